@@ -90,9 +90,11 @@ inline void CPyCppyy::CPPMethod::Copy_(const CPPMethod& /* other */)
 // fScope and fMethod handled separately
 
 // do not copy caches
-    fExecutor     = nullptr;
-    fArgIndices   = nullptr;
-    fArgsRequired = -1;
+    fExecutor      = nullptr;
+    fArgIndices    = nullptr;
+    fOffsetDerived = (Cppyy::TCppType_t)0;
+    fOffset        = 0;
+    fArgsRequired  = -1;
 }
 
 //----------------------------------------------------------------------------
@@ -336,7 +338,7 @@ void CPyCppyy::CPPMethod::SetPyError_(PyObject* msg)
 CPyCppyy::CPPMethod::CPPMethod(
         Cppyy::TCppScope_t scope, Cppyy::TCppMethod_t method) :
     fMethod(method), fScope(scope), fExecutor(nullptr), fArgIndices(nullptr),
-    fArgsRequired(-1)
+    fOffsetDerived((Cppyy::TCppType_t)0), fOffset(0), fArgsRequired(-1)
 {
    // empty
 }
@@ -1006,8 +1008,19 @@ PyObject* CPyCppyy::CPPMethod::Call(CPPInstance*& self,
 
 // calculate offset (the method expects 'this' to be an object of fScope)
     ptrdiff_t offset = 0;
-    if (derived && derived != fScope)
-        offset = Cppyy::GetBaseOffset(derived, fScope, object, 1 /* up-cast */);
+    if (derived && derived != fScope) {
+    // without virtual bases, the offset is the same for all objects of the derived class,
+    // so it is only calculated for the first call on that class (e.g. TH1F for TH1::Fill)
+        if (derived == fOffsetDerived)
+            offset = fOffset;
+        else {
+            offset = Cppyy::GetBaseOffset(derived, fScope, object, 1 /* up-cast */);
+            if (!Cppyy::HasVirtualBase(derived)) {
+                fOffsetDerived = derived;
+                fOffset = offset;
+            }
+        }
+    }
 
 // actual call; recycle self instead of returning new object for same address objects
     CPPInstance* pyobj = (CPPInstance*)Execute(object, offset, ctxt);
@@ -113,6 +113,10 @@ private:
     std::vector<Converter*>     fConverters;
     std::map<std::string, int>* fArgIndices;
 
+// offset of fScope in the last seen derived class, if it does not depend on the object
+    Cppyy::TCppType_t           fOffsetDerived;
+    ptrdiff_t                   fOffset;
+
 protected:
 // cached value that doubles as initialized flag (uninitialized if -1)
     int fArgsRequired;
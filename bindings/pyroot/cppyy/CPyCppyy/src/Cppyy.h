@@ -162,6 +162,8 @@ namespace Cppyy {
     CPPYY_IMPORT
     bool        HasComplexHierarchy(TCppType_t type);
     CPPYY_IMPORT
+    bool        HasVirtualBase(TCppType_t type);
+    CPPYY_IMPORT
     TCppIndex_t GetNumBases(TCppType_t type);
     CPPYY_IMPORT
     TCppIndex_t GetNumBasesLongestBranch(TCppType_t type);
@@ -54,6 +54,7 @@ PyObject* CPyCppyy::PyStrings::gEnd              = nullptr;
 PyObject* CPyCppyy::PyStrings::gFirst            = nullptr;
 PyObject* CPyCppyy::PyStrings::gSecond           = nullptr;
 PyObject* CPyCppyy::PyStrings::gSize             = nullptr;
+PyObject* CPyCppyy::PyStrings::gData             = nullptr;
 PyObject* CPyCppyy::PyStrings::gTemplate         = nullptr;
 PyObject* CPyCppyy::PyStrings::gVectorAt         = nullptr;
 PyObject* CPyCppyy::PyStrings::gInsert           = nullptr;
@@ -139,6 +140,7 @@ bool CPyCppyy::CreatePyStrings() {
     CPPYY_INITIALIZE_STRING(gFirst,          first);
     CPPYY_INITIALIZE_STRING(gSecond,         second);
     CPPYY_INITIALIZE_STRING(gSize,           size);
+    CPPYY_INITIALIZE_STRING(gData,           data);
     CPPYY_INITIALIZE_STRING(gTemplate,       Template);
     CPPYY_INITIALIZE_STRING(gVectorAt,       _vector__at);
     CPPYY_INITIALIZE_STRING(gInsert,         insert);
@@ -211,6 +213,7 @@ PyObject* CPyCppyy::DestroyPyStrings() {
     Py_DECREF(PyStrings::gFirst);       PyStrings::gFirst       = nullptr;
     Py_DECREF(PyStrings::gSecond);      PyStrings::gSecond      = nullptr;
     Py_DECREF(PyStrings::gSize);        PyStrings::gSize        = nullptr;
+    Py_DECREF(PyStrings::gData);        PyStrings::gData        = nullptr;
     Py_DECREF(PyStrings::gTemplate);    PyStrings::gTemplate    = nullptr;
     Py_DECREF(PyStrings::gVectorAt);    PyStrings::gVectorAt    = nullptr;
     Py_DECREF(PyStrings::gInsert);      PyStrings::gInsert      = nullptr;
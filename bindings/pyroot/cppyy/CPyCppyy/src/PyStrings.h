@@ -57,6 +57,7 @@ namespace PyStrings {
     extern PyObject* gFirst;
     extern PyObject* gSecond;
     extern PyObject* gSize;
+    extern PyObject* gData;
     extern PyObject* gTemplate;
     extern PyObject* gVectorAt;
     extern PyObject* gInsert;
@@ -528,14 +528,95 @@ PyObject* VectorData(PyObject* self, PyObject*)
 
 
 //---------------------------------------------------------------------------
-PyObject* VectorArray(PyObject* self, PyObject* /* args */)
+PyObject* VectorArray(PyObject* self, PyObject* args, PyObject* kwds)
 {
+// numpy array view on the data; numpy >= 2 passes dtype and copy as keywords
+    static const char* kwnames[] = {"dtype", "copy", nullptr};
+    PyObject* dtype = nullptr;
+    PyObject* copy = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, const_cast<char*>("|OO:__array__"),
+            const_cast<char**>(kwnames), &dtype, &copy))
+        return nullptr;
+
     PyObject* pydata = VectorData(self, nullptr);
+    if (!pydata)
+        return nullptr;
     PyObject* view = PyObject_CallMethodNoArgs(pydata, PyStrings::gArray);
     Py_DECREF(pydata);
+    if (!view)
+        return nullptr;
+
+// the memory has the element type, so convert rather than reinterpret for other dtypes
+    bool docopy = copy && copy != Py_None && PyObject_IsTrue(copy) == 1;
+    if (dtype && dtype != Py_None) {
+        PyObject* astype = PyObject_GetAttrString(view, "astype");
+        PyObject* cargs = PyTuple_Pack(1, dtype);
+        PyObject* ckwds = PyDict_New();
+        PyDict_SetItemString(ckwds, "copy", docopy ? Py_True : Py_False);
+        PyObject* converted = astype ? PyObject_Call(astype, cargs, ckwds) : nullptr;
+        Py_DECREF(ckwds);
+        Py_DECREF(cargs);
+        Py_XDECREF(astype);
+        Py_DECREF(view);
+        return converted;
+    }
+
+    if (docopy) {
+        PyObject* copied = CallPyObjMethod(view, "copy");
+        Py_DECREF(view);
+        return copied;
+    }
+
     return view;
 }
 
+#if PY_VERSION_HEX >= 0x03000000
+//---------------------------------------------------------------------------
+static int vector_getbuf(PyObject* self, Py_buffer* view, int flags)
+{
+// Export the memory of a contiguous container through the view on its data. The
+// container is the exporter, so that it is kept alive while the buffer is in use,
+// and the view, which holds shape and strides, is kept in the internal field.
+    PyObject* pydata = VectorData(self, nullptr);
+    if (!pydata)
+        return -1;
+
+    if (!LowLevelView_Check(pydata)) {
+        Py_DECREF(pydata);
+        PyErr_SetString(PyExc_BufferError, "container elements can not be exported as a buffer");
+        return -1;
+    }
+
+    if (PyObject_GetBuffer(pydata, view, flags) < 0) {
+        Py_DECREF(pydata);
+        return -1;
+    }
+
+    Py_DECREF(view->obj);      // reference to pydata taken by PyObject_GetBuffer
+    view->obj = self;
+    Py_INCREF(self);
+    view->internal = pydata;   // reference owned by the buffer
+
+    return 0;
+}
+
+static void vector_releasebuf(PyObject* /* self */, Py_buffer* view)
+{
+    Py_XDECREF((PyObject*)view->internal);
+    view->internal = nullptr;
+}
+
+static void AddBufferProtocol(PyObject* pyclass)
+{
+// heap types carry their own buffer slots
+    PyBufferProcs* procs = ((PyTypeObject*)pyclass)->tp_as_buffer;
+    if (procs) {
+        procs->bf_getbuffer = (getbufferproc)vector_getbuf;
+        procs->bf_releasebuffer = (releasebufferproc)vector_releasebuf;
+    }
+}
+#endif
+
 
 //-----------------------------------------------------------------------------
 static PyObject* vector_iter(PyObject* v) {
@@ -1808,8 +1889,11 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
             Utility::AddToClass(pyclass, "__real_data", "data");
             Utility::AddToClass(pyclass, "data", (PyCFunction)VectorData);
 
-        // numpy array conversion
-            Utility::AddToClass(pyclass, "__array__", (PyCFunction)VectorArray);
+        // numpy array conversion and buffer protocol, both without copy
+            Utility::AddToClass(pyclass, "__array__", (PyCFunction)VectorArray, METH_VARARGS | METH_KEYWORDS);
+#if PY_VERSION_HEX >= 0x03000000
+            AddBufferProtocol(pyclass);
+#endif
 
         // checked getitem
             if (HasAttrDirect(pyclass, PyStrings::gLen)) {
@@ -1846,6 +1930,17 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
         Utility::AddToClass(pyclass, "__init__", (PyCFunction)ArrayInit, METH_VARARGS | METH_KEYWORDS);
     }
 
+// other contiguous containers: data with size, numpy array conversion and buffer protocol
+    if ((IsTemplatedSTLClass(name, "array") || name.rfind("ROOT::VecOps::RVec<", 0) == 0) &&
+            HasAttrDirect(pyclass, PyStrings::gData) && HasAttrDirect(pyclass, PyStrings::gSize)) {
+        Utility::AddToClass(pyclass, "__real_data", "data");
+        Utility::AddToClass(pyclass, "data", (PyCFunction)VectorData);
+        Utility::AddToClass(pyclass, "__array__", (PyCFunction)VectorArray, METH_VARARGS | METH_KEYWORDS);
+#if PY_VERSION_HEX >= 0x03000000
+        AddBufferProtocol(pyclass);
+#endif
+    }
+
     else if (IsTemplatedSTLClass(name, "map") || IsTemplatedSTLClass(name, "unordered_map")) {
     // constructor that takes python associative collections
         Utility::AddToClass(pyclass, "__real_init", "__init__");
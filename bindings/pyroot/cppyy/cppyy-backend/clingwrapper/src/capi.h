@@ -124,6 +124,8 @@ extern "C" {
     RPY_EXPORTED
     int cppyy_has_complex_hierarchy(cppyy_type_t type);
     RPY_EXPORTED
+    int cppyy_has_virtual_base(cppyy_type_t type);
+    RPY_EXPORTED
     int cppyy_num_bases(cppyy_type_t type);
     RPY_EXPORTED
     int cppyy_num_bases_longest_branch(cppyy_type_t type);
@@ -1291,6 +1291,23 @@ bool Cppyy::HasComplexHierarchy(TCppType_t klass)
     return is_complex;
 }
 
+bool Cppyy::HasVirtualBase(TCppType_t klass)
+{
+// Determine whether any class in the hierarchy is a virtual base, in which case the
+// offsets of the base classes depend on the actual object.
+    TClassRef& cr = type_from_handle(klass);
+    if (!cr.GetClass() || !cr->GetListOfBases())
+        return false;
+
+    for (auto obj : *cr->GetListOfBases()) {
+        TBaseClass* base = (TBaseClass*)obj;
+        if ((base->Property() & kIsVirtualBase) || HasVirtualBase(GetScope(base->GetName())))
+            return true;
+    }
+
+    return false;
+}
+
 Cppyy::TCppIndex_t Cppyy::GetNumBases(TCppType_t klass)
 {
 // Get the total number of base classes that this class has.
@@ -2574,6 +2591,10 @@ int cppyy_has_complex_hierarchy(cppyy_type_t type) {
     return (int)Cppyy::HasComplexHierarchy(type);
 }
 
+int cppyy_has_virtual_base(cppyy_type_t type) {
+    return (int)Cppyy::HasVirtualBase(type);
+}
+
 int cppyy_num_bases(cppyy_type_t type) {
     return (int)Cppyy::GetNumBases(type);
 }
@@ -138,6 +138,8 @@ namespace Cppyy {
     RPY_EXPORTED
     bool        HasComplexHierarchy(TCppType_t type);
     RPY_EXPORTED
+    bool        HasVirtualBase(TCppType_t type);
+    RPY_EXPORTED
     TCppIndex_t GetNumBases(TCppType_t type);
     RPY_EXPORTED
     TCppIndex_t GetNumBasesLongestBranch(TCppType_t type);
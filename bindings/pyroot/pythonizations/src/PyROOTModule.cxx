@@ -74,8 +74,14 @@ static PyMethodDef gPyROOTMethods[] = {
     (char *)"Add equality and inequality comparison operators to TObject"},
    {(char *)"BranchPyz", (PyCFunction)PyROOT::BranchPyz, METH_VARARGS,
     (char *)"Fully enable the use of TTree::Branch from Python"},
+   {(char *)"ReadArrays", (PyCFunction)PyROOT::ReadArrays, METH_VARARGS,
+    (char *)"Read whole TTree columns into buffers through the bulk I/O interface"},
    {(char *)"AddPrettyPrintingPyz", (PyCFunction)PyROOT::AddPrettyPrintingPyz, METH_VARARGS,
     (char *)"Add pretty printing pythonization"},
+   {(char *)"AddReleaseGILPyz", (PyCFunction)PyROOT::AddReleaseGILPyz, METH_VARARGS,
+    (char *)"Release the GIL in long-running ROOT entry points"},
+   {(char *)"AddRDFNumbaPyz", (PyCFunction)PyROOT::AddRDFNumbaPyz, METH_VARARGS,
+    (char *)"Accept numba-compiled functions in RDataFrame Define and Filter"},
    {(char *)"InitApplication", (PyCFunction)PyROOT::RPyROOTApplication::InitApplication, METH_VARARGS,
     (char *)"Initialize interactive ROOT use from Python"},
    {(char *)"InstallGUIEventInputHook", (PyCFunction)PyROOT::RPyROOTApplication::InstallGUIEventInputHook, METH_NOARGS,
@@ -149,6 +155,20 @@ extern "C" PyObject *PyInit_libROOTPythonizations()
    // setup PyROOT
    PyROOT::Init();
 
+   // global pythonizors implemented in C++: GIL release in known long-running
+   // entry points, numba-compiled callables in RDataFrame
+   if (PyObject *cppyy = PyImport_ImportModule("libcppyy")) {
+      for (const char *name : {"AddReleaseGILPyz", "AddRDFNumbaPyz"}) {
+         PyObject *pyz = PyObject_GetAttrString(gRootModule, name);
+         PyObject *res = pyz ? PyObject_CallMethod(cppyy, (char *)"add_pythonization", (char *)"Os", pyz, "") : nullptr;
+         Py_XDECREF(res);
+         Py_XDECREF(pyz);
+      }
+      Py_DECREF(cppyy);
+   }
+   if (PyErr_Occurred())
+      PyErr_Clear();
+
    // signal policy: don't abort interpreter in interactive mode
    CallContext::SetGlobalSignalPolicy(!gROOT->IsBatch());
 
@@ -22,6 +22,7 @@ PyObject *AddPrettyPrintingPyz(PyObject *self, PyObject *args);
 
 PyObject *GetBranchAttr(PyObject *self, PyObject *args);
 PyObject *BranchPyz(PyObject *self, PyObject *args);
+PyObject *ReadArrays(PyObject *self, PyObject *args);
 
 PyObject *AddTClassDynamicCastPyz(PyObject *self, PyObject *args);
 
@@ -29,6 +30,10 @@ PyObject *AddTObjectEqNePyz(PyObject *self, PyObject *args);
 
 PyObject *CPPInstanceExpand(PyObject *self, PyObject *args);
 
+PyObject *AddReleaseGILPyz(PyObject *self, PyObject *args);
+
+PyObject *AddRDFNumbaPyz(PyObject *self, PyObject *args);
+
 } // namespace PyROOT
 
 #endif // !PYROOT_PYTHONIZE_H
@@ -0,0 +1,235 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Bindings
+#include "CPyCppyy/API.h"
+
+#include "../../cppyy/CPyCppyy/src/CPyCppyy.h"
+#include "../../cppyy/CPyCppyy/src/Utility.h"
+
+#include "PyROOTPythonize.h"
+
+// Standard
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace CPyCppyy;
+
+namespace {
+
+// Map the name of a numba scalar type (as given by str() on the type) to the
+// corresponding C++ type. Pointers are written as "float64*" by numba.
+bool NumbaToCppType(std::string nbtype, std::string &cpptype, bool &isPointer)
+{
+   isPointer = !nbtype.empty() && nbtype.back() == '*';
+   if (isPointer)
+      nbtype.pop_back();
+
+   static const std::pair<const char *, const char *> gTypes[] = {
+      {"float64", "double"}, {"float32", "float"},   {"int64", "Long64_t"},       {"int32", "int"},
+      {"int16", "short"},    {"int8", "signed char"}, {"uint64", "ULong64_t"},     {"uint32", "unsigned int"},
+      {"uint16", "unsigned short"}, {"uint8", "unsigned char"}, {"bool", "bool"}, {"boolean", "bool"}};
+
+   for (const auto &t : gTypes) {
+      if (nbtype == t.first) {
+         cpptype = t.second;
+         return true;
+      }
+   }
+   return false;
+}
+
+std::string PyStr(PyObject *obj)
+{
+   std::string result;
+   if (PyObject *pystr = PyObject_Str(obj)) {
+      result = CPyCppyy_PyText_AsString(pystr);
+      Py_DECREF(pystr);
+   }
+   return result;
+}
+
+// A numba cfunc exposes the address of the compiled function and its signature
+bool IsNumbaCFunc(PyObject *callable)
+{
+   return PyObject_HasAttrString(callable, "address") && PyObject_HasAttrString(callable, "_sig");
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Build a jitted RDataFrame expression that calls the compiled function
+/// directly through its address. Scalar arguments take one column each; a
+/// pointer argument followed by an integer argument takes one RVec column,
+/// which is passed as (data, size), so that the whole collection of an entry
+/// is handed over in a single call.
+bool MakeNumbaExpression(PyObject *cfunc, PyObject *pycolumns, std::string &expr)
+{
+   std::vector<std::string> columns;
+   PyObject *seq = PySequence_Fast(pycolumns, "columns must be given as a sequence of strings");
+   if (!seq)
+      return false;
+   for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(seq); ++i)
+      columns.emplace_back(PyStr(PySequence_Fast_GET_ITEM(seq, i)));
+   Py_DECREF(seq);
+
+   PyObject *pyaddr = PyObject_GetAttrString(cfunc, "address");
+   PyObject *pysig = PyObject_GetAttrString(cfunc, "_sig");
+   PyObject *pyret = pysig ? PyObject_GetAttrString(pysig, "return_type") : nullptr;
+   PyObject *pyargs = pysig ? PyObject_GetAttrString(pysig, "args") : nullptr;
+   PyObject *argseq = pyargs ? PySequence_Fast(pyargs, "invalid numba signature") : nullptr;
+
+   bool ok = pyaddr && pyret && argseq;
+   std::string rettype, proto, call;
+   bool isPointer = false;
+   if (ok && (!NumbaToCppType(PyStr(pyret), rettype, isPointer) || isPointer)) {
+      PyErr_Format(PyExc_TypeError, "unsupported numba return type %s", PyStr(pyret).c_str());
+      ok = false;
+   }
+
+   std::size_t icol = 0;
+   const Py_ssize_t nargs = ok ? PySequence_Fast_GET_SIZE(argseq) : 0;
+   for (Py_ssize_t i = 0; ok && i < nargs; ++i) {
+      std::string cpptype, sizetype;
+      const std::string nbtype = PyStr(PySequence_Fast_GET_ITEM(argseq, i));
+      if (!NumbaToCppType(nbtype, cpptype, isPointer)) {
+         PyErr_Format(PyExc_TypeError, "unsupported numba argument type %s", nbtype.c_str());
+         ok = false;
+         break;
+      }
+      if (icol >= columns.size()) {
+         PyErr_Format(PyExc_TypeError, "numba function takes more arguments than the %d columns given",
+                      (int)columns.size());
+         ok = false;
+         break;
+      }
+      const std::string &col = columns[icol++];
+      if (!proto.empty()) {
+         proto += ", ";
+         call += ", ";
+      }
+      if (isPointer) {
+         bool sizeIsPointer = true;
+         if (i + 1 >= nargs ||
+             !NumbaToCppType(PyStr(PySequence_Fast_GET_ITEM(argseq, i + 1)), sizetype, sizeIsPointer) ||
+             sizeIsPointer || sizetype == "double" || sizetype == "float" || sizetype == "bool") {
+            PyErr_Format(PyExc_TypeError, "pointer argument %d of numba function must be followed by its size",
+                         (int)i);
+            ok = false;
+            break;
+         }
+         ++i;
+         proto += cpptype + "*, " + sizetype;
+         call += "const_cast<" + cpptype + "*>(" + col + ".data()), (" + sizetype + ")" + col + ".size()";
+      } else {
+         proto += cpptype;
+         call += col;
+      }
+   }
+   if (ok && icol != columns.size()) {
+      PyErr_Format(PyExc_TypeError, "numba function takes %d columns, but %d were given", (int)icol,
+                   (int)columns.size());
+      ok = false;
+   }
+
+   if (ok) {
+      const auto address = PyLong_AsUnsignedLongLong(pyaddr);
+      char addr[32];
+      snprintf(addr, sizeof(addr), "0x%llx", (unsigned long long)address);
+      expr = "reinterpret_cast<" + rettype + "(*)(" + proto + ")>(" + addr + ")(" + call + ")";
+      ok = !PyErr_Occurred();
+   }
+
+   Py_XDECREF(argseq);
+   Py_XDECREF(pyargs);
+   Py_XDECREF(pyret);
+   Py_XDECREF(pysig);
+   Py_XDECREF(pyaddr);
+   return ok;
+}
+
+PyObject *CallOriginal(PyObject *self, const char *name, PyObject *args, PyObject *kwds)
+{
+   PyObject *meth = PyObject_GetAttrString(self, name);
+   if (!meth)
+      return nullptr;
+   PyObject *result = PyObject_Call(meth, args, kwds);
+   Py_DECREF(meth);
+   return result;
+}
+
+// Define(name, cfunc, columns)
+PyObject *RDFNumbaDefine(PyObject *self, PyObject *args, PyObject *kwds)
+{
+   if (PyTuple_GET_SIZE(args) != 3 || kwds || !IsNumbaCFunc(PyTuple_GET_ITEM(args, 1)))
+      return CallOriginal(self, "_OriginalDefine", args, kwds);
+
+   std::string expr;
+   if (!MakeNumbaExpression(PyTuple_GET_ITEM(args, 1), PyTuple_GET_ITEM(args, 2), expr))
+      return nullptr;
+
+   PyObject *newargs = Py_BuildValue("(Os)", PyTuple_GET_ITEM(args, 0), expr.c_str());
+   PyObject *result = CallOriginal(self, "_OriginalDefine", newargs, nullptr);
+   Py_DECREF(newargs);
+   return result;
+}
+
+// Filter(cfunc, columns[, name])
+PyObject *RDFNumbaFilter(PyObject *self, PyObject *args, PyObject *kwds)
+{
+   const auto nargs = PyTuple_GET_SIZE(args);
+   if (nargs < 2 || nargs > 3 || kwds || !IsNumbaCFunc(PyTuple_GET_ITEM(args, 0)))
+      return CallOriginal(self, "_OriginalFilter", args, kwds);
+
+   std::string expr;
+   if (!MakeNumbaExpression(PyTuple_GET_ITEM(args, 0), PyTuple_GET_ITEM(args, 1), expr))
+      return nullptr;
+
+   PyObject *newargs = nargs == 3 ? Py_BuildValue("(sO)", expr.c_str(), PyTuple_GET_ITEM(args, 2))
+                                  : Py_BuildValue("(s)", expr.c_str());
+   PyObject *result = CallOriginal(self, "_OriginalFilter", newargs, nullptr);
+   Py_DECREF(newargs);
+   return result;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Accept numba-compiled functions in RDataFrame Define and Filter
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args Pointer to a Python tuple object containing the arguments
+/// received from Python: the class proxy and its fully qualified name.
+///
+/// This is registered as a global pythonizor and acts on the RInterface
+/// instantiations. A `numba.cfunc` can be passed in place of the expression:
+/// ~~~{.py}
+/// @numba.cfunc("float64(float64*, int64)")
+/// def sum_pt(pt, n): ...
+/// df.Define("sumpt", sum_pt, ["Muon_pt"])
+/// ~~~
+/// The call is jitted as a direct call through the address of the compiled
+/// function, so the event loop never goes back to Python. RVec columns are
+/// passed as a (pointer, size) pair, i.e. the whole collection of an entry is
+/// processed by one call without conversions.
+PyObject *PyROOT::AddRDFNumbaPyz(PyObject * /* self */, PyObject *args)
+{
+   PyObject *pyclass = nullptr;
+   const char *pyname = nullptr;
+   if (!PyArg_ParseTuple(args, "Os:AddRDFNumbaPyz", &pyclass, &pyname))
+      return nullptr;
+
+   if (std::string(pyname).rfind("ROOT::RDF::RInterface<", 0) != 0)
+      Py_RETURN_NONE;
+
+   if (Utility::AddToClass(pyclass, "_OriginalDefine", "Define"))
+      Utility::AddToClass(pyclass, "Define", (PyCFunction)RDFNumbaDefine, METH_VARARGS | METH_KEYWORDS);
+   if (Utility::AddToClass(pyclass, "_OriginalFilter", "Filter"))
+      Utility::AddToClass(pyclass, "Filter", (PyCFunction)RDFNumbaFilter, METH_VARARGS | METH_KEYWORDS);
+   PyErr_Clear();
+
+   Py_RETURN_NONE;
+}
@@ -0,0 +1,95 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Bindings
+#include "CPyCppyy/API.h"
+#include "PyROOTPythonize.h"
+
+// ROOT
+#include "TEnv.h"
+
+// Standard
+#include <cstring>
+
+namespace {
+
+struct ReleaseGILEntry {
+   const char *fClass;        ///< class name, or name prefix of a class template if ending in '<'
+   const char *fMethods[4];   ///< null-terminated list of method names
+};
+
+// Entry points that are known to run for a long time without calling back
+// into Python (or, if they do, through wrappers that re-acquire the GIL).
+const ReleaseGILEntry gReleaseGIL[] = {
+   {"TFile", {"Open", "Cp", nullptr}},
+   {"TFileMerger", {"Merge", "PartialMerge", nullptr}},
+   {"TTree", {"Draw", "Process", "CopyTree", nullptr}},
+   {"TChain", {"Draw", "Process", "Merge", nullptr}},
+   {"TH1", {"Fit", nullptr}},
+   {"TGraph", {"Fit", nullptr}},
+   {"RooAbsPdf", {"fitTo", nullptr}},
+   {"TMVA::Factory", {"TrainAllMethods", "TestAllMethods", "EvaluateAllMethods", nullptr}},
+   {"ROOT::RDF::RResultPtr<", {"GetValue", "GetPtr", "__deref__", nullptr}},
+   {"ROOT::RDF::RInterface<", {"Foreach", "ForeachSlot", "Snapshot", nullptr}},
+};
+
+bool MatchesClass(const char *entry, const std::string &name)
+{
+   const auto len = std::strlen(entry);
+   if (len && entry[len - 1] == '<')
+      return name.compare(0, len, entry) == 0;
+   return name == entry;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Release the GIL in long-running ROOT entry points
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args Pointer to a Python tuple object containing the arguments
+/// received from Python: the class proxy and its fully qualified name.
+///
+/// This is registered as a global pythonizor, so that it sees every class.
+/// For the classes in the list above, the `__release_gil__` policy is set on
+/// the listed methods, which lets other Python threads run while the C++
+/// call (event loop, fit, merge, ...) is in progress. Callbacks into Python
+/// that go through TPyDispatcher or cppyy-generated wrappers re-acquire the
+/// GIL. The default can be switched off with `PyROOT.ReleaseGIL: 0` in
+/// .rootrc.
+PyObject *PyROOT::AddReleaseGILPyz(PyObject * /* self */, PyObject *args)
+{
+   PyObject *pyclass = nullptr;
+   const char *pyname = nullptr;
+   if (!PyArg_ParseTuple(args, "Os:AddReleaseGILPyz", &pyclass, &pyname))
+      return nullptr;
+
+   static const bool enabled = gEnv->GetValue("PyROOT.ReleaseGIL", 1) != 0;
+   if (!enabled)
+      Py_RETURN_NONE;
+
+   const std::string name = pyname;
+   for (const auto &entry : gReleaseGIL) {
+      if (!MatchesClass(entry.fClass, name))
+         continue;
+
+      for (auto meth = entry.fMethods; *meth; ++meth) {
+         PyObject *pymeth = PyObject_GetAttrString(pyclass, *meth);
+         if (!pymeth) {
+            // method not available in this version or configuration
+            PyErr_Clear();
+            continue;
+         }
+         if (PyObject_SetAttrString(pymeth, "__release_gil__", Py_True) != 0)
+            PyErr_Clear(); // not a C++ overload, e.g. replaced by a Python pythonization
+         Py_DECREF(pymeth);
+      }
+      break;
+   }
+
+   Py_RETURN_NONE;
+}
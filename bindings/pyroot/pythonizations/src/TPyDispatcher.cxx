@@ -21,6 +21,22 @@
 // Standard
 #include <stdarg.h>
 
+namespace {
+
+// Callbacks may arrive from C++ code that was entered with the GIL released
+// (see ReleaseGILPyz.cxx), so always (re-)acquire it before touching Python.
+class TPyGILGuard {
+   PyGILState_STATE fState;
+
+public:
+   TPyGILGuard() : fState(PyGILState_Ensure()) {}
+   ~TPyGILGuard() { PyGILState_Release(fState); }
+   TPyGILGuard(const TPyGILGuard &) = delete;
+   TPyGILGuard &operator=(const TPyGILGuard &) = delete;
+};
+
+} // namespace
+
 //______________________________________________________________________________
 //                         Python callback dispatcher
 //                         ==========================
@@ -73,6 +89,7 @@ TPyDispatcher::~TPyDispatcher()
 //- public members -----------------------------------------------------------
 PyObject *TPyDispatcher::DispatchVA(const char *format, ...)
 {
+   TPyGILGuard gil;
    // Dispatch the arguments to the held callable python object, using format to
    // interpret the types of the arguments. Note that format is in python style,
    // not in C printf style. See: https://docs.python.org/2/c-api/arg.html .
@@ -113,6 +130,7 @@ PyObject *TPyDispatcher::DispatchVA(const char *format, ...)
 
 PyObject *TPyDispatcher::DispatchVA1(const char *clname, void *obj, const char *format, ...)
 {
+   TPyGILGuard gil;
    PyObject *pyobj = CPyCppyy::Instance_FromVoidPtr(obj, clname);
    if (!pyobj) {
       PyErr_Print();
@@ -170,6 +188,7 @@ PyObject *TPyDispatcher::DispatchVA1(const char *clname, void *obj, const char *
 
 PyObject *TPyDispatcher::Dispatch(TPad *selpad, TObject *selected, Int_t event)
 {
+   TPyGILGuard gil;
    PyObject *args = PyTuple_New(3);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::Instance_FromVoidPtr(selpad, "TPad"));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::Instance_FromVoidPtr(selected, "TObject"));
@@ -190,6 +209,7 @@ PyObject *TPyDispatcher::Dispatch(TPad *selpad, TObject *selected, Int_t event)
 
 PyObject *TPyDispatcher::Dispatch(Int_t event, Int_t x, Int_t y, TObject *selected)
 {
+   TPyGILGuard gil;
    PyObject *args = PyTuple_New(4);
    PyTuple_SET_ITEM(args, 0, PyLong_FromLong(event));
    PyTuple_SET_ITEM(args, 1, PyLong_FromLong(x));
@@ -211,6 +231,7 @@ PyObject *TPyDispatcher::Dispatch(Int_t event, Int_t x, Int_t y, TObject *select
 
 PyObject *TPyDispatcher::Dispatch(TVirtualPad *pad, TObject *obj, Int_t event)
 {
+   TPyGILGuard gil;
    PyObject *args = PyTuple_New(3);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::Instance_FromVoidPtr(pad, "TVirtualPad"));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::Instance_FromVoidPtr(obj, "TObject"));
@@ -231,6 +252,7 @@ PyObject *TPyDispatcher::Dispatch(TVirtualPad *pad, TObject *obj, Int_t event)
 
 PyObject *TPyDispatcher::Dispatch(TGListTreeItem *item, TDNDData *data)
 {
+   TPyGILGuard gil;
    PyObject *args = PyTuple_New(2);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::Instance_FromVoidPtr(item, "TGListTreeItem"));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::Instance_FromVoidPtr(data, "TDNDData"));
@@ -250,6 +272,7 @@ PyObject *TPyDispatcher::Dispatch(TGListTreeItem *item, TDNDData *data)
 
 PyObject *TPyDispatcher::Dispatch(const char *name, const TList *attr)
 {
+   TPyGILGuard gil;
    PyObject *args = PyTuple_New(2);
    PyTuple_SET_ITEM(args, 0, PyBytes_FromString(name));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::Instance_FromVoidPtr((void *)attr, "TList"));
@@ -269,6 +292,7 @@ PyObject *TPyDispatcher::Dispatch(const char *name, const TList *attr)
 
 PyObject *TPyDispatcher::Dispatch(TSlave *slave, TProofProgressInfo *pi)
 {
+   TPyGILGuard gil;
    PyObject *args = PyTuple_New(2);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::Instance_FromVoidPtr(slave, "TSlave"));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::Instance_FromVoidPtr(pi, "TProofProgressInfo"));
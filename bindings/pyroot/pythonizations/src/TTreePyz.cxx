@@ -29,8 +29,11 @@
 #include "TLeaf.h"
 #include "TLeafElement.h"
 #include "TLeafObject.h"
+#include "TMath.h"
 #include "TStreamerElement.h"
 #include "TStreamerInfo.h"
+#include "TBufferFile.h"
+#include "TVirtualCollectionProxy.h"
 
 #include <algorithm>
 #include <sstream>
@@ -375,3 +378,246 @@ PyObject *PyROOT::BranchPyz(PyObject * /* self */, PyObject *args)
    // Not the overload we wanted to pythonize, return None
    Py_RETURN_NONE;
 }
+
+namespace {
+
+// Python buffer format character and size of the values of a bulk-readable type
+bool GetBulkFormat(EDataType type, char &format, int &size)
+{
+   switch (type) {
+   case kChar_t: format = 'b'; size = 1; return true;
+   case kUChar_t: format = 'B'; size = 1; return true;
+   case kBool_t: format = '?'; size = 1; return true;
+   case kShort_t: format = 'h'; size = 2; return true;
+   case kUShort_t: format = 'H'; size = 2; return true;
+   case kInt_t: format = 'i'; size = 4; return true;
+   case kUInt_t: format = 'I'; size = 4; return true;
+   case kFloat_t: format = 'f'; size = 4; return true;
+   case kLong64_t: format = 'q'; size = 8; return true;
+   case kULong64_t: format = 'Q'; size = 8; return true;
+   case kDouble_t: format = 'd'; size = 8; return true;
+   default: return false;
+   }
+}
+
+struct BulkColumn {
+   std::string fName;
+   char fFormat = 0;
+   int fSize = 0;
+   bool fJagged = false;            ///< variable-size array or std::vector
+   Long64_t fLen = 1;               ///< number of values per entry (fixed size) or per count (variable-size array)
+   std::vector<char> fContent;      ///< values of all entries, contiguous
+   std::vector<Long64_t> fOffsets;  ///< for jagged columns: offset of each entry in fContent, plus the end
+   std::string fError;
+};
+
+// Find the type of the values stored on a bulk-readable branch
+bool InitBulkColumn(TBranch *branch, BulkColumn &col)
+{
+   if (!branch || !branch->SupportsBulkRead()) {
+      col.fError = "branch " + col.fName + " cannot be read in bulk";
+      return false;
+   }
+   TLeaf *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->At(0));
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   branch->GetExpectedType(cl, type);
+   if (cl && cl->GetCollectionProxy()) {
+      type = cl->GetCollectionProxy()->GetType();
+      col.fJagged = true;
+   } else if (leaf->GetLeafCount()) {
+      col.fJagged = true;
+      col.fLen = leaf->GetLenStatic();
+   } else {
+      col.fLen = leaf->GetLen();
+   }
+   if (!GetBulkFormat(type, col.fFormat, col.fSize)) {
+      col.fError = "branch " + col.fName + " has an unsupported type";
+      return false;
+   }
+   if (col.fJagged)
+      col.fOffsets.push_back(0);
+   return true;
+}
+
+// Read the entries [begin, end) of one column, one basket at a time. Runs
+// without the GIL.
+bool ReadBulkColumn(TTree *tree, Long64_t begin, Long64_t end, BulkColumn &col)
+{
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile counts(TBuffer::kWrite, 4 * 1024);
+   TTree *current = nullptr;
+   TBranch *branch = nullptr;
+
+   for (Long64_t entry = begin; entry < end;) {
+      const Long64_t local = tree->LoadTree(entry);
+      if (local < 0) {
+         col.fError = "cannot load entry " + std::to_string(entry);
+         return false;
+      }
+      if (tree->GetTree() != current) {
+         current = tree->GetTree();
+         branch = current->GetBranch(col.fName.c_str());
+         if (!branch || !branch->SupportsBulkRead()) {
+            col.fError = "branch " + col.fName + " cannot be read in bulk in " + current->GetName();
+            return false;
+         }
+      }
+
+      // GetBulkEntries only reads whole baskets, so start from the first entry of the basket
+      // holding the requested one
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const Long64_t first = basketEntry[TMath::BinarySearch(branch->GetWriteBasket() + 1, basketEntry, local)];
+      counts.SetBufferOffset(0);
+      const Int_t n = branch->GetBulkRead().GetBulkEntries(first, buf, col.fJagged ? &counts : nullptr);
+      if (n <= 0) {
+         col.fError = "bulk read of branch " + col.fName + " failed at entry " + std::to_string(entry);
+         return false;
+      }
+      const Long64_t skip = local - first;
+      const Long64_t take = std::min<Long64_t>(n - skip, end - entry);
+      const char *values = buf.GetCurrent();
+
+      if (col.fJagged) {
+         const Int_t *sizes = reinterpret_cast<const Int_t *>(counts.GetCurrent());
+         Long64_t start = 0;
+         for (Long64_t i = 0; i < skip; ++i)
+            start += sizes[i] * col.fLen;
+         Long64_t nvalues = 0;
+         for (Long64_t i = skip; i < skip + take; ++i) {
+            nvalues += sizes[i] * col.fLen;
+            col.fOffsets.push_back(col.fOffsets.back() + sizes[i] * col.fLen);
+         }
+         col.fContent.insert(col.fContent.end(), values + start * col.fSize, values + (start + nvalues) * col.fSize);
+      } else {
+         const Long64_t stride = col.fLen * col.fSize;
+         col.fContent.insert(col.fContent.end(), values + skip * stride, values + (skip + take) * stride);
+      }
+      entry += take;
+   }
+   return true;
+}
+
+// Wrap a copy of the given bytes in a memoryview of the given format, so that
+// numpy.asarray() and awkward can use it without a further copy
+PyObject *MakeBulkView(const char *data, Py_ssize_t nbytes, char format, int size, Long64_t len)
+{
+   PyObject *bytes = PyByteArray_FromStringAndSize(data, nbytes);
+   if (!bytes)
+      return nullptr;
+   PyObject *view = PyMemoryView_FromObject(bytes);
+   Py_DECREF(bytes);
+   if (!view)
+      return nullptr;
+   const char fmt[2] = {format, '\0'};
+   PyObject *result = nullptr;
+   if (len > 1) {
+      PyObject *shape = Py_BuildValue("(nn)", (Py_ssize_t)(nbytes / (size * len)), (Py_ssize_t)len);
+      result = shape ? PyObject_CallMethod(view, "cast", "sO", fmt, shape) : nullptr;
+      Py_XDECREF(shape);
+   } else {
+      result = PyObject_CallMethod(view, "cast", "s", fmt);
+   }
+   Py_DECREF(view);
+   return result;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Read whole columns of a TTree or TChain into Python buffers
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args Pointer to a Python tuple object containing the arguments
+/// received from Python: the tree, a sequence of branch names and optionally
+/// the first and the one-past-last entry to read.
+///
+/// The branches are read one basket at a time through the bulk I/O interface
+/// of TBranch (TBranch::GetBulkEntries), without the GIL and without creating
+/// a Python object per entry. Fixed-size leaves (also `x[3]/F`), variable-size
+/// arrays (`x[n]/F`) and std::vector of arithmetic types are supported.
+///
+/// The result is a dictionary that maps each branch name to a typed
+/// memoryview of its values (two-dimensional for fixed-size arrays), or, for
+/// variable-size columns, to an (offsets, content) pair of memoryviews as
+/// expected by awkward's ListOffsetArray. Both can be turned into numpy
+/// arrays with numpy.asarray() without copying.
+PyObject *PyROOT::ReadArrays(PyObject * /* self */, PyObject *args)
+{
+   PyObject *pytree = nullptr, *pycolumns = nullptr;
+   long long begin = 0, end = -1;
+   if (!PyArg_ParseTuple(args, "O!O|LL:ReadArrays", &CPPInstance_Type, &pytree, &pycolumns, &begin, &end))
+      return nullptr;
+
+   TClass *cl = GetTClass(pytree);
+   if (!cl || !cl->InheritsFrom(TTree::Class())) {
+      PyErr_SetString(PyExc_TypeError, "ReadArrays: first argument must be a TTree");
+      return nullptr;
+   }
+   TTree *tree = (TTree *)cl->DynamicCast(TTree::Class(), ((CPPInstance *)pytree)->GetObject());
+   if (!tree) {
+      PyErr_SetString(PyExc_ReferenceError, "ReadArrays: attempt to access a null-pointer");
+      return nullptr;
+   }
+
+   PyObject *seq = PySequence_Fast(pycolumns, "ReadArrays: columns must be a sequence of branch names");
+   if (!seq)
+      return nullptr;
+   std::vector<BulkColumn> columns(PySequence_Fast_GET_SIZE(seq));
+   for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(seq); ++i) {
+      PyObject *pyname = PyObject_Str(PySequence_Fast_GET_ITEM(seq, i));
+      if (!pyname) {
+         Py_DECREF(seq);
+         return nullptr;
+      }
+      columns[i].fName = CPyCppyy_PyText_AsString(pyname);
+      Py_DECREF(pyname);
+   }
+   Py_DECREF(seq);
+
+   const Long64_t nentries = tree->GetEntries();
+   if (end < 0 || end > nentries)
+      end = nentries;
+   if (begin < 0 || begin > end) {
+      PyErr_Format(PyExc_ValueError, "ReadArrays: invalid entry range [%lld, %lld)", begin, end);
+      return nullptr;
+   }
+
+   Py_BEGIN_ALLOW_THREADS
+   for (auto &col : columns) {
+      if (tree->LoadTree(begin < end ? begin : 0) < 0) {
+         col.fError = "cannot load the first entry of the tree";
+         break;
+      }
+      if (!InitBulkColumn(tree->GetTree()->GetBranch(col.fName.c_str()), col) || !ReadBulkColumn(tree, begin, end, col))
+         break;
+   }
+   Py_END_ALLOW_THREADS
+
+   for (const auto &col : columns) {
+      if (!col.fError.empty()) {
+         PyErr_Format(PyExc_RuntimeError, "ReadArrays: %s", col.fError.c_str());
+         return nullptr;
+      }
+   }
+
+   PyObject *result = PyDict_New();
+   for (const auto &col : columns) {
+      PyObject *content = MakeBulkView(col.fContent.data(), col.fContent.size(), col.fFormat, col.fSize,
+                                       col.fJagged ? 1 : col.fLen);
+      PyObject *item = content;
+      if (content && col.fJagged) {
+         PyObject *offsets = MakeBulkView(reinterpret_cast<const char *>(col.fOffsets.data()),
+                                          col.fOffsets.size() * sizeof(Long64_t), 'q', 8, 1);
+         item = offsets ? PyTuple_Pack(2, offsets, content) : nullptr;
+         Py_XDECREF(offsets);
+         Py_DECREF(content);
+      }
+      if (!item || PyDict_SetItemString(result, col.fName.c_str(), item) != 0) {
+         Py_XDECREF(item);
+         Py_DECREF(result);
+         return nullptr;
+      }
+      Py_DECREF(item);
+   }
+   return result;
+}
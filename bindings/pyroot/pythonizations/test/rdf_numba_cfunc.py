@@ -0,0 +1,75 @@
+import unittest
+
+import ROOT
+
+try:
+    import numba
+except ImportError:
+    numba = None
+
+
+@unittest.skipIf(numba is None, "numba is not available")
+class RDataFrameNumbaCFunc(unittest.TestCase):
+    """
+    Test the numba cfuncs passed to RDataFrame Define and Filter
+    (see RDataFrameNumbaPyz.cxx)
+    """
+
+    def make_df(self):
+        return (
+            ROOT.RDataFrame(10)
+            .Define("x", "double(rdfentry_)")
+            .Define("n", "Long64_t(rdfentry_)")
+            .Define("v", "ROOT::RVecD(rdfentry_ % 4, 1.5)")
+        )
+
+    def test_define_scalar(self):
+        @numba.cfunc("float64(float64, int64)")
+        def f(x, n):
+            return 2 * x + n
+
+        df = self.make_df().Define("y", f, ["x", "n"])
+        self.assertEqual(list(df.Take["double"]("y").GetValue()), [3.0 * i for i in range(10)])
+
+    def test_define_rvec(self):
+        @numba.cfunc("float64(float64*, int64)")
+        def vsum(v, size):
+            s = 0.0
+            for i in range(size):
+                s += v[i]
+            return s
+
+        df = self.make_df().Define("s", vsum, ["v"])
+        self.assertEqual(list(df.Take["double"]("s").GetValue()), [1.5 * (i % 4) for i in range(10)])
+
+    def test_filter(self):
+        @numba.cfunc("boolean(int64)")
+        def even(n):
+            return n % 2 == 0
+
+        df = self.make_df()
+        self.assertEqual(df.Filter(even, ["n"]).Count().GetValue(), 5)
+
+        # with a name, which shows up in the report
+        filtered = df.Filter(even, ["n"], "even")
+        self.assertEqual(filtered.Count().GetValue(), 5)
+        report = filtered.Report()
+        self.assertEqual(report.At("even").GetPass(), 5)
+
+    def test_wrong_number_of_columns(self):
+        @numba.cfunc("float64(float64)")
+        def f(x):
+            return x
+
+        with self.assertRaises(TypeError):
+            self.make_df().Define("y", f, ["x", "n"])
+
+    def test_original_overloads(self):
+        """Expressions that are not numba cfuncs still go to the original Define and Filter"""
+        df = self.make_df().Define("y", "x + 1").Filter("n > 4", "gt4")
+        self.assertEqual(df.Count().GetValue(), 5)
+        self.assertEqual(df.Sum("y").GetValue(), sum(i + 1.0 for i in range(5, 10)))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,104 @@
+import threading
+import unittest
+
+import ROOT
+
+
+class ReleaseGIL(unittest.TestCase):
+    """
+    Test the release of the GIL by default in the long-running C++ entry points
+    (see ReleaseGILPyz.cxx): other Python threads run while they are in
+    progress, and the callbacks into Python still work.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        ROOT.gInterpreter.Declare("""
+        #include "TPyDispatcher.h"
+
+        #include <atomic>
+        #include <chrono>
+        #include <thread>
+
+        std::atomic<bool> releaseGILFlag{false};
+
+        void SetReleaseGILFlag(bool on) { releaseGILFlag = on; }
+
+        // wait until releaseGILFlag is set from another Python thread, which can
+        // only happen if the GIL is released; give up after a while instead of hanging
+        bool WaitForReleaseGILFlag()
+        {
+           const auto start = std::chrono::steady_clock::now();
+           while (!releaseGILFlag) {
+              if (std::chrono::steady_clock::now() - start > std::chrono::seconds(30))
+                 return false;
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+           }
+           return true;
+        }
+
+        // call the dispatcher from a C++ thread that does not hold the GIL
+        void DispatchFromThread(TPyDispatcher *d, int n)
+        {
+           std::thread t([d, n]() {
+              for (int i = 0; i < n; ++i)
+                 d->Dispatch(i); // the callable returns None
+           });
+           t.join();
+        }
+        """)
+        ROOT.DispatchFromThread.__release_gil__ = True
+
+    def test_policy_is_set(self):
+        """The methods in the list have the __release_gil__ policy set"""
+        self.assertTrue(ROOT.TTree.Draw.__release_gil__)
+        self.assertTrue(ROOT.TH1.Fit.__release_gil__)
+        self.assertTrue(ROOT.TFileMerger.Merge.__release_gil__)
+        # and the others don't
+        self.assertFalse(ROOT.TTree.GetEntries.__release_gil__)
+
+    def test_other_threads_run(self):
+        """A Python thread can run while the RDataFrame event loop is in progress"""
+        # resolve and compile the call before the event loop starts
+        set_flag = ROOT.SetReleaseGILFlag
+        set_flag(False)
+
+        count = ROOT.RDataFrame(1).Filter("WaitForReleaseGILFlag()").Count()
+        thread = threading.Thread(target=set_flag, args=(True,))
+        thread.start()
+        # this deadlocks, until WaitForReleaseGILFlag gives up, if the GIL is held
+        self.assertEqual(count.GetValue(), 1)
+        thread.join(timeout=60)
+        self.assertFalse(thread.is_alive())
+
+    def test_fit_python_function(self):
+        """TH1::Fit runs without the GIL but can still call a Python model"""
+        ncalls = [0]
+
+        def line(x, p):
+            ncalls[0] += 1
+            return p[0] + p[1] * x[0]
+
+        f = ROOT.TF1("release_gil_line", line, 0, 10, 2)
+        f.SetParameters(0, 0)
+        h = ROOT.TH1D("release_gil_h", "", 10, 0, 10)
+        for i in range(10):
+            h.SetBinContent(i + 1, 2 + 3 * h.GetBinCenter(i + 1))
+            h.SetBinError(i + 1, 0.1)
+
+        result = h.Fit(f, "QNS")
+        self.assertEqual(result.Status(), 0)
+        self.assertAlmostEqual(f.GetParameter(0), 2, delta=1e-6)
+        self.assertAlmostEqual(f.GetParameter(1), 3, delta=1e-6)
+        self.assertGreater(ncalls[0], 0)
+
+    def test_dispatcher_from_thread(self):
+        """TPyDispatcher takes the GIL when called from C++ code running without it"""
+        values = []
+        d = ROOT.TPyDispatcher(values.append)
+        ROOT.DispatchFromThread(d, 5)
+        self.assertEqual(values, [0, 1, 2, 3, 4])
+
+
+if __name__ == "__main__":
+    unittest.main()
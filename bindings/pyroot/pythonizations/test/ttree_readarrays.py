@@ -0,0 +1,160 @@
+import os
+import unittest
+
+import ROOT
+import libROOTPythonizations
+
+
+class TTreeReadArrays(unittest.TestCase):
+    """
+    Test the values returned by ReadArrays, the bulk reader of TTree columns
+    (see TTreePyz.cxx), for fixed-size and variable-size branches
+    """
+
+    filename = "ttree_readarrays.root"
+    nfixed = 1000
+    njagged = 100
+
+    @classmethod
+    def setUpClass(cls):
+        ROOT.gInterpreter.Declare("""
+        #include "TFile.h"
+        #include "TTree.h"
+
+        #include <vector>
+
+        void MakeReadArraysFile(const char *filename, int nfixed, int njagged)
+        {
+           TFile f(filename, "RECREATE");
+
+           // small baskets, so that the columns span several of them
+           TTree fixed("fixed", "fixed-size branches");
+           int i = 0;
+           float xyz[3];
+           double d = 0;
+           fixed.Branch("i", &i, "i/I", 1000);
+           fixed.Branch("xyz", xyz, "xyz[3]/F", 1000);
+           fixed.Branch("d", &d, "d/D", 1000);
+           for (i = 0; i < nfixed; ++i) {
+              xyz[0] = i;
+              xyz[1] = 2 * i;
+              xyz[2] = 3 * i;
+              d = 0.5 * i;
+              fixed.Fill();
+           }
+           fixed.Write();
+
+           TTree jagged("jagged", "variable-size branches");
+           int n = 0;
+           float x[3];
+           std::vector<double> v;
+           jagged.Branch("n", &n, "n/I");
+           jagged.Branch("x", x, "x[n]/F");
+           jagged.Branch("v", &v);
+           for (int e = 0; e < njagged; ++e) {
+              n = e % 4;
+              for (int j = 0; j < n; ++j)
+                 x[j] = e + 0.25 * j;
+              v.clear();
+              for (int j = 0; j < e % 3; ++j)
+                 v.push_back(10 * e + j);
+              jagged.Fill();
+           }
+           jagged.Write();
+        }
+        """)
+        ROOT.MakeReadArraysFile(cls.filename, cls.nfixed, cls.njagged)
+        cls.file = ROOT.TFile(cls.filename)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.file.Close()
+        os.remove(cls.filename)
+
+    def expected_x(self, entries):
+        offsets, content = [0], []
+        for e in entries:
+            content += [e + 0.25 * j for j in range(e % 4)]
+            offsets.append(len(content))
+        return offsets, content
+
+    def expected_v(self, entries):
+        offsets, content = [0], []
+        for e in entries:
+            content += [10.0 * e + j for j in range(e % 3)]
+            offsets.append(len(content))
+        return offsets, content
+
+    def test_fixed_size(self):
+        tree = self.file.Get("fixed")
+        self.assertGreater(tree.GetBranch("i").GetWriteBasket(), 1)
+
+        arrays = libROOTPythonizations.ReadArrays(tree, ["i", "xyz", "d"])
+        self.assertEqual(sorted(arrays.keys()), ["d", "i", "xyz"])
+        self.assertEqual(arrays["i"].format, "i")
+        self.assertEqual(arrays["i"].tolist(), list(range(self.nfixed)))
+        self.assertEqual(arrays["xyz"].format, "f")
+        self.assertEqual(arrays["xyz"].shape, (self.nfixed, 3))
+        self.assertEqual(arrays["xyz"].tolist(), [[i, 2.0 * i, 3.0 * i] for i in range(self.nfixed)])
+        self.assertEqual(arrays["d"].format, "d")
+        self.assertEqual(arrays["d"].tolist(), [0.5 * i for i in range(self.nfixed)])
+
+    def test_fixed_size_range(self):
+        """The range starts and ends in the middle of baskets"""
+        tree = self.file.Get("fixed")
+        begin, end = 150, 737
+        arrays = libROOTPythonizations.ReadArrays(tree, ["i", "xyz"], begin, end)
+        self.assertEqual(arrays["i"].tolist(), list(range(begin, end)))
+        self.assertEqual(arrays["xyz"].tolist(), [[i, 2.0 * i, 3.0 * i] for i in range(begin, end)])
+
+        empty = libROOTPythonizations.ReadArrays(tree, ["i"], 10, 10)
+        self.assertEqual(empty["i"].tolist(), [])
+
+    def test_variable_size(self):
+        tree = self.file.Get("jagged")
+        arrays = libROOTPythonizations.ReadArrays(tree, ["n", "x", "v"])
+
+        self.assertEqual(arrays["n"].tolist(), [e % 4 for e in range(self.njagged)])
+
+        # variable-size arrays and std::vector come as (offsets, content)
+        offsets, content = arrays["x"]
+        self.assertEqual(offsets.format, "q")
+        self.assertEqual(content.format, "f")
+        self.assertEqual((offsets.tolist(), content.tolist()), self.expected_x(range(self.njagged)))
+
+        offsets, content = arrays["v"]
+        self.assertEqual(content.format, "d")
+        self.assertEqual((offsets.tolist(), content.tolist()), self.expected_v(range(self.njagged)))
+
+    def test_variable_size_range(self):
+        tree = self.file.Get("jagged")
+        begin, end = 10, 21
+        arrays = libROOTPythonizations.ReadArrays(tree, ["x", "v"], begin, end)
+        offsets, content = arrays["x"]
+        self.assertEqual((offsets.tolist(), content.tolist()), self.expected_x(range(begin, end)))
+        offsets, content = arrays["v"]
+        self.assertEqual((offsets.tolist(), content.tolist()), self.expected_v(range(begin, end)))
+
+    def test_chain(self):
+        """The columns of the trees of a chain are concatenated"""
+        chain = ROOT.TChain("jagged")
+        chain.Add(self.filename)
+        chain.Add(self.filename)
+        arrays = libROOTPythonizations.ReadArrays(chain, ["n", "x"])
+        entries = list(range(self.njagged)) * 2
+        self.assertEqual(arrays["n"].tolist(), [e % 4 for e in entries])
+        offsets, content = arrays["x"]
+        self.assertEqual((offsets.tolist(), content.tolist()), self.expected_x(entries))
+
+    def test_errors(self):
+        tree = self.file.Get("fixed")
+        with self.assertRaises(RuntimeError):
+            libROOTPythonizations.ReadArrays(tree, ["nonexistent"])
+        with self.assertRaises(ValueError):
+            libROOTPythonizations.ReadArrays(tree, ["i"], 20, 10)
+        with self.assertRaises(TypeError):
+            libROOTPythonizations.ReadArrays(ROOT.TH1F(), ["i"])
+
+
+if __name__ == "__main__":
+    unittest.main()
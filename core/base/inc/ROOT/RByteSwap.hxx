@@ -0,0 +1,37 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RByteSwap
+#define ROOT_RByteSwap
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+
+/// \name Array byte swapping
+/// Copy n values of 2, 4 or 8 bytes from `from` to `to`, reversing the order of the bytes of each value, e.g. to
+/// convert an array between the host and the (big-endian) network byte order. The addresses do not need to be
+/// aligned. `to` and `from` may be equal to swap in place, but must not otherwise overlap.
+///
+/// The arrays are processed with the widest SIMD instructions supported by the CPU (AVX2 or SSSE3 on x86, NEON on
+/// ARM), selected at runtime on first use; the other platforms use a scalar loop.
+///@{
+void ByteSwapCopy16(void *to, const void *from, std::size_t n);
+void ByteSwapCopy32(void *to, const void *from, std::size_t n);
+void ByteSwapCopy64(void *to, const void *from, std::size_t n);
+///@}
+
+/// Return the name of the implementation of the ByteSwapCopy functions selected for this CPU,
+/// i.e. one of "avx2", "ssse3", "neon" or "scalar".
+const char *GetByteSwapImplementation();
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
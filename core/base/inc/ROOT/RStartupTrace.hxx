@@ -0,0 +1,64 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RStartupTrace
+#define ROOT_RStartupTrace
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+\class ROOT::Internal::RStartupTrace
+\ingroup Base
+\brief Records the time spent in the phases of the ROOT initialization.
+
+The trace is enabled by the ROOT_STARTUP_TRACE environment variable: with the value `1` it is printed to stderr at
+the end of the process, any other non-empty value except `0` is taken as the name of the file to write it to. The
+trace lists the TROOT and TCling initialization phases, the loaded libraries, the rootmap files, the dictionaries,
+the C++ modules and the PCM files in the order in which they started, indented by nesting level, followed by the
+totals per category. Recording costs a clock reading per entry and nothing if the trace is disabled.
+*/
+class RStartupTrace {
+public:
+   /// Times the enclosing scope as one entry of the trace
+   class RScope {
+      std::size_t fIndex; ///< Index of the entry in the trace, or kInvalid if the trace is disabled
+      static constexpr std::size_t kInvalid = static_cast<std::size_t>(-1);
+
+   public:
+      RScope(const char *category, const std::string &name) : fIndex(IsEnabled() ? Begin(category, name) : kInvalid)
+      {
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      ~RScope()
+      {
+         if (fIndex != kInvalid)
+            End(fIndex);
+      }
+   };
+
+   static bool IsEnabled();
+   /// Starts an entry and returns its index
+   static std::size_t Begin(const char *category, const std::string &name);
+   /// Ends the entry returned by Begin()
+   static void End(std::size_t index);
+   /// Writes the entries recorded so far
+   static void Print(std::FILE *out);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
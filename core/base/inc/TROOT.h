@@ -89,6 +89,20 @@ namespace ROOT {
    void DisableImplicitMT();
    Bool_t IsImplicitMTEnabled();
    UInt_t GetThreadPoolSize();
+
+   // Manage the registration of new objects in gDirectory and gObjectTable, for the calling thread only
+   void DisableGlobalRegistration();
+   void EnableGlobalRegistration();
+   Bool_t IsGlobalRegistrationEnabled();
+   /// \brief While an object of this class is alive, the histograms and TGraph2D objects created by the
+   /// current thread are not added to gDirectory, and TObjects are not added to gObjectTable.
+   class TNoGlobalRegistrationRAII {
+   public:
+      TNoGlobalRegistrationRAII()  { DisableGlobalRegistration(); }
+      ~TNoGlobalRegistrationRAII() { EnableGlobalRegistration();  }
+      TNoGlobalRegistrationRAII(const TNoGlobalRegistrationRAII &) = delete;
+      TNoGlobalRegistrationRAII &operator=(const TNoGlobalRegistrationRAII &) = delete;
+   };
 }
 
 class TROOT : public TDirectory {
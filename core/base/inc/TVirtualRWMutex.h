@@ -85,6 +85,14 @@ public:
    virtual std::unique_ptr<StateDelta> Rewind(const State& earlierState) = 0;
    virtual void Apply(std::unique_ptr<StateDelta> &&delta) = 0;
 
+   /// Start (and reset) or stop recording the number of acquisitions of the lock,
+   /// the time spent waiting for it and the call sites that waited the longest.
+   /// Must not be called concurrently with itself. Implementations without
+   /// instrumentation ignore the call.
+   virtual void EnableContentionStats(Bool_t /*enable*/ = kTRUE) {}
+   /// Print the statistics recorded since EnableContentionStats() was called
+   virtual void PrintContentionStats() const {}
+
    TVirtualRWMutex *Factory(Bool_t /*recursive*/ = kFALSE) override = 0;
 
    ClassDefOverride(TVirtualRWMutex, 0)  // Virtual mutex lock class
@@ -0,0 +1,187 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RByteSwap.hxx"
+
+#include "Byteswap.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define R__BYTESWAP_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#define R__BYTESWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using Kernel_t = void (*)(char *, const char *, std::size_t);
+
+inline std::uint16_t SwapValue(std::uint16_t x)
+{
+   return R__bswap_16(x);
+}
+inline std::uint32_t SwapValue(std::uint32_t x)
+{
+   return R__bswap_32(x);
+}
+inline std::uint64_t SwapValue(std::uint64_t x)
+{
+   return R__bswap_64(x);
+}
+
+/// Swap one value at a time. Also used for the tail of the arrays in the vectorized kernels.
+template <typename T>
+void ByteSwapCopyScalar(char *to, const char *from, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i) {
+      T x;
+      std::memcpy(&x, from + i * sizeof(T), sizeof(T));
+      x = SwapValue(x);
+      std::memcpy(to + i * sizeof(T), &x, sizeof(T));
+   }
+}
+
+#ifdef R__BYTESWAP_X86
+/// Control mask of pshufb reversing the bytes of each value of `S` bytes. The AVX2 shuffle works within each
+/// 128-bit lane, so the indices are lane-relative and the same mask serves both instruction sets.
+template <std::size_t S>
+struct RShuffleMask {
+   alignas(32) std::uint8_t fBytes[32];
+};
+
+template <std::size_t S>
+constexpr RShuffleMask<S> MakeShuffleMask()
+{
+   RShuffleMask<S> mask{};
+   for (std::size_t j = 0; j < 32; ++j)
+      mask.fBytes[j] = static_cast<std::uint8_t>((j % 16) / S * S + (S - 1 - j % S));
+   return mask;
+}
+
+template <std::size_t S>
+constexpr RShuffleMask<S> kShuffleMask = MakeShuffleMask<S>();
+
+template <typename T>
+__attribute__((target("ssse3"))) void ByteSwapCopySSSE3(char *to, const char *from, std::size_t n)
+{
+   constexpr std::size_t kPerVector = 16 / sizeof(T);
+   const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i *>(kShuffleMask<sizeof(T)>.fBytes));
+   std::size_t i = 0;
+   for (; i + kPerVector <= n; i += kPerVector) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i * sizeof(T)));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i * sizeof(T)), _mm_shuffle_epi8(v, mask));
+   }
+   ByteSwapCopyScalar<T>(to + i * sizeof(T), from + i * sizeof(T), n - i);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void ByteSwapCopyAVX2(char *to, const char *from, std::size_t n)
+{
+   constexpr std::size_t kPerVector = 32 / sizeof(T);
+   const __m256i mask = _mm256_load_si256(reinterpret_cast<const __m256i *>(kShuffleMask<sizeof(T)>.fBytes));
+   std::size_t i = 0;
+   // two vectors per iteration to hide the latency of the loads
+   for (; i + 2 * kPerVector <= n; i += 2 * kPerVector) {
+      const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i * sizeof(T)));
+      const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + (i + kPerVector) * sizeof(T)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i * sizeof(T)), _mm256_shuffle_epi8(v0, mask));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + (i + kPerVector) * sizeof(T)),
+                          _mm256_shuffle_epi8(v1, mask));
+   }
+   for (; i + kPerVector <= n; i += kPerVector) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i * sizeof(T)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i * sizeof(T)), _mm256_shuffle_epi8(v, mask));
+   }
+   ByteSwapCopyScalar<T>(to + i * sizeof(T), from + i * sizeof(T), n - i);
+}
+#endif // R__BYTESWAP_X86
+
+#ifdef R__BYTESWAP_NEON
+inline uint8x16_t ReverseBytes(uint8x16_t v, std::uint16_t)
+{
+   return vrev16q_u8(v);
+}
+inline uint8x16_t ReverseBytes(uint8x16_t v, std::uint32_t)
+{
+   return vrev32q_u8(v);
+}
+inline uint8x16_t ReverseBytes(uint8x16_t v, std::uint64_t)
+{
+   return vrev64q_u8(v);
+}
+
+template <typename T>
+void ByteSwapCopyNEON(char *to, const char *from, std::size_t n)
+{
+   constexpr std::size_t kPerVector = 16 / sizeof(T);
+   std::size_t i = 0;
+   for (; i + kPerVector <= n; i += kPerVector) {
+      const uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t *>(from + i * sizeof(T)));
+      vst1q_u8(reinterpret_cast<std::uint8_t *>(to + i * sizeof(T)), ReverseBytes(v, T{}));
+   }
+   ByteSwapCopyScalar<T>(to + i * sizeof(T), from + i * sizeof(T), n - i);
+}
+#endif // R__BYTESWAP_NEON
+
+struct RKernels {
+   Kernel_t f16;
+   Kernel_t f32;
+   Kernel_t f64;
+   const char *fName;
+};
+
+RKernels SelectKernels()
+{
+#if defined(R__BYTESWAP_X86)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2")) {
+      return {ByteSwapCopyAVX2<std::uint16_t>, ByteSwapCopyAVX2<std::uint32_t>, ByteSwapCopyAVX2<std::uint64_t>,
+              "avx2"};
+   }
+   if (__builtin_cpu_supports("ssse3")) {
+      return {ByteSwapCopySSSE3<std::uint16_t>, ByteSwapCopySSSE3<std::uint32_t>, ByteSwapCopySSSE3<std::uint64_t>,
+              "ssse3"};
+   }
+#elif defined(R__BYTESWAP_NEON)
+   return {ByteSwapCopyNEON<std::uint16_t>, ByteSwapCopyNEON<std::uint32_t>, ByteSwapCopyNEON<std::uint64_t>, "neon"};
+#endif
+   return {ByteSwapCopyScalar<std::uint16_t>, ByteSwapCopyScalar<std::uint32_t>, ByteSwapCopyScalar<std::uint64_t>,
+           "scalar"};
+}
+
+const RKernels &GetKernels()
+{
+   static const RKernels kernels = SelectKernels();
+   return kernels;
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::ByteSwapCopy16(void *to, const void *from, std::size_t n)
+{
+   GetKernels().f16(static_cast<char *>(to), static_cast<const char *>(from), n);
+}
+
+void ROOT::Internal::ByteSwapCopy32(void *to, const void *from, std::size_t n)
+{
+   GetKernels().f32(static_cast<char *>(to), static_cast<const char *>(from), n);
+}
+
+void ROOT::Internal::ByteSwapCopy64(void *to, const void *from, std::size_t n)
+{
+   GetKernels().f64(static_cast<char *>(to), static_cast<const char *>(from), n);
+}
+
+const char *ROOT::Internal::GetByteSwapImplementation()
+{
+   return GetKernels().fName;
+}
@@ -0,0 +1,138 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RStartupTrace.hxx"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+using Clock_t = std::chrono::steady_clock;
+
+struct RTraceEntry {
+   const char *fCategory;
+   std::string fName;
+   Clock_t::time_point fStart;
+   double fSeconds = -1; ///< Negative while the entry is open
+   int fDepth;
+};
+
+struct RTraceState {
+   std::mutex fLock;
+   std::vector<RTraceEntry> fEntries;
+   /// Number of open entries; startup is essentially serial, so one nesting level for all threads is good enough
+   int fDepth = 0;
+   std::string fOutput;
+};
+
+/// Never destroyed: libraries can still be loaded and traced while the static objects are being destroyed
+RTraceState &GetState()
+{
+   static RTraceState *gState = new RTraceState;
+   return *gState;
+}
+
+void PrintAtExit()
+{
+   const std::string &output = GetState().fOutput;
+   if (output == "1") {
+      ROOT::Internal::RStartupTrace::Print(stderr);
+      return;
+   }
+   if (std::FILE *out = std::fopen(output.c_str(), "w")) {
+      ROOT::Internal::RStartupTrace::Print(out);
+      std::fclose(out);
+   } else {
+      std::fprintf(stderr, "Error in <RStartupTrace>: cannot write the startup trace to %s\n", output.c_str());
+   }
+}
+
+} // anonymous namespace
+
+bool ROOT::Internal::RStartupTrace::IsEnabled()
+{
+   static const bool isEnabled = []() {
+      const char *env = std::getenv("ROOT_STARTUP_TRACE");
+      if (!env || !*env || std::strcmp(env, "0") == 0)
+         return false;
+      GetState().fOutput = env;
+      std::atexit(PrintAtExit);
+      return true;
+   }();
+   return isEnabled;
+}
+
+std::size_t ROOT::Internal::RStartupTrace::Begin(const char *category, const std::string &name)
+{
+   auto &state = GetState();
+   std::lock_guard<std::mutex> guard(state.fLock);
+   state.fEntries.push_back({category, name, Clock_t::now(), -1, state.fDepth++});
+   return state.fEntries.size() - 1;
+}
+
+void ROOT::Internal::RStartupTrace::End(std::size_t index)
+{
+   auto &state = GetState();
+   const auto end = Clock_t::now();
+   std::lock_guard<std::mutex> guard(state.fLock);
+   auto &entry = state.fEntries[index];
+   entry.fSeconds = std::chrono::duration<double>(end - entry.fStart).count();
+   state.fDepth--;
+}
+
+void ROOT::Internal::RStartupTrace::Print(std::FILE *out)
+{
+   auto &state = GetState();
+   std::lock_guard<std::mutex> guard(state.fLock);
+   if (state.fEntries.empty())
+      return;
+
+   struct RTotal {
+      unsigned int fN = 0;
+      double fSeconds = 0;
+   };
+   std::map<std::string, RTotal> totals;
+   // Categories of the open ancestors of the current entry; an entry nested in one of the same category is already
+   // accounted for in the totals
+   std::vector<const char *> ancestors;
+
+   const auto origin = state.fEntries.front().fStart;
+   std::fprintf(out, "ROOT startup trace: start [ms], duration [ms], category and name, nested entries indented\n");
+   for (const auto &entry : state.fEntries) {
+      ancestors.resize(entry.fDepth);
+      const double start = 1e3 * std::chrono::duration<double>(entry.fStart - origin).count();
+      if (entry.fSeconds < 0) {
+         std::fprintf(out, "%10.2f %10s  %*s%-10s %s\n", start, "(open)", 2 * entry.fDepth, "", entry.fCategory,
+                      entry.fName.c_str());
+      } else {
+         std::fprintf(out, "%10.2f %10.2f  %*s%-10s %s\n", start, 1e3 * entry.fSeconds, 2 * entry.fDepth, "",
+                      entry.fCategory, entry.fName.c_str());
+         bool isNestedInSameCategory = false;
+         for (const char *category : ancestors)
+            isNestedInSameCategory |= std::strcmp(category, entry.fCategory) == 0;
+         if (!isNestedInSameCategory) {
+            auto &total = totals[entry.fCategory];
+            total.fN++;
+            total.fSeconds += entry.fSeconds;
+         }
+      }
+      ancestors.push_back(entry.fCategory);
+   }
+
+   std::fprintf(out, "ROOT startup trace totals per category (nested entries of the same category not counted):\n");
+   for (const auto &total : totals)
+      std::fprintf(out, "   %-10s %6u entries %10.2f ms\n", total.first.c_str(), total.second.fN,
+                   1e3 * total.second.fSeconds);
+}
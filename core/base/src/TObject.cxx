@@ -180,7 +180,8 @@ TObject::~TObject()
 
 void TObject::AddToTObjectTable(TObject *op)
 {
-   TObjectTable::AddObj(op);
+   if (ROOT::IsGlobalRegistrationEnabled())
+      TObjectTable::AddObj(op);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
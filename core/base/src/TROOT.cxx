@@ -115,6 +115,7 @@ FARPROC dlsym(void *library, const char *function_name)
 
 #include <iostream>
 #include "ROOT/FoundationUtils.hxx"
+#include "ROOT/RStartupTrace.hxx"
 #include "TROOT.h"
 #include "TClass.h"
 #include "TClassEdit.h"
@@ -572,6 +573,39 @@ namespace Internal {
       return ROOT::Internal::IsImplicitMTEnabledImpl();
    }
 
+   namespace {
+      thread_local unsigned int gNoGlobalRegistrationDepth = 0;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Stops adding the objects created by the calling thread to gDirectory and to
+   /// gObjectTable, until the matching call to EnableGlobalRegistration(). Calls can
+   /// be nested. In the meantime, histograms (TH1 and derived classes) and TGraph2D
+   /// are not added to gDirectory, whatever TH1::AddDirectoryStatus() returns, and no
+   /// TObject is added to gObjectTable. This avoids taking the directory locks when many
+   /// temporary objects are created by concurrent threads. Other classes, e.g. TTree,
+   /// are still registered. It is up to the caller to delete these objects.
+   /// See also TNoGlobalRegistrationRAII.
+   void DisableGlobalRegistration()
+   {
+      ++gNoGlobalRegistrationDepth;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Undo one call to DisableGlobalRegistration().
+   void EnableGlobalRegistration()
+   {
+      if (gNoGlobalRegistrationDepth > 0)
+         --gNoGlobalRegistrationDepth;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Returns false if DisableGlobalRegistration() is in effect for the calling thread.
+   Bool_t IsGlobalRegistrationEnabled()
+   {
+      return gNoGlobalRegistrationDepth == 0;
+   }
+
    ////////////////////////////////////////////////////////////////////////////////
    /// Returns the size of ROOT's thread pool
    UInt_t GetThreadPoolSize()
@@ -656,6 +690,7 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
    }
 
    R__LOCKGUARD(gROOTMutex);
+   ROOT::Internal::RStartupTrace::RScope traceScope("phase", "TROOT::TROOT");
 
    ROOT::Internal::gROOTLocal = this;
    gDirectory = nullptr;
@@ -671,7 +706,10 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
    gPluginMgr = fPluginManager = new TPluginManager;
 
    // Initialize Operating System interface
-   InitSystem();
+   {
+      ROOT::Internal::RStartupTrace::RScope initSystemScope("phase", "TROOT::InitSystem");
+      InitSystem();
+   }
 
    // Initialize static directory functions
    GetRootSys();
@@ -717,6 +755,7 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
    // rootcling.
    if (!dlsym(RTLD_DEFAULT, "usedToIdentifyRootClingByDlSym")) {
       // initialize plugin manager early
+      ROOT::Internal::RStartupTrace::RScope pluginScope("phase", "TPluginManager::LoadHandlersFromEnv");
       fPluginManager->LoadHandlersFromEnv(gEnv);
    }
 
@@ -2063,12 +2102,18 @@ void TROOT::InitThreads()
 
 void TROOT::InitInterpreter()
 {
+   ROOT::Internal::RStartupTrace::RScope traceScope("phase", "TROOT::InitInterpreter");
+
    // usedToIdentifyRootClingByDlSym is available when TROOT is part of
    // rootcling.
    if (!dlsym(RTLD_DEFAULT, "usedToIdentifyRootClingByDlSym")
        && !dlsym(RTLD_DEFAULT, "usedToIdentifyStaticRoot")) {
       char *libRIO = gSystem->DynamicPathName("libRIO");
-      void *libRIOHandle = dlopen(libRIO, RTLD_NOW|RTLD_GLOBAL);
+      void *libRIOHandle = nullptr;
+      {
+         ROOT::Internal::RStartupTrace::RScope libScope("library", libRIO ? libRIO : "libRIO");
+         libRIOHandle = dlopen(libRIO, RTLD_NOW|RTLD_GLOBAL);
+      }
       delete [] libRIO;
       if (!libRIOHandle) {
          TString err = dlerror();
@@ -2077,7 +2122,10 @@ void TROOT::InitInterpreter()
       }
 
       char *libcling = gSystem->DynamicPathName("libCling");
-      gInterpreterLib = dlopen(libcling, RTLD_LAZY|RTLD_LOCAL);
+      {
+         ROOT::Internal::RStartupTrace::RScope libScope("library", libcling ? libcling : "libCling");
+         gInterpreterLib = dlopen(libcling, RTLD_LAZY|RTLD_LOCAL);
+      }
       delete [] libcling;
 
       if (!gInterpreterLib) {
@@ -2123,7 +2171,10 @@ void TROOT::InitInterpreter()
 #endif
       nullptr};
 
-   fInterpreter = CreateInterpreter(gInterpreterLib, interpArgs);
+   {
+      ROOT::Internal::RStartupTrace::RScope createScope("phase", "CreateInterpreter");
+      fInterpreter = CreateInterpreter(gInterpreterLib, interpArgs);
+   }
 
    fCleanups->Add(fInterpreter);
    fInterpreter->SetBit(kMustCleanup);
@@ -2135,23 +2186,27 @@ void TROOT::InitInterpreter()
       new TClassTable;
 
    // Initialize all registered dictionaries.
-   for (std::vector<ModuleHeaderInfo_t>::const_iterator
-           li = GetModuleHeaderInfoBuffer().begin(),
-           le = GetModuleHeaderInfoBuffer().end(); li != le; ++li) {
-         // process buffered module registrations
-      fInterpreter->RegisterModule(li->fModuleName,
-                                   li->fHeaders,
-                                   li->fIncludePaths,
-                                   li->fPayloadCode,
-                                   li->fFwdDeclCode,
-                                   li->fTriggerFunc,
-                                   li->fFwdNargsToKeepColl,
-                                   li->fClassesHeaders,
-                                   kTRUE /*lateRegistration*/,
-                                   li->fHasCxxModule);
-   }
-   GetModuleHeaderInfoBuffer().clear();
+   {
+      ROOT::Internal::RStartupTrace::RScope registerScope("phase", "Late registration of the dictionaries");
+      for (std::vector<ModuleHeaderInfo_t>::const_iterator
+              li = GetModuleHeaderInfoBuffer().begin(),
+              le = GetModuleHeaderInfoBuffer().end(); li != le; ++li) {
+            // process buffered module registrations
+         fInterpreter->RegisterModule(li->fModuleName,
+                                      li->fHeaders,
+                                      li->fIncludePaths,
+                                      li->fPayloadCode,
+                                      li->fFwdDeclCode,
+                                      li->fTriggerFunc,
+                                      li->fFwdNargsToKeepColl,
+                                      li->fClassesHeaders,
+                                      kTRUE /*lateRegistration*/,
+                                      li->fHasCxxModule);
+      }
+      GetModuleHeaderInfoBuffer().clear();
+   }
 
+   ROOT::Internal::RStartupTrace::RScope initializeScope("phase", "TInterpreter::Initialize");
    fInterpreter->Initialize();
 }
 
@@ -22,6 +22,7 @@ allows a simple partial implementation for new OS'es.
 */
 
 #include <ROOT/FoundationUtils.hxx>
+#include <ROOT/RStartupTrace.hxx>
 #include "strlcpy.h"
 #include "TSystem.h"
 #include "TApplication.h"
@@ -1905,6 +1906,7 @@ int TSystem::Load(const char *module, const char *entry, Bool_t system)
 
    int ret = -1;
    if (path) {
+      ROOT::Internal::RStartupTrace::RScope traceScope("library", path);
       // load any dependent libraries
       TString deplibs = gInterpreter->GetSharedLibDeps(path);
       if (!deplibs.IsNull()) {
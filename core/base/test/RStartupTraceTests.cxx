@@ -0,0 +1,46 @@
+#include "gtest/gtest.h"
+
+#include "ROOT/RStartupTrace.hxx"
+
+#include <cstdio>
+#include <string>
+
+using ROOT::Internal::RStartupTrace;
+
+namespace {
+
+std::string PrintToString()
+{
+   std::FILE *f = std::tmpfile();
+   RStartupTrace::Print(f);
+   std::string output(std::ftell(f), '\0');
+   std::rewind(f);
+   output.resize(std::fread(&output[0], 1, output.size(), f));
+   std::fclose(f);
+   return output;
+}
+
+} // anonymous namespace
+
+TEST(RStartupTrace, NestedEntries)
+{
+   auto outer = RStartupTrace::Begin("testlib", "libOuter.so");
+   auto inner = RStartupTrace::Begin("testlib", "libInner.so");
+   auto pcm = RStartupTrace::Begin("testpcm", "Inner_rdict.pcm");
+   RStartupTrace::End(pcm);
+   RStartupTrace::End(inner);
+   RStartupTrace::End(outer);
+   auto open = RStartupTrace::Begin("testphase", "Unfinished");
+
+   const std::string output = PrintToString();
+   RStartupTrace::End(open);
+
+   EXPECT_NE(output.find("libOuter.so"), std::string::npos);
+   EXPECT_NE(output.find("Inner_rdict.pcm"), std::string::npos);
+   EXPECT_NE(output.find("(open)"), std::string::npos);
+   // The library loaded by another library is included in the time of the outer one
+   EXPECT_NE(output.find("testlib         1 entries"), std::string::npos) << output;
+   EXPECT_NE(output.find("testpcm         1 entries"), std::string::npos) << output;
+   // Open entries are not counted
+   EXPECT_EQ(output.find("testphase "), output.rfind("testphase ")) << output;
+}
@@ -0,0 +1,139 @@
+// @(#)root/cont:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TClonesVector
+#define ROOT_TClonesVector
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+\class TClonesVector
+\ingroup Containers
+\brief A contiguous array of objects of type T that are reused from one event to the next.
+
+Like TClonesArray, a TClonesVector avoids constructing and destructing its
+elements for every event. Unlike TClonesArray, the elements are stored by value
+in one contiguous block of memory, without a TObject* indirection, and T does
+not need to inherit from TObject:
+~~~ {.cpp}
+TClonesVector<Hit> hits;
+while (NextEvent()) {
+   for (int i = 0; i < nhits; i++) {
+      Hit &hit = hits.ConstructedAt(i);
+      hit.Set(x, y, z, ...);
+   }
+   ...
+   hits.Clear();
+}
+~~~
+Clear() keeps the memory of the array and parks the elements instead of
+destructing them, so that ConstructedAt() hands them out again in the next
+event with their own heap allocations (for instance the buffers of a
+std::vector data member) still in place. As with TClonesArray::ConstructedAt(),
+a reused element keeps its previous content; it is up to the caller to reset it.
+For trivially destructible types there is nothing to retain and Clear() is
+equivalent to std::vector::clear().
+
+The elements in use are held in a std::vector<T> data member, so the I/O is
+the one of std::vector: once a dictionary is generated, e.g. with
+~~~ {.cpp}
+#pragma link C++ class Hit+;
+#pragma link C++ class TClonesVector<Hit>+;
+~~~
+a TClonesVector is streamed by TGenCollectionStreamer and a branch holding it
+is split memberwise by TBranchElement, like a std::vector<Hit>.
+*/
+
+template <typename T>
+class TClonesVector {
+public:
+   using value_type = T;
+   using size_type = std::size_t;
+   using reference = T &;
+   using const_reference = const T &;
+   using iterator = typename std::vector<T>::iterator;
+   using const_iterator = typename std::vector<T>::const_iterator;
+
+private:
+   std::vector<T> fElements; ///< The elements in use
+   std::vector<T> fSpare;    ///<! Elements removed by Clear(), in the reverse order of their last use
+
+public:
+   TClonesVector() = default;
+   explicit TClonesVector(size_type capacity) { fElements.reserve(capacity); }
+
+   /// Return the element at `idx`, constructing or reusing all the missing elements up to `idx`.
+   T &ConstructedAt(size_type idx)
+   {
+      while (fElements.size() <= idx) {
+         if (fSpare.empty()) {
+            fElements.emplace_back();
+         } else {
+            fElements.emplace_back(std::move(fSpare.back()));
+            fSpare.pop_back();
+         }
+      }
+      return fElements[idx];
+   }
+
+   /// Append an element, reusing a parked one if available.
+   T &Add() { return ConstructedAt(fElements.size()); }
+
+   /// Remove all the elements, keeping them for reuse by ConstructedAt().
+   void Clear()
+   {
+      if constexpr (!std::is_trivially_destructible<T>::value) {
+         for (auto it = fElements.rbegin(); it != fElements.rend(); ++it)
+            fSpare.emplace_back(std::move(*it));
+      }
+      fElements.clear();
+   }
+
+   /// Remove and destruct all the elements, including the ones kept for reuse.
+   void Delete()
+   {
+      fElements.clear();
+      fSpare.clear();
+   }
+
+   /// Release the memory that is not used by the current elements.
+   void Compress()
+   {
+      fSpare.clear();
+      fSpare.shrink_to_fit();
+      fElements.shrink_to_fit();
+   }
+
+   void reserve(size_type capacity) { fElements.reserve(capacity); }
+
+   size_type size() const { return fElements.size(); }
+   bool empty() const { return fElements.empty(); }
+   size_type capacity() const { return fElements.capacity(); }
+   /// The number of elements kept for reuse by Clear().
+   size_type GetNSpare() const { return fSpare.size(); }
+
+   T &operator[](size_type idx) { return fElements[idx]; }
+   const T &operator[](size_type idx) const { return fElements[idx]; }
+   T *data() { return fElements.data(); }
+   const T *data() const { return fElements.data(); }
+
+   iterator begin() { return fElements.begin(); }
+   iterator end() { return fElements.end(); }
+   const_iterator begin() const { return fElements.begin(); }
+   const_iterator end() const { return fElements.end(); }
+
+   /// Access to the underlying std::vector, e.g. to pass it to code that expects one.
+   const std::vector<T> &GetVector() const { return fElements; }
+};
+
+#endif
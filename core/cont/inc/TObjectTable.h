@@ -57,7 +57,7 @@ public:
    void      Delete(Option_t *opt = "") override;
    Int_t     GetSize() const { return fSize; }
    Int_t     Instances() const { return fTally; }
-   void      InstanceStatistics() const;
+   void      InstanceStatistics(Option_t *option = "") const;
    void      Print(Option_t *option="") const override;
    Bool_t    PtrIsValid(TObject *obj);
    void      Remove(TObject *obj);
@@ -34,8 +34,9 @@ ClassImp(THashTable);
 /// (i.e. number of slots), by default kInitHashTableCapacity = 17, and
 /// rehashlevel is the value at which a rehash will be triggered. I.e. when
 /// the average size of the linked lists at a slot becomes longer than
-/// rehashlevel then the hashtable will be resized and refilled to reduce
-/// the collision rate to about 1. The higher the collision rate, i.e. the
+/// rehashlevel then the hashtable will be resized to twice the number of
+/// entries and refilled, which reduces the collision rate to about 1 and
+/// leaves room for as many new entries. The higher the collision rate, i.e. the
 /// longer the linked lists, the longer lookup will take. If rehashlevel=0
 /// the table will NOT automatically be rehashed. Use Rehash() for manual
 /// rehashing.
@@ -100,7 +101,7 @@ void THashTable::Add(TObject *obj)
    AddImpl(slot,obj);
 
    if (fRehashLevel && AverageCollisions() > fRehashLevel)
-      Rehash(fEntries);
+      Rehash(2 * fEntries);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -128,7 +129,7 @@ void THashTable::AddBefore(const TObject *before, TObject *obj)
    fEntries++;
 
    if (fRehashLevel && AverageCollisions() > fRehashLevel)
-      Rehash(fEntries);
+      Rehash(2 * fEntries);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -145,7 +146,7 @@ void THashTable::AddAll(const TCollection *col)
    Int_t sumEntries=fEntries+col->GetEntries();
    Bool_t rehashBefore=fRehashLevel && (sumEntries > fSize*fRehashLevel);
    if (rehashBefore)
-      Rehash(sumEntries);
+      Rehash(2 * sumEntries);
 
    // prevent Add from Rehashing
    Int_t saveRehashLevel=fRehashLevel;
@@ -157,7 +158,7 @@ void THashTable::AddAll(const TCollection *col)
    // If we didn't Rehash before, we might have to do it
    // now, due to a non-perfect hash function.
    if (!rehashBefore && fRehashLevel && AverageCollisions() > fRehashLevel)
-      Rehash(fEntries);
+      Rehash(2 * fEntries);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
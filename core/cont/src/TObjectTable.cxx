@@ -87,6 +87,9 @@ via the command gObjectTable->Print()
 #include "TClass.h"
 #include "TError.h"
 
+#include <algorithm>
+#include <vector>
+
 
 TObjectTable *gObjectTable = nullptr;
 
@@ -116,6 +119,8 @@ TObjectTable::~TObjectTable()
 /// Print the object table.
 /// If option ="all" prints the list of all objects with the format
 /// object number, pointer, class name, object name
+/// If option contains "size" the classes are sorted by decreasing total size,
+/// see InstanceStatistics().
 
 void TObjectTable::Print(Option_t *option) const
 {
@@ -138,7 +143,7 @@ void TObjectTable::Print(Option_t *option) const
    }
 
    //print the number of instances per class
-   InstanceStatistics();
+   InstanceStatistics(option);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -335,37 +340,50 @@ void TObjectTable::Expand(Int_t newSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Print the object table.
+/// Print the number of live objects and the memory they use, per class.
+/// If option contains "size" the classes are sorted by decreasing total size,
+/// which puts the classes responsible for a growing memory footprint on top,
+/// otherwise they are listed in the order of gROOT->GetListOfClasses().
+/// The sizes do not include the memory owned through pointer data members.
 
-void TObjectTable::InstanceStatistics() const
+void TObjectTable::InstanceStatistics(Option_t *option) const
 {
-   int n, h, s, ncum = 0, hcum = 0, scum = 0, tcum = 0, thcum = 0;
-
    if (fTally == 0 || !fTable)
       return;
 
    UpdateInstCount();
 
+   std::vector<TClass *> classes;
+   TIter next(gROOT->GetListOfClasses());
+   while (auto cl = (TClass*) next()) {
+      if (cl->GetInstanceCount() > 0)
+         classes.push_back(cl);
+   }
+   TString opt = option;
+   opt.ToLower();
+   if (opt.Contains("size")) {
+      std::stable_sort(classes.begin(), classes.end(), [](TClass *a, TClass *b) {
+         return Long64_t(a->GetInstanceCount()) * a->Size() > Long64_t(b->GetInstanceCount()) * b->Size();
+      });
+   }
+
+   Long64_t ncum = 0, hcum = 0, scum = 0, tcum = 0, thcum = 0;
    Printf("\nObject statistics");
    Printf("class                         cnt    on heap     size    total size    heap size");
    Printf("================================================================================");
-   TIter next(gROOT->GetListOfClasses());
-   TClass *cl;
-   while ((cl = (TClass*) next())) {
-      n = cl->GetInstanceCount();
-      h = cl->GetHeapInstanceCount();
-      s = cl->Size();
-      if (n > 0) {
-         Printf("%-24s %8d%11d%9d%14d%13d", cl->GetName(), n, h, s, n*s, h*s);
-         ncum  += n;
-         hcum  += h;
-         scum  += s;
-         tcum  += n*s;
-         thcum += h*s;
-      }
+   for (auto cl : classes) {
+      const Long64_t n = cl->GetInstanceCount();
+      const Long64_t h = cl->GetHeapInstanceCount();
+      const Long64_t s = cl->Size();
+      Printf("%-24s %8lld%11lld%9lld%14lld%13lld", cl->GetName(), n, h, s, n*s, h*s);
+      ncum  += n;
+      hcum  += h;
+      scum  += s;
+      tcum  += n*s;
+      thcum += h*s;
    }
    Printf("--------------------------------------------------------------------------------");
-   Printf("Total:                   %8d%11d%9d%14d%13d", ncum, hcum, scum, tcum, thcum);
+   Printf("Total:                   %8lld%11lld%9lld%14lld%13lld", ncum, hcum, scum, tcum, thcum);
    Printf("================================================================================\n");
 }
 
@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include "TClonesVector.h"
+
+#include <vector>
+
+namespace {
+struct Hit {
+   double fX = 0.;
+   std::vector<int> fChannels;
+};
+} // namespace
+
+TEST(TClonesVector, ConstructedAt)
+{
+   TClonesVector<Hit> hits;
+   EXPECT_TRUE(hits.empty());
+   hits.ConstructedAt(2).fX = 3.;
+   ASSERT_EQ(3u, hits.size());
+   EXPECT_EQ(0., hits[0].fX);
+   EXPECT_EQ(3., hits[2].fX);
+   hits.Add().fX = 4.;
+   ASSERT_EQ(4u, hits.size());
+   EXPECT_EQ(4., hits.data()[3].fX);
+
+   double sum = 0.;
+   for (const auto &hit : hits)
+      sum += hit.fX;
+   EXPECT_EQ(7., sum);
+}
+
+TEST(TClonesVector, ReuseAfterClear)
+{
+   TClonesVector<Hit> hits;
+   for (int i = 0; i < 3; ++i)
+      hits.ConstructedAt(i).fChannels.assign(100, i);
+   const int *channels1 = hits[1].fChannels.data();
+
+   hits.Clear();
+   EXPECT_TRUE(hits.empty());
+   EXPECT_EQ(3u, hits.GetNSpare());
+
+   // The elements come back in the same order, with their memory
+   auto &hit = hits.ConstructedAt(1);
+   EXPECT_EQ(1u, hits.GetNSpare());
+   EXPECT_EQ(channels1, hit.fChannels.data());
+   EXPECT_EQ(1, hit.fChannels[0]);
+   EXPECT_EQ(0, hits[0].fChannels[0]);
+
+   hits.Delete();
+   EXPECT_TRUE(hits.empty());
+   EXPECT_EQ(0u, hits.GetNSpare());
+   EXPECT_TRUE(hits.ConstructedAt(0).fChannels.empty());
+}
+
+TEST(TClonesVector, Trivial)
+{
+   TClonesVector<double> values(16);
+   EXPECT_LE(16u, values.capacity());
+   values.ConstructedAt(9) = 1.;
+   values.Clear();
+   EXPECT_EQ(0u, values.GetNSpare());
+   EXPECT_LE(16u, values.capacity());
+}
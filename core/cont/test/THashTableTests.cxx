@@ -0,0 +1,166 @@
+#include "THashList.h"
+#include "THashTable.h"
+#include "TList.h"
+#include "TNamed.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string Name(int i)
+{
+   return "obj_" + std::to_string(i);
+}
+
+// All the objects of the collection, in iteration order
+std::vector<TObject *> Contents(const TCollection &col)
+{
+   std::vector<TObject *> objs;
+   for (TObject *obj : col)
+      objs.push_back(obj);
+   return objs;
+}
+
+} // namespace
+
+TEST(THashTable, FindAfterGrowth)
+{
+   const int n = 5000;
+   THashTable table(TCollection::kInitHashTableCapacity, 3);
+   table.SetOwner(kTRUE);
+
+   std::vector<TObject *> objs;
+   for (int i = 0; i < n; ++i) {
+      objs.push_back(new TNamed(Name(i).c_str(), "title"));
+      table.Add(objs.back());
+   }
+
+   EXPECT_EQ(table.GetEntries(), n);
+   EXPECT_GT(table.Capacity(), TCollection::kInitHashTableCapacity);
+   EXPECT_LE(table.AverageCollisions(), 3);
+
+   for (int i = 0; i < n; ++i) {
+      EXPECT_EQ(table.FindObject(Name(i).c_str()), objs[i]);
+      EXPECT_EQ(table.FindObject(objs[i]), objs[i]);
+      const TList *slot = table.GetListForObject(Name(i).c_str());
+      ASSERT_NE(slot, nullptr);
+      EXPECT_EQ(slot->FindObject(objs[i]), objs[i]);
+   }
+   EXPECT_EQ(table.FindObject("not_there"), nullptr);
+}
+
+TEST(THashTable, IterateAfterRehash)
+{
+   const int n = 2000;
+   THashTable table(TCollection::kInitHashTableCapacity, 3);
+   table.SetOwner(kTRUE);
+
+   std::set<TObject *> objs;
+   for (int i = 0; i < n; ++i) {
+      auto obj = new TNamed(Name(i).c_str(), "title");
+      objs.insert(obj);
+      table.Add(obj);
+   }
+
+   // the order is the one of the slots, but each object is visited exactly once
+   auto contents = Contents(table);
+   EXPECT_EQ(contents.size(), n);
+   EXPECT_EQ(std::set<TObject *>(contents.begin(), contents.end()), objs);
+
+   table.Rehash(10 * n);
+   contents = Contents(table);
+   EXPECT_EQ(contents.size(), n);
+   EXPECT_EQ(std::set<TObject *>(contents.begin(), contents.end()), objs);
+}
+
+TEST(THashTable, AddAndRemove)
+{
+   const int n = 3000;
+   // declared first, so that the objects outlive the table
+   std::vector<std::unique_ptr<TNamed>> objs;
+   THashTable table(TCollection::kInitHashTableCapacity, 3);
+   for (int i = 0; i < n; ++i) {
+      objs.emplace_back(new TNamed(Name(i).c_str(), "title"));
+      table.Add(objs.back().get());
+   }
+
+   // remove every other object
+   for (int i = 0; i < n; i += 2)
+      EXPECT_EQ(table.Remove(objs[i].get()), objs[i].get());
+   EXPECT_EQ(table.GetEntries(), n / 2);
+   for (int i = 0; i < n; ++i) {
+      if (i % 2 == 0) {
+         EXPECT_EQ(table.FindObject(Name(i).c_str()), nullptr);
+      } else {
+         EXPECT_EQ(table.FindObject(Name(i).c_str()), objs[i].get());
+      }
+   }
+   EXPECT_EQ(table.Remove(objs[0].get()), nullptr);
+
+   // and add them back, together with new ones
+   for (int i = 0; i < n; i += 2)
+      table.Add(objs[i].get());
+   for (int i = n; i < 2 * n; ++i) {
+      objs.emplace_back(new TNamed(Name(i).c_str(), "title"));
+      table.Add(objs.back().get());
+   }
+   EXPECT_EQ(table.GetEntries(), 2 * n);
+   EXPECT_LE(table.AverageCollisions(), 3);
+   for (int i = 0; i < 2 * n; ++i)
+      EXPECT_EQ(table.FindObject(Name(i).c_str()), objs[i].get());
+}
+
+TEST(THashTable, AddAll)
+{
+   const int n = 1000;
+   TList list;
+   list.SetOwner(kTRUE);
+   for (int i = 0; i < n; ++i)
+      list.Add(new TNamed(Name(i).c_str(), "title"));
+
+   THashTable table(TCollection::kInitHashTableCapacity, 3);
+   table.AddAll(&list);
+   EXPECT_EQ(table.GetEntries(), n);
+   EXPECT_GE(table.Capacity(), n);
+   for (TObject *obj : list)
+      EXPECT_EQ(table.FindObject(obj->GetName()), obj);
+}
+
+TEST(THashList, OrderAfterRehash)
+{
+   const int n = 2000;
+   THashList list(TCollection::kInitHashTableCapacity, 3);
+   list.SetOwner(kTRUE);
+
+   std::vector<TObject *> objs;
+   for (int i = 0; i < n; ++i) {
+      objs.push_back(new TNamed(Name(i).c_str(), "title"));
+      list.Add(objs.back());
+   }
+
+   // the list keeps the order of insertion through the automatic rehashes
+   EXPECT_EQ(Contents(list), objs);
+   for (int i = 0; i < n; ++i)
+      EXPECT_EQ(list.FindObject(Name(i).c_str()), objs[i]);
+
+   list.Rehash(10 * n);
+   EXPECT_EQ(Contents(list), objs);
+
+   // removing objects does not change the order of the others
+   std::vector<TObject *> kept;
+   for (int i = 0; i < n; ++i) {
+      if (i % 3 == 0) {
+         delete list.Remove(objs[i]);
+      } else {
+         kept.push_back(objs[i]);
+      }
+   }
+   EXPECT_EQ(Contents(list), kept);
+   EXPECT_EQ(list.FindObject(Name(0).c_str()), nullptr);
+   EXPECT_EQ(list.FindObject(Name(1).c_str()), objs[1]);
+}
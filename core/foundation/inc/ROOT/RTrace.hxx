@@ -0,0 +1,131 @@
+/// \file ROOT/RTrace.hxx
+/// \ingroup Base ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RTrace
+#define ROOT7_RTrace
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+ \class ROOT::Experimental::RTrace
+ \ingroup Base
+ \brief Collects timed trace points of ROOT's hot paths into per-thread ring buffers.
+
+ Trace points are placed with `R__TRACE_SCOPE(category, name)`, which records the
+ time between its construction and the end of the enclosing scope. While tracing is
+ disabled, a trace point costs a single relaxed atomic load; if ROOT is compiled with
+ `R__NO_TRACEPOINTS`, trace points compile to nothing.
+
+ Every thread writes into its own fixed-size ring buffer without locking; when the
+ buffer is full the oldest events are overwritten. The collected events can be written
+ in the Chrome trace event format, which is understood by Perfetto and chrome://tracing:
+ ~~~ {.cpp}
+ ROOT::Experimental::RTrace::Enable();
+ df.Histo1D("x")->Draw();
+ ROOT::Experimental::RTrace::WriteChromeTrace("timeline.json");
+ ~~~
+ Tracing can also be switched on for a whole process by setting the environment
+ variable `ROOT_TRACE_FILE` to the name of the output file, which is written at exit.
+
+ Exporting and clearing must not run concurrently with traced code.
+ */
+class RTrace {
+public:
+   static constexpr std::size_t kDefaultEventsPerThread = 1 << 16;
+
+   /// Start recording; `eventsPerThread` is the ring buffer size of threads that did not trace yet.
+   static void Enable(std::size_t eventsPerThread = kDefaultEventsPerThread);
+   static void Disable();
+   static bool IsEnabled()
+   {
+#ifdef R__NO_TRACEPOINTS
+      return false;
+#else
+      return fgEnabled.load(std::memory_order_relaxed);
+#endif
+   }
+
+   /// Drop all recorded events.
+   static void Clear();
+   /// The number of events currently held in the ring buffers of all threads.
+   static std::size_t GetNEvents();
+
+   static void WriteChromeTrace(std::ostream &os);
+   /// Returns false if the file cannot be written.
+   static bool WriteChromeTrace(const std::string &fileName);
+
+   /// Nanoseconds since the start of the trace clock.
+   static std::uint64_t Now();
+   /// Store a complete event. `category` and `name` must have static storage duration.
+   static void Record(const char *category, const char *name, std::uint64_t start, std::uint64_t end);
+
+private:
+   static std::atomic<bool> fgEnabled;
+};
+
+/**
+ \class ROOT::Experimental::RTraceScope
+ \ingroup Base
+ \brief Records the lifetime of the object as a trace event, if tracing is enabled when it is constructed.
+ */
+class RTraceScope {
+   const char *fCategory;
+   const char *fName;
+   std::uint64_t fStart = 0;
+   bool fActive;
+
+public:
+   RTraceScope(const char *category, const char *name)
+      : fCategory(category), fName(name), fActive(RTrace::IsEnabled())
+   {
+      if (fActive)
+         fStart = RTrace::Now();
+   }
+   RTraceScope(const RTraceScope &) = delete;
+   RTraceScope &operator=(const RTraceScope &) = delete;
+   ~RTraceScope()
+   {
+      if (fActive)
+         RTrace::Record(fCategory, fName, fStart, RTrace::Now());
+   }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#define R__TRACE_CONCAT_IMPL(A, B) A##B
+#define R__TRACE_CONCAT(A, B) R__TRACE_CONCAT_IMPL(A, B)
+
+/// \name TraceMacros
+/// Place a trace point covering the rest of the enclosing scope. `CATEGORY` and `NAME`
+/// must be string literals.
+/// ~~~ {.cpp}
+///     R__TRACE_SCOPE("io", "TFile::ReadBuffer");
+/// ~~~
+///\{
+#ifdef R__NO_TRACEPOINTS
+#define R__TRACE_SCOPE(CATEGORY, NAME) ((void)0)
+#else
+#define R__TRACE_SCOPE(CATEGORY, NAME) \
+   ::ROOT::Experimental::RTraceScope R__TRACE_CONCAT(rTraceScope, __LINE__)(CATEGORY, NAME)
+#endif
+///\}
+
+#endif
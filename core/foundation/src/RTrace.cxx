@@ -0,0 +1,191 @@
+/// \file RTrace.cxx
+/// \ingroup Base ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RTrace.hxx"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+std::atomic<bool> RTrace::fgEnabled{false};
+
+namespace {
+
+struct RTraceEvent {
+   const char *fCategory;
+   const char *fName;
+   std::uint64_t fStart;
+   std::uint64_t fEnd;
+};
+
+/// Written only by its owning thread; readers only look at it while no traced code runs.
+struct RTraceRing {
+   std::vector<RTraceEvent> fEvents;
+   std::atomic<std::uint64_t> fNWritten{0};
+   unsigned int fThreadIndex;
+
+   RTraceRing(std::size_t size, unsigned int threadIndex) : fEvents(size), fThreadIndex(threadIndex) {}
+};
+
+struct RTraceRegistry {
+   std::mutex fMutex;
+   std::vector<std::unique_ptr<RTraceRing>> fRings;
+   std::size_t fEventsPerThread = RTrace::kDefaultEventsPerThread;
+
+   RTraceRing *NewRing()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fRings.emplace_back(new RTraceRing(fEventsPerThread, fRings.size()));
+      return fRings.back().get();
+   }
+
+   template <typename F>
+   void ForEachEvent(F &&f)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (const auto &ring : fRings) {
+         const auto nWritten = ring->fNWritten.load(std::memory_order_acquire);
+         const auto size = ring->fEvents.size();
+         for (auto i = nWritten > size ? nWritten - size : 0; i < nWritten; ++i)
+            f(ring->fThreadIndex, ring->fEvents[i % size]);
+      }
+   }
+};
+
+RTraceRegistry &GetRegistry()
+{
+   // Never destructed: threads may still record while the process exits.
+   static RTraceRegistry *registry = new RTraceRegistry;
+   return *registry;
+}
+
+thread_local RTraceRing *tRing = nullptr;
+
+const auto gTraceOrigin = std::chrono::steady_clock::now();
+
+void WriteJSONString(std::ostream &os, const char *str)
+{
+   os << '"';
+   for (; *str; ++str) {
+      if (*str == '"' || *str == '\\')
+         os << '\\';
+      os << *str;
+   }
+   os << '"';
+}
+
+/// Switches tracing on at startup and writes the trace at exit if ROOT_TRACE_FILE is set.
+struct RTraceFromEnv {
+   std::string fFileName;
+
+   RTraceFromEnv()
+   {
+      if (const char *fileName = std::getenv("ROOT_TRACE_FILE")) {
+         fFileName = fileName;
+         if (!fFileName.empty())
+            RTrace::Enable();
+      }
+   }
+   ~RTraceFromEnv()
+   {
+      if (!fFileName.empty()) {
+         RTrace::Disable();
+         RTrace::WriteChromeTrace(fFileName);
+      }
+   }
+} gTraceFromEnv;
+
+} // namespace
+
+void RTrace::Enable(std::size_t eventsPerThread)
+{
+   {
+      auto &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      registry.fEventsPerThread = eventsPerThread > 0 ? eventsPerThread : 1;
+   }
+   fgEnabled = true;
+}
+
+void RTrace::Disable()
+{
+   fgEnabled = false;
+}
+
+void RTrace::Clear()
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   for (auto &ring : registry.fRings)
+      ring->fNWritten = 0;
+}
+
+std::size_t RTrace::GetNEvents()
+{
+   std::size_t nEvents = 0;
+   GetRegistry().ForEachEvent([&nEvents](unsigned int, const RTraceEvent &) { ++nEvents; });
+   return nEvents;
+}
+
+std::uint64_t RTrace::Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - gTraceOrigin)
+      .count();
+}
+
+void RTrace::Record(const char *category, const char *name, std::uint64_t start, std::uint64_t end)
+{
+   if (!tRing)
+      tRing = GetRegistry().NewRing();
+   const auto n = tRing->fNWritten.load(std::memory_order_relaxed);
+   tRing->fEvents[n % tRing->fEvents.size()] = RTraceEvent{category, name, start, end};
+   tRing->fNWritten.store(n + 1, std::memory_order_release);
+}
+
+void RTrace::WriteChromeTrace(std::ostream &os)
+{
+   const auto flags = os.flags();
+   const auto precision = os.precision();
+   os << std::fixed << std::setprecision(3);
+
+   os << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+   bool first = true;
+   GetRegistry().ForEachEvent([&](unsigned int threadIndex, const RTraceEvent &event) {
+      os << (first ? "\n" : ",\n") << "{\"ph\": \"X\", \"pid\": 1, \"tid\": " << threadIndex << ", \"cat\": ";
+      WriteJSONString(os, event.fCategory);
+      os << ", \"name\": ";
+      WriteJSONString(os, event.fName);
+      // The format uses microseconds
+      os << ", \"ts\": " << event.fStart / 1000. << ", \"dur\": " << (event.fEnd - event.fStart) / 1000. << "}";
+      first = false;
+   });
+   os << "\n]}\n";
+
+   os.flags(flags);
+   os.precision(precision);
+}
+
+bool RTrace::WriteChromeTrace(const std::string &fileName)
+{
+   std::ofstream os(fileName);
+   if (!os)
+      return false;
+   WriteChromeTrace(os);
+   return static_cast<bool>(os);
+}
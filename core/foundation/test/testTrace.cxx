@@ -0,0 +1,65 @@
+#include "ROOT/RTrace.hxx"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace ROOT::Experimental;
+
+TEST(Trace, DisabledRecordsNothing)
+{
+   RTrace::Disable();
+   RTrace::Clear();
+   {
+      R__TRACE_SCOPE("test", "disabled");
+   }
+   EXPECT_EQ(0u, RTrace::GetNEvents());
+}
+
+TEST(Trace, ChromeTrace)
+{
+   RTrace::Enable();
+   RTrace::Clear();
+   {
+      R__TRACE_SCOPE("test", "outer");
+      R__TRACE_SCOPE("test", "inner");
+   }
+   std::thread([] { R__TRACE_SCOPE("test", "other thread"); }).join();
+   RTrace::Disable();
+
+#ifdef R__NO_TRACEPOINTS
+   EXPECT_EQ(0u, RTrace::GetNEvents());
+#else
+   EXPECT_EQ(3u, RTrace::GetNEvents());
+   std::ostringstream os;
+   RTrace::WriteChromeTrace(os);
+   const auto json = os.str();
+   EXPECT_NE(std::string::npos, json.find("\"name\": \"outer\""));
+   EXPECT_NE(std::string::npos, json.find("\"name\": \"inner\""));
+   EXPECT_NE(std::string::npos, json.find("\"name\": \"other thread\""));
+   EXPECT_NE(std::string::npos, json.find("\"ph\": \"X\""));
+#endif
+   RTrace::Clear();
+}
+
+TEST(Trace, RingBufferOverwritesOldest)
+{
+   RTrace::Enable(4);
+   RTrace::Clear();
+   // Use a new thread so that its ring is created with the requested size
+   std::thread([] {
+      for (int i = 0; i < 10; ++i) {
+         R__TRACE_SCOPE("test", "loop");
+      }
+   }).join();
+   RTrace::Disable();
+
+#ifndef R__NO_TRACEPOINTS
+   EXPECT_EQ(4u, RTrace::GetNEvents());
+#endif
+   RTrace::Clear();
+   RTrace::Enable(RTrace::kDefaultEventsPerThread);
+   RTrace::Disable();
+}
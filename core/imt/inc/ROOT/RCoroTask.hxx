@@ -0,0 +1,365 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCoroTask
+#define ROOT_RCoroTask
+
+#include <functional>
+
+namespace ROOT {
+namespace Internal {
+
+/// Runs `func` as a task of the ROOT task arena, or immediately in the calling thread if implicit multi-threading
+/// is not enabled.
+void EnqueueOnTaskArena(std::function<void()> func);
+/// Runs `func` on one of the threads dedicated to blocking I/O. Their number is set by the ROOT_IO_THREADS
+/// environment variable and defaults to 4; they spend their time waiting for the storage, not computing, and
+/// therefore do not compete with the task arena for the cores.
+void EnqueueOnIOThread(std::function<void()> func);
+
+} // namespace Internal
+} // namespace ROOT
+
+#if defined(__cpp_impl_coroutine) && __cplusplus >= 202002L
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+template <typename T = void>
+class RCoroTask;
+
+namespace Internal {
+
+template <typename T>
+class RCoroPromiseBase {
+   std::coroutine_handle<> fContinuation;
+
+protected:
+   std::exception_ptr fException;
+
+public:
+   /// Resumes the awaiting coroutine, if any, when the task is done
+   struct RFinalAwaiter {
+      bool await_ready() const noexcept { return false; }
+      template <typename PromiseT>
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> h) noexcept
+      {
+         auto continuation = h.promise().fContinuation;
+         return continuation ? continuation : std::noop_coroutine();
+      }
+      void await_resume() const noexcept {}
+   };
+
+   std::suspend_always initial_suspend() const noexcept { return {}; }
+   RFinalAwaiter final_suspend() const noexcept { return {}; }
+   void unhandled_exception() { fException = std::current_exception(); }
+   void SetContinuation(std::coroutine_handle<> continuation) { fContinuation = continuation; }
+};
+
+template <typename T>
+class RCoroPromise final : public RCoroPromiseBase<T> {
+   std::optional<T> fValue;
+
+public:
+   RCoroTask<T> get_return_object();
+   template <typename U>
+   void return_value(U &&value)
+   {
+      fValue.emplace(std::forward<U>(value));
+   }
+   T GetResult()
+   {
+      if (this->fException)
+         std::rethrow_exception(this->fException);
+      return std::move(*fValue);
+   }
+};
+
+template <>
+class RCoroPromise<void> final : public RCoroPromiseBase<void> {
+public:
+   RCoroTask<void> get_return_object();
+   void return_void() const {}
+   void GetResult()
+   {
+      if (fException)
+         std::rethrow_exception(fException);
+   }
+};
+
+} // namespace Internal
+
+/**
+\class ROOT::Experimental::RCoroTask
+\ingroup Parallelism
+\brief A lazily started C++20 coroutine returning a value of type T.
+
+The coroutine body runs when the task is awaited with `co_await`, or when it is passed to SyncWait(); the awaiting
+coroutine resumes when the body completes, in the thread that completed it. A task can be awaited only once.
+
+Together with ScheduleOnTaskArena(), RunOnIOThread() and WhenAll(), tasks let analysis code interleave I/O waits
+and computation: while a coroutine waits for its data on an I/O thread, the cores of the task arena run the other
+tasks.
+~~~{.cpp}
+ROOT::Experimental::RCoroTask<double> ProcessCluster(ROOT::Internal::RRawFile &file, std::uint64_t offset)
+{
+   std::vector<unsigned char> buffer(kClusterSize);
+   ROOT::Internal::RRawFile::RIOVec req{buffer.data(), offset, buffer.size(), 0};
+   co_await ROOT::Experimental::RunOnIOThread([&] { file.ReadV(&req, 1); }); // resumes in the task arena
+   co_return Unpack(buffer);
+}
+~~~
+*/
+template <typename T>
+class RCoroTask {
+public:
+   using promise_type = Internal::RCoroPromise<T>;
+
+private:
+   std::coroutine_handle<promise_type> fHandle;
+
+public:
+   explicit RCoroTask(std::coroutine_handle<promise_type> handle) : fHandle(handle) {}
+   RCoroTask(RCoroTask &&other) noexcept : fHandle(std::exchange(other.fHandle, nullptr)) {}
+   RCoroTask &operator=(RCoroTask &&other) noexcept
+   {
+      if (this != &other) {
+         if (fHandle)
+            fHandle.destroy();
+         fHandle = std::exchange(other.fHandle, nullptr);
+      }
+      return *this;
+   }
+   RCoroTask(const RCoroTask &) = delete;
+   RCoroTask &operator=(const RCoroTask &) = delete;
+   ~RCoroTask()
+   {
+      if (fHandle)
+         fHandle.destroy();
+   }
+
+   bool await_ready() const noexcept { return !fHandle || fHandle.done(); }
+   std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+   {
+      fHandle.promise().SetContinuation(awaiting);
+      return fHandle;
+   }
+   T await_resume() { return fHandle.promise().GetResult(); }
+};
+
+template <typename T>
+RCoroTask<T> Internal::RCoroPromise<T>::get_return_object()
+{
+   return RCoroTask<T>(std::coroutine_handle<RCoroPromise<T>>::from_promise(*this));
+}
+
+inline RCoroTask<void> Internal::RCoroPromise<void>::get_return_object()
+{
+   return RCoroTask<void>(std::coroutine_handle<RCoroPromise<void>>::from_promise(*this));
+}
+
+namespace Internal {
+
+/// An eagerly started, self-destroying coroutine used by SyncWait() to drive a task
+struct RDetachedCoro {
+   struct promise_type {
+      RDetachedCoro get_return_object() const noexcept { return {}; }
+      std::suspend_never initial_suspend() const noexcept { return {}; }
+      std::suspend_never final_suspend() const noexcept { return {}; }
+      void return_void() const noexcept {}
+      void unhandled_exception() const noexcept { std::terminate(); }
+   };
+};
+
+template <typename T>
+struct RSyncWaitState {
+   std::mutex fLock;
+   std::condition_variable fCv;
+   bool fIsDone = false;
+   std::exception_ptr fException;
+   std::conditional_t<std::is_void_v<T>, bool, std::optional<T>> fResult{};
+};
+
+/// A free function rather than a lambda: the coroutine frame keeps the references, not a pointer to the closure
+template <typename T>
+RDetachedCoro DriveSyncWait(RCoroTask<T> &task, RSyncWaitState<T> &state)
+{
+   try {
+      if constexpr (std::is_void_v<T>)
+         co_await task;
+      else
+         state.fResult.emplace(co_await task);
+   } catch (...) {
+      state.fException = std::current_exception();
+   }
+   std::lock_guard<std::mutex> guard(state.fLock);
+   state.fIsDone = true;
+   state.fCv.notify_one();
+}
+
+/// Awaiter that resumes the coroutine in the task arena after `fFunc` completed on an I/O thread
+template <typename F>
+class RIOThreadAwaiter {
+   using Result_t = std::invoke_result_t<F &>;
+   using Storage_t = std::conditional_t<std::is_void_v<Result_t>, bool, std::optional<Result_t>>;
+
+   F fFunc;
+   Storage_t fResult{};
+   std::exception_ptr fException;
+
+public:
+   explicit RIOThreadAwaiter(F func) : fFunc(std::move(func)) {}
+
+   bool await_ready() const noexcept { return false; }
+   void await_suspend(std::coroutine_handle<> h)
+   {
+      ROOT::Internal::EnqueueOnIOThread([this, h] {
+         try {
+            if constexpr (std::is_void_v<Result_t>)
+               fFunc();
+            else
+               fResult.emplace(fFunc());
+         } catch (...) {
+            fException = std::current_exception();
+         }
+         ROOT::Internal::EnqueueOnTaskArena([h] { h.resume(); });
+      });
+   }
+   Result_t await_resume()
+   {
+      if (fException)
+         std::rethrow_exception(fException);
+      if constexpr (!std::is_void_v<Result_t>)
+         return std::move(*fResult);
+   }
+};
+
+/// Awaits the completion of a task without taking its result, which stays in the task
+template <typename T>
+struct RStartAwaiter {
+   RCoroTask<T> &fTask;
+
+   bool await_ready() const noexcept { return fTask.await_ready(); }
+   std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) noexcept { return fTask.await_suspend(h); }
+   void await_resume() const noexcept {}
+};
+
+/// Runs one of the tasks of WhenAll(); the last one to complete resumes the awaiting coroutine
+template <typename T>
+RDetachedCoro DriveWhenAll(RCoroTask<T> &task, std::atomic<std::size_t> &nPending, std::coroutine_handle<> &continuation)
+{
+   co_await RStartAwaiter<T>{task};
+   if (--nPending == 0)
+      continuation.resume();
+}
+
+/// Starts all the tasks and suspends the awaiting coroutine until they all completed
+template <typename T>
+class RWhenAllAwaiter {
+   std::vector<RCoroTask<T>> &fTasks;
+   /// One more than the tasks still running while the tasks are started, so that none resumes the awaiting
+   /// coroutine before it is suspended
+   std::atomic<std::size_t> fNPending;
+   std::coroutine_handle<> fContinuation;
+
+public:
+   explicit RWhenAllAwaiter(std::vector<RCoroTask<T>> &tasks) : fTasks(tasks), fNPending(tasks.size() + 1) {}
+
+   bool await_ready() const noexcept { return fTasks.empty(); }
+   bool await_suspend(std::coroutine_handle<> h)
+   {
+      fContinuation = h;
+      for (auto &task : fTasks)
+         DriveWhenAll(task, fNPending, fContinuation);
+      // if all the tasks already completed, the awaiting coroutine continues without suspending
+      return --fNPending != 0;
+   }
+   void await_resume() const noexcept {}
+};
+
+} // namespace Internal
+
+/// Runs the `tasks` concurrently and completes when all of them completed, with their results in the order of
+/// `tasks`. Each task runs in the calling thread until its first suspension, e.g. at a RunOnIOThread(), so that the
+/// I/O of all the tasks is in flight at the same time. If tasks threw, the exception of the first one is rethrown
+/// once all completed.
+template <typename T>
+RCoroTask<std::vector<T>> WhenAll(std::vector<RCoroTask<T>> tasks)
+{
+   co_await Internal::RWhenAllAwaiter<T>(tasks);
+   std::vector<T> results;
+   results.reserve(tasks.size());
+   for (auto &task : tasks)
+      results.emplace_back(co_await task);
+   co_return results;
+}
+
+/// Runs the `tasks` concurrently and completes when all of them completed; see WhenAll() for tasks with a result.
+inline RCoroTask<> WhenAll(std::vector<RCoroTask<>> tasks)
+{
+   co_await Internal::RWhenAllAwaiter<void>(tasks);
+   for (auto &task : tasks)
+      co_await task;
+}
+
+/// Returns an awaitable that moves the awaiting coroutine to a task of the ROOT task arena.
+inline auto ScheduleOnTaskArena()
+{
+   struct RArenaAwaiter {
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> h) const { ROOT::Internal::EnqueueOnTaskArena([h] { h.resume(); }); }
+      void await_resume() const noexcept {}
+   };
+   return RArenaAwaiter{};
+}
+
+/// Returns an awaitable that calls the blocking `func` on an I/O thread and resumes the awaiting coroutine in the
+/// ROOT task arena once it returned. The result of `func` is the result of the `co_await` expression, and an
+/// exception thrown by `func` is rethrown there. `func` is kept in the coroutine frame: the objects it references
+/// must outlive the `co_await`.
+template <typename F>
+auto RunOnIOThread(F &&func)
+{
+   return Internal::RIOThreadAwaiter<std::decay_t<F>>(std::forward<F>(func));
+}
+
+/// Runs `task` and blocks the calling thread until it completed. Must not be called from a task of the ROOT task
+/// arena, which would then wait for the tasks that it prevents from running.
+template <typename T>
+T SyncWait(RCoroTask<T> task)
+{
+   Internal::RSyncWaitState<T> state;
+   Internal::DriveSyncWait(task, state);
+
+   std::unique_lock<std::mutex> guard(state.fLock);
+   state.fCv.wait(guard, [&] { return state.fIsDone; });
+   if (state.fException)
+      std::rethrow_exception(state.fException);
+   if constexpr (!std::is_void_v<T>)
+      return std::move(*state.fResult);
+}
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif // __cpp_impl_coroutine
+
+#endif
@@ -11,9 +11,9 @@
 #ifndef ROOT_RSLOTSTACK
 #define ROOT_RSLOTSTACK
 
-#include <ROOT/TSpinMutex.hxx>
-
-#include <stack>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -25,13 +25,33 @@ namespace Internal {
 /// resulting in undefined behavior if more slot numbers than available are
 /// requested.
 /// An important design assumption is that a slot will almost always be available
-/// when a thread asks for it, and if it is not available it will be very soon,
-/// therefore a spinlock is used for synchronization.
+/// when a thread asks for it, and if it is not available it will be very soon.
+/// The slots are therefore claimed lock-free, with one flag per slot: a thread
+/// first tries the slot it used last, such that threads keep getting the same
+/// slot, and otherwise takes the first free one.
+/// If the global task arena is NUMA-aware and has as many slots as the stack,
+/// a thread running in the arena of a NUMA node gets the slots of that node
+/// (see RTaskArenaWrapper::GetNumaSlotOffsets()) as long as some are available,
+/// so that the per-slot data stay local to the node.
 class RSlotStack {
 private:
+   /// Padded to a cache line such that threads claiming different slots do not contend
+   struct alignas(64) RSlotFlag {
+      std::atomic<bool> fInUse{false};
+   };
+
    const unsigned int fSize;
-   std::stack<unsigned int> fStack;
-   ROOT::TSpinMutex fMutex;
+   std::unique_ptr<RSlotFlag[]> fSlots;
+   std::vector<unsigned int> fNodeOffsets; ///< First slot of each NUMA node, empty if the stack is not NUMA-aware
+#ifndef NDEBUG
+   std::atomic<unsigned int> fNInUse{0}; ///< Only counted to check that no more slots than available are requested
+#endif
+
+   bool TryClaim(unsigned int slot)
+   {
+      return !fSlots[slot].fInUse.load(std::memory_order_relaxed) &&
+             !fSlots[slot].fInUse.exchange(true, std::memory_order_acquire);
+   }
 
 public:
    RSlotStack() = delete;
@@ -25,6 +25,7 @@
 
 #include "RConfigure.h"
 #include <memory>
+#include <vector>
 
 // exclude in case ROOT does not have IMT support
 #ifndef R__USE_IMT
@@ -43,6 +44,8 @@ class ROpaqueTaskArena;
 
 namespace Internal {
 
+class RNumaNodeObserver;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the available number of logical cores.
 ///
@@ -59,17 +62,35 @@ int LogicalCPUBandwidthControl();
 ///
 /// Necessary in order to keep tbb away from ROOT headers.
 /// This class is thought out to be used as a singleton.
+///
+/// If the environment variable `ROOT_IMT_NUMA` is set to 1 and TBB reports more than
+/// one NUMA node, one arena constrained to each node is created next to the flat one,
+/// with the workers split among the nodes proportionally to their cores. The threads
+/// of a node arena are pinned to the cores of that node (this requires TBB's tbbbind
+/// library). The processing slots 0 to TaskArenaSize() - 1 are split among the nodes
+/// in the same way, see GetNumaSlotOffsets().
 ////////////////////////////////////////////////////////////////////////////////
 class RTaskArenaWrapper {
 public:
    ~RTaskArenaWrapper(); // necessary to set size back to zero
    static unsigned TaskArenaSize(); // A static getter lets us check for RTaskArenaWrapper's existence
    ROOT::ROpaqueTaskArena &Access();
+   /// Number of NUMA node arenas, 0 if the arena is not NUMA-aware
+   unsigned GetNNumaNodes() const { return fNumaArenas.size(); }
+   ROOT::ROpaqueTaskArena &AccessNumaNode(unsigned node);
+   /// The slots of NUMA node `i` are [offsets[i], offsets[i + 1]); empty if the arena is not NUMA-aware
+   static const std::vector<unsigned> &GetNumaSlotOffsets();
+   /// The NUMA node arena the calling thread is running in, -1 if none
+   static int GetCurrentNumaNode();
 private:
    RTaskArenaWrapper(unsigned maxConcurrency = 0);
+   void InitializeNumaArenas(unsigned maxConcurrency);
    friend std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> GetGlobalTaskArena(unsigned maxConcurrency);
    std::unique_ptr<ROOT::ROpaqueTaskArena> fTBBArena;
+   std::vector<std::unique_ptr<ROOT::ROpaqueTaskArena>> fNumaArenas;
+   std::vector<std::unique_ptr<RNumaNodeObserver>> fNumaObservers;
    static unsigned fNWorkers;
+   static std::vector<unsigned> fNumaSlotOffsets;
 };
 
 
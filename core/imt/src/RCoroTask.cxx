@@ -0,0 +1,107 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RConfigure.h"
+
+#include "ROOT/RCoroTask.hxx"
+
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "tbb/task_arena.h"
+#include "ROOT/RTaskArena.hxx"
+#include "ROpaqueTaskArena.hxx"
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// The threads that run the blocking reads of the coroutines. They are started on first use.
+class RIOThreadPool {
+   std::mutex fLock;
+   std::condition_variable fCv;
+   std::deque<std::function<void()>> fQueue;
+   std::vector<std::thread> fThreads;
+   bool fIsStopping = false;
+
+   void Run()
+   {
+      while (true) {
+         std::function<void()> func;
+         {
+            std::unique_lock<std::mutex> guard(fLock);
+            fCv.wait(guard, [this] { return fIsStopping || !fQueue.empty(); });
+            if (fQueue.empty())
+               return;
+            func = std::move(fQueue.front());
+            fQueue.pop_front();
+         }
+         func();
+      }
+   }
+
+public:
+   RIOThreadPool()
+   {
+      unsigned int nThreads = 4;
+      if (const char *env = std::getenv("ROOT_IO_THREADS"))
+         nThreads = std::max(std::atoi(env), 1);
+      for (unsigned int i = 0; i < nThreads; ++i)
+         fThreads.emplace_back([this] { Run(); });
+   }
+
+   ~RIOThreadPool()
+   {
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         fIsStopping = true;
+      }
+      fCv.notify_all();
+      for (auto &thread : fThreads)
+         thread.join();
+   }
+
+   void Enqueue(std::function<void()> func)
+   {
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         fQueue.emplace_back(std::move(func));
+      }
+      fCv.notify_one();
+   }
+};
+
+} // anonymous namespace
+
+void ROOT::Internal::EnqueueOnTaskArena(std::function<void()> func)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      // The task keeps the arena alive until it ran
+      auto arena = GetGlobalTaskArena();
+      arena->Access().enqueue([arena, func = std::move(func)] { func(); });
+      return;
+   }
+#endif
+   func();
+}
+
+void ROOT::Internal::EnqueueOnIOThread(std::function<void()> func)
+{
+   static RIOThreadPool gIOThreadPool;
+   gIOThreadPool.Enqueue(std::move(func));
+}
@@ -8,31 +8,65 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
-#include <ROOT/TSeq.hxx>
+#include "RConfigure.h"
 #include <ROOT/RSlotStack.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/RTaskArena.hxx>
+#endif
 
 #include <cassert>
-#include <mutex> // std::lock_guard
+#include <thread> // std::this_thread::yield
 
-ROOT::Internal::RSlotStack::RSlotStack(unsigned int size) : fSize(size)
+namespace {
+/// The slot last returned by the current thread, to any RSlotStack
+thread_local unsigned int gLastSlot = -1;
+} // anonymous namespace
+
+ROOT::Internal::RSlotStack::RSlotStack(unsigned int size) : fSize(size), fSlots(new RSlotFlag[size])
 {
-   for (auto i : ROOT::TSeqU(size))
-      fStack.push(i);
+#ifdef R__USE_IMT
+   const auto &numaOffsets = ROOT::Internal::RTaskArenaWrapper::GetNumaSlotOffsets();
+   if (!numaOffsets.empty() && numaOffsets.back() == size)
+      fNodeOffsets.assign(numaOffsets.begin(), numaOffsets.end() - 1);
+#endif
 }
 
 void ROOT::Internal::RSlotStack::ReturnSlot(unsigned int slot)
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   assert(fStack.size() < fSize && "Trying to put back a slot to a full stack!");
-   (void)fSize;
-   fStack.push(slot);
+   const bool wasInUse = fSlots[slot].fInUse.exchange(false, std::memory_order_release);
+   assert(wasInUse && "Trying to put back a slot to a full stack!");
+   (void)wasInUse;
+#ifndef NDEBUG
+   --fNInUse;
+#endif
+   gLastSlot = slot;
 }
 
 unsigned int ROOT::Internal::RSlotStack::GetSlot()
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   assert(!fStack.empty() && "Trying to pop a slot from an empty stack!");
-   const auto slot = fStack.top();
-   fStack.pop();
-   return slot;
+#ifndef NDEBUG
+   assert(fNInUse++ < fSize && "Trying to pop a slot from an empty stack!");
+#endif
+
+   if (gLastSlot < fSize && TryClaim(gLastSlot))
+      return gLastSlot;
+
+   unsigned int first = 0;
+#ifdef R__USE_IMT
+   if (!fNodeOffsets.empty()) {
+      const int currentNode = ROOT::Internal::RTaskArenaWrapper::GetCurrentNumaNode();
+      if (currentNode >= 0 && static_cast<unsigned int>(currentNode) < fNodeOffsets.size())
+         first = fNodeOffsets[currentNode];
+   }
+#endif
+
+   // A slot freed behind the scan is only found by the next pass, the caller guarantees that one is free soon
+   while (true) {
+      for (unsigned int i = 0; i < fSize; ++i) {
+         const unsigned int slot = (first + i) % fSize;
+         if (TryClaim(slot))
+            return slot;
+      }
+      std::this_thread::yield();
+   }
 }
@@ -7,11 +7,14 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TThread.h"
+#include <algorithm>
 #include <fstream>
 #include <mutex>
 #include <string>
 #include <thread>
+#include "tbb/info.h"
 #include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
 
@@ -45,6 +48,25 @@
 namespace ROOT {
 namespace Internal {
 
+namespace {
+thread_local int gCurrentNumaNode = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Records the NUMA node arena the threads are running in.
+////////////////////////////////////////////////////////////////////////////////
+class RNumaNodeObserver : public tbb::task_scheduler_observer {
+   int fNode;
+
+public:
+   RNumaNodeObserver(tbb::task_arena &arena, int node) : tbb::task_scheduler_observer(arena), fNode(node)
+   {
+      observe(true);
+   }
+   void on_scheduler_entry(bool) override { gCurrentNumaNode = fNode; }
+   void on_scheduler_exit(bool) override { gCurrentNumaNode = -1; }
+};
+
 // Honor environment variable `ROOT_MAX_THREADS` if set.
 // Also honor cgroup quotas if set: see https://github.com/oneapi-src/oneTBB/issues/190
 int LogicalCPUBandwidthControl()
@@ -105,15 +127,64 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
    }
    fTBBArena->initialize(maxConcurrency);
    fNWorkers = maxConcurrency;
+   const char *envNuma = gSystem->Getenv("ROOT_IMT_NUMA");
+   if (envNuma && std::string(envNuma) == "1")
+      InitializeNumaArenas(maxConcurrency);
    ROOT::EnableThreadSafety();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Creates one arena per NUMA node, splitting the maxConcurrency workers among
+/// the nodes proportionally to their number of cores.
+////////////////////////////////////////////////////////////////////////////////
+void RTaskArenaWrapper::InitializeNumaArenas(unsigned maxConcurrency)
+{
+   // Without the tbbbind library, TBB reports a single node with id -1
+   const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+   if (nodes.size() < 2 || maxConcurrency < nodes.size()) {
+      Info("RTaskArenaWrapper", "ROOT_IMT_NUMA is set but TBB reports %zu NUMA node(s), using a flat task arena",
+           nodes.size());
+      return;
+   }
+
+   std::vector<unsigned> nodeCores;
+   unsigned nCores = 0;
+   for (auto node : nodes) {
+      nodeCores.push_back(std::max(tbb::info::default_concurrency(node), 1));
+      nCores += nodeCores.back();
+   }
+
+   fNumaSlotOffsets.assign(1, 0u);
+   unsigned nCoresUpTo = 0;
+   for (std::size_t i = 0; i < nodes.size(); ++i) {
+      nCoresUpTo += nodeCores[i];
+      // Every node gets at least one worker, the last one ends at maxConcurrency
+      const unsigned nNodesAfter = nodes.size() - i - 1;
+      unsigned end = static_cast<unsigned long>(maxConcurrency) * nCoresUpTo / nCores;
+      end = std::min(std::max(end, fNumaSlotOffsets.back() + 1), maxConcurrency - nNodesAfter);
+      const unsigned nWorkers = end - fNumaSlotOffsets.back();
+
+      tbb::task_arena::constraints constraints;
+      constraints.set_numa_id(nodes[i]);
+      constraints.set_max_concurrency(nWorkers);
+      fNumaArenas.emplace_back(new ROpaqueTaskArena{});
+      fNumaArenas.back()->initialize(constraints);
+      fNumaObservers.emplace_back(new RNumaNodeObserver(*fNumaArenas.back(), i));
+      fNumaSlotOffsets.push_back(end);
+   }
+}
+
 RTaskArenaWrapper::~RTaskArenaWrapper()
 {
+   // The observers must stop observing before their arena goes away
+   fNumaObservers.clear();
+   fNumaArenas.clear();
+   fNumaSlotOffsets.clear();
    fNWorkers = 0u;
 }
 
 unsigned RTaskArenaWrapper::fNWorkers = 0u;
+std::vector<unsigned> RTaskArenaWrapper::fNumaSlotOffsets;
 
 unsigned RTaskArenaWrapper::TaskArenaSize()
 {
@@ -127,6 +198,24 @@ ROOT::ROpaqueTaskArena &RTaskArenaWrapper::Access()
    return *fTBBArena;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Provides access to the task arena constrained to the given NUMA node.
+////////////////////////////////////////////////////////////////////////////////
+ROOT::ROpaqueTaskArena &RTaskArenaWrapper::AccessNumaNode(unsigned node)
+{
+   return *fNumaArenas.at(node);
+}
+
+const std::vector<unsigned> &RTaskArenaWrapper::GetNumaSlotOffsets()
+{
+   return fNumaSlotOffsets;
+}
+
+int RTaskArenaWrapper::GetCurrentNumaNode()
+{
+   return gCurrentNumaNode;
+}
+
 std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> GetGlobalTaskArena(unsigned maxConcurrency)
 {
    static std::weak_ptr<ROOT::Internal::RTaskArenaWrapper> weak_GTAWrapper;
@@ -20,6 +20,8 @@
 
 #include "TError.h"
 #include "ROOT/RTaskArena.hxx"
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
 #include <atomic>
 
 static std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> &R__GetTaskArena4IMT()
@@ -79,3 +81,10 @@ extern "C" bool ROOT_TImplicitMT_IsParBranchProcessingEnabled()
 {
    return GetParBranchProcessingCount() > 0;
 };
+
+/// Runs func(i, arg) for i in [0, n) on the IMT pool, for libraries below libImt
+extern "C" void ROOT_TImplicitMT_ParallelFor(UInt_t n, void (*func)(UInt_t, void *), void *arg)
+{
+   ROOT::TThreadExecutor pool;
+   pool.Foreach([func, arg](UInt_t i) { func(i, arg); }, ROOT::TSeqU(n));
+};
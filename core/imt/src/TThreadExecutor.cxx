@@ -3,6 +3,7 @@
 
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROpaqueTaskArena.hxx"
+#include "ROOT/RTrace.hxx"
 #if !defined(_MSC_VER)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -135,6 +136,35 @@ static T ParallelReduceHelper(const std::vector<T> &objs, const std::function<T(
 
 }
 
+/// A helper function running the TThreadExecutor::ParallelFor loop in the NUMA node arenas,
+/// each node processing a contiguous part of the indices proportional to its share of slots
+static void ParallelForNuma(RTaskArenaWrapper &arenaW, unsigned start, unsigned end, unsigned step,
+                            const std::function<void(unsigned int i)> &f)
+{
+   const auto &offsets = RTaskArenaWrapper::GetNumaSlotOffsets();
+   const unsigned nNodes = arenaW.GetNNumaNodes();
+   const ULong64_t nIndexes = (end - start + step - 1) / step;
+   // The first index of the part of the loop of the node whose slots start at `offset`
+   auto partStart = [&](unsigned offset) {
+      return static_cast<unsigned>(std::min<ULong64_t>(end, start + step * (nIndexes * offset / offsets.back())));
+   };
+
+   std::vector<tbb::task_group> taskGroups(nNodes);
+   for (unsigned node = 0; node < nNodes; ++node) {
+      const unsigned nodeStart = partStart(offsets[node]);
+      const unsigned nodeEnd = partStart(offsets[node + 1]);
+      if (nodeStart >= nodeEnd)
+         continue;
+      arenaW.AccessNumaNode(node).execute([&, node, nodeStart, nodeEnd] {
+         taskGroups[node].run([&f, nodeStart, nodeEnd, step] {
+            tbb::this_task_arena::isolate([&] { tbb::parallel_for(nodeStart, nodeEnd, step, f); });
+         });
+      });
+   }
+   for (unsigned node = 0; node < nNodes; ++node)
+      arenaW.AccessNumaNode(node).execute([&taskGroups, node] { taskGroups[node].wait(); });
+}
+
 } // End NS Internal
 
 //////////////////////////////////////////////////////////////////////////
@@ -157,16 +187,34 @@ TThreadExecutor::TThreadExecutor(UInt_t nThreads)
 /// \param start Start index of the loop.
 /// \param end End index of the loop.
 /// \param step Step size of the loop.
-/// \param f function to execute.
+/// \param func function to execute.
 void TThreadExecutor::ParallelFor(unsigned start, unsigned end, unsigned step,
-                                  const std::function<void(unsigned int i)> &f)
+                                  const std::function<void(unsigned int i)> &func)
 {
+   // Only pay for the wrapper if the tasks end up in a trace
+   std::function<void(unsigned int i)> tracedFunc;
+   if (ROOT::Experimental::RTrace::IsEnabled()) {
+      tracedFunc = [&func](unsigned int i) {
+         R__TRACE_SCOPE("imt", "TThreadExecutor task");
+         func(i);
+      };
+   }
+   const auto &f = tracedFunc ? tracedFunc : func;
+
    if (GetPoolSize() > tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism)) {
       Warning("TThreadExecutor::ParallelFor",
               "tbb::global_control is limiting the number of parallel workers."
               " Proceeding with %zu threads this time",
               tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
    }
+   if (fTaskArenaW->GetNNumaNodes() > 0) {
+      // Nested loops stay in the NUMA node of the task that starts them
+      if (ROOT::Internal::RTaskArenaWrapper::GetCurrentNumaNode() >= 0)
+         tbb::this_task_arena::isolate([&] { tbb::parallel_for(start, end, step, f); });
+      else
+         ROOT::Internal::ParallelForNuma(*fTaskArenaW, start, end, step, f);
+      return;
+   }
    fTaskArenaW->Access().execute([&] {
       tbb::this_task_arena::isolate([&] {
          tbb::parallel_for(start, end, step, f);
@@ -0,0 +1,139 @@
+#include "ROOT/RCoroTask.hxx"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#if defined(__cpp_impl_coroutine) && __cplusplus >= 202002L
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using ROOT::Experimental::RCoroTask;
+
+namespace {
+
+RCoroTask<> Throwing()
+{
+   co_await ROOT::Experimental::RunOnIOThread([] { throw std::runtime_error("read error"); });
+}
+
+RCoroTask<int> Square(int i)
+{
+   co_return i * i;
+}
+
+RCoroTask<int> SumOfSquares(int n)
+{
+   int sum = 0;
+   for (int i = 1; i <= n; ++i)
+      sum += co_await Square(i);
+   co_return sum;
+}
+
+/// Counts the reads, and the maximum number of reads in flight at the same time
+struct ReadCounters {
+   std::atomic<int> fNReads{0};
+   std::atomic<int> fNInFlight{0};
+   std::atomic<int> fMaxInFlight{0};
+};
+
+RCoroTask<int> SlowRead(int value, ReadCounters &counters)
+{
+   int result = co_await ROOT::Experimental::RunOnIOThread([value, &counters] {
+      int nInFlight = ++counters.fNInFlight;
+      int max = counters.fMaxInFlight;
+      while (nInFlight > max && !counters.fMaxInFlight.compare_exchange_weak(max, nInFlight))
+         ;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      --counters.fNInFlight;
+      ++counters.fNReads;
+      return value;
+   });
+   co_return result;
+}
+
+RCoroTask<int> SequentialReads(int n, ReadCounters &counters)
+{
+   int sum = 0;
+   for (int i = 0; i < n; ++i)
+      sum += co_await SlowRead(i, counters);
+   co_return sum;
+}
+
+RCoroTask<int> ConcurrentReads(int n, ReadCounters &counters)
+{
+   std::vector<RCoroTask<int>> reads;
+   for (int i = 0; i < n; ++i)
+      reads.emplace_back(SlowRead(i, counters));
+   auto values = co_await ROOT::Experimental::WhenAll(std::move(reads));
+   // the results are in the order of the tasks, not of their completion
+   int sum = 0;
+   for (int i = 0; i < n; ++i) {
+      EXPECT_EQ(values[i], i);
+      sum += values[i];
+   }
+   co_return sum;
+}
+
+RCoroTask<> ConcurrentThrowing(int n)
+{
+   std::vector<RCoroTask<>> tasks;
+   for (int i = 0; i < n; ++i)
+      tasks.emplace_back(Throwing());
+   co_await ROOT::Experimental::WhenAll(std::move(tasks));
+}
+
+
+} // anonymous namespace
+
+TEST(RCoroTask, Chain)
+{
+   EXPECT_EQ(ROOT::Experimental::SyncWait(SumOfSquares(10)), 385);
+}
+
+TEST(RCoroTask, IOThread)
+{
+   ReadCounters counters;
+   EXPECT_EQ(ROOT::Experimental::SyncWait(SequentialReads(8, counters)), 28);
+   EXPECT_EQ(counters.fNReads, 8);
+   // each read is awaited before the next one starts
+   EXPECT_EQ(counters.fMaxInFlight, 1);
+}
+
+TEST(RCoroTask, WhenAll)
+{
+   ReadCounters counters;
+   EXPECT_EQ(ROOT::Experimental::SyncWait(ConcurrentReads(8, counters)), 28);
+   EXPECT_EQ(counters.fNReads, 8);
+   // the reads are all enqueued before the first one completed, and run on the several I/O threads
+   EXPECT_GT(counters.fMaxInFlight, 1);
+
+   EXPECT_TRUE(ROOT::Experimental::SyncWait(ROOT::Experimental::WhenAll(std::vector<RCoroTask<int>>{})).empty());
+}
+
+TEST(RCoroTask, Exception)
+{
+   EXPECT_THROW(ROOT::Experimental::SyncWait(Throwing()), std::runtime_error);
+   EXPECT_THROW(ROOT::Experimental::SyncWait(ConcurrentThrowing(4)), std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST(RCoroTask, TaskArena)
+{
+   ROOT::EnableImplicitMT(2);
+   std::thread::id callerId = std::this_thread::get_id();
+   auto onArena = [](std::thread::id id) -> RCoroTask<bool> {
+      co_await ROOT::Experimental::ScheduleOnTaskArena();
+      co_return std::this_thread::get_id() != id;
+   };
+   ReadCounters counters;
+   EXPECT_TRUE(ROOT::Experimental::SyncWait(onArena(callerId)));
+   EXPECT_EQ(ROOT::Experimental::SyncWait(ConcurrentReads(4, counters)), 6);
+   ROOT::DisableImplicitMT();
+}
+#endif
+
+#endif // __cpp_impl_coroutine
@@ -1,6 +1,8 @@
 #include "TROOT.h"
+#include "ROOT/RSlotStack.hxx"
 #include "ROOT/RTaskArena.hxx"
 #include "ROOT/TThreadExecutor.hxx"
+#include "TSystem.h"
 #include "../src/ROpaqueTaskArena.hxx"
 
 #include "ROOT/TestSupport.hxx"
@@ -75,6 +77,47 @@ TEST(RTaskArena, AccessWorkingTBBtaskArena)
    ASSERT_EQ(nCores, tbbTACores);
 }
 
+// The NUMA arenas are only created on machines with several NUMA nodes and TBB's tbbbind library,
+// otherwise this checks the fallback to the flat arena.
+TEST(RTaskArena, NumaArenas)
+{
+   ROOT::TestSupport::CheckDiagsRAII raii;
+   raii.optionalDiag(kInfo, "RTaskArenaWrapper", "ROOT_IMT_NUMA is set", false);
+   gSystem->Setenv("ROOT_IMT_NUMA", "1");
+   auto gTAInstance = ROOT::Internal::GetGlobalTaskArena(maxConcurrency);
+   gSystem->Unsetenv("ROOT_IMT_NUMA");
+
+   const unsigned nNodes = gTAInstance->GetNNumaNodes();
+   const auto &offsets = ROOT::Internal::RTaskArenaWrapper::GetNumaSlotOffsets();
+   if (nNodes > 0) {
+      ASSERT_EQ(nNodes + 1, offsets.size());
+      EXPECT_EQ(0u, offsets.front());
+      EXPECT_EQ(maxConcurrency, offsets.back());
+      for (unsigned node = 0; node < nNodes; ++node)
+         EXPECT_LT(offsets[node], offsets[node + 1]);
+   } else {
+      EXPECT_TRUE(offsets.empty());
+   }
+
+   // Every index is processed once, and the slots are all handed out and returned
+   ROOT::Internal::RSlotStack slotStack(maxConcurrency);
+   std::vector<std::atomic<int>> nCalls(1000);
+   std::vector<std::atomic<int>> slotInUse(maxConcurrency);
+   std::atomic<int> nSlotClashes{0};
+   ROOT::TThreadExecutor ttex;
+   ttex.Foreach(
+      [&](unsigned i) {
+         ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
+         if (slotInUse[slotRAII.fSlot]++ != 0)
+            ++nSlotClashes;
+         ++nCalls[i];
+         --slotInUse[slotRAII.fSlot];
+      },
+      ROOT::TSeqU(nCalls.size()));
+   EXPECT_TRUE(std::all_of(nCalls.begin(), nCalls.end(), [](const std::atomic<int> &n) { return n == 1; }));
+   EXPECT_EQ(0, nSlotClashes);
+}
+
 TEST(RTaskArena, KeepSize)
 {
    SUPPRESS_DIAG
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <memory>
 #include <lz4.h>
 #include <lz4hc.h>
 #include <xxhash.h>
@@ -30,6 +31,13 @@ static const int kChecksumOffset = 2 + 1 + 3 + 3;
 static const int kChecksumSize = sizeof(XXH64_canonical_t);
 static const int kHeaderSize = kChecksumOffset + kChecksumSize;
 
+// LZ4_compress_HC allocates its ~256 kB state on the heap for every call; reuse one state per thread instead.
+static void *R__getLZ4HCState()
+{
+   thread_local std::unique_ptr<char[]> state{new char[LZ4_sizeofStateHC()]};
+   return state.get();
+}
+
 void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
    int LZ4_version = LZ4_versionNumber();
@@ -52,7 +60,9 @@ void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, in
       cxlevel = 9;
    }
    if (cxlevel >= 4) {
-      returnStatus = LZ4_compress_HC(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, cxlevel);
+      returnStatus =
+         LZ4_compress_HC_extStateHC(R__getLZ4HCState(), src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize,
+                                    cxlevel);
    } else {
       returnStatus = LZ4_compress_default(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize);
    }
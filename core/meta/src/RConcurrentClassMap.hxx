@@ -0,0 +1,129 @@
+// @(#)root/meta:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RConcurrentClassMap
+#define ROOT_RConcurrentClassMap
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TClass;
+
+namespace ROOT {
+namespace Internal {
+
+/**
+\class ROOT::Internal::RConcurrentClassMap
+\brief A map from names to TClass pointers with lock-free lookups.
+
+Used by TClass::GetClass() to find the registered classes, by name and by type_info name, before taking any lock.
+Lookups only perform acquire loads; insertions and removals, which happen when classes are registered, are
+serialized by an internal mutex. The map is an open-addressing hash table of nodes that are never deleted while the
+map lives: removing a class resets the pointer of its node. When the table grows, the previous tables are kept
+alive for the readers that may still probe them; their size is bounded by the size of the current table.
+*/
+class RConcurrentClassMap {
+   struct RNode {
+      std::string fKey;
+      std::atomic<TClass *> fClass;
+      RNode(std::string_view key, TClass *cl) : fKey(key), fClass(cl) {}
+   };
+
+   struct RTable {
+      std::size_t fMask; ///< Number of slots - 1, the number of slots being a power of 2
+      std::unique_ptr<std::atomic<RNode *>[]> fSlots;
+      explicit RTable(std::size_t nSlots) : fMask(nSlots - 1), fSlots(new std::atomic<RNode *>[nSlots])
+      {
+         for (std::size_t i = 0; i < nSlots; ++i)
+            fSlots[i].store(nullptr, std::memory_order_relaxed);
+      }
+   };
+
+   std::atomic<RTable *> fTable;
+   std::mutex fWriteLock;                        ///< Serializes the writers
+   std::vector<std::unique_ptr<RNode>> fNodes;   ///< Owns the nodes; protected by fWriteLock
+   std::vector<std::unique_ptr<RTable>> fTables; ///< Owns the current and the previous tables; by fWriteLock
+
+   static std::size_t Hash(std::string_view key) { return std::hash<std::string_view>()(key); }
+
+   static RNode *FindNode(const RTable &table, std::string_view key)
+   {
+      for (std::size_t i = Hash(key) & table.fMask;; i = (i + 1) & table.fMask) {
+         RNode *node = table.fSlots[i].load(std::memory_order_acquire);
+         if (!node || node->fKey == key)
+            return node;
+      }
+   }
+
+   static void InsertNode(RTable &table, RNode *node)
+   {
+      std::size_t i = Hash(node->fKey) & table.fMask;
+      while (table.fSlots[i].load(std::memory_order_relaxed))
+         i = (i + 1) & table.fMask;
+      table.fSlots[i].store(node, std::memory_order_release);
+   }
+
+public:
+   RConcurrentClassMap()
+   {
+      fTables.emplace_back(new RTable(1024));
+      fTable.store(fTables.back().get(), std::memory_order_release);
+   }
+   RConcurrentClassMap(const RConcurrentClassMap &) = delete;
+   RConcurrentClassMap &operator=(const RConcurrentClassMap &) = delete;
+
+   /// Returns the class registered for `key`, nullptr if there is none
+   TClass *Find(std::string_view key) const
+   {
+      RNode *node = FindNode(*fTable.load(std::memory_order_acquire), key);
+      return node ? node->fClass.load(std::memory_order_acquire) : nullptr;
+   }
+
+   /// Registers `cl` for `key`, replacing the previously registered class
+   void Insert(std::string_view key, TClass *cl)
+   {
+      std::lock_guard<std::mutex> guard(fWriteLock);
+      RTable *table = fTable.load(std::memory_order_relaxed);
+      if (RNode *node = FindNode(*table, key)) {
+         node->fClass.store(cl, std::memory_order_release);
+         return;
+      }
+      // Keep the load factor below 1/2 so that the probe sequences stay short
+      if (2 * (fNodes.size() + 1) > table->fMask + 1) {
+         fTables.emplace_back(new RTable(2 * (table->fMask + 1)));
+         RTable *newTable = fTables.back().get();
+         for (const auto &node : fNodes)
+            InsertNode(*newTable, node.get());
+         fTable.store(newTable, std::memory_order_release);
+         table = newTable;
+      }
+      fNodes.emplace_back(new RNode(key, cl));
+      InsertNode(*table, fNodes.back().get());
+   }
+
+   /// Unregisters `cl` for `key`; does nothing if another class has been registered for `key` since
+   void Remove(std::string_view key, TClass *cl)
+   {
+      std::lock_guard<std::mutex> guard(fWriteLock);
+      if (RNode *node = FindNode(*fTable.load(std::memory_order_relaxed), key))
+         node->fClass.compare_exchange_strong(cl, nullptr, std::memory_order_acq_rel);
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -70,6 +70,7 @@ In order to access the name of a class within the ROOT type system, the method T
 #include "TROOT.h"
 #include "TRealData.h"
 #include "TCheckHashRecursiveRemoveConsistency.h" // Private header
+#include "RConcurrentClassMap.hxx" // Private header
 #include "TStreamer.h"
 #include "TStreamerElement.h"
 #include "TVirtualStreamerInfo.h"
@@ -477,6 +478,24 @@ IdMap_t *TClass::GetIdMap() {
 #endif
 }
 
+namespace {
+
+/// Classes by name, used by the lock-free path of TClass::GetClass(const char*)
+ROOT::Internal::RConcurrentClassMap &GetClassNameMap()
+{
+   static ROOT::Internal::RConcurrentClassMap *gClassNameMap = new ROOT::Internal::RConcurrentClassMap;
+   return *gClassNameMap;
+}
+
+/// Classes by type_info name, used by the lock-free path of TClass::GetClass(const std::type_info&)
+ROOT::Internal::RConcurrentClassMap &GetClassTypeMap()
+{
+   static ROOT::Internal::RConcurrentClassMap *gClassTypeMap = new ROOT::Internal::RConcurrentClassMap;
+   return *gClassTypeMap;
+}
+
+} // anonymous namespace
+
 DeclIdMap_t *TClass::GetDeclIdMap() {
 
 #ifdef R__COMPLETE_MEM_TERMINATION
@@ -497,8 +516,10 @@ void TClass::AddClass(TClass *cl)
 
    R__LOCKGUARD(gInterpreterMutex);
    gROOT->GetListOfClasses()->Add(cl);
+   GetClassNameMap().Insert(cl->GetName(), cl);
    if (cl->GetTypeInfo()) {
       GetIdMap()->Add(cl->GetTypeInfo()->name(),cl);
+      GetClassTypeMap().Insert(cl->GetTypeInfo()->name(), cl);
    }
    if (cl->fClassInfo) {
       GetDeclIdMap()->Add((void*)(cl->fClassInfo), cl);
@@ -523,8 +544,10 @@ void TClass::RemoveClass(TClass *oldcl)
 
    R__LOCKGUARD(gInterpreterMutex);
    gROOT->GetListOfClasses()->Remove(oldcl);
+   GetClassNameMap().Remove(oldcl->GetName(), oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
+      GetClassTypeMap().Remove(oldcl->GetTypeInfo()->name(), oldcl);
    }
    if (oldcl->fClassInfo) {
       //GetDeclIdMap()->Remove((void*)(oldcl->fClassInfo));
@@ -2981,10 +3004,14 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Lock-free lookup of the classes that are already registered.
+   TClass *cl = GetClassNameMap().Find(name);
+   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
-   TClass *cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
+   cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
@@ -3256,10 +3283,14 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   // Lock-free lookup of the classes that are already registered.
+   TClass *cl = GetClassTypeMap().Find(typeinfo.name());
+   if (cl && cl->IsLoaded()) return cl;
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   TClass* cl = GetIdMap()->Find(typeinfo.name());
+   cl = GetIdMap()->Find(typeinfo.name());
 
    if (cl && cl->IsLoaded()) return cl;
 
@@ -4,6 +4,10 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 TEST(TClass, DictCheck)
 {
    gInterpreter->ProcessLine(".L stlDictCheck.h+");
@@ -22,3 +26,25 @@ TEST(TClass, DictCheck)
 
    EXPECT_STREQ(errMsg.c_str(), "Missing dictionary for C, ") << errMsg;
 }
+
+TEST(TClass, ConcurrentGetClass)
+{
+   TClass *byName = TClass::GetClass("TNamed");
+   TClass *byType = TClass::GetClass(typeid(THashTable));
+   ASSERT_NE(byName, nullptr);
+   ASSERT_NE(byType, nullptr);
+
+   std::atomic<int> nMismatches{0};
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&] {
+         for (int i = 0; i < 10000; ++i) {
+            if (TClass::GetClass("TNamed") != byName || TClass::GetClass(typeid(THashTable)) != byType)
+               ++nMismatches;
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   EXPECT_EQ(nMismatches, 0);
+}
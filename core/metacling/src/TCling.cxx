@@ -20,6 +20,7 @@ clang/LLVM technology.
 #include "TCling.h"
 
 #include "ROOT/FoundationUtils.hxx"
+#include "ROOT/RStartupTrace.hxx"
 
 #include "TClingBaseClassInfo.h"
 #include "TClingCallFunc.h"
@@ -1043,6 +1044,7 @@ static bool LoadModule(const std::string &ModuleName, cling::Interpreter &interp
       ::Info("TCling::__LoadModule", "Preloading module %s. \n",
              ModuleName.c_str());
 
+   ROOT::Internal::RStartupTrace::RScope traceScope("module", ModuleName);
    return interp.loadModule(ModuleName, /*Complain=*/true);
 }
 
@@ -1055,6 +1057,19 @@ static void LoadModules(const std::vector<std::string> &modules, cling::Interpre
       LoadModule(modName, interp);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Whether ROOT_STARTUP_LAZY is set: the forward declarations of the rootmap files are then only declared when the
+/// interpreter first looks up an unknown name, and the C++ modules known to the global module index are not
+/// preloaded but loaded when one of their declarations is first used.
+static bool IsStartupLazy()
+{
+   static const bool isLazy = []() {
+      auto EnvOpt = llvm::sys::Process::GetEnv("ROOT_STARTUP_LAZY");
+      return EnvOpt.has_value() && !EnvOpt->empty() && *EnvOpt != "0";
+   }();
+   return isLazy;
+}
+
 static bool IsFromRootCling() {
   // rootcling also uses TCling for generating the dictionary ROOT files.
   const static bool foundSymbol = dlsym(RTLD_DEFAULT, "usedToIdentifyRootClingByDlSym");
@@ -1221,7 +1236,6 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
    // Take this branch only from ROOT because we don't need to preload modules in rootcling
    if (!IsFromRootCling()) {
       std::vector<std::string> CommonModules = {"MathCore"};
-      LoadModules(CommonModules, clingInterp);
 
       // These modules should not be preloaded but they fix issues.
       // FIXME: Hist is not a core module but is very entangled to MathCore and
@@ -1233,7 +1247,12 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
       if (MMap.findModule("RInterface"))
          FIXMEModules.push_back("RInterface");
 
-      LoadModules(FIXMEModules, clingInterp);
+      // In lazy startup mode, the global module index decides whether the common modules need to be preloaded.
+      const bool isLazy = IsStartupLazy();
+      if (!isLazy) {
+         LoadModules(CommonModules, clingInterp);
+         LoadModules(FIXMEModules, clingInterp);
+      }
 
       GlobalModuleIndex *GlobalIndex = nullptr;
       loadGlobalModuleIndex(clingInterp);
@@ -1241,6 +1260,12 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
       // We should investigate how to suppress it completely.
       GlobalIndex = CI.getASTReader()->getGlobalIndex();
 
+      if (isLazy && !GlobalIndex) {
+         // Without an index, the declarations of a module that is not loaded cannot be found.
+         LoadModules(CommonModules, clingInterp);
+         LoadModules(FIXMEModules, clingInterp);
+      }
+
       llvm::StringSet<> KnownModuleFileNames;
       if (GlobalIndex)
          GlobalIndex->getKnownModuleFileNames(KnownModuleFileNames);
@@ -1340,6 +1365,7 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
   fPrevLoadedDynLibInfo(nullptr), fClingCallbacks(nullptr), fAutoLoadCallBack(nullptr),
   fTransactionCount(0), fHeaderParsingOnDemand(true), fIsAutoParsingSuspended(kFALSE)
 {
+   ROOT::Internal::RStartupTrace::RScope traceScope("phase", "TCling::TCling");
    fPrompt[0] = 0;
    const bool fromRootCling = IsFromRootCling();
 
@@ -1531,10 +1557,13 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
    if (!EnvOpt.has_value())
       extensions.push_back(std::make_shared<TClingRdictModuleFileExtension>());
 
-   fInterpreter = std::make_unique<cling::Interpreter>(interpArgs.size(),
-                                                       &(interpArgs[0]),
-                                                       llvmResourceDir, extensions,
-                                                       interpLibHandle);
+   {
+      ROOT::Internal::RStartupTrace::RScope interpScope("phase", "cling::Interpreter::Interpreter");
+      fInterpreter = std::make_unique<cling::Interpreter>(interpArgs.size(),
+                                                          &(interpArgs[0]),
+                                                          llvmResourceDir, extensions,
+                                                          interpLibHandle);
+   }
 
    // Don't check whether modules' files exist.
    fInterpreter->getCI()->getPreprocessorOpts().DisablePCHOrModuleValidation =
@@ -1555,8 +1584,14 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
    static llvm::raw_fd_ostream fMPOuts (STDOUT_FILENO, /*ShouldClose*/false);
    fMetaProcessor = std::make_unique<cling::MetaProcessor>(*fInterpreter, fMPOuts);
 
-   RegisterCxxModules(*fInterpreter);
-   RegisterPreIncludedHeaders(*fInterpreter);
+   {
+      ROOT::Internal::RStartupTrace::RScope modulesScope("phase", "Preloading of the C++ modules");
+      RegisterCxxModules(*fInterpreter);
+   }
+   {
+      ROOT::Internal::RStartupTrace::RScope headersScope("phase", "Pre-included headers");
+      RegisterPreIncludedHeaders(*fInterpreter);
+   }
 
    // We are now ready (enough is loaded) to init the list of opaque typedefs.
    fNormalizedCtxt = new ROOT::TMetaUtils::TNormalizedCtxt(fInterpreter->getLookupHelper());
@@ -1646,7 +1681,10 @@ void TCling::Initialize()
    // *not* using them.
    // Note this call must happen before the first call to LoadLibraryMap.
    assert(GetRootMapFiles() == nullptr && "Must be called before LoadLibraryMap!");
-   TClass::ReadRules(); // Read the default customization rules ...
+   {
+      ROOT::Internal::RStartupTrace::RScope rulesScope("phase", "TClass::ReadRules");
+      TClass::ReadRules(); // Read the default customization rules ...
+   }
 
    LoadLibraryMap();
    SetClassAutoLoading(true);
@@ -1814,6 +1852,7 @@ void TCling::LoadPCM(std::string pcmFileNameFullPath)
    SuspendAutoParsing autoparseOff(this);
    assert(!pcmFileNameFullPath.empty());
    assert(llvm::sys::path::is_absolute(pcmFileNameFullPath));
+   ROOT::Internal::RStartupTrace::RScope traceScope("pcm", pcmFileNameFullPath);
 
    // Easier to work with the ROOT interfaces.
    TString pcmFileName = pcmFileNameFullPath;
@@ -2024,6 +2063,8 @@ void TCling::RegisterModule(const char* modulename,
    // I/O; see rootcling.cxx after the call to TCling__GetInterpreter().
    if (fromRootCling) return;
 
+   ROOT::Internal::RStartupTrace::RScope traceScope("dictionary", modulename);
+
    // When we cannot provide a module for the library we should enable header
    // parsing. This 'mixed' mode ensures gradual migration to modules.
    llvm::SaveAndRestore<bool> SaveHeaderParsing(fHeaderParsingOnDemand);
@@ -5533,6 +5574,8 @@ int TCling::ReadRootmapFile(const char *rootmapfile, TUniqueString *uniqueString
    if (!requiresRootMap(rootmapfile))
       return 0; // success
 
+   ROOT::Internal::RStartupTrace::RScope traceScope("rootmap", rootmapfile);
+
    // For "class ", "namespace ", "typedef ", "header ", "enum ", "var " respectively
    const std::map<char, unsigned int> keyLenMap = {{'c',6},{'n',10},{'t',8},{'h',7},{'e',5},{'v',4}};
 
@@ -5731,6 +5774,176 @@ namespace {
    };
 }
 
+namespace {
+
+/// A directory of the dynamic path and its modification time when it was
+/// scanned, -1 if it did not exist.
+struct RScannedDir {
+   std::string fPath;
+   Long_t fMtime;
+};
+
+Long_t GetDirMtime(const char *dir)
+{
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(dir, stat) != 0 || !R_ISDIR(stat.fMode))
+      return -1;
+   return stat.fMtime;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the rootmap files in the directories of the dynamic path, in the
+/// order in which they must be read, and fills the list of scanned directories.
+
+std::vector<std::string> ScanRootmapFiles(const TString &ldpath, std::vector<RScannedDir> &dirs)
+{
+   ROOT::Internal::RStartupTrace::RScope traceScope("rootmap", "scan of the dynamic path");
+   std::vector<std::string> rootmaps;
+#ifdef WIN32
+   TObjArray* paths = ldpath.Tokenize(";");
+#else
+   TObjArray* paths = ldpath.Tokenize(":");
+#endif
+   TString d;
+   for (Int_t i = 0; i < paths->GetEntriesFast(); i++) {
+      d = ((TObjString *)paths->At(i))->GetString();
+      // check if directory already scanned
+      Int_t skip = 0;
+      for (Int_t j = 0; j < i; j++) {
+         TString pd = ((TObjString *)paths->At(j))->GetString();
+         if (pd == d) {
+            skip++;
+            break;
+         }
+      }
+      if (skip)
+         continue;
+      // Taken before the scan: a rootmap file added during the scan then invalidates the cache
+      dirs.push_back({d.Data(), GetDirMtime(d)});
+      void* dirp = gSystem->OpenDirectory(d);
+      if (dirp) {
+         if (gDebug > 3) {
+            ::Info("TCling::LoadLibraryMap", "%s", d.Data());
+         }
+         const char* f1;
+         while ((f1 = gSystem->GetDirEntry(dirp))) {
+            TString f = f1;
+            if (f.EndsWith(".rootmap")) {
+               TString p;
+               p = d + "/" + f;
+               if (!gSystem->AccessPathName(p, kReadPermission) && f != ".rootmap")
+                  rootmaps.push_back(p.Data());
+            }
+            if (f.BeginsWith("rootmap")) {
+               TString p;
+               p = d + "/" + f;
+               FileStat_t stat;
+               if (gSystem->GetPathInfo(p, stat) == 0 && R_ISREG(stat.fMode)) {
+                  ::Warning("TCling::LoadLibraryMap", "please rename %s to end with \".rootmap\"", p.Data());
+               }
+            }
+         }
+      }
+      gSystem->FreeDirectory(dirp);
+   }
+   delete paths;
+   return rootmaps;
+}
+
+constexpr const char *kRootmapCacheHeader = "ROOT rootmap cache v1";
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reads the list of rootmap files of the cache written by WriteRootmapCache().
+/// Returns false if the cache does not exist, was written for another dynamic
+/// path or if one of the scanned directories was modified since.
+
+bool ReadRootmapCache(const char *cacheFile, const TString &ldpath, std::vector<std::string> &rootmaps)
+{
+   ROOT::Internal::RStartupTrace::RScope traceScope("rootmap", cacheFile);
+   std::ifstream in(cacheFile);
+   std::string line;
+   if (!std::getline(in, line) || line != kRootmapCacheHeader)
+      return false;
+   if (!std::getline(in, line) || line != ldpath.Data())
+      return false;
+   while (std::getline(in, line)) {
+      if (line.size() < 2) {
+         rootmaps.clear();
+         return false;
+      }
+      if (line[0] == 'D') {
+         // "D <mtime> <directory>"
+         std::istringstream fields(line.substr(2));
+         Long_t mtime = 0;
+         std::string dir;
+         fields >> mtime;
+         fields.get();
+         std::getline(fields, dir);
+         if (!fields.eof() || GetDirMtime(dir.c_str()) != mtime) {
+            rootmaps.clear();
+            return false;
+         }
+      } else if (line[0] == 'F') {
+         rootmaps.push_back(line.substr(2));
+      } else {
+         rootmaps.clear();
+         return false;
+      }
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Writes the result of the scan of the dynamic path. The file is written under
+/// a temporary name and renamed, so that concurrent processes sharing the cache
+/// never read a partial file.
+
+void WriteRootmapCache(const char *cacheFile, const TString &ldpath, const std::vector<RScannedDir> &dirs,
+                       const std::vector<std::string> &rootmaps)
+{
+   std::string tmpFile = std::string(cacheFile) + ".tmp" + std::to_string(gSystem->GetPid());
+   {
+      std::ofstream out(tmpFile);
+      out << kRootmapCacheHeader << '\n' << ldpath.Data() << '\n';
+      for (const auto &dir : dirs)
+         out << "D " << dir.fMtime << ' ' << dir.fPath << '\n';
+      for (const auto &rootmap : rootmaps)
+         out << "F " << rootmap << '\n';
+      if (!out) {
+         out.close();
+         gSystem->Unlink(tmpFile.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(tmpFile.c_str(), cacheFile) != 0)
+      gSystem->Unlink(tmpFile.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the rootmap files of the dynamic path. If ROOT_STARTUP_CACHE names a
+/// file, the result of the directory scan is taken from and stored in it: on
+/// shared file systems with many directories in the dynamic path, the scan is
+/// a sizeable part of the startup time.
+
+std::vector<std::string> FindRootmapFiles(const TString &ldpath)
+{
+   const char *cacheFile = gSystem->Getenv("ROOT_STARTUP_CACHE");
+   const bool useCache = cacheFile && *cacheFile;
+   std::vector<std::string> rootmaps;
+   if (useCache && ReadRootmapCache(cacheFile, ldpath, rootmaps)) {
+      if (gDebug > 3)
+         ::Info("TCling::LoadLibraryMap", "using the rootmap files listed in %s", cacheFile);
+      return rootmaps;
+   }
+   std::vector<RScannedDir> dirs;
+   rootmaps = ScanRootmapFiles(ldpath, dirs);
+   if (useCache)
+      WriteRootmapCache(cacheFile, ldpath, dirs, rootmaps);
+   return rootmaps;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Load map between class and library. If rootmapfile is specified a
 /// specific rootmap file can be added (typically used by ACLiC).
@@ -5744,6 +5957,9 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
       return 0;
 
    R__LOCKGUARD(gInterpreterMutex);
+   ROOT::Internal::RStartupTrace::RScope traceScope("rootmap", (rootmapfile && *rootmapfile)
+                                                                  ? rootmapfile
+                                                                  : "rootmap files of the dynamic path");
 
    // open the [system].rootmap files
    if (!fMapfile) {
@@ -5764,70 +5980,24 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
    TString ldpath = gSystem->GetDynamicPath();
    if (ldpath != fRootmapLoadPath) {
       fRootmapLoadPath = ldpath;
-#ifdef WIN32
-      TObjArray* paths = ldpath.Tokenize(";");
-#else
-      TObjArray* paths = ldpath.Tokenize(":");
-#endif
-      TString d;
-      for (Int_t i = 0; i < paths->GetEntriesFast(); i++) {
-         d = ((TObjString *)paths->At(i))->GetString();
-         // check if directory already scanned
-         Int_t skip = 0;
-         for (Int_t j = 0; j < i; j++) {
-            TString pd = ((TObjString *)paths->At(j))->GetString();
-            if (pd == d) {
-               skip++;
-               break;
-            }
+      for (const std::string &path : FindRootmapFiles(ldpath)) {
+         TString p = path;
+         TString f = gSystem->BaseName(p);
+         if (fRootmapFiles->FindObject(f))
+            continue;
+         if (gDebug > 4) {
+            Info("LoadLibraryMap", "   rootmap file: %s", p.Data());
          }
-         if (!skip) {
-            void* dirp = gSystem->OpenDirectory(d);
-            if (dirp) {
-               if (gDebug > 3) {
-                  Info("LoadLibraryMap", "%s", d.Data());
-               }
-               const char* f1;
-               while ((f1 = gSystem->GetDirEntry(dirp))) {
-                  TString f = f1;
-                  if (f.EndsWith(".rootmap")) {
-                     TString p;
-                     p = d + "/" + f;
-                     if (!gSystem->AccessPathName(p, kReadPermission)) {
-                        if (!fRootmapFiles->FindObject(f) && f != ".rootmap") {
-                           if (gDebug > 4) {
-                              Info("LoadLibraryMap", "   rootmap file: %s", p.Data());
-                           }
-                           Int_t ret = ReadRootmapFile(p, &uniqueString);
-
-                           if (ret == 0)
-                              fRootmapFiles->Add(new TNamed(gSystem->BaseName(f), p.Data()));
-                           if (ret == -3) {
-                              // old format
-                              fMapfile->ReadFile(p, kEnvGlobal);
-                              fRootmapFiles->Add(new TNamed(f, p));
-                           }
-                        }
-                        // else {
-                        //    fprintf(stderr,"Reject %s because %s is already there\n",p.Data(),f.Data());
-                        //    fRootmapFiles->FindObject(f)->ls();
-                        // }
-                     }
-                  }
-                  if (f.BeginsWith("rootmap")) {
-                     TString p;
-                     p = d + "/" + f;
-                     FileStat_t stat;
-                     if (gSystem->GetPathInfo(p, stat) == 0 && R_ISREG(stat.fMode)) {
-                        Warning("LoadLibraryMap", "please rename %s to end with \".rootmap\"", p.Data());
-                     }
-                  }
-               }
-            }
-            gSystem->FreeDirectory(dirp);
+         Int_t ret = ReadRootmapFile(p, &uniqueString);
+
+         if (ret == 0)
+            fRootmapFiles->Add(new TNamed(gSystem->BaseName(f), p.Data()));
+         if (ret == -3) {
+            // old format
+            fMapfile->ReadFile(p, kEnvGlobal);
+            fRootmapFiles->Add(new TNamed(f, p));
          }
       }
-      delete paths;
       if (fMapfile->GetTable() && !fMapfile->GetTable()->GetEntries()) {
          return -1;
       }
@@ -5889,13 +6059,32 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
    }
 
    // Process the forward declarations collected
+   if (IsStartupLazy() && !(rootmapfile && *rootmapfile)) {
+      // Declared by the first lookup of an unknown name, see DeclarePendingRootmapDecls()
+      fPendingRootmapDecls += uniqueString.Data();
+      fHasPendingRootmapDecls = !fPendingRootmapDecls.empty();
+      return 0;
+   }
+   DeclareRootmapDecls(uniqueString.Data(), rootmapfile);
+
+   // clear duplicates
+
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Declare the forward declarations collected from rootmap files and make the
+/// namespaces they open visible to the autoloading.
+
+void TCling::DeclareRootmapDecls(const char *decls, const char *rootmapfile)
+{
    cling::Transaction* T = nullptr;
-   auto compRes= fInterpreter->declare(uniqueString.Data(), &T);
+   auto compRes= fInterpreter->declare(decls, &T);
    assert(cling::Interpreter::kSuccess == compRes && "A declaration in a rootmap could not be compiled");
 
    if (compRes!=cling::Interpreter::kSuccess){
       Warning("LoadLibraryMap",
-               "Problems in %s declaring '%s' were encountered.", rootmapfile, uniqueString.Data()) ;
+               "Problems in %s declaring '%s' were encountered.", rootmapfile, decls) ;
    }
 
    if (T) {
@@ -5910,10 +6099,32 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
          }
       }
    }
+}
 
-   // clear duplicates
+////////////////////////////////////////////////////////////////////////////////
+/// Declare the rootmap forward declarations whose processing was deferred by the
+/// lazy startup mode (ROOT_STARTUP_LAZY). Returns true if there were any, in which
+/// case a failed name lookup should be retried.
 
-   return 0;
+bool TCling::DeclarePendingRootmapDecls()
+{
+   if (!fHasPendingRootmapDecls)
+      return false;
+
+   R__LOCKGUARD(gInterpreterMutex);
+   if (fPendingRootmapDecls.empty())
+      return false;
+   // Moved out first: declaring them can recurse into the lookup callbacks
+   std::string decls;
+   std::swap(decls, fPendingRootmapDecls);
+   fHasPendingRootmapDecls = false;
+
+   ROOT::Internal::RStartupTrace::RScope traceScope("rootmap", "deferred forward declarations");
+   if (gDebug > 1)
+      Info("TCling::DeclarePendingRootmapDecls", "Declaring the forward declarations of the rootmap files");
+   ROOT::Internal::ParsingStateRAII parsingStateRAII(fInterpreter->getParser(), fInterpreter->getSema());
+   DeclareRootmapDecls(decls.c_str(), "the rootmap files");
+   return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -6525,6 +6736,10 @@ Int_t TCling::AutoParse(const char *cls)
    if (llvm::StringRef(cls).contains("(lambda)"))
       return 0;
 
+   // The deferred rootmap declarations might declare cls; the caller looks it up again
+   if (DeclarePendingRootmapDecls())
+      return 1;
+
    if (!fHeaderParsingOnDemand || fIsAutoParsingSuspended) {
       if (fClingCallbacks->IsAutoLoadingEnabled()) {
          return AutoLoad(cls);
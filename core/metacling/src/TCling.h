@@ -26,6 +26,7 @@
 
 #include "TInterpreter.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -124,6 +125,8 @@ private: // Data Members
    std::hash<std::string> fStringHashFunction; // A simple hashing function
    std::unordered_set<const clang::NamespaceDecl*> fNSFromRootmaps;   // Collection of namespaces fwd declared in the rootmaps
    TObjArray*      fRootmapFiles;     // Loaded rootmap files.
+   std::string     fPendingRootmapDecls; // Forward declarations of the rootmaps not yet declared (lazy startup)
+   std::atomic<bool> fHasPendingRootmapDecls{false}; // Whether fPendingRootmapDecls is not empty
    Bool_t          fLockProcessLine;  // True if ProcessLine should lock gInterpreterMutex.
    Bool_t          fCxxModulesEnabled;// True if C++ modules was enabled
 
@@ -638,6 +641,8 @@ private: // Private Utility Functions and Classes
 
    void InitRootmapFile(const char *name);
    int  ReadRootmapFile(const char *rootmapfile, TUniqueString* uniqueString = nullptr);
+   void DeclareRootmapDecls(const char *decls, const char *rootmapfile);
+   bool DeclarePendingRootmapDecls();
    Bool_t HandleNewTransaction(const cling::Transaction &T);
    bool IsClassAutoLoadingEnabled() const;
    void ProcessClassesToUpdate();
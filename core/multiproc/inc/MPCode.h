@@ -31,6 +31,8 @@ namespace MPCode {
       kExecFunc = 0,    ///< Execute function without arguments
       kExecFuncWithArg, ///< Execute function with the argument contained in the message
       kFuncResult,      ///< The message contains the result of a function execution
+      kExecFuncWithArgRange, ///< Execute function on a range of arguments. The object sent is a ULong64_t with the first index in the upper and the end index in the lower 32 bits
+      kPartialResult,   ///< Like kFuncResult, but more results of the current range of arguments follow
       /* TProcessExecutor::MapReduce */
       kIdling = 100,    ///< We are ready for the next task
       kSendResult,      ///< Ask for a kFuncResult/kProcResult
@@ -71,6 +71,16 @@ public:
    /// \return The number of workers in the pool.
    unsigned GetPoolSize() const { return TMPClient::GetNWorkers(); }
 
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Set the number of arguments that Map hands to a worker at once.
+   ///
+   /// Each batch costs one round trip between client and worker instead of
+   /// one per argument. 0 (the default) chooses it from the number of
+   /// arguments so that every worker gets about four batches; 1 hands out
+   /// arguments one at a time.
+   void SetTaskBatchSize(unsigned n) { fTaskBatchSize = n; }
+   unsigned GetTaskBatchSize() const { return fTaskBatchSize; }
+
 private:
    // Implementation of the Map functions declared in the parent class (TExecutorCRTP)
    //
@@ -87,11 +97,14 @@ private:
    template<class T> void HandlePoolCode(MPCodeBufPair &msg, TSocket *sender, std::vector<T> &reslist);
 
    void Reset();
+   unsigned BroadcastArgs();
    void ReplyToFuncResult(TSocket *s);
    void ReplyToIdle(TSocket *s);
 
    unsigned fNProcessed; ///< number of arguments already passed to the workers
    unsigned fNToProcess; ///< total number of arguments to pass to the workers
+   unsigned fTaskBatchSize = 0; ///< number of arguments per task requested by the user, 0 for automatic
+   unsigned fBatchSize = 1; ///< number of arguments per task of the Map being executed
 
    /// A collection of the types of tasks that TProcessExecutor can execute.
    /// It is used to interpret in the right way and properly reply to the
@@ -183,9 +196,7 @@ auto TProcessExecutor::MapImpl(F func, std::vector<T> &args) -> std::vector<Invo
    fNToProcess = args.size();
    std::vector<retType> reslist;
    reslist.reserve(fNToProcess);
-   std::vector<unsigned> range(fNToProcess);
-   std::iota(range.begin(), range.end(), 0);
-   fNProcessed = Broadcast(MPCode::kExecFuncWithArg, range);
+   fNProcessed = BroadcastArgs();
 
    //collect results, give out other tasks if needed
    Collect(reslist);
@@ -228,9 +239,7 @@ auto TProcessExecutor::MapImpl(F func, const std::vector<T> &args) -> std::vecto
    fNToProcess = args.size();
    std::vector<retType> reslist;
    reslist.reserve(fNToProcess);
-   std::vector<unsigned> range(fNToProcess);
-   std::iota(range.begin(), range.end(), 0);
-   fNProcessed = Broadcast(MPCode::kExecFuncWithArg, range);
+   fNProcessed = BroadcastArgs();
 
    //collect results, give out other tasks if needed
    Collect(reslist);
@@ -386,6 +395,8 @@ void TProcessExecutor::HandlePoolCode(MPCodeBufPair &msg, TSocket *s, std::vecto
    if (code == MPCode::kFuncResult) {
       reslist.push_back(std::move(ReadBuffer<T>(msg.second.get())));
       ReplyToFuncResult(s);
+   } else if (code == MPCode::kPartialResult) {
+      reslist.push_back(std::move(ReadBuffer<T>(msg.second.get())));
    } else if (code == MPCode::kIdling) {
       ReplyToIdle(s);
    } else if(code == MPCode::kProcResult) {
@@ -178,6 +178,13 @@ public:
          unsigned n;
          msg.second->ReadUInt(n);
          MPSend(s, MPCode::kFuncResult, fFunc(fArgs[n]));
+      } else if (code == MPCode::kExecFuncWithArgRange) {
+         ULong64_t range;
+         *(msg.second) >> range;
+         const unsigned begin = range >> 32, end = range & 0xffffffff;
+         // one message per result, only the last one asks for the next range
+         for (unsigned n = begin; n < end; ++n)
+            MPSend(s, n + 1 < end ? MPCode::kPartialResult : MPCode::kFuncResult, fFunc(fArgs[n]));
       } else {
          std::string reply = "S" + std::to_string(GetNWorker()) + ": unknown code received: " + std::to_string(code);
          MPSend(s, MPCode::kError, reply.c_str());
@@ -11,8 +11,168 @@
  
 #include "MPSendRecv.h"
 #include "TBufferFile.h"
+#include "TEnv.h"
 #include "MPCode.h"
+#include <atomic>
 #include <memory> //unique_ptr
+#include <mutex>
+#include <cstring> //memcpy
+#include <cerrno>
+#include <vector>
+#include <fcntl.h> //O_* constants
+#include <sys/mman.h> //shm_open, mmap
+#include <sys/stat.h> //fstat
+#include <unistd.h> //ftruncate, getpid
+
+namespace {
+
+/// Set in the object size field of a message when the object is not sent
+/// over the socket, but stored in a POSIX shared memory segment: the message
+/// then only carries the name of the segment.
+/// The size field is always sent as 8 bytes, so the flag is a 64 bit value
+/// even where ULong_t is 32 bits wide.
+constexpr ULong64_t kShmFlag = 1ULL << 63;
+
+/// Objects larger than this (in bytes) are passed through shared memory.
+/// Configurable via `MultiProc.ShmThreshold` in .rootrc, 0 disables it.
+ULong64_t GetShmThreshold()
+{
+   const Long_t threshold = gEnv->GetValue("MultiProc.ShmThreshold", 4 * 1024 * 1024);
+   return threshold > 0 ? threshold : 0;
+}
+
+/// The prefix of the names of the shared memory segments created by this process.
+std::string GetShmPrefix()
+{
+   return "/root_mp_" + std::to_string(getpid()) + "_";
+}
+
+/// The names of the segments created by this process that the receiver
+/// might not have opened yet. The receiver removes a segment as soon as it
+/// opens it; the ones still existing when the process exits (e.g. because the
+/// receiver died or stopped reading) are removed here, so that they do not
+/// stay in /dev/shm.
+class TMPShmRegistry {
+   std::mutex fMutex;
+   std::vector<std::string> fNames;
+
+   /// Forget the segments already removed by the receiver.
+   void Prune()
+   {
+      std::vector<std::string> pending;
+      for (auto &name : fNames) {
+         int fd = shm_open(name.c_str(), O_RDONLY, 0);
+         if (fd >= 0) {
+            close(fd);
+            pending.emplace_back(std::move(name));
+         }
+      }
+      fNames.swap(pending);
+   }
+
+public:
+   ~TMPShmRegistry()
+   {
+      // a forked worker inherits the names of its parent, which are not its own to remove
+      const std::string prefix = GetShmPrefix();
+      for (const auto &name : fNames)
+         if (name.compare(0, prefix.size(), prefix) == 0)
+            shm_unlink(name.c_str());
+   }
+
+   void Add(const std::string &name)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      Prune();
+      fNames.emplace_back(name);
+   }
+
+   void Remove(const std::string &name)
+   {
+      shm_unlink(name.c_str());
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (auto it = fNames.begin(); it != fNames.end(); ++it) {
+         if (*it == name) {
+            fNames.erase(it);
+            break;
+         }
+      }
+   }
+};
+
+TMPShmRegistry &GetShmRegistry()
+{
+   static TMPShmRegistry registry;
+   return registry;
+}
+
+/// Copy the serialized object into a new shared memory segment and return
+/// its name, or an empty string if that was not possible, in which case the
+/// object is sent over the socket.
+/// The pages of the segment are allocated before mapping it: with a plain
+/// ftruncate, writing to the mapping raises SIGBUS if /dev/shm is full.
+std::string WriteToShm(const TBufferFile &objBuf)
+{
+   static std::atomic<unsigned> counter{0};
+   std::string name = GetShmPrefix() + std::to_string(counter++);
+
+   int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+   if (fd < 0)
+      return "";
+   const size_t len = objBuf.Length();
+   void *addr = MAP_FAILED;
+#ifdef R__MACOSX
+   // no posix_fallocate; shared memory on macOS is not backed by a size-limited filesystem
+   const int allocErr = ftruncate(fd, len) == 0 ? 0 : errno;
+#else
+   const int allocErr = posix_fallocate(fd, 0, len);
+#endif
+   if (allocErr == 0)
+      addr = mmap(nullptr, len, PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED) {
+      shm_unlink(name.c_str());
+      return "";
+   }
+   memcpy(addr, objBuf.Buffer(), len);
+   munmap(addr, len);
+   GetShmRegistry().Add(name);
+   return name;
+}
+
+/// A read buffer backed by a private mapping of a shared memory segment,
+/// which is unmapped when the buffer is destroyed.
+class TMPShmBufferFile : public TBufferFile {
+   void *fAddr;
+   size_t fLen;
+
+public:
+   TMPShmBufferFile(void *addr, size_t len)
+      : TBufferFile(TBuffer::kRead, len, addr, false), fAddr(addr), fLen(len)
+   {
+   }
+   ~TMPShmBufferFile() override { munmap(fAddr, fLen); }
+};
+
+/// Map the shared memory segment with the given name, which is removed
+/// right away. Return null on failure.
+std::unique_ptr<TBufferFile> ReadFromShm(const std::string &name)
+{
+   int fd = shm_open(name.c_str(), O_RDONLY, 0);
+   if (fd < 0)
+      return nullptr;
+   shm_unlink(name.c_str());
+   struct stat st;
+   void *addr = MAP_FAILED;
+   if (fstat(fd, &st) == 0 && st.st_size > 0)
+      addr = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED)
+      return nullptr;
+   return std::unique_ptr<TBufferFile>(new TMPShmBufferFile(addr, st.st_size));
+}
+
+} // namespace
 
 //////////////////////////////////////////////////////////////////////////
 /// Send a message with the specified code on the specified socket.
@@ -38,6 +198,43 @@ int MPSend(TSocket *s, unsigned code)
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with the specified code and a serialized object.
+/// Objects larger than `MultiProc.ShmThreshold` bytes (4 MB by default) are
+/// not pushed through the socket: they are copied into a POSIX shared memory
+/// segment and only the name of the segment is sent. MPRecv() maps the
+/// segment and removes it, so this is transparent for the receiver.
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param objBuf the buffer containing the serialized object
+/// \return the number of bytes sent, as per TSocket::SendRaw
+int MPSendBuffer(TSocket *s, unsigned code, const TBufferFile &objBuf)
+{
+   const ULong64_t threshold = GetShmThreshold();
+   if (threshold && ULong64_t(objBuf.Length()) > threshold) {
+      const std::string name = WriteToShm(objBuf);
+      if (!name.empty()) {
+         TBufferFile wBuf(TBuffer::kWrite);
+         wBuf.WriteUInt(code);
+         wBuf.WriteULong64(kShmFlag | name.size());
+         wBuf.WriteFastArray(name.data(), name.size());
+         const int nBytes = s->SendRaw(wBuf.Buffer(), wBuf.Length());
+         if (nBytes <= 0)
+            GetShmRegistry().Remove(name);
+         return nBytes;
+      }
+   }
+
+   //send the header and the object without copying them into one buffer
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   wBuf.WriteULong(objBuf.Length());
+   const void *buffers[] = {wBuf.Buffer(), objBuf.Buffer()};
+   const Int_t lengths[] = {wBuf.Length(), objBuf.Length()};
+   return s->SendRawV(buffers, lengths, 2);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 /// Receive message from a socket.
 /// This standalone function can be used to read a message that
@@ -70,13 +267,22 @@ MPCodeBufPair MPRecv(TSocket *s)
    rawbuf = new char[8];
    s->RecvRaw(rawbuf, 8);
    bufReader.SetBuffer(rawbuf, 8, false);
-   ULong_t classBufSize;
-   bufReader.ReadULong(classBufSize);
+   ULong64_t classBufSize;
+   bufReader.ReadULong64(classBufSize);
    delete [] rawbuf;
 
    //receive object if needed
    std::unique_ptr<TBufferFile> objBuf; //defaults to nullptr
-   if (classBufSize != 0) {
+   if (classBufSize & kShmFlag) {
+      //the object is in a shared memory segment, the message only contains its name
+      std::string name(classBufSize & ~kShmFlag, '\0');
+      s->RecvRaw(&name[0], name.size());
+      objBuf = ReadFromShm(name);
+      if (!objBuf) {
+         Error("MPRecv", "[E] Could not map shared memory segment %s\n", name.c_str());
+         return std::make_pair(MPCode::kRecvError, nullptr);
+      }
+   } else if (classBufSize != 0) {
       char *classBuf = new char[classBufSize];
       s->RecvRaw(classBuf, classBufSize);
       objBuf.reset(new TBufferFile(TBuffer::kRead, classBufSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
@@ -98,9 +98,38 @@ void TProcessExecutor::Reset()
 {
    fNProcessed = 0;
    fNToProcess = 0;
+   fBatchSize = 1;
    fTaskType = ETask::kNoTask;
 }
 
+namespace {
+ULong64_t EncodeRange(unsigned begin, unsigned end)
+{
+   return (ULong64_t(begin) << 32) | end;
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+/// Give the first arguments of a Map with arguments to the workers, in
+/// batches of fBatchSize. Return the number of arguments handed out.
+unsigned TProcessExecutor::BroadcastArgs()
+{
+   const unsigned nWorkers = std::max(1u, GetPoolSize());
+   fBatchSize = fTaskBatchSize ? fTaskBatchSize : std::max(1u, fNToProcess / (4 * nWorkers));
+
+   if (fBatchSize == 1) {
+      std::vector<unsigned> range(fNToProcess);
+      std::iota(range.begin(), range.end(), 0);
+      return Broadcast(MPCode::kExecFuncWithArg, range);
+   }
+
+   std::vector<ULong64_t> ranges;
+   for (unsigned begin = 0; begin < fNToProcess && ranges.size() < nWorkers; begin += fBatchSize)
+      ranges.push_back(EncodeRange(begin, std::min(begin + fBatchSize, fNToProcess)));
+   const unsigned nSent = Broadcast(MPCode::kExecFuncWithArgRange, ranges);
+   return std::min(nSent * fBatchSize, fNToProcess);
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// Reply to a worker who just sent a result.
 /// If another argument to process exists, tell the worker. Otherwise
@@ -111,7 +140,12 @@ void TProcessExecutor::ReplyToFuncResult(TSocket *s)
       //this cannot be a "greedy worker" task
       if (fTaskType == ETask::kMap)
          MPSend(s, MPCode::kExecFunc);
-      else if (fTaskType == ETask::kMapWithArg)
+      else if (fTaskType == ETask::kMapWithArg && fBatchSize > 1) {
+         const unsigned end = std::min(fNProcessed + fBatchSize, fNToProcess);
+         MPSend(s, MPCode::kExecFuncWithArgRange, EncodeRange(fNProcessed, end));
+         fNProcessed = end;
+         return;
+      } else if (fTaskType == ETask::kMapWithArg)
          MPSend(s, MPCode::kExecFuncWithArg, fNProcessed);
       ++fNProcessed;
    } else //whatever the task is, we are done
@@ -0,0 +1,164 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "MPCode.h"
+#include "MPSendRecv.h"
+#include "TEnv.h"
+#include "TNamed.h"
+#include "TSocket.h"
+
+#include <dirent.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+/// A connected pair of sockets, as used between TMPClient and its workers.
+struct SocketPair {
+   std::unique_ptr<TSocket> fSender;
+   std::unique_ptr<TSocket> fReceiver;
+
+   SocketPair()
+   {
+      int fds[2];
+      EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+      fSender.reset(new TSocket(fds[0], "MPsock"));
+      fReceiver.reset(new TSocket(fds[1], "MPsock"));
+   }
+};
+
+/// Pass every object larger than 1 kB through shared memory.
+struct ShmThreshold {
+   ShmThreshold() { gEnv->SetValue("MultiProc.ShmThreshold", 1024); }
+   ~ShmThreshold() { gEnv->SetValue("MultiProc.ShmThreshold", 4 * 1024 * 1024); }
+};
+
+/// The number of shared memory segments created by process pid that still exist.
+/// Only meaningful where POSIX shared memory is mounted on /dev/shm.
+int CountSegments(pid_t pid)
+{
+   const std::string prefix = "root_mp_" + std::to_string(pid) + "_";
+   int n = 0;
+   if (DIR *dir = opendir("/dev/shm")) {
+      while (dirent *entry = readdir(dir))
+         if (std::string(entry->d_name).compare(0, prefix.size(), prefix) == 0)
+            n++;
+      closedir(dir);
+   }
+   return n;
+}
+
+bool HasDevShm()
+{
+   return access("/dev/shm", R_OK) == 0;
+}
+
+std::string LargeTitle()
+{
+   return std::string(100000, 'x');
+}
+
+/// Receive a TNamed sent with MPSend and check its content.
+void ExpectNamed(TSocket *s, unsigned expectedCode, const std::string &expectedTitle)
+{
+   MPCodeBufPair msg = MPRecv(s);
+   ASSERT_EQ(msg.first, expectedCode);
+   ASSERT_NE(msg.second, nullptr);
+   std::unique_ptr<TNamed> obj(ReadBuffer<TNamed *>(msg.second.get()));
+   ASSERT_NE(obj, nullptr);
+   EXPECT_STREQ(obj->GetName(), "obj");
+   EXPECT_EQ(expectedTitle, obj->GetTitle());
+}
+
+} // namespace
+
+TEST(MPSendRecv, SmallObjectThroughSocket)
+{
+   ShmThreshold threshold;
+   SocketPair sockets;
+   TNamed named("obj", "small");
+   EXPECT_GT(MPSend(sockets.fSender.get(), MPCode::kMessage, &named), 0);
+   if (HasDevShm()) {
+      EXPECT_EQ(CountSegments(getpid()), 0);
+   }
+   ExpectNamed(sockets.fReceiver.get(), MPCode::kMessage, "small");
+}
+
+TEST(MPSendRecv, LargeObjectThroughShm)
+{
+   ShmThreshold threshold;
+   SocketPair sockets;
+   const std::string title = LargeTitle();
+   TNamed named("obj", title.c_str());
+   // only the name of the segment goes through the socket, so sending does not block
+   // even if the receiver is in the same thread
+   const int nBytes = MPSend(sockets.fSender.get(), MPCode::kMessage, &named);
+   EXPECT_GT(nBytes, 0);
+   EXPECT_LT(nBytes, 1024);
+   if (HasDevShm()) {
+      EXPECT_EQ(CountSegments(getpid()), 1);
+   }
+   ExpectNamed(sockets.fReceiver.get(), MPCode::kMessage, title);
+   // the receiver removes the segment as soon as it has mapped it
+   if (HasDevShm()) {
+      EXPECT_EQ(CountSegments(getpid()), 0);
+   }
+}
+
+TEST(MPSendRecv, UnreadSegmentRemovedAtExit)
+{
+   if (!HasDevShm())
+      GTEST_SKIP() << "/dev/shm not available";
+   ShmThreshold threshold;
+   SocketPair sockets;
+   const pid_t pid = fork();
+   ASSERT_GE(pid, 0);
+   if (pid == 0) {
+      TNamed named("obj", LargeTitle().c_str());
+      const int nBytes = MPSend(sockets.fSender.get(), MPCode::kMessage, &named);
+      exit(nBytes > 0 && CountSegments(getpid()) == 1 ? 0 : 1);
+   }
+   int status = 0;
+   ASSERT_EQ(waitpid(pid, &status, 0), pid);
+   ASSERT_TRUE(WIFEXITED(status));
+   EXPECT_EQ(WEXITSTATUS(status), 0);
+   // the message was never read: the sender removed the segment when exiting
+   EXPECT_EQ(CountSegments(pid), 0);
+}
+
+TEST(MPSendRecv, FallbackToSocketIfShmAllocationFails)
+{
+   ShmThreshold threshold;
+   SocketPair sockets;
+   const std::string title = LargeTitle();
+   const pid_t pid = fork();
+   ASSERT_GE(pid, 0);
+   if (pid == 0) {
+      // files, and therefore shared memory segments, cannot be larger than 4 kB in the child:
+      // allocating the segment fails and the object must be sent through the socket
+      signal(SIGXFSZ, SIG_IGN);
+      rlimit limit{4096, 4096};
+      setrlimit(RLIMIT_FSIZE, &limit);
+      TNamed named("obj", title.c_str());
+      const int nBytes = MPSend(sockets.fSender.get(), MPCode::kMessage, &named);
+      exit(nBytes > int(title.size()) && CountSegments(getpid()) == 0 ? 0 : 1);
+   }
+   ExpectNamed(sockets.fReceiver.get(), MPCode::kMessage, title);
+   int status = 0;
+   ASSERT_EQ(waitpid(pid, &status, 0), pid);
+   ASSERT_TRUE(WIFEXITED(status));
+   EXPECT_EQ(WEXITSTATUS(status), 0);
+}
@@ -17,7 +17,7 @@
 
 namespace ROOT {
 
-class TRWSpinLock;
+class TDistributedRWSpinLock;
 
 namespace Internal {
 
@@ -30,7 +30,7 @@ using RUidColl = std::vector<Int_t>;
 class RConcurrentHashColl {
 private:
    mutable std::unique_ptr<RHashMap> fHashMap;
-   mutable std::unique_ptr<ROOT::TRWSpinLock> fRWLock;
+   mutable std::unique_ptr<ROOT::TDistributedRWSpinLock> fRWLock;
 
 public:
    class HashValue {
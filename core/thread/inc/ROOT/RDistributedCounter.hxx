@@ -0,0 +1,102 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDistributedCounter
+#define ROOT_RDistributedCounter
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+\class ROOT::Internal::RDistributedCounter
+\brief An atomic counter split over several cache lines.
+
+Every thread increments and decrements only the slot it is assigned to, so that threads updating the counter
+concurrently do not bounce the same cache line between cores. Reading the value sums all slots and is therefore
+more expensive than with a `std::atomic<int>`: the counter suits values that are updated on hot paths but only read
+on slow paths, like the number of readers of a RW lock which only a writer needs to know.
+
+The operators mirror those of `std::atomic<int>` used by the RW locks, so that it can replace it as their
+`ReadersCountT` policy. All operations are sequentially consistent.
+*/
+class RDistributedCounter {
+public:
+   static constexpr unsigned int kMaxSlots = 64;
+
+private:
+   /// Padded to a cache line to avoid false sharing between the slots
+   struct alignas(64) RSlot {
+      std::atomic<int> fValue{0};
+   };
+
+   std::unique_ptr<RSlot[]> fSlots;
+   unsigned int fMask; ///< Number of slots - 1, the number of slots being a power of 2
+
+   /// Hash of the thread id. Not kept in a thread_local: the first access to the thread-local storage of a shared
+   /// library can take the loader lock, which would dead-lock the RW locks held during library loading.
+   static unsigned int GetThreadIndex()
+   {
+      const std::uint64_t id = std::hash<std::thread::id>()(std::this_thread::get_id());
+      // Thread ids are often aligned addresses, mix the bits before masking
+      return static_cast<unsigned int>((id * 0x9E3779B97F4A7C15ull) >> 40);
+   }
+
+   static unsigned int GetNSlots()
+   {
+      const unsigned int nCores = std::min(std::max(std::thread::hardware_concurrency(), 1u), kMaxSlots);
+      unsigned int nSlots = 1;
+      while (nSlots < nCores)
+         nSlots *= 2;
+      return nSlots;
+   }
+
+   std::atomic<int> &GetLocal() { return fSlots[GetThreadIndex() & fMask].fValue; }
+
+public:
+   explicit RDistributedCounter(int value = 0) : fSlots(new RSlot[GetNSlots()]), fMask(GetNSlots() - 1)
+   {
+      fSlots[0].fValue = value;
+   }
+   RDistributedCounter(const RDistributedCounter &) = delete;
+   RDistributedCounter &operator=(const RDistributedCounter &) = delete;
+
+   void operator++() { GetLocal().fetch_add(1); }
+   void operator--() { GetLocal().fetch_sub(1); }
+   void operator+=(int value) { GetLocal().fetch_add(value); }
+   void operator-=(int value) { GetLocal().fetch_sub(value); }
+
+   /// Sets the total; only meaningful if no other thread updates the counter concurrently.
+   RDistributedCounter &operator=(int value)
+   {
+      GetLocal() += value - Load();
+      return *this;
+   }
+
+   int Load() const
+   {
+      int sum = 0;
+      for (unsigned int i = 0; i <= fMask; ++i)
+         sum += fSlots[i].fValue.load();
+      return sum;
+   }
+   operator int() const { return Load(); }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,61 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TDistributedRWSpinLock
+#define ROOT_TDistributedRWSpinLock
+
+#include "ROOT/RDistributedCounter.hxx"
+#include "ROOT/TSpinMutex.hxx"
+
+#include <atomic>
+#include <condition_variable>
+
+namespace ROOT {
+class TDistributedRWSpinLock {
+private:
+   Internal::RDistributedCounter fReaders;           ///<! Number of readers
+   Internal::RDistributedCounter fReaderReservation; ///<! A reader wants access
+   std::atomic<int> fWriterReservation;              ///<! A writer wants access
+   std::atomic<bool> fWriter;                        ///<! Is there a writer?
+   ROOT::TSpinMutex fMutex;                          ///<! RWlock internal mutex
+   std::condition_variable_any fCond;                ///<! RWlock internal condition variable
+
+public:
+   ////////////////////////////////////////////////////////////////////////
+   /// Regular constructor.
+   TDistributedRWSpinLock() : fReaders(0), fReaderReservation(0), fWriterReservation(0), fWriter(false) {}
+
+   void ReadLock();
+   void ReadUnLock();
+   void WriteLock();
+   void WriteUnLock();
+};
+
+class TDistributedRWSpinLockReadGuard {
+private:
+   TDistributedRWSpinLock &fLock;
+
+public:
+   TDistributedRWSpinLockReadGuard(TDistributedRWSpinLock &lock);
+   ~TDistributedRWSpinLockReadGuard();
+};
+
+class TDistributedRWSpinLockWriteGuard {
+private:
+   TDistributedRWSpinLock &fLock;
+
+public:
+   TDistributedRWSpinLockWriteGuard(TDistributedRWSpinLock &lock);
+   ~TDistributedRWSpinLockWriteGuard();
+};
+
+} // end of namespace ROOT
+
+#endif
@@ -17,6 +17,7 @@
 #include "TError.h"
 #include "TList.h"
 #include "TROOT.h"
+#include "TSystem.h"
 
 
 #include <algorithm>
@@ -29,6 +30,8 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 class TH1;
@@ -110,6 +113,24 @@ namespace ROOT {
             static TDirectory *Create() { return nullptr; }
          };
 
+         /// Call func(i) for i in [0, n), in parallel on the IMT pool if implicit multi-threading is enabled.
+         /// libThread cannot depend on libImt, the loop is run by a function looked up in libImt.
+         inline void ParallelFor(unsigned n, const std::function<void(unsigned)> &func)
+         {
+            using ParallelFor_t = void (*)(UInt_t, void (*)(UInt_t, void *), void *);
+            if (n > 1 && ROOT::IsImplicitMTEnabled()) {
+               static const auto parallelFor =
+                  reinterpret_cast<ParallelFor_t>(gSystem->DynFindSymbol(nullptr, "ROOT_TImplicitMT_ParallelFor"));
+               if (parallelFor) {
+                  auto call = [](UInt_t i, void *f) { (*static_cast<const std::function<void(unsigned)> *>(f))(i); };
+                  parallelFor(n, call, const_cast<std::function<void(unsigned)> *>(&func));
+                  return;
+               }
+            }
+            for (unsigned i = 0; i < n; ++i)
+               func(i);
+         }
+
       } // End of namespace TThreadedObjectUtils
    } // End of namespace Internal
 
@@ -146,6 +167,12 @@ namespace ROOT {
     * In case an elaborate thread management is in place, e.g. in presence of
     * stream of operations or "processing slots", it is also possible to
     * manually select the correct object pointer explicitly.
+    *
+    * For large objects and many slots, groups of slots can share a single copy,
+    * see SetSlotGroups(): e.g. one copy per NUMA node, passing the offsets
+    * returned by ROOT::Internal::RTaskArenaWrapper::GetNumaSlotOffsets().
+    * A shared copy must then be modified through ApplyAtSlot() or a
+    * TThreadedObjectFiller, which buffers the fills of each slot.
     */
    template<class T>
    class TThreadedObject {
@@ -214,11 +241,62 @@ namespace ROOT {
          }
 
          auto &objPointer = fObjPointers[i];
-         if (!objPointer)
-            objPointer.reset(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get(), fDirectories[i]));
+         if (!objPointer) {
+            const int group = GetSlotGroup(i);
+            if (group < 0) {
+               objPointer.reset(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get(), fDirectories[i]));
+            } else {
+               std::lock_guard<std::mutex> lg(fGroupMutexes[group]);
+               auto &copy = fGroupCopies[group];
+               if (!copy)
+                  copy.reset(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get(),
+                                                                               fDirectories[fGroupOffsets[group]]));
+               objPointer = copy;
+            }
+         }
          return objPointer;
       }
 
+      /// Let groups of slots share a single copy of the object, to bound the memory used by large objects.
+      /// The slots of group `g` are [offsets[g], offsets[g + 1]), slots beyond offsets.back() keep their own copy.
+      /// Must be called before any slot is used.
+      void SetSlotGroups(const std::vector<unsigned> &offsets)
+      {
+         if (offsets.size() < 2 || !std::is_sorted(offsets.begin(), offsets.end())) {
+            Warning("TThreadedObject::SetSlotGroups", "Invalid slot offsets, doing nothing.");
+            return;
+         }
+         std::lock_guard<ROOT::TSpinMutex> lg(fSpinMutex);
+         if (std::any_of(fObjPointers.begin(), fObjPointers.end(), [](const std::shared_ptr<T> &p) { return !!p; })) {
+            Warning("TThreadedObject::SetSlotGroups", "Some slots are already in use, doing nothing.");
+            return;
+         }
+         while (fObjPointers.size() < offsets.back()) {
+            fDirectories.emplace_back(Internal::TThreadedObjectUtils::DirCreator<T>::Create());
+            fObjPointers.emplace_back(nullptr);
+         }
+         fGroupOffsets = offsets;
+         fGroupCopies.assign(offsets.size() - 1, nullptr);
+         fGroupMutexes.reset(new std::mutex[offsets.size() - 1]);
+      }
+
+      /// Call `func(obj)` with the object of slot `i`. If the slot shares its copy with other slots
+      /// (see SetSlotGroups()), the call holds the lock of the group.
+      template <class F>
+      void ApplyAtSlot(unsigned i, F &&func)
+      {
+         auto obj = GetAtSlot(i);
+         if (!obj)
+            return;
+         const int group = GetSlotGroup(i);
+         if (group < 0) {
+            func(*obj);
+            return;
+         }
+         std::lock_guard<std::mutex> lg(fGroupMutexes[group]);
+         func(*obj);
+      }
+
       /// Set the value of a particular slot.
       ///
       /// This method is thread-safe as long as concurrent calls access different slots (i.e. pass a different
@@ -298,13 +376,41 @@ namespace ROOT {
             Warning("TThreadedObject::Merge", "This object was already merged. Returning the previous result.");
             return fObjPointers[0];
          }
-         // need to convert to std::vector because historically mergeFunction requires a vector
-         auto vecOfObjPtrs = std::vector<std::shared_ptr<T>>(fObjPointers.begin(), fObjPointers.end());
+         auto vecOfObjPtrs = GetObjects();
          mergeFunction(fObjPointers[0], vecOfObjPtrs);
          fIsMerged = true;
          return fObjPointers[0];
       }
 
+      /// Merge all the thread private objects like Merge(), as a tree: pairs of objects are merged
+      /// concurrently on the IMT pool, then pairs of results, and so on, in log2(N) steps instead of N.
+      /// `mergeFunction` is called with a target and a vector holding one other object, concurrently for
+      /// different targets. Without implicit multi-threading the merge steps run sequentially.
+      std::shared_ptr<T> MergeParallel(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>)
+      {
+         if (fIsMerged) {
+            Warning("TThreadedObject::MergeParallel", "This object was already merged. Returning the previous result.");
+            return fObjPointers[0];
+         }
+         if (!fObjPointers[0])
+            return Merge(mergeFunction);
+
+         std::vector<std::shared_ptr<T>> objs;
+         for (auto &&obj : GetObjects()) {
+            if (obj)
+               objs.emplace_back(obj);
+         }
+         for (std::size_t stride = 1; stride < objs.size(); stride *= 2) {
+            const unsigned nPairs = (objs.size() - stride + 2 * stride - 1) / (2 * stride);
+            Internal::TThreadedObjectUtils::ParallelFor(nPairs, [&](unsigned k) {
+               std::vector<std::shared_ptr<T>> other{objs[2 * stride * k + stride]};
+               mergeFunction(objs[2 * stride * k], other);
+            });
+         }
+         fIsMerged = true;
+         return fObjPointers[0];
+      }
+
       /// Merge all the thread private objects. Can be called many times. It
       /// does create a new instance of class T to represent the "Sum" object.
       /// This method is not thread safe: correct or acceptable behaviours
@@ -317,8 +423,7 @@ namespace ROOT {
          }
          auto targetPtr = Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get());
          std::shared_ptr<T> targetPtrShared(targetPtr, [](T *) {});
-         // need to convert to std::vector because historically mergeFunction requires a vector
-         auto vecOfObjPtrs = std::vector<std::shared_ptr<T>>(fObjPointers.begin(), fObjPointers.end());
+         auto vecOfObjPtrs = GetObjects();
          mergeFunction(targetPtrShared, vecOfObjPtrs);
          return std::unique_ptr<T>(targetPtr);
       }
@@ -333,6 +438,31 @@ namespace ROOT {
       std::map<std::thread::id, unsigned> fThrIDSlotMap; ///< A mapping between the thread IDs and the slots
       mutable ROOT::TSpinMutex fSpinMutex;               ///< Protects concurrent access to fThrIDSlotMap, fObjPointers
       bool fIsMerged : 1;                                ///< Remember if the objects have been merged already
+      std::vector<unsigned> fGroupOffsets;               ///< First slot of each group sharing a copy, see SetSlotGroups()
+      std::vector<std::shared_ptr<T>> fGroupCopies;      ///< The copy shared by each group of slots
+      std::unique_ptr<std::mutex[]> fGroupMutexes;       ///< Protects the creation and the use of each shared copy
+
+      /// The group of slots that slot `i` belongs to, -1 if it has its own copy
+      int GetSlotGroup(unsigned i) const
+      {
+         if (fGroupOffsets.empty() || i >= fGroupOffsets.back())
+            return -1;
+         return std::upper_bound(fGroupOffsets.begin(), fGroupOffsets.end(), i) - fGroupOffsets.begin() - 1;
+      }
+
+      /// The objects of all slots, with the copies shared by groups of slots listed only once
+      std::vector<std::shared_ptr<T>> GetObjects() const
+      {
+         // need to convert to std::vector because historically mergeFunction requires a vector
+         if (fGroupOffsets.empty())
+            return std::vector<std::shared_ptr<T>>(fObjPointers.begin(), fObjPointers.end());
+         std::vector<std::shared_ptr<T>> objs;
+         for (auto &&obj : fObjPointers) {
+            if (!obj || std::find(objs.begin(), objs.end(), obj) == objs.end())
+               objs.emplace_back(obj);
+         }
+         return objs;
+      }
 
       /// Get the slot number for this threadID, make a slot if needed
       unsigned GetThisSlotNumber()
@@ -356,6 +486,72 @@ namespace ROOT {
    template<class T>
    constexpr const TNumSlots TThreadedObject<T>::fgMaxSlots;
 
+   /**
+    * \class ROOT::TThreadedObjectFiller
+    * \brief Buffers the calls to `Fill(ARGS...)` of each slot of a TThreadedObject.
+    * \tparam T Class of the object wrapped by the TThreadedObject (e.g. TH1F)
+    * \tparam ARGS Arguments' class types of T::Fill
+    * \ingroup Parallelism
+    *
+    * When groups of slots share a copy of the object (see TThreadedObject::SetSlotGroups()),
+    * locking the shared copy for every fill would serialize the slots of a group. The filler
+    * instead collects the arguments of each slot and fills the object with a whole buffer at
+    * once, under a single lock. The remaining fills are done by Flush() and by the destructor.
+    * Different slots can be filled concurrently.
+    * ~~~{.cpp}
+    * ROOT::TThreadedObject<TH1D> h(ROOT::TNumSlots{nSlots}, "h", "h", 100, 0, 1);
+    * h.SetSlotGroups(ROOT::Internal::RTaskArenaWrapper::GetNumaSlotOffsets());
+    * ROOT::TThreadedObjectFiller<TH1D, double> filler(h);
+    * // in the task processing slot `slot`
+    * filler.Fill(slot, x);
+    * ~~~
+    */
+   template <class T, class... ARGS>
+   class TThreadedObjectFiller {
+      TThreadedObject<T> &fObject;
+      std::size_t fBufferSize;
+      std::deque<std::vector<std::tuple<ARGS...>>> fBuffers; ///< One per slot
+
+   public:
+      TThreadedObjectFiller(TThreadedObject<T> &object, std::size_t bufferSize = 1024)
+         : fObject(object), fBufferSize(bufferSize), fBuffers(object.GetNSlots())
+      {
+      }
+      TThreadedObjectFiller(const TThreadedObjectFiller &) = delete;
+      TThreadedObjectFiller &operator=(const TThreadedObjectFiller &) = delete;
+      ~TThreadedObjectFiller() { Flush(); }
+
+      /// Buffer a fill of the object of slot `slot`, which must be one of the slots the TThreadedObject had when
+      /// the filler was constructed. Not thread-safe for concurrent calls with the same slot.
+      void Fill(unsigned slot, ARGS... args)
+      {
+         auto &buffer = fBuffers[slot];
+         buffer.emplace_back(std::move(args)...);
+         if (buffer.size() >= fBufferSize)
+            Flush(slot);
+      }
+
+      /// Fill the object of slot `slot` with the buffered arguments.
+      void Flush(unsigned slot)
+      {
+         auto &buffer = fBuffers[slot];
+         if (buffer.empty())
+            return;
+         fObject.ApplyAtSlot(slot, [&buffer](T &obj) {
+            for (auto &args : buffer)
+               std::apply([&obj](auto &&...a) { obj.Fill(a...); }, args);
+         });
+         buffer.clear();
+      }
+
+      /// Fill the objects of all slots with the buffered arguments. Must not run concurrently to Fill().
+      void Flush()
+      {
+         for (unsigned slot = 0; slot < fBuffers.size(); ++slot)
+            Flush(slot);
+      }
+   };
+
 } // End ROOT namespace
 
 ////////////////////////////////////////////////////////////////////////////////
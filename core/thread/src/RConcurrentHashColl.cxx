@@ -1,5 +1,5 @@
 #include <ROOT/RConcurrentHashColl.hxx>
-#include <ROOT/TRWSpinLock.hxx>
+#include <ROOT/TDistributedRWSpinLock.hxx>
 #include <ROOT/TSeq.hxx>
 #include <ROOT/RSha256.hxx>
 
@@ -39,13 +39,13 @@ struct RHashMap {
 };
 
 RConcurrentHashColl::RConcurrentHashColl()
-   : fHashMap(std::make_unique<RHashMap>()), fRWLock(std::make_unique<ROOT::TRWSpinLock>()){};
+   : fHashMap(std::make_unique<RHashMap>()), fRWLock(std::make_unique<ROOT::TDistributedRWSpinLock>()){};
 
 RConcurrentHashColl::~RConcurrentHashColl() = default;
 
 const RUidColl* RConcurrentHashColl::Find(const HashValue &hash) const
 {
-   ROOT::TRWSpinLockReadGuard rg(*fRWLock);
+   ROOT::TDistributedRWSpinLockReadGuard rg(*fRWLock);
    auto iter = fHashMap->fHashMap.find(hash);
    if (iter != fHashMap->fHashMap.end())
       return &(iter->second);
@@ -60,7 +60,7 @@ RConcurrentHashColl::HashValue RConcurrentHashColl::Hash(char *buffer, int len)
 
 bool RConcurrentHashColl::Insert(const HashValue &hash, RUidColl &&values) const
 {
-   ROOT::TRWSpinLockWriteGuard wg(*fRWLock);
+   ROOT::TDistributedRWSpinLockWriteGuard wg(*fRWLock);
    auto ret = fHashMap->fHashMap.insert({hash, std::move(values)});
    return ret.second;
 }
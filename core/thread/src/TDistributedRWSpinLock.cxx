@@ -0,0 +1,130 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TDistributedRWSpinLock
+    \brief A read-write lock for read-mostly data whose readers do not contend with each other.
+
+This class implements the algorithm of TRWSpinLock, but keeps the number of
+readers and of reader reservations in a ROOT::Internal::RDistributedCounter.
+Readers of different threads thus update different cache lines, and taking
+the read lock from many threads at once scales with the number of cores
+instead of serializing on a single atomic counter.
+
+The price is paid by the writers, which have to sum the counters of all
+slots while waiting for the readers to leave: use it where writes are rare,
+like look-ups in a collection that is filled once.
+*/
+
+#include "ROOT/TDistributedRWSpinLock.hxx"
+
+using namespace ROOT;
+
+////////////////////////////////////////////////////////////////////////////
+/// Acquire the lock in read mode.
+void TDistributedRWSpinLock::ReadLock()
+{
+   ++fReaderReservation;
+
+   if (!fWriter) {
+      // There is no writer, go freely to the critical section
+      ++fReaders;
+      --fReaderReservation;
+   } else {
+      // A writer claimed the RW lock, we will need to wait on the
+      // internal lock
+      --fReaderReservation;
+
+      std::unique_lock<ROOT::TSpinMutex> lock(fMutex);
+
+      // Wait for writers, if any
+      fCond.wait(lock, [this] { return !fWriter; });
+
+      // This RW lock now belongs to the readers
+      ++fReaders;
+
+      lock.unlock();
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Release the lock in read mode.
+void TDistributedRWSpinLock::ReadUnLock()
+{
+   --fReaders;
+   // Summing the reader counters is only needed if a writer waits
+   if (fWriterReservation && fReaders == 0) {
+      // We still need to lock here to prevent interleaving with a writer
+      std::lock_guard<ROOT::TSpinMutex> lock(fMutex);
+
+      // Make sure you wake up a writer, if any
+      // Note: spurrious wakeups are okay, fReaders
+      // will be checked again in WriteLock
+      fCond.notify_all();
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Acquire the lock in write mode.
+void TDistributedRWSpinLock::WriteLock()
+{
+   ++fWriterReservation;
+
+   std::unique_lock<ROOT::TSpinMutex> lock(fMutex);
+
+   // Wait for other writers, if any
+   fCond.wait(lock, [this] { return !fWriter; });
+
+   // Claim the lock for this writer
+   fWriter = true;
+
+   // Wait until all reader reservations finish
+   while (fReaderReservation) {
+   };
+
+   // Wait for remaining readers
+   fCond.wait(lock, [this] { return fReaders == 0; });
+
+   --fWriterReservation;
+
+   lock.unlock();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Release the lock in write mode.
+void TDistributedRWSpinLock::WriteUnLock()
+{
+   // We need to lock here to prevent interleaving with a reader
+   std::lock_guard<ROOT::TSpinMutex> lock(fMutex);
+
+   fWriter = false;
+
+   // Notify all potential readers/writers that are waiting
+   fCond.notify_all();
+}
+
+TDistributedRWSpinLockReadGuard::TDistributedRWSpinLockReadGuard(TDistributedRWSpinLock &lock) : fLock(lock)
+{
+   fLock.ReadLock();
+}
+
+TDistributedRWSpinLockReadGuard::~TDistributedRWSpinLockReadGuard()
+{
+   fLock.ReadUnLock();
+}
+
+TDistributedRWSpinLockWriteGuard::TDistributedRWSpinLockWriteGuard(TDistributedRWSpinLock &lock) : fLock(lock)
+{
+   fLock.WriteLock();
+}
+
+TDistributedRWSpinLockWriteGuard::~TDistributedRWSpinLockWriteGuard()
+{
+   fLock.WriteUnLock();
+}
@@ -20,33 +20,164 @@
 
 #include "TRWMutexImp.h"
 #include "ROOT/TSpinMutex.hxx"
+#include "TClassEdit.h"
 #include "TMutex.h"
+#include "TString.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifndef R__WIN32
+#include <dlfcn.h>
+#endif
+
+// The address the lock call returns to, i.e. a location in the function taking the lock
+#if defined(__GNUC__) || defined(__clang__)
+#define R__RWMUTEX_CALLER() __builtin_return_address(0)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define R__RWMUTEX_CALLER() _ReturnAddress()
+#else
+#define R__RWMUTEX_CALLER() nullptr
+#endif
+
+namespace {
+
+ULong64_t NanosecondsSince(std::chrono::steady_clock::time_point start)
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// The demangled name of the function containing `address`, or the address itself
+std::string GetCallSiteName(void *address)
+{
+#ifndef R__WIN32
+   Dl_info info;
+   if (dladdr(address, &info) && info.dli_sname) {
+      int err = 0;
+      char *demangled = TClassEdit::DemangleName(info.dli_sname, err);
+      std::string name = (err == 0 && demangled) ? demangled : info.dli_sname;
+      free(demangled);
+      return name;
+   }
+#endif
+   return TString::Format("%p", address).Data();
+}
+
+} // anonymous namespace
 
 namespace ROOT {
 
+////////////////////////////////////////////////////////////////////////////////
+/// Count an acquisition of the lock from `callSite` that waited `waitNs` nanoseconds.
+
+void Internal::RRWMutexContention::Record(void *callSite, bool isWrite, ULong64_t waitNs)
+{
+   (isWrite ? fNWrites : fNReads).fetch_add(1, std::memory_order_relaxed);
+   (isWrite ? fWriteWaitNs : fReadWaitNs).fetch_add(waitNs, std::memory_order_relaxed);
+   if (waitNs > kContendedNs)
+      fNContended.fetch_add(1, std::memory_order_relaxed);
+   ULong64_t maxWait = fMaxWaitNs.load(std::memory_order_relaxed);
+   while (waitNs > maxWait && !fMaxWaitNs.compare_exchange_weak(maxWait, waitNs, std::memory_order_relaxed)) {
+   }
+
+   // Open addressing with a short linear probe; the top bits of a multiplicative hash pick the first slot
+   static_assert(kNCallSites == 1024, "the hash below produces 10 bits");
+   auto first = static_cast<unsigned int>((reinterpret_cast<std::uintptr_t>(callSite) * 0x9E3779B97F4A7C15ull) >> 54);
+   for (unsigned int probe = 0; probe < 16; ++probe) {
+      RCallSite &site = fCallSites[(first + probe) % kNCallSites];
+      void *address = site.fAddress.load(std::memory_order_relaxed);
+      if (address == nullptr && site.fAddress.compare_exchange_strong(address, callSite))
+         address = callSite;
+      if (address == callSite) {
+         site.fNAcquired.fetch_add(1, std::memory_order_relaxed);
+         site.fWaitNs.fetch_add(waitNs, std::memory_order_relaxed);
+         return;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget all recorded acquisitions and call sites.
+
+void Internal::RRWMutexContention::Reset()
+{
+   fNReads = 0;
+   fNWrites = 0;
+   fNContended = 0;
+   fReadWaitNs = 0;
+   fWriteWaitNs = 0;
+   fMaxWaitNs = 0;
+   for (auto &site : fCallSites) {
+      site.fAddress = nullptr;
+      site.fNAcquired = 0;
+      site.fWaitNs = 0;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the totals and the ten call sites that waited the longest in total.
+
+void Internal::RRWMutexContention::Print() const
+{
+   std::vector<const RCallSite *> sites;
+   for (const auto &site : fCallSites) {
+      if (site.fAddress.load() && site.fNAcquired.load())
+         sites.push_back(&site);
+   }
+   std::sort(sites.begin(), sites.end(),
+             [](const RCallSite *a, const RCallSite *b) { return a->fWaitNs.load() > b->fWaitNs.load(); });
+
+   Printf("Lock contention: %llu read and %llu write acquisitions, %llu waited more than %llu ns",
+          fNReads.load(), fNWrites.load(), fNContended.load(), kContendedNs);
+   Printf("   waited %.3f s for read locks and %.3f s for write locks, longest wait %.3f ms",
+          1e-9 * fReadWaitNs.load(), 1e-9 * fWriteWaitNs.load(), 1e-6 * fMaxWaitNs.load());
+   if (sites.empty())
+      return;
+   Printf("   call sites with the longest total wait:");
+   for (std::size_t i = 0; i < std::min<std::size_t>(sites.size(), 10); ++i) {
+      Printf("   %12.3f ms %12llu calls  %s", 1e-6 * sites[i]->fWaitNs.load(), sites[i]->fNAcquired.load(),
+             GetCallSiteName(sites[i]->fAddress.load()).c_str());
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Take the Read Lock of the mutex.
 
-template <typename MutexT, typename RecurseCountsT>
-TVirtualRWMutex::Hint_t *TRWMutexImp<MutexT, RecurseCountsT>::ReadLock()
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+TVirtualRWMutex::Hint_t *TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::ReadLock()
 {
-   return fMutexImp.ReadLock();
+   if (R__likely(!fStatsEnabled.load(std::memory_order_acquire)))
+      return fMutexImp.ReadLock();
+   auto start = std::chrono::steady_clock::now();
+   auto hint = fMutexImp.ReadLock();
+   fStats->Record(R__RWMUTEX_CALLER(), false, NanosecondsSince(start));
+   return hint;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Take the Write Lock of the mutex.
 
-template <typename MutexT, typename RecurseCountsT>
-TVirtualRWMutex::Hint_t *TRWMutexImp<MutexT, RecurseCountsT>::WriteLock()
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+TVirtualRWMutex::Hint_t *TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::WriteLock()
 {
-   return fMutexImp.WriteLock();
+   if (R__likely(!fStatsEnabled.load(std::memory_order_acquire)))
+      return fMutexImp.WriteLock();
+   auto start = std::chrono::steady_clock::now();
+   auto hint = fMutexImp.WriteLock();
+   fStats->Record(R__RWMUTEX_CALLER(), true, NanosecondsSince(start));
+   return hint;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Release the read lock of the mutex
 
-template <typename MutexT, typename RecurseCountsT>
-void TRWMutexImp<MutexT, RecurseCountsT>::ReadUnLock(TVirtualRWMutex::Hint_t *hint)
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::ReadUnLock(TVirtualRWMutex::Hint_t *hint)
 {
    fMutexImp.ReadUnLock(hint);
 }
@@ -54,8 +185,8 @@ void TRWMutexImp<MutexT, RecurseCountsT>::ReadUnLock(TVirtualRWMutex::Hint_t *hi
 ////////////////////////////////////////////////////////////////////////////////
 /// Release the read lock of the mutex
 
-template <typename MutexT, typename RecurseCountsT>
-void TRWMutexImp<MutexT, RecurseCountsT>::WriteUnLock(TVirtualRWMutex::Hint_t *hint)
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::WriteUnLock(TVirtualRWMutex::Hint_t *hint)
 {
    fMutexImp.WriteUnLock(hint);
 }
@@ -63,8 +194,8 @@ void TRWMutexImp<MutexT, RecurseCountsT>::WriteUnLock(TVirtualRWMutex::Hint_t *h
 ////////////////////////////////////////////////////////////////////////////////
 /// Create mutex and return pointer to it.
 
-template <typename MutexT, typename RecurseCountsT>
-TVirtualRWMutex *TRWMutexImp<MutexT, RecurseCountsT>::Factory(Bool_t /*recursive = kFALSE*/)
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+TVirtualRWMutex *TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::Factory(Bool_t /*recursive = kFALSE*/)
 {
    return new TRWMutexImp();
 }
@@ -79,9 +210,9 @@ TVirtualRWMutex *TRWMutexImp<MutexT, RecurseCountsT>::Factory(Bool_t /*recursive
 ///     current_lock_count -= delta;
 ///     return delta;
 
-template <typename MutexT, typename RecurseCountsT>
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
 std::unique_ptr<TVirtualRWMutex::StateDelta>
-TRWMutexImp<MutexT, RecurseCountsT>::Rewind(const TVirtualRWMutex::State &earlierState)
+TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::Rewind(const TVirtualRWMutex::State &earlierState)
 {
    return fMutexImp.Rewind(earlierState);
 }
@@ -91,8 +222,8 @@ TRWMutexImp<MutexT, RecurseCountsT>::Rewind(const TVirtualRWMutex::State &earlie
 /// In pseudo-code:
 ///     current_lock_count += delta;
 
-template <typename MutexT, typename RecurseCountsT>
-void TRWMutexImp<MutexT, RecurseCountsT>::Apply(std::unique_ptr<TVirtualRWMutex::StateDelta> &&delta)
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::Apply(std::unique_ptr<TVirtualRWMutex::StateDelta> &&delta)
 {
    fMutexImp.Apply(std::move(delta));
 }
@@ -101,13 +232,44 @@ void TRWMutexImp<MutexT, RecurseCountsT>::Apply(std::unique_ptr<TVirtualRWMutex:
 /// Get the mutex state *before* the current lock was taken. This function must
 /// only be called while the mutex is locked.
 
-template <typename MutexT, typename RecurseCountsT>
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
 std::unique_ptr<TVirtualRWMutex::State>
-TRWMutexImp<MutexT, RecurseCountsT>::GetStateBefore()
+TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::GetStateBefore()
 {
    return fMutexImp.GetStateBefore();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Start, after resetting them, or stop recording the contention statistics.
+/// Recording costs two clock reads and a few atomic increments per lock call.
+
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::EnableContentionStats(Bool_t enable)
+{
+   if (!enable) {
+      fStatsEnabled = false;
+      return;
+   }
+   if (!fStats)
+      fStats = std::make_unique<Internal::RRWMutexContention>();
+   else
+      fStats->Reset();
+   fStatsEnabled.store(true, std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the statistics recorded since the last call to EnableContentionStats().
+
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TRWMutexImp<MutexT, RecurseCountsT, ReadersCountT>::PrintContentionStats() const
+{
+   if (!fStats) {
+      Printf("Lock contention statistics are not enabled, see EnableContentionStats()");
+      return;
+   }
+   fStats->Print();
+}
+
 template class TRWMutexImp<TMutex>;
 template class TRWMutexImp<ROOT::TSpinMutex>;
 template class TRWMutexImp<std::mutex>;
@@ -117,6 +279,8 @@ template class TRWMutexImp<ROOT::TSpinMutex, ROOT::Internal::UniqueLockRecurseCo
 #ifdef R__HAS_TBB
 template class TRWMutexImp<std::mutex, ROOT::Internal::RecurseCountsTBB>;
 template class TRWMutexImp<std::mutex, ROOT::Internal::RecurseCountsTBBUnique>;
+template class TRWMutexImp<std::mutex, ROOT::Internal::RecurseCountsTBBUnique, ROOT::Internal::RDistributedCounter>;
 #endif
+template class TRWMutexImp<std::mutex, ROOT::Internal::RecurseCounts, ROOT::Internal::RDistributedCounter>;
 
 } // End of namespace ROOT
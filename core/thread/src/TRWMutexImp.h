@@ -17,10 +17,53 @@
 
 #include "TBuffer.h" // Needed by ClassDefInlineOverride
 
+#include <atomic>
+#include <memory>
+
 namespace ROOT {
-template <typename MutexT, typename RecurseCountsT = ROOT::Internal::RecurseCounts>
+namespace Internal {
+
+/// Number of acquisitions of a TVirtualRWMutex and time spent waiting for it, in total and per call site.
+/// The call site is the return address of the lock call, i.e. the function that took the lock.
+class RRWMutexContention {
+public:
+   struct RCallSite {
+      std::atomic<void *> fAddress{nullptr};
+      std::atomic<ULong64_t> fNAcquired{0};
+      std::atomic<ULong64_t> fWaitNs{0};
+   };
+   /// Size of the call site table; call sites beyond it are only counted in the totals
+   static constexpr unsigned int kNCallSites = 1024;
+   /// Acquisitions that waited longer than this are counted as contended
+   static constexpr ULong64_t kContendedNs = 1000;
+
+private:
+   std::atomic<ULong64_t> fNReads{0};
+   std::atomic<ULong64_t> fNWrites{0};
+   std::atomic<ULong64_t> fNContended{0};
+   std::atomic<ULong64_t> fReadWaitNs{0};
+   std::atomic<ULong64_t> fWriteWaitNs{0};
+   std::atomic<ULong64_t> fMaxWaitNs{0};
+   RCallSite fCallSites[kNCallSites];
+
+public:
+   void Record(void *callSite, bool isWrite, ULong64_t waitNs);
+   void Reset();
+   void Print() const;
+
+   ULong64_t GetNReads() const { return fNReads; }
+   ULong64_t GetNWrites() const { return fNWrites; }
+};
+
+} // namespace Internal
+
+template <typename MutexT, typename RecurseCountsT = ROOT::Internal::RecurseCounts,
+          typename ReadersCountT = std::atomic<int>>
 class TRWMutexImp : public TVirtualRWMutex {
-   ROOT::TReentrantRWLock<MutexT, RecurseCountsT> fMutexImp;
+   ROOT::TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT> fMutexImp;
+   std::atomic<bool> fStatsEnabled{false};
+   /// Allocated by the first EnableContentionStats() and kept, threads may still be recording after disabling
+   std::unique_ptr<Internal::RRWMutexContention> fStats;
 
 public:
    Hint_t * ReadLock() override;
@@ -32,6 +75,9 @@ public:
    std::unique_ptr<State> GetStateBefore() override;
    std::unique_ptr<StateDelta> Rewind(const State &earlierState) override;
    void Apply(std::unique_ptr<StateDelta> &&delta) override;
+   void EnableContentionStats(Bool_t enable = kTRUE) override;
+   void PrintContentionStats() const override;
+   const Internal::RRWMutexContention *GetContentionStats() const { return fStats.get(); }
 
    ClassDefInlineOverride(TRWMutexImp,0)  // Concrete RW mutex lock class
 };
@@ -66,8 +66,8 @@ Internal::UniqueLockRecurseCount::UniqueLockRecurseCount()
 
 ////////////////////////////////////////////////////////////////////////////
 /// Acquire the lock in read mode.
-template <typename MutexT, typename RecurseCountsT>
-TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::ReadLock()
 {
    ++fReaderReservation;
 
@@ -133,8 +133,8 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
 
 //////////////////////////////////////////////////////////////////////////
 /// Release the lock in read mode.
-template <typename MutexT, typename RecurseCountsT>
-void TReentrantRWLock<MutexT, RecurseCountsT>::ReadUnLock(TVirtualRWMutex::Hint_t *hint)
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::ReadUnLock(TVirtualRWMutex::Hint_t *hint)
 {
    size_t *localReaderCount;
    if (!hint) {
@@ -165,8 +165,8 @@ void TReentrantRWLock<MutexT, RecurseCountsT>::ReadUnLock(TVirtualRWMutex::Hint_
 
 //////////////////////////////////////////////////////////////////////////
 /// Acquire the lock in write mode.
-template <typename MutexT, typename RecurseCountsT>
-TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::WriteLock()
 {
    ++fWriterReservation;
 
@@ -213,8 +213,8 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
 
 //////////////////////////////////////////////////////////////////////////
 /// Release the lock in write mode.
-template <typename MutexT, typename RecurseCountsT>
-void TReentrantRWLock<MutexT, RecurseCountsT>::WriteUnLock(TVirtualRWMutex::Hint_t *)
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::WriteUnLock(TVirtualRWMutex::Hint_t *)
 {
    // We need to lock here to prevent interleaving with a reader
    std::lock_guard<MutexT> lock(fMutex);
@@ -255,9 +255,9 @@ struct TReentrantRWLockStateDelta: public TVirtualRWMutex::StateDelta {
 //////////////////////////////////////////////////////////////////////////
 /// Get the lock state before the most recent write lock was taken.
 
-template <typename MutexT, typename RecurseCountsT>
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
 std::unique_ptr<TVirtualRWMutex::State>
-TReentrantRWLock<MutexT, RecurseCountsT>::GetStateBefore()
+TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::GetStateBefore()
 {
    using State_t = TReentrantRWLockState<MutexT, RecurseCountsT>;
 
@@ -295,9 +295,9 @@ TReentrantRWLock<MutexT, RecurseCountsT>::GetStateBefore()
 //////////////////////////////////////////////////////////////////////////
 /// Rewind to an earlier mutex state, returning the delta.
 
-template <typename MutexT, typename RecurseCountsT>
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
 std::unique_ptr<TVirtualRWMutex::StateDelta>
-TReentrantRWLock<MutexT, RecurseCountsT>::Rewind(const State &earlierState) {
+TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::Rewind(const State &earlierState) {
    using State_t = TReentrantRWLockState<MutexT, RecurseCountsT>;
    using StateDelta_t = TReentrantRWLockStateDelta<MutexT, RecurseCountsT>;
    auto& typedState = static_cast<const State_t&>(earlierState);
@@ -354,8 +354,8 @@ TReentrantRWLock<MutexT, RecurseCountsT>::Rewind(const State &earlierState) {
 //////////////////////////////////////////////////////////////////////////
 /// Re-apply a delta.
 
-template <typename MutexT, typename RecurseCountsT>
-void TReentrantRWLock<MutexT, RecurseCountsT>::Apply(std::unique_ptr<StateDelta> &&state) {
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::Apply(std::unique_ptr<StateDelta> &&state) {
    if (!state) {
       Error("TReentrantRWLock::Apply", "Cannot apply empty delta!");
       return;
@@ -390,8 +390,8 @@ void TReentrantRWLock<MutexT, RecurseCountsT>::Apply(std::unique_ptr<StateDelta>
 /// Assert that presumedLocalReadersCount really matches the local read count.
 /// Print an error message if not.
 
-template <typename MutexT, typename RecurseCountsT>
-void TReentrantRWLock<MutexT, RecurseCountsT>::AssertReadCountLocIsFromCurrentThread(const size_t* presumedLocalReadersCount)
+template <typename MutexT, typename RecurseCountsT, typename ReadersCountT>
+void TReentrantRWLock<MutexT, RecurseCountsT, ReadersCountT>::AssertReadCountLocIsFromCurrentThread(const size_t* presumedLocalReadersCount)
 {
    auto local = fRecurseCounts.GetLocal();
    size_t* localReadersCount;
@@ -417,5 +417,8 @@ template class TReentrantRWLock<std::mutex, ROOT::Internal::UniqueLockRecurseCou
 #ifdef R__HAS_TBB
 template class TReentrantRWLock<std::mutex, ROOT::Internal::RecurseCountsTBB>;
 template class TReentrantRWLock<std::mutex, ROOT::Internal::RecurseCountsTBBUnique>;
+template class TReentrantRWLock<std::mutex, ROOT::Internal::RecurseCountsTBBUnique,
+                                ROOT::Internal::RDistributedCounter>;
 #endif
+template class TReentrantRWLock<std::mutex, ROOT::Internal::RecurseCounts, ROOT::Internal::RDistributedCounter>;
 }
@@ -14,6 +14,7 @@
 #define ROOT_TReentrantRWLock
 
 #include "ThreadLocalStorage.h"
+#include "ROOT/RDistributedCounter.hxx"
 #include "ROOT/TSpinMutex.hxx"
 #include "TVirtualRWMutex.h"
 
@@ -275,12 +276,15 @@ struct RecurseCountsTBBUnique {
 
 } // Internal
 
-template <typename MutexT = ROOT::TSpinMutex, typename RecurseCountsT = Internal::RecurseCounts>
+/// `ReadersCountT` is the type of the reader counters, updated by every read lock and unlock; with
+/// Internal::RDistributedCounter readers of different threads do not contend on them.
+template <typename MutexT = ROOT::TSpinMutex, typename RecurseCountsT = Internal::RecurseCounts,
+          typename ReadersCountT = std::atomic<int>>
 class TReentrantRWLock {
 private:
 
-   std::atomic<int> fReaders;           ///<! Number of readers
-   std::atomic<int> fReaderReservation; ///<! A reader wants access
+   ReadersCountT fReaders;              ///<! Number of readers
+   ReadersCountT fReaderReservation;    ///<! A reader wants access
    std::atomic<int> fWriterReservation; ///<! A writer wants access
    std::atomic<bool> fWriter;           ///<! Is there a writer?
    MutexT fMutex;                       ///<! RWlock internal mutex
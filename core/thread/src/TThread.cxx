@@ -347,15 +347,29 @@ void TThread::Init()
      if (!ROOT::gCoreMutex) {
         // To avoid dead locks, caused by shared library opening and/or static initialization
         // taking the same lock as 'tls_get_addr_tail', we can not use UniqueLockRecurseCount.
+        // gCoreMutex is read locked much more often than write locked, spread its reader
+        // counters over several cache lines so that readers do not contend.
 #ifdef R__HAS_TBB
-        ROOT::gCoreMutex = new ROOT::TRWMutexImp<std::mutex, ROOT::Internal::RecurseCountsTBBUnique>();
+        ROOT::gCoreMutex = new ROOT::TRWMutexImp<std::mutex, ROOT::Internal::RecurseCountsTBBUnique,
+                                                 ROOT::Internal::RDistributedCounter>();
 #else
-        ROOT::gCoreMutex = new ROOT::TRWMutexImp<std::mutex, ROOT::Internal::RecurseCounts>();
+        ROOT::gCoreMutex =
+           new ROOT::TRWMutexImp<std::mutex, ROOT::Internal::RecurseCounts, ROOT::Internal::RDistributedCounter>();
 #endif
      }
      gInterpreterMutex = ROOT::gCoreMutex;
      gROOTMutex = gInterpreterMutex;
    }
+
+   // Contention statistics of gCoreMutex, printed at exit
+   const char *stats = gSystem->Getenv("ROOT_CORE_MUTEX_STATS");
+   if (stats && strcmp(stats, "0")) {
+      ROOT::gCoreMutex->EnableContentionStats();
+      atexit([]() {
+         if (ROOT::gCoreMutex)
+            ROOT::gCoreMutex->PrintContentionStats();
+      });
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3,6 +3,7 @@
 #include "TMutex.h"
 #include "TVirtualRWMutex.h"
 #include "ROOT/TRWSpinLock.hxx"
+#include "ROOT/TDistributedRWSpinLock.hxx"
 
 #include "../src/TRWMutexImp.h"
 #include "../src/TReentrantRWLock.hxx"
@@ -250,6 +251,8 @@ auto gMutex = new TMutex(kTRUE);
 auto gRWMutex = new TRWMutexImp<TMutex>();
 auto gRWMutexSpin = new TRWMutexImp<ROOT::TSpinMutex>();
 auto gRWMutexStd = new TRWMutexImp<std::mutex>();
+auto gRWMutexStdDist =
+   new TRWMutexImp<std::mutex, ROOT::Internal::RecurseCounts, ROOT::Internal::RDistributedCounter>();
 #ifdef R__HAS_TBB
 auto gRWMutexStdTBB = new TRWMutexImp<std::mutex, ROOT::Internal::RecurseCountsTBB>();
 auto gRWMutexStdTBBUnique = new TRWMutexImp<std::mutex, ROOT::Internal::RecurseCountsTBBUnique>();
@@ -257,6 +260,8 @@ auto gRWMutexStdTBBUnique = new TRWMutexImp<std::mutex, ROOT::Internal::RecurseC
 auto gReentrantRWMutex = new ROOT::TReentrantRWLock<TMutex>();
 auto gReentrantRWMutexSM = new ROOT::TReentrantRWLock<ROOT::TSpinMutex>();
 auto gReentrantRWMutexStd = new ROOT::TReentrantRWLock<std::mutex>();
+auto gReentrantRWMutexStdDist =
+   new ROOT::TReentrantRWLock<std::mutex, ROOT::Internal::RecurseCounts, ROOT::Internal::RDistributedCounter>();
 #ifdef R__HAS_TBB
 auto gReentrantRWMutexStdTBB = new ROOT::TReentrantRWLock<std::mutex, ROOT::Internal::RecurseCountsTBB>();
 auto gReentrantRWMutexStdTBBUnique = new ROOT::TReentrantRWLock<std::mutex, ROOT::Internal::RecurseCountsTBBUnique>();
@@ -742,3 +747,107 @@ TEST(RWLock, VeryLargeconcurrentReadsTL)
 {
    concurrentReadsAndWrites(gRWMutexTL, 0, 200, gRepetition / 10000);
 }
+
+TEST(RWLock, ReentrantStdDist)
+{
+   Reentrant(*gReentrantRWMutexStdDist);
+}
+
+TEST(RWLock, ResetRestoreStdDist)
+{
+   ResetRestore(*gReentrantRWMutexStdDist);
+}
+
+TEST(RWLock, concurrentResetRestoreStdDist)
+{
+   concurrentResetRestore(gRWMutexStdDist, 20, gRepetition / 40000);
+}
+
+TEST(RWLock, VeryLargeconcurrentReadsAndWritesStdDist)
+{
+   concurrentReadsAndWrites(gRWMutexStdDist, 10, 200, gRepetition / 10000);
+}
+
+TEST(RWLock, VeryLargeconcurrentReadsStdDist)
+{
+   concurrentReadsAndWrites(gRWMutexStdDist, 0, 200, gRepetition / 10000);
+}
+
+TEST(RWLock, DistributedCounter)
+{
+   ROOT::Internal::RDistributedCounter counter(3);
+   EXPECT_EQ(3, counter);
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < 8; ++i) {
+      threads.emplace_back([&counter]() {
+         for (int j = 0; j < 1000; ++j) {
+            ++counter;
+            counter += 2;
+            counter -= 2;
+         }
+      });
+   }
+   for (auto &&th : threads)
+      th.join();
+   EXPECT_EQ(8003, counter);
+
+   counter = 0;
+   EXPECT_EQ(0, counter.Load());
+}
+
+TEST(RWLock, DistributedSpinLock)
+{
+   ROOT::TDistributedRWSpinLock lock;
+   std::atomic<bool> writerInside{false};
+   std::atomic<int> nBadReads{0};
+   int value = 0;
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < 2; ++i) {
+      threads.emplace_back([&]() {
+         for (int j = 0; j < 1000; ++j) {
+            ROOT::TDistributedRWSpinLockWriteGuard wg(lock);
+            writerInside = true;
+            ++value;
+            writerInside = false;
+         }
+      });
+   }
+   for (int i = 0; i < 8; ++i) {
+      threads.emplace_back([&]() {
+         for (int j = 0; j < 10000; ++j) {
+            ROOT::TDistributedRWSpinLockReadGuard rg(lock);
+            if (writerInside)
+               ++nBadReads;
+         }
+      });
+   }
+   for (auto &&th : threads)
+      th.join();
+
+   EXPECT_EQ(2000, value);
+   EXPECT_EQ(0, nBadReads);
+}
+
+TEST(RWLock, ContentionStats)
+{
+   TRWMutexImp<std::mutex> m;
+   EXPECT_EQ(nullptr, m.GetContentionStats());
+
+   m.EnableContentionStats();
+   concurrentReadsAndWrites(&m, 2, 4, 10);
+   auto stats = m.GetContentionStats();
+   ASSERT_NE(nullptr, stats);
+   EXPECT_EQ(20u, stats->GetNWrites());
+   EXPECT_EQ(40u, stats->GetNReads());
+
+   // Nothing is recorded while disabled, re-enabling starts from zero
+   m.EnableContentionStats(kFALSE);
+   testReadGuard(&m, 10);
+   EXPECT_EQ(40u, stats->GetNReads());
+   m.EnableContentionStats();
+   EXPECT_EQ(0u, stats->GetNReads());
+   testReadGuard(&m, 10);
+   EXPECT_EQ(10u, stats->GetNReads());
+}
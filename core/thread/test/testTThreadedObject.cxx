@@ -180,3 +180,52 @@ TEST(TThreadedObject, GetNSlots)
 
    EXPECT_EQ(tto.GetNSlots(), 4u);
 }
+
+TEST(TThreadedObject, MergeParallel)
+{
+   TH1::AddDirectory(false);
+
+   const unsigned nSlots = 7;
+   TH1F expected("h", "h", 64, -4, 4);
+   ROOT::TThreadedObject<TH1F> tto(ROOT::TNumSlots{nSlots}, "h", "h", 64, -4, 4);
+   gRandom->SetSeed(1);
+   for (unsigned i = 0; i < nSlots; ++i) {
+      TH1F h("h", "h", 64, -4, 4);
+      h.FillRandom("gaus", 100 * (i + 1));
+      expected.Add(&h);
+      tto.GetAtSlot(i)->Add(&h);
+   }
+   auto hsum = tto.MergeParallel();
+   EXPECT_EQ(hsum, tto.GetAtSlot(0));
+   IsHistEqual(*hsum, expected);
+}
+
+TEST(TThreadedObject, SlotGroups)
+{
+   TH1::AddDirectory(false);
+
+   ROOT::TThreadedObject<TH1F> tto(ROOT::TNumSlots{4}, "h", "h", 64, -4, 4);
+   tto.SetSlotGroups({0, 2, 4});
+   EXPECT_EQ(tto.GetAtSlot(0), tto.GetAtSlot(1));
+   EXPECT_EQ(tto.GetAtSlot(2), tto.GetAtSlot(3));
+   EXPECT_NE(tto.GetAtSlot(0), tto.GetAtSlot(2));
+
+   {
+      ROOT::TThreadedObjectFiller<TH1F, double> filler(tto, 16);
+      std::vector<std::thread> threads;
+      for (unsigned slot = 0; slot < 4; ++slot) {
+         threads.emplace_back([&filler, slot] {
+            for (int i = 0; i < 1000; ++i)
+               filler.Fill(slot, 0.5);
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+   }
+   EXPECT_EQ(2000, tto.GetAtSlot(0)->GetEntries());
+   EXPECT_EQ(2000, tto.GetAtSlot(2)->GetEntries());
+
+   // The shared copies are merged once each
+   auto hsum = tto.Merge();
+   EXPECT_EQ(4000, hsum->GetEntries());
+}
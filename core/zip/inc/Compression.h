@@ -16,6 +16,7 @@
 #include "ROOT/RConfig.hxx"
 
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -109,6 +110,27 @@ struct RCompressionSetting {
    static std::string AlgorithmToString(EAlgorithm::EValues algorithm);
 };
 
+/// Chooses the compression settings for a stream of similar buffers, e.g. the baskets of one branch, by compressing
+/// a sample buffer with each candidate setting and timing its decompression.
+struct RCompressionAutoSelection {
+   enum class EObjective {
+      /// Smallest output among the candidates that decompress at least at fConstraint MB/s
+      kMinimizeSize,
+      /// Fastest decompression among the candidates whose output is at most fConstraint times the smallest output
+      kMinimizeDecompressionTime
+   };
+
+   EObjective fObjective = EObjective::kMinimizeSize;
+   /// Decompression speed budget in MB/s, or size budget relative to the smallest output, depending on fObjective
+   double fConstraint = 0.;
+   /// Compression settings (algorithm * 100 + level) to choose from
+   std::vector<int> fCandidates{101, 106, 207, 404, 505, 509};
+
+   /// Return the candidate best matching the objective for buffers like `sample`, 0 (no compression) if no candidate
+   /// reduces its size, or -1 if there are no candidates or the sample is too small to judge.
+   int Select(const char *sample, int sampleSize) const;
+};
+
 // clang-format off
 enum R__DEPRECATED(6, 34, "Use RCompressionSetting::EAlgorithm instead") ECompressionAlgorithm {
    kUseGlobalCompressionSetting = static_cast<int>(RCompressionSetting::EAlgorithm::kUseGlobal),
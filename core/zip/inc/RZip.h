@@ -35,6 +35,21 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * A single-shot decompressor for the zlib streams of ZLIB-compressed ("ZL") buffers, e.g. libdeflate or a hardware
+ * offload engine. It decompresses `srcsize` bytes of zlib stream at `src` into at most `tgtsize` bytes at `tgt` and
+ * returns the number of bytes written, or -1 if it cannot handle the buffer; R__unzip then falls back to zlib.
+ * It may be called concurrently from several threads.
+ */
+typedef int (*R__ZLIBDecompressor_t)(const unsigned char *src, int srcsize, unsigned char *tgt, int tgtsize);
+
+/**
+ * Install the decompressor used by R__unzip for ZLIB-compressed buffers; `nullptr` selects zlib. Returns the
+ * previously installed one. The default is libdeflate if ROOT was built with it, zlib otherwise.
+ * Only decompression is affected: the compressed output, and therefore the files written, stay the same.
+ */
+extern "C" R__ZLIBDecompressor_t R__SetZLIBDecompressor(R__ZLIBDecompressor_t decompressor);
+
 enum { kMAXZIPBUF = 0xffffff }; // 16 MB
 
 #endif
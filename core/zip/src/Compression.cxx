@@ -10,6 +10,11 @@
  *************************************************************************/
 
 #include "Compression.h"
+#include "RZip.h"
+
+#include <chrono>
+#include <limits>
+#include <memory>
 
 namespace ROOT {
 
@@ -48,4 +53,78 @@ namespace ROOT {
      default: return "Undefined compression algorithm";
      }
   }
+
+  int RCompressionAutoSelection::Select(const char *sample, int sampleSize) const
+  {
+     // Smaller samples are not compressed at all by R__zipMultipleAlgorithm and would not tell the candidates apart.
+     if (fCandidates.empty() || sampleSize < 256 || sampleSize > kMAXZIPBUF)
+        return -1;
+
+     // Worst-case expansion of the supported algorithms is well below 10% plus the ROOT block header.
+     const int zippedCapacity = sampleSize + sampleSize / 10 + 64;
+     std::unique_ptr<char[]> zipped(new char[zippedCapacity]);
+     std::unique_ptr<unsigned char[]> unzipped(new unsigned char[sampleSize]);
+     std::vector<int> sizes(fCandidates.size(), 0);
+     std::vector<double> speeds(fCandidates.size(), 0.); // MB/s
+
+     int minSize = sampleSize;
+     for (int i = 0, n = static_cast<int>(fCandidates.size()); i < n; ++i) {
+        int srcsize = sampleSize;
+        int tgtsize = zippedCapacity;
+        int nzip = 0;
+        R__zipMultipleAlgorithm(fCandidates[i] % 100, &srcsize, const_cast<char *>(sample), &tgtsize, zipped.get(),
+                                &nzip, static_cast<RCompressionSetting::EAlgorithm::EValues>(fCandidates[i] / 100));
+        if (nzip <= 0 || nzip >= sampleSize)
+           continue;
+        sizes[i] = nzip;
+        if (nzip < minSize)
+           minSize = nzip;
+
+        // Repeat the decompression until the timing is meaningful against the clock resolution.
+        using Clock_t = std::chrono::steady_clock;
+        const auto start = Clock_t::now();
+        std::chrono::duration<double> elapsed{0.};
+        int nReps = 0;
+        do {
+           int unzipSrcsize = nzip;
+           int unzipTgtsize = sampleSize;
+           int nout = 0;
+           R__unzip(&unzipSrcsize, reinterpret_cast<unsigned char *>(zipped.get()), &unzipTgtsize, unzipped.get(),
+                    &nout);
+           if (nout != sampleSize) {
+              sizes[i] = 0;
+              break;
+           }
+           ++nReps;
+           elapsed = Clock_t::now() - start;
+        } while (elapsed.count() < 1e-3 && nReps < 100);
+        speeds[i] = elapsed.count() > 0. ? 1e-6 * sampleSize * nReps / elapsed.count()
+                                         : std::numeric_limits<double>::max();
+     }
+
+     int best = -1;
+     for (int i = 0, n = static_cast<int>(fCandidates.size()); i < n; ++i) {
+        if (sizes[i] == 0)
+           continue;
+        if (fObjective == EObjective::kMinimizeSize) {
+           if (speeds[i] < fConstraint)
+              continue;
+           if (best < 0 || sizes[i] < sizes[best])
+              best = i;
+        } else {
+           if (fConstraint > 0. && sizes[i] > fConstraint * minSize)
+              continue;
+           if (best < 0 || speeds[i] > speeds[best])
+              best = i;
+        }
+     }
+     if (best < 0) {
+        // No candidate satisfies the constraint: fall back to the fastest, or store uncompressed if none compressed.
+        for (int i = 0, n = static_cast<int>(fCandidates.size()); i < n; ++i) {
+           if (sizes[i] != 0 && (best < 0 || speeds[i] > speeds[best]))
+              best = i;
+        }
+     }
+     return best < 0 ? 0 : fCandidates[best];
+  }
 }
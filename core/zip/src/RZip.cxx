@@ -15,9 +15,103 @@
 #include "ZipZSTD.h"
 
 #include "zlib.h"
+#ifdef R__HAS_LIBDEFLATE
+#include <libdeflate.h>
+#endif
 
+#include <atomic>
 #include <cstdio>
 #include <cassert>
+#include <memory>
+
+namespace {
+
+/// A zlib stream kept per thread and reset between buffers: deflateInit and inflateInit allocate the window and the
+/// hash tables anew on every call, which costs as much as processing a small buffer.
+struct RZlibStreams {
+   z_stream fDeflate;
+   z_stream fInflate;
+   int fDeflateLevel = 0; ///< Level fDeflate was initialized with; 0 if not initialized
+   bool fHasInflate = false;
+
+   ~RZlibStreams()
+   {
+      if (fDeflateLevel)
+         deflateEnd(&fDeflate);
+      if (fHasInflate)
+         inflateEnd(&fInflate);
+   }
+
+   z_stream *GetDeflate(int cxlevel)
+   {
+      if (fDeflateLevel == cxlevel) {
+         if (deflateReset(&fDeflate) == Z_OK)
+            return &fDeflate;
+      }
+      if (fDeflateLevel)
+         deflateEnd(&fDeflate);
+      fDeflateLevel = 0;
+      fDeflate.zalloc = (alloc_func)0;
+      fDeflate.zfree = (free_func)0;
+      fDeflate.opaque = (voidpf)0;
+      int err = deflateInit(&fDeflate, cxlevel);
+      if (err != Z_OK) {
+         printf("error %d in deflateInit (zlib)\n", err);
+         return nullptr;
+      }
+      fDeflateLevel = cxlevel;
+      return &fDeflate;
+   }
+
+   z_stream *GetInflate()
+   {
+      if (fHasInflate) {
+         if (inflateReset(&fInflate) == Z_OK)
+            return &fInflate;
+         inflateEnd(&fInflate);
+         fHasInflate = false;
+      }
+      fInflate.next_in = Z_NULL;
+      fInflate.avail_in = 0;
+      fInflate.zalloc = (alloc_func)0;
+      fInflate.zfree = (free_func)0;
+      fInflate.opaque = (voidpf)0;
+      int err = inflateInit(&fInflate);
+      if (err != Z_OK) {
+         fprintf(stderr, "R__unzip: error %d in inflateInit (zlib)\n", err);
+         return nullptr;
+      }
+      fHasInflate = true;
+      return &fInflate;
+   }
+};
+
+RZlibStreams &GetZlibStreams()
+{
+   thread_local RZlibStreams streams;
+   return streams;
+}
+
+#ifdef R__HAS_LIBDEFLATE
+/// libdeflate decompresses a whole buffer in one shot, typically two to three times faster than zlib's inflate.
+int R__unzipLibdeflate(const unsigned char *src, int srcsize, unsigned char *tgt, int tgtsize)
+{
+   thread_local std::unique_ptr<libdeflate_decompressor, decltype(&libdeflate_free_decompressor)> decompressor{
+      libdeflate_alloc_decompressor(), &libdeflate_free_decompressor};
+   if (!decompressor)
+      return -1;
+   size_t nbytes = 0;
+   if (libdeflate_zlib_decompress(decompressor.get(), src, srcsize, tgt, tgtsize, &nbytes) != LIBDEFLATE_SUCCESS)
+      return -1;
+   return static_cast<int>(nbytes);
+}
+
+std::atomic<R__ZLIBDecompressor_t> gZLIBDecompressor{&R__unzipLibdeflate};
+#else
+std::atomic<R__ZLIBDecompressor_t> gZLIBDecompressor{nullptr};
+#endif
+
+} // anonymous namespace
 
 // The size of the ROOT block framing headers for compression:
 // - 3 bytes to identify the compression algorithm and version.
@@ -64,6 +158,11 @@ extern "C" void R__SetZipMode(ROOT::RCompressionSetting::EAlgorithm::EValues mod
    R__ZipMode = mode;
 }
 
+extern "C" R__ZLIBDecompressor_t R__SetZLIBDecompressor(R__ZLIBDecompressor_t decompressor)
+{
+   return gZLIBDecompressor.exchange(decompressor);
+}
+
 unsigned long R__crc32(unsigned long crc, const unsigned char* buf, unsigned int len)
 {
    return crc32(crc, buf, len);
@@ -183,7 +282,6 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
   int err;
   int method   = Z_DEFLATED;
 
-    z_stream stream;
     //Don't use the globals but want name similar to help see similarities in code
     unsigned l_in_size, l_out_size;
     *irep = 0;
@@ -197,40 +295,29 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
        return;
     }
 
-    stream.next_in   = (Bytef*)src;
-    stream.avail_in  = (uInt)(*srcsize);
-
-    stream.next_out  = (Bytef*)(&tgt[HDRSIZE]);
-    stream.avail_out = (uInt)(*tgtsize) - HDRSIZE;
-
-    stream.zalloc    = (alloc_func)0;
-    stream.zfree     = (free_func)0;
-    stream.opaque    = (voidpf)0;
-
     if (cxlevel > 9) cxlevel = 9;
-    err = deflateInit(&stream, cxlevel);
-    if (err != Z_OK) {
-       printf("error %d in deflateInit (zlib)\n",err);
+    z_stream *stream = GetZlibStreams().GetDeflate(cxlevel);
+    if (!stream)
        return;
-    }
 
-    while ((err = deflate(&stream, Z_FINISH)) != Z_STREAM_END) {
+    stream->next_in   = (Bytef*)src;
+    stream->avail_in  = (uInt)(*srcsize);
+
+    stream->next_out  = (Bytef*)(&tgt[HDRSIZE]);
+    stream->avail_out = (uInt)(*tgtsize) - HDRSIZE;
+
+    while ((err = deflate(stream, Z_FINISH)) != Z_STREAM_END) {
        if (err != Z_OK) {
-          deflateEnd(&stream);
           return;
        }
     }
 
-    err = deflateEnd(&stream);
-    if (err != Z_OK)
-       printf("error %d in deflateEnd (zlib)\n",err);
-
     tgt[0] = 'Z';               /* Signature ZLib */
     tgt[1] = 'L';
     tgt[2] = (char) method;
 
     l_in_size   = (unsigned) (*srcsize);
-    l_out_size  = stream.total_out;             /* compressed size */
+    l_out_size  = stream->total_out;            /* compressed size */
     tgt[3] = (char)(l_out_size & 0xff);
     tgt[4] = (char)((l_out_size >> 8) & 0xff);
     tgt[5] = (char)((l_out_size >> 16) & 0xff);
@@ -239,7 +326,7 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
     tgt[7] = (char)((l_in_size >> 8) & 0xff);
     tgt[8] = (char)((l_in_size >> 16) & 0xff);
 
-    *irep = stream.total_out + HDRSIZE;
+    *irep = stream->total_out + HDRSIZE;
 }
 
 
@@ -395,33 +482,31 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
 
 void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-     z_stream stream; /* decompression stream */
-     int err = 0;
+     if (R__ZLIBDecompressor_t decompressor = gZLIBDecompressor.load(std::memory_order_relaxed)) {
+        int nbytes = decompressor(&src[HDRSIZE], *srcsize - HDRSIZE, tgt, *tgtsize);
+        if (nbytes >= 0) {
+           *irep = nbytes;
+           return;
+        }
+     }
 
-     stream.next_in = (Bytef *)(&src[HDRSIZE]);
-     stream.avail_in = (uInt)(*srcsize) - HDRSIZE;
-     stream.next_out = (Bytef *)tgt;
-     stream.avail_out = (uInt)(*tgtsize);
-     stream.zalloc = (alloc_func)0;
-     stream.zfree = (free_func)0;
-     stream.opaque = (voidpf)0;
-
-     err = inflateInit(&stream);
-     if (err != Z_OK) {
-        fprintf(stderr, "R__unzip: error %d in inflateInit (zlib)\n", err);
+     z_stream *stream = GetZlibStreams().GetInflate(); /* decompression stream */
+     int err = 0;
+     if (!stream)
         return;
-     }
 
-     while ((err = inflate(&stream, Z_FINISH)) != Z_STREAM_END) {
+     stream->next_in = (Bytef *)(&src[HDRSIZE]);
+     stream->avail_in = (uInt)(*srcsize) - HDRSIZE;
+     stream->next_out = (Bytef *)tgt;
+     stream->avail_out = (uInt)(*tgtsize);
+
+     while ((err = inflate(stream, Z_FINISH)) != Z_STREAM_END) {
         if (err != Z_OK) {
-           inflateEnd(&stream);
            fprintf(stderr, "R__unzip: error %d in inflate (zlib)\n", err);
            return;
         }
      }
 
-     inflateEnd(&stream);
-
-     *irep = stream.total_out;
+     *irep = stream->total_out;
      return;
 }
@@ -1,9 +1,12 @@
 #include <Compression.h>
 #include <RZip.h>
+#include <ZipZSTD.h>
 
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 static void testZipBufferSizes(ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm)
 {
@@ -68,3 +71,147 @@ TEST(RZip, ZipBufferSizesZSTD)
 {
    testZipBufferSizes(ROOT::RCompressionSetting::EAlgorithm::kZSTD);
 }
+
+// The compression and decompression contexts are reused across calls: interleave algorithms, levels and buffer
+// sizes to check that no state leaks from one buffer into the next.
+TEST(RZip, RepeatedRoundTrip)
+{
+   using EAlgorithm = ROOT::RCompressionSetting::EAlgorithm;
+   for (auto algorithm : {EAlgorithm::kZLIB, EAlgorithm::kLZMA, EAlgorithm::kLZ4, EAlgorithm::kZSTD}) {
+      for (int i = 0; i < 20; ++i) {
+         std::string source;
+         for (int j = 0; j < 100 * (1 + i % 7); ++j)
+            source += std::to_string((i + j * 7) % 101) + ",";
+         std::vector<char> zipped(source.size() + 64);
+         int srcsize = static_cast<int>(source.size());
+         int tgtsize = static_cast<int>(zipped.size());
+         int irep = 0;
+         R__zipMultipleAlgorithm(1 + (i % 9), &srcsize, &source[0], &tgtsize, zipped.data(), &irep, algorithm);
+         ASSERT_GT(irep, 0);
+
+         std::vector<char> unzipped(source.size());
+         int unzipSrcsize = irep;
+         int unzipTgtsize = static_cast<int>(unzipped.size());
+         int unzipIrep = 0;
+         R__unzip(&unzipSrcsize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipTgtsize,
+                  reinterpret_cast<unsigned char *>(unzipped.data()), &unzipIrep);
+         ASSERT_EQ(unzipIrep, srcsize);
+         EXPECT_EQ(source, std::string(unzipped.data(), unzipped.size()));
+      }
+   }
+}
+
+TEST(RZip, CompressionAutoSelection)
+{
+   std::string sample;
+   for (int i = 0; i < 2000; ++i)
+      sample += std::to_string(i % 53) + ",";
+
+   ROOT::RCompressionAutoSelection selection;
+   selection.fCandidates = {101, 505};
+   const int settings = selection.Select(sample.data(), static_cast<int>(sample.size()));
+   EXPECT_TRUE(settings == 101 || settings == 505) << settings;
+
+   // An unreachable speed budget falls back to the fastest candidate rather than to no compression
+   selection.fConstraint = 1e12;
+   EXPECT_GT(selection.Select(sample.data(), static_cast<int>(sample.size())), 0);
+
+   // Too small to judge
+   EXPECT_EQ(-1, selection.Select(sample.data(), 16));
+
+   std::string incompressible;
+   unsigned int state = 12345;
+   for (int i = 0; i < 4096; ++i) {
+      state = state * 1103515245u + 12345u;
+      incompressible += static_cast<char>(state >> 24);
+   }
+   EXPECT_EQ(0, selection.Select(incompressible.data(), static_cast<int>(incompressible.size())));
+}
+
+static int gNRejectingDecompressorCalls = 0;
+
+static int rejectingDecompressor(const unsigned char *, int, unsigned char *, int)
+{
+   ++gNRejectingDecompressorCalls;
+   return -1;
+}
+
+TEST(RZip, ZLIBDecompressorFallback)
+{
+   std::string source;
+   for (int i = 0; i < 500; ++i)
+      source += std::to_string(i % 37) + ";";
+   std::vector<char> zipped(source.size() + 64);
+   int srcsize = static_cast<int>(source.size());
+   int tgtsize = static_cast<int>(zipped.size());
+   int irep = 0;
+   R__zipMultipleAlgorithm(6, &srcsize, &source[0], &tgtsize, zipped.data(), &irep,
+                           ROOT::RCompressionSetting::EAlgorithm::kZLIB);
+   ASSERT_GT(irep, 0);
+
+   // A decompressor that gives up leaves the work to zlib
+   auto previous = R__SetZLIBDecompressor(&rejectingDecompressor);
+   std::vector<char> unzipped(source.size());
+   int unzipSrcsize = irep;
+   int unzipTgtsize = static_cast<int>(unzipped.size());
+   int unzipIrep = 0;
+   R__unzip(&unzipSrcsize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipTgtsize,
+            reinterpret_cast<unsigned char *>(unzipped.data()), &unzipIrep);
+   EXPECT_EQ(&rejectingDecompressor, R__SetZLIBDecompressor(previous));
+   EXPECT_EQ(1, gNRejectingDecompressorCalls);
+   ASSERT_EQ(unzipIrep, srcsize);
+   EXPECT_EQ(source, std::string(unzipped.data(), unzipped.size()));
+}
+
+static std::string makeSmallRecord(int i)
+{
+   return "{\"run\": " + std::to_string(1000 + i % 7) + ", \"event\": " + std::to_string(i) +
+          ", \"trigger\": \"HLT_IsoMu24\", \"pt\": [" + std::to_string(i % 113) + ".5, 17.25]}";
+}
+
+TEST(RZip, ZSTDDictionary)
+{
+   std::string samples;
+   std::vector<size_t> sampleSizes;
+   for (int i = 0; i < 2000; ++i) {
+      const auto record = makeSmallRecord(i);
+      samples += record;
+      sampleSizes.push_back(record.size());
+   }
+   std::vector<char> dict(4096);
+   const auto dictSize = R__trainZSTDDictionary(dict.data(), dict.size(), samples.data(), sampleSizes.data(),
+                                                static_cast<unsigned>(sampleSizes.size()));
+   ASSERT_GT(dictSize, 0u);
+   const auto dictID = R__registerZSTDDictionary(dict.data(), dictSize);
+   ASSERT_NE(dictID, 0u);
+   // Registering the same dictionary again is a no-op
+   EXPECT_EQ(dictID, R__registerZSTDDictionary(dict.data(), dictSize));
+
+   std::string source;
+   for (int i = 5000; i < 5004; ++i)
+      source += makeSmallRecord(i);
+   std::vector<char> plain(source.size() + 64);
+   std::vector<char> withDict(source.size() + 64);
+
+   int srcsize = static_cast<int>(source.size());
+   int tgtsize = static_cast<int>(plain.size());
+   int irepPlain = 0;
+   R__zipMultipleAlgorithm(5, &srcsize, &source[0], &tgtsize, plain.data(), &irepPlain,
+                           ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+   int irepDict = 0;
+   R__zipZSTDWithDictionary(5, dictID, &srcsize, &source[0], &tgtsize, withDict.data(), &irepDict);
+   ASSERT_GT(irepDict, 0);
+   if (irepPlain > 0) {
+      EXPECT_LT(irepDict, irepPlain);
+   }
+
+   // R__unzip finds the dictionary from the ID stored in the frame
+   std::vector<char> unzipped(source.size());
+   int unzipSrcsize = irepDict;
+   int unzipTgtsize = static_cast<int>(unzipped.size());
+   int irep = 0;
+   R__unzip(&unzipSrcsize, reinterpret_cast<unsigned char *>(withDict.data()), &unzipTgtsize,
+            reinterpret_cast<unsigned char *>(unzipped.data()), &irep);
+   ASSERT_EQ(irep, srcsize);
+   EXPECT_EQ(source, std::string(unzipped.data(), unzipped.size()));
+}
@@ -10,6 +10,8 @@
 #ifndef ROOT_ZipZSTD
 #define ROOT_ZipZSTD
 
+#include <stddef.h>
+
 // NOTE: the ROOT compression libraries aren't consistently written in C++; hence the
 // #ifdef's to avoid problems with C code.
 #ifdef __cplusplus
@@ -17,6 +19,16 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+// Dictionary support. Many small buffers of similar content (small baskets, pages of small collections) compress
+// much better against a dictionary trained on samples of that content. Dictionaries are registered once per
+// process; the zstd frame records the ID of the dictionary it was compressed with and R__unzipZSTD looks it up in
+// the registry, failing with an error if that dictionary was not registered.
+size_t R__trainZSTDDictionary(void *dictBuffer, size_t dictCapacity, const void *samples, const size_t *sampleSizes,
+                              unsigned nSamples);
+unsigned R__registerZSTDDictionary(const void *dict, size_t dictSize);
+void R__zipZSTDWithDictionary(int cxlevel, unsigned dictID, int *srcsize, char *src, int *tgtsize, char *tgt,
+                              int *irep);
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,10 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include <iostream>
 
@@ -22,18 +25,71 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+/// A registered dictionary: the digested form used for decompression, and the digested forms used for compression,
+/// created on first use for each compression level.
+struct RZSTDDictionary {
+    std::string fContent;
+    ZSTD_DDict *fDDict = nullptr;
+    ZSTD_CDict *fCDicts[10] = {};
+
+    ~RZSTDDictionary()
+    {
+        ZSTD_freeDDict(fDDict);
+        for (auto cdict : fCDicts)
+            ZSTD_freeCDict(cdict);
+    }
+};
+
+std::mutex &GetDictionaryMutex()
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    static std::mutex mutex;
+    return mutex;
+}
 
-    *irep = 0;
+// Dictionaries are never unregistered, so the pointers handed out stay valid for the lifetime of the process.
+std::map<unsigned, std::unique_ptr<RZSTDDictionary>> &GetDictionaryRegistry()
+{
+    static std::map<unsigned, std::unique_ptr<RZSTDDictionary>> registry;
+    return registry;
+}
+
+RZSTDDictionary *FindDictionary(unsigned dictID)
+{
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    auto &registry = GetDictionaryRegistry();
+    auto it = registry.find(dictID);
+    return it == registry.end() ? nullptr : it->second.get();
+}
+
+ZSTD_CDict *GetCompressionDictionary(RZSTDDictionary &dict, int cxlevel)
+{
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    if (!dict.fCDicts[cxlevel])
+        dict.fCDicts[cxlevel] = ZSTD_createCDict(dict.fContent.data(), dict.fContent.size(), 2 * cxlevel);
+    return dict.fCDicts[cxlevel];
+}
+
+// Creating a context allocates and initializes several hundred kilobytes, which dominates the cost of compressing
+// or decompressing a small buffer. Each thread therefore keeps one context of each kind and reuses it for all calls;
+// zstd resets the context parameters at the start of each ZSTD_compressCCtx / ZSTD_decompressDCtx call.
+ZSTD_CCtx *GetCompressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> ctx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    return ctx.get();
+}
+
+ZSTD_DCtx *GetDecompressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> ctx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    return ctx.get();
+}
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+} // anonymous namespace
 
+static void R__finishZipZSTD(size_t retval, int *srcsize, char *tgt, int *irep)
+{
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
             std::cerr << "Error in zip ZSTD. Type = " << ZSTD_getErrorName(retval) <<
@@ -58,10 +114,99 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     tgt[8] = (inflate_size >> 16) & 0xff;
 }
 
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    ZSTD_CCtx *ctx = GetCompressionContext();
+
+    *irep = 0;
+
+    size_t retval = ZSTD_compressCCtx(ctx,
+                                      &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                      src, static_cast<size_t>(*srcsize),
+                                      2*cxlevel);
+    R__finishZipZSTD(retval, srcsize, tgt, irep);
+}
+
+void R__zipZSTDWithDictionary(int cxlevel, unsigned dictID, int *srcsize, char *src, int *tgtsize, char *tgt,
+                              int *irep)
+{
+    if (dictID == 0) {
+        R__zipZSTD(cxlevel, srcsize, src, tgtsize, tgt, irep);
+        return;
+    }
+
+    *irep = 0;
+
+    RZSTDDictionary *dict = FindDictionary(dictID);
+    if (R__unlikely(!dict)) {
+        std::cerr << "R__zipZSTDWithDictionary: dictionary " << dictID << " is not registered" << std::endl;
+        return;
+    }
+    if (cxlevel < 1)
+        cxlevel = 1;
+    if (cxlevel > 9)
+        cxlevel = 9;
+    ZSTD_CDict *cdict = GetCompressionDictionary(*dict, cxlevel);
+    if (R__unlikely(!cdict)) {
+        std::cerr << "R__zipZSTDWithDictionary: cannot load dictionary " << dictID << std::endl;
+        return;
+    }
+
+    ZSTD_CCtx *ctx = GetCompressionContext();
+
+    size_t retval = ZSTD_compress_usingCDict(ctx,
+                                             &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                             src, static_cast<size_t>(*srcsize), cdict);
+    R__finishZipZSTD(retval, srcsize, tgt, irep);
+}
+
+size_t R__trainZSTDDictionary(void *dictBuffer, size_t dictCapacity, const void *samples, const size_t *sampleSizes,
+                              unsigned nSamples)
+{
+    size_t retval = ZDICT_trainFromBuffer(dictBuffer, dictCapacity, samples, sampleSizes, nSamples);
+    if (ZDICT_isError(retval)) {
+        std::cerr << "R__trainZSTDDictionary: cannot train dictionary from " << nSamples
+                  << " samples: " << ZDICT_getErrorName(retval) << std::endl;
+        return 0;
+    }
+    return retval;
+}
+
+unsigned R__registerZSTDDictionary(const void *dict, size_t dictSize)
+{
+    // Raw content dictionaries have no ID, so frames compressed with them could not find them again.
+    unsigned dictID = ZDICT_getDictID(dict, dictSize);
+    if (dictID == 0) {
+        std::cerr << "R__registerZSTDDictionary: not a zstd dictionary" << std::endl;
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    auto &registry = GetDictionaryRegistry();
+    auto it = registry.find(dictID);
+    if (it != registry.end()) {
+        if (it->second->fContent.compare(0, std::string::npos, static_cast<const char *>(dict), dictSize) != 0) {
+            std::cerr << "R__registerZSTDDictionary: a different dictionary with ID " << dictID
+                      << " is already registered" << std::endl;
+            return 0;
+        }
+        return dictID;
+    }
+
+    auto entry = std::make_unique<RZSTDDictionary>();
+    entry->fContent.assign(static_cast<const char *>(dict), dictSize);
+    entry->fDDict = ZSTD_createDDict(entry->fContent.data(), entry->fContent.size());
+    if (!entry->fDDict) {
+        std::cerr << "R__registerZSTDDictionary: cannot load dictionary " << dictID << std::endl;
+        return 0;
+    }
+    registry.emplace(dictID, std::move(entry));
+    return dictID;
+}
+
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    ZSTD_DCtx *ctx = GetDecompressionContext();
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
@@ -77,9 +222,24 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    size_t retval;
+    unsigned dictID = ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    if (dictID == 0) {
+        retval = ZSTD_decompressDCtx(ctx,
+                                     (char *)tgt, static_cast<size_t>(*tgtsize),
+                                     (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    } else {
+        RZSTDDictionary *dict = FindDictionary(dictID);
+        if (R__unlikely(!dict)) {
+            std::cerr << "R__unzipZSTD: buffer was compressed with zstd dictionary " << dictID
+                      << ", which is not registered" << std::endl;
+            return;
+        }
+        retval = ZSTD_decompress_usingDDict(ctx,
+                                            (char *)tgt, static_cast<size_t>(*tgtsize),
+                                            (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize),
+                                            dict->fDDict);
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
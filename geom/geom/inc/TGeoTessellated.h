@@ -12,6 +12,7 @@
 #ifndef ROOT_TGeoTessellated
 #define ROOT_TGeoTessellated
 
+#include <atomic>
 #include <map>
 #include "TGeoVector3.h"
 #include "TGeoTypedefs.h"
@@ -67,19 +68,30 @@ private:
    std::vector<Vertex_t> fVertices; // List of vertices
    std::vector<TGeoFacet> fFacets;  // List of facets
    std::multimap<long, int> fVerticesMap; //! Temporary map used to deduplicate vertices
+   mutable std::atomic<void *> fBVH{nullptr}; //! Bounding volume hierarchy of the facets, built on first use
 
    TGeoTessellated(const TGeoTessellated &) = delete;
    TGeoTessellated &operator=(const TGeoTessellated &) = delete;
 
+   void *GetBVH() const;
+   void DeleteBVH();
+
 public:
    // constructors
    TGeoTessellated() {}
    TGeoTessellated(const char *name, int nfacets = 0);
    TGeoTessellated(const char *name, const std::vector<Vertex_t> &vertices);
    // destructor
-   ~TGeoTessellated() override {}
+   ~TGeoTessellated() override;
 
    void ComputeBBox() override;
+   void ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm) override;
+   Bool_t Contains(const Double_t *point) const override;
+   Double_t DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact = 1, Double_t step = TGeoShape::Big(),
+                           Double_t *safe = nullptr) const override;
+   Double_t DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact = 1,
+                            Double_t step = TGeoShape::Big(), Double_t *safe = nullptr) const override;
+   Double_t Safety(const Double_t *point, Bool_t in = kTRUE) const override;
    void CloseShape(bool check = true, bool fixFlipped = true, bool verbose = true);
 
    bool AddFacet(const Vertex_t &pt0, const Vertex_t &pt1, const Vertex_t &pt2);
@@ -61,8 +61,13 @@ protected:
    UChar_t *fIndcX;    //[fNx] array of slices bits on X
    UChar_t *fIndcY;    //[fNy] array of slices bits on Y
    UChar_t *fIndcZ;    //[fNz] array of slices bits on Z
+   void *fBVH;         //! optional bounding volume hierarchy of the daughter boxes
 
+   static Int_t fgBVHThreshold; // minimum number of daughters for building a BVH (0 = never)
+
+   void BuildBVH();
    void BuildVoxelLimits();
+   void DeleteBVH();
    Int_t *GetExtraX(Int_t islice, Bool_t left, Int_t &nextra) const;
    Int_t *GetExtraY(Int_t islice, Bool_t left, Int_t &nextra) const;
    Int_t *GetExtraZ(Int_t islice, Bool_t left, Int_t &nextra) const;
@@ -93,16 +98,22 @@ public:
    ~TGeoVoxelFinder() override;
    void DaughterToMother(Int_t id, const Double_t *local, Double_t *master) const;
    virtual Double_t Efficiency();
+   Int_t *GetBVHNextCandidates(const Double_t *point, const Double_t *dir, Double_t stepmax, Int_t &ncheck,
+                               TGeoStateInfo &td) const;
+   Int_t *GetBVHSafetyCandidates(const Double_t *point, Double_t safmax, Int_t &ncheck, TGeoStateInfo &td) const;
+   static Int_t GetBVHThreshold() { return fgBVHThreshold; }
    virtual Int_t *GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td);
    Int_t *GetCheckList(Int_t &nelem, TGeoStateInfo &td) const;
    virtual Int_t *GetNextCandidates(const Double_t *point, Int_t &ncheck, TGeoStateInfo &td);
    virtual void FindOverlaps(Int_t inode) const;
+   Bool_t HasBVH() const { return fBVH != nullptr; }
    Bool_t IsInvalid() const { return TObject::TestBit(kGeoInvalidVoxels); }
    Bool_t NeedRebuild() const { return TObject::TestBit(kGeoRebuildVoxels); }
    Double_t *GetBoxes() const { return fBoxes; }
    Bool_t IsSafeVoxel(const Double_t *point, Int_t inode, Double_t minsafe) const;
    void Print(Option_t *option = "") const override;
    void PrintVoxelLimits(const Double_t *point) const;
+   static void SetBVHThreshold(Int_t ndaughters) { fgBVHThreshold = ndaughters; }
    void SetInvalid(Bool_t flag = kTRUE) { TObject::SetBit(kGeoInvalidVoxels, flag); }
    void SetNeedRebuild(Bool_t flag = kTRUE) { TObject::SetBit(kGeoRebuildVoxels, flag); }
    virtual Int_t *GetNextVoxel(const Double_t *point, const Double_t *dir, Int_t &ncheck, TGeoStateInfo &td);
@@ -1197,11 +1197,25 @@ void TGeoBBox::FillBuffer3D(TBuffer3D &buffer, Int_t reqSections, Bool_t localFr
 /// Check the inside status for each of the points in the array.
 /// Input: Array of point coordinates + vector size
 /// Output: Array of Booleans for the inside of each point
+///
+/// The loops of the vectorized methods of the box are written without branches, so that the compiler can
+/// vectorize them. Shapes deriving from TGeoBBox which do not implement these methods fall back to a loop on
+/// their scalar methods.
 
 void TGeoBBox::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      inside[i] = Contains(&points[3 * i]);
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i = 0; i < vecsize; i++)
+         inside[i] = Contains(&points[3 * i]);
+      return;
+   }
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t *point = &points[3 * i];
+      inside[i] = (TMath::Abs(point[0] - ox) <= dx) & (TMath::Abs(point[1] - oy) <= dy) &
+                  (TMath::Abs(point[2] - oz) <= dz);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1221,8 +1235,24 @@ void TGeoBBox::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
                                 Double_t *step) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i = 0; i < vecsize; i++)
+         dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+      return;
+   }
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   const Double_t big = TGeoShape::Big();
+   for (Int_t i = 0; i < vecsize; i++) {
+      Double_t smin = big;
+      for (Int_t j = 0; j < 3; j++) {
+         const Double_t newpt = points[3 * i + j] - fOrigin[j];
+         const Double_t dir = dirs[3 * i + j];
+         // distance to the face the track is moving to, along this axis
+         const Double_t s = (par[j] - ((dir > 0) ? newpt : -newpt)) / TMath::Abs(dir);
+         smin = TMath::Min(smin, (dir != 0) ? s : big);
+      }
+      dists[i] = (smin < 0) ? 0. : smin;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1231,8 +1261,38 @@ void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
 void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
                                  Double_t *step) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      dists[i] = DistFromOutside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i = 0; i < vecsize; i++)
+         dists[i] = DistFromOutside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+      return;
+   }
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   const Double_t big = TGeoShape::Big();
+   for (Int_t i = 0; i < vecsize; i++) {
+      Double_t newpt[3], dir[3], saf[3];
+      for (Int_t j = 0; j < 3; j++) {
+         newpt[j] = points[3 * i + j] - fOrigin[j];
+         dir[j] = dirs[3 * i + j];
+         saf[j] = TMath::Abs(newpt[j]) - par[j];
+      }
+      const Bool_t far = (saf[0] >= step[i]) | (saf[1] >= step[i]) | (saf[2] >= step[i]);
+      const Bool_t in = (saf[0] <= 0) & (saf[1] <= 0) & (saf[2] <= 0);
+      // point actually inside: zero, unless it is exiting through the closest face
+      const Int_t jclose = (saf[1] > saf[0]) ? ((saf[2] > saf[1]) ? 2 : 1) : ((saf[2] > saf[0]) ? 2 : 0);
+      const Double_t dinside = (newpt[jclose] * dir[jclose] > 0) ? big : 0.;
+      // the track can only enter through one of the faces it is moving to; the entry point is on the box
+      Double_t snxt = big;
+      for (Int_t j = 0; j < 3; j++) {
+         const Double_t s = saf[j] / TMath::Abs(dir[j]);
+         const Int_t j1 = (j + 1) % 3;
+         const Int_t j2 = (j + 2) % 3;
+         const Bool_t hit = (saf[j] >= 0) & (newpt[j] * dir[j] < 0) &
+                            (TMath::Abs(newpt[j1] + s * dir[j1]) <= par[j1]) &
+                            (TMath::Abs(newpt[j2] + s * dir[j2]) <= par[j2]);
+         snxt = TMath::Min(snxt, hit ? s : big);
+      }
+      dists[i] = far ? big : (in ? dinside : snxt);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1242,6 +1302,18 @@ void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 
 void TGeoBBox::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      safe[i] = Safety(&points[3 * i], inside[i]);
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i = 0; i < vecsize; i++)
+         safe[i] = Safety(&points[3 * i], inside[i]);
+      return;
+   }
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t *point = &points[3 * i];
+      // the safety inside is the opposite of the largest distance outside of the three slabs
+      const Double_t saf = TMath::Max(TMath::Max(TMath::Abs(point[0] - ox) - dx, TMath::Abs(point[1] - oy) - dy),
+                                      TMath::Abs(point[2] - oz) - dz);
+      safe[i] = inside[i] ? -saf : saf;
+   }
 }
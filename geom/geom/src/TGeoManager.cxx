@@ -236,6 +236,7 @@ in order to enhance rays.
 \image html geom_random2.jpg
 */
 
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
@@ -285,6 +286,11 @@ in order to enhance rays.
 #include "TGeoRegion.h"
 #include "TGDMLMatrix.h"
 #include "TGeoOpticalSurface.h"
+#include "ROOT/TSeq.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 // statics and globals
 
@@ -305,6 +311,23 @@ TGeoManager::EDefaultUnits TGeoManager::fgDefaultUnits = TGeoManager::kRootUnits
 TGeoManager::ThreadsMap_t *TGeoManager::fgThreadId = nullptr;
 static Bool_t gGeometryLocked = kFALSE;
 
+namespace {
+
+// Incremented whenever a navigator is added or removed, or the current navigator of a thread
+// is changed: this invalidates the per-thread caches of the current navigator.
+std::atomic<UInt_t> gNavigatorsGeneration{0};
+
+// Current navigator of the calling thread, for the last geometry manager used by the thread.
+struct TNavigatorCache {
+   const TGeoManager *fManager = nullptr;
+   TGeoNavigator *fNavigator = nullptr;
+   UInt_t fGeneration = 0;
+};
+
+thread_local TNavigatorCache gNavigatorCache;
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
@@ -804,6 +827,7 @@ TGeoNavigator *TGeoManager::AddNavigator()
    TGeoNavigator *nav = array->AddNavigator();
    if (fClosed)
       nav->GetCache()->BuildInfoBranch();
+   gNavigatorsGeneration++;
    if (fMultiThread)
       fgMutex.unlock();
    return nav;
@@ -811,22 +835,25 @@ TGeoNavigator *TGeoManager::AddNavigator()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns current navigator for the calling thread.
+/// In multi-threaded mode the navigator is cached per thread, so that the map of
+/// navigators is only looked up (under lock) after navigators were added, removed or
+/// switched, or when the thread uses another geometry manager.
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator *) tnav = nullptr;
    if (!fMultiThread)
       return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav)
-      return nav;
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end())
+   TNavigatorCache &cache = gNavigatorCache;
+   const UInt_t generation = gNavigatorsGeneration.load(std::memory_order_acquire);
+   if (cache.fNavigator && cache.fManager == this && cache.fGeneration == generation)
+      return cache.fNavigator;
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   if (!array)
       return nullptr;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
+   TGeoNavigator *nav = array->GetCurrentNavigator();
+   cache.fManager = this;
+   cache.fNavigator = nav;
+   cache.fGeneration = generation;
    return nav;
 }
 
@@ -836,6 +863,9 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 {
    std::thread::id threadId = std::this_thread::get_id();
+   std::unique_lock<std::mutex> lock(fgMutex, std::defer_lock);
+   if (fMultiThread)
+      lock.lock();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
    if (it == fNavigators.end())
       return nullptr;
@@ -848,22 +878,21 @@ TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 
 Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
 {
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) {
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   if (!array) {
       Error("SetCurrentNavigator", "No navigator defined for this thread\n");
-      std::cout << "  thread id: " << threadId << std::endl;
+      std::cout << "  thread id: " << std::this_thread::get_id() << std::endl;
       return kFALSE;
    }
-   TGeoNavigatorArray *array = it->second;
    TGeoNavigator *nav = array->SetCurrentNavigator(index);
    if (!nav) {
       Error("SetCurrentNavigator", "Navigator %d not existing for this thread\n", index);
-      std::cout << "  thread id: " << threadId << std::endl;
+      std::cout << "  thread id: " << std::this_thread::get_id() << std::endl;
       return kFALSE;
    }
    if (!fMultiThread)
       fCurrentNavigator = nav;
+   gNavigatorsGeneration++;
    return kTRUE;
 }
 
@@ -889,6 +918,7 @@ void TGeoManager::ClearNavigators()
          delete arr;
    }
    fNavigators.clear();
+   gNavigatorsGeneration++;
    if (fMultiThread)
       fgMutex.unlock();
 }
@@ -907,6 +937,7 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
             delete nav;
             if (!arr->GetEntries())
                fNavigators.erase(it);
+            gNavigatorsGeneration++;
             if (fMultiThread)
                fgMutex.unlock();
             return;
@@ -1005,15 +1036,17 @@ Int_t TGeoManager::ThreadId()
    if (gGeoManager && !gGeoManager->IsMultiThread())
       return 0;
    std::thread::id threadId = std::this_thread::get_id();
+   // the map is only looked up once per thread, but it is modified by other threads meanwhile
+   std::lock_guard<std::mutex> lock(fgMutex);
    TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end())
+   if (it != fgThreadId->end()) {
+      tid = it->second;
       return it->second;
+   }
    // Map needs to be updated.
-   fgMutex.lock();
    (*fgThreadId)[threadId] = fgNumThreads;
    tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
    ttid = fgNumThreads++;
-   fgMutex.unlock();
    return ttid;
 }
 
@@ -3125,6 +3158,11 @@ void TGeoManager::RestoreMasterVolume()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Voxelize all non-divided volumes.
+///
+/// The voxelization of a volume only depends on its daughters, so when the implicit
+/// multi-threading is enabled the volumes are voxelized in parallel. The voxels can also be
+/// exported to a ROOT file together with the geometry (option "v" of Export()), in which case
+/// they are not recomputed when the geometry is read back.
 
 void TGeoManager::Voxelize(Option_t *option)
 {
@@ -3132,16 +3170,44 @@ void TGeoManager::Voxelize(Option_t *option)
    //   TGeoVoxelFinder *vox = 0;
    if (!fStreamVoxels && fgVerboseLevel > 0)
       Info("Voxelize", "Voxelizing...");
-   //   Int_t nentries = fVolumes->GetSize();
-   TIter next(fVolumes);
-   while ((vol = (TGeoVolume *)next())) {
-      if (!fIsGeomReading)
-         vol->SortNodes();
-      if (!fStreamVoxels) {
-         vol->Voxelize(option);
+   Int_t nvolumes = fVolumes->GetEntriesFast();
+   if (!fIsGeomReading) {
+      for (Int_t i = 0; i < nvolumes; i++) {
+         vol = (TGeoVolume *)fVolumes->At(i);
+         if (vol)
+            vol->SortNodes();
+      }
+   }
+   if (!fStreamVoxels) {
+      auto voxelize = [&](UInt_t i) {
+         TGeoVolume *v = (TGeoVolume *)fVolumes->At(i);
+         if (v)
+            v->Voxelize(option);
+      };
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && nvolumes > 1) {
+         // The bounding boxes of the assemblies are computed on demand from the ones of their
+         // daughters, possibly by the voxelization of any of their mothers: compute them upfront.
+         for (Int_t i = 0; i < nvolumes; i++) {
+            vol = (TGeoVolume *)fVolumes->At(i);
+            if (vol && vol->IsAssembly())
+               vol->GetShape()->ComputeBBox();
+         }
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(voxelize, ROOT::TSeqU(nvolumes));
+      } else
+#endif
+      {
+         for (Int_t i = 0; i < nvolumes; i++)
+            voxelize(i);
+      }
+   }
+   if (!fIsGeomReading) {
+      for (Int_t i = 0; i < nvolumes; i++) {
+         vol = (TGeoVolume *)fVolumes->At(i);
+         if (vol)
+            vol->FindOverlaps();
       }
-      if (!fIsGeomReading)
-         vol->FindOverlaps();
    }
 }
 
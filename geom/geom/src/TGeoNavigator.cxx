@@ -1119,49 +1119,62 @@ TGeoNode *TGeoNavigator::FindNextDaughterBoundary(Double_t *point, Double_t *dir
    Int_t sumchecked = 0;
    Int_t *vlist = nullptr;
    TGeoStateInfo &info = *fCache->GetInfo();
-   voxels->SortCrossedVoxels(point, dir, info);
-   while ((sumchecked < nd) && (vlist = voxels->GetNextVoxel(point, dir, ncheck, info))) {
-      for (i = 0; i < ncheck; i++) {
-         current = vol->GetNode(vlist[i]);
-         if (fGeometry->IsActivityEnabled() && !current->GetVolume()->IsActive())
-            continue;
-         current->cd();
-         current->MasterToLocal(point, lpoint);
-         current->MasterToLocalVect(dir, ldir);
-         if (current->IsOverlapping() && current->GetVolume()->Contains(lpoint) &&
-             current->GetVolume()->GetShape()->Safety(lpoint, kTRUE) > gTolerance)
-            continue;
-         snext = current->GetVolume()->GetShape()->DistFromOutside(lpoint, ldir, 3, fStep);
-         sumchecked++;
-         //         printf("checked %d from %d : snext=%g\n", sumchecked, nd, snext);
-         if (snext < fStep - gTolerance) {
-            if (idebug > 4) {
-               printf("   -> from local=(%19.16f, %19.16f, %19.16f)\n", lpoint[0], lpoint[1], lpoint[2]);
-               printf("           ldir =(%19.16f, %19.16f, %19.16f)\n", ldir[0], ldir[1], ldir[2]);
-               printf("   -> to: %s shape %s snext=%g\n", current->GetName(),
-                      current->GetVolume()->GetShape()->ClassName(), snext);
-            }
-            indnext = current->GetVolume()->GetNextNodeIndex();
-            if (compmatrix) {
-               fCurrentMatrix->CopyFrom(fGlobalMatrix);
+   // check the distance to a candidate daughter
+   auto checkDaughter = [&](Int_t id) {
+      current = vol->GetNode(id);
+      if (fGeometry->IsActivityEnabled() && !current->GetVolume()->IsActive())
+         return;
+      current->cd();
+      current->MasterToLocal(point, lpoint);
+      current->MasterToLocalVect(dir, ldir);
+      if (current->IsOverlapping() && current->GetVolume()->Contains(lpoint) &&
+          current->GetVolume()->GetShape()->Safety(lpoint, kTRUE) > gTolerance)
+         return;
+      snext = current->GetVolume()->GetShape()->DistFromOutside(lpoint, ldir, 3, fStep);
+      sumchecked++;
+      //         printf("checked %d from %d : snext=%g\n", sumchecked, nd, snext);
+      if (snext < fStep - gTolerance) {
+         if (idebug > 4) {
+            printf("   -> from local=(%19.16f, %19.16f, %19.16f)\n", lpoint[0], lpoint[1], lpoint[2]);
+            printf("           ldir =(%19.16f, %19.16f, %19.16f)\n", ldir[0], ldir[1], ldir[2]);
+            printf("   -> to: %s shape %s snext=%g\n", current->GetName(),
+                   current->GetVolume()->GetShape()->ClassName(), snext);
+         }
+         indnext = current->GetVolume()->GetNextNodeIndex();
+         if (compmatrix) {
+            fCurrentMatrix->CopyFrom(fGlobalMatrix);
+            fCurrentMatrix->Multiply(current->GetMatrix());
+         }
+         fIsStepExiting = kFALSE;
+         fIsStepEntering = kTRUE;
+         fStep = snext;
+         fNextNode = current;
+         nodefound = fNextNode;
+         idaughter = id;
+         while (indnext >= 0) {
+            current = current->GetDaughter(indnext);
+            if (compmatrix)
                fCurrentMatrix->Multiply(current->GetMatrix());
-            }
-            fIsStepExiting = kFALSE;
-            fIsStepEntering = kTRUE;
-            fStep = snext;
             fNextNode = current;
-            nodefound = fNextNode;
-            idaughter = vlist[i];
-            while (indnext >= 0) {
-               current = current->GetDaughter(indnext);
-               if (compmatrix)
-                  fCurrentMatrix->Multiply(current->GetMatrix());
-               fNextNode = current;
-               nodefound = current;
-               indnext = current->GetVolume()->GetNextNodeIndex();
-            }
+            nodefound = current;
+            indnext = current->GetVolume()->GetNextNodeIndex();
          }
       }
+   };
+   if (voxels->HasBVH()) {
+      // candidates ordered by the distance to their bounding box
+      vlist = voxels->GetBVHNextCandidates(point, dir, fStep, ncheck, info);
+      for (i = 0; i < ncheck; i++) {
+         if (voxels->IsSafeVoxel(point, vlist[i], fStep))
+            continue;
+         checkDaughter(vlist[i]);
+      }
+   } else {
+      voxels->SortCrossedVoxels(point, dir, info);
+      while ((sumchecked < nd) && (vlist = voxels->GetNextVoxel(point, dir, ncheck, info))) {
+         for (i = 0; i < ncheck; i++)
+            checkDaughter(vlist[i]);
+      }
    }
    fCache->ReleaseInfo();
    if (vol->IsAssembly())
@@ -1803,6 +1816,32 @@ Double_t TGeoNavigator::Safety(Bool_t inside)
       }
    }
 
+   //---> with a BVH, check only the daughters having their box closer than the safety
+   if (voxels->HasBVH()) {
+      Int_t ncheck = 0;
+      TGeoStateInfo &info = *fCache->GetInfo();
+      Int_t *vlist = voxels->GetBVHSafetyCandidates(point, fSafety, ncheck, info);
+      for (Int_t i = 0; i < ncheck; i++) {
+         // the candidates are ordered by distance, but the safety decreases meanwhile
+         if (voxels->IsSafeVoxel(point, vlist[i], fSafety))
+            continue;
+         node = (TGeoNode *)nodes->UncheckedAt(vlist[i]);
+         safe = node->Safety(point, kFALSE);
+         if (safe < gTolerance) {
+            fCache->ReleaseInfo();
+            fSafety = 0;
+            fIsOnBoundary = kTRUE;
+            return fSafety;
+         }
+         if (safe < fSafety)
+            fSafety = safe;
+      }
+      fCache->ReleaseInfo();
+      if (fNmany && !inside)
+         SafetyOverlaps();
+      return fSafety;
+   }
+
    //---> check fast unsafe voxels
    Double_t *boxes = voxels->GetBoxes();
    for (id = 0; id < nd; id++) {
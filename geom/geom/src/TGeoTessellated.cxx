@@ -14,8 +14,13 @@
 \ingroup Geometry_classes
 
 Tessellated solid class. It is composed by a set of planar faces having triangular or
-quadrilateral shape. The class does not provide navigation functionality, it just wraps the data
-for the composing faces.
+quadrilateral shape.
+
+The navigation methods use a bounding volume hierarchy of the triangles composing the facets,
+built on the first call of any of them (by the first thread, the others waiting for it), so that
+their cost grows only logarithmically with the number of facets. The facets of a closed body must
+be consistently oriented (see CheckClosure()), the orientation of the whole solid being deduced
+from the sign of its volume.
 */
 
 #include <iostream>
@@ -31,12 +36,241 @@ for the composing faces.
 #include "TMath.h"
 
 #include <array>
+#include <mutex>
+#include <utility>
 #include <vector>
 
+#include <bvh/v2/bvh.h>
+#include <bvh/v2/vec.h>
+#include <bvh/v2/ray.h>
+#include <bvh/v2/node.h>
+#include <bvh/v2/stack.h>
+#include <bvh/v2/default_builder.h>
+
 ClassImp(TGeoTessellated);
 
 using Vertex_t = Tessellated::Vertex_t;
 
+namespace {
+
+using BVHVec3 = bvh::v2::Vec<double, 3>;
+using BVHBBox = bvh::v2::BBox<double, 3>;
+using BVHNode = bvh::v2::Node<double, 3>;
+using BVH = bvh::v2::Bvh<BVHNode>;
+using BVHRay = bvh::v2::Ray<double, 3>;
+
+/// Triangle of a facet, oriented such that its normal points outside of the solid
+struct FacetTriangle {
+   Vertex_t fV0;     ///< first vertex
+   Vertex_t fE1;     ///< edge from the first to the second vertex
+   Vertex_t fE2;     ///< edge from the first to the third vertex
+   Vertex_t fNormal; ///< unit normal
+};
+
+/// Triangles of the facets, stored in the order of the leaves of their bounding volume hierarchy
+struct FacetBVH {
+   BVH fBVH;
+   std::vector<FacetTriangle> fTriangles;
+};
+
+std::mutex gFacetBVHMutex;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Split the facets in triangles and build their bounding volume hierarchy
+
+FacetBVH *BuildFacetBVH(const TGeoTessellated &shape)
+{
+   std::vector<FacetTriangle> triangles;
+   triangles.reserve(2 * shape.GetNfacets());
+   double volume = 0.;
+   for (int i = 0; i < shape.GetNfacets(); ++i) {
+      const auto &facet = shape.GetFacet(i);
+      const auto &v0 = shape.GetVertex(facet[0]);
+      for (int j = 1; j < facet.GetNvert() - 1; ++j) {
+         FacetTriangle tri;
+         tri.fV0 = v0;
+         tri.fE1 = shape.GetVertex(facet[j]) - v0;
+         tri.fE2 = shape.GetVertex(facet[j + 1]) - v0;
+         tri.fNormal = Vertex_t::Cross(tri.fE1, tri.fE2);
+         if (tri.fNormal.Mag2() == 0.)
+            continue;
+         // signed volume of the tetrahedron made by the triangle and the origin
+         volume += Vertex_t::Dot(v0, tri.fNormal) / 6.;
+         tri.fNormal.Normalize();
+         triangles.push_back(tri);
+      }
+   }
+   // the facets are oriented consistently, but not necessarily outwards
+   if (volume < 0.) {
+      for (auto &tri : triangles) {
+         std::swap(tri.fE1, tri.fE2);
+         tri.fNormal *= -1.;
+      }
+   }
+
+   auto facetbvh = new FacetBVH;
+   if (triangles.empty())
+      return facetbvh;
+   const double margin = TGeoShape::Tolerance();
+   std::vector<BVHBBox> bboxes;
+   std::vector<BVHVec3> centers;
+   bboxes.reserve(triangles.size());
+   centers.reserve(triangles.size());
+   for (const auto &tri : triangles) {
+      const Vertex_t v1 = tri.fV0 + tri.fE1;
+      const Vertex_t v2 = tri.fV0 + tri.fE2;
+      BVHBBox bbox(BVHVec3(tri.fV0[0], tri.fV0[1], tri.fV0[2]));
+      bbox.extend(BVHVec3(v1[0], v1[1], v1[2]));
+      bbox.extend(BVHVec3(v2[0], v2[1], v2[2]));
+      for (int j = 0; j < 3; ++j) {
+         bbox.min[j] -= margin;
+         bbox.max[j] += margin;
+      }
+      bboxes.push_back(bbox);
+      centers.push_back(bbox.get_center());
+   }
+   typename bvh::v2::DefaultBuilder<BVHNode>::Config config;
+   config.quality = bvh::v2::DefaultBuilder<BVHNode>::Quality::High;
+   facetbvh->fBVH = bvh::v2::DefaultBuilder<BVHNode>::build(bboxes, centers, config);
+   facetbvh->fTriangles.reserve(triangles.size());
+   for (auto id : facetbvh->fBVH.prim_ids)
+      facetbvh->fTriangles.push_back(triangles[id]);
+   return facetbvh;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Intersection of the line point + t * dir with a triangle (Moller-Trumbore). Returns false
+/// if the line misses the triangle or is parallel to it, otherwise the distance t and the
+/// barycentric coordinates u, v of the crossing. The crossings slightly outside of the triangle
+/// are kept, otherwise rounding can make a line crossing the edge shared by two triangles miss both.
+
+bool IntersectTriangle(const FacetTriangle &tri, const Vertex_t &point, const Vertex_t &dir, double &t, double &u,
+                       double &v)
+{
+   constexpr double kEdgeMargin = 1.e-12;
+   const Vertex_t pvec = Vertex_t::Cross(dir, tri.fE2);
+   const double det = Vertex_t::Dot(tri.fE1, pvec);
+   if (det * det <= 1.e-24 * tri.fE1.Mag2() * tri.fE2.Mag2())
+      return false;
+   const double invdet = 1. / det;
+   const Vertex_t tvec = point - tri.fV0;
+   u = Vertex_t::Dot(tvec, pvec) * invdet;
+   if (u < -kEdgeMargin || u > 1. + kEdgeMargin)
+      return false;
+   const Vertex_t qvec = Vertex_t::Cross(tvec, tri.fE1);
+   v = Vertex_t::Dot(dir, qvec) * invdet;
+   if (v < -kEdgeMargin || u + v > 1. + kEdgeMargin)
+      return false;
+   t = Vertex_t::Dot(tri.fE2, qvec) * invdet;
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from a point to a triangle (Ericson, Real-Time Collision Detection, 5.1.5)
+
+double DistanceSqToTriangle(const FacetTriangle &tri, const Vertex_t &point)
+{
+   const Vertex_t &ab = tri.fE1;
+   const Vertex_t &ac = tri.fE2;
+   const Vertex_t ap = point - tri.fV0;
+   const double d1 = Vertex_t::Dot(ab, ap);
+   const double d2 = Vertex_t::Dot(ac, ap);
+   if (d1 <= 0. && d2 <= 0.)
+      return ap.Mag2();
+   const Vertex_t bp = ap - ab;
+   const double d3 = Vertex_t::Dot(ab, bp);
+   const double d4 = Vertex_t::Dot(ac, bp);
+   if (d3 >= 0. && d4 <= d3)
+      return bp.Mag2();
+   const double vc = d1 * d4 - d3 * d2;
+   if (vc <= 0. && d1 >= 0. && d3 <= 0.)
+      return (ap - (d1 / (d1 - d3)) * ab).Mag2();
+   const Vertex_t cp = ap - ac;
+   const double d5 = Vertex_t::Dot(ab, cp);
+   const double d6 = Vertex_t::Dot(ac, cp);
+   if (d6 >= 0. && d5 <= d6)
+      return cp.Mag2();
+   const double vb = d5 * d2 - d1 * d6;
+   if (vb <= 0. && d2 >= 0. && d6 <= 0.)
+      return (ap - (d2 / (d2 - d6)) * ac).Mag2();
+   const double va = d3 * d6 - d5 * d4;
+   if (va <= 0. && d4 - d3 >= 0. && d5 - d6 >= 0.)
+      return (bp - ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (ac - ab)).Mag2();
+   const double denom = 1. / (va + vb + vc);
+   return (ap - (vb * denom) * ab - (vc * denom) * ac).Mag2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along dir to the closest triangle crossed by the ray entering (or exiting) the
+/// solid, within tmax. Returns TGeoShape::Big() if there is none.
+
+double DistanceToTriangles(const FacetBVH &facets, const double *point, const double *dir, bool entering,
+                           double tmax)
+{
+   const Vertex_t pt(point[0], point[1], point[2]);
+   const Vertex_t dr(dir[0], dir[1], dir[2]);
+   BVHRay ray(BVHVec3(point[0], point[1], point[2]), BVHVec3(dir[0], dir[1], dir[2]), -TGeoShape::Tolerance(), tmax);
+   double dist = TGeoShape::Big();
+   static thread_local bvh::v2::GrowingStack<BVH::Index> stack;
+   stack.clear();
+   facets.fBVH.intersect<false, true>(ray, facets.fBVH.get_root().index, stack, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+         const auto &tri = facets.fTriangles[i];
+         const double dn = Vertex_t::Dot(dr, tri.fNormal);
+         if (entering ? dn >= 0. : dn <= 0.)
+            continue;
+         double t, u, v;
+         if (IntersectTriangle(tri, pt, dr, t, u, v) && t >= ray.tmin && t < ray.tmax) {
+            ray.tmax = t;
+            dist = TMath::Max(0., t);
+         }
+      }
+      return false;
+   });
+   return dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from a point to the closest triangle, which is returned in closest
+
+double SafetySqToTriangles(const FacetBVH &facets, const double *point, int &closest)
+{
+   const Vertex_t pt(point[0], point[1], point[2]);
+   double safsq = TGeoShape::Big();
+   closest = -1;
+   auto distanceSqToNode = [&](const BVHNode &node) {
+      const auto bbox = node.get_bbox();
+      double dsq = 0.;
+      for (int j = 0; j < 3; ++j) {
+         const double d = TMath::Max(0., TMath::Max(bbox.min[j] - point[j], point[j] - bbox.max[j]));
+         dsq += d * d;
+      }
+      return dsq;
+   };
+   static thread_local bvh::v2::GrowingStack<BVH::Index> stack;
+   stack.clear();
+   facets.fBVH.traverse_top_down<false>(
+      facets.fBVH.get_root().index, stack,
+      [&](size_t begin, size_t end) {
+         for (size_t i = begin; i < end; ++i) {
+            const double dsq = DistanceSqToTriangle(facets.fTriangles[i], pt);
+            if (dsq < safsq) {
+               safsq = dsq;
+               closest = i;
+            }
+         }
+         return false;
+      },
+      [&](const BVHNode &left, const BVHNode &right) {
+         const double dleft = distanceSqToNode(left);
+         const double dright = distanceSqToNode(right);
+         return std::make_tuple(dleft < safsq, dright < safsq, dleft > dright);
+      });
+   return safsq;
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compact consecutive equal vertices
 
@@ -320,6 +554,7 @@ bool TGeoTessellated::FacetCheck(int ifacet) const
 
 void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
 {
+   DeleteBVH();
    // Compute bounding box
    fDefined = true;
    fNvert = fVertices.size();
@@ -429,6 +664,163 @@ void TGeoTessellated::ComputeBBox()
       fOrigin[i] = 0.5 * (vmax[i] + vmin[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+TGeoTessellated::~TGeoTessellated()
+{
+   DeleteBVH();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the bounding volume hierarchy of the facets, building it if this is the first use
+
+void *TGeoTessellated::GetBVH() const
+{
+   void *bvh = fBVH.load(std::memory_order_acquire);
+   if (bvh)
+      return bvh;
+   std::lock_guard<std::mutex> lock(gFacetBVHMutex);
+   bvh = fBVH.load(std::memory_order_relaxed);
+   if (!bvh) {
+      bvh = BuildFacetBVH(*this);
+      fBVH.store(bvh, std::memory_order_release);
+   }
+   return bvh;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the bounding volume hierarchy of the facets, which is rebuilt on next use
+
+void TGeoTessellated::DeleteBVH()
+{
+   delete (FacetBVH *)fBVH.exchange(nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the normal to the closest facet, oriented along dir
+
+void TGeoTessellated::ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm)
+{
+   const auto &facets = *(const FacetBVH *)GetBVH();
+   int closest = -1;
+   if (!facets.fTriangles.empty())
+      SafetySqToTriangles(facets, point, closest);
+   if (closest < 0) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   const Vertex_t &normal = facets.fTriangles[closest].fNormal;
+   const double sign = (normal[0] * dir[0] + normal[1] * dir[1] + normal[2] * dir[2] < 0.) ? -1. : 1.;
+   for (int j = 0; j < 3; ++j)
+      norm[j] = sign * normal[j];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if the point is inside the solid, counting the facets crossed by a ray starting from it.
+/// When the ray passes too close to an edge, the test is repeated along another direction.
+
+Bool_t TGeoTessellated::Contains(const Double_t *point) const
+{
+   if (!TGeoBBox::Contains(point))
+      return kFALSE;
+   const auto &facets = *(const FacetBVH *)GetBVH();
+   if (facets.fTriangles.empty())
+      return kFALSE;
+   static constexpr double kDirs[3][3] = {{0.4082410136247861, 0.5345129562060230, 0.7400237661335651},
+                                          {-0.7014085303658127, 0.2897132827263866, 0.6512236845677311},
+                                          {0.2521460843788513, -0.8386069941446758, 0.4828671261372481}};
+   constexpr double kEdgeTolerance = 1.e-9;
+   const double tol = TGeoShape::Tolerance();
+   const Vertex_t pt(point[0], point[1], point[2]);
+   bool inside = false;
+   for (const auto &dir : kDirs) {
+      const Vertex_t dr(dir[0], dir[1], dir[2]);
+      BVHRay ray(BVHVec3(point[0], point[1], point[2]), BVHVec3(dir[0], dir[1], dir[2]), -tol);
+      int ncrossings = 0;
+      bool ambiguous = false;
+      bool onsurface = false;
+      static thread_local bvh::v2::GrowingStack<BVH::Index> stack;
+      stack.clear();
+      facets.fBVH.intersect<false, true>(ray, facets.fBVH.get_root().index, stack, [&](size_t begin, size_t end) {
+         for (size_t i = begin; i < end; ++i) {
+            double t, u, v;
+            if (!IntersectTriangle(facets.fTriangles[i], pt, dr, t, u, v) || t < -tol)
+               continue;
+            if (t <= tol)
+               onsurface = true;
+            if (u < kEdgeTolerance || v < kEdgeTolerance || u + v > 1. - kEdgeTolerance)
+               ambiguous = true;
+            ncrossings++;
+         }
+         return false;
+      });
+      if (onsurface)
+         return kTRUE;
+      inside = (ncrossings % 2) == 1;
+      if (!ambiguous)
+         break;
+   }
+   return inside;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from inside point to the surface of the solid
+
+Double_t TGeoTessellated::DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                         Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kTRUE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   const auto &facets = *(const FacetBVH *)GetBVH();
+   if (facets.fTriangles.empty())
+      return TGeoBBox::DistFromInside(point, dir, iact, step, safe);
+   const double dist = DistanceToTriangles(facets, point, dir, false, TGeoShape::Big());
+   // the point is outside
+   if (dist >= TGeoShape::Big())
+      return 0.;
+   return dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from outside point to the surface of the solid
+
+Double_t TGeoTessellated::DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                          Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kFALSE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   // fast rejection of the rays missing the bounding box
+   if (TGeoBBox::DistFromOutside(point, dir, fDX, fDY, fDZ, fOrigin, step) >= TGeoShape::Big())
+      return TGeoShape::Big();
+   const auto &facets = *(const FacetBVH *)GetBVH();
+   if (facets.fTriangles.empty())
+      return TGeoShape::Big();
+   return DistanceToTriangles(facets, point, dir, true, step);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the closest distance from given point to the surface of the solid
+
+Double_t TGeoTessellated::Safety(const Double_t *point, Bool_t in) const
+{
+   const auto &facets = *(const FacetBVH *)GetBVH();
+   if (facets.fTriangles.empty())
+      return TGeoBBox::Safety(point, in);
+   int closest = -1;
+   return TMath::Sqrt(SafetySqToTriangles(facets, point, closest));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns numbers of vertices, segments and polygons composing the shape mesh.
 
@@ -537,6 +929,7 @@ void TGeoTessellated::ResizeCenter(double maxsize)
       fVertices[i] = scale * (fVertices[i] - origin);
    }
    fOrigin[0] = fOrigin[1] = fOrigin[2] = 0;
+   DeleteBVH();
    fDX *= scale;
    fDY *= scale;
    fDZ *= scale;
@@ -19,6 +19,19 @@ Full description with examples and pictures
 \image html geom_t_finder.png
 \image html geom_t_voxelfind.png
 \image html geom_t_voxtree.png
+
+For volumes with many daughters (e.g. calorimeter cells), the slices scale badly
+since the candidate lists of the crossed voxels get long. A bounding volume
+hierarchy (BVH) of the daughter boxes can then be built in addition, for the
+volumes having at least a given number of daughters:
+
+~~~{.cpp}
+TGeoVoxelFinder::SetBVHThreshold(1000); // before closing the geometry
+~~~
+
+The navigator then uses the BVH to select the candidates in FindNextBoundary
+and Safety. The BVH is built with the surface area heuristic when voxelizing
+the volume, in parallel if implicit multi-threading is enabled.
 */
 
 #include "TGeoVoxelFinder.h"
@@ -30,9 +43,36 @@ Full description with examples and pictures
 #include "TGeoNode.h"
 #include "TGeoManager.h"
 #include "TGeoStateInfo.h"
+#include "TROOT.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <bvh/v2/bvh.h>
+#include <bvh/v2/vec.h>
+#include <bvh/v2/ray.h>
+#include <bvh/v2/node.h>
+#include <bvh/v2/stack.h>
+#include <bvh/v2/default_builder.h>
+#include <bvh/v2/thread_pool.h>
+
+namespace {
+using BVHScalar = float;
+using BVHVec3 = bvh::v2::Vec<BVHScalar, 3>;
+using BVHBBox = bvh::v2::BBox<BVHScalar, 3>;
+using BVHNode = bvh::v2::Node<BVHScalar, 3>;
+using BVH = bvh::v2::Bvh<BVHNode>;
+using BVHRay = bvh::v2::Ray<BVHScalar, 3>;
+} // namespace
 
 ClassImp(TGeoVoxelFinder);
 
+Int_t TGeoVoxelFinder::fgBVHThreshold = 0;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor
 
@@ -71,6 +111,7 @@ TGeoVoxelFinder::TGeoVoxelFinder()
    fNsliceX = nullptr;
    fNsliceY = nullptr;
    fNsliceZ = nullptr;
+   fBVH = nullptr;
    memset(fPriority, 0, 3 * sizeof(Int_t));
    SetInvalid(kFALSE);
 }
@@ -117,6 +158,7 @@ TGeoVoxelFinder::TGeoVoxelFinder(TGeoVolume *vol)
    fNsliceX = nullptr;
    fNsliceY = nullptr;
    fNsliceZ = nullptr;
+   fBVH = nullptr;
    memset(fPriority, 0, 3 * sizeof(Int_t));
    SetNeedRebuild();
 }
@@ -168,6 +210,7 @@ TGeoVoxelFinder::~TGeoVoxelFinder()
    if (fExtraZ)
       delete[] fExtraZ;
    //   printf("IndX IndY IndZ...\n");
+   DeleteBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -233,6 +276,175 @@ void TGeoVoxelFinder::BuildVoxelLimits()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the bounding volume hierarchy of the daughter boxes computed by BuildVoxelLimits.
+/// The boxes are enlarged to single precision, so that the BVH never misses a daughter;
+/// the candidates it returns are then checked against the exact boxes.
+
+void TGeoVoxelFinder::BuildBVH()
+{
+   Int_t nd = fVolume->GetNdaughters();
+   if (!nd || !fBoxes)
+      return;
+   std::vector<BVHBBox> bboxes(nd);
+   std::vector<BVHVec3> centers(nd);
+   for (Int_t id = 0; id < nd; id++) {
+      for (Int_t j = 0; j < 3; j++) {
+         Double_t xmin = fBoxes[6 * id + 3 + j] - fBoxes[6 * id + j];
+         Double_t xmax = fBoxes[6 * id + 3 + j] + fBoxes[6 * id + j];
+         Double_t margin = 1E-3 + 1E-6 * TMath::Max(TMath::Abs(xmin), TMath::Abs(xmax));
+         bboxes[id].min[j] = xmin - margin;
+         bboxes[id].max[j] = xmax + margin;
+      }
+      centers[id] = bboxes[id].get_center();
+   }
+   typename bvh::v2::DefaultBuilder<BVHNode>::Config config;
+   config.quality = bvh::v2::DefaultBuilder<BVHNode>::Quality::High;
+   BVH *bvhptr = nullptr;
+   if (ROOT::IsImplicitMTEnabled() && size_t(nd) >= config.parallel_threshold) {
+      bvh::v2::ThreadPool pool(ROOT::GetThreadPoolSize());
+      bvhptr = new BVH(bvh::v2::DefaultBuilder<BVHNode>::build(pool, bboxes, centers, config));
+   } else {
+      bvhptr = new BVH(bvh::v2::DefaultBuilder<BVHNode>::build(bboxes, centers, config));
+   }
+   fBVH = bvhptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the bounding volume hierarchy, if any.
+
+void TGeoVoxelFinder::DeleteBVH()
+{
+   delete (BVH *)fBVH;
+   fBVH = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the daughters having their bounding box crossed by the segment starting in POINT
+/// along DIR, within STEPMAX, ordered by the distance to their box. Uses the BVH, which
+/// must have been built. The list is stored in the state info.
+
+Int_t *TGeoVoxelFinder::GetBVHNextCandidates(const Double_t *point, const Double_t *dir, Double_t stepmax,
+                                             Int_t &ncheck, TGeoStateInfo &td) const
+{
+   ncheck = 0;
+   if (NeedRebuild()) {
+      TGeoVoxelFinder *vox = (TGeoVoxelFinder *)this;
+      vox->Voxelize();
+      fVolume->FindOverlaps();
+   }
+   auto mybvh = (BVH *)fBVH;
+   if (!mybvh)
+      return nullptr;
+   static thread_local std::vector<std::pair<Double_t, Int_t>> candidates;
+   candidates.clear();
+   const Double_t tol = TGeoShape::Tolerance();
+   // distance to the box of a daughter along the segment, or -1 if not crossed
+   auto distToBox = [&](Int_t id) {
+      Double_t tmin = 0;
+      Double_t tmax = stepmax;
+      for (Int_t j = 0; j < 3; j++) {
+         Double_t dx = fBoxes[6 * id + j] + tol;
+         Double_t p = point[j] - fBoxes[6 * id + 3 + j];
+         if (dir[j] == 0) {
+            if (TMath::Abs(p) > dx)
+               return -1.;
+            continue;
+         }
+         Double_t invdir = 1. / dir[j];
+         Double_t t1 = (-dx - p) * invdir;
+         Double_t t2 = (dx - p) * invdir;
+         tmin = TMath::Max(tmin, TMath::Min(t1, t2));
+         tmax = TMath::Min(tmax, TMath::Max(t1, t2));
+         if (tmin > tmax)
+            return -1.;
+      }
+      return tmin;
+   };
+   // the end of the ray is rounded up in single precision
+   Float_t tend = stepmax;
+   if (tend < stepmax)
+      tend = std::nextafter(tend, std::numeric_limits<Float_t>::max());
+   BVHRay ray(BVHVec3(point[0], point[1], point[2]), BVHVec3(dir[0], dir[1], dir[2]), 0.f, tend);
+   bvh::v2::GrowingStack<BVH::Index> stack;
+   mybvh->intersect<false, true>(ray, mybvh->get_root().index, stack, [&](size_t begin, size_t end) {
+      for (size_t prim_id = begin; prim_id < end; ++prim_id) {
+         Int_t id = mybvh->prim_ids[prim_id];
+         Double_t dist = distToBox(id);
+         if (dist >= 0)
+            candidates.emplace_back(dist, id);
+      }
+      return false; // all crossed boxes are needed
+   });
+   std::sort(candidates.begin(), candidates.end());
+   for (const auto &candidate : candidates)
+      td.fVoxCheckList[ncheck++] = candidate.second;
+   td.fVoxNcandidates = ncheck;
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the daughters having their bounding box closer than SAFMAX to POINT, ordered by
+/// the distance to their box. Uses the BVH, which must have been built. The list is stored
+/// in the state info.
+
+Int_t *TGeoVoxelFinder::GetBVHSafetyCandidates(const Double_t *point, Double_t safmax, Int_t &ncheck,
+                                               TGeoStateInfo &td) const
+{
+   ncheck = 0;
+   if (NeedRebuild()) {
+      TGeoVoxelFinder *vox = (TGeoVoxelFinder *)this;
+      vox->Voxelize();
+      fVolume->FindOverlaps();
+   }
+   auto mybvh = (BVH *)fBVH;
+   if (!mybvh)
+      return nullptr;
+   static thread_local std::vector<std::pair<Double_t, Int_t>> candidates;
+   candidates.clear();
+   const Double_t safmax2 = safmax * safmax;
+   // squared distance from the point to a box given by its limits
+   auto distToBox2 = [&](const auto *bmin, const auto *bmax) {
+      Double_t rsq = 0;
+      for (Int_t j = 0; j < 3; j++) {
+         Double_t d = TMath::Max(Double_t(bmin[j]) - point[j], point[j] - Double_t(bmax[j]));
+         if (d > 0)
+            rsq += d * d;
+      }
+      return rsq;
+   };
+   auto closeNode = [&](const BVHNode &node) {
+      auto bbox = node.get_bbox();
+      return distToBox2(&bbox.min[0], &bbox.max[0]) < safmax2;
+   };
+   auto leaf_fn = [&](size_t begin, size_t end) {
+      for (size_t prim_id = begin; prim_id < end; ++prim_id) {
+         Int_t id = mybvh->prim_ids[prim_id];
+         Double_t bmin[3], bmax[3];
+         for (Int_t j = 0; j < 3; j++) {
+            bmin[j] = fBoxes[6 * id + 3 + j] - fBoxes[6 * id + j];
+            bmax[j] = fBoxes[6 * id + 3 + j] + fBoxes[6 * id + j];
+         }
+         Double_t rsq = distToBox2(bmin, bmax);
+         if (rsq < safmax2)
+            candidates.emplace_back(rsq, id);
+      }
+      return false; // all close boxes are needed
+   };
+   const auto &root = mybvh->get_root();
+   if (closeNode(root)) {
+      bvh::v2::GrowingStack<BVH::Index> stack;
+      mybvh->traverse_top_down<false>(root.index, stack, leaf_fn, [&](const BVHNode &left, const BVHNode &right) {
+         return std::make_tuple(closeNode(left), closeNode(right), false);
+      });
+   }
+   std::sort(candidates.begin(), candidates.end());
+   for (const auto &candidate : candidates)
+      td.fVoxCheckList[ncheck++] = candidate.second;
+   td.fVoxNcandidates = ncheck;
+   return td.fVoxCheckList;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// convert a point from the local reference system of node id to reference
 /// system of mother volume
@@ -2429,6 +2641,9 @@ void TGeoVoxelFinder::Voxelize(Option_t * /*option*/)
    }
    BuildVoxelLimits();
    SortAll();
+   DeleteBVH();
+   if (fgBVHThreshold > 0 && nd >= fgBVHThreshold)
+      BuildBVH();
    SetNeedRebuild(kFALSE);
 }
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <TGeoBBox.h>
+#include <TGeoManager.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+// The vectorized navigation methods of TGeoBBox must give the same results as the
+// scalar ones, for random points and directions, points on the surface, tracks
+// parallel to a face and tracks along an axis.
+
+namespace {
+
+struct Tracks {
+   std::vector<Double_t> fPoints;
+   std::vector<Double_t> fDirs;
+   std::vector<Double_t> fSteps;
+};
+
+Tracks MakeTracks(const TGeoBBox &box, int n, unsigned int seed)
+{
+   std::mt19937 gen(seed);
+   std::uniform_real_distribution<double> uniform(-1.5, 1.5);
+   std::normal_distribution<double> gaus;
+   const Double_t d[3] = {box.GetDX(), box.GetDY(), box.GetDZ()};
+   const Double_t *origin = box.GetOrigin();
+
+   Tracks tracks;
+   for (int i = 0; i < n; ++i) {
+      Double_t point[3], dir[3];
+      for (int j = 0; j < 3; ++j) {
+         point[j] = uniform(gen) * d[j];
+         dir[j] = gaus(gen);
+      }
+      const int axis = i % 3;
+      switch (i % 4) {
+      case 1: // on a face
+         point[axis] = uniform(gen) > 0 ? d[axis] : -d[axis];
+         break;
+      case 2: // parallel to a face
+         dir[axis] = 0;
+         break;
+      case 3: // along an axis
+         for (int j = 0; j < 3; ++j)
+            dir[j] = (j == axis) ? (uniform(gen) > 0 ? 1 : -1) : 0;
+         break;
+      }
+      const Double_t norm = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+      for (int j = 0; j < 3; ++j) {
+         tracks.fPoints.push_back(origin[j] + point[j]);
+         tracks.fDirs.push_back(dir[j] / norm);
+      }
+      // a short step now and then, to exercise the early return of DistFromOutside
+      tracks.fSteps.push_back(i % 5 == 0 ? 0.1 * d[0] : TGeoShape::Big());
+   }
+   return tracks;
+}
+
+void ExpectSameDistance(Double_t dist, Double_t ref, int i)
+{
+   if (ref >= TGeoShape::Big()) {
+      EXPECT_EQ(dist, ref) << "track " << i;
+   } else {
+      EXPECT_DOUBLE_EQ(dist, ref) << "track " << i;
+   }
+}
+
+void CompareWithScalar(const TGeoBBox &box)
+{
+   const int n = 20000;
+   Tracks tracks = MakeTracks(box, n, 4357);
+   const Double_t *points = tracks.fPoints.data();
+   const Double_t *dirs = tracks.fDirs.data();
+
+   std::unique_ptr<Bool_t[]> inside(new Bool_t[n]);
+   box.Contains_v(points, inside.get(), n);
+   int nInside = 0;
+   for (int i = 0; i < n; ++i) {
+      EXPECT_EQ(inside[i], box.Contains(&points[3 * i])) << "track " << i;
+      nInside += inside[i];
+   }
+   // the sample has points inside and outside
+   EXPECT_GT(nInside, n / 10);
+   EXPECT_LT(nInside, n - n / 10);
+
+   std::vector<Double_t> dists(n);
+   box.DistFromInside_v(points, dirs, dists.data(), n, tracks.fSteps.data());
+   for (int i = 0; i < n; ++i) {
+      if (inside[i])
+         ExpectSameDistance(dists[i], box.DistFromInside(&points[3 * i], &dirs[3 * i], 3, tracks.fSteps[i]), i);
+   }
+
+   box.DistFromOutside_v(points, dirs, dists.data(), n, tracks.fSteps.data());
+   for (int i = 0; i < n; ++i)
+      ExpectSameDistance(dists[i], box.DistFromOutside(&points[3 * i], &dirs[3 * i], 3, tracks.fSteps[i]), i);
+
+   box.Safety_v(points, inside.get(), dists.data(), n);
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(dists[i], box.Safety(&points[3 * i], inside[i])) << "track " << i;
+}
+
+} // namespace
+
+TEST(Geometry, BBoxVectorized)
+{
+   TGeoBBox box("bbox_vectorized", 2., 3., 0.5);
+   CompareWithScalar(box);
+}
+
+TEST(Geometry, BBoxVectorizedOrigin)
+{
+   Double_t origin[3] = {1., -2., 0.25};
+   TGeoBBox box("bbox_vectorized_origin", 2., 3., 0.5, origin);
+   CompareWithScalar(box);
+}
@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+
+#include <TGeoManager.h>
+#include <TGeoTessellated.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+// The navigation methods of TGeoTessellated are checked against the analytic results for
+// the cube [-1, 1]^3, with its faces divided in 10 x 10 quadrilaterals (1200 triangles).
+// Many of the points and directions are chosen so that the tracks cross the facets on
+// their edges.
+
+namespace {
+
+using Vertex_t = Tessellated::Vertex_t;
+
+const int kDivisions = 10;
+const double kTolerance = 1.e-9;
+
+double Grid(int i)
+{
+   return -1. + 2. * i / kDivisions;
+}
+
+// the facets are oriented with their normals pointing outwards or inwards
+std::unique_ptr<TGeoTessellated> MakeCube(bool outwards)
+{
+   auto cube = std::make_unique<TGeoTessellated>("tessellated_cube");
+   for (int axis = 0; axis < 3; ++axis) {
+      const int u = (axis + 1) % 3;
+      const int v = (axis + 2) % 3;
+      for (double side : {-1., 1.}) {
+         auto corner = [&](int i, int j) {
+            double p[3];
+            p[axis] = side;
+            p[u] = Grid(i);
+            p[v] = Grid(j);
+            return Vertex_t(p[0], p[1], p[2]);
+         };
+         for (int i = 0; i < kDivisions; ++i) {
+            for (int j = 0; j < kDivisions; ++j) {
+               // counter-clockwise seen from the positive side of the axis
+               if ((side > 0) == outwards) {
+                  cube->AddFacet(corner(i, j), corner(i + 1, j), corner(i + 1, j + 1), corner(i, j + 1));
+               } else {
+                  cube->AddFacet(corner(i, j), corner(i, j + 1), corner(i + 1, j + 1), corner(i + 1, j));
+               }
+            }
+         }
+      }
+   }
+   cube->CloseShape(true, true, false);
+   return cube;
+}
+
+bool InCube(const double *p)
+{
+   return std::abs(p[0]) <= 1. && std::abs(p[1]) <= 1. && std::abs(p[2]) <= 1.;
+}
+
+double SafetyCube(const double *p, bool in)
+{
+   if (in)
+      return std::min({1. - std::abs(p[0]), 1. - std::abs(p[1]), 1. - std::abs(p[2])});
+   double dsq = 0.;
+   for (int j = 0; j < 3; ++j) {
+      const double d = std::max(0., std::abs(p[j]) - 1.);
+      dsq += d * d;
+   }
+   return std::sqrt(dsq);
+}
+
+// distance to exit the cube from an inside point
+double DistFromInsideCube(const double *p, const double *d)
+{
+   double dist = TGeoShape::Big();
+   for (int j = 0; j < 3; ++j) {
+      if (d[j] != 0.)
+         dist = std::min(dist, ((d[j] > 0. ? 1. : -1.) - p[j]) / d[j]);
+   }
+   return dist;
+}
+
+// distance to enter the cube from an outside point (slab method); the rays passing too close
+// to an edge of the cube, for which tessellated and analytic results may differ, are flagged
+double DistFromOutsideCube(const double *p, const double *d, bool &grazing)
+{
+   double tmin = -TGeoShape::Big();
+   double tmax = TGeoShape::Big();
+   grazing = false;
+   for (int j = 0; j < 3; ++j) {
+      if (d[j] == 0.) {
+         if (std::abs(p[j]) > 1.)
+            return TGeoShape::Big();
+         continue;
+      }
+      const double t1 = (-1. - p[j]) / d[j];
+      const double t2 = (1. - p[j]) / d[j];
+      tmin = std::max(tmin, std::min(t1, t2));
+      tmax = std::min(tmax, std::max(t1, t2));
+   }
+   grazing = std::abs(tmax - tmin) < 1.e-6;
+   if (tmin > tmax || tmax < 0.)
+      return TGeoShape::Big();
+   return tmin;
+}
+
+struct Track {
+   double fPoint[3];
+   double fDir[3];
+};
+
+Track MakeTrack(int i, std::mt19937 &gen)
+{
+   std::uniform_real_distribution<double> uniform(-1.5, 1.5);
+   std::uniform_int_distribution<int> line(1, kDivisions - 1);
+   std::normal_distribution<double> gaus;
+   const int axis = i % 3;
+   const int u = (axis + 1) % 3;
+   const int v = (axis + 2) % 3;
+   const double side = (i / 3) % 2 ? 1. : -1.;
+
+   Track track;
+   double *p = track.fPoint;
+   double *d = track.fDir;
+   for (int j = 0; j < 3; ++j) {
+      p[j] = uniform(gen);
+      d[j] = gaus(gen);
+   }
+   switch (i % 5) {
+   case 1: // along an axis, through the vertices shared by several facets
+      p[u] = Grid(line(gen));
+      p[v] = Grid(line(gen));
+      for (int j = 0; j < 3; ++j)
+         d[j] = (j == axis) ? side : 0.;
+      break;
+   case 2: // the track goes through an edge, from the inside
+   case 3: // or from the outside, through the face it is in front of
+   {
+      if (i % 5 == 2) {
+         for (int j = 0; j < 3; ++j)
+            p[j] /= 1.5;
+      } else {
+         p[axis] = side * (1. + std::abs(uniform(gen)) / 3. + 0.01);
+      }
+      double target[3];
+      target[axis] = side;
+      target[u] = Grid(line(gen));
+      target[v] = uniform(gen) / 1.5;
+      for (int j = 0; j < 3; ++j)
+         d[j] = target[j] - p[j];
+      break;
+   }
+   case 4: // parallel to a face
+      d[axis] = 0.;
+      break;
+   }
+   const double norm = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+   for (int j = 0; j < 3; ++j)
+      d[j] /= norm;
+   return track;
+}
+
+void CompareWithCube(TGeoTessellated &cube)
+{
+   const int n = 20000;
+   std::mt19937 gen(4357);
+   int nInside = 0;
+   for (int i = 0; i < n; ++i) {
+      const Track track = MakeTrack(i, gen);
+      const double *p = track.fPoint;
+      const double *d = track.fDir;
+      const bool in = InCube(p);
+      nInside += in;
+
+      ASSERT_EQ(cube.Contains(p), in) << "track " << i;
+      EXPECT_NEAR(cube.Safety(p, in), SafetyCube(p, in), kTolerance) << "track " << i;
+      if (in) {
+         const double dist = DistFromInsideCube(p, d);
+         EXPECT_NEAR(cube.DistFromInside(p, d, 3), dist, kTolerance) << "track " << i;
+
+         // normal at the exit point, away from the edges of the cube
+         double exit[3], norm[3];
+         int nfaces = 0;
+         for (int j = 0; j < 3; ++j) {
+            exit[j] = p[j] + dist * d[j];
+            nfaces += std::abs(exit[j]) > 1. - 1.e-6;
+         }
+         if (nfaces == 1) {
+            cube.ComputeNormal(exit, d, norm);
+            for (int j = 0; j < 3; ++j) {
+               const double expected = (std::abs(exit[j]) > 1. - 1.e-6) ? (d[j] > 0. ? 1. : -1.) : 0.;
+               EXPECT_NEAR(norm[j], expected, kTolerance) << "track " << i;
+            }
+         }
+      } else {
+         bool grazing = false;
+         const double dist = DistFromOutsideCube(p, d, grazing);
+         if (!grazing) {
+            const double tdist = cube.DistFromOutside(p, d, 3);
+            if (dist >= TGeoShape::Big()) {
+               EXPECT_GE(tdist, TGeoShape::Big()) << "track " << i;
+            } else {
+               EXPECT_NEAR(tdist, dist, kTolerance) << "track " << i;
+            }
+         }
+      }
+   }
+   // the sample has points inside and outside
+   EXPECT_GT(nInside, n / 10);
+   EXPECT_LT(nInside, n - n / 10);
+}
+
+} // namespace
+
+TEST(Geometry, TessellatedCube)
+{
+   auto cube = MakeCube(true);
+   EXPECT_EQ(cube->GetNfacets(), 6 * kDivisions * kDivisions);
+   EXPECT_TRUE(cube->IsClosedBody());
+   CompareWithCube(*cube);
+}
+
+TEST(Geometry, TessellatedCubeInwardFacets)
+{
+   auto cube = MakeCube(false);
+   EXPECT_TRUE(cube->IsClosedBody());
+   CompareWithCube(*cube);
+}
+
+TEST(Geometry, TessellatedResize)
+{
+   auto cube = MakeCube(true);
+   const double inner[3] = {0.9, 0., 0.};
+   const double outer[3] = {1.5, 0., 0.};
+   const double dir[3] = {-1., 0., 0.};
+   EXPECT_TRUE(cube->Contains(inner));
+   EXPECT_FALSE(cube->Contains(outer));
+
+   // the hierarchy of the facets is rebuilt for the new size
+   cube->ResizeCenter(2.);
+   EXPECT_TRUE(cube->Contains(outer));
+   const double far[3] = {3., 0., 0.};
+   EXPECT_NEAR(cube->DistFromOutside(far, dir, 3), 1., kTolerance);
+   EXPECT_NEAR(cube->Safety(outer, kTRUE), 0.5, kTolerance);
+}
+
+TEST(Geometry, TessellatedVectorized)
+{
+   // the vectorized methods of the box fall back to the ones of the tessellated solid
+   auto cube = MakeCube(true);
+   const int n = 1000;
+   std::mt19937 gen(17);
+   std::vector<double> points, dirs, steps(n, TGeoShape::Big());
+   for (int i = 0; i < n; ++i) {
+      const Track track = MakeTrack(i, gen);
+      points.insert(points.end(), track.fPoint, track.fPoint + 3);
+      dirs.insert(dirs.end(), track.fDir, track.fDir + 3);
+   }
+   std::unique_ptr<Bool_t[]> inside(new Bool_t[n]);
+   std::vector<double> dists(n);
+   cube->Contains_v(points.data(), inside.get(), n);
+   cube->DistFromOutside_v(points.data(), dirs.data(), dists.data(), n, steps.data());
+   for (int i = 0; i < n; ++i) {
+      EXPECT_EQ(inside[i], cube->Contains(&points[3 * i]));
+      EXPECT_EQ(dists[i], cube->DistFromOutside(&points[3 * i], &dirs[3 * i], 3, steps[i]));
+   }
+}
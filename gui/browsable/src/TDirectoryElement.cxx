@@ -24,8 +24,8 @@
 #include "TClass.h"
 #include "TEnv.h"
 
-#include <cstring>
 #include <string>
+#include <unordered_map>
 
 using namespace std::string_literals;
 
@@ -47,6 +47,7 @@ class TDirectoryLevelIter : public RLevelIter {
    TKey *fKey{nullptr};               ///<! currently selected key
    TObject *fObj{nullptr};            ///<! currently selected object
    std::string fCurrentName;          ///<! current key name
+   std::unordered_map<std::string, Short_t> fLastCycles; ///<! highest cycle of every key name, used with fOnlyLastCycle
 
    bool CreateIter()
    {
@@ -54,6 +55,16 @@ class TDirectoryLevelIter : public RLevelIter {
       fObj = nullptr;
       fKey = nullptr;
       auto lst = fDir->GetListOfKeys();
+      fLastCycles.clear();
+      if (fOnlyLastCycle) {
+         // collect cycles once, checking every key against all others is quadratic in the number of keys
+         TIter iter(lst);
+         while (auto key = dynamic_cast<TKey *>(iter())) {
+            auto &cycle = fLastCycles[key->GetName()];
+            if (key->GetCycle() > cycle)
+               cycle = key->GetCycle();
+         }
+      }
       if (lst->GetSize() == 0) {
          auto olst = fDir->GetList();
          if (olst->GetSize() > 0) {
@@ -112,17 +123,8 @@ class TDirectoryLevelIter : public RLevelIter {
 
          if (!fOnlyLastCycle) break;
 
-         TIter iter(fDir->GetListOfKeys());
-         TKey *key = nullptr;
-         bool found_newer = false;
-         while ((key = dynamic_cast<TKey*>(iter())) != nullptr) {
-            if ((key != fKey) && !strcmp(key->GetName(), fKey->GetName()) && (key->GetCycle() > fKey->GetCycle())) {
-               found_newer = true;
-               break;
-            }
-         }
-
-         if (!found_newer) break;
+         auto entry = fLastCycles.find(fKey->GetName());
+         if ((entry == fLastCycles.end()) || (entry->second <= fKey->GetCycle())) break;
 
          fObj = fIter->Next();
       }
@@ -29,6 +29,7 @@ public:
    std::vector<std::string> path;     ///< reply path
    int nchilds{0};                    ///< total number of childs in the node
    int first{0};                      ///< first node in returned list
+   bool more{false};                  ///< not all childs are listed yet, further ones can be requested with "unsorted" pages
    std::vector<const Browsable::RItem *> nodes; ///< list of pointers, no ownership!
 };
 
@@ -189,21 +189,42 @@ bool RBrowserData::ProcessBrowserRequest(const RBrowserRequest &request, RBrowse
       ResetLastRequestData(false);
    }
 
+   // unsorted page without filter only requires childs up to the end of the page,
+   // any other request requires all childs, but not more than kMaxItems
+   const std::size_t kMaxItems = 10000;
+   bool paged = (request.sort == "unsorted") && request.regex.empty() && (request.number > 0);
+   std::size_t required = paged ? request.first + request.number : kMaxItems;
+
+   auto is_visible = [&request](const std::unique_ptr<Browsable::RItem> &item) {
+      return item && (request.hidden || !item->IsHidden());
+   };
+
+   std::size_t nvisible = paged ? std::count_if(fLastItems.begin(), fLastItems.end(), is_visible) : fLastItems.size();
+
    // when request childs, always try to make elements
-   if (fLastItems.empty()) {
+   if (!fLastAllChilds && (nvisible < required)) {
 
       auto iter = fLastElement->GetChildsIter();
 
       if (!iter) return false;
-      int id = 0;
-      fLastAllChilds = true;
 
-      while (iter->Next() && fLastAllChilds) {
-         fLastItems.emplace_back(iter->CreateItem());
-         if (id++ > 10000)
-            fLastAllChilds = false;
+      // iterator is not kept between requests, skip childs already created before
+      bool more = true;
+      for (std::size_t n = 0; more && (n < fLastItems.size()); ++n)
+         more = iter->Next();
+
+      while (more && (nvisible < required)) {
+         more = iter->Next();
+         if (more) {
+            fLastItems.emplace_back(iter->CreateItem());
+            if (!paged || is_visible(fLastItems.back()))
+               nvisible++;
+         }
       }
 
+      if (!more)
+         fLastAllChilds = true;
+
       fLastSortedItems.clear();
       fLastSortMethod.clear();
    }
@@ -259,6 +280,7 @@ bool RBrowserData::ProcessBrowserRequest(const RBrowserRequest &request, RBrowse
 
    reply.first = request.first;
    reply.nchilds = id; // total number of childs
+   reply.more = !fLastAllChilds;
 
    return true;
 }
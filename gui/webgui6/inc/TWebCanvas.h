@@ -60,6 +60,7 @@ protected:
       Long64_t fSendVersion{0};        ///<! canvas version send to the client
       Long64_t fDrawVersion{0};        ///<! canvas version drawn (confirmed) by client
       UInt_t fLastSendHash{0};         ///<! hash of last send draw message, avoid looping
+      Int_t fZipAlgorithm{0};          ///<! compression algorithm accepted by the client for snapshots, 0 - plain JSON
       std::map<std::string, std::string> fCtrl; ///<! different ctrl parameters which can be send at once
       std::queue<std::string> fSend;   ///<! send queue, processed after sending draw data
 
@@ -96,6 +97,8 @@ protected:
    Int_t fPaletteDelivery{1};      ///<! colors palette delivery 0:never, 1:once, 2:always, 3:per subpad
    Int_t fPrimitivesMerge{100};    ///<! number of PS primitives, which will be merged together
    Int_t fJsonComp{0};             ///<! compression factor for messages send to the client
+   Int_t fZipLevel{0};             ///<! compression level of snapshots for clients supporting it, 0 - never compress
+   Int_t fZipMinSize{0};           ///<! minimal JSON size of snapshot to compress
    Bool_t fCanCreateObjects{kTRUE}; ///<! indicates if canvas allowed to create extra objects for interactive painting
    Bool_t fLongerPolling{kFALSE};  ///<! when true, make longer polling in blocking operations
    Bool_t fProcessingData{kFALSE}; ///<! flag used to prevent blocking methods when process data is invoked
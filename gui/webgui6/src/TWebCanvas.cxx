@@ -54,6 +54,7 @@
 #include "TMath.h"
 #include "TTimer.h"
 #include "TThread.h"
+#include "RZip.h"
 
 #include <cstdio>
 #include <cstring>
@@ -108,6 +109,12 @@ Following settings parameters can be useful for TWebCanvas:
      WebGui.StyleDelivery:    1     provide gStyle object to JSROOT client (default - 1)
      WebGui.PaletteDelivery:  1     provide color palette to JSROOT client (default - 1)
      WebGui.TF1UseSave:       1     used saved values for function drawing: 0 - off, 1 - if client fail to evaluate function, 2 - always (default - 1)
+     WebGui.ZipLevel:         1     compression level of snapshots for clients announcing support of it, 0 - never compress (default - 1)
+     WebGui.ZipMinSize:   65536     minimal size of snapshot JSON to be compressed (default - 65536)
+
+Clients which announce with a `ZIP6:` message the compression algorithms they support (ROOT algorithm ids, separated by commas)
+get the large snapshots as binary `SNAP6Z:<version>:` messages, followed by the JSON compressed in ROOT blocks
+(same format as ROOT files). Other clients always get plain JSON.
 
 TWebCanvas is used by default in interactive ROOT session. To use web-based canvas in batch mode for image
 generation, one should explicitly specify `--web` option when starting ROOT:
@@ -135,6 +142,34 @@ struct WebFont_t {
 
 static std::vector<WebFont_t> gWebFonts;
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress data in ROOT blocks of maximal kMAXZIPBUF size, appending them to out
+/// Returns false if the data cannot be compressed
+
+static bool ZipData(const TString &data, int algorithm, int level, std::string &out)
+{
+   Int_t len = data.Length();
+   Int_t nbuffers = 1 + (len - 1) / kMAXZIPBUF;
+   auto start = out.length();
+   out.resize(start + len + 9 * nbuffers);
+   char *src = const_cast<char *>(data.Data());
+   char *tgt = &out[start];
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      Int_t srcsize = (i == nbuffers - 1) ? len - i * kMAXZIPBUF : kMAXZIPBUF;
+      Int_t tgtsize = srcsize + 9, nout = 0;
+      R__zipMultipleAlgorithm(level, &srcsize, src, &tgtsize, tgt, &nout,
+                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(algorithm));
+      if (nout <= 0) {
+         out.resize(start);
+         return false;
+      }
+      src += srcsize;
+      tgt += nout;
+   }
+   out.resize(tgt - out.data());
+   return true;
+}
+
 std::string TWebCanvas::gCustomScripts = {};
 std::vector<std::string> TWebCanvas::gCustomClasses = {};
 
@@ -197,6 +232,8 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fTF1UseSave = gEnv->GetValue("WebGui.TF1UseSave", (Int_t) 1);
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   fZipLevel = gEnv->GetValue("WebGui.ZipLevel", 1);
+   fZipMinSize = gEnv->GetValue("WebGui.ZipMinSize", 65536);
 
    fWebConn.emplace_back(0); // add special connection which only used to perform updates
 
@@ -1190,6 +1227,8 @@ void TWebCanvas::AddSendQueue(unsigned connid, const std::string &msg)
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// Check if any data should be send to client
 /// If connid != 0, only selected connection will be checked
+/// Clients which already got the same canvas version share the same snapshot, which is
+/// created and streamed only once
 
 Bool_t TWebCanvas::CheckDataToSend(unsigned connid)
 {
@@ -1198,6 +1237,11 @@ Bool_t TWebCanvas::CheckDataToSend(unsigned connid)
 
    bool isMoreData = false, isAnySend = false;
 
+   // JSON and hash of the snapshots created for the versions already send to the clients
+   std::map<Long64_t, std::pair<TString, UInt_t>> snapshots;
+   // compressed snapshots for the version and the compression algorithm
+   std::map<std::pair<Long64_t, Int_t>, std::string> zipped;
+
    for (auto &conn : fWebConn) {
 
       bool isConnData = !conn.fCtrl.empty() || !conn.fSend.empty() ||
@@ -1207,6 +1251,7 @@ Bool_t TWebCanvas::CheckDataToSend(unsigned connid)
          // check if any control messages still there to keep timer running
 
          std::string buf;
+         bool binary = false;
 
          if (!conn.fCtrl.empty()) {
             buf = "CTRL:"s + TBufferJSON::ToJSON(&conn.fCtrl, TBufferJSON::kMapAsObject + TBufferJSON::kNoSpaces);
@@ -1216,35 +1261,53 @@ Bool_t TWebCanvas::CheckDataToSend(unsigned connid)
             conn.fSend.pop();
          } else if ((conn.fCheckedVersion < fCanvVersion) && (conn.fSendVersion == conn.fDrawVersion)) {
 
-            buf = "SNAP6:"s + std::to_string(fCanvVersion) + ":"s;
+            auto snapshot = conn.is_batch() ? snapshots.end() : snapshots.find(conn.fSendVersion);
 
-            TCanvasWebSnapshot holder(IsReadOnly(), true, false); // readonly, set ids, batchmode
+            if (snapshot == snapshots.end()) {
+               TCanvasWebSnapshot holder(IsReadOnly(), true, false); // readonly, set ids, batchmode
 
-            holder.SetFixedSize(fFixedSize); // set fixed size flag
+               holder.SetFixedSize(fFixedSize); // set fixed size flag
 
-            // scripts send only when canvas drawn for the first time
-            if (!conn.fSendVersion)
-               holder.SetScripts(ProcessCustomScripts(false));
+               // scripts send only when canvas drawn for the first time
+               if (!conn.fSendVersion)
+                  holder.SetScripts(ProcessCustomScripts(false));
 
-            holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
+               holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
 
-            CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf, &conn, this](TPadWebSnapshot *snap) {
-               if (conn.is_batch()) {
+               auto store = [&snapshot, &snapshots, &conn, this](TPadWebSnapshot *snap) {
                   // for batch connection only calling of CreatePadSnapshot is important
-                  buf.clear();
-                  return;
-               }
+                  if (conn.is_batch())
+                     return;
+                  auto json = TBufferJSON::ToJSON(snap, fJsonComp);
+                  auto hash = json.Hash();
+                  snapshot = snapshots.emplace(conn.fSendVersion, std::make_pair(json, hash)).first;
+               };
+
+               CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, store);
+            }
 
-               auto json = TBufferJSON::ToJSON(snap, fJsonComp);
-               auto hash = json.Hash();
-               if (conn.fLastSendHash && (conn.fLastSendHash == hash) && conn.fSendVersion) {
-                  // prevent looping when same data send many times
-                  buf.clear();
-               } else {
-                  buf.append(json.Data());
+            if (snapshot != snapshots.end()) {
+               auto hash = snapshot->second.second;
+               // prevent looping when same data send many times
+               if (!conn.fLastSendHash || (conn.fLastSendHash != hash) || !conn.fSendVersion) {
+                  auto &json = snapshot->second.first;
+                  if (conn.fZipAlgorithm && (fZipLevel > 0) && (json.Length() >= fZipMinSize)) {
+                     auto &zbuf = zipped[std::make_pair(snapshot->first, conn.fZipAlgorithm)];
+                     if (zbuf.empty()) {
+                        zbuf = "SNAP6Z:"s + std::to_string(fCanvVersion) + ":"s;
+                        if (!ZipData(json, conn.fZipAlgorithm, fZipLevel, zbuf))
+                           zbuf = "-"; // not compressible, send as JSON
+                     }
+                     if (zbuf != "-") {
+                        buf = zbuf;
+                        binary = true;
+                     }
+                  }
+                  if (!binary)
+                     buf = "SNAP6:"s + std::to_string(fCanvVersion) + ":"s + json.Data();
                   conn.fLastSendHash = hash;
                }
-            });
+            }
 
             conn.fCheckedVersion = fCanvVersion;
 
@@ -1258,7 +1321,10 @@ Bool_t TWebCanvas::CheckDataToSend(unsigned connid)
          }
 
          if (!buf.empty() && !conn.is_batch()) {
-            fWindow->Send(conn.fConnId, buf);
+            if (binary)
+               fWindow->SendBinary(conn.fConnId, std::move(buf));
+            else
+               fWindow->Send(conn.fConnId, buf);
             isAnySend = true;
          }
       }
@@ -1832,6 +1898,23 @@ Bool_t TWebCanvas::ProcessData(unsigned connid, const std::string &arg)
                CheckCanvasModified();
       }
 
+   } else if (arg.compare(0, 5, "ZIP6:") == 0) {
+
+      // client announces compression algorithms it can decode, first supported one is used for snapshots
+      fWebConn[indx].fZipAlgorithm = 0;
+      auto arr = TString(cdata + 5).Tokenize(",");
+      for (Int_t n = 0; n <= arr->GetLast(); ++n) {
+         Int_t alg = TString(arr->At(n)->GetName()).Atoi();
+         if ((alg == ROOT::RCompressionSetting::EAlgorithm::kZLIB) || (alg == ROOT::RCompressionSetting::EAlgorithm::kLZ4) ||
+             (alg == ROOT::RCompressionSetting::EAlgorithm::kZSTD)) {
+            fWebConn[indx].fZipAlgorithm = alg;
+            break;
+         }
+      }
+      delete arr;
+      // confirm to the client which algorithm will be used
+      AddCtrlMsg(connid, "zip"s, std::to_string(fWebConn[indx].fZipAlgorithm));
+
    } else if (arg == "RELOAD") {
 
       // trigger reload of canvas data
@@ -64,6 +64,7 @@
 #pragma link C++ class TH1I+;
 #pragma link C++ class TH1K+;
 #pragma link C++ class TH1L+;
+#pragma link C++ class TH1Collection+;
 #pragma link C++ class TH2-;
 #pragma link C++ class TH2C-;
 #pragma link C++ class TH2D-;
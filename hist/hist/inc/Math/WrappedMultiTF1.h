@@ -19,6 +19,7 @@
 #include "TF1.h"
 #include <string>
 #include <vector>
+#include <type_traits>
 #include <algorithm>
 
 namespace ROOT {
@@ -160,6 +161,18 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function at n points passing their coordinates x one point after the other
+         /// and the vector of parameters, using TF1::EvalBatch
+         void DoEvalParBatch(unsigned int n, const T *x, const double *p, T *result) const override
+         {
+            if constexpr (std::is_same<T, double>::value) {
+               fFunc->EvalBatch(n, x, result, p);
+            } else {
+               for (unsigned int i = 0; i < n; ++i)
+                  result[i] = fFunc->EvalPar(x + i * fDim, p);
+            }
+         }
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
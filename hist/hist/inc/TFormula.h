@@ -107,6 +107,8 @@ private:
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   mutable std::string fBatchGenerationInput;      ///<! Input to Cling to generate the loop kernel of EvalBatch
+   mutable CallFuncSignature fBatchFuncPtr = nullptr; ///<! Function pointer, owned by the JIT.
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -131,6 +133,10 @@ private:
    std::string GetHessianFuncName() const {
       return std::string(GetUniqueFuncName().Data()) + "_hessian_1";
    }
+   std::string GetBatchFuncName() const {
+      return std::string(GetUniqueFuncName().Data()) + "_batch_" + std::to_string(fNdim);
+   }
+   bool GenerateBatchEval() const;
    bool HasGradientGenerationFailed() const {
       return !fGradFuncPtr && !fGradGenerationInput.empty();
    }
@@ -200,6 +206,7 @@ public:
    template <typename... Args>
    Double_t       Eval(Args... args) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params = nullptr) const;
+   void           EvalBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params = nullptr) const;
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
@@ -54,6 +54,7 @@ class TCollection;
 class TVirtualFFT;
 class TVirtualHistPainter;
 class TRandom;
+class TH1AtomicFill;
 
 
 class TH1 : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
@@ -84,6 +85,7 @@ public:
    };
 
    friend class TH1Merger;
+   friend class TH1AtomicFill;
 
 protected:
     Int_t         fNcells;          ///<  Number of bins(1D), cells (2D) +U/Overflows
@@ -110,6 +112,7 @@ protected:
     Int_t         fDimension;       ///<! Histogram dimension (1, 2 or 3 dim)
     Double_t     *fIntegral;        ///<! Integral of bins used by GetRandom
     TVirtualHistPainter *fPainter;  ///<! Pointer to histogram painter
+    TH1AtomicFill *fAtomicFill = nullptr; ///<! Atomic filling of the bins, in atomic fill mode only
     EBinErrorOpt  fBinStatErrOpt;   ///<  Option for bin statistical errors
     EStatOverflows fStatOverflows;  ///<  Per object flag to use under/overflows in statistics
     static Int_t  fgBufferSize;     ///<! Default buffer size for automatic histograms
@@ -149,6 +152,7 @@ protected:
                                Option_t * opt, Bool_t doerr = kFALSE) const;
 
    virtual void     DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
+           void     DoFillNFixBins(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride);
    Bool_t    GetStatOverflowsBehaviour() const { return EStatOverflows::kNeutral == fStatOverflows ? fgStatOverflows : EStatOverflows::kConsider == fStatOverflows; }
 
    static bool CheckAxisLimits(const TAxis* a1, const TAxis* a2);
@@ -335,6 +339,7 @@ public:
    virtual Double_t Interpolate(Double_t x, Double_t y, Double_t z) const;
            Bool_t   IsBinOverflow(Int_t bin, Int_t axis = 0) const;
            Bool_t   IsBinUnderflow(Int_t bin, Int_t axis = 0) const;
+           Bool_t   IsAtomicFill() const { return fAtomicFill != nullptr; }
    virtual Bool_t   IsHighlight() const { return TestBit(kIsHighlight); }
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Option_t *option="") const;
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Double_t &advalue) const;
@@ -379,6 +384,7 @@ public:
                             const Double_t *zBins);
    virtual void     SetBinsLength(Int_t = -1) { } //redefined in derived classes
    virtual void     SetBinErrorOption(EBinErrorOpt type) { fBinStatErrOpt = type; }
+           void     SetAtomicFill(Bool_t atomic = kTRUE);
    virtual void     SetBuffer(Int_t buffersize, Option_t *option="");
    virtual UInt_t   SetCanExtend(UInt_t extendBitMask);
    virtual void     SetContent(const Double_t *content);
@@ -0,0 +1,58 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TH1Collection
+#define ROOT_TH1Collection
+
+#include "TNamed.h"
+#include "TAxis.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TH1F;
+
+class TH1Collection : public TNamed {
+protected:
+   std::vector<TAxis>       fAxes;        ///<  Distinct axes of the histograms
+   std::vector<std::string> fNames;       ///<  Names of the histograms
+   std::vector<std::string> fTitles;      ///<  Titles of the histograms
+   std::vector<Int_t>       fAxis;        ///<  Index in fAxes of the axis of each histogram
+   std::vector<Long64_t>    fBegin;       ///<  Index in fContents of the first bin (underflow) of each histogram
+   std::vector<Float_t>     fContents;    ///<  Bin contents of all the histograms, underflows and overflows included
+   std::vector<Long64_t>    fSumw2Begin;  ///<  Index in fSumw2 of the first bin of each histogram, -1 if none
+   std::vector<Double_t>    fSumw2;       ///<  Sums of squares of weights of the histograms that have them
+   std::vector<Double_t>    fStats;       ///<  Entries, sumw, sumw2, sumwx and sumwx2 of each histogram
+   mutable std::unordered_map<std::string, Int_t> fIndex; ///<! Index of each histogram by name, built on demand
+
+   static constexpr Int_t kNstat = 5;     ///< Number of elements of fStats per histogram
+
+   Int_t FindAxis(const TAxis &axis) const;
+
+public:
+   TH1Collection() {}
+   TH1Collection(const char *name, const char *title);
+   ~TH1Collection() override;
+
+   Bool_t        Add(const TH1F &h);
+   void          Clear(Option_t *option = "") override;
+   TH1F         *Get(const char *name) const;
+   TH1F         *Get(Int_t i) const;
+   const char   *GetHistName(Int_t i) const { return fNames.at(i).c_str(); }
+   Int_t         GetIndex(const char *name) const;
+   Int_t         GetNaxes() const { return fAxes.size(); }
+   Int_t         GetSize() const { return fNames.size(); }
+   void          Print(Option_t *option = "") const override;
+
+   ClassDefOverride(TH1Collection, 1) // Collection of TH1F stored with shared axes and contiguous bin contents
+};
+
+#endif
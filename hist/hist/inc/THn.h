@@ -31,6 +31,7 @@ class THn: public THnBase {
 
 protected:
    void AllocCoordBuf() const;
+   void AllocSumw2();
    void InitStorage(Int_t* nbins, Int_t chunkSize) override;
 
    THn() = default;
@@ -85,10 +86,12 @@ public:
 
    /// Increment the bin content of "bin" by "w", return the bin index.
    void FillBin(Long64_t bin, Double_t w) override {
-      GetArray().AddAt(bin, w);
-      if (GetCalculateErrors()) {
+      if (GetCalculateErrors() && (w != 1. || fSumw2.IsAllocated())) {
+         if (!fSumw2.IsAllocated())
+            AllocSumw2();
          fSumw2.AddAt(bin, w * w);
       }
+      GetArray().AddAt(bin, w);
       FillBinBase(w);
    }
 
@@ -98,10 +101,14 @@ public:
       THnBase::SetBinContent(idx, v);
    }
    void SetBinContent(Long64_t bin, Double_t v) override {
+      if (GetCalculateErrors() && !fSumw2.IsAllocated())
+         AllocSumw2();
       GetArray().SetAsDouble(bin, v);
    }
    void SetBinError2(Long64_t bin, Double_t e2) override {
       if (!GetCalculateErrors()) Sumw2();
+      if (!fSumw2.IsAllocated())
+         AllocSumw2();
       fSumw2.At(bin) = e2;
    }
    /// Forwards to THnBase::SetBinContent().
@@ -110,9 +117,13 @@ public:
       THnBase::AddBinContent(idx, v);
    }
    void AddBinContent(Long64_t bin, Double_t v = 1.) override {
+      if (GetCalculateErrors() && !fSumw2.IsAllocated())
+         AllocSumw2();
       GetArray().AddAt(bin, v);
    }
    void AddBinError2(Long64_t bin, Double_t e2) override {
+      if (!fSumw2.IsAllocated())
+         AllocSumw2();
       fSumw2.At(bin) += e2;
    }
    /// Forwards to THnBase::GetBinContent() overload.
@@ -134,7 +145,7 @@ public:
       return GetArray().AtAsDouble(bin);
    }
    Double_t GetBinError2(Long64_t linidx) const override {
-      return GetCalculateErrors() ? fSumw2.At(linidx) : GetBinContent(linidx);
+      return GetCalculateErrors() && fSumw2.IsAllocated() ? fSumw2.At(linidx) : GetBinContent(linidx);
    }
 
    virtual const TNDArray& GetArray() const = 0;
@@ -177,7 +188,7 @@ public:
    void Reset(Option_t* option = "") override;
 
 protected:
-   TNDArrayT<Double_t> fSumw2; // bin error, lazy allocation happens in TNDArrayT
+   TNDArrayT<Double_t> fSumw2; // bin error; while not allocated, equal to the bin content
    mutable std::vector<Int_t> fCoordBuf; //! Temporary buffer
 
    ClassDefOverride(THn, 1); //Base class for multi-dimensional histogram
@@ -208,7 +219,8 @@ protected:
  We recommend to use THnC wherever possible, and to map its value space
  of 256 possible values to e.g. float values outside the class. This saves an
  enormous amount of memory. Only if more than 256 values need to be
- distinguished should e.g. THnS or even THnF be chosen.
+ distinguished should e.g. THnS or even THnF be chosen. Counts of unweighted
+ fills fit in a THnI, which takes half the memory of a THnD.
 
  Implementation detail: the derived, templated class is kept extremely small
  on purpose. That way the (templated thus inlined) uses of this class will
@@ -23,6 +23,8 @@
 
 #include "TObject.h"
 
+#include <vector>
+
 class TBrowser;
 class TH1;
 class THnSparse;
@@ -52,7 +54,7 @@ class THnSparseArrayChunk: public TObject {
    void AddBinContent(Int_t idx, Double_t v = 1.) {
       fContent->SetAt(v + fContent->GetAt(idx), idx);
       if (fSumw2)
-         fSumw2->SetAt(v * v + fSumw2->GetAt(idx), idx);
+         fSumw2->fArray[idx] += v * v;
    }
    void Sumw2();
    Int_t GetEntries() const { return fCoordinatesSize / fSingleCoordinateSize; }
@@ -66,5 +68,46 @@ class THnSparseArrayChunk: public TObject {
 
    ClassDefOverride(THnSparseArrayChunk, 1); // chunks of linearized bins
 };
+
+/// Hash table from the hash of the compact bin coordinates to the linear bin
+/// index. Open addressing with linear probing: the slots are two flat arrays,
+/// so a lookup reads consecutive memory and compares hashes before comparing
+/// coordinates. Bins with the same hash take consecutive slots of the probe
+/// sequence. The load factor is kept below 1/2.
+class THnSparseBinMap {
+   std::vector<ULong64_t> fHashes; ///< Hash of the bin in each slot
+   std::vector<Long64_t> fBins;    ///< Linear bin index + 1 in each slot, 0 for an empty slot
+   Long64_t fSize = 0;             ///< Number of bins in the table
+   Int_t fShift = 64;              ///< 64 - log2 of the number of slots
+
+   /// First slot of the probe sequence; Fibonacci hashing spreads the
+   /// consecutive compact coordinates used as hashes for small histograms
+   ULong64_t GetSlot(ULong64_t hash) const { return (hash * 0x9E3779B97F4A7C15ull) >> fShift; }
+   void Insert(ULong64_t hash, Long64_t linidx);
+
+public:
+   Long64_t GetSize() const { return fSize; }
+   Long64_t GetCapacity() const { return fBins.size(); }
+
+   /// Return the linear index of the bin with this hash for which matches(linidx)
+   /// is true, -1 if there is none.
+   template <class MATCHES>
+   Long64_t Find(ULong64_t hash, MATCHES &&matches) const {
+      if (fBins.empty())
+         return -1;
+      const ULong64_t mask = fBins.size() - 1;
+      for (ULong64_t slot = GetSlot(hash);; slot = (slot + 1) & mask) {
+         const Long64_t bin = fBins[slot];
+         if (!bin)
+            return -1;
+         if (fHashes[slot] == hash && matches(bin - 1))
+            return bin - 1;
+      }
+   }
+
+   void Add(ULong64_t hash, Long64_t linidx);
+   void Clear();
+   void Reserve(Long64_t nbins);
+};
 #endif // ROOT_THnSparse_Internal
 
@@ -16,6 +16,7 @@
 #include "TNamed.h"
 
 #include "Math/Math.h"
+#include "ROOT/EExecutionPolicy.hxx"
 
 #include <string>
 #include <vector>
@@ -130,6 +131,8 @@ public:
    Double_t operator()(const Double_t* x, const Double_t* p = nullptr) const;  // Needed for creating TF1
 
    Double_t GetValue(Double_t x) const { return (*this)(x); }
+   void GetValues(UInt_t n, const Double_t *x, Double_t *values,
+                  ROOT::EExecutionPolicy policy = ROOT::EExecutionPolicy::kSequential) const;
    Double_t GetError(Double_t x) const;
 
    Double_t GetBias(Double_t x) const;
@@ -164,6 +167,15 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      // Data points sorted in increasing order, to only sum the points within fRadius; empty if not usable
+      std::vector<Double_t> fSortedData;
+      std::vector<Double_t> fSortedCoefs;      ///< Count divided by bandwidth of the sorted data points
+      std::vector<Double_t> fSortedInvWeights; ///< Inverse bandwidth of the sorted data points
+      Double_t fRadius = 0;                    ///< Distance to a data point beyond which its kernel vanishes
+      void SortData();
+      Double_t SumAll(Double_t x) const;
+      template <class KERNEL>
+      Double_t SumSorted(Double_t x, KERNEL kernel) const;
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
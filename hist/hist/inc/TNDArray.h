@@ -123,10 +123,17 @@ public:
    }
 
    void Reset(Option_t* /*option*/ = "") override {
-      // Reset the content
-      fData.assign(fSizes[0], T());
+      // Reset the content; storage that has not been allocated yet stays unallocated.
+      if (!fData.empty())
+         fData.assign(fSizes[0], T());
    }
 
+   /// Whether storage has been allocated, i.e. whether any element has been written.
+   bool IsAllocated() const { return !fData.empty(); }
+
+   /// Release the storage; all elements read as T() until the next write.
+   void Deallocate() { std::vector<T>().swap(fData); }
+
    TNDArrayRef<T> operator[](Int_t idx) const {
       if (!fData) return TNDArrayRef<T>(0, 0);
       R__ASSERT(idx < fSizes[0] / fSizes[1] && "index out of range!");
@@ -17,6 +17,8 @@
 #include "Fit/FitResult.h"
 #include "Math/IParamFunction.h"
 
+#include <algorithm>
+#include <array>
 #include <vector>
 
 #include <cassert>
@@ -76,6 +78,22 @@ bool AdjustError(const DataOptions & option, double & error, double value = 1) {
    return true;
 }
 
+void GetBinCoordinates(const TAxis *axis, int first, int last, bool useBinEdges, std::vector<double> &x,
+                       std::vector<double> &s)
+{
+   // store in x the coordinates of the fit points for the bins first to last of the axis (the bin centers,
+   // or the bin low edges if useBinEdges) and in s the bin up edges if useBinEdges
+   x.resize(std::max(last - first + 1, 0));
+   s.resize(useBinEdges ? x.size() : 0);
+   for (int bin = first; bin <= last; ++bin) {
+      if (useBinEdges) {
+         x[bin - first] = axis->GetBinLowEdge(bin);
+         s[bin - first] = axis->GetBinUpEdge(bin);
+      } else
+         x[bin - first] = axis->GetBinCenter(bin);
+   }
+}
+
 void ExamineRange(const TAxis * axis, std::pair<double,double> range,int &hxfirst,int &hxlast) {
    // examine the range given with the pair on the given histogram axis
    // correct in case the bin values hxfirst hxlast
@@ -159,26 +177,19 @@ void FillData(BinData & dv, const TH1 * hfit, TF1 * func)
    }
 
 
-   int n = (hxlast-hxfirst+1)*(hylast-hyfirst+1)*(hzlast-hzfirst+1);
-
 #ifdef DEBUG
+   int n = (hxlast-hxfirst+1)*(hylast-hyfirst+1)*(hzlast-hzfirst+1);
    std::cout << "THFitInterface: ifirst = " << hxfirst << " ilast =  " << hxlast
              << " total bins  " << n
              << std::endl;
 #endif
 
-   // reserve n for more efficient usage
-   //dv.Data().reserve(n);
-
    int hdim =  hfit->GetDimension();
    int ndim = hdim;
    // case of function dimension less than histogram
    if (func !=nullptr && func->GetNdim() == hdim-1) ndim = hdim-1;
 
    assert( ndim > 0 );
-   //typedef  BinPoint::CoordData CoordData;
-   //CoordData x = CoordData( hfit->GetDimension() );
-   dv.Initialize(n,ndim, (fitOpt.fErrors1) ? ROOT::Fit::BinData::kNoError : ROOT::Fit::BinData::kValueError);
 
    double x[3];
    double s[3];
@@ -191,68 +202,87 @@ void FillData(BinData & dv, const TH1 * hfit, TF1 * func)
    const TAxis *yaxis  = hfit->GetYaxis();
    const TAxis *zaxis  = hfit->GetZaxis();
 
-   for ( binx = hxfirst; binx <= hxlast; ++binx) {
+   // the coordinates (and the up edges) of the points are computed once for each bin of the axes
+   std::vector<double> xc[3];
+   std::vector<double> sc[3];
+   HFitInterface::GetBinCoordinates(xaxis, hxfirst, hxlast, useBinEdges, xc[0], sc[0]);
+   HFitInterface::GetBinCoordinates(yaxis, hyfirst, hylast, useBinEdges, xc[1], sc[1]);
+   HFitInterface::GetBinCoordinates(zaxis, hzfirst, hzlast, useBinEdges, xc[2], sc[2]);
+   auto setCoordinates = [&]() {
+      x[0] = xc[0][binx - hxfirst];
+      x[1] = xc[1][biny - hyfirst];
+      x[2] = xc[2][binz - hzfirst];
       if (useBinEdges) {
-         x[0] = xaxis->GetBinLowEdge(binx);
-         s[0] = xaxis->GetBinUpEdge(binx);
+         s[0] = sc[0][binx - hxfirst];
+         s[1] = sc[1][biny - hyfirst];
+         s[2] = sc[2][binz - hzfirst];
       }
-      else
-         x[0] = xaxis->GetBinCenter(binx);
-
+   };
 
+   // first find the bins used in the fit (skipping the empty and the rejected ones), so that the fit data
+   // are allocated only for them: this matters for large multi-dimensional histograms which are mostly empty
+   std::vector<std::array<int, 3>> fitBins;
+   for ( binx = hxfirst; binx <= hxlast; ++binx) {
       for ( biny = hyfirst; biny <= hylast; ++biny) {
-         if (useBinEdges) {
-            x[1] = yaxis->GetBinLowEdge(biny);
-            s[1] = yaxis->GetBinUpEdge(biny);
-         }
-         else
-            x[1] = yaxis->GetBinCenter(biny);
-
          for ( binz = hzfirst; binz <= hzlast; ++binz) {
-            if (useBinEdges) {
-               x[2] = zaxis->GetBinLowEdge(binz);
-               s[2] = zaxis->GetBinUpEdge(binz);
-            }
-            else
-               x[2] = zaxis->GetBinCenter(binz);
+            int bin = hfit->GetBin(binx, biny, binz);
+            double value =  hfit->GetBinContent(bin);
+            double error =  hfit->GetBinError(bin);
+            if (!HFitInterface::AdjustError(fitOpt,error,value) ) continue;
 
             // need to evaluate function to know about rejected points
             // hugly but no other solutions
             if (func != nullptr) {
+               setCoordinates();
                TF1::RejectPoint(false);
                (*func)( &x[0] );  // evaluate using stored function parameters
                if (TF1::RejectedPoint() ) continue;
             }
 
+            fitBins.push_back({binx, biny, binz});
 
-            double value =  hfit->GetBinContent(binx, biny, binz);
-            double error =  hfit->GetBinError(binx, biny, binz);
-            if (!HFitInterface::AdjustError(fitOpt,error,value) ) continue;
+         }  // end loop on z bins
+      }  // end loop on y bins
+   }   // end loop on x axis
 
-            if (ndim == hdim -1) {
-               // case of fitting a function with  dimension -1
-               // point error is bin width y / sqrt(N) where N is the number of entries in the bin
-               // normalization of error will be wrong - but they will be rescaled in the fit
-               if (hdim == 2)  dv.Add(  x,  x[1],  yaxis->GetBinWidth(biny) / error  );
-               if (hdim == 3)  dv.Add(  x,  x[2],  zaxis->GetBinWidth(binz) / error  );
-            } else {
-               if (fitOpt.fErrors1)
-                  dv.Add(   x,  value );
-               else
-                  dv.Add(   x,  value, error  );
-               if (useBinEdges) {
-                  dv.AddBinUpEdge( s );
-               }
-            }
+#ifdef DEBUG
+   std::cout << "THFitInterface: " << fitBins.size() << " bins used out of " << n << std::endl;
+#endif
 
+   dv.Initialize(fitBins.size(), ndim,
+                 (fitOpt.fErrors1) ? ROOT::Fit::BinData::kNoError : ROOT::Fit::BinData::kValueError);
+
+   for (const auto &fitBin : fitBins) {
+      binx = fitBin[0];
+      biny = fitBin[1];
+      binz = fitBin[2];
+      setCoordinates();
+
+      int bin = hfit->GetBin(binx, biny, binz);
+      double value =  hfit->GetBinContent(bin);
+      double error =  hfit->GetBinError(bin);
+      HFitInterface::AdjustError(fitOpt,error,value);
+
+      if (ndim == hdim -1) {
+         // case of fitting a function with  dimension -1
+         // point error is bin width y / sqrt(N) where N is the number of entries in the bin
+         // normalization of error will be wrong - but they will be rescaled in the fit
+         if (hdim == 2)  dv.Add(  x,  x[1],  yaxis->GetBinWidth(biny) / error  );
+         if (hdim == 3)  dv.Add(  x,  x[2],  zaxis->GetBinWidth(binz) / error  );
+      } else {
+         if (fitOpt.fErrors1)
+            dv.Add(   x,  value );
+         else
+            dv.Add(   x,  value, error  );
+         if (useBinEdges) {
+            dv.AddBinUpEdge( s );
+         }
+      }
 
 #ifdef DEBUG
-            std::cout << "bin " << binx << " add point " << x[0] << "  " << hfit->GetBinContent(binx) << std::endl;
+      std::cout << "bin " << binx << " add point " << x[0] << "  " << value << std::endl;
 #endif
-
-         }  // end loop on z bins
-      }  // end loop on y bins
-   }   // end loop on x axis
+   }
 
 
 #ifdef DEBUG
@@ -434,6 +434,53 @@ Int_t TAxis::FindFixBin(Double_t x) const
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers of the n abscissas x[0], x[stride], ..., x[(n-1)*stride]
+///
+/// Gives the same bins as calling TAxis::FindFixBin for each abscissa, but the
+/// loops have no data-dependent branches, so that the compiler can vectorize
+/// them: out-of-range abscissas get their bin number from a select, and the
+/// variable bin sizes are searched with a binary search of fixed depth.
+
+void TAxis::FindFixBins(Int_t n, const Double_t *x, Int_t stride, Int_t *bins) const
+{
+   const Double_t xmin = fXmin;
+   const Double_t xmax = fXmax;
+   const Int_t overflow = fNbins + 1;
+   if (!fXbins.fN) {        //*-* fix bins
+      const Double_t nbins = fNbins;
+      const Double_t width = fXmax - fXmin;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i * stride];
+         // NaN is neither underflow nor in range, hence overflow as in FindFixBin
+         const bool isUnderflow = xi < xmin;
+         const bool isInRange = !isUnderflow && xi < xmax;
+         // out-of-range abscissas are replaced by xmin before the conversion to int, which would overflow otherwise
+         const Double_t xc = isInRange ? xi : xmin;
+         const Int_t bin = 1 + int(nbins * (xc - xmin) / width);
+         bins[i] = isInRange ? bin : (isUnderflow ? 0 : overflow);
+      }
+   } else {                  //*-* variable bin sizes
+      const Double_t *edges = fXbins.fArray;
+      const Int_t nedges = fXbins.fN;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i * stride];
+         const bool isUnderflow = xi < xmin;
+         const bool isInRange = !isUnderflow && xi < xmax;
+         const Double_t xc = isInRange ? xi : edges[0];
+         // last edge <= xc, like TMath::BinarySearch for strictly increasing edges
+         const Double_t *first = edges;
+         for (Int_t len = nedges; len > 1;) {
+            const Int_t half = len / 2;
+            first = (first[half] <= xc) ? first + half : first;
+            len -= half;
+         }
+         const Int_t bin = 1 + Int_t(first - edges);
+         bins[i] = isInRange ? bin : (isUnderflow ? 0 : overflow);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
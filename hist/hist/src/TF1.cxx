@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include "strlcpy.h"
@@ -1528,6 +1529,32 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at n points.
+///
+/// x holds the fNdim coordinates of the first point followed by those of the
+/// second point and so on; the n values are written to result. For functions
+/// defined by a formula the points are evaluated by TFormula::EvalBatch, which
+/// is much faster than n calls to EvalPar; other functions are evaluated point
+/// by point.
+
+void TF1::EvalBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params)
+{
+   if (fType == EFType::kFormula) {
+      assert(fFormula);
+      fFormula->EvalBatch(n, x, result, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (Int_t i = 0; i < n; ++i)
+            result[i] /= fNormIntegral;
+      }
+      return;
+   }
+   for (Int_t i = 0; i < n; ++i) {
+      InitArgs(x + i * fNdim, params);
+      result[i] = EvalPar(x + i * fNdim, params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -2212,6 +2239,60 @@ Double_t TF1::GetRandom(TRandom * rng, Option_t * option)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `x` with `n` random numbers following this function shape.
+///
+/// The result is the same as `n` calls of GetRandom(rng, option), but the
+/// uniform numbers are generated with a single TRandom::RndmArray() call and
+/// the inversion of the tabulated integral runs in a loop without virtual
+/// calls. To generate in parallel, give each task its own generator, e.g. a
+/// TRandomPhilox with the task index as stream number; the integral table
+/// has to be computed before, e.g. by a first call from one thread.
+///
+/// @param n  number of random numbers to generate
+/// @param x  output array of size `n`
+/// @param rng  Random number generator. By default (or when passing a nullptr) the global gRandom is used
+/// @param option  `LOG` or `LIN`, see GetRandom(TRandom *, Option_t *)
+
+void TF1::GetRandom(Int_t n, Double_t *x, TRandom * rng, Option_t * option)
+{
+   if (n <= 0)
+      return;
+   //  Check if integral array must be built
+   if (fIntegral.empty()) {
+      Bool_t ret = ComputeCdfTable(option);
+      if (!ret) {
+         std::fill(x, x + n, TMath::QuietNaN());
+         return;
+      }
+   }
+
+   if (!rng)
+      rng = gRandom;
+   rng->RndmArray(n, x);
+
+   const Double_t *integral = fIntegral.data();
+   const Double_t *alpha = fAlpha.data();
+   const Double_t *beta = fBeta.data();
+   const Double_t *gamma = fGamma.data();
+   const Bool_t logx = fAlpha[fNpx] > 0;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t r = x[i];
+      const Int_t bin = TMath::BinarySearch(fNpx, integral, r);
+      const Double_t rr = r - integral[bin];
+      Double_t yy;
+      if (gamma[bin] != 0)
+         yy = (-beta[bin] + TMath::Sqrt(beta[bin] * beta[bin] + 2 * gamma[bin] * rr)) / gamma[bin];
+      else
+         yy = rr / beta[bin];
+      x[i] = alpha[bin] + yy;
+   }
+   if (logx) {
+      for (Int_t i = 0; i < n; ++i)
+         x[i] = TMath::Power(10, x[i]);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a random number following this function shape in [xmin,xmax]
 ///
@@ -3199,11 +3280,18 @@ void TF1::Save(Double_t xmin, Double_t xmax, Double_t, Double_t, Double_t, Doubl
    if (npx <= 0)
       return;
    fSave.resize(npx + 3);
-   Double_t xv[1];
-   InitArgs(xv, parameters);
-   for (Int_t i = 0; i <= npx; i++) {
-      xv[0]    = xmin + dx * i;
-      fSave[i] = EvalPar(xv, parameters);
+   if (fType == EFType::kFormula) {
+      std::vector<Double_t> xv(npx + 1);
+      for (Int_t i = 0; i <= npx; i++)
+         xv[i] = xmin + dx * i;
+      EvalBatch(npx + 1, xv.data(), fSave.data(), parameters);
+   } else {
+      Double_t xv[1];
+      InitArgs(xv, parameters);
+      for (Int_t i = 0; i <= npx; i++) {
+         xv[0] = xmin + dx * i;
+         fSave[i] = EvalPar(xv, parameters);
+      }
    }
    fSave[npx + 1] = xmin;
    fSave[npx + 2] = xmax;
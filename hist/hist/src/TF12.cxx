@@ -169,6 +169,15 @@ Double_t TF12::EvalPar(const Double_t *x, const Double_t *params)
    return fF2->EvalPar(xx,params);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this function at the n points x[0], ..., x[n-1]
+
+void TF12::EvalBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params)
+{
+   for (Int_t i = 0; i < n; ++i)
+      result[i] = EvalPar(x + i, params);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Save primitive as a C++ statement(s) on output stream out
@@ -23,6 +23,7 @@
 
 #include "ROOT/StringUtils.hxx"
 
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <memory>
@@ -757,6 +758,8 @@ void TFormula::Copy(TObject &obj) const
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
    fnew.fHessFuncPtr = fHessFuncPtr;
+   fnew.fBatchGenerationInput = fBatchGenerationInput;
+   fnew.fBatchFuncPtr = fBatchFuncPtr;
 
 }
 
@@ -3314,6 +3317,121 @@ void TFormula::HessianPar(const Double_t *x, Double_t *result) {
    CallCladFunction(fHessFuncPtr, vars, pars, result, fNpar * fNpar);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the loop kernel used by EvalBatch: a function calling the formula
+/// function for n points, compiled together with it so that the call is
+/// inlined and the loop can be vectorized.
+/// Returns true on success.
+
+bool TFormula::GenerateBatchEval() const
+{
+   if (fBatchFuncPtr)
+      return true;
+
+   R__LOCKGUARD(gROOTMutex);
+   // check again in case another thread has generated the kernel
+   if (fBatchFuncPtr)
+      return true;
+   // the generation has failed before
+   if (!fBatchGenerationInput.empty())
+      return false;
+
+   const std::string funcName = GetBatchFuncName();
+   // EvalBatch only uses the kernel for formulas with variables
+   TString call = TString::Format("%s(x + i * %d%s)", fClingName.Data(), fNdim, fNpar > 0 ? ", p" : "");
+   fBatchGenerationInput = TString::Format("#pragma cling optimize(2)\n"
+                                           "void %s(Int_t n, Double_t *x, Double_t *p, Double_t *result) {\n"
+                                           "   for (Int_t i = 0; i < n; ++i)\n"
+                                           "      result[i] = %s;\n"
+                                           "}",
+                                           funcName.c_str(), call.Data())
+                              .Data();
+
+   // The kernel may have been generated for another TFormula with the same expression
+   if (!functionExists(funcName) && !gInterpreter->Declare(fBatchGenerationInput.c_str())) {
+      Error("GenerateBatchEval", "Could not generate the batch evaluation of the formula %s", fClingName.Data());
+      return false;
+   }
+
+   auto method = std::make_unique<TMethodCall>();
+   method->InitWithPrototype(funcName.c_str(), "Int_t,Double_t*,Double_t*,Double_t*");
+   if (!method->IsValid()) {
+      Error("GenerateBatchEval", "Can't compile function %s", funcName.c_str());
+      return false;
+   }
+   fBatchFuncPtr = prepareFuncPtr(method.get());
+   return fBatchFuncPtr != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula for n points.
+///
+/// \param[in] n - The number of points.
+/// \param[in] x - The variables of the points, the fNdim variables of the first
+///                point followed by those of the second and so on; if nullptr,
+///                all points use the stored variables.
+/// \param[out] result - The n values of the formula.
+/// \param[in] params - The parameters, if nullptr the stored parameters are used.
+///
+/// Unlike n calls to EvalPar(), the points are evaluated by a loop compiled
+/// together with the formula (see GenerateBatchEval()), which saves the call
+/// overhead per point and lets the compiler vectorize the formula. Vectorized
+/// formulas are evaluated ROOT::Double_v by ROOT::Double_v; lambda expressions
+/// point by point.
+
+void TFormula::EvalBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params) const
+{
+   if (n <= 0)
+      return;
+
+   // evaluating the first point also checks the formula and performs its lazy initialization
+   result[0] = EvalPar(x, params);
+   if (n == 1)
+      return;
+   if (!fReadyToExecute || (!fClingInitialized && !TestBit(TFormula::kLambda))) {
+      std::fill(result + 1, result + n, TMath::QuietNaN());
+      return;
+   }
+   // all points use the stored variables
+   if (!x || fNdim == 0) {
+      std::fill(result + 1, result + n, result[0]);
+      return;
+   }
+   const Double_t *xnext = x + fNdim;
+
+#ifdef R__HAS_VECCORE
+   if (fVectorized) {
+      const Int_t vecSize = vecCore::VectorSize<ROOT::Double_v>();
+      std::vector<ROOT::Double_v> xvec(fNdim);
+      for (Int_t first = 1; first < n; first += vecSize) {
+         const Int_t size = std::min(vecSize, n - first);
+         for (Int_t d = 0; d < fNdim; ++d) {
+            // the missing points of the last vector repeat the last point
+            for (Int_t i = 0; i < vecSize; ++i)
+               vecCore::Set(xvec[d], i, x[(first + std::min(i, size - 1)) * fNdim + d]);
+         }
+         ROOT::Double_v ans = DoEvalVec(xvec.data(), params);
+         for (Int_t i = 0; i < size; ++i)
+            result[first + i] = vecCore::Get(ans, i);
+      }
+      return;
+   }
+#endif
+
+   if (fVectorized || TestBit(TFormula::kLambda) || !GenerateBatchEval()) {
+      for (Int_t i = 1; i < n; ++i)
+         result[i] = EvalPar(xnext + (i - 1) * fNdim, params);
+      return;
+   }
+
+   Int_t nnext = n - 1;
+   double *vars = const_cast<double *>(xnext);
+   double *pars = params ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+   double *res = result + 1;
+   void *args[4] = {&nnext, &vars, &pars, &res};
+   (*fBatchFuncPtr)(nullptr, 4, args, /*ret*/ nullptr); // We do not use ret in a return-void func.
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 #ifdef R__HAS_VECCORE
 // ROOT::Double_v TFormula::Eval(ROOT::Double_v x, ROOT::Double_v y, ROOT::Double_v z, ROOT::Double_v t) const
@@ -530,7 +530,7 @@ TGraph2D::TGraph2D(const TGraph2D &g)
    (*this) = g;
 
    // append TGraph2D to gdirectory
-   if (TH1::AddDirectoryStatus()) {
+   if (TH1::AddDirectoryStatus() && ROOT::IsGlobalRegistrationEnabled()) {
       fDirectory = gDirectory;
       if (fDirectory) {
          // append without replacing existing objects
@@ -624,7 +624,7 @@ void TGraph2D::Build(Int_t n)
    fPainter   = nullptr;
    fUserHisto = kFALSE;
 
-   if (TH1::AddDirectoryStatus()) {
+   if (TH1::AddDirectoryStatus() && ROOT::IsGlobalRegistrationEnabled()) {
       fDirectory = gDirectory;
       if (fDirectory) {
          fDirectory->Append(this, kTRUE);
@@ -714,7 +714,7 @@ void TGraph2D::Clear(Option_t * /*option = "" */)
 
 void TGraph2D::DirectoryAutoAdd(TDirectory *dir)
 {
-   Bool_t addStatus = TH1::AddDirectoryStatus();
+   Bool_t addStatus = TH1::AddDirectoryStatus() && ROOT::IsGlobalRegistrationEnabled();
    if (addStatus) {
       SetDirectory(dir);
       if (dir) {
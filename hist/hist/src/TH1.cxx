@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cctype>
 #include <climits>
@@ -53,6 +54,7 @@
 #include "Math/MinimizerOptions.h"
 #include "Math/QuantFuncMathCore.h"
 
+#include "TH1AtomicFill.h"
 #include "TH1Merger.h"
 
 /** \addtogroup Histograms
@@ -373,6 +375,11 @@ When using the options 2 or 3 above, the labels are automatically
  capacity (127 or 32767). Histograms of all types may have positive
  or/and negative bin contents.
 
+ A histogram can be filled from several threads at the same time in
+ the atomic fill mode, enabled with TH1::SetAtomicFill: the bins are
+ updated with atomic operations instead of filling one clone of the
+ histogram per thread and merging the clones.
+
 \anchor associated-errors
 ### Associated errors
  By default, for each bin, the sum of weights is computed at fill time.
@@ -649,6 +656,8 @@ TH1::~TH1()
    fIntegral = nullptr;
    delete[] fBuffer;
    fBuffer = nullptr;
+   delete fAtomicFill;
+   fAtomicFill = nullptr;
    if (fFunctions) {
       R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -797,7 +806,7 @@ void TH1::Build()
 
    UseCurrentStyle();
 
-   if (TH1::AddDirectoryStatus()) {
+   if (TH1::AddDirectoryStatus() && ROOT::IsGlobalRegistrationEnabled()) {
       fDirectory = gDirectory;
       if (fDirectory) {
          fFunctions->UseRWLock();
@@ -1290,6 +1299,10 @@ void TH1::AddBinContent(Int_t, Double_t)
 ///
 /// NOTE that this is a static function. To call it, use;
 /// TH1::AddDirectory
+///
+/// The flag is shared by all threads. To create histograms without registering
+/// them in a region of code of the current thread only, use
+/// ROOT::TNoGlobalRegistrationRAII.
 
 void TH1::AddDirectory(Bool_t add)
 {
@@ -2738,7 +2751,7 @@ void TH1::Copy(TObject &obj) const
    // will be added to gDirectory independently of the fDirectory stored.
    // and if the AddDirectoryStatus() is false it will not be added to
    // any directory (fDirectory = nullptr)
-   if (fgAddDirectory && gDirectory) {
+   if (fgAddDirectory && ROOT::IsGlobalRegistrationEnabled() && gDirectory) {
       gDirectory->Append(&obj);
       ((TH1&)obj).fFunctions->UseRWLock();
       ((TH1&)obj).fDirectory = gDirectory;
@@ -2802,7 +2815,7 @@ TObject* TH1::Clone(const char* newname) const
 
 void TH1::DirectoryAutoAdd(TDirectory *dir)
 {
-   Bool_t addStatus = TH1::AddDirectoryStatus();
+   Bool_t addStatus = TH1::AddDirectoryStatus() && ROOT::IsGlobalRegistrationEnabled();
    if (addStatus) {
       SetDirectory(dir);
       if (dir) {
@@ -3346,6 +3359,7 @@ TH1* TH1::FFT(TH1* h_output, Option_t *option)
 Int_t TH1::Fill(Double_t x)
 {
    if (fBuffer)  return BufferFill(x,1);
+   if (fAtomicFill) return fAtomicFill->Fill(x, 1.);
 
    Int_t bin;
    fEntries++;
@@ -3379,6 +3393,7 @@ Int_t TH1::Fill(Double_t x, Double_t w)
 {
 
    if (fBuffer) return BufferFill(x,w);
+   if (fAtomicFill) return fAtomicFill->Fill(x, w);
 
    Int_t bin;
    fEntries++;
@@ -3464,6 +3479,11 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
       }
       return;
    }
+   if (fAtomicFill) {
+      for (Int_t i = 0; i < ntimes; ++i)
+         fAtomicFill->Fill(x[i*stride], w ? w[i*stride] : 1.);
+      return;
+   }
    // call internal method
    DoFillN(ntimes, x, w, stride);
 }
@@ -3479,6 +3499,10 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
+   if (!fXaxis.CanExtend()) {
+      DoFillNFixBins(ntimes, x, w, stride);
+      return;
+   }
    ntimes *= stride;
    for (i=0;i<ntimes;i+=stride) {
       bin =fXaxis.FindBin(x[i]);
@@ -3498,6 +3522,55 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the entries of DoFillN when the axis cannot be extended
+///
+/// The bins are found for blocks of entries at once with TAxis::FindFixBins, whose
+/// loops the compiler can vectorize, and the statistics are summed in local
+/// variables. The contents and the statistics are the same as the ones of the
+/// entry-by-entry filling, including the order of the sums.
+
+void TH1::DoFillNFixBins(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
+{
+   constexpr Int_t kBlockSize = 256;
+   Int_t bins[kBlockSize];
+
+   // a weight different from 1 triggers the storage of the sum of squares of weights for all the entries
+   if (w && !fSumw2.fN && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i * stride] != 1.0) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   const Bool_t useOverflows = GetStatOverflowsBehaviour();
+   const Int_t nbins = fXaxis.GetNbins();
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      fXaxis.FindFixBins(n, x + first * stride, stride, bins);
+      for (Int_t k = 0; k < n; ++k) {
+         const Int_t i = (first + k) * stride;
+         const Int_t bin = bins[k];
+         const Double_t z = w ? w[i] : 1.;
+         if (sumw2) sumw2[bin] += z*z;
+         AddBinContent(bin, z);
+         if (!useOverflows && (bin == 0 || bin > nbins)) continue;
+         tsumw   += z;
+         tsumw2  += z*z;
+         tsumwx  += z*x[i];
+         tsumwx2 += z*x[i]*x[i];
+      }
+   }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill histogram following distribution in function fname.
 ///
@@ -6643,6 +6716,11 @@ UInt_t TH1::SetCanExtend(UInt_t extendBitMask)
 {
    UInt_t oldExtendBitMask = kNoAxis;
 
+   if (fAtomicFill && extendBitMask != kNoAxis) {
+      Error("SetCanExtend", "the axes of a histogram in atomic fill mode cannot be extended");
+      extendBitMask = kNoAxis;
+   }
+
    if (fXaxis.CanExtend()) oldExtendBitMask |= kXaxis;
    if (extendBitMask & kXaxis) fXaxis.SetCanExtend(kTRUE);
    else fXaxis.SetCanExtend(kFALSE);
@@ -7127,6 +7205,7 @@ void TH1::Reset(Option_t *option)
    fTsumwx      = 0;
    fTsumwx2     = 0;
    fEntries     = 0;
+   if (fAtomicFill) fAtomicFill->Reset();
 
    if (opt == "ICES") return;
 
@@ -8445,11 +8524,71 @@ Double_t TH1::GetContourLevelPad(Int_t level) const
    return zlevel;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the atomic fill mode.
+///
+/// In atomic fill mode, the histogram can be filled from several threads at
+/// the same time with the Fill functions taking coordinates and with FillN:
+/// the bin contents and the sums of squares of weights are updated with
+/// atomic operations, and the number of entries and the statistics are
+/// accumulated per group of threads, each on its own cache line. This avoids
+/// one clone of the histogram per thread, as with ROOT::TThreadedObject, and
+/// the merging of the clones at the end; the price is an atomic operation per
+/// update, which matters little for the large 2-D and 3-D histograms for which
+/// the clones are a memory problem.
+///
+/// When the mode is enabled:
+///  - the entries of the buffer are filled and the buffer is deleted;
+///  - the axes can no longer be extended, the bins must be known in advance;
+///  - the storage of the sum of squares of weights is allocated, unless the
+///    bit TH1::kIsNotW is set: it cannot be triggered by the first weight
+///    different from 1 while other threads are filling.
+///
+/// The number of entries and the statistics (GetEntries, GetMean, etc) are
+/// only updated when the mode is disabled, which must be done once the
+/// filling threads completed and before using the histogram; the bin
+/// contents are always up to date. The filling with bin labels, TH1::AddBinContent,
+/// TH1::SetBinContent and all the other functions are not thread-safe in
+/// this mode either. The profiles, TH2Poly and TH1K are not supported.
+
+void TH1::SetAtomicFill(Bool_t atomic)
+{
+   if (!atomic) {
+      if (fAtomicFill) {
+         fAtomicFill->Flush();
+         delete fAtomicFill;
+         fAtomicFill = nullptr;
+      }
+      return;
+   }
+   if (fAtomicFill)
+      return;
+   if (InheritsFrom(TProfile::Class()) || InheritsFrom("TProfile2D") || InheritsFrom("TProfile3D") ||
+       InheritsFrom("TH2Poly") || InheritsFrom("TH1K")) {
+      Error("SetAtomicFill", "the atomic fill mode is not supported for a %s", ClassName());
+      return;
+   }
+   TH1AtomicFill *atomicFill = TH1AtomicFill::Create(*this);
+   if (!atomicFill) {
+      Error("SetAtomicFill", "the atomic fill mode is not supported for the bin contents of a %s", ClassName());
+      return;
+   }
+   BufferEmpty(1);
+   SetCanExtend(kNoAxis);
+   if (!fSumw2.fN && !TestBit(TH1::kIsNotW)) Sumw2();
+   fAtomicFill = atomicFill;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the maximum number of entries to be kept in the buffer.
+/// The buffer cannot be used in atomic fill mode, see TH1::SetAtomicFill.
 
 void TH1::SetBuffer(Int_t buffersize, Option_t * /*option*/)
 {
+   if (fAtomicFill && buffersize > 0) {
+      Error("SetBuffer", "a histogram in atomic fill mode cannot have a buffer");
+      return;
+   }
    if (fBuffer) {
       BufferEmpty();
       delete [] fBuffer;
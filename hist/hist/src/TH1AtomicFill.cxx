@@ -0,0 +1,240 @@
+// Helper class implementing the atomic fill mode of TH1, see TH1::SetAtomicFill
+
+#include "TH1AtomicFill.h"
+#include "TH2.h"
+#include "TH3.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <type_traits>
+
+namespace {
+
+// Atomic accesses to the elements of the plain arrays of TH1 (contents, sum of squares of weights)
+
+template <typename T>
+T AtomicLoad(T *target)
+{
+#if defined(__cpp_lib_atomic_ref)
+   return std::atomic_ref<T>(*target).load(std::memory_order_relaxed);
+#elif defined(__GNUC__)
+   T value;
+   __atomic_load(target, &value, __ATOMIC_RELAXED);
+   return value;
+#else
+   return reinterpret_cast<std::atomic<T> *>(target)->load(std::memory_order_relaxed);
+#endif
+}
+
+template <typename T>
+bool AtomicCompareExchange(T *target, T &expected, T desired)
+{
+#if defined(__cpp_lib_atomic_ref)
+   return std::atomic_ref<T>(*target).compare_exchange_weak(expected, desired, std::memory_order_relaxed);
+#elif defined(__GNUC__)
+   return __atomic_compare_exchange(target, &expected, &desired, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+#else
+   return reinterpret_cast<std::atomic<T> *>(target)->compare_exchange_weak(expected, desired,
+                                                                            std::memory_order_relaxed);
+#endif
+}
+
+/// Replaces *target by update(*target), atomically
+template <typename T, typename F>
+void AtomicUpdate(T *target, F update)
+{
+   T expected = AtomicLoad(target);
+   while (!AtomicCompareExchange<T>(target, expected, T(update(expected)))) {
+   }
+}
+
+void AtomicAdd(Double_t *target, Double_t w)
+{
+   AtomicUpdate(target, [w](Double_t value) { return value + w; });
+}
+
+/// The new content of a bin filled with weight w, as computed by the AddBinContent of the histogram classes
+template <typename T>
+T AddToContent(T content, Double_t w)
+{
+   if constexpr (std::is_floating_point<T>::value) {
+      return content + T(w);
+   } else {
+      // integer contents saturate at +/- the maximum of the type
+      constexpr Long64_t max = std::numeric_limits<T>::max();
+      return T(std::min(std::max(Long64_t(content) + Long64_t(w), -max), max));
+   }
+}
+
+template <typename ARRAY>
+void AtomicAddBinContent(TArray &content, Int_t bin, Double_t w)
+{
+   auto *cell = static_cast<ARRAY &>(content).fArray + bin;
+   using Content_t = std::remove_reference_t<decltype(*cell)>;
+   AtomicUpdate(cell, [w](Content_t value) { return AddToContent(value, w); });
+}
+
+/// Per-thread index, used to spread the threads over the stripes
+Int_t GetThreadSlot()
+{
+   static std::atomic<Int_t> gNextSlot{0};
+   thread_local Int_t slot = gNextSlot++;
+   return slot;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns a new helper for hist, nullptr if the type of its bin contents is not supported.
+
+TH1AtomicFill *TH1AtomicFill::Create(TH1 &hist)
+{
+   if (auto content = dynamic_cast<TArrayD *>(&hist))
+      return new TH1AtomicFill(hist, *content, &AtomicAddBinContent<TArrayD>);
+   if (auto content = dynamic_cast<TArrayF *>(&hist))
+      return new TH1AtomicFill(hist, *content, &AtomicAddBinContent<TArrayF>);
+   if (auto content = dynamic_cast<TArrayI *>(&hist))
+      return new TH1AtomicFill(hist, *content, &AtomicAddBinContent<TArrayI>);
+   if (auto content = dynamic_cast<TArrayL64 *>(&hist))
+      return new TH1AtomicFill(hist, *content, &AtomicAddBinContent<TArrayL64>);
+   if (auto content = dynamic_cast<TArrayS *>(&hist))
+      return new TH1AtomicFill(hist, *content, &AtomicAddBinContent<TArrayS>);
+   if (auto content = dynamic_cast<TArrayC *>(&hist))
+      return new TH1AtomicFill(hist, *content, &AtomicAddBinContent<TArrayC>);
+   return nullptr;
+}
+
+TH1AtomicFill::TH1AtomicFill(TH1 &hist, TArray &content, AddBinContentFunc_t addBinContent)
+   : fHist(hist), fContent(content), fAddBinContent(addBinContent), fNStripes(1)
+{
+   // one stripe per core, so that threads rarely update the same statistics
+   const Int_t nCores = std::min(std::max(Int_t(std::thread::hardware_concurrency()), 1), 64);
+   while (fNStripes < nCores)
+      fNStripes *= 2;
+   fStripes.reset(new RStripe[fNStripes]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Counts an entry and adds w to the content of bin; returns the stripe of the calling thread.
+
+TH1AtomicFill::RStripe &TH1AtomicFill::AddEntry(Int_t bin, Double_t w)
+{
+   RStripe &stripe = fStripes[GetThreadSlot() & (fNStripes - 1)];
+   AtomicAdd(&stripe.fEntries, 1.);
+   if (fHist.fSumw2.fN)
+      AtomicAdd(fHist.fSumw2.fArray + bin, w * w);
+   fAddBinContent(fContent, bin, w);
+   return stripe;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Same as TH1::Fill(x, w) for the atomic fill mode.
+
+Int_t TH1AtomicFill::Fill(Double_t x, Double_t w)
+{
+   const Int_t binx = fHist.fXaxis.FindFixBin(x);
+   Double_t *stats = AddEntry(binx, w).fStats;
+   if ((binx == 0 || binx > fHist.fXaxis.GetNbins()) && !fHist.GetStatOverflowsBehaviour())
+      return -1;
+   AtomicAdd(&stats[0], w);
+   AtomicAdd(&stats[1], w * w);
+   AtomicAdd(&stats[2], w * x);
+   AtomicAdd(&stats[3], w * x * x);
+   return binx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Same as TH2::Fill(x, y, w) for the atomic fill mode.
+
+Int_t TH1AtomicFill::Fill(Double_t x, Double_t y, Double_t w)
+{
+   const Int_t binx = fHist.fXaxis.FindFixBin(x);
+   const Int_t biny = fHist.fYaxis.FindFixBin(y);
+   const Int_t bin = biny * (fHist.fXaxis.GetNbins() + 2) + binx;
+   Double_t *stats = AddEntry(bin, w).fStats;
+   if ((binx == 0 || binx > fHist.fXaxis.GetNbins() || biny == 0 || biny > fHist.fYaxis.GetNbins()) &&
+       !fHist.GetStatOverflowsBehaviour())
+      return -1;
+   AtomicAdd(&stats[0], w);
+   AtomicAdd(&stats[1], w * w);
+   AtomicAdd(&stats[2], w * x);
+   AtomicAdd(&stats[3], w * x * x);
+   AtomicAdd(&stats[4], w * y);
+   AtomicAdd(&stats[5], w * y * y);
+   AtomicAdd(&stats[6], w * x * y);
+   return bin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Same as TH3::Fill(x, y, z, w) for the atomic fill mode.
+
+Int_t TH1AtomicFill::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
+{
+   const Int_t binx = fHist.fXaxis.FindFixBin(x);
+   const Int_t biny = fHist.fYaxis.FindFixBin(y);
+   const Int_t binz = fHist.fZaxis.FindFixBin(z);
+   const Int_t bin = binx + (fHist.fXaxis.GetNbins() + 2) * (biny + (fHist.fYaxis.GetNbins() + 2) * binz);
+   Double_t *stats = AddEntry(bin, w).fStats;
+   if ((binx == 0 || binx > fHist.fXaxis.GetNbins() || biny == 0 || biny > fHist.fYaxis.GetNbins() || binz == 0 ||
+        binz > fHist.fZaxis.GetNbins()) &&
+       !fHist.GetStatOverflowsBehaviour())
+      return -1;
+   AtomicAdd(&stats[0], w);
+   AtomicAdd(&stats[1], w * w);
+   AtomicAdd(&stats[2], w * x);
+   AtomicAdd(&stats[3], w * x * x);
+   AtomicAdd(&stats[4], w * y);
+   AtomicAdd(&stats[5], w * y * y);
+   AtomicAdd(&stats[6], w * x * y);
+   AtomicAdd(&stats[7], w * z);
+   AtomicAdd(&stats[8], w * z * z);
+   AtomicAdd(&stats[9], w * x * z);
+   AtomicAdd(&stats[10], w * y * z);
+   return bin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adds the entries and the statistics of the stripes to the histogram and resets the stripes.
+/// Must not run concurrently with Fill.
+
+void TH1AtomicFill::Flush()
+{
+   Double_t stats[TH1::kNstat] = {};
+   Double_t entries = 0;
+   for (Int_t i = 0; i < fNStripes; ++i) {
+      entries += fStripes[i].fEntries;
+      for (Int_t j = 0; j < TH1::kNstat; ++j)
+         stats[j] += fStripes[i].fStats[j];
+   }
+   Reset();
+
+   fHist.fEntries += entries;
+   fHist.fTsumw += stats[0];
+   fHist.fTsumw2 += stats[1];
+   fHist.fTsumwx += stats[2];
+   fHist.fTsumwx2 += stats[3];
+   if (auto h2 = dynamic_cast<TH2 *>(&fHist)) {
+      h2->fTsumwy += stats[4];
+      h2->fTsumwy2 += stats[5];
+      h2->fTsumwxy += stats[6];
+   } else if (auto h3 = dynamic_cast<TH3 *>(&fHist)) {
+      h3->fTsumwy += stats[4];
+      h3->fTsumwy2 += stats[5];
+      h3->fTsumwxy += stats[6];
+      h3->fTsumwz += stats[7];
+      h3->fTsumwz2 += stats[8];
+      h3->fTsumwxz += stats[9];
+      h3->fTsumwyz += stats[10];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Discards the entries and the statistics of the stripes.
+
+void TH1AtomicFill::Reset()
+{
+   for (Int_t i = 0; i < fNStripes; ++i)
+      fStripes[i] = RStripe();
+}
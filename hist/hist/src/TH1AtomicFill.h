@@ -0,0 +1,49 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Helper class implementing the atomic fill mode of TH1, see TH1::SetAtomicFill
+
+#ifndef ROOT_TH1AtomicFill
+#define ROOT_TH1AtomicFill
+
+#include "TH1.h"
+
+#include <memory>
+
+class TH1AtomicFill {
+   /// Statistics of the entries filled by a group of threads; one per cache line to avoid false sharing
+   struct alignas(64) RStripe {
+      Double_t fEntries = 0;
+      Double_t fStats[TH1::kNstat] = {};
+   };
+
+   using AddBinContentFunc_t = void (*)(TArray &content, Int_t bin, Double_t w);
+
+   TH1 &fHist;
+   TArray &fContent;                     ///< The bin contents of fHist
+   AddBinContentFunc_t fAddBinContent;   ///< Atomic version of fHist.AddBinContent for the type of fContent
+   Int_t fNStripes;                      ///< Number of stripes, a power of 2
+   std::unique_ptr<RStripe[]> fStripes;
+
+   TH1AtomicFill(TH1 &hist, TArray &content, AddBinContentFunc_t addBinContent);
+
+   RStripe &AddEntry(Int_t bin, Double_t w);
+
+public:
+   static TH1AtomicFill *Create(TH1 &hist);
+
+   Int_t Fill(Double_t x, Double_t w);
+   Int_t Fill(Double_t x, Double_t y, Double_t w);
+   Int_t Fill(Double_t x, Double_t y, Double_t z, Double_t w);
+   void Flush();
+   void Reset();
+};
+
+#endif
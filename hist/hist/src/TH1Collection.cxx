@@ -0,0 +1,237 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TH1Collection.h"
+
+#include "TDirectory.h"
+#include "TH1F.h"
+#include "THashList.h"
+#include "TObjString.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+ClassImp(TH1Collection);
+
+/** \class TH1Collection
+    \ingroup Histograms
+A collection of many small TH1F, stored as a single object.
+
+Files with a very large number of small histograms, as written by monitoring and data quality applications,
+spend most of their size and reading time on the key, the streamer dispatch and the axis and attribute
+metadata of each TH1F. A TH1Collection stores the distinct axes once and the bin contents of all the
+histograms in one contiguous array, so that the whole collection is written and read as one key:
+
+~~~ {.cpp}
+TH1Collection coll("monitoring", "Monitoring histograms");
+for (auto h : histograms)
+   coll.Add(*h);
+file->WriteObject(&coll, "monitoring");
+...
+auto coll = file->Get<TH1Collection>("monitoring");
+std::unique_ptr<TH1F> h(coll->Get("chamber_42_occupancy"));
+~~~
+
+The histograms are looked up by name in a hash table built on the first access, and a TH1F is created only
+when it is requested, with Get(). The collection stores the name, the title, the x axis, the bin contents,
+the sums of squares of weights if the histogram has them, the number of entries and the statistics of each
+histogram. The y axis, the attributes of the histogram, its list of functions and its statistics options are
+not stored. Axes with the same binning, title and labels are shared; the other attributes of a shared axis
+are those of the first histogram added with it.
+*/
+
+namespace {
+
+/// Whether the two axes can be shared: same binning, title and labels
+bool HaveSameDefinition(const TAxis &a, const TAxis &b)
+{
+   if (a.GetNbins() != b.GetNbins() || a.GetXmin() != b.GetXmin() || a.GetXmax() != b.GetXmax() ||
+       std::strcmp(a.GetTitle(), b.GetTitle()) != 0)
+      return false;
+   const TArrayD &aBins = *a.GetXbins();
+   const TArrayD &bBins = *b.GetXbins();
+   if (aBins.fN != bBins.fN || !std::equal(aBins.fArray, aBins.fArray + aBins.fN, bBins.fArray))
+      return false;
+   const THashList *aLabels = a.GetLabels();
+   const THashList *bLabels = b.GetLabels();
+   if (!aLabels || !bLabels)
+      return !aLabels && !bLabels;
+   if (aLabels->GetSize() != bLabels->GetSize())
+      return false;
+   TIter nextA(aLabels);
+   TIter nextB(bLabels);
+   while (auto aLabel = static_cast<TObjString *>(nextA())) {
+      auto bLabel = static_cast<TObjString *>(nextB());
+      if (aLabel->String() != bLabel->String() || aLabel->GetUniqueID() != bLabel->GetUniqueID())
+         return false;
+   }
+   return true;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor.
+
+TH1Collection::TH1Collection(const char *name, const char *title) : TNamed(name, title) {}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor.
+
+TH1Collection::~TH1Collection() {}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the index in fAxes of an axis that can be shared with axis, -1 if there is none.
+
+Int_t TH1Collection::FindAxis(const TAxis &axis) const
+{
+   for (std::size_t i = 0; i < fAxes.size(); ++i) {
+      if (HaveSameDefinition(fAxes[i], axis))
+         return i;
+   }
+   return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adds a copy of h to the collection.
+/// Returns false, leaving the collection unchanged, if it already contains a histogram with the name of h.
+
+Bool_t TH1Collection::Add(const TH1F &h)
+{
+   if (GetIndex(h.GetName()) >= 0) {
+      Error("Add", "the collection already contains a histogram named %s", h.GetName());
+      return kFALSE;
+   }
+   if (h.GetBuffer())
+      const_cast<TH1F &>(h).BufferEmpty();
+
+   Int_t axis = FindAxis(*h.GetXaxis());
+   if (axis < 0) {
+      axis = fAxes.size();
+      fAxes.emplace_back(*h.GetXaxis());
+      fAxes.back().SetParent(nullptr);
+   }
+
+   const Int_t ncells = h.GetNcells();
+   fIndex[h.GetName()] = fNames.size();
+   fNames.emplace_back(h.GetName());
+   fTitles.emplace_back(h.GetTitle());
+   fAxis.push_back(axis);
+   fBegin.push_back(fContents.size());
+   fContents.insert(fContents.end(), h.GetArray(), h.GetArray() + ncells);
+   if (h.GetSumw2N()) {
+      fSumw2Begin.push_back(fSumw2.size());
+      fSumw2.insert(fSumw2.end(), h.GetSumw2()->GetArray(), h.GetSumw2()->GetArray() + ncells);
+   } else {
+      fSumw2Begin.push_back(-1);
+   }
+   Double_t stats[TH1::kNstat];
+   h.GetStats(stats);
+   fStats.push_back(h.GetEntries());
+   fStats.insert(fStats.end(), stats, stats + kNstat - 1);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Removes all the histograms.
+
+void TH1Collection::Clear(Option_t *)
+{
+   fAxes.clear();
+   fNames.clear();
+   fTitles.clear();
+   fAxis.clear();
+   fBegin.clear();
+   fContents.clear();
+   fSumw2Begin.clear();
+   fSumw2.clear();
+   fStats.clear();
+   fIndex.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the index of the histogram called name, -1 if there is none.
+
+Int_t TH1Collection::GetIndex(const char *name) const
+{
+   if (fIndex.size() != fNames.size()) {
+      // first access after reading the collection
+      fIndex.clear();
+      fIndex.reserve(fNames.size());
+      for (std::size_t i = 0; i < fNames.size(); ++i)
+         fIndex.emplace(fNames[i], i);
+   }
+   auto it = fIndex.find(name);
+   return it == fIndex.end() ? -1 : it->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns a new TH1F equal to the histogram called name, nullptr if there is none.
+/// The histogram is not added to any directory; it is owned by the caller.
+
+TH1F *TH1Collection::Get(const char *name) const
+{
+   const Int_t i = GetIndex(name);
+   return i < 0 ? nullptr : Get(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns a new TH1F equal to the i-th histogram of the collection, nullptr if i is out of range.
+/// The histogram is not added to any directory; it is owned by the caller.
+
+TH1F *TH1Collection::Get(Int_t i) const
+{
+   if (i < 0 || i >= GetSize()) {
+      Error("Get", "no histogram %d in a collection of %d", i, GetSize());
+      return nullptr;
+   }
+   const TAxis &axis = fAxes[fAxis[i]];
+   TH1F *h = nullptr;
+   {
+      TDirectory::TContext ctxt(nullptr);
+      if (axis.IsVariableBinSize())
+         h = new TH1F(fNames[i].c_str(), fTitles[i].c_str(), axis.GetNbins(), axis.GetXbins()->GetArray());
+      else
+         h = new TH1F(fNames[i].c_str(), fTitles[i].c_str(), axis.GetNbins(), axis.GetXmin(), axis.GetXmax());
+   }
+   h->SetDirectory(nullptr);
+   axis.Copy(*h->GetXaxis());
+   h->GetXaxis()->SetParent(h);
+
+   const Int_t ncells = h->GetNcells();
+   std::copy(fContents.begin() + fBegin[i], fContents.begin() + fBegin[i] + ncells, h->GetArray());
+   if (fSumw2Begin[i] >= 0) {
+      h->Sumw2();
+      std::copy(fSumw2.begin() + fSumw2Begin[i], fSumw2.begin() + fSumw2Begin[i] + ncells,
+                h->GetSumw2()->GetArray());
+   }
+   Double_t stats[TH1::kNstat] = {};
+   std::copy(fStats.begin() + kNstat * i + 1, fStats.begin() + kNstat * (i + 1), stats);
+   h->PutStats(stats);
+   h->SetEntries(fStats[kNstat * i]);
+   return h;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prints the number of histograms and axes; with option "all", the name, number of bins and entries of each
+/// histogram.
+
+void TH1Collection::Print(Option_t *option) const
+{
+   std::cout << ClassName() << " " << GetName() << ": " << GetSize() << " histograms, " << GetNaxes() << " axes, "
+             << fContents.size() << " bins" << std::endl;
+   if (!TString(option).Contains("all", TString::kIgnoreCase))
+      return;
+   for (Int_t i = 0; i < GetSize(); ++i) {
+      std::cout << "   " << fNames[i] << ": " << fAxes[fAxis[i]].GetNbins() << " bins, " << fStats[kNstat * i]
+                << " entries" << std::endl;
+   }
+}
@@ -9,11 +9,14 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
+
 #include "TROOT.h"
 #include "TBuffer.h"
 #include "TClass.h"
 #include "THashList.h"
 #include "TH2.h"
+#include "TH1AtomicFill.h"
 #include "TVirtualPad.h"
 #include "TF2.h"
 #include "TProfile.h"
@@ -415,6 +418,7 @@ Int_t TH2::Fill(Double_t )
 Int_t TH2::Fill(Double_t x,Double_t y)
 {
    if (fBuffer) return BufferFill(x,y,1);
+   if (fAtomicFill) return fAtomicFill->Fill(x, y, 1.);
 
    Int_t binx, biny, bin;
    fEntries++;
@@ -459,6 +463,7 @@ Int_t TH2::Fill(Double_t x,Double_t y)
 Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,w);
+   if (fAtomicFill) return fAtomicFill->Fill(x, y, w);
 
    Int_t binx, biny, bin;
    fEntries++;
@@ -664,6 +669,18 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
          return;
    }
 
+   if (fAtomicFill) {
+      for (i=ifirst;i<ntimes;i+=stride)
+         fAtomicFill->Fill(x[i], y[i], w ? w[i] : 1.);
+      return;
+   }
+
+   // bins are found block by block when the axes cannot be extended, so that the bin search is vectorized
+   if (!fXaxis.CanExtend() && !fYaxis.CanExtend()) {
+      DoFillNFixBins((ntimes - ifirst + stride - 1) / stride, x + ifirst, y + ifirst, w ? w + ifirst : nullptr, stride);
+      return;
+   }
+
    Double_t ww = 1;
    for (i=ifirst;i<ntimes;i+=stride) {
       fEntries++;
@@ -692,6 +709,65 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the entries of FillN when the axes cannot be extended
+///
+/// Same as TH1::DoFillNFixBins for the two axes: the contents and the statistics
+/// are the same as the ones of the entry-by-entry filling.
+
+void TH2::DoFillNFixBins(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
+{
+   constexpr Int_t kBlockSize = 256;
+   Int_t binsx[kBlockSize];
+   Int_t binsy[kBlockSize];
+
+   fEntries += ntimes;
+   if (w && !fSumw2.fN && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i * stride] != 1.0) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   const Bool_t useOverflows = GetStatOverflowsBehaviour();
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy;
+
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      fXaxis.FindFixBins(n, x + first * stride, stride, binsx);
+      fYaxis.FindFixBins(n, y + first * stride, stride, binsy);
+      for (Int_t k = 0; k < n; ++k) {
+         const Int_t i = (first + k) * stride;
+         const Int_t binx = binsx[k];
+         const Int_t biny = binsy[k];
+         const Int_t bin = biny*(nbinsx+2) + binx;
+         const Double_t z = w ? w[i] : 1.;
+         if (sumw2) sumw2[bin] += z*z;
+         AddBinContent(bin, z);
+         if (!useOverflows && (binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy)) continue;
+         tsumw   += z;
+         tsumw2  += z*z;
+         tsumwx  += z*x[i];
+         tsumwx2 += z*x[i]*x[i];
+         tsumwy  += z*y[i];
+         tsumwy2 += z*y[i]*y[i];
+         tsumwxy += z*x[i]*y[i];
+      }
+   }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
+   fTsumwy = tsumwy;
+   fTsumwy2 = tsumwy2;
+   fTsumwxy = tsumwxy;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill histogram following distribution in function fname.
@@ -14,6 +14,7 @@
 #include "TClass.h"
 #include "THashList.h"
 #include "TH3.h"
+#include "TH1AtomicFill.h"
 #include "TProfile2D.h"
 #include "TH2.h"
 #include "TF3.h"
@@ -25,8 +26,165 @@
 #include "TMath.h"
 #include "TObjString.h"
 
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 ClassImp(TH3);
 
+namespace {
+
+/// Reads the bin contents of the histogram classes of ROOT from their arrays
+template <typename T>
+struct RArrayContent {
+   const T *fArray;
+   Double_t operator()(Int_t bin) const { return fArray[bin]; }
+};
+
+/// Reads the bin contents of any other class deriving from TH3 through its virtual functions
+struct RVirtualContent {
+   const TH3 *fHist;
+   Double_t operator()(Int_t bin) const { return fHist->GetBinContent(bin); }
+};
+
+/// Adds the bins of h with z bin in [izbegin, izend) to the cells of a projection: the bin (ix, iy, iz) goes to the
+/// cell offset[0][ix] + offset[1][iy] + offset[2][iz] of cont, and the square of its error to the same cell of err2
+/// if not null; it is skipped if one of the offsets is negative. The bins are visited in storage order.
+template <typename CONTENT>
+void SumBins(const TH3 &h, CONTENT content, bool isVirtual, const std::vector<Int_t> *offset, Int_t izbegin,
+             Int_t izend, Double_t *cont, Double_t *err2)
+{
+   const Int_t nx = h.GetNbinsX() + 2;
+   const Int_t ny = h.GetNbinsY() + 2;
+   const Double_t *sumw2 = h.GetSumw2N() ? h.GetSumw2()->GetArray() : nullptr;
+   auto error2 = [&](Int_t bin, Double_t c) {
+      if (isVirtual) {
+         const Double_t e = h.GetBinError(bin);
+         return e * e;
+      }
+      return sumw2 ? sumw2[bin] : TMath::Abs(c);
+   };
+   // When the x axis is summed over, the bins of a row go to the same cell, between the first and last summed ones
+   Int_t ixfirst = nx, ixlast = -1;
+   bool isXSummed = true;
+   for (Int_t ix = 0; ix < nx; ++ix) {
+      if (offset[0][ix] < 0)
+         continue;
+      ixfirst = std::min(ixfirst, ix);
+      ixlast = ix;
+      isXSummed &= offset[0][ix] == offset[0][ixfirst];
+   }
+   if (ixlast < 0)
+      return;
+   for (Int_t ix = ixfirst; ix <= ixlast && isXSummed; ++ix)
+      isXSummed &= offset[0][ix] >= 0;
+
+   for (Int_t iz = izbegin; iz < izend; ++iz) {
+      if (offset[2][iz] < 0)
+         continue;
+      for (Int_t iy = 0; iy < ny; ++iy) {
+         if (offset[1][iy] < 0)
+            continue;
+         const Int_t cell = offset[1][iy] + offset[2][iz];
+         const Int_t row = (iz * ny + iy) * nx;
+         if (isXSummed) {
+            Double_t rowCont = 0;
+            Double_t rowErr2 = 0;
+            for (Int_t bin = row + ixfirst; bin <= row + ixlast; ++bin) {
+               const Double_t c = content(bin);
+               rowCont += c;
+               if (err2)
+                  rowErr2 += error2(bin, c);
+            }
+            cont[cell + offset[0][ixfirst]] += rowCont;
+            if (err2)
+               err2[cell + offset[0][ixfirst]] += rowErr2;
+            continue;
+         }
+         for (Int_t ix = ixfirst; ix <= ixlast; ++ix) {
+            if (offset[0][ix] < 0)
+               continue;
+            const Double_t c = content(row + ix);
+            cont[cell + offset[0][ix]] += c;
+            if (err2)
+               err2[cell + offset[0][ix]] += error2(row + ix, c);
+         }
+      }
+   }
+}
+
+template <typename CONTENT>
+void SumBins(const TH3 &h, CONTENT content, bool isVirtual, const std::vector<Int_t> *offset,
+             std::vector<Double_t> &cont, std::vector<Double_t> *err2)
+{
+   const Int_t nz = h.GetNbinsZ() + 2;
+#ifdef R__USE_IMT
+   // Large histograms are summed by blocks of z bins in parallel, each into its own cells
+   if (!isVirtual && ROOT::IsImplicitMTEnabled() && h.GetNcells() >= (1 << 20)) {
+      ROOT::TThreadExecutor pool;
+      const UInt_t nChunks = std::min<UInt_t>(nz, 4 * pool.GetPoolSize());
+      std::vector<std::vector<Double_t>> chunkCont(nChunks, std::vector<Double_t>(cont.size()));
+      std::vector<std::vector<Double_t>> chunkErr2(err2 ? nChunks : 0, std::vector<Double_t>(cont.size()));
+      pool.Foreach(
+         [&](UInt_t i) {
+            SumBins(h, content, isVirtual, offset, nz * i / nChunks, nz * (i + 1) / nChunks, chunkCont[i].data(),
+                    err2 ? chunkErr2[i].data() : nullptr);
+         },
+         ROOT::TSeq<UInt_t>(0, nChunks));
+      for (UInt_t i = 0; i < nChunks; ++i) {
+         for (std::size_t cell = 0; cell < cont.size(); ++cell) {
+            cont[cell] += chunkCont[i][cell];
+            if (err2)
+               (*err2)[cell] += chunkErr2[i][cell];
+         }
+      }
+      return;
+   }
+#endif
+   SumBins(h, content, isVirtual, offset, 0, nz, cont.data(), err2 ? err2->data() : nullptr);
+}
+
+/// Sums the bins of h into the cells of a projection, as described in SumBins; cont and err2 (if not null) must have
+/// the size of the projection.
+void ProjectBins(const TH3 &h, const std::vector<Int_t> *offset, std::vector<Double_t> &cont,
+                 std::vector<Double_t> *err2)
+{
+   if (h.IsA() == TH3D::Class())
+      SumBins(h, RArrayContent<Double_t>{static_cast<const TH3D &>(h).GetArray()}, false, offset, cont, err2);
+   else if (h.IsA() == TH3F::Class())
+      SumBins(h, RArrayContent<Float_t>{static_cast<const TH3F &>(h).GetArray()}, false, offset, cont, err2);
+   else if (h.IsA() == TH3I::Class())
+      SumBins(h, RArrayContent<Int_t>{static_cast<const TH3I &>(h).GetArray()}, false, offset, cont, err2);
+   else if (h.IsA() == TH3L::Class())
+      SumBins(h, RArrayContent<Long64_t>{static_cast<const TH3L &>(h).GetArray()}, false, offset, cont, err2);
+   else if (h.IsA() == TH3S::Class())
+      SumBins(h, RArrayContent<Short_t>{static_cast<const TH3S &>(h).GetArray()}, false, offset, cont, err2);
+   else if (h.IsA() == TH3C::Class())
+      SumBins(h, RArrayContent<Char_t>{static_cast<const TH3C &>(h).GetArray()}, false, offset, cont, err2);
+   else
+      SumBins(h, RVirtualContent{&h}, true, offset, cont, err2);
+}
+
+/// Index of axis among the axes of h: 0 for x, 1 for y, 2 for z
+Int_t AxisIndex(const TH3 &h, const TAxis *axis)
+{
+   return axis == h.GetXaxis() ? 0 : (axis == h.GetYaxis() ? 1 : 2);
+}
+
+/// Offsets of the bins of axis in the cells of a projection: stride * bin for the bins in [first, last], -1 for the
+/// others
+std::vector<Int_t> GetBinOffsets(const TAxis &axis, Int_t first, Int_t last, Int_t stride)
+{
+   std::vector<Int_t> offset(axis.GetNbins() + 2, -1);
+   for (Int_t bin = std::max(first, 0); bin <= std::min(last, axis.GetNbins() + 1); ++bin)
+      offset[bin] = stride * bin;
+   return offset;
+}
+
+} // anonymous namespace
+
 /** \addtogroup Histograms
 @{
 \class TH3C
@@ -381,6 +539,7 @@ Int_t TH3::Fill(Double_t )
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 {
    if (fBuffer) return BufferFill(x,y,z,1);
+   if (fAtomicFill) return fAtomicFill->Fill(x, y, z, 1.);
 
    Int_t binx, biny, binz, bin;
    fEntries++;
@@ -429,6 +588,7 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,z,w);
+   if (fAtomicFill) return fAtomicFill->Fill(x, y, z, w);
 
    Int_t binx, biny, binz, bin;
    fEntries++;
@@ -1981,25 +2141,6 @@ TH1D *TH3::DoProject1D(const char* name, const char * title, const TAxis* projX,
    }
    R__ASSERT(out1 != nullptr && out2 != nullptr);
 
-   Int_t *refX = nullptr, *refY = nullptr, *refZ = nullptr;
-   Int_t ixbin, out1bin, out2bin;
-   if (projX == GetXaxis()) {
-      refX = &ixbin;
-      refY = &out1bin;
-      refZ = &out2bin;
-   }
-   if (projX == GetYaxis()) {
-      refX = &out1bin;
-      refY = &ixbin;
-      refZ = &out2bin;
-   }
-   if (projX == GetZaxis()) {
-      refX = &out1bin;
-      refY = &out2bin;
-      refZ = &ixbin;
-   }
-   R__ASSERT (refX != nullptr && refY != nullptr && refZ != nullptr);
-
    // Fill the projected histogram excluding underflow/overflows if considered in the option
    // if specified in the option (by default they considered)
    Double_t totcont  = 0;
@@ -2017,32 +2158,28 @@ TH1D *TH3::DoProject1D(const char* name, const char * title, const TAxis* projX,
    if (useUF && !out2->TestBit(TAxis::kAxisRange) )  out2min -= 1;
    if (useOF && !out2->TestBit(TAxis::kAxisRange) )  out2max += 1;
 
+   // sum the bins to be integrated in one pass over the bin contents, into the cells ixbin of sums
+   if (fBuffer) const_cast<TH3 *>(this)->BufferEmpty();
+   const Int_t nsums = projX->GetNbins() + 2;
+   std::vector<Int_t> offset[3];
+   offset[AxisIndex(*this, projX)] = projX->TestBit(TAxis::kAxisRange) ? GetBinOffsets(*projX, ixmin, ixmax, 1)
+                                                                       : GetBinOffsets(*projX, 0, nsums - 1, 1);
+   offset[AxisIndex(*this, out1)] = GetBinOffsets(*out1, out1min, out1max, 0);
+   offset[AxisIndex(*this, out2)] = GetBinOffsets(*out2, out2min, out2max, 0);
+   std::vector<Double_t> sums(nsums);
+   std::vector<Double_t> sumsErr2(computeErrors ? nsums : 0);
+   ProjectBins(*this, offset, sums, computeErrors ? &sumsErr2 : nullptr);
+
    // if the out axis has labels and is extendable, temporary make it non-extendable to avoid adding extra bins
    Bool_t extendable = projX->CanExtend();
    if ( labels && extendable ) h1->GetXaxis()->SetCanExtend(kFALSE);
-   for (ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
+   for (Int_t ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
       if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
 
-      Double_t cont = 0;
-      Double_t err2 = 0;
-
-      // loop on the bins to be integrated (outbin should be called inbin)
-      for (out1bin = out1min; out1bin <= out1max; out1bin++) {
-         for (out2bin = out2min; out2bin <= out2max; out2bin++) {
-
-            Int_t bin = GetBin(*refX, *refY, *refZ);
-
-            // sum the bin contents and errors if needed
-            cont += RetrieveBinContent(bin);
-            if (computeErrors) {
-               Double_t exyz = GetBinError(bin);
-               err2 += exyz*exyz;
-            }
-         }
-      }
+      Double_t cont = sums[ixbin];
       Int_t ix    = h1->FindBin( projX->GetBinCenter(ixbin) );
       h1->SetBinContent(ix ,cont);
-      if (computeErrors) h1->SetBinError(ix, TMath::Sqrt(err2) );
+      if (computeErrors) h1->SetBinError(ix, TMath::Sqrt(sumsErr2[ixbin]) );
       // sum all content
       totcont += cont;
 
@@ -2225,16 +2362,6 @@ TH2D *TH3::DoProject2D(const char* name, const char * title, const TAxis* projX,
       out = GetZaxis();
    }
 
-   Int_t *refX = nullptr, *refY = nullptr, *refZ = nullptr;
-   Int_t ixbin, iybin, outbin;
-   if ( projX == GetXaxis() && projY == GetYaxis() ) { refX = &ixbin;  refY = &iybin;  refZ = &outbin; }
-   if ( projX == GetYaxis() && projY == GetXaxis() ) { refX = &iybin;  refY = &ixbin;  refZ = &outbin; }
-   if ( projX == GetXaxis() && projY == GetZaxis() ) { refX = &ixbin;  refY = &outbin; refZ = &iybin;  }
-   if ( projX == GetZaxis() && projY == GetXaxis() ) { refX = &iybin;  refY = &outbin; refZ = &ixbin;  }
-   if ( projX == GetYaxis() && projY == GetZaxis() ) { refX = &outbin; refY = &ixbin;  refZ = &iybin;  }
-   if ( projX == GetZaxis() && projY == GetYaxis() ) { refX = &outbin; refY = &iybin;  refZ = &ixbin;  }
-   R__ASSERT (refX != nullptr && refY != nullptr && refZ != nullptr);
-
    // Fill the projected histogram excluding underflow/overflows if considered in the option
    // if specified in the option (by default they considered)
    Double_t totcont  = 0;
@@ -2247,34 +2374,34 @@ TH2D *TH3::DoProject2D(const char* name, const char * title, const TAxis* projX,
    if (useUF && !out->TestBit(TAxis::kAxisRange) )  outmin -= 1;
    if (useOF && !out->TestBit(TAxis::kAxisRange) )  outmax += 1;
 
-   for (ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
+   // sum the bins to be integrated in one pass over the bin contents, into the cells ixbin * nysums + iybin of sums
+   if (fBuffer) const_cast<TH3 *>(this)->BufferEmpty();
+   const Int_t nysums = projY->GetNbins() + 2;
+   const Int_t nsums = (projX->GetNbins() + 2) * nysums;
+   std::vector<Int_t> offset[3];
+   offset[AxisIndex(*this, projX)] = projX->TestBit(TAxis::kAxisRange)
+                                        ? GetBinOffsets(*projX, ixmin, ixmax, nysums)
+                                        : GetBinOffsets(*projX, 0, projX->GetNbins() + 1, nysums);
+   offset[AxisIndex(*this, projY)] = projY->TestBit(TAxis::kAxisRange) ? GetBinOffsets(*projY, iymin, iymax, 1)
+                                                                       : GetBinOffsets(*projY, 0, nysums - 1, 1);
+   offset[AxisIndex(*this, out)] = GetBinOffsets(*out, outmin, outmax, 0);
+   std::vector<Double_t> sums(nsums);
+   std::vector<Double_t> sumsErr2(computeErrors ? nsums : 0);
+   ProjectBins(*this, offset, sums, computeErrors ? &sumsErr2 : nullptr);
+
+   for (Int_t ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
       if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
       Int_t ix = h2->GetYaxis()->FindBin( projX->GetBinCenter(ixbin) );
 
-      for (iybin=0;iybin<=1+projY->GetNbins();iybin++) {
+      for (Int_t iybin=0;iybin<=1+projY->GetNbins();iybin++) {
          if ( projY->TestBit(TAxis::kAxisRange) && ( iybin < iymin || iybin > iymax )) continue;
          Int_t iy = h2->GetXaxis()->FindBin( projY->GetBinCenter(iybin) );
 
-         Double_t cont = 0;
-         Double_t err2 = 0;
-
-         // loop on the bins to be integrated (outbin should be called inbin)
-         for (outbin = outmin; outbin <= outmax; outbin++) {
-
-            Int_t bin = GetBin(*refX,*refY,*refZ);
-
-            // sum the bin contents and errors if needed
-            cont += RetrieveBinContent(bin);
-            if (computeErrors) {
-               Double_t exyz = GetBinError(bin);
-               err2 += exyz*exyz;
-            }
-
-         }
+         Double_t cont = sums[ixbin * nysums + iybin];
 
          // remember axis are inverted
          h2->SetBinContent(iy , ix, cont);
-         if (computeErrors) h2->SetBinError(iy, ix, TMath::Sqrt(err2) );
+         if (computeErrors) h2->SetBinError(iy, ix, TMath::Sqrt(sumsErr2[ixbin * nysums + iybin]) );
          // sum all content
          totcont += cont;
 
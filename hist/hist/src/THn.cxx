@@ -157,7 +157,10 @@ A THn is filled just like a regular histogram, using
 THn::Fill(x, weight), where x is a n-dimensional Double_t value.
 To take errors into account, Sumw2() must be called before filling the
 histogram.
-Storage is allocated when the first bin content is stored.
+Storage is allocated when the first bin content is stored. The sum of squares
+of weights is only allocated when it differs from the bin content, i.e. once
+the histogram is filled with a weight other than 1 or its contents or errors
+are set: a THnI or THnF filled with unit weights takes no memory for errors.
 
 ## Projections
 The dimensionality of a THn can be reduced by projecting it to
@@ -217,8 +220,17 @@ void THn::Sumw2() {
    if (!GetCalculateErrors()) {
       fTsumw2 = 0.;
    }
-   // fill sumw2 array with current content
-   TNDArray & content = GetArray();
+   // the sum of squares of weights equals the current content until AllocSumw2()
+   fSumw2.Deallocate();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate the sum of squares of weights, initialized with the current bin
+/// content that it stands for until then.
+
+void THn::AllocSumw2()
+{
+   const TNDArray &content = GetArray();
    Long64_t nbins = GetNbins();
    for (Long64_t ibin = 0; ibin < nbins; ++ibin)
       fSumw2.At(ibin) = content.AtAsDouble(ibin);
@@ -250,5 +262,6 @@ void THn::InitStorage(Int_t* nbins, Int_t /*chunkSize*/)
 void THn::Reset(Option_t* option /*= ""*/)
 {
    GetArray().Reset(option);
-   fSumw2.Reset(option);
+   // zero errors for zero content: no need to keep the storage
+   fSumw2.Deallocate();
 }
@@ -488,6 +488,66 @@ void THnSparseArrayChunk::Sumw2()
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store linidx in the first empty slot of the probe sequence of hash
+
+void THnSparseBinMap::Insert(ULong64_t hash, Long64_t linidx)
+{
+   const ULong64_t mask = fBins.size() - 1;
+   ULong64_t slot = GetSlot(hash);
+   while (fBins[slot])
+      slot = (slot + 1) & mask;
+   fHashes[slot] = hash;
+   fBins[slot] = linidx + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin with linear index linidx and the given hash; the caller
+/// checked with Find() that the bin is not in the table yet.
+
+void THnSparseBinMap::Add(ULong64_t hash, Long64_t linidx)
+{
+   if (2 * (fSize + 1) > GetCapacity())
+      Reserve(fSize + 1);
+   Insert(hash, linidx);
+   ++fSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all bins and free the slots
+
+void THnSparseBinMap::Clear()
+{
+   std::vector<ULong64_t>().swap(fHashes);
+   std::vector<Long64_t>().swap(fBins);
+   fSize = 0;
+   fShift = 64;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make room for nbins bins without rehashing
+
+void THnSparseBinMap::Reserve(Long64_t nbins)
+{
+   Long64_t nslots = 16;
+   Int_t shift = 60;
+   while (nslots < 2 * nbins) {
+      nslots *= 2;
+      --shift;
+   }
+   if (nslots <= GetCapacity())
+      return;
+
+   std::vector<ULong64_t> hashes(nslots);
+   std::vector<Long64_t> bins(nslots);
+   fHashes.swap(hashes);
+   fBins.swap(bins);
+   fShift = shift;
+   for (std::size_t i = 0; i < bins.size(); ++i)
+      if (bins[i])
+         Insert(hashes[i], bins[i] - 1);
+}
+
 
 /** \class THnSparse
     \ingroup Hist
@@ -570,14 +630,13 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open-addressing hash
+table fBins (of the internal class THnSparseBinMap); the coordinates of the
+entry fBins points to is compared to the coordinates passed to GetBin(). If
+they do not match, these two coordinates have the same hash - which is
+extremely unlikely but (for the case where the compact bin coordinates are
+larger than 8 bytes) possible. In this case, the next slots of the probe
+sequence with the same hash are compared until the matching bin is found.
 */
 
 
@@ -658,28 +717,14 @@ void THnSparse::FillExMap()
    THnSparseArrayChunk* chunk = nullptr;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   fBins.Reserve(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBins.Add(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -690,9 +735,7 @@ void THnSparse::Reserve(Long64_t nbins) {
    if (!fBins.GetSize() && fBinContent.GetSize()) {
       FillExMap();
    }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   fBins.Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -792,19 +835,11 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
    ULong64_t hash = cc->GetHash();
    if (fBinContent.GetSize() && !fBins.GetSize())
       FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
-   }
-   if (!allocate) return -1;
+   const Char_t* buf = cc->GetBuffer();
+   Long64_t linidx = fBins.Find(hash, [this, buf](Long64_t idx) {
+      return GetChunk(idx / fChunkSize)->Matches(idx % fChunkSize, buf);
+   });
+   if (linidx >= 0 || !allocate) return linidx;
 
    ++fFilledBins;
 
@@ -819,16 +854,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBins.Add(hash, newidx);
    return newidx;
 }
 
@@ -880,7 +906,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += (sizeof(ULong64_t) + sizeof(Long64_t)) * fBins.GetCapacity() /* THnSparseBinMap */;
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +988,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBins.Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
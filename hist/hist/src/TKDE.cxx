@@ -43,6 +43,11 @@
 #include "TH1.h"
 #include "TVirtualPad.h"
 #include "TKDE.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ClassImp(TKDE);
 
@@ -748,6 +753,37 @@ Double_t TKDE::operator()(Double_t x) const {
    return (*fKernel)(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the density estimate at the n points x, writing the values to values.
+/// With policy ROOT::EExecutionPolicy::kMultiThread (requires IMT), the points
+/// are shared between the threads of the ROOT thread pool; user-defined kernels
+/// are always evaluated sequentially, as they may not be thread safe.
+
+void TKDE::GetValues(UInt_t n, const Double_t *x, Double_t *values, ROOT::EExecutionPolicy policy) const
+{
+   if (!fKernel) {
+      (const_cast<TKDE*>(this))->ReInit();
+      // in case of failed re-initialization
+      if (!fKernel) {
+         std::fill(values, values + n, TMath::QuietNaN());
+         return;
+      }
+   }
+   if (policy == ROOT::EExecutionPolicy::kMultiThread && fKernelType != kUserDefined) {
+#ifdef R__USE_IMT
+      ROOT::TThreadExecutor pool;
+      // a few chunks per thread to balance the load, not so many that scheduling dominates
+      const unsigned nChunks = std::min<unsigned>(n, 4 * pool.GetPoolSize());
+      pool.Foreach([&](UInt_t i) { values[i] = (*fKernel)(x[i]); }, ROOT::TSeq<UInt_t>(0, n), nChunks);
+      return;
+#else
+      Warning("GetValues", "ROOT was built without IMT support: evaluating sequentially");
+#endif
+   }
+   for (UInt_t i = 0; i < n; ++i)
+      values[i] = (*fKernel)(x[i]);
+}
+
 Double_t TKDE::GetMean() const {
    // return the mean of the data
    if (fNewData) (const_cast<TKDE*>(this))->InitFromNewData();
@@ -771,7 +807,9 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 fKDE(kde),
 fNWeights(kde->fData.size()),
 fWeights(1, weight)
-{}
+{
+   SortData();
+}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
    // Gets the adaptive weights (bandwidths) for TKernel internal computation
@@ -780,6 +818,11 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    // we will store computed adaptive weights in weights
    std::vector<Double_t> weights(n, fWeights[0]);
    bool useDataWeights = (fKDE->fBinCount.size() == n);
+   // the fixed kernel at all data points, the expensive part for large data sets
+   std::vector<Double_t> values(n);
+   fKDE->GetValues(n, fKDE->fData.data(), values.data(),
+                   ROOT::IsImplicitMTEnabled() ? ROOT::EExecutionPolicy::kMultiThread
+                                               : ROOT::EExecutionPolicy::kSequential);
    Double_t f = 0.0;
    for (unsigned int i = 0; i < n; ++i) {
       // for negative or null bin contents use the fixed weight value (fWeights[0])
@@ -787,7 +830,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
          weights[i] = fWeights[0];
          continue; // skip negative or null weights
       }
-      f = (*fKDE->fKernel)(fKDE->fData[i]);
+      f = values[i];
       if (f <= 0) {
          // this can happen when data are outside range and fAsymLeft or fAsymRight is on
          fKDE->Warning("ComputeAdativeWeights","function value is zero or negative for x = %f w = %f - set their bandwidth to zero",
@@ -809,6 +852,64 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    transform(weights.begin(), weights.end(), fWeights.begin(),
              std::bind(std::multiplies<Double_t>(), std::placeholders::_1, fKDE->fAdaptiveBandwidthFactor));
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
+   SortData();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the evaluation of the built-in kernels, which vanish beyond a known
+/// distance: sort the data points, with their count and bandwidth, so that an
+/// evaluation only visits the points within that distance, found by binary search.
+
+void TKDE::TKernel::SortData() {
+   fSortedData.clear();
+   fSortedCoefs.clear();
+   fSortedInvWeights.clear();
+   // the support of user-defined kernels is unknown
+   if (fKDE->fKernelType == kUserDefined || fKDE->fKernelType == kTotalKernels)
+      return;
+   const std::vector<Double_t> &data = fKDE->fData;
+   UInt_t n = data.size();
+   // NaN cannot be sorted
+   if (std::any_of(data.begin(), data.end(), [](Double_t d) { return TMath::IsNaN(d); }))
+      return;
+
+   std::vector<UInt_t> order(n);
+   std::iota(order.begin(), order.end(), 0);
+   std::sort(order.begin(), order.end(), [&data](UInt_t i, UInt_t j) { return data[i] < data[j]; });
+
+   Bool_t useCount = (fKDE->fBinCount.size() == n);
+   Bool_t hasAdaptiveWeights = (fWeights.size() == n);
+   Double_t maxWeight = 0;
+   fSortedData.resize(n);
+   fSortedCoefs.resize(n);
+   fSortedInvWeights.resize(n);
+   for (UInt_t k = 0; k < n; ++k) {
+      UInt_t i = order[k];
+      Double_t weight = hasAdaptiveWeights ? fWeights[i] : fWeights[0];
+      fSortedData[k] = data[i];
+      // data points with 0 bandwidth are skipped, see ComputeAdaptiveWeights
+      fSortedInvWeights[k] = (weight != 0) ? 1. / weight : 0.;
+      fSortedCoefs[k] = (useCount ? fKDE->fBinCount[i] : 1.) * fSortedInvWeights[k];
+      maxWeight = std::max(maxWeight, weight);
+   }
+   // GaussianKernel is cut at |x| = 9, the other kernels at |x| = 1
+   fRadius = (fKDE->fKernelType == kGaussian ? 9. : 1.) * maxWeight;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sum of the kernels of the sorted data points within fRadius of x.
+
+template <class KERNEL>
+Double_t TKDE::TKernel::SumSorted(Double_t x, KERNEL kernel) const {
+   auto first = std::lower_bound(fSortedData.begin(), fSortedData.end(), x - fRadius) - fSortedData.begin();
+   auto last = std::upper_bound(fSortedData.begin() + first, fSortedData.end(), x + fRadius) - fSortedData.begin();
+   const Double_t *data = fSortedData.data();
+   const Double_t *coefs = fSortedCoefs.data();
+   const Double_t *invWeights = fSortedInvWeights.data();
+   Double_t result = 0;
+   for (auto i = first; i < last; ++i)
+      result += coefs[i] * kernel((x - data[i]) * invWeights[i]);
+   return result;
 }
 
 Double_t TKDE::TKernel::GetWeight(Double_t x) const {
@@ -1009,6 +1110,34 @@ const std::vector<Double_t> & TKDE::TKernel::GetAdaptiveWeights() const {
 
 Double_t TKDE::TKernel::operator()(Double_t x) const {
    // The internal class's unary function: returns the kernel density estimate
+   // the sorted data are out of date if data have been filled since
+   if (fSortedData.empty() || fSortedData.size() != fKDE->fData.size())
+      return SumAll(x);
+
+   const TKDE *kde = fKDE;
+   // the built-in kernels are even: the asymmetric mirror image of a data point d in xmin, 2 * xmin - d,
+   // contributes kernel(x - 2 * xmin + d) = kernel((2 * xmin - x) - d)
+   auto sum = [&](Double_t y) -> Double_t {
+      switch (kde->fKernelType) {
+         case kGaussian: return SumSorted(y, [kde](Double_t u) { return kde->GaussianKernel(u); });
+         case kEpanechnikov: return SumSorted(y, [kde](Double_t u) { return kde->EpanechnikovKernel(u); });
+         case kBiweight: return SumSorted(y, [kde](Double_t u) { return kde->BiweightKernel(u); });
+         default: return SumSorted(y, [kde](Double_t u) { return kde->CosineArchKernel(u); });
+      }
+   };
+   Double_t result = sum(x);
+   if (kde->fAsymLeft)
+      result += sum(2. * kde->fXMin - x);
+   if (kde->fAsymRight)
+      result += sum(2. * kde->fXMax - x);
+   if ( TMath::IsNaN(result) ) {
+      fKDE->Warning("operator()","Result is NaN for  x %f \n",x);
+   }
+   return result / kde->fSumOfCounts;
+}
+
+Double_t TKDE::TKernel::SumAll(Double_t x) const {
+   // Returns the kernel density estimate, summing the kernel function over all data points
    Double_t result(0.0);
    UInt_t n = fKDE->fData.size();
    // case of bins or weighted data
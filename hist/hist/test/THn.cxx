@@ -1,9 +1,14 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 // Filling THn
 TEST(THn, Fill) {
    Int_t bins[2] = {2, 3};
@@ -144,3 +149,73 @@ TEST(THn, GetBinCenter)
    EXPECT_DOUBLE_EQ(centers.at(0), 2.5);
    EXPECT_DOUBLE_EQ(centers.at(1), -1.5);
 }
+
+// Bin lookup of THnSparse, with compact coordinates smaller and larger than 8 bytes
+// Errors of unit-weight fills are taken from the content until another weight comes
+TEST(THn, LazySumw2)
+{
+   Int_t bins[2] = {4, 3};
+   Double_t xmin[2] = {0., -3.};
+   Double_t xmax[2] = {4., 3.};
+   THnI hn("hn", "hn", 2, bins, xmin, xmax);
+   hn.Sumw2();
+   const Double_t x0[2] = {0.5, 0.5};
+   const Double_t x1[2] = {2.5, -2.5};
+   for (int i = 0; i < 5; ++i)
+      hn.Fill(x0);
+   hn.Fill(x1);
+   EXPECT_DOUBLE_EQ(5., hn.GetBinError2(hn.GetBin(x0)));
+   EXPECT_DOUBLE_EQ(1., hn.GetBinError2(hn.GetBin(x1)));
+
+   hn.Fill(x1, 3.);
+   hn.Fill(x0);
+   EXPECT_DOUBLE_EQ(6., hn.GetBinContent(hn.GetBin(x0)));
+   EXPECT_DOUBLE_EQ(6., hn.GetBinError2(hn.GetBin(x0)));
+   EXPECT_DOUBLE_EQ(4., hn.GetBinContent(hn.GetBin(x1)));
+   EXPECT_DOUBLE_EQ(10., hn.GetBinError2(hn.GetBin(x1)));
+   EXPECT_DOUBLE_EQ(1. * 7 + 9., hn.GetSumw2());
+
+   hn.SetBinContent(hn.GetBin(x0), 2.);
+   EXPECT_DOUBLE_EQ(6., hn.GetBinError2(hn.GetBin(x0)));
+
+   hn.Reset();
+   EXPECT_DOUBLE_EQ(0., hn.GetBinError2(hn.GetBin(x1)));
+   hn.Fill(x1);
+   EXPECT_DOUBLE_EQ(1., hn.GetBinError2(hn.GetBin(x1)));
+}
+
+TEST(THnSparse, GetBin)
+{
+   for (Int_t nbinsPerDim : {4, 1000}) {
+      const Int_t dim = 10;
+      std::vector<Int_t> bins(dim, nbinsPerDim);
+      std::vector<Double_t> xmin(dim, 0.), xmax(dim, 1.);
+      THnSparseD hs("hs", "hs", dim, bins.data(), xmin.data(), xmax.data(), /*chunksize*/ 100);
+
+      std::map<std::vector<Int_t>, Double_t> expected;
+      std::vector<Int_t> coord(dim);
+      for (Int_t i = 0; i < 5000; ++i) {
+         for (Int_t d = 0; d < dim; ++d)
+            coord[d] = 1 + (i * (d + 3) * 7919 + d) % nbinsPerDim;
+         const Double_t w = 1 + i % 5;
+         hs.SetBinContent(hs.GetBin(coord.data()), hs.GetBinContent(coord.data()) + w);
+         expected[coord] += w;
+      }
+      EXPECT_EQ(static_cast<Long64_t>(expected.size()), hs.GetNbins());
+      for (const auto &bin : expected) {
+         const Long64_t linidx = hs.GetBin(bin.first.data(), kFALSE);
+         ASSERT_GE(linidx, 0);
+         EXPECT_DOUBLE_EQ(bin.second, hs.GetBinContent(linidx));
+      }
+      coord.assign(dim, 1);
+      coord[0] = 2;
+      if (!expected.count(coord)) {
+         EXPECT_EQ(-1, hs.GetBin(coord.data(), kFALSE));
+      }
+
+      // the lookup table is rebuilt from the chunks, as after reading from a file
+      std::unique_ptr<THnSparse> clone(static_cast<THnSparse *>(hs.Clone()));
+      for (const auto &bin : expected)
+         EXPECT_DOUBLE_EQ(bin.second, clone->GetBinContent(clone->GetBin(bin.first.data(), kFALSE)));
+   }
+}
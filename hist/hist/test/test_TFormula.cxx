@@ -2,8 +2,34 @@
 
 #include "TFormula.h"
 
+#include <vector>
+
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Test that EvalBatch gives the same values as EvalPar
+TEST(TFormula, EvalBatch)
+{
+  TFormula f("batch", "[0] * sin(x) + [1] * y * y");
+  const double params[2] = {2., 0.5};
+  f.SetParameters(params);
+
+  const int n = 37;
+  std::vector<double> x(2 * n);
+  for (int i = 0; i < n; ++i) {
+    x[2 * i] = 0.1 * i;
+    x[2 * i + 1] = 1. - 0.05 * i;
+  }
+  std::vector<double> result(n);
+  f.EvalBatch(n, x.data(), result.data());
+  for (int i = 0; i < n; ++i)
+    EXPECT_DOUBLE_EQ(f.EvalPar(&x[2 * i]), result[i]);
+
+  const double otherParams[2] = {-1., 3.};
+  f.EvalBatch(n, x.data(), result.data(), otherParams);
+  for (int i = 0; i < n; ++i)
+    EXPECT_DOUBLE_EQ(f.EvalPar(&x[2 * i], otherParams), result[i]);
+}
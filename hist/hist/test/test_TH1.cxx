@@ -1,9 +1,15 @@
 #include "gtest/gtest.h"
 
 #include "TH1.h"
+#include "TH1D.h"
 #include "TH1F.h"
+#include "TH2F.h"
 #include "THLimitsFinder.h"
+#include "TROOT.h"
 
+#include <limits>
+#include <memory>
+#include <thread>
 #include <vector>
 
 // StatOverflows TH1
@@ -63,3 +69,114 @@ TEST(TH1, SmoothArrayCrossCheck)
       EXPECT_FLOAT_EQ(arr2[i], 1.0);
    }
 }
+
+// FillN must give the same contents and statistics as filling entry by entry
+TEST(TH1, FillNSameAsFill)
+{
+   const Double_t edges[] = {-3., -1., -0.5, 0., 0.25, 2., 5.};
+   TH1D hFix1("hFix1", "", 37, -2.5, 2.5);
+   TH1D hFixN("hFixN", "", 37, -2.5, 2.5);
+   TH1D hVar1("hVar1", "", 6, edges);
+   TH1D hVarN("hVarN", "", 6, edges);
+
+   std::vector<Double_t> x, w;
+   for (int i = 0; i < 1000; ++i) {
+      x.push_back(-6. + 12. * ((i * 7919) % 1000) / 1000.);
+      w.push_back(i < 500 ? 1. : 0.5 + (i % 3));
+   }
+   x.push_back(std::numeric_limits<Double_t>::quiet_NaN());
+   w.push_back(1.);
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      hFix1.Fill(x[i], w[i]);
+      hVar1.Fill(x[i], w[i]);
+      EXPECT_EQ(hFix1.GetXaxis()->FindFixBin(x[i]), hFix1.FindFixBin(x[i]));
+   }
+   hFixN.FillN(x.size(), x.data(), w.data());
+   hVarN.FillN(x.size(), x.data(), w.data());
+
+   for (auto hists : {std::make_pair(&hFix1, &hFixN), std::make_pair(&hVar1, &hVarN)}) {
+      for (int bin = 0; bin <= hists.first->GetNbinsX() + 1; ++bin) {
+         EXPECT_DOUBLE_EQ(hists.first->GetBinContent(bin), hists.second->GetBinContent(bin));
+         EXPECT_DOUBLE_EQ(hists.first->GetBinError(bin), hists.second->GetBinError(bin));
+      }
+      Double_t stats1[4], statsN[4];
+      hists.first->GetStats(stats1);
+      hists.second->GetStats(statsN);
+      for (int i = 0; i < 4; ++i)
+         EXPECT_DOUBLE_EQ(stats1[i], statsN[i]);
+      EXPECT_EQ(hists.first->GetEntries(), hists.second->GetEntries());
+   }
+}
+
+// Filling from several threads in atomic fill mode gives the same histogram as the serial filling
+TEST(TH1, AtomicFill)
+{
+   TH1D h1("h1", "", 50, -2.5, 2.5);
+   TH1D h1Atomic("h1Atomic", "", 50, -2.5, 2.5);
+   TH2F h2("h2", "", 20, -2., 2., 10, 0., 1.);
+   TH2F h2Atomic("h2Atomic", "", 20, -2., 2., 10, 0., 1.);
+   h1Atomic.SetAtomicFill();
+   h2Atomic.SetAtomicFill();
+   EXPECT_TRUE(h1Atomic.IsAtomicFill());
+
+   // the weights are small integers, so that the sums do not depend on the order of the additions
+   auto x = [](int i) { return -3. + 6. * ((i * 7919) % 1000) / 1000.; };
+   auto y = [](int i) { return ((i * 104729) % 1000) / 1000.; };
+   auto w = [](int i) { return 1. + i % 3; };
+   constexpr int kNThreads = 4;
+   constexpr int kNPerThread = 10000;
+   for (int i = 0; i < kNThreads * kNPerThread; ++i) {
+      h1.Fill(x(i), w(i));
+      h2.Fill(x(i), y(i), w(i));
+   }
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         for (int i = t * kNPerThread; i < (t + 1) * kNPerThread; ++i) {
+            h1Atomic.Fill(x(i), w(i));
+            h2Atomic.Fill(x(i), y(i), w(i));
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   h1Atomic.SetAtomicFill(kFALSE);
+   h2Atomic.SetAtomicFill(kFALSE);
+   EXPECT_FALSE(h1Atomic.IsAtomicFill());
+
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), h1Atomic.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(h1.GetBinError(bin), h1Atomic.GetBinError(bin));
+   }
+   for (int bin = 0; bin < h2.GetNcells(); ++bin) {
+      EXPECT_FLOAT_EQ(h2.GetBinContent(bin), h2Atomic.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(h2.GetBinError(bin), h2Atomic.GetBinError(bin));
+   }
+   EXPECT_EQ(h1.GetEntries(), h1Atomic.GetEntries());
+   EXPECT_EQ(h2.GetEntries(), h2Atomic.GetEntries());
+   EXPECT_NEAR(h1.GetMean(), h1Atomic.GetMean(), 1e-12);
+   EXPECT_NEAR(h1.GetStdDev(), h1Atomic.GetStdDev(), 1e-12);
+   EXPECT_NEAR(h2.GetCorrelationFactor(), h2Atomic.GetCorrelationFactor(), 1e-12);
+}
+
+// Objects created while TNoGlobalRegistrationRAII is alive are not added to gDirectory, in the current thread only
+TEST(TH1, NoGlobalRegistration)
+{
+   EXPECT_TRUE(ROOT::IsGlobalRegistrationEnabled());
+   {
+      ROOT::TNoGlobalRegistrationRAII noRegistration;
+      EXPECT_FALSE(ROOT::IsGlobalRegistrationEnabled());
+      std::thread([] { EXPECT_TRUE(ROOT::IsGlobalRegistrationEnabled()); }).join();
+
+      TH1D h("hNoRegistration", "", 10, 0, 1);
+      EXPECT_EQ(nullptr, h.GetDirectory());
+      EXPECT_EQ(nullptr, gDirectory->FindObject("hNoRegistration"));
+      std::unique_ptr<TH1> clone(static_cast<TH1 *>(h.Clone("hNoRegistrationClone")));
+      EXPECT_EQ(nullptr, clone->GetDirectory());
+      // The global flag is not modified
+      EXPECT_TRUE(TH1::AddDirectoryStatus());
+   }
+   EXPECT_TRUE(ROOT::IsGlobalRegistrationEnabled());
+   TH1D h("hRegistration", "", 10, 0, 1);
+   EXPECT_EQ(gDirectory, h.GetDirectory());
+}
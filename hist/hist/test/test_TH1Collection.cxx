@@ -0,0 +1,58 @@
+#include "TH1Collection.h"
+#include "TH1F.h"
+#include "TMemFile.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+
+TEST(TH1Collection, WriteReadGet)
+{
+   TH1Collection coll("coll", "test collection");
+   const double edges[] = {0., 1., 3., 7.};
+   for (int i = 0; i < 100; ++i) {
+      const auto name = "h" + std::to_string(i);
+      std::unique_ptr<TH1F> h(i % 10 ? new TH1F(name.c_str(), "fixed", 20, -1., 1.)
+                                     : new TH1F(name.c_str(), "variable", 3, edges));
+      h->SetDirectory(nullptr);
+      h->GetXaxis()->SetTitle("x");
+      if (i % 2)
+         h->Sumw2();
+      for (int j = 0; j <= i; ++j)
+         h->Fill(-1.2 + 0.01 * j, 1. + (i % 2));
+      EXPECT_TRUE(coll.Add(*h));
+   }
+   // same name
+   TH1F dup("h3", "", 20, -1., 1.);
+   dup.SetDirectory(nullptr);
+   EXPECT_FALSE(coll.Add(dup));
+   EXPECT_EQ(coll.GetSize(), 100);
+   EXPECT_EQ(coll.GetNaxes(), 2);
+
+   TMemFile file("th1collection.root", "RECREATE");
+   file.WriteObject(&coll, "coll");
+   auto read = file.Get<TH1Collection>("coll");
+   ASSERT_NE(read, nullptr);
+   EXPECT_EQ(read->GetSize(), 100);
+   EXPECT_EQ(read->Get("nonexistent"), nullptr);
+
+   for (int i = 0; i < 100; i += 7) {
+      const auto name = "h" + std::to_string(i);
+      std::unique_ptr<TH1F> expected(coll.Get(name.c_str()));
+      std::unique_ptr<TH1F> h(read->Get(name.c_str()));
+      ASSERT_NE(h, nullptr);
+      EXPECT_EQ(h->GetDirectory(), nullptr);
+      EXPECT_STREQ(h->GetTitle(), i % 10 ? "fixed" : "variable");
+      EXPECT_STREQ(h->GetXaxis()->GetTitle(), "x");
+      ASSERT_EQ(h->GetNbinsX(), i % 10 ? 20 : 3);
+      EXPECT_EQ(h->GetSumw2N() != 0, i % 2 == 1);
+      EXPECT_EQ(h->GetEntries(), i + 1);
+      EXPECT_DOUBLE_EQ(h->GetMean(), expected->GetMean());
+      for (int bin = 0; bin <= h->GetNbinsX() + 1; ++bin) {
+         EXPECT_FLOAT_EQ(h->GetBinContent(bin), expected->GetBinContent(bin));
+         EXPECT_FLOAT_EQ(h->GetBinError(bin), expected->GetBinError(bin));
+         EXPECT_DOUBLE_EQ(h->GetXaxis()->GetBinLowEdge(bin), expected->GetXaxis()->GetBinLowEdge(bin));
+      }
+   }
+}
@@ -1,11 +1,15 @@
 #include "TH2F.h"
 #include "TH3F.h"
+#include "TH3.h"
+#include "TRandom3.h"
 #include "TProfile.h"   // ProjectionX
 #include "TProfile2D.h" // ProjectionX
 #include "THashList.h"  // GetLabels
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+
 template <typename V1, typename V2>
 void expect_list_eq_names(const V1 &v1, const V2 &v2)
 {
@@ -85,3 +89,51 @@ TEST(Projections, Issue_6658_Profile2D)
    EXPECT_EQ(xaxis_2d_nbins, xaxis_pxy_nbins);
    expect_list_eq_names(*labels_2d, *labels_pxy);
 }
+
+// Test the 1D and 2D projections of a TH3 against the sums of its bins, with ranges on the summed axes
+TEST(Projections, TH3Sums)
+{
+   TH3D h3("h3sums", "", 6, 0, 6, 7, 0, 7, 8, 0, 8);
+   h3.Sumw2();
+   TRandom3 rng(1);
+   for (int i = 0; i < 5000; ++i)
+      h3.Fill(rng.Uniform(-1, 7), rng.Uniform(-1, 8), rng.Uniform(-1, 9), rng.Uniform(0.5, 2));
+   h3.GetYaxis()->SetRange(2, 5);
+
+   // x: summed over y in [2, 5] and over all z
+   auto *px = static_cast<TH1D *>(h3.Project3D("x"));
+   for (int ix = 0; ix <= 7; ++ix) {
+      double cont = 0, err2 = 0;
+      for (int iy = 2; iy <= 5; ++iy) {
+         for (int iz = 0; iz <= 9; ++iz) {
+            cont += h3.GetBinContent(ix, iy, iz);
+            err2 += h3.GetBinError(ix, iy, iz) * h3.GetBinError(ix, iy, iz);
+         }
+      }
+      EXPECT_NEAR(px->GetBinContent(ix), cont, 1e-9 * std::abs(cont));
+      EXPECT_NEAR(px->GetBinError(ix), std::sqrt(err2), 1e-9 * std::sqrt(err2));
+   }
+
+   // zx: z versus x, summed over y in [2, 5]
+   auto *pzx = static_cast<TH2D *>(h3.Project3D("zx"));
+   for (int ix = 0; ix <= 7; ++ix) {
+      for (int iz = 0; iz <= 9; ++iz) {
+         double cont = 0;
+         for (int iy = 2; iy <= 5; ++iy)
+            cont += h3.GetBinContent(ix, iy, iz);
+         EXPECT_NEAR(pzx->GetBinContent(ix, iz), cont, 1e-9 * std::abs(cont));
+      }
+   }
+
+   // y: restricted to [2, 5], summed over all x and z
+   auto *py = static_cast<TH1D *>(h3.Project3D("y"));
+   ASSERT_EQ(py->GetNbinsX(), 4);
+   for (int iy = 2; iy <= 5; ++iy) {
+      double cont = 0;
+      for (int ix = 0; ix <= 7; ++ix) {
+         for (int iz = 0; iz <= 9; ++iz)
+            cont += h3.GetBinContent(ix, iy, iz);
+      }
+      EXPECT_NEAR(py->GetBinContent(iy - 1), cont, 1e-9 * std::abs(cont));
+   }
+}
@@ -2,11 +2,20 @@
 #include "TClass.h"
 #include "TFitResult.h"
 #include "TH1F.h"
+#include "TH2D.h"
+#include "TH3D.h"
 #include "TF1.h"
+#include "TF2.h"
+#include "TRandom3.h"
+#include "HFitInterface.h"
+#include "Fit/BinData.h"
+#include "Fit/FitUtil.h"
+#include "Math/WrappedMultiTF1.h"
 
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <vector>
 
 template<typename T>
 std::unique_ptr<T> SerialiseDeserialise(const T &f)
@@ -46,4 +55,95 @@ TEST(TF1, PersistentNumber)
 
    res = h.Fit(f1_d.get(), "SQN");
    EXPECT_EQ(0, res->Status());
-}
\ No newline at end of file
+}
+// The chi2 and the Poisson likelihood are computed evaluating the function for batches of bins
+TEST(TF1, BatchedFitMethodFunctions)
+{
+   TRandom3 rndm(42);
+   TH1D h1("h1", "h1", 1000, -5, 5);
+   TH2D h2("h2", "h2", 50, -3, 3, 40, -3, 3);
+   for (int i = 0; i < 100000; ++i) {
+      h1.Fill(rndm.Gaus(0, 1));
+      h2.Fill(rndm.Gaus(0, 1), rndm.Gaus(0, 1));
+   }
+   TF1 f1("f1", "[0]*exp(-0.5*((x-[1])/[2])^2)", -5, 5);
+   TF2 f2("f2", "[0]*exp(-0.5*(x*x+y*y)/([1]*[1]))", -3, 3, -3, 3);
+   const double p1[] = {350, 0.1, 1.1};
+   const double p2[] = {100, 0.9};
+
+   auto check = [](TF1 &f, const TH1 &h, const double *p) {
+      ROOT::Fit::BinData data;
+      ROOT::Fit::FillData(data, &h);
+      ROOT::Math::WrappedMultiTF1 func(f, f.GetNdim());
+
+      double chi2 = 0;
+      double nll = 0;
+      std::vector<double> x(data.NDim());
+      for (unsigned int i = 0; i < data.Size(); ++i) {
+         for (unsigned int j = 0; j < data.NDim(); ++j)
+            x[j] = *data.GetCoordComponent(i, j);
+         const double fval = f.EvalPar(x.data(), p);
+         const double y = data.Value(i);
+         chi2 += std::pow((y - fval) * data.InvError(i), 2);
+         nll += fval - y + (y > 0 ? y * (std::log(y) - std::log(fval)) : 0.);
+      }
+
+      std::vector<ROOT::EExecutionPolicy> policies{ROOT::EExecutionPolicy::kSequential};
+#ifdef R__USE_IMT
+      policies.push_back(ROOT::EExecutionPolicy::kMultiThread);
+#endif
+      for (auto policy : policies) {
+         unsigned int nPoints = 0;
+         EXPECT_NEAR(ROOT::Fit::FitUtil::EvaluateChi2(func, data, p, nPoints, policy), chi2, 1.E-10 * chi2);
+         EXPECT_NEAR(ROOT::Fit::FitUtil::EvaluatePoissonLogL(func, data, p, 0, true, nPoints, policy), nll,
+                     1.E-10 * nll);
+      }
+   };
+   check(f1, h1, p1);
+   check(f2, h2, p2);
+}
+
+// The fit data of a histogram contain only the non-empty bins in the axis ranges
+TEST(TF1, FillDataSkipsEmptyBins)
+{
+   TRandom3 rndm(7);
+   TH3D h("h3", "h3", 40, -4, 4, 30, -3, 3, 20, -2, 2);
+   for (int i = 0; i < 2000; ++i)
+      h.Fill(rndm.Gaus(0, 1), rndm.Gaus(0, 1), rndm.Gaus(0, 1));
+   h.GetXaxis()->SetRange(5, 30);
+
+   ROOT::Fit::BinData data;
+   ROOT::Fit::FillData(data, &h);
+
+   unsigned int n = 0;
+   for (int binx = 5; binx <= 30; ++binx) {
+      for (int biny = 1; biny <= 30; ++biny) {
+         for (int binz = 1; binz <= 20; ++binz) {
+            const double value = h.GetBinContent(binx, biny, binz);
+            if (value == 0)
+               continue;
+            ASSERT_LT(n, data.Size());
+            EXPECT_DOUBLE_EQ(*data.GetCoordComponent(n, 0), h.GetXaxis()->GetBinCenter(binx));
+            EXPECT_DOUBLE_EQ(*data.GetCoordComponent(n, 1), h.GetYaxis()->GetBinCenter(biny));
+            EXPECT_DOUBLE_EQ(*data.GetCoordComponent(n, 2), h.GetZaxis()->GetBinCenter(binz));
+            EXPECT_DOUBLE_EQ(data.Value(n), value);
+            EXPECT_DOUBLE_EQ(data.Error(n), h.GetBinError(binx, biny, binz));
+            ++n;
+         }
+      }
+   }
+   EXPECT_EQ(data.Size(), n);
+}
+
+// The batch GetRandom must give the same numbers as repeated single calls
+TEST(TF1, GetRandomBatch)
+{
+   for (const char *opt : {"LIN", "LOG"}) {
+      TF1 f("fBatch", "exp(-x)*(1+x)", 0.1, 10);
+      TRandom3 rng1(7), rng2(7);
+      std::vector<double> batch(1001);
+      f.GetRandom(batch.size(), batch.data(), &rng1, opt);
+      for (auto x : batch)
+         EXPECT_EQ(x, f.GetRandom(&rng2, opt));
+   }
+}
@@ -496,4 +496,50 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+// Test the evaluation of the built-in kernels on the sorted data points against a sum over all points
+TEST(TKDE, tkde_values)
+{
+   TRandom3 r(4242);
+   const int n = 2000;
+   std::vector<double> data(n);
+   for (auto &d : data)
+      d = r.Gaus(5, 2);
+
+   for (const char *kernel : {"Gaussian", "Epanechnikov", "Biweight", "CosineArch"}) {
+      TString opt = TString::Format("KernelType:%s;Iteration:Fixed;Mirror:noMirror;Binning:Unbinned", kernel);
+      TKDE kde(n, data.data(), -5., 15., opt, 1);
+      const double h = kde.GetFixedWeight();
+      const int npoints = 101;
+      std::vector<double> x(npoints);
+      for (int i = 0; i < npoints; ++i)
+         x[i] = -5. + 0.2 * i;
+
+      std::vector<double> values(npoints);
+      kde.GetValues(npoints, x.data(), values.data());
+      for (int i = 0; i < npoints; ++i) {
+         double expected = 0;
+         for (double d : data) {
+            const double u = (x[i] - d) / h;
+            if (TString(kernel) == "Gaussian")
+               expected += (std::abs(u) < 9) ? std::exp(-0.5 * u * u) / std::sqrt(2 * M_PI) : 0;
+            else if (TString(kernel) == "Epanechnikov")
+               expected += (std::abs(u) < 1) ? 0.75 * (1 - u * u) : 0;
+            else if (TString(kernel) == "Biweight")
+               expected += (std::abs(u) < 1) ? 15. / 16. * (1 - u * u) * (1 - u * u) : 0;
+            else
+               expected += (std::abs(u) < 1) ? M_PI_4 * std::cos(M_PI_2 * u) : 0;
+         }
+         expected /= n * h;
+         EXPECT_NEAR(expected, values[i], 1.E-12 * (1 + expected)) << kernel << " at x = " << x[i];
+         EXPECT_DOUBLE_EQ(values[i], kde(x[i]));
+      }
+
+#ifdef R__USE_IMT
+      std::vector<double> valuesMT(npoints);
+      kde.GetValues(npoints, x.data(), valuesMT.data(), ROOT::EExecutionPolicy::kMultiThread);
+      for (int i = 0; i < npoints; ++i)
+         EXPECT_EQ(values[i], valuesMT[i]);
+#endif
+   }
+}
@@ -61,10 +61,12 @@ public:
    void           SetHighlight(TGraph *theGraph) override;
    void           Smooth(TGraph *theGraph, Int_t npoints, Double_t *x, Double_t *y, Int_t drawtype);
    static void    SetMaxPointsPerLine(Int_t maxp=50);
+   static void    SetMaxPointsPerPixel(Int_t maxp=0);
 
 protected:
 
    static Int_t   fgMaxPointsPerLine;  ///< Number of points per chunks' line when drawing a graph.
+   static Int_t   fgMaxPointsPerPixel; ///< Number of points per pixel column above which graph lines are reduced.
 
    std::vector<Double_t> gxwork, gywork, gxworkl, gyworkl; ///< Internal buffers for coordinates. Used for graphs painting.
 
@@ -42,11 +42,41 @@
 #include <memory>
 
 Int_t TGraphPainter::fgMaxPointsPerLine = 50;
+Int_t TGraphPainter::fgMaxPointsPerPixel = 0;
 
 static Int_t    gHighlightPoint  = -1;         // highlight point of graph
 static TGraph  *gHighlightGraph  = nullptr;    // pointer to graph with highlight point
 static std::unique_ptr<TMarker> gHighlightMarker;    // highlight marker
 
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce the consecutive points of a line falling in the same pixel column of gPad to
+/// the first, lowest, highest and last of them (in their original order), which draw
+/// the same vertical segment. Returns the number of points kept in xr and yr.
+
+static Int_t ReducePointsPerPixel(Int_t npoints, const Double_t *x, const Double_t *y,
+                                  std::vector<Double_t> &xr, std::vector<Double_t> &yr)
+{
+   xr.clear();
+   yr.clear();
+   Int_t i = 0;
+   while (i < npoints) {
+      Int_t px = gPad->XtoAbsPixel(gPad->XtoPad(x[i]));
+      Int_t imin = i, imax = i, j = i+1;
+      for (; j < npoints && gPad->XtoAbsPixel(gPad->XtoPad(x[j])) == px; j++) {
+         if (y[j] < y[imin]) imin = j;
+         if (y[j] > y[imax]) imax = j;
+      }
+      Int_t kept[4] = {i, TMath::Min(imin, imax), TMath::Max(imin, imax), j-1};
+      for (Int_t k = 0; k < 4; k++) {
+         if (k > 0 && kept[k] == kept[k-1]) continue;
+         xr.push_back(x[kept[k]]);
+         yr.push_back(y[kept[k]]);
+      }
+      i = j;
+   }
+   return xr.size();
+}
+
 ClassImp(TGraphPainter);
 
 
@@ -1450,18 +1480,28 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
    gyworkl.resize(2*npoints+10);
 
    if (optionLine || optionFill) {
-      x1    = x[0];
-      xn    = x[npoints-1];
-      y1    = y[0];
-      yn    = y[npoints-1];
-      nloop = npoints;
+      // Level of detail: reduce the points of a line painted in the same pixel column
+      Int_t nline = npoints;
+      const Double_t *xline = x, *yline = y;
+      std::vector<Double_t> xreduced, yreduced;
+      if (optionLine && !optionFill && !optionR && fgMaxPointsPerPixel > 0 &&
+          npoints > fgMaxPointsPerPixel * gPad->GetAbsWNDC() * gPad->GetWw()) {
+         nline  = ReducePointsPerPixel(npoints, x, y, xreduced, yreduced);
+         xline  = xreduced.data();
+         yline  = yreduced.data();
+      }
+      x1    = xline[0];
+      xn    = xline[nline-1];
+      y1    = yline[0];
+      yn    = yline[nline-1];
+      nloop = nline;
       if (optionFill && (xn != x1 || yn != y1)) nloop++;
       npt = 0;
       for (i=1;i<=nloop;i++) {
-         if (i > npoints) {
+         if (i > nline) {
             gxwork[npt] = gxwork[0];  gywork[npt] = gywork[0];
          } else {
-            gxwork[npt] = x[i-1];      gywork[npt] = y[i-1];
+            gxwork[npt] = xline[i-1];  gywork[npt] = yline[i-1];
             npt++;
          }
          if (i == nloop) {
@@ -5409,3 +5449,18 @@ void TGraphPainter::SetMaxPointsPerLine(Int_t maxp)
    fgMaxPointsPerLine = maxp;
    if (maxp < 50) fgMaxPointsPerLine = 50;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to set `fgMaxPointsPerPixel` for graph painting. When a graph
+/// painted with a line (option "L", or no option) has more than `fgMaxPointsPerPixel`
+/// points per pixel column of the pad, the consecutive points falling in the same pixel
+/// column are reduced to the first, lowest, highest and last of them. The painted line
+/// covers the same pixels, while the screen, PDF and PostScript outputs of graphs with
+/// millions of points stay small. The reduction is done each time the graph is painted,
+/// hence according to the current zoom. `0` (default) disables the reduction, for instance:
+/// `TGraphPainter::SetMaxPointsPerPixel(4)`.
+
+void TGraphPainter::SetMaxPointsPerPixel(Int_t maxp)
+{
+   fgMaxPointsPerPixel = maxp < 0 ? 0 : maxp;
+}
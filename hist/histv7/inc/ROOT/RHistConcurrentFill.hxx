@@ -19,7 +19,12 @@
 #include "ROOT/RSpan.hxx"
 #include "ROOT/RHistBufferedFill.hxx"
 
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -71,6 +76,15 @@ private:
  buffer calls to Fill() until the buffer is full, and then swap the buffer
  with that of the RHistConcurrentFillManager. The manager than fills the
  histogram.
+
+ By default all flushes go to the histogram under one mutex. With `nShards` > 1,
+ the manager additionally owns `nShards - 1` empty copies of the histogram,
+ each with its own mutex: a flush goes to the first shard that is not locked,
+ starting from one that depends on the calling thread, so that up to `nShards`
+ flushes run in parallel. The copies are added to the histogram by
+ MergeShards(), at the latest when the manager is destroyed; the histogram
+ content is only complete then. Sharding needs axes that do not grow, as the
+ copies must keep the binning of the histogram.
  **/
 
 template <class HIST, int SIZE = 1024>
@@ -83,26 +97,82 @@ public:
    using Weight_t = typename HIST::Weight_t;
 
 private:
+   /// A histogram that flushes can fill, with its lock.
+   struct RShard {
+      HIST *fHist = nullptr;          ///< The histogram of the manager for the first shard, fCopy for the others
+      std::unique_ptr<HIST> fCopy;    ///< Empty copy of the histogram of the manager
+      std::mutex fFillMutex;          // should become a spin lock
+   };
+
    HIST &fHist;
-   std::mutex fFillMutex; // should become a spin lock
+   std::vector<std::unique_ptr<RShard>> fShards;
+
+   /// Empty the statistics of `hist`, keeping its axes.
+   static void ResetStat(HIST &hist)
+   {
+      auto &impl = *hist.GetImpl();
+      using Stat_t = typename std::decay<decltype(impl.GetStat())>::type;
+      impl.GetStat() = Stat_t(impl.GetNBinsNoOver(), impl.GetNOverflowBins());
+   }
+
+   /// Call `fill(hist)` on the histogram of a shard, under the shard's lock.
+   template <class FILL>
+   void FillShard(FILL &&fill)
+   {
+      const std::size_t nShards = fShards.size();
+      const std::size_t first = nShards == 1 ? 0 : std::hash<std::thread::id>()(std::this_thread::get_id()) % nShards;
+      for (std::size_t i = 0; i < nShards; ++i) {
+         RShard &shard = *fShards[(first + i) % nShards];
+         std::unique_lock<std::mutex> lock(shard.fFillMutex, std::try_to_lock);
+         if (lock.owns_lock()) {
+            fill(*shard.fHist);
+            return;
+         }
+      }
+      RShard &shard = *fShards[first];
+      std::lock_guard<std::mutex> lockGuard(shard.fFillMutex);
+      fill(*shard.fHist);
+   }
 
 public:
-   RHistConcurrentFillManager(HIST &hist): fHist(hist) {}
+   RHistConcurrentFillManager(HIST &hist, std::size_t nShards = 1): fHist(hist)
+   {
+      for (std::size_t i = 0; i < nShards || i == 0; ++i) {
+         fShards.emplace_back(new RShard);
+         if (i == 0) {
+            fShards.back()->fHist = &fHist;
+         } else {
+            fShards.back()->fCopy.reset(new HIST(fHist));
+            ResetStat(*fShards.back()->fCopy);
+            fShards.back()->fHist = fShards.back()->fCopy.get();
+         }
+      }
+   }
+
+   ~RHistConcurrentFillManager() { MergeShards(); }
 
    RHistConcurrentFiller<HIST, SIZE> MakeFiller() { return RHistConcurrentFiller<HIST, SIZE>{*this}; }
 
+   /// Add the content of the shards to the histogram and empty them.
+   /// Must not be called while fillers are flushing.
+   void MergeShards()
+   {
+      for (std::size_t i = 1; i < fShards.size(); ++i) {
+         Add(fHist, *fShards[i]->fCopy);
+         ResetStat(*fShards[i]->fCopy);
+      }
+   }
+
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
    {
-      std::lock_guard<std::mutex> lockGuard(fFillMutex);
-      fHist.FillN(xN, weightN);
+      FillShard([&](HIST &hist) { hist.FillN(xN, weightN); });
    }
 
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN)
    {
-      std::lock_guard<std::mutex> lockGuard(fFillMutex);
-      fHist.FillN(xN);
+      FillShard([&](HIST &hist) { hist.FillN(xN); });
    }
 };
 
@@ -50,10 +50,119 @@
 #include "TSpectrum3.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "RConfigure.h" // R__USE_IMT
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h" // IsImplicitMTEnabled
+#endif
 #define PEAK_WINDOW 1024
 
 ClassImp(TSpectrum3);
 
+namespace {
+
+// Below this number of multiply-adds a step of the Gold deconvolution runs on one thread
+const Long64_t kMinParallelOps = 1 << 22;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call f(i1) for all x slabs 0 <= i1 < nx, in parallel if implicit
+/// multi-threading is enabled and the step is large enough.
+
+template <typename F>
+void ForEachSlab(Int_t nx, Long64_t nOps, F &&f)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nOps >= kMinParallelOps && nx > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&f](Int_t i1) { f(i1); }, ROOT::TSeqI(nx));
+      return;
+   }
+#else
+   (void)nOps;
+#endif
+   for (Int_t i1 = 0; i1 < nx; i1++)
+      f(i1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Gold deconvolution: compute h^T y into ws[][][nz..2nz), where the response
+/// h is stored in ws[][][0..nz) and y in src[][][srcOffset..srcOffset+nz).
+
+void GoldHty(Double_t ***ws, Double_t ***src, Int_t srcOffset, Int_t nx, Int_t ny, Int_t nz, Int_t lhx, Int_t lhy,
+             Int_t lhz)
+{
+   ForEachSlab(nx, Long64_t(nx) * ny * nz * lhx * lhy * lhz, [=](Int_t i1) {
+      const Int_t j1max = TMath::Min(lhx, nx - i1);
+      for (Int_t i2 = 0; i2 < ny; i2++) {
+         const Int_t j2max = TMath::Min(lhy, ny - i2);
+         for (Int_t i3 = 0; i3 < nz; i3++) {
+            const Int_t j3max = TMath::Min(lhz, nz - i3);
+            Double_t sum = 0;
+            for (Int_t j1 = 0; j1 < j1max; j1++) {
+               for (Int_t j2 = 0; j2 < j2max; j2++) {
+                  const Double_t *h = ws[j1][j2];
+                  const Double_t *y = src[i1 + j1][i2 + j2] + srcOffset + i3;
+                  for (Int_t j3 = 0; j3 < j3max; j3++)
+                     sum += h[j3] * y[j3];
+               }
+            }
+            ws[i1][i2][i3 + nz] = sum;
+         }
+      }
+   });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// One Gold iteration x <- x * h^T y / (h^T h x), with h^T y in
+/// ws[][][nz..2nz), the matrix h^T h in ws[][][2nz..3nz) (centred at
+/// lh - 1) and x in ws[][][3nz..4nz); ws[][][4nz..5nz) is scratch space.
+/// With skipSmall, elements where x or h^T y are below 1e-6 keep the
+/// scratch value of the previous iteration.
+///
+/// The x slabs are independent of each other and the innermost loop runs
+/// over contiguous memory.
+
+void GoldIteration(Double_t ***ws, Int_t nx, Int_t ny, Int_t nz, Int_t lhx, Int_t lhy, Int_t lhz, Bool_t skipSmall)
+{
+   const Long64_t nOps = Long64_t(nx) * ny * nz * (2 * lhx - 1) * (2 * lhy - 1) * (2 * lhz - 1);
+   ForEachSlab(nx, nOps, [=](Int_t i1) {
+      const Int_t j1min = -TMath::Min(i1, lhx - 1);
+      const Int_t j1max = TMath::Min(nx - i1 - 1, lhx - 1);
+      for (Int_t i2 = 0; i2 < ny; i2++) {
+         const Int_t j2min = -TMath::Min(i2, lhy - 1);
+         const Int_t j2max = TMath::Min(ny - i2 - 1, lhy - 1);
+         for (Int_t i3 = 0; i3 < nz; i3++) {
+            const Double_t x = ws[i1][i2][i3 + 3 * nz];
+            const Double_t hty = ws[i1][i2][i3 + nz];
+            if (skipSmall && !(TMath::Abs(x) > 1e-6 && TMath::Abs(hty) > 1e-6))
+               continue;
+            const Int_t j3min = -TMath::Min(i3, lhz - 1);
+            const Int_t j3max = TMath::Min(nz - i3 - 1, lhz - 1);
+            Double_t sum = 0;
+            for (Int_t j1 = j1min; j1 <= j1max; j1++) {
+               for (Int_t j2 = j2min; j2 <= j2max; j2++) {
+                  const Double_t *hth = ws[j1 + lhx - 1][j2 + lhy - 1] + 2 * nz + lhz - 1;
+                  const Double_t *xj = ws[i1 + j1][i2 + j2] + 3 * nz + i3;
+                  for (Int_t j3 = j3min; j3 <= j3max; j3++)
+                     sum += hth[j3] * xj[j3];
+               }
+            }
+            ws[i1][i2][i3 + 4 * nz] = (x * hty != 0 && sum != 0) ? x * hty / sum : 0;
+         }
+      }
+   });
+   for (Int_t i1 = 0; i1 < nx; i1++) {
+      for (Int_t i2 = 0; i2 < ny; i2++) {
+         Double_t *w = ws[i1][i2];
+         for (Int_t i3 = 0; i3 < nz; i3++)
+            w[i3 + 3 * nz] = w[i3 + 4 * nz];
+      }
+   }
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor.
 
@@ -1602,7 +1711,7 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
                                        Int_t numberRepetitions,
                                        Double_t boost)
 {
-   Int_t i, j, k, lhx, lhy, lhz, i1, i2, i3, j1, j2, j3, k1, k2, k3, lindex, i1min, i1max, i2min, i2max, i3min, i3max, j1min, j1max, j2min, j2max, j3min, j3max, positx = 0, posity = 0, positz = 0, repet;
+   Int_t i, j, k, lhx, lhy, lhz, i1, i2, i3, j1, j2, j3, lindex, i1min, i1max, i2min, i2max, i3min, i3max, j1min, j1max, j2min, j2max, j3min, j3max, positx = 0, posity = 0, positz = 0, repet;
    Double_t lda, ldb, ldc, area, maximum = 0;
    if (ssizex <= 0 || ssizey <= 0 || ssizez <= 0)
       return "Wrong parameters";
@@ -1650,26 +1759,7 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
    }
 
 //calculate ht*y and write into p
-   for (i3 = 0; i3 < ssizez; i3++) {
-      for (i2 = 0; i2 < ssizey; i2++) {
-         for (i1 = 0; i1 < ssizex; i1++) {
-            ldc = 0;
-            for (j3 = 0; j3 <= (lhz - 1); j3++) {
-               for (j2 = 0; j2 <= (lhy - 1); j2++) {
-                  for (j1 = 0; j1 <= (lhx - 1); j1++) {
-                     k3 = i3 + j3, k2 = i2 + j2, k1 = i1 + j1;
-                     if (k3 >= 0 && k3 < ssizez && k2 >= 0 && k2 < ssizey && k1 >= 0 && k1 < ssizex) {
-                        lda = working_space[j1][j2][j3];
-                        ldb = source[k1][k2][k3];
-                        ldc = ldc + lda * ldb;
-                     }
-                  }
-               }
-            }
-            working_space[i1][i2][i3 + ssizez] = ldc;
-         }
-      }
-   }
+   GoldHty(working_space, source, 0, ssizex, ssizey, ssizez, lhx, lhy, lhz);
 
 //calculate matrix b=ht*h
    i1min = -(lhx - 1), i1max = lhx - 1;
@@ -1735,60 +1825,8 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
             }
          }
       }
-      for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i3 = 0; i3 < ssizez; i3++) {
-            for (i2 = 0; i2 < ssizey; i2++) {
-               for (i1 = 0; i1 < ssizex; i1++) {
-                  ldb = 0;
-                  j3min = i3;
-                  if (j3min > lhz - 1)
-                     j3min = lhz - 1;
-                  j3min = -j3min;
-                  j3max = ssizez - i3 - 1;
-                  if (j3max > lhz - 1)
-                     j3max = lhz - 1;
-                  j2min = i2;
-                  if (j2min > lhy - 1)
-                     j2min = lhy - 1;
-                  j2min = -j2min;
-                  j2max = ssizey - i2 - 1;
-                  if (j2max > lhy - 1)
-                     j2max = lhy - 1;
-                  j1min = i1;
-                  if (j1min > lhx - 1)
-                     j1min = lhx - 1;
-                  j1min = -j1min;
-                  j1max = ssizex - i1 - 1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-                  for (j3 = j3min; j3 <= j3max; j3++) {
-                     for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * ssizez];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * ssizez];
-                           ldb = ldb + lda * ldc;
-                        }
-                     }
-                  }
-                  lda = working_space[i1][i2][i3 + 3 * ssizez];
-                  ldc = working_space[i1][i2][i3 + 1 * ssizez];
-                  if (ldc * lda != 0 && ldb != 0) {
-                     lda = lda * ldc / ldb;
-                  }
-
-                  else
-                     lda = 0;
-                  working_space[i1][i2][i3 + 4 * ssizez] = lda;
-               }
-            }
-         }
-         for (i3 = 0; i3 < ssizez; i3++) {
-            for (i2 = 0; i2 < ssizey; i2++) {
-               for (i1 = 0; i1 < ssizex; i1++)
-                  working_space[i1][i2][i3 + 3 * ssizez] = working_space[i1][i2][i3 + 4 * ssizez];
-            }
-         }
-      }
+      for (lindex = 0; lindex < numberIterations; lindex++)
+         GoldIteration(working_space, ssizex, ssizey, ssizez, lhx, lhy, lhz, kFALSE);
    }
    for (i = 0; i < ssizex; i++) {
       for (j = 0; j < ssizey; j++){
@@ -1961,7 +1999,7 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
    Double_t p1,p2,p3,p4,p5,p6,p7,p8,s1,s2,s3,s4,s5,s6,s7,s8,s9,s10,s11,s12,r1,r2,r3,r4,r5,r6;
    Int_t x,y,z;
    Double_t pocet_sigma = 5;
-   Int_t lhx,lhy,lhz,i1,i2,i3,j1,j2,j3,k1,k2,k3,i1min,i1max,i2min,i2max,i3min,i3max,j1min,j1max,j2min,j2max,j3min,j3max,positx,posity,positz;
+   Int_t lhx,lhy,lhz,i1,i2,i3,j1,j2,j3,i1min,i1max,i2min,i2max,i3min,i3max,j1min,j1max,j2min,j2max,j3min,j3max,positx,posity,positz;
    if(sigma < 1){
       Error("SearchHighRes", "Invalid sigma, must be greater than or equal to 1");
       return 0;
@@ -2946,26 +2984,7 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
       }
    }
    //calculate ht*y and write into p
-   for (i3 = 0; i3 < sizez_ext; i3++) {
-      for (i2 = 0; i2 < sizey_ext; i2++) {
-         for (i1 = 0; i1 < sizex_ext; i1++) {
-            ldc = 0;
-            for (j3 = 0; j3 <= (lhz - 1); j3++) {
-               for (j2 = 0; j2 <= (lhy - 1); j2++) {
-                  for (j1 = 0; j1 <= (lhx - 1); j1++) {
-                     k3 = i3 + j3, k2 = i2 + j2, k1 = i1 + j1;
-                     if (k3 >= 0 && k3 < sizez_ext && k2 >= 0 && k2 < sizey_ext && k1 >= 0 && k1 < sizex_ext) {
-                        lda = working_space[j1][j2][j3];
-                        ldb = working_space[k1][k2][k3+2*sizez_ext];
-                        ldc = ldc + lda * ldb;
-                     }
-                  }
-               }
-            }
-            working_space[i1][i2][i3 + sizez_ext] = ldc;
-         }
-      }
-   }
+   GoldHty(working_space, working_space, 2 * sizez_ext, sizex_ext, sizey_ext, sizez_ext, lhx, lhy, lhz);
 //calculate b=ht*h
    i1min = -(lhx - 1), i1max = lhx - 1;
    i2min = -(lhy - 1), i2max = lhy - 1;
@@ -3027,68 +3046,8 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
    }
 
 //START OF ITERATIONS
-   for (lindex=0;lindex<deconIterations;lindex++){
-      for (i3 = 0; i3 < sizez_ext; i3++) {
-         for (i2 = 0; i2 < sizey_ext; i2++) {
-            for (i1 = 0; i1 < sizex_ext; i1++) {
-               if (TMath::Abs(working_space[i1][i2][i3 + 3 * sizez_ext])>1e-6 && TMath::Abs(working_space[i1][i2][i3 + 1 * sizez_ext])>1e-6){
-                  ldb = 0;
-                  j3min = i3;
-                  if (j3min > lhz - 1)
-                     j3min = lhz - 1;
-
-                  j3min = -j3min;
-                  j3max = sizez_ext - i3 - 1;
-                  if (j3max > lhz - 1)
-                     j3max = lhz - 1;
-
-                  j2min = i2;
-                  if (j2min > lhy - 1)
-                     j2min = lhy - 1;
-
-                  j2min = -j2min;
-                  j2max = sizey_ext - i2 - 1;
-                  if (j2max > lhy - 1)
-                     j2max = lhy - 1;
-
-                  j1min = i1;
-                  if (j1min > lhx - 1)
-                     j1min = lhx - 1;
-
-                  j1min = -j1min;
-                  j1max = sizex_ext - i1 - 1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-
-                  for (j3 = j3min; j3 <= j3max; j3++) {
-                     for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * sizez_ext];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * sizez_ext];
-                           ldb = ldb + lda * ldc;
-                        }
-                     }
-                  }
-                  lda = working_space[i1][i2][i3 + 3 * sizez_ext];
-                  ldc = working_space[i1][i2][i3 + 1 * sizez_ext];
-                  if (ldc * lda != 0 && ldb != 0) {
-                     lda = lda * ldc / ldb;
-                  }
-
-                  else
-                     lda = 0;
-                  working_space[i1][i2][i3 + 4 * sizez_ext] = lda;
-               }
-            }
-         }
-      }
-      for (i3 = 0; i3 < sizez_ext; i3++) {
-         for (i2 = 0; i2 < sizey_ext; i2++) {
-            for (i1 = 0; i1 < sizex_ext; i1++)
-               working_space[i1][i2][i3 + 3 * sizez_ext] = working_space[i1][i2][i3 + 4 * sizez_ext];
-         }
-      }
-   }
+   for (lindex=0;lindex<deconIterations;lindex++)
+      GoldIteration(working_space, sizex_ext, sizey_ext, sizez_ext, lhx, lhy, lhz, kTRUE);
 //write back resulting spectrum
    maximum=0;
   for(i = 0;i < sizex_ext; i++){
@@ -210,10 +210,17 @@ class TUnfold : public TObject {
    TMatrixDSparse *fEinv;
    /// matrix E
    TMatrixDSparse *fE;
+   /// cached A<sup>T</sup>Vyy<sup>-1</sup>, does not depend on tau
+   TMatrixDSparse *fAtVyyInv; //!
+   /// cached A<sup>T</sup>Vyy<sup>-1</sup>A, does not depend on tau
+   TMatrixDSparse *fAtVyyInvA; //!
+   /// cached L<sup>T</sup>L, does not depend on tau
+   TMatrixDSparse *fLSquared; //!
  protected:
    // Int_t IsNotSymmetric(TMatrixDSparse const &m) const;
    virtual Double_t DoUnfold(void);     // the unfolding algorithm
    virtual void ClearResults(void);     // clear all results
+   void ClearCachedProducts(void);      // clear tau-independent matrix products
    void ClearHistogram(TH1 *h,Double_t x=0.) const;
    virtual TString GetOutputBinName(Int_t iBinX) const; // name a bin
    TMatrixDSparse *MultiplyMSparseM(const TMatrixDSparse *a,const TMatrixD *b) const; // multiply sparse and non-sparse matrix
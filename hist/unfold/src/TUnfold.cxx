@@ -136,6 +136,7 @@ TUnfold::~TUnfold(void)
    DeleteMatrix(&fVyyInv);
 
    ClearResults();
+   ClearCachedProducts();
 }
 
 
@@ -159,6 +160,9 @@ void TUnfold::InitTUnfold(void)
    // output
    fX = nullptr;
    fVyyInv = nullptr;
+   fAtVyyInv = nullptr;
+   fAtVyyInvA = nullptr;
+   fLSquared = nullptr;
    fVxx = nullptr;
    fVxxInv = nullptr;
    fAx = nullptr;
@@ -232,6 +236,19 @@ void TUnfold::ClearResults(void)
    fRhoAvg = -1.0;
 }
 
+////////////////////////////////////////////////////////////////////////
+/// clear the matrix products which do not depend on tau
+///
+/// they are cached by DoUnfold() and have to be cleared whenever
+/// the response matrix, the input covariance or the regularisation
+/// conditions change
+void TUnfold::ClearCachedProducts(void)
+{
+   DeleteMatrix(&fAtVyyInv);
+   DeleteMatrix(&fAtVyyInvA);
+   DeleteMatrix(&fLSquared);
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// only for use by root streamer or derived classes
 ///
@@ -260,6 +277,7 @@ Double_t TUnfold::DoUnfold(void)
    //     fConstraint: whether the constraint is applied
    // Data members modified:
    //     fVyyInv: inverse of input data covariance matrix
+   //     fAtVyyInv, fAtVyyInvA, fLSquared: cached products, independent of tau
    //     fNdf: number of degrees of freedom
    //     fEinv: inverse of the matrix needed for unfolding calculations
    //     fE:    the matrix needed for unfolding calculations
@@ -287,18 +305,27 @@ Double_t TUnfold::DoUnfold(void)
       }
    }
    //
-   // get matrix
-   //              T
-   //            fA fV  = mAt_V
+   // get matrices
+   //              T                  T                T
+   //            fA fV  = mAt_V,    fA fV fA,        fL fL
    //
-   TMatrixDSparse *AtVyyinv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+   // these do not depend on tau and are kept from one call to the next,
+   // which saves most of the matrix products when scanning tau
+   if(!fAtVyyInv) {
+      fAtVyyInv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+      fAtVyyInvA=MultiplyMSparseMSparse(fAtVyyInv,fA);
+   }
+   if(!fLSquared) {
+      fLSquared=MultiplyMSparseTranspMSparse(fL,fL);
+   }
+   const TMatrixDSparse *AtVyyinv=fAtVyyInv;
+   const TMatrixDSparse *lSquared=fLSquared;
    //
    // get
    //       T
    //     fA fVyyinv fY + fTauSquared fBiasScale Lsquared fX0 = rhs
    //
    TMatrixDSparse *rhs=MultiplyMSparseM(AtVyyinv,fY);
-   TMatrixDSparse *lSquared=MultiplyMSparseTranspMSparse(fL,fL);
    if (fBiasScale != 0.0) {
      TMatrixDSparse *rhs2=MultiplyMSparseM(lSquared,fX0);
       AddMSparse(rhs, fTauSquared * fBiasScale ,rhs2);
@@ -309,7 +336,7 @@ Double_t TUnfold::DoUnfold(void)
    // get matrix
    //              T
    //           (fA fV)fA + fTauSquared*fLsquared  = fEinv
-   fEinv=MultiplyMSparseMSparse(AtVyyinv,fA);
+   fEinv=new TMatrixDSparse(*fAtVyyInvA);
    AddMSparse(fEinv,fTauSquared,lSquared);
 
    //
@@ -415,8 +442,6 @@ Double_t TUnfold::DoUnfold(void)
       DeleteMatrix(&corr);
    }
 
-   DeleteMatrix(&AtVyyinv);
-
    //
    // get error matrix on x
    //   fDXDY * Vyy * fDXDY#
@@ -479,7 +504,6 @@ Double_t TUnfold::DoUnfold(void)
    DeleteMatrix(&epsilon);
 
    DeleteMatrix(&LsquaredDx);
-   DeleteMatrix(&lSquared);
 
    // calculate/store matrices defining the derivatives dx/dA
    fDXDAM[0]=new TMatrixDSparse(*fE);
@@ -1995,6 +2019,7 @@ Bool_t TUnfold::AddRegularisationCondition
 
    // replace the old matrix fL
    if(r) {
+      ClearCachedProducts();
       DeleteMatrix(&fL);
       fL=CreateSparseMatrix(rowMax+1,GetNx(),nF,l_row,l_col,l_data);
    }
@@ -2282,6 +2307,7 @@ Int_t TUnfold::SetInput(const TH1 *input, Double_t scaleBias,
   //   + see ClearResults
 
   DeleteMatrix(&fVyyInv);
+  ClearCachedProducts();
   fNdf=0;
 
   fBiasScale = scaleBias;
@@ -3101,6 +3127,7 @@ void TUnfold::GetInputInverseEmatrix(TH2 *out)
    // corresponding to the input data
    if(!fVyyInv) {
       Int_t rank=0;
+      ClearCachedProducts();
       fVyyInv=InvertMSparseSymmPos(fVyy,&rank);
       // and count number of degrees of freedom
       fNdf = rank-GetNpar();
@@ -0,0 +1,92 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBlockCache
+#define ROOT_RBlockCache
+
+#include <ROOT/RRawFile.hxx>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RBlockCache RBlockCache.hxx
+ * \ingroup IO
+ *
+ * A read-through cache of fixed-size blocks of remote files on local disk. Every block is stored in its own file,
+ * named after a hash of the file identity, the file size and the block index, so that several processes on the same
+ * node can share the cache directory. Blocks are written to a temporary file and renamed into place, readers
+ * therefore never see a partial block. When the cache grows beyond its maximum size, the least recently used blocks
+ * are removed.
+ *
+ * The cache sits below TFile::ReadBuffers() of the remote TFile implementations and below RRawFile::ReadV() of the
+ * remote RRawFile implementations. It is enabled by setting the TFile.BlockCacheDir rc variable; the maximum size
+ * in MB and the block size in kB are set by TFile.BlockCacheSize and TFile.BlockCacheBlockSize.
+ */
+class RBlockCache {
+public:
+   static constexpr std::size_t kDefaultBlockSize = 1024 * 1024;
+   /// Reads the given blocks from the remote file and sets their fOutBytes
+   using ReadBlocksFunc_t = std::function<void(RRawFile::RIOVec *ioVec, unsigned int nReq)>;
+
+private:
+   std::string fDirectory;
+   std::uint64_t fMaxSize;
+   std::size_t fBlockSize;
+   /// Protects fUsedSize and fIsScanned
+   std::mutex fLock;
+   /// Estimate of the bytes in the cache directory, corrected by every scan of the directory
+   std::uint64_t fUsedSize = 0;
+   bool fIsScanned = false;
+   std::atomic<std::uint64_t> fNHits{0};
+   std::atomic<std::uint64_t> fNMisses{0};
+
+   std::string GetBlockPath(const std::string &fileId, std::uint64_t fileSize, std::uint64_t index) const;
+   bool LoadBlock(const std::string &path, unsigned char *buffer, std::size_t size) const;
+   void StoreBlock(const std::string &path, const unsigned char *buffer, std::size_t size);
+
+public:
+   RBlockCache(std::string_view directory, std::uint64_t maxSize, std::size_t blockSize = kDefaultBlockSize);
+   RBlockCache(const RBlockCache &) = delete;
+   RBlockCache &operator=(const RBlockCache &) = delete;
+   ~RBlockCache() = default;
+
+   /// Returns the cache configured by the TFile.BlockCache* rc variables, or nullptr if no cache directory is set
+   static RBlockCache *GetGlobal();
+
+   /// Serves the requests for the file `fileId` of size `fileSize` from the cached blocks. The blocks that are not
+   /// in the cache are read with a single call to `readBlocks` and stored.
+   void ReadV(const std::string &fileId, std::uint64_t fileSize, RRawFile::RIOVec *ioVec, unsigned int nReq,
+              const ReadBlocksFunc_t &readBlocks);
+
+   /// Removes the least recently used blocks until the cache holds at most `targetSize` bytes
+   void Evict(std::uint64_t targetSize);
+   /// Scans the cache directory and returns the number of bytes it holds
+   std::uint64_t GetUsedSize();
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   std::uint64_t GetMaxSize() const { return fMaxSize; }
+   std::size_t GetBlockSize() const { return fBlockSize; }
+   std::uint64_t GetNHits() const { return fNHits; }
+   std::uint64_t GetNMisses() const { return fNMisses; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
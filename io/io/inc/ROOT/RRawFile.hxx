@@ -22,6 +22,8 @@
 namespace ROOT {
 namespace Internal {
 
+class RBlockCache;
+
 /**
  * \class RRawFile RRawFile.hxx
  * \ingroup IO
@@ -120,6 +122,8 @@ private:
    bool fIsOpen = false;
    /// Runtime switch to decide if reads are buffered or directly sent to ReadAtImpl()
    bool fIsBuffering = true;
+   /// The local block cache that serves ReadV() for remote files, if configured; not owned
+   RBlockCache *fBlockCache = nullptr;
 
 protected:
    std::string fUrl;
@@ -173,7 +177,7 @@ public:
    /// Returns the url of the file
    std::string GetUrl() const;
 
-   /// Opens the file if necessary and calls ReadVImpl
+   /// Opens the file if necessary and calls ReadVImpl, through the local block cache for remote files
    void ReadV(RIOVec *ioVec, unsigned int nReq);
    /// Returns the limits regarding the ioVec input to ReadV for this specific file; may open the file as a side-effect.
    virtual RIOVecLimits GetReadVLimits() { return RIOVecLimits(); }
@@ -16,10 +16,12 @@
 #include "TMemFile.h"
 #include "ROOT/RConfig.hxx"
 
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 namespace ROOT {
 
@@ -36,6 +38,13 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * The baskets are compressed by each thread in its own
+ * TBufferMergerFile and are copied to the output without being
+ * recompressed. While a thread merges, the files written by the
+ * other threads are queued and the next thread to merge takes
+ * all of them at once, so that the output is updated by a
+ * single thread at a time with as few merges as possible.
  */
 
 class TBufferMerger {
@@ -127,7 +136,12 @@ private:
    void Merge(TBufferMergerFile *memfile);
 
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
-   std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
+   std::mutex fMergeMutex;                                       //< Mutex used to lock the queue of files to merge
+   std::condition_variable fMergeDone;                           //< Signalled each time a batch of files was merged
+   std::vector<TBufferMergerFile *> fQueue;                      //< Files waiting to be merged
+   size_t fNQueued = 0;                                          //< Number of files queued so far
+   size_t fNMerged = 0;                                          //< Number of files merged so far
+   bool fMerging = false;                                        //< Whether a thread is merging a batch of files
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
@@ -16,6 +16,7 @@
 #include "TString.h"
 
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,10 +49,14 @@ public:
      kSkipTypeInfo  = 100            ///< do not store typenames in JSON
    };
 
+   /// Receives the successive chunks of the JSON code, see SetOutputSink()
+   using OutputSink_t = std::function<void(const char *data, std::size_t len)>;
+
    TBufferJSON(TBuffer::EMode mode = TBuffer::kWrite);
    ~TBufferJSON() override;
 
    void SetCompact(int level);
+   void SetOutputSink(OutputSink_t sink, std::size_t chunkSize = 65536);
    void SetTypenameTag(const char *tag = "_typename");
    void SetTypeversionTag(const char *tag = nullptr);
    void SetSkipClassInfo(const TClass *cl);
@@ -67,6 +72,7 @@ public:
 
    static Int_t ExportToFile(const char *filename, const TObject *obj, const char *option = nullptr);
    static Int_t ExportToFile(const char *filename, const void *obj, const TClass *cl, const char *option = nullptr);
+   static Long64_t ExportToSink(const OutputSink_t &sink, const void *obj, const TClass *cl, Int_t compact = 0);
 
    static TObject *ConvertFromJSON(const char *str);
    static void *ConvertFromJSONAny(const char *str, TClass **cl = nullptr);
@@ -296,6 +302,8 @@ protected:
 
    void AppendOutput(const char *line0, const char *line1 = nullptr);
 
+   void FlushOutput();
+
    void JsonPushValue();
 
    template <typename T>
@@ -316,6 +324,9 @@ protected:
 
    TString fOutBuffer;                 ///<!  main output buffer for json code
    TString *fOutput{nullptr};          ///<!  current output buffer for json code
+   OutputSink_t fOutputSink;           ///<!  when set, receives the main output buffer each time it is big enough
+   std::size_t fOutputChunkSize{0};    ///<!  length of main output buffer which triggers the call of fOutputSink
+   Long64_t fOutputFlushed{0};         ///<!  number of bytes already passed to fOutputSink
    TString fValue;                     ///<!  buffer for current value
    unsigned fJsonrCnt{0};              ///<!  counter for all objects, used for referencing
    std::deque<std::unique_ptr<TJSONStackObj>> fStack; ///<!  hierarchy of currently streamed element
@@ -27,6 +27,13 @@
 #include "TList.h"
 
 class TKey;
+class THashList;
+
+namespace ROOT {
+namespace Internal {
+class RDirectoryKeyIndex;
+}
+} // namespace ROOT
 class TFile;
 
 class TDirectoryFile : public TDirectory {
@@ -44,8 +51,12 @@ protected:
    Long64_t    fSeekKeys{0};             ///< Location of Keys record on file
    TFile      *fFile{nullptr};           ///< Pointer to current file in memory
    TList      *fKeys{nullptr};           ///< Pointer to keys list in memory
+   mutable ROOT::Internal::RDirectoryKeyIndex *fKeyIndex{nullptr}; ///<! Keys not yet read, if read on demand
 
    void        CleanTargets();
+   Int_t       CountKeysOfClass(const char *classname) const;
+   void        DeleteKeyIndex() const;
+   THashList  *GetListOfKeysFor(const char *name) const;
    void        InitDirectoryFile(TClass *cl = nullptr);
    void        BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir);
 
@@ -91,10 +102,10 @@ public:
    const TDatime      &GetCreationDate() const { return fDatimeC; }
            TFile      *GetFile() const override { return fFile; }
            TKey       *GetKey(const char *name, Short_t cycle=9999) const override;
-           TList      *GetListOfKeys() const override { return fKeys; }
+           TList      *GetListOfKeys() const override;
    const TDatime      &GetModificationDate() const { return fDatimeM; }
            Int_t       GetNbytesKeys() const override { return fNbytesKeys; }
-           Int_t       GetNkeys() const override { return fKeys->GetSize(); }
+           Int_t       GetNkeys() const override;
            Long64_t    GetSeekDir() const override { return fSeekDir; }
            Long64_t    GetSeekParent() const override { return fSeekParent; }
            Long64_t    GetSeekKeys() const override { return fSeekKeys; }
@@ -109,6 +120,7 @@ public:
            void        ReadAll(Option_t *option="") override;
            Int_t       ReadKeys(Bool_t forceRead=kTRUE) override;
            Int_t       ReadTObject(TObject *obj, const char *keyname) override;
+           void        RemoveKey(TKey *key);
    virtual void        ResetAfterMerge(TFileMergeInfo *);
            void        rmdir(const char *name) override;
            void        Save() override;
@@ -22,7 +22,11 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "Compression.h"
 #include "TDirectoryFile.h"
@@ -50,6 +54,12 @@ class TProcessID;
 class TStopwatch;
 class TFilePrefetch;
 
+namespace ROOT {
+namespace Internal {
+class RBlockCache;
+}
+}
+
 class TFile : public TDirectoryFile {
   friend class TDirectoryFile;
   friend class TFilePrefetch;
@@ -114,8 +124,17 @@ protected:
 
    bool             fGlobalRegistration = true; ///<! if true, bypass use of global lists
 
+   std::vector<char>     fOpenPlanBuffer;     ///<!Records prefetched when the file was opened, see PrefetchOpenPlan()
+   std::vector<Long64_t> fOpenPlanPos;        ///<!Relative offsets of the prefetched records
+   std::vector<Int_t>    fOpenPlanLen;        ///<!Lengths of the prefetched records
+   char            *fMapAddress{nullptr};     ///<!Start of the memory mapping of the file, see MapFile()
+   Long64_t         fMapSize{0};              ///<!Size of the memory mapping of the file
+   Bool_t           fConcurrentRead{kFALSE};  ///<!True if several threads may read at once, see SetConcurrentRead()
+   Long64_t         fBlockCacheFileSize{-1};  ///<!File size used by the local block cache, -1 if not known yet
+
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
+   mutable std::mutex                         fReadMutex;   ///<!Lock for the read statistics and caches when reading concurrently.
 #endif
    static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
 
@@ -138,6 +157,16 @@ protected:
    virtual void        Init(Bool_t create);
            Bool_t      FlushWriteCache();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
+           void        PrefetchOpenPlan(Int_t nbytesDir);
+           Bool_t      ReadBufferViaOpenPlan(char *buf, Long64_t off, Int_t len);
+           void        DropOpenPlan();
+           void        MapFile();
+           Bool_t      ReadBufferConcurrent(char *buf, Long64_t pos, Int_t len);
+           ROOT::Internal::RBlockCache *GetBlockCache() const;
+           using ReadBuffersFunc_t = std::function<Bool_t(char *, Long64_t *, Int_t *, Int_t)>;
+           Bool_t      ReadBuffersBlockCached(ROOT::Internal::RBlockCache &cache, char *buf, Long64_t *pos, Int_t *len,
+                                              Int_t nbuf, const ReadBuffersFunc_t &readRemote);
+           void        UnmapFile();
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
 
    ////////////////////////////////////////////////////////////////////////////////
@@ -240,6 +269,7 @@ public:
            Option_t   *GetOption() const override { return fOption.Data(); }
    virtual Long64_t    GetBytesRead() const { return fBytesRead; }
    virtual Long64_t    GetBytesReadExtra() const { return fBytesReadExtra; }
+   const   char       *GetMappedBuffer(Long64_t pos, Int_t len);
    virtual Long64_t    GetBytesWritten() const;
    virtual Int_t       GetReadCalls() const { return fReadCalls; }
            Int_t       GetVersion() const { return fVersion; }
@@ -258,6 +288,8 @@ public:
    virtual Bool_t      IsArchive() const { return fIsArchive; }
            Bool_t      IsBinary() const { return TestBit(kBinaryFile); }
            Bool_t      IsRaw() const { return !fIsRootFile; }
+           Bool_t      IsConcurrentRead() const { return fConcurrentRead; }
+           Bool_t      IsMemoryMapped() const { return fMapAddress != nullptr; }
    virtual Bool_t      IsOpen() const;
            void        ls(Option_t *option="") const override;
    virtual void        MakeFree(Long64_t first, Long64_t last);
@@ -284,6 +316,7 @@ public:
    virtual void        SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
    virtual void        SetCompressionLevel(Int_t level = ROOT::RCompressionSetting::ELevel::kUseMin);
    virtual void        SetCompressionSettings(Int_t settings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
+           void        SetConcurrentRead(Bool_t concurrent = kTRUE);
    virtual void        SetEND(Long64_t last) { fEND = last; }
    virtual void        SetOffset(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetOption(Option_t *option=">") { fOption = option; }
@@ -307,6 +340,8 @@ public:
                             const char *ftitle = "", Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault,
                             Int_t netopt = 0);
    static TFile       *Open(TFileOpenHandle *handle);
+   static std::vector<std::future<std::unique_ptr<TFile>>>
+                       OpenMany(const std::vector<std::string> &names, Option_t *option = "", Int_t concurrency = 0);
 
    static EFileType    GetType(const char *name, Option_t *option = "", TString *prefix = nullptr);
 
@@ -51,6 +51,7 @@ protected:
    Int_t          fMaxOpenedFiles;            ///< Maximum number of files opened at the same time by the TFileMerger
    Bool_t         fLocal;                     ///< Makes local copies of merging files if True (default is kTRUE)
    Bool_t         fHistoOneGo;                ///< Merger histos in one go (default is kTRUE)
+   Bool_t         fStreamingMerge{kFALSE};    ///<! Merge and write out the objects one input and one name at a time (default is kFALSE)
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
@@ -121,6 +122,8 @@ public:
    virtual Bool_t PartialMerge(Int_t type = kAll | kIncremental);
    virtual void   SetFastMethod(Bool_t fast=kTRUE)  {fFastMethod = fast;}
            Bool_t GetNotrees() const { return fNoTrees; }
+           Bool_t IsStreamingMerge() const { return fStreamingMerge; }
+           void   SetStreamingMerge(Bool_t streaming = kTRUE) { fStreamingMerge = streaming; }
    virtual void   SetNotrees(Bool_t notrees=kFALSE) {fNoTrees = notrees;}
            void   RecursiveRemove(TObject *obj) override;
 
@@ -109,6 +109,8 @@ private:
    TStreamerInfoActions::TActionSequence *fWriteMemberWise;       ///<! List of write action resulting from the compilation for use in member wise streaming.
    TStreamerInfoActions::TActionSequence *fWriteMemberWiseVecPtr; ///<! List of write action resulting from the compilation for use in member wise streaming.
    TStreamerInfoActions::TActionSequence *fWriteText;             ///<! List of text write action resulting for the compilation, used for JSON.
+   std::atomic<Bool_t> fHasWriteActions;  ///<! True if the write action sequences have been filled, see BuildWriteActions()
+   std::atomic<Bool_t> fHasTextActions;   ///<! True if the text action sequences have been filled, see BuildTextActions()
 
    static std::atomic<Int_t>             fgCount;     ///<Number of TStreamerInfo instances
 
@@ -118,6 +120,8 @@ private:
    UInt_t            GenerateIncludes(FILE *fp, char *inclist, const TList *extrainfos);
    void              GenerateDeclaration(FILE *fp, FILE *sfp, const TList *subClasses, Bool_t top = kTRUE);
    void              InsertArtificialElements(std::vector<const ROOT::TSchemaRule*> &rules);
+   void              BuildWriteActions();
+   void              BuildTextActions();
    void              DestructorImpl(void* p, Bool_t dtorOnly);
 
 private:
@@ -166,10 +170,10 @@ public:
    Int_t               GetElementOffset(Int_t id) const override {return fCompFull[id]->fOffset;}
    TStreamerInfoActions::TActionSequence *GetReadMemberWiseActions(Bool_t forCollection) { return forCollection ? fReadMemberWiseVecPtr : fReadMemberWise; }
    TStreamerInfoActions::TActionSequence *GetReadObjectWiseActions() { return fReadObjectWise; }
-   TStreamerInfoActions::TActionSequence *GetReadTextActions() { return fReadText; }
-   TStreamerInfoActions::TActionSequence *GetWriteMemberWiseActions(Bool_t forCollection) { return forCollection ? fWriteMemberWiseVecPtr : fWriteMemberWise; }
-   TStreamerInfoActions::TActionSequence *GetWriteObjectWiseActions() { return fWriteObjectWise; }
-   TStreamerInfoActions::TActionSequence *GetWriteTextActions() { return fWriteText; }
+   TStreamerInfoActions::TActionSequence *GetReadTextActions();
+   TStreamerInfoActions::TActionSequence *GetWriteMemberWiseActions(Bool_t forCollection);
+   TStreamerInfoActions::TActionSequence *GetWriteObjectWiseActions();
+   TStreamerInfoActions::TActionSequence *GetWriteTextActions();
    Int_t               GetNdata()   const {return fNdata;}
    Int_t               GetNelement() const { return fElements->GetEntriesFast(); }
    Int_t               GetNumber()  const override { return fNumber; }
@@ -0,0 +1,272 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RBlockCache.hxx>
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TMD5.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct RBlockFileInfo {
+   std::string fPath;
+   Long64_t fSize;
+   Long_t fMtime;
+};
+
+/// Temporary files of writers that died before renaming them are removed after this many seconds
+constexpr Long_t kStaleTmpAge = 3600;
+
+/// Calls `func` for every file in the two-level cache directory
+template <typename FuncT>
+void ForEachBlockFile(const std::string &directory, FuncT &&func)
+{
+   void *topDir = gSystem->OpenDirectory(directory.c_str());
+   if (!topDir)
+      return;
+   while (const char *subName = gSystem->GetDirEntry(topDir)) {
+      if (subName[0] == '.')
+         continue;
+      std::string subPath = directory + "/" + subName;
+      void *subDir = gSystem->OpenDirectory(subPath.c_str());
+      if (!subDir)
+         continue;
+      while (const char *name = gSystem->GetDirEntry(subDir)) {
+         if (name[0] == '.')
+            continue;
+         std::string path = subPath + "/" + name;
+         FileStat_t st;
+         if (gSystem->GetPathInfo(path.c_str(), st) == 0 && !R_ISDIR(st.fMode))
+            func(RBlockFileInfo{path, st.fSize, st.fMtime}, strstr(name, ".tmp") != nullptr);
+      }
+      gSystem->FreeDirectory(subDir);
+   }
+   gSystem->FreeDirectory(topDir);
+}
+
+} // anonymous namespace
+
+ROOT::Internal::RBlockCache::RBlockCache(std::string_view directory, std::uint64_t maxSize, std::size_t blockSize)
+   : fDirectory(directory), fMaxSize(maxSize), fBlockSize(blockSize > 0 ? blockSize : kDefaultBlockSize)
+{
+   gSystem->mkdir(fDirectory.c_str(), kTRUE);
+}
+
+ROOT::Internal::RBlockCache *ROOT::Internal::RBlockCache::GetGlobal()
+{
+   static std::unique_ptr<RBlockCache> gBlockCache = []() -> std::unique_ptr<RBlockCache> {
+      TString directory = gEnv->GetValue("TFile.BlockCacheDir", "");
+      if (directory.IsNull())
+         return nullptr;
+      gSystem->ExpandPathName(directory);
+      std::uint64_t maxSize = gEnv->GetValue("TFile.BlockCacheSize", 10240);
+      std::size_t blockSize = gEnv->GetValue("TFile.BlockCacheBlockSize", 1024);
+      return std::make_unique<RBlockCache>(directory.Data(), maxSize * 1024 * 1024, blockSize * 1024);
+   }();
+   return gBlockCache.get();
+}
+
+std::string
+ROOT::Internal::RBlockCache::GetBlockPath(const std::string &fileId, std::uint64_t fileSize, std::uint64_t index) const
+{
+   std::string key = fileId + "\n" + std::to_string(fileSize) + "\n" + std::to_string(fBlockSize) + "\n" +
+                     std::to_string(index);
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   std::string digest = md5.AsString();
+   return fDirectory + "/" + digest.substr(0, 2) + "/" + digest;
+}
+
+bool ROOT::Internal::RBlockCache::LoadBlock(const std::string &path, unsigned char *buffer, std::size_t size) const
+{
+   FILE *f = fopen(path.c_str(), "rb");
+   if (!f)
+      return false;
+   // A block of the wrong size is ignored and overwritten by the next store
+   bool isComplete = fread(buffer, 1, size, f) == size && fgetc(f) == EOF;
+   fclose(f);
+   if (isComplete) {
+      // The modification time orders the blocks for the LRU eviction
+      Long_t now = time(nullptr);
+      gSystem->Utime(path.c_str(), now, now);
+   }
+   return isComplete;
+}
+
+void ROOT::Internal::RBlockCache::StoreBlock(const std::string &path, const unsigned char *buffer, std::size_t size)
+{
+   static std::atomic<unsigned int> gTmpCounter{0};
+   std::string tmpPath = path + ".tmp" + std::to_string(gSystem->GetPid()) + "_" + std::to_string(gTmpCounter++);
+
+   FILE *f = fopen(tmpPath.c_str(), "wb");
+   if (!f) {
+      gSystem->mkdir(path.substr(0, path.rfind('/')).c_str(), kTRUE);
+      f = fopen(tmpPath.c_str(), "wb");
+      if (!f)
+         return;
+   }
+   bool isWritten = fwrite(buffer, 1, size, f) == size;
+   isWritten = (fclose(f) == 0) && isWritten;
+   if (!isWritten || gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0) {
+      gSystem->Unlink(tmpPath.c_str());
+      return;
+   }
+
+   bool needsEviction;
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      if (!fIsScanned) {
+         fIsScanned = true;
+         fUsedSize = 0;
+         ForEachBlockFile(fDirectory, [this](const RBlockFileInfo &info, bool) { fUsedSize += info.fSize; });
+      } else {
+         fUsedSize += size;
+      }
+      needsEviction = fUsedSize > fMaxSize;
+   }
+   // Evict a bit more than necessary so that the next stores do not trigger another scan right away
+   if (needsEviction)
+      Evict(fMaxSize - fMaxSize / 10);
+}
+
+void ROOT::Internal::RBlockCache::Evict(std::uint64_t targetSize)
+{
+   std::vector<RBlockFileInfo> blocks;
+   std::uint64_t usedSize = 0;
+   Long_t now = time(nullptr);
+   ForEachBlockFile(fDirectory, [&](const RBlockFileInfo &info, bool isTmp) {
+      if (isTmp) {
+         if (now - info.fMtime > kStaleTmpAge)
+            gSystem->Unlink(info.fPath.c_str());
+         return;
+      }
+      usedSize += info.fSize;
+      blocks.push_back(info);
+   });
+
+   std::sort(blocks.begin(), blocks.end(),
+             [](const RBlockFileInfo &a, const RBlockFileInfo &b) { return a.fMtime < b.fMtime; });
+   for (const auto &block : blocks) {
+      if (usedSize <= targetSize)
+         break;
+      // Another process may have removed the block already
+      gSystem->Unlink(block.fPath.c_str());
+      usedSize -= block.fSize;
+   }
+
+   std::lock_guard<std::mutex> guard(fLock);
+   fIsScanned = true;
+   fUsedSize = usedSize;
+}
+
+std::uint64_t ROOT::Internal::RBlockCache::GetUsedSize()
+{
+   std::uint64_t usedSize = 0;
+   ForEachBlockFile(fDirectory, [&](const RBlockFileInfo &info, bool isTmp) {
+      if (!isTmp)
+         usedSize += info.fSize;
+   });
+
+   std::lock_guard<std::mutex> guard(fLock);
+   fIsScanned = true;
+   fUsedSize = usedSize;
+   return usedSize;
+}
+
+void ROOT::Internal::RBlockCache::ReadV(const std::string &fileId, std::uint64_t fileSize, RRawFile::RIOVec *ioVec,
+                                        unsigned int nReq, const ReadBlocksFunc_t &readBlocks)
+{
+   struct RBlock {
+      std::uint64_t fIndex = 0;
+      std::size_t fSize = 0;
+      /// Number of valid bytes in fData; smaller than fSize only if the remote read was short
+      std::size_t fValidSize = 0;
+      std::string fPath;
+      std::unique_ptr<unsigned char[]> fData;
+   };
+
+   // Collect the blocks touched by the requests
+   std::vector<std::uint64_t> indexes;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = 0;
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fileSize)
+         continue;
+      std::uint64_t end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fileSize);
+      for (std::uint64_t idx = ioVec[i].fOffset / fBlockSize; idx <= (end - 1) / fBlockSize; ++idx)
+         indexes.push_back(idx);
+   }
+   std::sort(indexes.begin(), indexes.end());
+   indexes.erase(std::unique(indexes.begin(), indexes.end()), indexes.end());
+
+   // Load the cached blocks and prepare the remote read of the others
+   std::vector<RBlock> blocks(indexes.size());
+   std::vector<RRawFile::RIOVec> missing;
+   std::vector<std::size_t> missingBlocks;
+   for (std::size_t k = 0; k < indexes.size(); ++k) {
+      RBlock &block = blocks[k];
+      block.fIndex = indexes[k];
+      block.fSize = std::min<std::uint64_t>(fBlockSize, fileSize - block.fIndex * fBlockSize);
+      block.fPath = GetBlockPath(fileId, fileSize, block.fIndex);
+      block.fData.reset(new unsigned char[block.fSize]);
+      if (LoadBlock(block.fPath, block.fData.get(), block.fSize)) {
+         block.fValidSize = block.fSize;
+         fNHits++;
+         continue;
+      }
+      fNMisses++;
+      RRawFile::RIOVec req;
+      req.fBuffer = block.fData.get();
+      req.fOffset = block.fIndex * fBlockSize;
+      req.fSize = block.fSize;
+      missing.push_back(req);
+      missingBlocks.push_back(k);
+   }
+
+   if (!missing.empty()) {
+      readBlocks(missing.data(), missing.size());
+      for (std::size_t m = 0; m < missing.size(); ++m) {
+         RBlock &block = blocks[missingBlocks[m]];
+         block.fValidSize = std::min(missing[m].fOutBytes, block.fSize);
+         if (block.fValidSize == block.fSize)
+            StoreBlock(block.fPath, block.fData.get(), block.fSize);
+      }
+   }
+
+   // Serve the requests from the blocks
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fileSize)
+         continue;
+      std::uint64_t pos = ioVec[i].fOffset;
+      std::uint64_t end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fileSize);
+      auto k = std::lower_bound(indexes.begin(), indexes.end(), pos / fBlockSize) - indexes.begin();
+      while (pos < end) {
+         const RBlock &block = blocks[k++];
+         std::uint64_t offsetInBlock = pos - block.fIndex * fBlockSize;
+         if (offsetInBlock >= block.fValidSize)
+            break;
+         std::size_t nbytes = std::min<std::uint64_t>(end - pos, block.fValidSize - offsetInBlock);
+         memcpy(reinterpret_cast<unsigned char *>(ioVec[i].fBuffer) + (pos - ioVec[i].fOffset),
+                block.fData.get() + offsetInBlock, nbytes);
+         ioVec[i].fOutBytes += nbytes;
+         pos += nbytes;
+      }
+   }
+}
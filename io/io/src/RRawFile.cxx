@@ -10,6 +10,7 @@
  *************************************************************************/
 
 #include <ROOT/RConfig.h>
+#include <ROOT/RBlockCache.hxx>
 #include <ROOT/RRawFile.hxx>
 #ifdef _WIN32
 #include <ROOT/RRawFileWin.hxx>
@@ -94,6 +95,8 @@ void ROOT::Internal::RRawFile::EnsureOpen()
 
    OpenImpl();
    fIsOpen = true;
+   if (GetTransport(fUrl) != "file")
+      fBlockCache = RBlockCache::GetGlobal();
 }
 
 void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
@@ -194,7 +197,25 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
 void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
 {
    EnsureOpen();
-   ReadVImpl(ioVec, nReq);
+   if (!fBlockCache) {
+      ReadVImpl(ioVec, nReq);
+      return;
+   }
+
+   fBlockCache->ReadV(fUrl, GetSize(), ioVec, nReq, [this](RIOVec *blocks, unsigned int nBlocks) {
+      // Blocks are expected to be below the single request limit of the server, the other limits are honored here
+      const auto limits = GetReadVLimits();
+      for (unsigned int i = 0; i < nBlocks;) {
+         unsigned int n = 0;
+         std::uint64_t nbytes = 0;
+         while (i + n < nBlocks && n < limits.fMaxReqs &&
+                (n == 0 || nbytes + blocks[i + n].fSize <= limits.fMaxTotalSize)) {
+            nbytes += blocks[i + n++].fSize;
+         }
+         ReadVImpl(blocks + i, n);
+         i += n;
+      }
+   });
 }
 
 void ROOT::Internal::RRawFile::SetBuffering(bool value)
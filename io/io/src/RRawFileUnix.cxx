@@ -96,9 +96,14 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
+   // Ring setup is comparatively expensive and vector reads are typically issued in rapid succession
+   // by the same (I/O) thread, so the ring is created once per thread and then reused
+   thread_local std::unique_ptr<RIoUring> uring;
    if (!uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
+         if (!uring)
+            uring = std::make_unique<RIoUring>(); // throws std::runtime_error
+         auto &ring = *uring;
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -120,6 +125,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
          Warning("RRawFileUnix",
               "io_uring setup failed, falling back to blocking I/O in ReadV");
          uring_failed = true;
+         uring.reset();
       }
    }
 #endif
@@ -88,6 +88,15 @@ class Container {
 };
 ~~~
 
+To avoid keeping the complete JSON code of a big object in memory, it can be passed
+in chunks to a function while it is produced, e.g. to write it into a stream:
+~~~{.cpp}
+   std::ofstream ofs("h1.json");
+   TBufferJSON::ExportToSink([&ofs](const char *data, std::size_t len) { ofs.write(data, len); },
+                             h1, TH1::Class(), TBufferJSON::kNoSpaces + TBufferJSON::kBase64);
+~~~
+With TBufferJSON::kBase64, the numeric arrays are stored in the compact base64 binary coding.
+
 */
 
 #include "TBufferJSON.h"
@@ -569,6 +578,18 @@ void TBufferJSON::SetCompact(int level)
       fTypeNameTag = "_typename";
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Pass the JSON code produced by StoreObject() in chunks to the specified function
+/// instead of returning it as a single string
+/// The function is called each time the produced code reaches chunkSize bytes and
+/// once at the end with the remaining part; StoreObject() then returns an empty string
+
+void TBufferJSON::SetOutputSink(OutputSink_t sink, std::size_t chunkSize)
+{
+   fOutputSink = std::move(sink);
+   fOutputChunkSize = chunkSize;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Configures _typename tag in JSON structures
 /// By default "_typename" field in JSON structures used to store class information
@@ -712,9 +733,42 @@ TString TBufferJSON::StoreObject(const void *obj, const TClass *cl)
       Error("StoreObject", "Can not store object into TBuffer for reading");
    }
 
+   if (fOutputSink) {
+      // special classes like STL containers keep their complete output in the value
+      if ((fOutBuffer.Length() == 0) && (fOutputFlushed == 0))
+         fOutBuffer = fValue;
+      FlushOutput();
+      return TString();
+   }
+
    return fOutBuffer.Length() ? fOutBuffer : fValue;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Convert object into JSON and pass it in chunks to the sink function, see SetOutputSink()
+/// Returns the total length of the JSON code
+
+Long64_t TBufferJSON::ExportToSink(const OutputSink_t &sink, const void *obj, const TClass *cl, Int_t compact)
+{
+   if (!cl || !sink)
+      return 0;
+
+   TClass *clActual = obj ? cl->GetActualClass(obj) : nullptr;
+   const void *actualStart = obj;
+   if (clActual && (clActual != cl)) {
+      actualStart = (char *)obj - clActual->GetBaseClassOffset(cl);
+   } else {
+      clActual = const_cast<TClass *>(cl);
+   }
+
+   TBufferJSON buf;
+   buf.SetCompact(compact);
+   buf.SetOutputSink(sink);
+   buf.StoreObject(actualStart, clActual);
+
+   return buf.fOutputFlushed;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Converts selected data member into json
 /// Parameter ptr specifies address in memory, where data member is located
@@ -757,11 +811,12 @@ Int_t TBufferJSON::ExportToFile(const char *filename, const TObject *obj, const
    if (option && (*option >= '0') && (*option <= '3'))
       compact = TString(option).Atoi();
 
-   TString json = TBufferJSON::ConvertToJSON(obj, compact);
+   Long64_t len = 0;
 
    std::ofstream ofs(filename);
 
    if (strstr(filename, ".json.gz")) {
+      TString json = TBufferJSON::ConvertToJSON(obj, compact);
       const char *objbuf = json.Data();
       Long_t objlen = json.Length();
 
@@ -815,13 +870,16 @@ Int_t TBufferJSON::ExportToFile(const char *filename, const TObject *obj, const
       ofs.write(buffer, bufcur - buffer);
 
       free(buffer);
+      len = json.Length();
    } else {
-      ofs << json.Data();
+      // write JSON code while it is produced
+      len = ExportToSink([&ofs](const char *data, std::size_t size) { ofs.write(data, size); }, obj,
+                         TObject::Class(), compact);
    }
 
    ofs.close();
 
-   return json.Length();
+   return len;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -837,11 +895,12 @@ Int_t TBufferJSON::ExportToFile(const char *filename, const void *obj, const TCl
    if (option && (*option >= '0') && (*option <= '3'))
       compact = TString(option).Atoi();
 
-   TString json = TBufferJSON::ConvertToJSON(obj, cl, compact);
+   Long64_t len = 0;
 
    std::ofstream ofs(filename);
 
    if (strstr(filename, ".json.gz")) {
+      TString json = TBufferJSON::ConvertToJSON(obj, cl, compact);
       const char *objbuf = json.Data();
       Long_t objlen = json.Length();
 
@@ -895,13 +954,15 @@ Int_t TBufferJSON::ExportToFile(const char *filename, const void *obj, const TCl
       ofs.write(buffer, bufcur - buffer);
 
       free(buffer);
+      len = json.Length();
    } else {
-      ofs << json.Data();
+      // write JSON code while it is produced
+      len = ExportToSink([&ofs](const char *data, std::size_t size) { ofs.write(data, size); }, obj, cl, compact);
    }
 
    ofs.close();
 
-   return json.Length();
+   return len;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1170,6 +1231,23 @@ void TBufferJSON::AppendOutput(const char *line0, const char *line1)
          fOutput->Append(line1);
       }
    }
+
+   // the main output buffer is never modified once written, it can be passed to the sink
+   if (fOutputSink && (fOutput == &fOutBuffer) && ((std::size_t)fOutBuffer.Length() >= fOutputChunkSize))
+      FlushOutput();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pass the content of the main output buffer to the sink function and clear it
+
+void TBufferJSON::FlushOutput()
+{
+   if (!fOutputSink || (fOutBuffer.Length() == 0))
+      return;
+
+   fOutputSink(fOutBuffer.Data(), fOutBuffer.Length());
+   fOutputFlushed += fOutBuffer.Length();
+   fOutBuffer.Clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -75,12 +75,34 @@ void TBufferMerger::SetMergeOptions(const TString& options)
 
 void TBufferMerger::Merge(ROOT::TBufferMergerFile *memfile)
 {
-   std::lock_guard q(fMergeMutex);
+   // The StreamerInfo record only concerns this file, write (and compress) it before queuing.
    memfile->WriteStreamerInfo();
-   fMerger.AddFile(memfile);
+
+   std::unique_lock<std::mutex> lock(fMergeMutex);
+   fQueue.push_back(memfile);
+   const size_t ticket = ++fNQueued;
+
+   // Either another thread merges this file along with its own, or this thread merges all the queued files.
+   fMergeDone.wait(lock, [this, ticket] { return fNMerged >= ticket || !fMerging; });
+   if (fNMerged >= ticket)
+      return;
+
+   fMerging = true;
+   std::vector<TBufferMergerFile *> batch;
+   batch.swap(fQueue);
+   lock.unlock();
+
+   for (auto file : batch)
+      fMerger.AddFile(file);
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
    fMerger.Reset();
+
+   lock.lock();
+   fNMerged += batch.size();
+   fMerging = false;
+   lock.unlock();
+   fMergeDone.notify_all();
 }
 
 } // namespace ROOT
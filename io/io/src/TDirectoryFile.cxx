@@ -48,10 +48,161 @@ End_Macro
 #include "TProcessUUID.h"
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
+#include "TEnv.h"
+
+#include <algorithm>
+#include <vector>
 
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
 
+namespace ROOT {
+namespace Internal {
+
+/// Index of the key list record of a read-only directory, built without creating the TKeys.
+///
+/// Creating a TKey for each entry of a directory with hundreds of thousands of keys takes seconds and hundreds of
+/// MB, while most jobs then read a handful of objects. The index only records the hash of the name and the offset of
+/// each key in the record; TKeys are created by name when they are looked up and added to the directory's list of
+/// keys. The first use of the complete list creates the remaining ones, in the original order, and drops the index.
+class RDirectoryKeyIndex {
+   struct REntry {
+      ULong_t fHash;       ///< Hash of the key name, see TString::Hash(const void *, Int_t)
+      Int_t fOffset;       ///< Offset of the key in the key list record
+      Int_t fClassOffset;  ///< Offset of the class name in the key list record
+      TKey *fKey{nullptr}; ///< The key, once created
+   };
+
+   TKey *fHeaderKey;             ///< Holds the key list record
+   std::vector<REntry> fEntries; ///< In the order of the key list record
+   std::vector<Int_t> fByHash;   ///< Indices into fEntries, sorted by name hash then position
+
+   std::vector<Int_t>::const_iterator FindHash(ULong_t hash) const
+   {
+      return std::lower_bound(fByHash.begin(), fByHash.end(), hash,
+                              [this](Int_t i, ULong_t h) { return fEntries[i].fHash < h; });
+   }
+
+   static void ReadString(const char *&buffer, const char *&str, Int_t &len)
+   {
+      UChar_t nwh;
+      char *cur = const_cast<char *>(buffer);
+      frombuf(cur, &nwh);
+      len = nwh;
+      if (nwh == 255)
+         frombuf(cur, &len);
+      str = cur;
+      buffer = cur + len;
+   }
+
+   TKey *CreateKey(REntry &entry, TDirectory *dir)
+   {
+      char *buffer = fHeaderKey->GetBuffer() + entry.fOffset;
+      entry.fKey = new TKey(dir);
+      entry.fKey->ReadKeyBuffer(buffer);
+      return entry.fKey;
+   }
+
+public:
+   /// Take ownership of headerkey, whose buffer holds `nkeys` keys starting at `buffer`.
+   RDirectoryKeyIndex(TKey *headerkey, char *buffer, Int_t nkeys, Long64_t fsize) : fHeaderKey(headerkey)
+   {
+      const char *start = fHeaderKey->GetBuffer();
+      fEntries.reserve(nkeys);
+      for (Int_t i = 0; i < nkeys; ++i) {
+         REntry entry;
+         entry.fOffset = buffer - start;
+         char *cur = buffer + sizeof(Int_t);
+         Version_t version;
+         frombuf(cur, &version);
+         cur += sizeof(Int_t) + sizeof(UInt_t) + 2 * sizeof(Short_t); // fObjlen, fDatime, fKeylen, fCycle
+         Long64_t seekkey, seekpdir;
+         if (version > 1000) {
+            frombuf(cur, &seekkey);
+            frombuf(cur, &seekpdir);
+            seekpdir &= 0xffffffffffffLL; // the upper 16 bits hold the pid offset, see TKey::ReadKeyBuffer
+         } else {
+            UInt_t skey, spdir;
+            frombuf(cur, &skey);
+            frombuf(cur, &spdir);
+            seekkey = skey;
+            seekpdir = spdir;
+         }
+         if (seekkey < 64 || seekkey > fsize || seekpdir < 64 || seekpdir > fsize) {
+            ::Error("TDirectoryFile::ReadKeys", "reading illegal key, exiting after %d keys", i);
+            break;
+         }
+         entry.fClassOffset = cur - start;
+         const char *str;
+         Int_t len;
+         const char *next = cur;
+         ReadString(next, str, len); // class name
+         ReadString(next, str, len); // name
+         entry.fHash = TString::Hash(str, len);
+         ReadString(next, str, len); // title
+         buffer = const_cast<char *>(next);
+         fEntries.push_back(entry);
+      }
+
+      fByHash.resize(fEntries.size());
+      for (std::size_t i = 0; i < fByHash.size(); ++i)
+         fByHash[i] = i;
+      std::stable_sort(fByHash.begin(), fByHash.end(),
+                       [this](Int_t a, Int_t b) { return fEntries[a].fHash < fEntries[b].fHash; });
+   }
+
+   ~RDirectoryKeyIndex() { delete fHeaderKey; }
+
+   Int_t GetSize() const { return fEntries.size(); }
+
+   /// Create the keys that may be called `name` and are not created yet, and add them to `keys`.
+   void LoadKeys(const char *name, TDirectory *dir, TList *keys)
+   {
+      const ULong_t hash = TString::Hash(name, strlen(name));
+      for (auto it = FindHash(hash); it != fByHash.end() && fEntries[*it].fHash == hash; ++it) {
+         auto &entry = fEntries[*it];
+         if (!entry.fKey)
+            keys->Add(CreateKey(entry, dir));
+      }
+   }
+
+   /// Create all the keys not created yet and fill `keys` with all keys, in the order of the key list record.
+   void LoadAllKeys(TDirectory *dir, TList *keys)
+   {
+      keys->Clear("nodelete");
+      for (auto &entry : fEntries)
+         keys->Add(entry.fKey ? entry.fKey : CreateKey(entry, dir));
+   }
+
+   /// Forget about `key`, which is being deleted.
+   void Forget(TKey *key)
+   {
+      const ULong_t hash = TString::Hash(key->GetName(), strlen(key->GetName()));
+      for (auto it = FindHash(hash); it != fByHash.end() && fEntries[*it].fHash == hash; ++it) {
+         if (fEntries[*it].fKey == key)
+            fEntries[*it].fKey = nullptr;
+      }
+   }
+
+   Int_t CountClass(const char *classname) const
+   {
+      const Int_t n = strlen(classname);
+      Int_t count = 0;
+      for (auto &entry : fEntries) {
+         const char *cur = fHeaderKey->GetBuffer() + entry.fClassOffset;
+         const char *str;
+         Int_t len;
+         ReadString(cur, str, len);
+         if (len == n && !strncmp(str, classname, n))
+            ++count;
+      }
+      return count;
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
 ClassImp(TDirectoryFile);
 
 
@@ -177,6 +328,7 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -229,6 +381,8 @@ Int_t TDirectoryFile::AppendKey(TKey *key)
       Error("AppendKey","TDirectoryFile not initialized yet.");
       return 0;
    }
+   if (fKeyIndex)
+      GetListOfKeys();
 
    fModified = kTRUE;
 
@@ -266,13 +420,14 @@ void TDirectoryFile::Browse(TBrowser *b)
       TObject *obj = nullptr;
       TIter nextin(fList);
       TKey *key = nullptr, *keyo = nullptr;
-      TIter next(fKeys);
+      TList *keys = GetListOfKeys();
+      TIter next(keys);
 
       cd();
 
       //Add objects that are only in memory
       while ((obj = nextin())) {
-         if (fKeys->FindObject(obj->GetName())) continue;
+         if (keys->FindObject(obj->GetName())) continue;
          b->Add(obj, obj->GetName());
       }
 
@@ -319,8 +474,8 @@ void TDirectoryFile::BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir
    fSeekDir    = 0;
    fSeekParent = 0;
    fSeekKeys   = 0;
-   fList       = new THashList(100,50);
-   fKeys       = new THashList(100,50);
+   fList       = new THashList(100,3);
+   fKeys       = new THashList(100,3);
    fList->UseRWLock();
    fMother     = motherDir;
    fFile       = motherFile ? motherFile : TFile::CurrentFile();
@@ -588,6 +743,7 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -801,7 +957,7 @@ TKey *TDirectoryFile::FindKeyAny(const char *keyname) const
 
    DecodeNameCycle(keyname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = GetListOfKeysFor(name);
    if (!listOfKeys) {
       Error("FindKeyAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -853,7 +1009,7 @@ TObject *TDirectoryFile::FindObjectAny(const char *aname) const
 
    DecodeNameCycle(aname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = GetListOfKeysFor(name);
    if (!listOfKeys) {
       Error("FindObjectAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -974,7 +1130,7 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = GetListOfKeysFor(namobj);
    if (!listOfKeys) {
       Error("Get", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1097,7 +1253,7 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = GetListOfKeysFor(namobj);
    if (!listOfKeys) {
       Error("GetObjectChecked", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1138,7 +1294,7 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = GetListOfKeysFor(name);
    if (!listOfKeys) {
       Error("GetKey", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1156,6 +1312,80 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
    return nullptr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of keys of this directory.
+///
+/// The keys of large directories of read-only files are read on demand (see
+/// ReadKeys); this creates the ones that were not looked up yet.
+
+TList *TDirectoryFile::GetListOfKeys() const
+{
+   if (fKeyIndex) {
+      fKeyIndex->LoadAllKeys(const_cast<TDirectoryFile *>(this), fKeys);
+      DeleteKeyIndex();
+   }
+   return fKeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of keys of this directory, in which all the keys called
+/// `name` are present, without creating the other keys not read yet.
+
+THashList *TDirectoryFile::GetListOfKeysFor(const char *name) const
+{
+   if (fKeyIndex)
+      fKeyIndex->LoadKeys(name, const_cast<TDirectoryFile *>(this), fKeys);
+   return dynamic_cast<THashList *>(fKeys);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of this directory.
+
+Int_t TDirectoryFile::GetNkeys() const
+{
+   return fKeyIndex ? fKeyIndex->GetSize() : fKeys->GetSize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of this directory holding an object of class
+/// `classname`, without creating the keys not read yet.
+
+Int_t TDirectoryFile::CountKeysOfClass(const char *classname) const
+{
+   if (fKeyIndex)
+      return fKeyIndex->CountClass(classname);
+   Int_t count = 0;
+   TIter next(fKeys);
+   while (auto key = static_cast<TKey *>(next())) {
+      if (!strcmp(key->GetClassName(), classname))
+         ++count;
+   }
+   return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove key from the list of keys, e.g. because it is being deleted, without
+/// creating the keys not read yet.
+
+void TDirectoryFile::RemoveKey(TKey *key)
+{
+   if (fKeyIndex)
+      fKeyIndex->Forget(key);
+   if (fKeys)
+      fKeys->Remove(key);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Drop the index of the keys not read yet, keeping the keys already created.
+
+void TDirectoryFile::DeleteKeyIndex() const
+{
+   // Reset fKeyIndex first: the index deletes the key of the key list record, which removes itself from us.
+   auto index = fKeyIndex;
+   fKeyIndex = nullptr;
+   delete index;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// List Directory contents
 ///
@@ -1209,7 +1439,7 @@ void TDirectoryFile::ls(Option_t *option) const
 
    if (diskobj && fKeys) {
       //*-* Loop on all the keys
-      for (TObjLink *lnk = fKeys->FirstLink(); lnk != nullptr; lnk = lnk->Next()) {
+      for (TObjLink *lnk = GetListOfKeys()->FirstLink(); lnk != nullptr; lnk = lnk->Next()) {
          TKey *key = (TKey*)lnk->GetObject();
          TString s = key->GetName();
          if (!reg.IsNull() && s.Index(re) == kNPOS)
@@ -1388,6 +1618,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      DeleteKeyIndex();
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1430,6 +1661,21 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
       TKey *key;
       frombuf(buffer, &nkeys);
+
+      // Large directories of read-only files only get an index; their keys are created when they are looked up.
+      const Int_t lazyMinKeys = gEnv->GetValue("TFile.LazyKeysMinNumber", 1000);
+      if (!forceRead && fKeyIndex)
+         GetListOfKeys(); // keep the keys read before
+      if (lazyMinKeys > 0 && nkeys >= lazyMinKeys && !fFile->IsWritable() && !fKeyIndex && fKeys->IsEmpty()) {
+         fKeyIndex = new ROOT::Internal::RDirectoryKeyIndex(headerkey, buffer, nkeys, fsize);
+         return fKeyIndex->GetSize();
+      }
+
+      // Size the hash table once instead of rehashing it while the keys are added;
+      // fKeys is created with 100 slots
+      if (fKeys->IsEmpty() && nkeys > 100)
+         static_cast<THashList *>(fKeys)->Rehash(2 * nkeys);
+
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
@@ -1466,7 +1712,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 Int_t TDirectoryFile::ReadTObject(TObject *obj, const char *keyname)
 {
    if (!fFile) { Error("ReadTObject","No file open"); return 0; }
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = GetListOfKeysFor(keyname);
    if (!listOfKeys) {
       Error("ReadTObject", "Unexpected type of TDirectoryFile::fKeys!");
       return 0;
@@ -1507,7 +1753,7 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    fSeekParent = 0; // updated by Init
    fSeekKeys = 0;   // updated by Init
    // Does not change: fFile
-   TKey *key = fKeys ? (TKey*)fKeys->FindObject(fName) : nullptr;
+   TKey *key = fKeys ? (TKey*)GetListOfKeys()->FindObject(fName) : nullptr;
    TClass *cl = IsA();
    if (key) {
       cl = TClass::GetClass(key->GetClassName());
@@ -1686,6 +1932,10 @@ void TDirectoryFile::SetWritable(Bool_t writable)
 {
    TDirectory::TContext ctxt(this);
 
+   // The write paths use the complete list of keys.
+   if (writable && fKeyIndex)
+      GetListOfKeys();
+
    fWritable = writable;
 
    // recursively set all sub-directories
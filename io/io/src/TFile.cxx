@@ -95,6 +95,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include <sys/stat.h>
 #ifndef WIN32
 #include <unistd.h>
+#include <sys/mman.h>
 #ifndef R__FBSD
 #include <sys/xattr.h>
 #endif
@@ -143,14 +144,19 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TObjString.h"
 #include "TStopwatch.h"
 #include "compiledata.h"
+#include <algorithm>
 #include <cmath>
+#include <future>
 #include <iostream>
 #include <set>
+#include <thread>
 #include "TSchemaRule.h"
 #include "TSchemaRuleSet.h"
 #include "TThreadSlots.h"
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include "ROOT/RBlockCache.hxx"
+#include "ROOT/RTrace.hxx"
 #include <memory>
 
 #ifdef R__FBSD
@@ -813,6 +819,10 @@ void TFile::Init(Bool_t create)
          goto zombie;
       }
 
+      //*-* -------------Prefetch the records read by the rest of Init and the first Get
+      if (!fWritable)
+         PrefetchOpenPlan(nbytes);
+
       //*-* -------------Check if file is truncated
       Long64_t size;
       if ((size = GetSize()) == -1) {          // NOLINT: silence clang-tidy warnings
@@ -820,6 +830,10 @@ void TFile::Init(Bool_t create)
          goto zombie;
       }
 
+      //*-* -------------Map the file in memory if requested
+      if (!fWritable && gEnv->GetValue("TFile.MemoryMap", 0) == 1)
+         MapFile();
+
       //*-* -------------Check if, in case of inconsistencies, we are requested to
       //*-* -------------attempt recovering the file
       Bool_t tryrecover = (gEnv->GetValue("TFile.Recover", 1) == 1) ? kTRUE : kFALSE;
@@ -897,7 +911,7 @@ void TFile::Init(Bool_t create)
             }
          } else if (fVersion != gROOT->GetVersionInt() && fVersion > 30000) {
             // Don't complain about missing streamer info for empty files.
-            if (fKeys->GetSize()) {
+            if (GetNkeys()) {
                // #14068: we take into account the different way of expressing the version
                const auto separator = fVersion < 63200 ? "/" : ".";
                const auto thisVersion = gROOT->GetVersionInt();
@@ -915,11 +929,7 @@ void TFile::Init(Bool_t create)
 
    // Count number of TProcessIDs in this file
    {
-      TIter next(fKeys);
-      TKey *key;
-      while ((key = (TKey*)next())) {
-         if (!strcmp(key->GetClassName(),"TProcessID")) fNProcessIDs++;
-      }
+      fNProcessIDs += CountKeysOfClass("TProcessID");
       fProcessIDs = new TObjArray(fNProcessIDs+1);
    }
 
@@ -987,6 +997,8 @@ void TFile::Close(Option_t *option)
    // TDirectoryFile, TDirectoryFile::Close will induce the proper cd.
    fMustFlush = kFALSE; // Make sure there is only one Flush.
    TDirectoryFile::Close(option);
+   DropOpenPlan();
+   UnmapFile();
 
    if (IsWritable()) {
       TFree *f1 = (TFree*)fFree->First();
@@ -1269,6 +1281,13 @@ TFileCacheRead *TFile::GetCacheRead(const TObject* tree) const
       }
       return fCacheRead;
    }
+#ifdef R__USE_IMT
+   if (fConcurrentRead) {
+      // A tree only uses its own cache, never the default one which belongs to another tree.
+      std::lock_guard<std::mutex> lock(fReadMutex);
+      return (TFileCacheRead *)fCacheReadMap->GetValue(tree);
+   }
+#endif
    TFileCacheRead *cache = (TFileCacheRead *)fCacheReadMap->GetValue(tree);
    if (!cache) return fCacheRead;
    return cache;
@@ -1720,8 +1739,12 @@ void TFile::Print(Option_t *option) const
 
 Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
+   R__TRACE_SCOPE("io", "TFile::ReadBuffer");
    if (IsOpen()) {
 
+      if (fConcurrentRead)
+         return ReadBufferConcurrent(buf, pos, len);
+
       SetOffset(pos);
 
       Int_t st;
@@ -1734,6 +1757,12 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
          return kFALSE;
       }
 
+      if (const char *mapped = GetMappedBuffer(pos, len)) {
+         memcpy(buf, mapped, len);
+         SetOffset(pos + len);
+         return kFALSE;
+      }
+
       Seek(pos);
       ssize_t siz;
 
@@ -1779,6 +1808,13 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
          return kFALSE;
       }
 
+      Long64_t off = GetRelOffset();
+      if (const char *mapped = GetMappedBuffer(off, len)) {
+         memcpy(buf, mapped, len);
+         SetOffset(off + len);
+         return kFALSE;
+      }
+
       ssize_t siz;
       Double_t start = 0;
 
@@ -1811,6 +1847,141 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read a buffer at the offset 'pos' in a file read by several threads at once.
+///
+/// Neither the file offset nor the default read cache are used, see
+/// SetConcurrentRead(). Returns kTRUE in case of failure.
+
+Bool_t TFile::ReadBufferConcurrent(char *buf, Long64_t pos, Int_t len)
+{
+#ifdef R__USE_IMT
+   if (const char *mapped = GetMappedBuffer(pos, len)) {
+      memcpy(buf, mapped, len);
+      return kFALSE;
+   }
+
+   Double_t start = 0;
+   if (gPerfStats) start = TTimeStamp();
+
+   ssize_t siz;
+#ifndef WIN32
+   const Long64_t offset = pos + fArchiveOffset;
+#if defined(R__SEEK64)
+   while ((siz = ::pread64(fD, buf, len, offset)) < 0 && GetErrno() == EINTR)
+#else
+   while ((siz = ::pread(fD, buf, len, offset)) < 0 && GetErrno() == EINTR)
+#endif
+      ResetErrno();
+#else
+   {
+      std::lock_guard<std::mutex> lock(fReadMutex);
+      Seek(pos);
+      while ((siz = SysRead(fD, buf, len)) < 0 && GetErrno() == EINTR)
+         ResetErrno();
+   }
+#endif
+
+   if (siz < 0) {
+      SysError("ReadBuffer", "error reading from file %s", GetName());
+      return kTRUE;
+   }
+   if (siz != len) {
+      Error("ReadBuffer", "error reading all requested bytes from file %s, got %ld of %d",
+            GetName(), (Long_t)siz, len);
+      return kTRUE;
+   }
+   fgBytesRead += siz;
+   fgReadCalls++;
+
+   std::lock_guard<std::mutex> lock(fReadMutex);
+   fBytesRead += siz;
+   fReadCalls++;
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+   if (gPerfStats)
+      gPerfStats->FileReadEvent(this, len, start);
+   return kFALSE;
+#else
+   (void)buf;
+   (void)pos;
+   (void)len;
+   return kTRUE;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the local block cache to be used by the ReadBuffers() implementation
+/// of a remote file, or nullptr. The cache is configured by the
+/// TFile.BlockCacheDir, TFile.BlockCacheSize and TFile.BlockCacheBlockSize rc
+/// variables; it is only used for files opened read-only and not inside an
+/// archive.
+
+ROOT::Internal::RBlockCache *TFile::GetBlockCache() const
+{
+   if (IsWritable() || fArchiveOffset)
+      return nullptr;
+   return ROOT::Internal::RBlockCache::GetGlobal();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the nbuf blocks described in arrays pos and len through the local
+/// block cache. The blocks of the file that are not in the cache are read with
+/// a single call to readRemote, which has the signature and return value of
+/// ReadBuffers(), and stored in the cache. Returns kTRUE in case of failure.
+
+Bool_t TFile::ReadBuffersBlockCached(ROOT::Internal::RBlockCache &cache, char *buf, Long64_t *pos, Int_t *len,
+                                     Int_t nbuf, const ReadBuffersFunc_t &readRemote)
+{
+   using RIOVec = ROOT::Internal::RRawFile::RIOVec;
+
+   if (fBlockCacheFileSize < 0)
+      fBlockCacheFileSize = GetSize();
+   // Prefetch requests without a buffer and files of unknown size bypass the cache
+   if (!buf || fBlockCacheFileSize <= 0)
+      return readRemote(buf, pos, len, nbuf);
+
+   std::vector<RIOVec> ioVec(nbuf);
+   char *cursor = buf;
+   for (Int_t i = 0; i < nbuf; ++i) {
+      ioVec[i].fBuffer = cursor;
+      ioVec[i].fOffset = pos[i];
+      ioVec[i].fSize = len[i];
+      cursor += len[i];
+   }
+
+   Bool_t failed = kFALSE;
+   cache.ReadV(fUrl.GetUrl(), fBlockCacheFileSize, ioVec.data(), nbuf, [&](RIOVec *blocks, unsigned int nBlocks) {
+      std::vector<Long64_t> blockPos(nBlocks);
+      std::vector<Int_t> blockLen(nBlocks);
+      std::size_t nbytes = 0;
+      for (unsigned int i = 0; i < nBlocks; ++i) {
+         blockPos[i] = blocks[i].fOffset;
+         blockLen[i] = blocks[i].fSize;
+         nbytes += blocks[i].fSize;
+      }
+      std::vector<char> remote(nbytes);
+      if (readRemote(remote.data(), blockPos.data(), blockLen.data(), nBlocks)) {
+         failed = kTRUE;
+         return;
+      }
+      nbytes = 0;
+      for (unsigned int i = 0; i < nBlocks; ++i) {
+         memcpy(blocks[i].fBuffer, remote.data() + nbytes, blocks[i].fSize);
+         blocks[i].fOutBytes = blocks[i].fSize;
+         nbytes += blocks[i].fSize;
+      }
+   });
+   if (failed)
+      return kTRUE;
+
+   for (Int_t i = 0; i < nbuf; ++i) {
+      if (ioVec[i].fOutBytes != static_cast<std::size_t>(len[i]))
+         return kTRUE;
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the nbuf blocks described in arrays pos and len.
 ///
@@ -1821,6 +1992,7 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
 
 Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 {
+   R__TRACE_SCOPE("io", "TFile::ReadBuffers");
    // called with buf=0, from TFileCacheRead to pass list of readahead buffers
    if (!buf) {
       for (Int_t j = 0; j < nbuf; j++) {
@@ -1831,6 +2003,15 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       return kFALSE;
    }
 
+   if (fConcurrentRead) {
+      // Read each block at its own position, the read-ahead buffer relies on the file offset.
+      for (Int_t i = 0, k = 0; i < nbuf; k += len[i], ++i) {
+         if (ReadBufferConcurrent(&buf[k], pos[i], len[i]))
+            return kTRUE;
+      }
+      return kFALSE;
+   }
+
    Int_t k = 0;
    Bool_t result = kTRUE;
    TFileCacheRead *old = fCacheRead;
@@ -1890,6 +2071,14 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
 {
    Long64_t off = GetRelOffset();
+   if (!fOpenPlanPos.empty()) {
+      if (ReadBufferViaOpenPlan(buf, off, len)) {
+         SetOffset(off + len);
+         return 1;
+      }
+      // The plan only helps until the first read it did not foresee.
+      DropOpenPlan();
+   }
    if (fCacheRead) {
       Int_t st = fCacheRead->ReadBuffer(buf, off, len);
       if (st < 0)
@@ -1916,6 +2105,176 @@ Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Prefetch, in a single ReadBuffers() call, the records that opening a file
+/// and reading its first object need: the keys list of the top directory, the
+/// StreamerInfo record and the first TFile.OpenPlanSize bytes (default 64 KB)
+/// following the top directory record, where the first objects written to the
+/// file usually are. Their locations are all known once the file header has
+/// been read, so a remote file is opened in one round trip instead of one per
+/// record.
+///
+/// The prefetched records are served by ReadBufferViaCache() and dropped at
+/// the first read that they do not contain. TFile.OpenPlan selects the files
+/// for which this is done: 0 for none, 1 (default) for the remote files, i.e.
+/// those handled by a TFile subclass other than TMemFile, 2 for all files.
+
+void TFile::PrefetchOpenPlan(Int_t nbytesDir)
+{
+   DropOpenPlan();
+
+   Int_t mode = gEnv->GetValue("TFile.OpenPlan", 1);
+   if (mode <= 0 || (mode == 1 && (IsA() == TFile::Class() || InheritsFrom("TMemFile"))))
+      return;
+
+   std::vector<std::pair<Long64_t, Long64_t>> ranges; // [begin, end)
+   auto addRange = [&](Long64_t begin, Long64_t length) {
+      if (begin > fBEGIN && length > 0 && begin + length <= fEND)
+         ranges.emplace_back(begin, begin + length);
+   };
+   addRange(fSeekKeys, fNbytesKeys);
+   if (fgReadInfo)
+      addRange(fSeekInfo, fNbytesInfo);
+   Long64_t firstData = fBEGIN + nbytesDir;
+   addRange(firstData, std::min<Long64_t>(gEnv->GetValue("TFile.OpenPlanSize", 65536), fEND - firstData));
+   if (ranges.empty())
+      return;
+
+   // Merge the overlapping and adjacent ranges: the first data range often
+   // covers the whole content of a small file, keys list included.
+   std::sort(ranges.begin(), ranges.end());
+   std::vector<Long64_t> pos;
+   std::vector<Int_t> len;
+   Long64_t total = 0;
+   Long64_t begin = ranges[0].first, end = ranges[0].second;
+   for (std::size_t i = 1; i <= ranges.size(); ++i) {
+      if (i < ranges.size() && ranges[i].first <= end) {
+         end = std::max(end, ranges[i].second);
+         continue;
+      }
+      if (end - begin > kMaxInt)
+         return;
+      pos.push_back(begin);
+      len.push_back(end - begin);
+      total += end - begin;
+      if (i < ranges.size()) {
+         begin = ranges[i].first;
+         end = ranges[i].second;
+      }
+   }
+   if (total > kMaxInt)
+      return;
+
+   std::vector<char> buffer(total);
+   if (ReadBuffers(buffer.data(), pos.data(), len.data(), pos.size())) {
+      // Not fatal: the records are read again, one by one, by the rest of Init.
+      return;
+   }
+   fOpenPlanBuffer = std::move(buffer);
+   fOpenPlanPos = std::move(pos);
+   fOpenPlanLen = std::move(len);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy len bytes at the relative offset off from the records prefetched by
+/// PrefetchOpenPlan(). Returns kFALSE if they do not contain the whole buffer.
+
+Bool_t TFile::ReadBufferViaOpenPlan(char *buf, Long64_t off, Int_t len)
+{
+   Long64_t start = 0;
+   for (std::size_t i = 0; i < fOpenPlanPos.size(); ++i) {
+      if (off >= fOpenPlanPos[i] && off + len <= fOpenPlanPos[i] + fOpenPlanLen[i]) {
+         memcpy(buf, fOpenPlanBuffer.data() + start + (off - fOpenPlanPos[i]), len);
+         return kTRUE;
+      }
+      start += fOpenPlanLen[i];
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the records prefetched by PrefetchOpenPlan().
+
+void TFile::DropOpenPlan()
+{
+   std::vector<char>().swap(fOpenPlanBuffer);
+   fOpenPlanPos.clear();
+   fOpenPlanLen.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Map a local file opened read-only in memory, if TFile.MemoryMap is set to 1.
+///
+/// ReadBuffer() then copies from the mapping instead of calling read, and
+/// TKey and TBasket take the records straight from GetMappedBuffer(): the
+/// uncompressed objects are streamed from the mapping and the compressed ones
+/// are decompressed from it, saving a copy. The pages are shared through the
+/// page cache with all the processes reading the same file. The mapping is
+/// private, so that the rare streamers modifying their input buffer do not
+/// fault; they only get their own copy of the pages they touch.
+///
+/// Only plain TFile objects are mapped, the subclasses do not read through a
+/// file descriptor. Not available on Windows.
+
+void TFile::MapFile()
+{
+#ifndef WIN32
+   if (fMapAddress || fD < 0 || IsA() != TFile::Class())
+      return;
+   Long_t id, flags, modtime;
+   Long64_t size;
+   if (SysStat(fD, &id, &size, &flags, &modtime) || size <= 0)
+      return;
+   void *address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fD, 0);
+   if (address == MAP_FAILED) {
+      Warning("MapFile", "cannot map file %s in memory, reading it with read calls", GetName());
+      return;
+   }
+   fMapAddress = static_cast<char *>(address);
+   fMapSize = size;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the memory mapping of the file, see MapFile().
+
+void TFile::UnmapFile()
+{
+#ifndef WIN32
+   if (fMapAddress)
+      munmap(fMapAddress, fMapSize);
+#endif
+   fMapAddress = nullptr;
+   fMapSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the address of the len bytes at the relative offset pos in the
+/// memory mapping of the file, accounting them as read, or nullptr if the
+/// file is not mapped or the mapping does not contain them.
+///
+/// The returned buffer is valid until the file is closed.
+
+const char *TFile::GetMappedBuffer(Long64_t pos, Int_t len)
+{
+   Long64_t begin = pos + fArchiveOffset;
+   if (!fMapAddress || begin < 0 || len < 0 || begin + len > fMapSize)
+      return nullptr;
+
+#ifdef R__USE_IMT
+   std::unique_lock<std::mutex> lock(fReadMutex, std::defer_lock);
+   if (fConcurrentRead)
+      lock.lock();
+#endif
+   fBytesRead  += len;
+   fgBytesRead += len;
+   fReadCalls++;
+   fgReadCalls++;
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+   return fMapAddress + begin;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the FREE linked list.
 ///
@@ -2220,6 +2579,8 @@ Int_t TFile::ReOpen(Option_t *mode)
       // switch to UPDATE mode
 
       // close readonly file
+      UnmapFile();
+      fConcurrentRead = kFALSE;
       if (IsOpen()) {
          SysClose(fD);
          fD = -1;
@@ -2341,6 +2702,41 @@ void TFile::SetCompressionSettings(Int_t settings)
    fCompress = settings;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Allow several threads to read from this file at the same time.
+///
+/// Only local files opened read-only support it, and ROOT::EnableThreadSafety()
+/// must have been called. The data is then read with pread(), at the requested
+/// position and without going through the shared file offset, so the reads done
+/// through different TKey objects or by the baskets of different TTree objects
+/// do not need to be serialized. All the threads can share this TFile, its StreamerInfos and its
+/// keys instead of opening their own copy of the file.
+///
+/// The read cache of a tree is then only used by that tree: there is no default
+/// read cache. Reading an object that registers itself in its directory (e.g. a
+/// TTree, or a histogram unless TH1::AddDirectory(kFALSE) was called) modifies
+/// the list of objects of that directory and must still be serialized by the
+/// caller; the reads done by the object afterwards are concurrent.
+
+void TFile::SetConcurrentRead(Bool_t concurrent)
+{
+   if (!concurrent) {
+      fConcurrentRead = kFALSE;
+      return;
+   }
+#ifdef R__USE_IMT
+   if (fWritable || IsA() != TFile::Class() || fD < 0) {
+      Error("SetConcurrentRead", "only local files opened read-only can be read concurrently, not %s", GetName());
+      return;
+   }
+   // Finding a key in a directory whose keys are read on demand adds the key to the list.
+   GetListOfKeys();
+   fConcurrentRead = kTRUE;
+#else
+   Error("SetConcurrentRead", "ROOT was built without support for implicit multi-threading");
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a pointer to the read cache.
 ///
@@ -2365,6 +2761,11 @@ void TFile::SetCompressionSettings(Int_t settings)
 
 void TFile::SetCacheRead(TFileCacheRead *cache, TObject* tree, ECacheAction action)
 {
+#ifdef R__USE_IMT
+   std::unique_lock<std::mutex> lock(fReadMutex, std::defer_lock);
+   if (fConcurrentRead)
+      lock.lock();
+#endif
    if (tree) {
       if (cache) fCacheReadMap->Add(tree, cache);
       else {
@@ -2378,7 +2779,9 @@ void TFile::SetCacheRead(TFileCacheRead *cache, TObject* tree, ECacheAction acti
    if (cache) cache->SetFile(this, action);
    else if (!tree && fCacheRead && (action != kDoNotDisconnect)) fCacheRead->SetFile(0, action);
    // For backward compatibility the last Cache set is the default cache.
-   fCacheRead = cache;
+   // When reading concurrently, the cache of a tree is not shared with the other threads.
+   if (!tree || !fConcurrentRead)
+      fCacheRead = cache;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4476,6 +4879,67 @@ TFile *TFile::Open(TFileOpenHandle *fh)
    return f;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Open several files concurrently.
+///
+/// Each file is opened with TFile::Open(name, option) by one of at most
+/// `concurrency` threads (by default, as many as the number of cores), so
+/// that the latencies of opening remote files, i.e. contacting the
+/// redirectors and reading the header, the list of keys and the StreamerInfo
+/// record, overlap instead of adding up.
+///
+/// The returned futures are in the same order as the names; each becomes ready
+/// as soon as its file is open and holds a null pointer if the file could not be
+/// opened. Thread safety (ROOT::EnableThreadSafety()) is enabled by this call.
+/// The opening threads are detached: all the futures must have been waited for
+/// before the end of the program.
+/// ~~~{.cpp}
+/// auto futures = TFile::OpenMany(names, "READ", 16);
+/// for (auto &future : futures) {
+///    std::unique_ptr<TFile> file = future.get();
+///    if (file) ...
+/// }
+/// ~~~
+
+std::vector<std::future<std::unique_ptr<TFile>>>
+TFile::OpenMany(const std::vector<std::string> &names, Option_t *option, Int_t concurrency)
+{
+   // Shared with the opening threads, which may outlive the returned futures.
+   struct ROpenManyRequest {
+      std::vector<std::string> fNames;
+      TString fOption;
+      std::vector<std::promise<std::unique_ptr<TFile>>> fFiles;
+      std::atomic<std::size_t> fNext{0};
+   };
+
+   std::vector<std::future<std::unique_ptr<TFile>>> futures;
+   if (names.empty())
+      return futures;
+
+   ROOT::EnableThreadSafety();
+
+   auto request = std::make_shared<ROpenManyRequest>();
+   request->fNames = names;
+   request->fOption = option;
+   request->fFiles.resize(names.size());
+   futures.reserve(names.size());
+   for (auto &file : request->fFiles)
+      futures.emplace_back(file.get_future());
+
+   std::size_t nThreads = concurrency > 0 ? concurrency : std::max(1u, std::thread::hardware_concurrency());
+   nThreads = std::min(nThreads, names.size());
+   for (std::size_t t = 0; t < nThreads; ++t) {
+      std::thread([request]() {
+         for (std::size_t i = request->fNext++; i < request->fNames.size(); i = request->fNext++) {
+            std::unique_ptr<TFile> file(TFile::Open(request->fNames[i].c_str(), request->fOption));
+            request->fFiles[i].set_value(std::move(file));
+         }
+      }).detach();
+   }
+
+   return futures;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to system open. All arguments like in POSIX open().
 
@@ -20,6 +20,13 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+In streaming mode (see SetStreamingMerge()) each object is merged with
+its counterpart of one input file at a time and every merged object,
+except trees, is written out and deleted as soon as its name has been
+processed, including when merging incrementally over several batches of
+fMaxOpenedFiles input files. The memory used is then of the order of the
+largest object instead of growing with the number of inputs and objects.
 */
 
 #include "TFileMerger.h"
@@ -40,6 +47,11 @@ to be merged, like the standalone hadd program.
 #include "TMemFile.h"
 #include "TVirtualMutex.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 #ifdef WIN32
 // For _getmaxstdio
 #include <cstdio>
@@ -49,7 +61,9 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -451,6 +465,7 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
    // until the name changes. We flag the case here and we act consequently later.
    Bool_t alreadyseen = (oldkeyname == keyname) ? kTRUE : kFALSE;
    Bool_t ownobj = kFALSE;
+   Bool_t readFromKey = kFALSE;
 
    // Read in but do not copy directly the processIds.
    if (strcmp(keyclassname, "TProcessID") == 0 && key) {
@@ -515,6 +530,7 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       if (!obj && key) {
          obj = key->ReadObj();
          ownobj = kTRUE;
+         readFromKey = kTRUE;
       } else if (obj && info.fIsFirst && current_sourcedir != target
                  && !cl->InheritsFrom( TDirectory::Class() )) {
          R__ASSERT(cl->IsTObject());
@@ -532,6 +548,10 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       return kTRUE;
    }
    Bool_t canBeFound = (type & kIncremental) && (current_sourcedir->GetList()->FindObject(keyname) != nullptr);
+   // In streaming mode, do not keep the objects read from a key in memory until the final write of the output.
+   if (canBeFound && readFromKey && fStreamingMerge && !cl->InheritsFrom(R__TTree_Class) &&
+       !cl->InheritsFrom(TDirectory::Class()))
+      canBeFound = kFALSE;
 
    // if (cl->IsTObject())
    //    obj->ResetBit(kMustCleanup);
@@ -620,7 +640,7 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
 
       TList inputs;
       TList todelete;
-      Bool_t oneGo = fHistoOneGo && cl->InheritsFrom(R__TH1_Class);
+      Bool_t oneGo = fHistoOneGo && !fStreamingMerge && cl->InheritsFrom(R__TH1_Class);
 
       // Loop over all source files and merge same-name object
       TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
@@ -630,50 +650,92 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          func(obj, &inputs, &info);
          info.fIsFirst = kFALSE;
       } else {
-         do {
-            // make sure we are at the correct directory level by cd'ing to path
-            TDirectory *ndir = getDirectory(nextsource, target->GetName(), path);
-            if (ndir) {
+         // Reading the objects of the different sources is independent, so with implicit multi-threading a
+         // batch of sources (one per pool thread) is read concurrently. The merge itself stays sequential and
+         // in file order. Trees are not read in parallel: their merge only reads the headers.
+         std::size_t batchSize = 1;
+#ifdef R__USE_IMT
+         if (ROOT::IsImplicitMTEnabled() && !fStreamingMerge && !cl->InheritsFrom(R__TTree_Class))
+            batchSize = std::max(1u, ROOT::GetThreadPoolSize());
+#endif
+         std::vector<TFile *> batchFiles;
+         std::vector<TDirectory *> batchDirs;
+         std::vector<TKey *> batchKeys;
+         std::vector<TObject *> batchObjs;
+         while (nextsource) {
+            batchFiles.clear();
+            batchDirs.clear();
+            batchKeys.clear();
+            batchObjs.clear();
+            for (; nextsource && batchFiles.size() < batchSize; nextsource = (TFile*)sourcelist->After(nextsource)) {
+               // make sure we are at the correct directory level by cd'ing to path
+               TDirectory *ndir = getDirectory(nextsource, target->GetName(), path);
+               if (!ndir)
+                  continue;
                // For consistency (and persformance), we reset the MustCleanup be also for those
                // 'key' retrieved indirectly.
                // ndir->ResetBit(kMustCleanup);
-               ndir->cd();
                TObject *hobj = ndir->GetList()->FindObject(keyname);
-               if (!hobj) {
-                  TKey *key2 = (TKey*)ndir->GetListOfKeys()->FindObject(keyname);
-                  if (key2) {
-                     hobj = key2->ReadObj();
-                     if (!hobj) {
-                        Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
-                           keyname, keytitle, nextsource->GetName());
-                              nextsource = (TFile*)sourcelist->After(nextsource);
-                              return kTRUE;
+               TKey *key2 = hobj ? nullptr : (TKey*)ndir->GetListOfKeys()->FindObject(keyname);
+               if (!hobj && !key2)
+                  continue;
+               batchFiles.push_back(nextsource);
+               batchDirs.push_back(ndir);
+               batchKeys.push_back(key2);
+               batchObjs.push_back(hobj);
+            }
+
+            auto readOne = [&batchDirs, &batchKeys, &batchObjs](unsigned int i) {
+               if (batchKeys[i]) {
+                  TDirectory::TContext ctxt(batchDirs[i]);
+                  batchObjs[i] = batchKeys[i]->ReadObj();
+               }
+            };
+#ifdef R__USE_IMT
+            if (batchFiles.size() > 1) {
+               ROOT::TThreadExecutor pool;
+               pool.Foreach(readOne, ROOT::TSeqU(batchFiles.size()));
+            } else
+#endif
+            {
+               for (unsigned int i = 0; i < batchFiles.size(); ++i)
+                  readOne(i);
+            }
+
+            for (std::size_t i = 0; i < batchFiles.size(); ++i) {
+               batchDirs[i]->cd();
+               TObject *hobj = batchObjs[i];
+               if (batchKeys[i]) {
+                  if (!hobj) {
+                     Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
+                        keyname, keytitle, batchFiles[i]->GetName());
+                     for (std::size_t j = i + 1; j < batchFiles.size(); ++j) {
+                        if (batchKeys[j])
+                           delete batchObjs[j];
                      }
-                     todelete.Add(hobj);
+                     return kTRUE;
                   }
+                  todelete.Add(hobj);
                }
-               if (hobj) {
-                  // Set ownership for collections
-                  if (hobj->InheritsFrom(TCollection::Class())) {
-                     ((TCollection*)hobj)->SetOwner();
-                  }
-                  hobj->ResetBit(kMustCleanup);
-                  inputs.Add(hobj);
-                  if (!oneGo) {
-                     ROOT::MergeFunc_t func = cl->GetMerge();
-                     Long64_t result = func(obj, &inputs, &info);
-                     info.fIsFirst = kFALSE;
-                     if (result < 0) {
-                        Error("MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
-                              keyname, nextsource->GetName());
-                     }
-                     inputs.Clear();
-                     todelete.Delete();
+               // Set ownership for collections
+               if (hobj->InheritsFrom(TCollection::Class())) {
+                  ((TCollection*)hobj)->SetOwner();
+               }
+               hobj->ResetBit(kMustCleanup);
+               inputs.Add(hobj);
+               if (!oneGo) {
+                  ROOT::MergeFunc_t func = cl->GetMerge();
+                  Long64_t result = func(obj, &inputs, &info);
+                  info.fIsFirst = kFALSE;
+                  if (result < 0) {
+                     Error("MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
+                           keyname, batchFiles[i]->GetName());
                   }
+                  inputs.Clear();
+                  todelete.Delete();
                }
             }
-            nextsource = (TFile*)sourcelist->After( nextsource );
-         } while (nextsource);
+         }
          // Merge the list, if still to be done
          if (oneGo || info.fIsFirst) {
             ROOT::MergeFunc_t func = cl->GetMerge();
@@ -845,6 +907,9 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
    info.fOptions = fMergeOptions;
    if (fFastMethod && ((type&kKeepCompression) || !fCompressionChange) ) {
       info.fOptions.Append(" fast");
+   } else if (fFastMethod) {
+      // The compression changes: TTrees still copy their baskets without unstreaming them, but recompress them.
+      info.fOptions.Append(" recompress");
    }
 
    TFile      *current_file;
@@ -67,6 +67,12 @@
 
 #include "RZip.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <vector>
+
 const Int_t kTitleMax = 32000;
 
 #if !defined(_MSC_VER) || (_MSC_VER>1300)
@@ -79,6 +85,59 @@ const UChar_t kPidOffsetShift = 48;
 const static TString gTDirectoryString("TDirectory");
 std::atomic<UInt_t> keyAbsNumber{0};
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the `objlen` bytes at `objbuf` into `tgt` as a sequence of
+/// independently compressed blocks of at most kMAXZIPBUF input bytes, the
+/// layout expected by TKey::ReadObj. Return the total compressed size, or 0
+/// if the data cannot be compressed. `tgt` must have room for `objlen` bytes.
+///
+/// With implicit multi-threading, objects larger than one block have their
+/// blocks compressed concurrently: block i is compressed into the i-th
+/// kMAXZIPBUF-sized slot of `tgt`, then the slots are moved together. The
+/// output is identical to the serial one.
+
+Int_t ZipObjectBuffer(Int_t cxlevel, ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm, char *objbuf,
+                      Int_t objlen, char *tgt)
+{
+   const Int_t nbuffers = 1 + (objlen - 1) / kMAXZIPBUF;
+   auto zipBlock = [&](Int_t i, char *blocktgt) {
+      Int_t bufmax = (i == nbuffers - 1) ? objlen - i * kMAXZIPBUF : kMAXZIPBUF;
+      Int_t nout = 0;
+      R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf + i * kMAXZIPBUF, &bufmax, blocktgt, &nout, cxAlgorithm);
+      return nout;
+   };
+
+#ifdef R__USE_IMT
+   if (nbuffers > 1 && ROOT::IsImplicitMTEnabled()) {
+      std::vector<Int_t> nouts(nbuffers);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t i) { nouts[i] = zipBlock(i, tgt + i * kMAXZIPBUF); }, ROOT::TSeqI(nbuffers));
+      Int_t noutot = 0;
+      for (Int_t i = 0; i < nbuffers; ++i) {
+         if (nouts[i] == 0 || nouts[i] >= objlen)
+            return 0;
+         // Slot i starts at or after the end of the blocks already moved, so this never overwrites unmoved data.
+         memmove(tgt + noutot, tgt + i * kMAXZIPBUF, nouts[i]);
+         noutot += nouts[i];
+      }
+      return noutot;
+   }
+#endif
+
+   Int_t noutot = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      Int_t nout = zipBlock(i, tgt + noutot);
+      if (nout == 0 || nout >= objlen)
+         return 0;
+      noutot += nout;
+   }
+   return noutot;
+}
+
+} // anonymous namespace
+
 ClassImp(TKey);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -150,8 +209,7 @@ TKey::TKey(TDirectory* motherDir, const TKey &orig, UShort_t pidOffset) : TNamed
    TFile* f = orig.GetFile();
    if (f) {
       Int_t nsize = orig.fNbytes;
-      f->Seek(orig.fSeekKey);
-      if( f->ReadBuffer(fBuffer+bufferIncOffset,nsize) )
+      if( f->ReadBuffer(fBuffer+bufferIncOffset,orig.fSeekKey,nsize) )
       {
          Error("ReadFile", "Failed to read data.");
          return;
@@ -235,7 +293,7 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
 
    Build(motherDir, obj->ClassName(), -1);
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf, noutot;
    fBufferRef = new TBufferFile(TBuffer::kWrite, bufsize);
    fBufferRef->SetParent(GetFile());
    fCycle     = fMotherDir->AppendKey(this);
@@ -253,27 +311,14 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
       Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
       Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
       fBuffer = new char[buflen];
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            delete[] fBuffer;
-            bufcur = nullptr;
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+      noutot = ZipObjectBuffer(cxlevel, cxAlgorithm, fBufferRef->Buffer() + fKeylen, fObjlen, &fBuffer[fKeylen]);
+      if (noutot == 0) { //this happens when the buffer cannot be compressed
+         delete[] fBuffer;
+         fBuffer = fBufferRef->Buffer();
+         Create(fObjlen);
+         fBufferRef->SetBufferOffset(0);
+         Streamer(*fBufferRef);         //write key itself again
+         return;
       }
       Create(noutot);
       fBufferRef->SetBufferOffset(0);
@@ -333,7 +378,7 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
    Streamer(*fBufferRef);         //write key itself
    fKeylen    = fBufferRef->Length();
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf, noutot;
 
    fBufferRef->MapObject(actualStart,clActual);         //register obj in map in case of self reference
    clActual->Streamer((void*)actualStart, *fBufferRef); //write object
@@ -346,27 +391,14 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
       Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
       Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
       fBuffer = new char[buflen];
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            delete[] fBuffer;
-            bufcur = nullptr;
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+      noutot = ZipObjectBuffer(cxlevel, cxAlgorithm, fBufferRef->Buffer() + fKeylen, fObjlen, &fBuffer[fKeylen]);
+      if (noutot == 0) { //this happens when the buffer cannot be compressed
+         delete[] fBuffer;
+         fBuffer = fBufferRef->Buffer();
+         Create(fObjlen);
+         fBufferRef->SetBufferOffset(0);
+         Streamer(*fBufferRef);         //write key itself again
+         return;
       }
       Create(noutot);
       fBufferRef->SetBufferOffset(0);
@@ -525,7 +557,10 @@ void TKey::Create(Int_t nbytes, TFile* externFile)
 
 TKey::~TKey()
 {
-   if (fMotherDir && fMotherDir->GetListOfKeys())
+   // TDirectoryFile::GetListOfKeys would create all the keys a directory has not read yet.
+   if (auto dirFile = dynamic_cast<TDirectoryFile *>(fMotherDir))
+      dirFile->RemoveKey(this);
+   else if (fMotherDir && fMotherDir->GetListOfKeys())
       fMotherDir->GetListOfKeys()->Remove(this);
    TKey::DeleteBuffer();
 }
@@ -768,18 +803,26 @@ TObject *TKey::ReadObj()
       return (TObject*)ReadObjectAny(0);
    }
 
-   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
+   if (GetFile()==0) return 0;
+   // A memory-mapped file is read in place: an uncompressed object is streamed
+   // straight from the mapping and a compressed one is decompressed from it.
+   const char *mapped = GetFile()->GetMappedBuffer(fSeekKey, fNbytes);
+   const Bool_t compressed = fObjlen > fNbytes-fKeylen;
+   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen, mapped && !compressed ? const_cast<char *>(mapped) : nullptr,
+                         kFALSE);
    if (!bufferRef.Buffer()) {
       Error("ReadObj", "Cannot allocate buffer: fObjlen = %d", fObjlen);
       return 0;
    }
-   if (GetFile()==0) return 0;
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
    std::unique_ptr<char []> compressedBuffer;
    auto storeBuffer = fBuffer;
-   if (fObjlen > fNbytes-fKeylen) {
+   if (mapped) {
+      if (compressed)
+         memcpy(bufferRef.Buffer(), mapped, fKeylen);
+   } else if (compressed) {
       compressedBuffer.reset(new char[fNbytes]);
       fBuffer = compressedBuffer.get();
       if( !ReadFile() )                    //Read object structure from file
@@ -825,7 +868,7 @@ TObject *TKey::ReadObj()
 
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
+      UChar_t *bufcur = (UChar_t *)(mapped ? mapped : compressedBuffer.get()) + fKeylen;
       Int_t nin, nout = 0, nbuf;
       Int_t noutot = 0;
       while (1) {
@@ -1023,18 +1066,25 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
 
 void *TKey::ReadObjectAny(const TClass* expectedClass)
 {
-   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
+   if (GetFile()==0) return 0;
+   // See ReadObj() for reading from a memory-mapped file
+   const char *mapped = GetFile()->GetMappedBuffer(fSeekKey, fNbytes);
+   const Bool_t compressed = fObjlen > fNbytes-fKeylen;
+   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen, mapped && !compressed ? const_cast<char *>(mapped) : nullptr,
+                         kFALSE);
    if (!bufferRef.Buffer()) {
       Error("ReadObj", "Cannot allocate buffer: fObjlen = %d", fObjlen);
       return 0;
    }
-   if (GetFile()==0) return 0;
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
    std::unique_ptr<char []> compressedBuffer;
    auto storeBuffer = fBuffer;
-   if (fObjlen > fNbytes-fKeylen) {
+   if (mapped) {
+      if (compressed)
+         memcpy(bufferRef.Buffer(), mapped, fKeylen);
+   } else if (compressed) {
       compressedBuffer.reset(new char[fNbytes]);
       fBuffer = compressedBuffer.get();
       ReadFile();                    //Read object structure from file
@@ -1094,7 +1144,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
 
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
+      UChar_t *bufcur = (UChar_t *)(mapped ? mapped : compressedBuffer.get()) + fKeylen;
       Int_t nin, nout = 0, nbuf;
       Int_t noutot = 0;
       while (1) {
@@ -1159,7 +1209,11 @@ Int_t TKey::Read(TObject *obj)
 {
    if (!obj || (GetFile()==0)) return 0;
 
-   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
+   // See ReadObj() for reading from a memory-mapped file
+   const char *mapped = GetFile()->GetMappedBuffer(fSeekKey, fNbytes);
+   const Bool_t compressed = fObjlen > fNbytes-fKeylen;
+   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen, mapped && !compressed ? const_cast<char *>(mapped) : nullptr,
+                         kFALSE);
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
@@ -1168,7 +1222,10 @@ Int_t TKey::Read(TObject *obj)
 
    std::unique_ptr<char []> compressedBuffer;
    auto storeBuffer = fBuffer;
-   if (fObjlen > fNbytes-fKeylen) {
+   if (mapped) {
+      if (compressed)
+         memcpy(bufferRef.Buffer(), mapped, fKeylen);
+   } else if (compressed) {
       compressedBuffer.reset(new char[fNbytes]);
       fBuffer = compressedBuffer.get();
       ReadFile();                    //Read object structure from file
@@ -1182,7 +1239,7 @@ Int_t TKey::Read(TObject *obj)
    bufferRef.SetBufferOffset(fKeylen);
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
+      UChar_t *bufcur = (UChar_t *)(mapped ? mapped : compressedBuffer.get()) + fKeylen;
       Int_t nin, nout = 0, nbuf;
       Int_t noutot = 0;
       while (1) {
@@ -1277,8 +1334,8 @@ Bool_t TKey::ReadFile()
    if (f==0) return kFALSE;
 
    Int_t nsize = fNbytes;
-   f->Seek(fSeekKey);
-   if( f->ReadBuffer(fBuffer,nsize) )
+   // Read at the key position rather than after a Seek, so that concurrent reads of the same file do not interfere.
+   if( f->ReadBuffer(fBuffer,fSeekKey,nsize) )
    {
       Error("ReadFile", "Failed to read data.");
       return kFALSE;
@@ -169,6 +169,8 @@ TStreamerInfo::TStreamerInfo()
    fWriteMemberWise = 0;
    fWriteMemberWiseVecPtr = 0;
    fWriteText = 0;
+   fHasWriteActions = kFALSE;
+   fHasTextActions = kFALSE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -203,6 +205,8 @@ TStreamerInfo::TStreamerInfo(TClass *cl)
    fWriteMemberWise = 0;
    fWriteMemberWiseVecPtr = 0;
    fWriteText = 0;
+   fHasWriteActions = kFALSE;
+   fHasTextActions = kFALSE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2646,6 +2650,8 @@ void TStreamerInfo::Clear(Option_t *option)
       if (fWriteMemberWise) fWriteMemberWise->fActions.clear();
       if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->fActions.clear();
       if (fWriteText) fWriteText->fActions.clear();
+      fHasWriteActions = kFALSE;
+      fHasTextActions = kFALSE;
    }
 }
 
@@ -25,6 +25,8 @@
 #include "TProcessID.h"
 #include "TFile.h"
 
+#include <typeinfo>
+
 static const Int_t kRegrouped = TStreamerInfo::kOffsetL;
 
 // More possible optimizations:
@@ -54,6 +56,43 @@ namespace TStreamerInfoActions
       return isEmulated || (isVector && hasDefaultAlloc);
    }
 
+   /// Decode the on-file values of a data member of all the elements of a
+   /// contiguous collection, `incr` bytes apart, in one pass over the buffer.
+   ///
+   /// TBufferFile::ReadInt() and its siblings are a frombuf() at the current
+   /// position, so for a plain TBufferFile the loop is done here instead of
+   /// paying a virtual call per element. Returns false, without reading
+   /// anything, for other buffers or if the buffer is too short.
+   template <typename From, typename To>
+   struct StridedReader {
+      static bool Read(TBuffer &buf, char *iter, const char *end, Int_t incr)
+      {
+         if (typeid(buf) != typeid(TBufferFile))
+            return false;
+         char *cur = buf.GetCurrent();
+         const std::size_t n = (end - iter) / incr;
+         if (n * sizeof(From) > std::size_t(buf.Buffer() + buf.BufferSize() - cur))
+            return false;
+         for (; iter != end; iter += incr) {
+            From temp;
+            frombuf(cur, &temp);
+            *(To *)iter = (To)temp;
+         }
+         buf.SetBufferOffset(cur - buf.Buffer());
+         return true;
+      }
+   };
+
+   // The on-file size of Long_t depends on the version of the file, see TBufferFile::ReadLong().
+   template <typename To>
+   struct StridedReader<Long_t, To> {
+      static bool Read(TBuffer &, char *, const char *, Int_t) { return false; }
+   };
+   template <typename To>
+   struct StridedReader<ULong_t, To> {
+      static bool Read(TBuffer &, char *, const char *, Int_t) { return false; }
+   };
+
    template <typename From>
    struct WithFactorMarker {
       typedef From Value_t;
@@ -1724,6 +1763,8 @@ namespace TStreamerInfoActions
          const Int_t incr = ((TVectorLoopConfig*)loopconfig)->fIncrement;
          iter = (char*)iter + config->fOffset;
          end = (char*)end + config->fOffset;
+         if (StridedReader<T, T>::Read(buf, (char *)iter, (const char *)end, incr))
+            return 0;
          for(; iter != end; iter = (char*)iter + incr ) {
             T *x = (T*) ((char*) iter);
             buf >> *x;
@@ -1740,6 +1781,8 @@ namespace TStreamerInfoActions
             const Int_t incr = ((TVectorLoopConfig*)loopconfig)->fIncrement;
             iter = (char*)iter + config->fOffset;
             end = (char*)end + config->fOffset;
+            if (StridedReader<From, To>::Read(buf, (char *)iter, (const char *)end, incr))
+               return 0;
             for(; iter != end; iter = (char*)iter + incr ) {
                buf >> temp;
                *(To*)( ((char*)iter) ) = (To)temp;
@@ -3002,6 +3045,9 @@ void TStreamerInfo::Compile()
 
    Int_t ndata = fElements->GetEntriesFast();
 
+   // The write and text sequences are only filled when first requested.
+   fHasWriteActions = kFALSE;
+   fHasTextActions = kFALSE;
 
    if (fReadObjectWise) fReadObjectWise->fActions.clear();
    else fReadObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
@@ -3186,19 +3232,13 @@ void TStreamerInfo::Compile()
          continue;
       }
       AddReadAction(fReadObjectWise, i, fCompOpt[i]);
-      AddWriteAction(fWriteObjectWise, i, fCompOpt[i]);
    }
    for (i = 0; i < fNfulldata; ++i) {
       if (!fCompFull[i]->fElem || fCompFull[i]->fElem->GetType()< 0) {
          continue;
       }
       AddReadAction(fReadMemberWise, i, fCompFull[i]);
-      AddWriteAction(fWriteMemberWise, i, fCompFull[i]);
       AddReadMemberWiseVecPtrAction(fReadMemberWiseVecPtr, i, fCompFull[i]);
-      AddWriteMemberWiseVecPtrAction(fWriteMemberWiseVecPtr, i, fCompFull[i]);
-
-      AddReadTextAction(fReadText, i, fCompFull[i]);
-      AddWriteTextAction(fWriteText, i, fCompFull[i]);
    }
    ComputeSize();
 
@@ -3210,6 +3250,85 @@ void TStreamerInfo::Compile()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the write action sequences of a compiled StreamerInfo.
+///
+/// A job reading thousands of classes from a file writes few or none of them,
+/// so Compile() leaves the write sequences empty and the first call to one
+/// of the GetWrite...Actions() getters fills them.
+
+void TStreamerInfo::BuildWriteActions()
+{
+   R__LOCKGUARD(gInterpreterMutex);
+
+   if (fHasWriteActions || !IsCompiled())
+      return;
+
+   for (Int_t i = 0; i < fNdata; ++i) {
+      if (!fCompOpt[i]->fElem || fCompOpt[i]->fElem->GetType()< 0) {
+         continue;
+      }
+      AddWriteAction(fWriteObjectWise, i, fCompOpt[i]);
+   }
+   for (Int_t i = 0; i < fNfulldata; ++i) {
+      if (!fCompFull[i]->fElem || fCompFull[i]->fElem->GetType()< 0) {
+         continue;
+      }
+      AddWriteAction(fWriteMemberWise, i, fCompFull[i]);
+      AddWriteMemberWiseVecPtrAction(fWriteMemberWiseVecPtr, i, fCompFull[i]);
+   }
+   fHasWriteActions = kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the text action sequences of a compiled StreamerInfo, used only by
+/// TBufferText (JSON and XML); see BuildWriteActions().
+
+void TStreamerInfo::BuildTextActions()
+{
+   R__LOCKGUARD(gInterpreterMutex);
+
+   if (fHasTextActions || !IsCompiled())
+      return;
+
+   for (Int_t i = 0; i < fNfulldata; ++i) {
+      if (!fCompFull[i]->fElem || fCompFull[i]->fElem->GetType()< 0) {
+         continue;
+      }
+      AddReadTextAction(fReadText, i, fCompFull[i]);
+      AddWriteTextAction(fWriteText, i, fCompFull[i]);
+   }
+   fHasTextActions = kTRUE;
+}
+
+TStreamerInfoActions::TActionSequence *TStreamerInfo::GetReadTextActions()
+{
+   if (!fHasTextActions)
+      BuildTextActions();
+   return fReadText;
+}
+
+TStreamerInfoActions::TActionSequence *TStreamerInfo::GetWriteMemberWiseActions(Bool_t forCollection)
+{
+   if (!fHasWriteActions)
+      BuildWriteActions();
+   return forCollection ? fWriteMemberWiseVecPtr : fWriteMemberWise;
+}
+
+TStreamerInfoActions::TActionSequence *TStreamerInfo::GetWriteObjectWiseActions()
+{
+   if (!fHasWriteActions)
+      BuildWriteActions();
+   return fWriteObjectWise;
+}
+
+TStreamerInfoActions::TActionSequence *TStreamerInfo::GetWriteTextActions()
+{
+   if (!fHasTextActions)
+      BuildTextActions();
+   return fWriteText;
+}
+
 template <typename From>
 static void AddReadConvertAction(TStreamerInfoActions::TActionSequence *sequence, Int_t newtype, TConfiguration *conf)
 {
@@ -1,6 +1,9 @@
 #include "io_test.hxx"
 
 #include "TFile.h"
+#include "TSystem.h"
+
+#include "ROOT/RBlockCache.hxx"
 
 #include "ROOT/RRawFileTFile.hxx"
 using ROOT::Internal::RRawFileTFile;
@@ -272,3 +275,74 @@ TEST(RRawFileTFile, TFile)
    EXPECT_EQ(seek[2], 0);
    EXPECT_EQ(seek[3], 100);
 }
+
+TEST(RBlockCache, ReadThrough)
+{
+   std::string dir = std::string(gSystem->TempDirectory()) + "/test_rblockcache_" + std::to_string(gSystem->GetPid());
+   std::string content;
+   for (int i = 0; i < 100; ++i)
+      content.push_back('a' + i % 26);
+
+   unsigned nRemoteBlocks = 0;
+   auto readBlocks = [&](RRawFile::RIOVec *blocks, unsigned int nBlocks) {
+      for (unsigned int i = 0; i < nBlocks; ++i) {
+         auto slice = content.substr(blocks[i].fOffset, blocks[i].fSize);
+         memcpy(blocks[i].fBuffer, slice.data(), slice.size());
+         blocks[i].fOutBytes = slice.size();
+      }
+      nRemoteBlocks += nBlocks;
+   };
+
+   {
+      ROOT::Internal::RBlockCache cache(dir, 1024, 16);
+      char buffer[3][20];
+      RRawFile::RIOVec iovec[3];
+      iovec[0].fBuffer = buffer[0];
+      iovec[0].fOffset = 10;
+      iovec[0].fSize = 20;
+      iovec[1].fBuffer = buffer[1];
+      iovec[1].fOffset = 40;
+      iovec[1].fSize = 5;
+      iovec[2].fBuffer = buffer[2];
+      iovec[2].fOffset = 95;
+      iovec[2].fSize = 20;
+
+      cache.ReadV("mock://file", content.size(), iovec, 3, readBlocks);
+      // Blocks 0, 1, 2, 5 and 6, the last one being short
+      EXPECT_EQ(5u, nRemoteBlocks);
+      EXPECT_EQ(5u, cache.GetNMisses());
+      EXPECT_EQ(20u, iovec[0].fOutBytes);
+      EXPECT_EQ(5u, iovec[1].fOutBytes);
+      EXPECT_EQ(5u, iovec[2].fOutBytes);
+      EXPECT_EQ(content.substr(10, 20), std::string(buffer[0], 20));
+      EXPECT_EQ(content.substr(40, 5), std::string(buffer[1], 5));
+      EXPECT_EQ(content.substr(95, 5), std::string(buffer[2], 5));
+      EXPECT_EQ(4u * 16 + 4, cache.GetUsedSize());
+
+      // A second pass, e.g. by another process sharing the directory, is served from disk
+      ROOT::Internal::RBlockCache other(dir, 1024, 16);
+      memset(buffer, 0, sizeof(buffer));
+      other.ReadV("mock://file", content.size(), iovec, 3, readBlocks);
+      EXPECT_EQ(5u, nRemoteBlocks);
+      EXPECT_EQ(5u, other.GetNHits());
+      EXPECT_EQ(content.substr(10, 20), std::string(buffer[0], 20));
+      EXPECT_EQ(content.substr(95, 5), std::string(buffer[2], 5));
+
+      // A different file identity does not hit the cached blocks
+      other.ReadV("mock://other", content.size(), iovec, 1, readBlocks);
+      EXPECT_EQ(7u, nRemoteBlocks);
+
+      cache.Evict(16);
+      EXPECT_GE(16u, cache.GetUsedSize());
+      cache.Evict(0);
+      EXPECT_EQ(0u, cache.GetUsedSize());
+   }
+
+   void *dirp = gSystem->OpenDirectory(dir.c_str());
+   while (const char *name = gSystem->GetDirEntry(dirp)) {
+      if (name[0] != '.')
+         gSystem->Unlink((dir + "/" + name).c_str());
+   }
+   gSystem->FreeDirectory(dirp);
+   gSystem->Unlink(dir.c_str());
+}
@@ -1,7 +1,9 @@
 #include "gtest/gtest.h"
 
+#include "Bytes.h"
 #include "TBufferFile.h"
 #include "TClass.h"
+#include <cstring>
 #include <vector>
 #include <iostream>
 
@@ -26,3 +28,64 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+template <typename T>
+void CheckFastArrays()
+{
+   // cover the vectorized part and the tail of the byte swapping kernels, at any alignment
+   for (Int_t n = 0; n < 80; ++n) {
+      for (Int_t offset = 0; offset < 3; ++offset) {
+         std::vector<T> values(n);
+         for (Int_t i = 0; i < n; ++i)
+            values[i] = T(i * 1000 + 7);
+
+         TBufferFile buf(TBuffer::kWrite);
+         for (Int_t i = 0; i < offset; ++i)
+            buf << Char_t(0);
+         buf.WriteFastArray(values.data(), n);
+         ASSERT_EQ(buf.Length(), Int_t(offset + n * sizeof(T)));
+
+         // the array must be in network byte order, as written by tobuf
+         std::vector<char> expected(n * sizeof(T));
+         char *cur = expected.data();
+         for (Int_t i = 0; i < n; ++i)
+            tobuf(cur, values[i]);
+         EXPECT_EQ(0, memcmp(buf.Buffer() + offset, expected.data(), expected.size())) << "n = " << n;
+
+         std::vector<T> result(n);
+         buf.SetReadMode();
+         buf.SetBufferOffset(offset);
+         buf.ReadFastArray(result.data(), n);
+         EXPECT_EQ(result, values) << "n = " << n;
+      }
+   }
+}
+
+TEST(TBufferFile, FastArrays)
+{
+   CheckFastArrays<Short_t>();
+   CheckFastArrays<Int_t>();
+   CheckFastArrays<Float_t>();
+   CheckFastArrays<Long64_t>();
+   CheckFastArrays<Double_t>();
+}
+
+TEST(TBufferFile, FastArraysDouble32)
+{
+   const Int_t n = 1000;
+   std::vector<Double_t> values(n);
+   for (Int_t i = 0; i < n; ++i)
+      values[i] = 0.1 * i;
+
+   // without a streamer element, Double32_t is stored as float
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteFastArrayDouble32(values.data(), n, nullptr);
+   ASSERT_EQ(buf.Length(), Int_t(n * sizeof(Float_t)));
+
+   std::vector<Double_t> result(n);
+   buf.SetReadMode();
+   buf.SetBufferOffset(0);
+   buf.ReadFastArrayDouble32(result.data(), n, nullptr);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_EQ(result[i], Double_t(Float_t(values[i])));
+}
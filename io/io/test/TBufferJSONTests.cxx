@@ -1,6 +1,8 @@
 #include "TBufferJSON.h"
+#include "TList.h"
 #include "TNamed.h"
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -47,3 +49,39 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// check that JSON passed in chunks to a sink is the same as the complete string
+TEST(TBufferJSON, OutputSink)
+{
+   TList list;
+   list.SetOwner(kTRUE);
+   for (int n = 0; n < 100; ++n)
+      list.Add(new TNamed(("name" + std::to_string(n)).c_str(), "title"));
+
+   for (int compact : {TBufferJSON::kNoCompress, TBufferJSON::kNoSpaces}) {
+      auto json = TBufferJSON::ConvertToJSON(&list, compact);
+
+      std::string streamed;
+      int nchunks = 0;
+      TBufferJSON buf;
+      buf.SetCompact(compact);
+      buf.SetOutputSink(
+         [&](const char *data, std::size_t len) {
+            streamed.append(data, len);
+            nchunks++;
+         },
+         256);
+      EXPECT_EQ(buf.StoreObject(&list, TList::Class()).Length(), 0);
+
+      EXPECT_EQ(streamed, json.Data());
+      EXPECT_GT(nchunks, 1);
+   }
+
+   // STL containers are stored as single value
+   std::vector<int> vect = {1, 4, 7};
+   std::string streamed;
+   auto len = TBufferJSON::ExportToSink([&](const char *data, std::size_t len) { streamed.append(data, len); }, &vect,
+                                        TClass::GetClass<std::vector<int>>());
+   EXPECT_EQ(streamed, TBufferJSON::ToJSON(&vect).Data());
+   EXPECT_EQ(len, (Long64_t)streamed.length());
+}
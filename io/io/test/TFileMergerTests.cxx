@@ -5,6 +5,12 @@
 #include "TMemFile.h"
 #include "TTree.h"
 #include "TH1.h"
+#include "TROOT.h"
+#include "TSystem.h"
+
+#include <memory>
+#include <string>
+#include <vector>
 
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
@@ -101,3 +107,72 @@ TEST(TFileMerger, MergeSingleOnlyListed)
    ASSERT_TRUE(output.get() && output->GetListOfKeys());
    EXPECT_EQ(output->GetListOfKeys()->GetSize(), 2);
 }
+
+#ifdef R__USE_IMT
+TEST(TFileMerger, MergeHistogramsWithImplicitMT)
+{
+   ROOT::EnableImplicitMT(4);
+
+   std::vector<std::unique_ptr<TMemFile>> inputs;
+   for (int i = 0; i < 9; ++i) {
+      inputs.emplace_back(new TMemFile(("histmt" + std::to_string(i) + ".root").c_str(), "CREATE"));
+      auto hist = new TH1F("hist", "hist", 1, 0, 2);
+      hist->SetDirectory(inputs.back().get());
+      for (int j = 0; j <= i; ++j)
+         hist->Fill(1);
+      inputs.back()->Write();
+   }
+
+   TFileMerger merger;
+   ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("histmt.root", "CREATE"))));
+   for (auto &input : inputs)
+      merger.AddFile(input.get(), false);
+   ASSERT_TRUE(merger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental));
+
+   ROOT::DisableImplicitMT();
+
+   auto hist = merger.GetOutputFile()->Get<TH1>("hist");
+   ASSERT_TRUE(hist != nullptr);
+   EXPECT_EQ(hist->GetEntries(), 45);
+   EXPECT_EQ(hist->GetBinContent(1), 45);
+}
+#endif
+
+TEST(TFileMerger, StreamingMerge)
+{
+   std::vector<std::string> inputNames;
+   for (int i = 0; i < 5; ++i) {
+      inputNames.emplace_back("streamingmerge" + std::to_string(i) + ".root");
+      TFile input(inputNames.back().c_str(), "RECREATE");
+      for (const char *name : {"hist1", "hist2"}) {
+         auto hist = new TH1F(name, name, 1, 0, 2);
+         hist->SetDirectory(&input);
+         for (int j = 0; j <= i; ++j)
+            hist->Fill(1);
+      }
+      input.Write();
+   }
+
+   {
+      TFileMerger merger(kFALSE, kTRUE);
+      merger.SetStreamingMerge();
+      // Merge the inputs in several incremental batches.
+      merger.SetMaxOpenedFiles(3);
+      ASSERT_TRUE(merger.OutputFile("streamingmerge.root", "RECREATE"));
+      for (const auto &name : inputNames)
+         ASSERT_TRUE(merger.AddFile(name.c_str(), kFALSE));
+      ASSERT_TRUE(merger.Merge());
+   }
+
+   TFile output("streamingmerge.root");
+   EXPECT_EQ(output.GetListOfKeys()->GetSize(), 2);
+   for (const char *name : {"hist1", "hist2"}) {
+      auto hist = output.Get<TH1>(name);
+      ASSERT_TRUE(hist != nullptr);
+      EXPECT_EQ(hist->GetBinContent(1), 15);
+   }
+
+   for (const auto &name : inputNames)
+      gSystem->Unlink(name.c_str());
+   gSystem->Unlink("streamingmerge.root");
+}
@@ -1,10 +1,15 @@
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "ROOT/TestSupport.hxx"
+
 #include "TFile.h"
 #include "TKey.h"
+#include "TMemFile.h"
+#include "TEnv.h"
 #include "TNamed.h"
 #include "TPluginManager.h"
 #include "TROOT.h" // gROOT
@@ -68,6 +73,247 @@ TEST(TFile, WriteObjectVector)
     gSystem->Unlink(filename);
 }
 
+#ifdef R__USE_IMT
+// Objects larger than kMAXZIPBUF are compressed in several blocks, concurrently with IMT.
+TEST(TFile, WriteLargeObjectMT)
+{
+   std::vector<int> large(10'000'000);
+   for (std::size_t i = 0; i < large.size(); ++i)
+      large[i] = i % 1000;
+
+   auto writeAndGetNbytes = [&](const char *name) {
+      TMemFile f(name, "RECREATE", "", 101);
+      f.WriteObject(&large, "large");
+      auto key = f.GetKey("large");
+      EXPECT_NE(key, nullptr);
+      const auto nbytes = key ? key->GetNbytes() : 0;
+      EXPECT_LT(nbytes, large.size() * sizeof(int));
+
+      auto read = f.Get<std::vector<int>>("large");
+      EXPECT_NE(read, nullptr);
+      if (read) {
+         EXPECT_EQ(*read, large);
+      }
+      delete read;
+      return nbytes;
+   };
+
+   const auto nbytesSerial = writeAndGetNbytes("tfile_writelargeobject_st.root");
+   ROOT::EnableImplicitMT(4);
+   const auto nbytesParallel = writeAndGetNbytes("tfile_writelargeobject_mt.root");
+   ROOT::DisableImplicitMT();
+   // The chunked on-disk format does not depend on how the chunks were compressed.
+   EXPECT_EQ(nbytesSerial, nbytesParallel);
+}
+#endif
+
+// Large directories of read-only files index their keys and create them on demand.
+TEST(TFile, LazyKeys)
+{
+   auto filename{"tfile_lazykeys.root"};
+   {
+      TFile f{filename, "RECREATE"};
+      for (int i = 0; i < 1500; ++i) {
+         TNamed obj(("obj_" + std::to_string(i)).c_str(), "title");
+         f.WriteTObject(&obj);
+      }
+      TNamed second("obj_7", "second cycle");
+      f.WriteTObject(&second);
+   }
+
+   auto readKeyNames = [&](TFile &f) {
+      std::vector<std::string> names;
+      for (auto key : *f.GetListOfKeys())
+         names.push_back(std::string(key->GetName()) + ";" + std::to_string(static_cast<TKey *>(key)->GetCycle()));
+      return names;
+   };
+
+   const auto lazyMinKeys = gEnv->GetValue("TFile.LazyKeysMinNumber", 1000);
+   gEnv->SetValue("TFile.LazyKeysMinNumber", 0);
+   std::vector<std::string> expectedNames;
+   {
+      TFile f{filename};
+      expectedNames = readKeyNames(f);
+   }
+   gEnv->SetValue("TFile.LazyKeysMinNumber", 1000);
+   {
+      TFile f{filename};
+      // Closed without having created any key
+      EXPECT_EQ(f.GetNkeys(), 1501);
+   }
+   {
+      TFile f{filename};
+      EXPECT_EQ(f.GetNkeys(), 1501);
+      std::unique_ptr<TNamed> obj{f.Get<TNamed>("obj_777")};
+      ASSERT_NE(obj, nullptr);
+      EXPECT_STREQ(obj->GetName(), "obj_777");
+      std::unique_ptr<TNamed> latest{f.Get<TNamed>("obj_7")};
+      ASSERT_NE(latest, nullptr);
+      EXPECT_STREQ(latest->GetTitle(), "second cycle");
+      std::unique_ptr<TNamed> first{f.Get<TNamed>("obj_7;1")};
+      ASSERT_NE(first, nullptr);
+      EXPECT_STREQ(first->GetTitle(), "title");
+      EXPECT_EQ(f.GetKey("missing"), nullptr);
+      // The complete list has the same keys in the same order as when read at once
+      EXPECT_EQ(readKeyNames(f), expectedNames);
+   }
+   gEnv->SetValue("TFile.LazyKeysMinNumber", lazyMinKeys);
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, OpenPlan)
+{
+   auto filename{"tfile_openplan.root"};
+   {
+      TFile f{filename, "RECREATE"};
+      for (int i = 0; i < 10; ++i) {
+         TNamed obj(("obj_" + std::to_string(i)).c_str(), "title");
+         f.WriteTObject(&obj);
+      }
+   }
+
+   auto openAndGet = [&](int mode) {
+      gEnv->SetValue("TFile.OpenPlan", mode);
+      TFile f{filename};
+      EXPECT_FALSE(f.IsZombie());
+      std::unique_ptr<TNamed> obj{f.Get<TNamed>("obj_3")};
+      EXPECT_NE(obj, nullptr);
+      if (obj) {
+         EXPECT_STREQ(obj->GetName(), "obj_3");
+      }
+      return f.GetReadCalls();
+   };
+
+   const auto planMode = gEnv->GetValue("TFile.OpenPlan", 1);
+   const auto nCallsWithoutPlan = openAndGet(0);
+   // The header, then the keys list, the StreamerInfo and the object in one go
+   const auto nCallsWithPlan = openAndGet(2);
+   EXPECT_LT(nCallsWithPlan, nCallsWithoutPlan);
+   EXPECT_EQ(nCallsWithPlan, 2);
+   gEnv->SetValue("TFile.OpenPlan", planMode);
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, MemoryMap)
+{
+   auto filename{"tfile_memorymap.root"};
+   const std::vector<double> values(10000, 42.);
+   for (int compression : {0, 101}) {
+      {
+         TFile f{filename, "RECREATE", "", compression};
+         TNamed obj("obj", "title");
+         f.WriteTObject(&obj);
+         f.WriteObject(&values, "values");
+      }
+
+      const auto memoryMap = gEnv->GetValue("TFile.MemoryMap", 0);
+      gEnv->SetValue("TFile.MemoryMap", 1);
+      {
+         TFile f{filename};
+#ifndef WIN32
+         EXPECT_TRUE(f.IsMemoryMapped());
+#endif
+         std::unique_ptr<TNamed> obj{f.Get<TNamed>("obj")};
+         ASSERT_NE(obj, nullptr);
+         EXPECT_STREQ(obj->GetTitle(), "title");
+         std::unique_ptr<std::vector<double>> readValues{f.Get<std::vector<double>>("values")};
+         ASSERT_NE(readValues, nullptr);
+         EXPECT_EQ(*readValues, values);
+         EXPECT_GT(f.GetBytesRead(), 0);
+         f.Close();
+         EXPECT_FALSE(f.IsMemoryMapped());
+      }
+      {
+         // Files opened for writing are never mapped
+         TFile f{filename, "UPDATE"};
+         EXPECT_FALSE(f.IsMemoryMapped());
+      }
+      gEnv->SetValue("TFile.MemoryMap", memoryMap);
+   }
+   gSystem->Unlink(filename);
+}
+
+#ifdef R__USE_IMT
+TEST(TFile, ConcurrentRead)
+{
+   auto filename{"tfile_concurrentread.root"};
+   constexpr int kNObjects = 64;
+   {
+      TFile f{filename, "RECREATE"};
+      for (int i = 0; i < kNObjects; ++i) {
+         TNamed obj(("obj_" + std::to_string(i)).c_str(), ("title_" + std::to_string(i)).c_str());
+         f.WriteTObject(&obj);
+      }
+   }
+
+   ROOT::EnableThreadSafety();
+   TFile f{filename};
+   f.SetConcurrentRead();
+   ASSERT_TRUE(f.IsConcurrentRead());
+   std::vector<TKey *> keys;
+   for (auto key : TRangeDynCast<TKey>(f.GetListOfKeys()))
+      keys.push_back(key);
+   ASSERT_EQ(keys.size(), kNObjects);
+
+   const auto nCallsBefore = f.GetReadCalls();
+   constexpr int kNThreads = 4;
+   std::vector<int> nErrors(kNThreads, 0);
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         // A TKey holds the buffer it reads into, each thread reads its own keys.
+         for (int i = t; i < kNObjects; i += kNThreads) {
+            std::unique_ptr<TNamed> obj{static_cast<TNamed *>(keys[i]->ReadObj())};
+            if (!obj || ("title_" + std::to_string(i)) != obj->GetTitle())
+               ++nErrors[t];
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   for (int t = 0; t < kNThreads; ++t)
+      EXPECT_EQ(nErrors[t], 0);
+   EXPECT_EQ(f.GetReadCalls() - nCallsBefore, kNObjects);
+
+   {
+      // Files opened for writing cannot be read concurrently
+      TFile update{filename, "UPDATE"};
+      ROOT_EXPECT_ERROR(update.SetConcurrentRead(), "TFile::SetConcurrentRead",
+                        "only local files opened read-only can be read concurrently, not tfile_concurrentread.root");
+      EXPECT_FALSE(update.IsConcurrentRead());
+   }
+   gSystem->Unlink(filename);
+}
+#endif
+
+TEST(TFile, OpenMany)
+{
+   constexpr int kNFiles = 5;
+   std::vector<std::string> names;
+   for (int i = 0; i < kNFiles; ++i) {
+      names.emplace_back("tfile_openmany_" + std::to_string(i) + ".root");
+      TFile f{names.back().c_str(), "RECREATE"};
+      TNamed obj("obj", names.back().c_str());
+      f.WriteTObject(&obj);
+   }
+
+   auto futures = TFile::OpenMany(names, "READ", 2);
+   ASSERT_EQ(futures.size(), kNFiles);
+   for (int i = 0; i < kNFiles; ++i) {
+      std::unique_ptr<TFile> f = futures[i].get();
+      ASSERT_NE(f, nullptr);
+      EXPECT_STREQ(f->GetName(), names[i].c_str());
+      std::unique_ptr<TNamed> obj{f->Get<TNamed>("obj")};
+      ASSERT_NE(obj, nullptr);
+      EXPECT_STREQ(obj->GetTitle(), names[i].c_str());
+   }
+
+   EXPECT_TRUE(TFile::OpenMany({}).empty());
+   for (const auto &name : names)
+      gSystem->Unlink(name.c_str());
+}
+
 // Tests ROOT-9857
 TEST(TFile, ReadFromSameFile)
 {
@@ -25,6 +25,8 @@
 // When Sync() is called, this triggers objects in the TFile space to   //
 // be communicated over MPI to a master writer which combines the data  //
 // before writing it to file.                                           //
+// Sync() does not wait for the collector: up to a configurable number  //
+// of snapshots can be in flight at the same time.                      //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
@@ -35,13 +37,15 @@
 
 #include <mpi.h>
 
+#include <deque>
+#include <memory>
 #include <vector>
 
 class TMPIFile : public TMemFile {
 
 private:
    Int_t fEndProcess = 0; // collector tracks number of exited processes
-   Int_t fSplitLevel;     // number of collectors to use
+   Int_t fSplitLevel;     // number of collectors to use, 0 for one collector per node
    Int_t fMPIColor;       // used by MPI ranks to track which collector to use
 
    Int_t fMPIGlobalRank; // global rank number
@@ -49,12 +53,18 @@ private:
    Int_t fMPILocalRank;  // rank number in sub communicator
    Int_t fMPILocalSize;  // number of ranks in sub communicator
 
-   MPI_Comm fSubComm;       // sub communicator handle
-   MPI_Request fMPIRequest; // request place holder
+   MPI_Comm fSubComm;                       // sub communicator handle
+   MPI_Comm fCollectorComm = MPI_COMM_NULL; // communicator of the collectors, null on workers
 
    TString fMPIFilename; // output filename, only used by collector
+   Bool_t fMergeCollectorOutputs = kFALSE; // merge the outputs of all collectors into one file
 
-   char *fSendBuf = 0; // message buffer, only used by worker
+   struct PendingSend {
+      MPI_Request fRequest;
+      std::unique_ptr<char[]> fBuffer;
+   };
+   std::deque<PendingSend> fPendingSends; //! snapshots not yet received by the collector, only used by worker
+   UInt_t fMaxPendingSends = 4;           // number of snapshots that Sync() keeps in flight
 
    struct ParallelFileMerger : public TObject {
    private:
@@ -85,12 +95,15 @@ private:
       void RegisterClient(UInt_t clientID, TFile *file);
    };
 
+   TString GetOutputName(Int_t color) const;
    void SetOutputName();
    void CheckSplitLevel();
    void SplitMPIComm();
    void UpdateEndProcess();
+   void MergeCollectorOutputs();
 
    Bool_t IsReceived();
+   void CompleteSends(UInt_t maxPending);
 
 public:
    TMPIFile(const char *name, char *buffer, Long64_t size = 0, Option_t *option = "", Int_t split = 1,
@@ -112,8 +125,12 @@ public:
    // Collector Functions
    void RunCollector(Bool_t cache = kFALSE);
    Bool_t IsCollector();
+   void SetMergeCollectorOutputs(Bool_t merge = kTRUE) { fMergeCollectorOutputs = merge; }
+   Bool_t GetMergeCollectorOutputs() const { return fMergeCollectorOutputs; }
 
    // Sender Functions
+   void SetMaxPendingSends(UInt_t n) { fMaxPendingSends = n > 0 ? n : 1; }
+   UInt_t GetMaxPendingSends() const { return fMaxPendingSends; }
    void CreateBufferAndSend();
    // Empty Buffer to signal the end of job...
    void CreateEmptyBufferAndSend();
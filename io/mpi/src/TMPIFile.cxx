@@ -14,6 +14,7 @@
 #include "TKey.h"
 #include "THashTable.h"
 #include "TMath.h"
+#include "TSystem.h"
 
 ClassImp(TMPIFile);
 
@@ -44,6 +45,19 @@ Begin_Macro (source)
 }
 End_Macro
 
+### Scaling to many ranks
+
+Each collector merges the snapshots of its sub-communicator into its own file,
+named after the output file with the collector index appended. With a split
+level of 0, one collector is used per node (i.e. per shared-memory domain), so
+that snapshots only travel over the node-local interconnect. With
+SetMergeCollectorOutputs(), the collectors finally merge their files pairwise
+in a tree, in log2(number of collectors) rounds, into the output file given to
+the constructor; this requires the collectors to share a file system.
+
+Workers never wait for the collector in Sync() unless more than
+GetMaxPendingSends() snapshots are still in flight.
+
 See TMPIFile class for the list of functions
 */
 
@@ -54,12 +68,11 @@ const Int_t MIN_FILE_NUM = 2;
 ///
 /// See TMemFile for constructor explanation of the syntax.
 ///
-/// \param[split] is the number of collectors to use
+/// \param[split] is the number of collectors to use, or 0 to use one collector per node
 
 TMPIFile::TMPIFile(const char *name, char *buffer, Long64_t size, Option_t *option, Int_t split, const char *ftitle,
                    Int_t compress)
-   : TMemFile(name, buffer, size, option, ftitle, compress), fSplitLevel(split), fMPIColor(0), fMPIRequest(0),
-     fSendBuf(0)
+   : TMemFile(name, buffer, size, option, ftitle, compress), fSplitLevel(split), fMPIColor(0)
 {
    // check that split is set to reasonable value
    CheckSplitLevel();
@@ -73,10 +86,10 @@ TMPIFile::TMPIFile(const char *name, char *buffer, Long64_t size, Option_t *opti
 ///
 /// See TMemFile for constructor explanation of the syntax.
 ///
-/// \param[split] is the number of collectors to use
+/// \param[split] is the number of collectors to use, or 0 to use one collector per node
 
 TMPIFile::TMPIFile(const char *name, Option_t *option, Int_t split, const char *ftitle, Int_t compress)
-   : TMemFile(name, option, ftitle, compress), fSplitLevel(split), fMPIColor(0), fMPIRequest(0), fSendBuf(0)
+   : TMemFile(name, option, ftitle, compress), fSplitLevel(split), fMPIColor(0)
 {
    // check that split is set to reasonable value
    CheckSplitLevel();
@@ -93,13 +106,17 @@ TMPIFile::TMPIFile(const char *name, Option_t *option, Int_t split, const char *
 
 TMPIFile::~TMPIFile()
 {
+   // Close still needs the sub communicator to signal the collector
+   Close();
    // Sub communicators should be freed
    Int_t finalized = 0;
    MPI_Finalized(&finalized);
-   if (!finalized && (fSplitLevel > 1)) {
-      MPI_Comm_free(&fSubComm);
+   if (!finalized) {
+      if (fSubComm != MPI_COMM_WORLD)
+         MPI_Comm_free(&fSubComm);
+      if (fCollectorComm != MPI_COMM_NULL)
+         MPI_Comm_free(&fCollectorComm);
    }
-   Close();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -185,11 +202,57 @@ void TMPIFile::RunCollector(Bool_t cache)
    }
 
    if (fEndProcess == fMPILocalSize - 1) {
+      // closes the output files
       mergers.Delete();
+      if (fMergeCollectorOutputs)
+         MergeCollectorOutputs();
       return;
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Called by the Collectors only, once they received all data: merge the
+/// output files of all collectors into the output file of this TMPIFile.
+///
+/// In every round, half of the remaining collectors hand over their file to
+/// a partner, which merges it into its own, so that the number of rounds grows
+/// only logarithmically with the number of collectors. The files are exchanged
+/// through the file system; only their collector indices travel over MPI.
+
+void TMPIFile::MergeCollectorOutputs()
+{
+   Int_t rank = 0;
+   Int_t size = 0;
+   MPI_Comm_rank(fCollectorComm, &rank);
+   MPI_Comm_size(fCollectorComm, &size);
+
+   for (Int_t step = 1; step < size; step *= 2) {
+      if (rank % (2 * step) != 0) {
+         // our file is complete: hand it over to the partner and leave
+         MPI_Send(&fMPIColor, 1, MPI_INT, rank - step, 0, fCollectorComm);
+         return;
+      }
+      if (rank + step >= size)
+         continue;
+
+      Int_t color = 0;
+      MPI_Recv(&color, 1, MPI_INT, rank + step, 0, fCollectorComm, MPI_STATUS_IGNORE);
+      const TString input = GetOutputName(color);
+
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetPrintLevel(0);
+      if (!merger.OutputFile(fMPIFilename, "UPDATE") || !merger.AddFile(input, kFALSE) ||
+          !merger.PartialMerge(TFileMerger::kAllIncremental | TFileMerger::kKeepCompression)) {
+         Error("MergeCollectorOutputs", "Failed to merge %s into %s", input.Data(), fMPIFilename.Data());
+         continue;
+      }
+      gSystem->Unlink(input);
+   }
+
+   if (gSystem->Rename(fMPIFilename, GetName()) != 0)
+      Error("MergeCollectorOutputs", "Cannot rename %s to %s", fMPIFilename.Data(), GetName());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for ParallelFileMerger class
 
@@ -391,7 +454,7 @@ Bool_t TMPIFile::IsCollector()
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by the Workers only: Copies the current content in memory and
 /// sends it asynchronously to the Collector for merging and writing to disk.
-///
+/// The copy is kept until the Collector received it.
 
 void TMPIFile::CreateBufferAndSend()
 {
@@ -401,9 +464,29 @@ void TMPIFile::CreateBufferAndSend()
    }
    this->Write();
    Int_t count = this->GetEND();
-   fSendBuf = new char[count];
-   this->CopyTo(fSendBuf, count);
-   MPI_Isend(fSendBuf, count, MPI_CHAR, 0, fMPIColor, fSubComm, &fMPIRequest);
+   fPendingSends.emplace_back();
+   auto &send = fPendingSends.back();
+   send.fBuffer.reset(new char[count]);
+   this->CopyTo(send.fBuffer.get(), count);
+   MPI_Isend(send.fBuffer.get(), count, MPI_CHAR, 0, fMPIColor, fSubComm, &send.fRequest);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by the Workers only: release the snapshots that were received by
+/// the Collector, then wait until at most maxPending are still in flight.
+
+void TMPIFile::CompleteSends(UInt_t maxPending)
+{
+   for (auto it = fPendingSends.begin(); it != fPendingSends.end();) {
+      Int_t done = 0;
+      MPI_Test(&it->fRequest, &done, MPI_STATUS_IGNORE);
+      it = done ? fPendingSends.erase(it) : std::next(it);
+   }
+   // sends to the same collector complete in order
+   while (fPendingSends.size() > maxPending) {
+      MPI_Wait(&fPendingSends.front().fRequest, MPI_STATUS_IGNORE);
+      fPendingSends.pop_front();
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -416,26 +499,19 @@ void TMPIFile::CreateEmptyBufferAndSend()
       return;
    }
 
-   if (!IsReceived()) {
-      MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
-   }
-   delete[] fSendBuf; // empty the buffer once received by master
-   fSendBuf = nullptr;
-   MPI_Send(fSendBuf, 0, MPI_CHAR, 0, fMPIColor, fSubComm);
+   // all snapshots must be received before the end of the job is signalled
+   CompleteSends(0);
+   MPI_Send(nullptr, 0, MPI_CHAR, 0, fMPIColor, fSubComm);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by the Workers only: Called periodically by workers and triggers
-/// the sending of data to the Collector for writing.
+/// the sending of data to the Collector for writing. This only blocks if
+/// GetMaxPendingSends() earlier snapshots are still not received.
 
 void TMPIFile::Sync()
 {
-   // check if the previous send request is accepted by master.
-   if (!IsReceived()) {
-      MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
-   }
-   delete[] fSendBuf; // empty the buffer once received by master
-   fSendBuf = nullptr;
+   CompleteSends(fMaxPendingSends - 1);
    CreateBufferAndSend();
    this->ResetAfterMerge((TFileMergeInfo *)0);
 }
@@ -467,6 +543,14 @@ void TMPIFile::Close(Option_t *option)
 /// unique filename.
 
 void TMPIFile::SetOutputName()
+{
+   fMPIFilename = GetOutputName(fMPIColor);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The name of the file written by the Collector of the given color.
+
+TString TMPIFile::GetOutputName(Int_t color) const
 {
    std::string _filename = this->GetName();
 
@@ -474,19 +558,20 @@ void TMPIFile::SetOutputName()
    if (found != std::string::npos) {
       _filename.resize(found);
    }
-   fMPIFilename = _filename;
-   fMPIFilename += "_";
-   fMPIFilename += fMPIColor;
-   fMPIFilename += ".root";
+   TString name = _filename;
+   name += "_";
+   name += color;
+   name += ".root";
+   return name;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Checks that the split level is more than one.
-/// There must be at least one Worker and one Collector rank.
+/// Checks that the split level is more than one, or 0 for one collector per
+/// node. There must be at least one Worker and one Collector rank.
 
 void TMPIFile::CheckSplitLevel()
 {
-   if (fSplitLevel < 1) {
+   if (fSplitLevel < 0) {
       Error("CheckSplitLevel", "At least one collector is required instead of %d", fSplitLevel);
    }
 }
@@ -508,7 +593,8 @@ void TMPIFile::SplitMPIComm()
    MPI_Comm_size(MPI_COMM_WORLD, &fMPIGlobalSize);
    MPI_Comm_rank(MPI_COMM_WORLD, &fMPIGlobalRank);
 
-   if (MIN_FILE_NUM * fSplitLevel > fMPIGlobalSize) {
+   const Bool_t perNode = (fSplitLevel == 0);
+   if (!perNode && MIN_FILE_NUM * fSplitLevel > fMPIGlobalSize) {
       Error("TMPIFile",
             "Number of Output File is larger than number of Processors Allocated."
             " Number of processors should be two times larger than outpts. For %d outputs at least %d "
@@ -516,8 +602,12 @@ void TMPIFile::SplitMPIComm()
             fSplitLevel, MIN_FILE_NUM * fSplitLevel, fMPIGlobalSize);
    }
 
+   // using one collector per node (i.e. per shared memory domain)
+   if (perNode) {
+      MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, fMPIGlobalRank, MPI_INFO_NULL, &fSubComm);
+   }
    // using one collector
-   if (fSplitLevel == 1) {
+   else if (fSplitLevel == 1) {
       fSubComm = MPI_COMM_WORLD;
    }
    // using more than one collector
@@ -534,17 +624,31 @@ void TMPIFile::SplitMPIComm()
    // get the sub-communicator size and rank
    MPI_Comm_size(fSubComm, &fMPILocalSize);
    MPI_Comm_rank(fSubComm, &fMPILocalRank);
+
+   // the collectors form their own communicator to merge their outputs at the end
+   MPI_Comm_split(MPI_COMM_WORLD, IsCollector() ? 0 : MPI_UNDEFINED, fMPIGlobalRank, &fCollectorComm);
+
+   if (perNode) {
+      // the nodes are numbered by the rank of their collector among all collectors
+      if (IsCollector()) {
+         MPI_Comm_rank(fCollectorComm, &fMPIColor);
+         MPI_Comm_size(fCollectorComm, &fSplitLevel);
+      }
+      Int_t nodeInfo[2] = {fMPIColor, fSplitLevel};
+      MPI_Bcast(nodeInfo, 2, MPI_INT, 0, fSubComm);
+      fMPIColor = nodeInfo[0];
+      fSplitLevel = nodeInfo[1];
+      if (fMPILocalSize < MIN_FILE_NUM) {
+         Warning("TMPIFile", "Rank %d is alone on its node and collects no data from other ranks", fMPIGlobalRank);
+      }
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Checks the member MPI_REQEUST object to see if a message has been received.
+/// Checks whether all snapshots sent so far have been received.
 
 Bool_t TMPIFile::IsReceived()
 {
-   if (!fMPIRequest) {
-      return kTRUE;
-   }
-   Int_t flag = 0;
-   MPI_Test(&fMPIRequest, &flag, MPI_STATUS_IGNORE);
-   return flag;
+   CompleteSends(fPendingSends.size());
+   return fPendingSends.empty();
 }
@@ -41,6 +41,9 @@ def get_argparse():
     parser.add_argument("-j", help=textwrap.fill(
         "Parallelize the execution in 'J' processes. If the number of "
         "processes is not specified, use the system maximum."))
+    parser.add_argument("-t", help=textwrap.fill(
+        "Read the objects to be merged with 'T' threads. If the number of "
+        "threads is not specified, use the system maximum."))
     parser.add_argument("-dbg", help=textwrap.fill(
         "Enable verbosity. If -j was specified, do not not delete partial files "
         "stored inside working directory."), action = 'store_true')
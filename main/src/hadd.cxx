@@ -28,6 +28,7 @@
   \param -T   Do not merge Trees
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
   \param -j   Parallelise the execution in `J` processes. If the number of processes is not specified, use the system maximum.
+  \param -t   Read the objects to be merged with `T` threads. If the number of threads is not specified, use the system maximum.
   \param -dbg Enable verbosity. If -j was specified, do not not delete partial files stored inside working directory.
   \param -d   Carry out the partial multiprocess execution in the specified directory
   \param -n   Open at most `N` files at once (use 0 to request to use the system maximum)
@@ -99,6 +100,7 @@
 #include "THashList.h"
 #include "TKey.h"
 #include "TClass.h"
+#include "TROOT.h"
 #include "TSystem.h"
 #include "TUUID.h"
 #include "ROOT/StringConv.hxx"
@@ -135,6 +137,7 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Int_t nThreads = -1;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
@@ -209,6 +212,22 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-t") == 0) {
+         // If the number of threads is not specified, let the thread pool use all the cores.
+         nThreads = 0;
+         if (a + 1 != argc && argv[a + 1][0] != '-') {
+            char *end = nullptr;
+            Long_t request = strtol(argv[a + 1], &end, 10);
+            if (*end == '\0' && request >= 0 && request < kMaxInt) {
+               nThreads = (Int_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the number of threads passed after -t: " << argv[a + 1]
+                         << ". We will use the system maximum.\n";
+            }
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -532,6 +551,17 @@ int main( int argc, char **argv )
       return mergeFiles(fileMerger);
    };
 
+   // The thread pool is only started in this process once the worker processes are done, never before forking.
+   auto enableThreads = [&]() {
+      if (nThreads >= 0) {
+#ifdef R__USE_IMT
+         ROOT::EnableImplicitMT(nThreads);
+#else
+         std::cerr << "hadd: -t is ignored, ROOT was built without implicit multi-threading support.\n";
+#endif
+      }
+   };
+
    Bool_t status;
 
 #ifndef R__WIN32
@@ -540,6 +570,7 @@ int main( int argc, char **argv )
       auto res = p.Map(parallelMerge, ROOT::TSeqI(0, allSubfiles.size(), step));
       status = std::accumulate(res.begin(), res.end(), 0U) == partialFiles.size();
       if (status) {
+         enableThreads();
          status = reductionFunc();
       } else {
          std::cout << "hadd failed at the parallel stage" << std::endl;
@@ -550,9 +581,11 @@ int main( int argc, char **argv )
          }
       }
    } else {
+      enableThreads();
       status = sequentialMerge(fileMerger, 0, allSubfiles.size());
    }
 #else
+   enableThreads();
    status = sequentialMerge(fileMerger, 0, allSubfiles.size());
 #endif
 
@@ -11,6 +11,9 @@
 #include "ReadSpeedCLI.hxx"
 #include "ReadSpeed.hxx"
 
+#include <fstream>
+#include <iostream>
+
 using namespace ReadSpeed;
 
 int main(int argc, char **argv)
@@ -20,7 +23,25 @@ int main(int argc, char **argv)
    if (!args.fShouldRun)
       return 1; // ParseArgs has printed the --help, has run the --test or has encountered an issue and logged about it
 
-   PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+   const auto result = args.fWriteOutput.empty()
+                          ? EvalThroughput(args.fData, args.fNThreads)
+                          : EvalWriteThroughput(args.fData, args.fWriteOutput, args.fWriteCompression);
+
+   if (args.fJSONOutput == "-") {
+      PrintThroughputJSON(result, std::cout);
+      return 0;
+   }
+
+   PrintThroughput(result);
+
+   if (!args.fJSONOutput.empty()) {
+      std::ofstream json(args.fJSONOutput);
+      if (!json) {
+         std::cerr << "Could not open '" << args.fJSONOutput << "' for writing\n";
+         return 1;
+      }
+      PrintThroughputJSON(result, json);
+   }
 
    return 0;
 }
@@ -0,0 +1,333 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 , LCG ROOT MathLib Team                         *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Header file for class LorentzVectorBatch
+
+#ifndef ROOT_Math_GenVector_LorentzVectorBatch
+#define ROOT_Math_GenVector_LorentzVectorBatch 1
+
+#include "Math/GenVector/LorentzVector.h"
+#include "Math/GenVector/PxPyPzE4D.h"
+#include "Math/GenVector/GenVector_exception.h"
+#include "Math/GenVector/eta.h"
+#include "Math/GenVector/etaMax.h"
+
+#include "ROOT/RVec.hxx"
+
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ROOT {
+
+namespace Math {
+
+//__________________________________________________________________________________________
+/** @ingroup GenVector
+
+Class describing a collection of Lorentz vectors, e.g. the jets or the muons of an event, stored as a
+structure of arrays: one ROOT::RVec for each of the Px, Py, Pz and E components.
+
+Building, for each particle of a collection, a LorentzVector from its pt, eta, phi and mass and then
+computing sums, boosts or invariant masses goes through one object at a time. The batch performs the
+coordinate conversions and the operations in loops over contiguous arrays of each component, which the
+compiler can vectorize, and it returns the derived quantities (Pt(), Eta(), Phi(), M(), ...) as RVecs,
+so that it can be used directly in the Defines of RDataFrame and together with ROOT::VecOps:
+
+~~~{.cpp}
+auto jets = ROOT::Math::LorentzVectorBatch<float>::FromPtEtaPhiM(Jet_pt, Jet_eta, Jet_phi, Jet_mass);
+auto masses = (jets + otherJets).M();
+~~~
+
+The quantities are computed as for ROOT::Math::PxPyPzEVector, element by element, except that M()
+returns -sqrt(-M2()) for tachyonic vectors without any warning.
+
+@sa Overview of the @ref GenVector "physics vector library"
+*/
+
+template <class T = double>
+class LorentzVectorBatch {
+
+public:
+   typedef T Scalar;
+   typedef ROOT::VecOps::RVec<T> RVec_t;
+   typedef LorentzVector<PxPyPzE4D<T>> Vector_t;
+
+   /// Empty collection
+   LorentzVectorBatch() {}
+
+   /// Construct from the collections of the Px, Py, Pz and E components, which must have the same size
+   LorentzVectorBatch(RVec_t px, RVec_t py, RVec_t pz, RVec_t e)
+      : fPx(std::move(px)), fPy(std::move(py)), fPz(std::move(pz)), fE(std::move(e))
+   {
+      CheckSize("LorentzVectorBatch", fPx.size(), fPy.size(), fPz.size(), fE.size());
+   }
+
+   /// Construct from a collection of Lorentz vectors in any coordinate system
+   template <class CoordSystem>
+   explicit LorentzVectorBatch(const ROOT::VecOps::RVec<LorentzVector<CoordSystem>> &v)
+      : fPx(v.size()), fPy(v.size()), fPz(v.size()), fE(v.size())
+   {
+      for (std::size_t i = 0; i < v.size(); ++i) {
+         fPx[i] = v[i].Px();
+         fPy[i] = v[i].Py();
+         fPz[i] = v[i].Pz();
+         fE[i] = v[i].E();
+      }
+   }
+
+   /// Construct from the collections of the transverse momentum, pseudorapidity, azimuth and mass,
+   /// as for ROOT::Math::PtEtaPhiMVector (a negative mass denotes a space-like vector)
+   template <class T0, class T1, class T2, class T3>
+   static LorentzVectorBatch FromPtEtaPhiM(const ROOT::VecOps::RVec<T0> &pt, const ROOT::VecOps::RVec<T1> &eta,
+                                           const ROOT::VecOps::RVec<T2> &phi, const ROOT::VecOps::RVec<T3> &mass)
+   {
+      const std::size_t n = pt.size();
+      CheckSize("FromPtEtaPhiM", n, eta.size(), phi.size(), mass.size());
+      LorentzVectorBatch b(n);
+      for (std::size_t i = 0; i < n; ++i) {
+         const T fpt = pt[i];
+         const T fphi = phi[i];
+         b.fPx[i] = fpt * std::cos(fphi);
+         b.fPy[i] = fpt * std::sin(fphi);
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+         const T fpt = pt[i];
+         const T feta = eta[i];
+         b.fPz[i] = fpt > 0 ? fpt * std::sinh(feta)
+                            : (feta == 0 ? 0 : (feta > 0 ? feta - etaMax<T>() : feta + etaMax<T>()));
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+         const T fpt = pt[i];
+         const T feta = eta[i];
+         const T m = mass[i];
+         const T p = fpt > 0 ? fpt * std::cosh(feta)
+                             : (feta > etaMax<T>() ? feta - etaMax<T>()
+                                                   : (feta < -etaMax<T>() ? -feta - etaMax<T>() : 0));
+         const T e2 = p * p + (m >= 0 ? m * m : -m * m);
+         b.fE[i] = std::sqrt(e2 > 0 ? e2 : 0);
+      }
+      return b;
+   }
+
+   /// Construct from the collections of the Px, Py, Pz components and of the mass,
+   /// as for ROOT::Math::PxPyPzMVector (a negative mass denotes a space-like vector)
+   template <class T0, class T1, class T2, class T3>
+   static LorentzVectorBatch FromPxPyPzM(const ROOT::VecOps::RVec<T0> &px, const ROOT::VecOps::RVec<T1> &py,
+                                         const ROOT::VecOps::RVec<T2> &pz, const ROOT::VecOps::RVec<T3> &mass)
+   {
+      const std::size_t n = px.size();
+      CheckSize("FromPxPyPzM", n, py.size(), pz.size(), mass.size());
+      LorentzVectorBatch b(n);
+      for (std::size_t i = 0; i < n; ++i) {
+         b.fPx[i] = px[i];
+         b.fPy[i] = py[i];
+         b.fPz[i] = pz[i];
+         const T m = mass[i];
+         const T e2 = b.fPx[i] * b.fPx[i] + b.fPy[i] * b.fPy[i] + b.fPz[i] * b.fPz[i] + (m >= 0 ? m * m : -m * m);
+         b.fE[i] = std::sqrt(e2 > 0 ? e2 : 0);
+      }
+      return b;
+   }
+
+   // ------ accessors ------
+
+   /// number of vectors in the collection
+   std::size_t Size() const { return fE.size(); }
+
+   const RVec_t &Px() const { return fPx; }
+   const RVec_t &Py() const { return fPy; }
+   const RVec_t &Pz() const { return fPz; }
+   const RVec_t &E() const { return fE; }
+
+   /// vector i of the collection
+   Vector_t operator[](std::size_t i) const { return Vector_t(fPx[i], fPy[i], fPz[i], fE[i]); }
+
+   /// the collection as an RVec of Lorentz vectors
+   ROOT::VecOps::RVec<Vector_t> Vectors() const
+   {
+      ROOT::VecOps::RVec<Vector_t> v(Size());
+      for (std::size_t i = 0; i < Size(); ++i)
+         v[i] = (*this)[i];
+      return v;
+   }
+
+   // ------ derived quantities, for each vector ------
+
+   /// transverse momentum
+   RVec_t Pt() const
+   {
+      RVec_t r(Size());
+      for (std::size_t i = 0; i < Size(); ++i)
+         r[i] = std::sqrt(fPx[i] * fPx[i] + fPy[i] * fPy[i]);
+      return r;
+   }
+
+   /// magnitude of the spatial momentum
+   RVec_t P() const
+   {
+      RVec_t r(Size());
+      for (std::size_t i = 0; i < Size(); ++i)
+         r[i] = std::sqrt(fPx[i] * fPx[i] + fPy[i] * fPy[i] + fPz[i] * fPz[i]);
+      return r;
+   }
+
+   /// azimuthal angle
+   RVec_t Phi() const
+   {
+      RVec_t r(Size());
+      for (std::size_t i = 0; i < Size(); ++i)
+         r[i] = (fPx[i] == 0 && fPy[i] == 0) ? 0 : std::atan2(fPy[i], fPx[i]);
+      return r;
+   }
+
+   /// pseudorapidity
+   RVec_t Eta() const
+   {
+      RVec_t r = Pt();
+      for (std::size_t i = 0; i < Size(); ++i)
+         r[i] = Impl::Eta_FromRhoZ(r[i], fPz[i]);
+      return r;
+   }
+
+   /// square of the invariant mass
+   RVec_t M2() const
+   {
+      RVec_t r(Size());
+      for (std::size_t i = 0; i < Size(); ++i)
+         r[i] = fE[i] * fE[i] - fPx[i] * fPx[i] - fPy[i] * fPy[i] - fPz[i] * fPz[i];
+      return r;
+   }
+
+   /// invariant mass, -sqrt(-M2()) for tachyonic vectors
+   RVec_t M() const
+   {
+      RVec_t r = M2();
+      for (auto &m2 : r)
+         m2 = m2 >= 0 ? std::sqrt(m2) : -std::sqrt(-m2);
+      return r;
+   }
+
+   /// distance in the eta-phi plane between each vector and the vector with the same index of other,
+   /// as for ROOT::Math::VectorUtil::DeltaR
+   RVec_t DeltaR(const LorentzVectorBatch &other) const
+   {
+      CheckSize("DeltaR", Size(), other.Size());
+      const RVec_t phi1 = Phi();
+      const RVec_t phi2 = other.Phi();
+      RVec_t r = Eta();
+      const RVec_t eta2 = other.Eta();
+      for (std::size_t i = 0; i < Size(); ++i) {
+         T dphi = phi2[i] - phi1[i];
+         if (dphi > T(M_PI))
+            dphi -= T(2.0 * M_PI);
+         else if (dphi <= T(-M_PI))
+            dphi += T(2.0 * M_PI);
+         const T deta = eta2[i] - r[i];
+         r[i] = std::sqrt(dphi * dphi + deta * deta);
+      }
+      return r;
+   }
+
+   // ------ operations ------
+
+   /// sum of all the vectors of the collection
+   Vector_t Sum() const
+   {
+      T px = 0, py = 0, pz = 0, e = 0;
+      for (std::size_t i = 0; i < Size(); ++i) {
+         px += fPx[i];
+         py += fPy[i];
+         pz += fPz[i];
+         e += fE[i];
+      }
+      return Vector_t(px, py, pz, e);
+   }
+
+   /// add to each vector the vector with the same index of other
+   LorentzVectorBatch &operator+=(const LorentzVectorBatch &other)
+   {
+      CheckSize("operator+=", Size(), other.Size());
+      fPx += other.fPx;
+      fPy += other.fPy;
+      fPz += other.fPz;
+      fE += other.fE;
+      return *this;
+   }
+
+   /// pairwise sum of the vectors with the same index, e.g. to compute the invariant masses of pairs
+   LorentzVectorBatch operator+(const LorentzVectorBatch &other) const
+   {
+      LorentzVectorBatch b(*this);
+      b += other;
+      return b;
+   }
+
+   /**
+      Boost all the vectors by the same beta vector (bx, by, bz), as ROOT::Math::VectorUtil::boost.
+      The beta of the boost must be < 1, otherwise the collection is left unchanged.
+   */
+   LorentzVectorBatch &Boost(T bx, T by, T bz)
+   {
+      const T b2 = bx * bx + by * by + bz * bz;
+      if (b2 >= 1) {
+         GenVector::Throw("LorentzVectorBatch::Boost - Beta Vector supplied to set Boost represents speed >= c");
+         return *this;
+      }
+      const T gamma = 1 / std::sqrt(1 - b2);
+      const T gamma2 = b2 > 0 ? (gamma - 1) / b2 : 0;
+      T *px = fPx.data();
+      T *py = fPy.data();
+      T *pz = fPz.data();
+      T *e = fE.data();
+      for (std::size_t i = 0; i < Size(); ++i) {
+         const T bp = bx * px[i] + by * py[i] + bz * pz[i];
+         const T t = e[i];
+         px[i] += gamma2 * bp * bx + gamma * bx * t;
+         py[i] += gamma2 * bp * by + gamma * by * t;
+         pz[i] += gamma2 * bp * bz + gamma * bz * t;
+         e[i] = gamma * (t + bp);
+      }
+      return *this;
+   }
+
+   /// Boost all the vectors by the same beta vector b, which can be any 3D vector
+   template <class Vector3>
+   LorentzVectorBatch &Boost(const Vector3 &b)
+   {
+      return Boost(b.X(), b.Y(), b.Z());
+   }
+
+private:
+   explicit LorentzVectorBatch(std::size_t n) : fPx(n), fPy(n), fPz(n), fE(n) {}
+
+   template <class... Sizes>
+   static void CheckSize(const char *where, std::size_t n, Sizes... sizes)
+   {
+      for (std::size_t s : {sizes...}) {
+         if (s != n)
+            throw std::runtime_error(std::string("LorentzVectorBatch::") + where +
+                                     ": input collections have different sizes");
+      }
+   }
+
+   RVec_t fPx; ///< x components of the momenta
+   RVec_t fPy; ///< y components of the momenta
+   RVec_t fPz; ///< z components of the momenta
+   RVec_t fE;  ///< energies
+};
+
+} // end namespace Math
+
+} // end namespace ROOT
+
+#endif /* ROOT_Math_GenVector_LorentzVectorBatch */
@@ -0,0 +1,112 @@
+// Tests of ROOT::Math::LorentzVectorBatch against the same operations on single Lorentz vectors
+
+#include "Math/LorentzVectorBatch.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector4D.h"
+#include "Math/VectorUtil.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace ROOT::Math;
+using ROOT::VecOps::RVec;
+
+int nFailedTests = 0;
+
+void CheckNear(double v1, double v2, const char *what, double eps = 1.E-10)
+{
+   if (std::abs(v1 - v2) > eps * std::max(1., std::abs(v2))) {
+      std::cout << what << " test failed: " << v1 << " != " << v2 << std::endl;
+      nFailedTests++;
+   }
+}
+
+void CheckNear(const XYZTVector &v1, const XYZTVector &v2, const char *what)
+{
+   CheckNear(v1.X(), v2.X(), what);
+   CheckNear(v1.Y(), v2.Y(), what);
+   CheckNear(v1.Z(), v2.Z(), what);
+   CheckNear(v1.T(), v2.T(), what);
+}
+
+int main()
+{
+   RVec<double> pt1{10., 25.5, 0., 40.};
+   RVec<double> eta1{0.5, -1.2, 2., 4.1};
+   RVec<double> phi1{0.1, -2.9, 1., 3.1};
+   RVec<double> mass1{0.105, 5., 0., -1.};
+   RVec<double> pt2{3., 12., 50., 0.1};
+   RVec<double> eta2{-2.2, 1.4, 0., -0.3};
+   RVec<double> phi2{-3.1, 2.8, 0.5, -1.};
+   RVec<double> mass2{0.105, 0.5, 91., 0.};
+
+   auto batch1 = LorentzVectorBatch<double>::FromPtEtaPhiM(pt1, eta1, phi1, mass1);
+   auto batch2 = LorentzVectorBatch<double>::FromPtEtaPhiM(pt2, eta2, phi2, mass2);
+
+   const auto sum = batch1 + batch2;
+   const auto masses = sum.M();
+   const auto pt = batch1.Pt();
+   const auto eta = batch1.Eta();
+   const auto phi = batch1.Phi();
+   const auto dr = batch1.DeltaR(batch2);
+
+   XYZTVector total;
+   for (std::size_t i = 0; i < pt1.size(); ++i) {
+      const PtEtaPhiMVector v1(pt1[i], eta1[i], phi1[i], mass1[i]);
+      const PtEtaPhiMVector v2(pt2[i], eta2[i], phi2[i], mass2[i]);
+      CheckNear(batch1[i], XYZTVector(v1), "FromPtEtaPhiM");
+      CheckNear(sum[i], XYZTVector(v1) + XYZTVector(v2), "operator+");
+      CheckNear(masses[i], (v1 + v2).M(), "M");
+      CheckNear(pt[i], v1.Pt(), "Pt");
+      CheckNear(eta[i], XYZTVector(v1).Eta(), "Eta");
+      CheckNear(phi[i], XYZTVector(v1).Phi(), "Phi");
+      CheckNear(dr[i], VectorUtil::DeltaR(XYZTVector(v1), XYZTVector(v2)), "DeltaR");
+      total += XYZTVector(v1);
+   }
+   CheckNear(batch1.Sum(), total, "Sum");
+
+   // boost into the rest frame of the sum of each pair, and back
+   const XYZVector beta(0.3, -0.2, 0.6);
+   auto boosted = batch1;
+   boosted.Boost(beta);
+   for (std::size_t i = 0; i < pt1.size(); ++i)
+      CheckNear(boosted[i], VectorUtil::boost(batch1[i], beta), "Boost");
+   boosted.Boost(-beta);
+   for (std::size_t i = 0; i < pt1.size(); ++i)
+      CheckNear(boosted[i], batch1[i], "Boost back");
+
+   // from single vectors and from the cartesian components
+   const LorentzVectorBatch<double> fromVectors(batch1.Vectors());
+   const auto fromPxPyPzM = LorentzVectorBatch<double>::FromPxPyPzM(batch1.Px(), batch1.Py(), batch1.Pz(), batch1.M());
+   for (std::size_t i = 0; i < pt1.size(); ++i) {
+      CheckNear(fromVectors[i], batch1[i], "from Vectors");
+      CheckNear(fromPxPyPzM[i], batch1[i], "FromPxPyPzM");
+   }
+
+   // single precision
+   const RVec<float> ptf(pt1), etaf(eta1), phif(phi1), massf(mass1);
+   const auto batchf = LorentzVectorBatch<float>::FromPtEtaPhiM(ptf, etaf, phif, massf);
+   const auto massesf = (batchf + LorentzVectorBatch<float>::FromPtEtaPhiM(pt2, eta2, phi2, mass2)).M();
+   for (std::size_t i = 0; i < pt1.size(); ++i) {
+      // vectors with zero pt depend on etaMax, which is different in single precision;
+      // the masses of energetic pairs lose precision in E^2 - p^2
+      if (pt1[i] > 0)
+         CheckNear(massesf[i], masses[i], "M in single precision", 1.E-3);
+   }
+
+   bool sizeError = false;
+   try {
+      LorentzVectorBatch<double>::FromPtEtaPhiM(pt1, eta1, phi1, RVec<double>{1.});
+   } catch (const std::runtime_error &) {
+      sizeError = true;
+   }
+   if (!sizeError) {
+      std::cout << "size check test failed" << std::endl;
+      nFailedTests++;
+   }
+
+   if (nFailedTests == 0)
+      std::cout << "All LorentzVectorBatch tests passed" << std::endl;
+   return nFailedTests;
+}
@@ -0,0 +1,114 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026  LCG ROOT Math Team, CERN/PH-SFT                *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Header file for class BatchFitter
+
+#ifndef ROOT_Fit_BatchFitter
+#define ROOT_Fit_BatchFitter
+
+#include "Fit/BinData.h"
+#include "Fit/FitConfig.h"
+#include "Fit/FitResult.h"
+#include "Math/IParamFunction.h"
+#include "ROOT/EExecutionPolicy.hxx"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+
+namespace Fit {
+
+/**
+   Fitter class for many independent fits of the same model function to different binned data sets,
+   as in calibration workflows fitting for example a Gaussian to the histogram of each channel.
+
+   Fitting each data set with a ROOT::Fit::Fitter (or TH1::Fit) creates a new minimizer, objective
+   function and fit result for each fit, which for small fits costs much more than the minimization.
+   The BatchFitter creates one minimizer and one clone of the model function for each worker, once,
+   and reuses them for all the fits of the worker. With ROOT::EExecutionPolicy::kMultiThread the
+   data sets are distributed dynamically to workers running in parallel.
+
+   All the fits use the same configuration (Config()), except for the initial parameter values,
+   which can be set for each data set with SetParameterInitializer(). The model function is
+   cloned for each worker, so that the clones must not share any state: a
+   ROOT::Math::WrappedMultiTF1 must for example own a copy of its TF1 (see
+   WrappedMultiTF1::SetAndCopyFunction).
+
+   The returned FitResult do not contain the model function, the objective function nor the
+   minimizer, so that FitResult::Contour and FitResult::Scan cannot be used. MINOS errors are
+   computed if requested in the configuration.
+
+   @ingroup FitMain
+*/
+class BatchFitter {
+
+public:
+   typedef ROOT::Math::IParamMultiFunction IModelFunction;
+
+   /// Function setting the initial parameter values of the fit of a data set,
+   /// given the index and the data set; the parameters contain initially the values of the configuration
+   typedef std::function<void(unsigned int, const BinData &, double *)> ParamInitializer_t;
+
+   /// Constructor from the model function, which is cloned.
+   /// The configuration contains the parameter settings of the function.
+   explicit BatchFitter(const IModelFunction &func);
+
+   ~BatchFitter();
+
+   BatchFitter(const BatchFitter &) = delete;
+   BatchFitter &operator=(const BatchFitter &) = delete;
+
+   /// access to the fit configuration (const method)
+   const FitConfig &Config() const { return fConfig; }
+
+   /// access to the fit configuration, used by all the fits
+   FitConfig &Config() { return fConfig; }
+
+   /// set the function setting the initial parameter values of each fit (e.g. estimated from its data)
+   void SetParameterInitializer(const ParamInitializer_t &init) { fParamInit = init; }
+
+   /**
+      Least-square fit of each data set.
+      nWorkers is the number of workers for the kMultiThread policy, by default the size of the thread pool.
+      Returns the results of the fits, in the order of the data sets.
+   */
+   std::vector<FitResult> LeastSquareFit(const std::vector<BinData> &data,
+                                         ROOT::EExecutionPolicy executionPolicy = ROOT::EExecutionPolicy::kSequential,
+                                         unsigned int nWorkers = 0);
+
+   /**
+      Binned likelihood fit of each data set (see Fitter::LikelihoodFit).
+      nWorkers is the number of workers for the kMultiThread policy, by default the size of the thread pool.
+      Returns the results of the fits, in the order of the data sets.
+   */
+   std::vector<FitResult> LikelihoodFit(const std::vector<BinData> &data, bool extended = true,
+                                        ROOT::EExecutionPolicy executionPolicy = ROOT::EExecutionPolicy::kSequential,
+                                        unsigned int nWorkers = 0);
+
+private:
+   struct Worker;
+
+   std::vector<FitResult> DoFit(const std::vector<BinData> &data, bool likelihood, bool extended,
+                                ROOT::EExecutionPolicy executionPolicy, unsigned int nWorkers);
+
+   void DoFit(Worker &worker, const FitConfig &config, unsigned int i, const BinData &data, bool likelihood,
+              bool extended, FitResult &result) const;
+
+   std::unique_ptr<IModelFunction> fFunc; ///< model function, cloned for each worker
+   FitConfig fConfig;                     ///< configuration of all the fits
+   ParamInitializer_t fParamInit;         ///< function setting the initial parameter values of each fit
+};
+
+} // end namespace Fit
+
+} // end namespace ROOT
+
+#endif /* ROOT_Fit_BatchFitter */
@@ -338,6 +338,7 @@ protected:
    void SetModelFunction(const std::shared_ptr<IModelFunction> & func) { fFitFunc = func; }
 
    friend class Fitter;
+   friend class BatchFitter;
 
 
    bool fValid;             ///< flag for indicating valid fit
@@ -39,6 +39,7 @@
 #pragma link C++ class ROOT::Math::MixMaxEngine<240,0>+;
 #pragma link C++ class ROOT::Math::MixMaxEngine<256,2>+;
 #pragma link C++ class ROOT::Math::MixMaxEngine<17,1>+;
+#pragma link C++ class ROOT::Math::PhiloxEngine+;
 //#pragma link C++ class mixmax::mixmax_engine<240>+;
 //#pragma link C++ class mixmax::mixmax_engine<256>+;
 //#pragma link C++ class mixmax::mixmax_engine<17>+;
@@ -59,6 +60,8 @@
 #pragma link C++ class TRandomGen<ROOT::Math::MixMaxEngine<17,0>>+;
 #pragma link C++ class TRandomGen<ROOT::Math::MixMaxEngine<17,1>>+;
 #pragma link C++ class TRandomGen<ROOT::Math::RanluxppEngine2048>+;
+#pragma link C++ class TRandomGen<ROOT::Math::PhiloxEngine>+;
+#pragma link C++ class TRandomPhilox+;
 #pragma link C++ class TRandomGen<ROOT::Math::StdEngine<std::mt19937_64>>+;
 #pragma link C++ class TRandomGen<ROOT::Math::StdEngine<std::ranlux48>>+;
 
@@ -130,6 +130,16 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+         Evaluate the function for the parameters p at n points and store the n values in result.
+         x contains the NDim() coordinates of the first point, followed by those of the second point and so on.
+         Use the virtual function DoEvalParBatch to implement it
+         */
+         void EvalParBatch(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            DoEvalParBatch(n, x, p, result);
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -137,6 +147,17 @@ namespace ROOT {
          */
          virtual T DoEvalPar(const T *x, const double *p) const = 0;
 
+         /**
+            Implementation of the evaluation at many points, calling DoEvalPar for each point.
+            Derived classes which can evaluate many points faster (e.g. vectorizing over them) should re-implement it
+         */
+         virtual void DoEvalParBatch(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            const unsigned int ndim = this->NDim();
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = DoEvalPar(x + i * ndim, p);
+         }
+
          /**
             Implement the ROOT::Math::IBaseFunctionMultiDim interface DoEval(x) using the cached parameter values
          */
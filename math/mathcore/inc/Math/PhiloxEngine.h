@@ -0,0 +1,176 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_Math_PhiloxEngine
+#define ROOT_Math_PhiloxEngine
+
+#include "Math/TRandomEngine.h"
+
+#include <cstdint>
+
+namespace ROOT {
+namespace Math {
+
+/**
+   Counter-based random number engine Philox4x32-10.
+
+   The engine is described in J. K. Salmon, M. A. Moraes, R. O. Dror and
+   D. E. Shaw, *Parallel random numbers: as easy as 1, 2, 3*, SC '11,
+   https://doi.org/10.1145/2063384.2063405, and the output matches the
+   reference implementation in the Random123 library.
+
+   The i-th block of four 32-bit numbers is a fixed function of the seed
+   (the key), a 64-bit stream number and the block index i. Hence
+   - skipping ahead costs nothing, see Skip();
+   - independent streams for threads or tasks are obtained by giving each
+     task its own stream number, for instance
+     ~~~ {.cpp}
+     ROOT::Math::PhiloxEngine rng(seed, taskIndex);
+     ~~~
+     The numbers generated by a task then depend only on (seed, taskIndex),
+     not on the number of threads or the order of execution.
+   - the state has 24 bytes and no warm-up, so an engine per task is cheap.
+
+   Every double-precision number uses 64 bits of one block (53 of which are
+   kept), so a block provides two numbers.
+
+   @ingroup Random
+*/
+
+class PhiloxEngine final : public TRandomEngine {
+
+public:
+   typedef TRandomEngine BaseType;
+   typedef uint64_t Result_t;
+
+   PhiloxEngine(uint64_t seed = 4357, uint64_t stream = 0) : fStream(stream) { SetSeed(seed); }
+
+   ~PhiloxEngine() override {}
+
+   /// Generate a double-precision random number in ]0,1[ with 53 bits of randomness
+   double Rndm() override { return ToDouble(IntRndm()); }
+   /// Generate a double-precision random number (non-virtual method)
+   double operator()() { return ToDouble(IntRndm()); }
+
+   /// Generate a random integer value with 64 bits
+   uint64_t IntRndm()
+   {
+      if ((fIndex & 1) == 0)
+         Block(fIndex >> 1, fBuffer);
+      const unsigned int i = 2 * (fIndex & 1);
+      ++fIndex;
+      return (uint64_t(fBuffer[i]) << 32) | fBuffer[i + 1];
+   }
+
+   /// Fill `array` with `n` random numbers, equal to `n` calls of Rndm().
+   /// Whole blocks are computed in a loop without dependencies between
+   /// iterations, which the compiler can vectorize.
+   void RndmArray(int n, double *array)
+   {
+      int i = 0;
+      if (n > 0 && (fIndex & 1))
+         array[i++] = Rndm();
+      uint64_t block = fIndex >> 1;
+      for (; i + 1 < n; i += 2, ++block) {
+         uint32_t out[4];
+         Block(block, out);
+         array[i] = ToDouble((uint64_t(out[0]) << 32) | out[1]);
+         array[i + 1] = ToDouble((uint64_t(out[2]) << 32) | out[3]);
+      }
+      fIndex = block << 1;
+      if (i < n)
+         array[i] = Rndm();
+   }
+
+   /// Fill the range with random numbers, as needed by ROOT::Math::Random
+   template <class OutputIterator>
+   void RandomArray(OutputIterator begin, OutputIterator end)
+   {
+      for (OutputIterator itr = begin; itr != end; ++itr)
+         *itr = Rndm();
+   }
+
+   /// Set the key of the generator and restart its current stream
+   void SetSeed(uint64_t seed)
+   {
+      fKey[0] = uint32_t(seed);
+      fKey[1] = uint32_t(seed >> 32);
+      fIndex = 0;
+   }
+
+   /// Switch to the independent stream `stream`, starting at its beginning
+   void SetStream(uint64_t stream)
+   {
+      fStream = stream;
+      fIndex = 0;
+   }
+   uint64_t GetStream() const { return fStream; }
+
+   /// Skip `n` random numbers without generating them
+   void Skip(uint64_t n)
+   {
+      fIndex += n;
+      if (fIndex & 1)
+         Block(fIndex >> 1, fBuffer);
+   }
+
+   /// Number of random numbers generated (or skipped) in the current stream
+   uint64_t Counter() const { return fIndex; }
+
+   /// Compute block `block` of stream `stream` for the key `key`
+   static void Block(const uint32_t key[2], uint64_t stream, uint64_t block, uint32_t out[4])
+   {
+      uint32_t c0 = uint32_t(block), c1 = uint32_t(block >> 32);
+      uint32_t c2 = uint32_t(stream), c3 = uint32_t(stream >> 32);
+      uint32_t k0 = key[0], k1 = key[1];
+      for (int round = 0; round < 10; ++round) {
+         if (round > 0) {
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+         }
+         const uint64_t p0 = uint64_t(0xD2511F53) * c0;
+         const uint64_t p1 = uint64_t(0xCD9E8D57) * c2;
+         c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+         c1 = uint32_t(p1);
+         c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+         c3 = uint32_t(p0);
+      }
+      out[0] = c0;
+      out[1] = c1;
+      out[2] = c2;
+      out[3] = c3;
+   }
+
+   /// minimum integer that can be generated
+   static uint64_t MinInt() { return 0; }
+   /// maximum integer that can be generated
+   static uint64_t MaxInt() { return UINT64_MAX; }
+   static uint64_t Max() { return UINT64_MAX; }
+   /// Size of the generator state in 32-bit words (key, stream and counter)
+   static int Size() { return 6; }
+   /// Name of the generator
+   static const char *Name() { return "Philox4x32-10"; }
+
+private:
+   void Block(uint64_t block, uint32_t out[4]) const { Block(fKey, fStream, block, out); }
+
+   /// Use the upper 53 bits and exclude both 0 and 1
+   static double ToDouble(uint64_t x) { return (double(x >> 11) + 0.5) * (1. / 9007199254740992.); }
+
+   uint32_t fKey[2];       ///< key, set from the seed
+   uint64_t fStream;       ///< stream number, the upper half of the Philox counter
+   uint64_t fIndex = 0;    ///< number of 64-bit words taken from the current stream
+   uint32_t fBuffer[4];    ///< last computed block, valid if fIndex is odd
+};
+
+} // end namespace Math
+} // end namespace ROOT
+
+#endif /* ROOT_Math_PhiloxEngine */
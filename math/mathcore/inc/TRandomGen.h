@@ -36,6 +36,7 @@
 //   * TRandomMixMax256 for the MixMaxEngine<256,2> (MIXMAX with state N=256 )
 //   * TRandomMT64 for the  StdEngine<std::mt19937_64> ( MersenneTwister 64 bits)
 //   * TRandomRanlux48 for the  StdEngine<std::ranlux48> (Ranlux 48 bits)
+//   * TRandomPhilox for the PhiloxEngine (counter-based, with streams)
 //
 //                                                                     //
 //////////////////////////////////////////////////////////////////////////
@@ -77,6 +78,7 @@ public:
 #include "Math/StdEngine.h"
 #include "Math/MixMaxEngine.h"
 #include "Math/RanluxppEngine.h"
+#include "Math/PhiloxEngine.h"
 
 // not working wight now for this classes
 //#define  DEFINE_TEMPL_INSTANCE
@@ -131,6 +133,27 @@ typedef TRandomGen<ROOT::Math::MixMaxEngine<256,2>> TRandomMixMax256;
 
 typedef TRandomGen<ROOT::Math::RanluxppEngine2048> TRandomRanluxpp;
 
+/**
+  @ingroup Random
+  Counter-based Philox4x32-10 generator, see ROOT::Math::PhiloxEngine.
+  Independent, reproducible streams for threads or tasks are obtained with
+  ~~~ {.cpp}
+  TRandomPhilox rng(seed, taskIndex);
+  ~~~
+ */
+class TRandomPhilox : public TRandomGen<ROOT::Math::PhiloxEngine> {
+public:
+   TRandomPhilox(ULong64_t seed = 4357, ULong64_t stream = 0) { fEngine = ROOT::Math::PhiloxEngine(seed, stream); }
+   /// Start the independent stream `stream` of the current seed
+   void SetStream(ULong64_t stream) { fEngine.SetStream(stream); }
+   /// Skip `n` random numbers without generating them
+   void Skip(ULong64_t n) { fEngine.Skip(n); }
+   using TRandomGen<ROOT::Math::PhiloxEngine>::RndmArray;
+   void RndmArray(Int_t n, Double_t *array) override { fEngine.RndmArray(n, array); }
+
+   ClassDefOverride(TRandomPhilox, 1) // Philox4x32-10 counter-based random number generator
+};
+
 /**
   @ingroup Random
   Generator based on a the Mersenne-Twister generator with 64 bits,
@@ -0,0 +1,177 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026  LCG ROOT Math Team, CERN/PH-SFT                *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Implementation file for class BatchFitter
+
+#include "Fit/BatchFitter.h"
+#include "Fit/Chi2FCN.h"
+#include "Fit/PoissonLikelihoodFCN.h"
+#include "Math/FitMethodFunction.h"
+#include "Math/Minimizer.h"
+#include "Math/MinimizerOptions.h"
+#include "Math/Error.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <atomic>
+
+namespace ROOT {
+
+namespace Fit {
+
+/// State of a worker, created once and reused for all its fits
+struct BatchFitter::Worker {
+   std::shared_ptr<IModelFunction> fFunc;             ///< clone of the model function
+   std::shared_ptr<ROOT::Math::Minimizer> fMinimizer; ///< minimizer
+   std::vector<ParameterSettings> fParams;            ///< parameter settings of the current fit
+   std::vector<double> fValues;                       ///< initial parameter values of the current fit
+};
+
+BatchFitter::BatchFitter(const IModelFunction &func)
+   : fFunc(dynamic_cast<IModelFunction *>(func.Clone()))
+{
+   fConfig.CreateParamsSettings(*fFunc);
+}
+
+BatchFitter::~BatchFitter() {}
+
+std::vector<FitResult>
+BatchFitter::LeastSquareFit(const std::vector<BinData> &data, ROOT::EExecutionPolicy executionPolicy,
+                            unsigned int nWorkers)
+{
+   return DoFit(data, false, false, executionPolicy, nWorkers);
+}
+
+std::vector<FitResult> BatchFitter::LikelihoodFit(const std::vector<BinData> &data, bool extended,
+                                                  ROOT::EExecutionPolicy executionPolicy, unsigned int nWorkers)
+{
+   return DoFit(data, true, extended, executionPolicy, nWorkers);
+}
+
+std::vector<FitResult> BatchFitter::DoFit(const std::vector<BinData> &data, bool likelihood, bool extended,
+                                          ROOT::EExecutionPolicy executionPolicy, unsigned int nWorkers)
+{
+   if (fConfig.NPar() != fFunc->NPar()) {
+      MATH_ERROR_MSG("BatchFitter::DoFit", "wrong size of the parameter settings in the FitConfig");
+      return {};
+   }
+   FitConfig config(fConfig);
+   // as in Fitter, use an error definition of 0.5 for likelihood fits unless it has been changed
+   if (likelihood && config.MinimizerOptions().ErrorDef() == ROOT::Math::MinimizerOptions::DefaultErrorDef())
+      config.MinimizerOptions().SetErrorDef(0.5);
+
+#ifndef R__USE_IMT
+   // If IMT is disabled, force the execution policy to the serial case
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      MATH_WARN_MSG("BatchFitter::DoFit", "Multithread execution policy requires IMT, which is disabled. "
+                                          "Changing to ROOT::EExecutionPolicy::kSequential.");
+      executionPolicy = ROOT::EExecutionPolicy::kSequential;
+   }
+#endif
+   if (executionPolicy != ROOT::EExecutionPolicy::kSequential &&
+       executionPolicy != ROOT::EExecutionPolicy::kMultiThread) {
+      MATH_ERROR_MSG("BatchFitter::DoFit", "Execution policy unknown. Available choices:\n "
+                                           "ROOT::EExecutionPolicy::kSequential (default)\n "
+                                           "ROOT::EExecutionPolicy::kMultiThread (requires IMT)\n");
+      return {};
+   }
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential)
+      nWorkers = 1;
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> pool;
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      pool = std::make_unique<ROOT::TThreadExecutor>();
+      if (nWorkers == 0)
+         nWorkers = pool->GetPoolSize();
+   }
+#endif
+   nWorkers = std::max(1u, std::min<unsigned int>(nWorkers, data.size()));
+
+   // the minimizers are created beforehand, since their creation (through the plugin manager) is not thread safe
+   std::vector<Worker> workers(nWorkers);
+   for (auto &worker : workers) {
+      worker.fFunc.reset(dynamic_cast<IModelFunction *>(fFunc->Clone()));
+      worker.fMinimizer.reset(config.CreateMinimizer());
+      if (!worker.fMinimizer) {
+         MATH_ERROR_MSG("BatchFitter::DoFit", "Minimizer cannot be created");
+         return {};
+      }
+      if (config.ParabErrors())
+         worker.fMinimizer->SetValidError(true);
+      worker.fParams = config.ParamsSettings();
+      worker.fValues.resize(config.NPar());
+   }
+
+   std::vector<FitResult> results(data.size());
+   std::atomic<unsigned int> next{0};
+   auto work = [&](unsigned int iworker) {
+      for (unsigned int i = next++; i < data.size(); i = next++)
+         DoFit(workers[iworker], config, i, data[i], likelihood, extended, results[i]);
+   };
+#ifdef R__USE_IMT
+   if (pool) {
+      pool->Foreach(work, ROOT::TSeq<unsigned int>(0, nWorkers));
+      return results;
+   }
+#endif
+   work(0);
+   return results;
+}
+
+void BatchFitter::DoFit(Worker &worker, const FitConfig &config, unsigned int i, const BinData &data,
+                        bool likelihood, bool extended, FitResult &result) const
+{
+   const unsigned int npar = config.NPar();
+   for (unsigned int ipar = 0; ipar < npar; ++ipar)
+      worker.fValues[ipar] = config.ParSettings(ipar).Value();
+   if (fParamInit)
+      fParamInit(i, data, worker.fValues.data());
+   for (unsigned int ipar = 0; ipar < npar; ++ipar)
+      worker.fParams[ipar].SetValue(worker.fValues[ipar]);
+
+   // the objective functions refer to the data set without copying it
+   std::shared_ptr<BinData> dataPtr(std::shared_ptr<BinData>(), const_cast<BinData *>(&data));
+   std::unique_ptr<ROOT::Math::FitMethodFunction> fcn;
+   if (likelihood)
+      fcn = std::make_unique<PoissonLLFunction>(dataPtr, worker.fFunc, 0, extended);
+   else
+      fcn = std::make_unique<Chi2Function>(dataPtr, worker.fFunc);
+
+   ROOT::Math::Minimizer &minimizer = *worker.fMinimizer;
+   minimizer.Clear();
+   minimizer.SetFunction(*fcn);
+   minimizer.SetVariables(worker.fParams.begin(), worker.fParams.end());
+   const bool isValid = minimizer.Minimize();
+
+   result.FillResult(worker.fMinimizer, config, nullptr, isValid, data.Size(), fcn->Type(), nullptr, fcn->NCalls());
+   if (isValid && config.MinosErrors()) {
+      std::vector<unsigned int> ipars = config.MinosParams();
+      if (ipars.empty()) {
+         for (unsigned int ipar = 0; ipar < npar; ++ipar)
+            ipars.push_back(ipar);
+      }
+      for (unsigned int ipar : ipars) {
+         double elow = 0;
+         double eup = 0;
+         if (!config.ParSettings(ipar).IsFixed() && minimizer.GetMinosError(ipar, elow, eup))
+            result.SetMinosError(ipar, elow, eup);
+      }
+   }
+   if (config.NormalizeErrors() && !likelihood)
+      result.NormalizeErrors();
+   // the minimizer is reused for the next fits
+   result.fMinimizer.reset();
+}
+
+} // end namespace Fit
+
+} // end namespace ROOT
@@ -213,6 +213,70 @@ namespace ROOT {
             }
          }
 
+         // number of points for which the model function is evaluated at once by MapReducePoints
+         constexpr unsigned int kEvalBatchSize = 256;
+
+         // evaluation of the map-reduce of the fit method functions (chi2, likelihood) when the model function
+         // is evaluated at the coordinates of the points: the function values are computed calling
+         // IModelFunction::EvalParBatch for batches of points (copying the coordinates point by point for
+         // multi-dim data), then mapPoint(i, fval) gives the contribution of the point i
+         template <class T, class Data, class MapPoint>
+         T MapReducePoints(const IModelFunction &func, const Data &data, const double *p, const MapPoint &mapPoint,
+                           ::ROOT::EExecutionPolicy executionPolicy, unsigned nChunks)
+         {
+            const unsigned int n = data.Size();
+            const unsigned int ndim = data.NDim();
+            const unsigned int nBatches = (n + kEvalBatchSize - 1) / kEvalBatchSize;
+#ifdef USE_PARAMCACHE
+            // the function parameters have been set before
+            p = func.Parameters();
+#endif
+
+            auto mapBatch = [&](const unsigned ibatch) {
+               const unsigned int begin = ibatch * kEvalBatchSize;
+               const unsigned int size = std::min(kEvalBatchSize, n - begin);
+               double fval[kEvalBatchSize];
+               if (ndim == 1) {
+                  func.EvalParBatch(size, data.GetCoordComponent(begin, 0), p, fval);
+               } else {
+                  std::vector<double> x(size * ndim);
+                  for (unsigned int j = 0; j < ndim; ++j) {
+                     const double *xj = data.GetCoordComponent(begin, j);
+                     for (unsigned int i = 0; i < size; ++i)
+                        x[i * ndim + j] = xj[i];
+                  }
+                  func.EvalParBatch(size, x.data(), p, fval);
+               }
+               T res{};
+               for (unsigned int i = 0; i < size; ++i)
+                  res += mapPoint(begin + i, fval[i]);
+               return res;
+            };
+
+            T res{};
+#ifdef R__USE_IMT
+            if (executionPolicy == ::ROOT::EExecutionPolicy::kMultiThread && nBatches > 0) {
+               // do not use std::accumulate to be sure to maintain always the same order
+               auto redFunction = [](const std::vector<T> &objs) {
+                  T sum{};
+                  for (auto &obj : objs)
+                     sum += obj;
+                  return sum;
+               };
+               ROOT::TThreadExecutor pool;
+               auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(n);
+               return pool.MapReduce(mapBatch, ROOT::TSeq<unsigned>(0, nBatches), redFunction,
+                                     std::min(chunks, nBatches));
+            }
+#else
+            (void)executionPolicy;
+            (void)nChunks;
+#endif
+            for (unsigned int ibatch = 0; ibatch < nBatches; ++ibatch)
+               res += mapBatch(ibatch);
+            return res;
+         }
+
 
 
       } // end namespace  FitUtil
@@ -276,17 +340,66 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
-   auto mapFunction = [&](const unsigned i){
+   // contribution to the chi2 of the point i given the function value fval
+   auto pointChi2 = [&](const unsigned i, const double fval) {
 
       double chi2{};
-      double fval{};
 
-      const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
       auto invError = data.InvError(i);
 
       //invError = (invError!= 0.0) ? 1.0/invError :1;
 
+      // expected errors
+      if (useExpErrors) {
+         double invWeight  = 1.0;
+         // case of weighted Pearson chi2 fit
+         if (isWeighted) {
+            // in case of requested a weighted Pearson fit (option "PW") a weight factor needs to be applied
+            // the bin inverse weight is estimated from bin error and bin content
+            if (y != 0)
+               invWeight = y * invError * invError;
+            else
+               // when y is 0 we use a global weight estimated form all histogram (correct if scaling the histogram)
+               // note that if the data is weighted data.SumOfError2 will not be equal to zero
+               invWeight = data.SumOfContent()/ data.SumOfError2();
+         }
+         // compute expected error  as f(x) or f(x) / weight (if weighted fit)
+         double invError2 = (fval > 0) ? invWeight / fval : 0.0;
+         invError = std::sqrt(invError2);
+         //std::cout << "using Pearson chi2 " << i << "  " << 1./invError2 << "  " << fval << std::endl;
+      }
+
+#ifdef DEBUG
+      std::cout << i << "  " << y << "  " << 1./invError << " params : ";
+      for (unsigned int ipar = 0; ipar < func.NPar(); ++ipar)
+         std::cout << p[ipar] << "\t";
+      std::cout << "\tfval = " << fval << std::endl;
+#endif
+
+      if (invError > 0) {
+
+         double tmp = ( y -fval )* invError;
+         double resval = tmp * tmp;
+
+
+         // avoid infinity or nan in chi2 values due to wrong function values
+         if ( resval < maxResValue )
+            chi2 += resval;
+         else {
+            //nRejected++;
+            chi2 += maxResValue;
+         }
+      }
+      return chi2;
+   };
+
+   auto mapFunction = [&](const unsigned i){
+
+      double fval{};
+
+      const auto x1 = data.GetCoordComponent(i, 0);
+
       const double * x = nullptr;
       std::vector<double> xc;
       double binVolume = 1.0;
@@ -334,48 +447,7 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       // we need to multiply by the bin volume (e.g. for variable bins histograms)
       if (useBinVolume) fval *= binVolume;
 
-      // expected errors
-      if (useExpErrors) {
-         double invWeight  = 1.0;
-         // case of weighted Pearson chi2 fit
-         if (isWeighted) {
-            // in case of requested a weighted Pearson fit (option "PW") a weight factor needs to be applied
-            // the bin inverse weight is estimated from bin error and bin content
-            if (y != 0)
-               invWeight = y * invError * invError;
-            else
-               // when y is 0 we use a global weight estimated form all histogram (correct if scaling the histogram)
-               // note that if the data is weighted data.SumOfError2 will not be equal to zero
-               invWeight = data.SumOfContent()/ data.SumOfError2();
-         }
-         // compute expected error  as f(x) or f(x) / weight (if weighted fit)
-         double invError2 = (fval > 0) ? invWeight / fval : 0.0;
-         invError = std::sqrt(invError2);
-         //std::cout << "using Pearson chi2 " << x[0] << "  " << 1./invError2 << "  " << fval << std::endl;
-      }
-
-#ifdef DEBUG
-      std::cout << x[0] << "  " << y << "  " << 1./invError << " params : ";
-      for (unsigned int ipar = 0; ipar < func.NPar(); ++ipar)
-         std::cout << p[ipar] << "\t";
-      std::cout << "\tfval = " << fval << " bin volume " << binVolume << " ref " << wrefVolume << std::endl;
-#endif
-
-      if (invError > 0) {
-
-         double tmp = ( y -fval )* invError;
-         double resval = tmp * tmp;
-
-
-         // avoid infinity or nan in chi2 values due to wrong function values
-         if ( resval < maxResValue )
-            chi2 += resval;
-         else {
-            //nRejected++;
-            chi2 += maxResValue;
-         }
-      }
-      return chi2;
+      return pointChi2(i, fval);
   };
 
 #ifdef R__USE_IMT
@@ -394,7 +466,10 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 #endif
 
   double res{};
-  if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
+  if (executionPolicy != ROOT::EExecutionPolicy::kMultiProcess && !useBinIntegral && !useBinVolume) {
+    // the function is evaluated at the bin coordinates, which can be done for many bins at once
+    res = MapReducePoints<double>(func, data, p, pointChi2, executionPolicy, nChunks);
+  } else if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
     for (unsigned int i=0; i<n; ++i) {
       res += mapFunction(i);
     }
@@ -1000,30 +1075,10 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
 
          // needed to compute effective global weight in case of extended likelihood
 
-         auto mapFunction = [&](const unsigned i) {
+         // contribution to the likelihood of the point i given the function value fval
+         auto pointLogL = [&](const unsigned i, double fval) {
             double W = 0;
             double W2 = 0;
-            double fval = 0;
-
-            if (data.NDim() > 1) {
-               std::vector<double> x(data.NDim());
-               for (unsigned int j = 0; j < data.NDim(); ++j)
-                  x[j] = *data.GetCoordComponent(i, j);
-#ifdef USE_PARAMCACHE
-               fval = func(x.data());
-#else
-               fval = func(x.data(), p);
-#endif
-
-               // one -dim case
-            } else {
-               const auto x = data.GetCoordComponent(i, 0);
-#ifdef USE_PARAMCACHE
-               fval = func(x);
-#else
-               fval = func(x, p);
-#endif
-            }
 
             if (normalizeFunc)
                fval = fval * (1 / norm);
@@ -1045,22 +1100,7 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
             return LikelihoodAux<double>(logval, W, W2);
          };
 
-#ifdef R__USE_IMT
-  // auto redFunction = [](const std::vector<LikelihoodAux<double>> & objs){
-  //          return std::accumulate(objs.begin(), objs.end(), LikelihoodAux<double>(0.0,0.0,0.0),
-  //                      [](const LikelihoodAux<double> &l1, const LikelihoodAux<double> &l2){
-  //                          return l1+l2;
-  //                 });
-  // };
-  // do not use std::accumulate to be sure to maintain always the same order
-  auto redFunction = [](const std::vector<LikelihoodAux<double>> & objs){
-     auto l0 =  LikelihoodAux<double>(0.0,0.0,0.0);
-     for ( auto & l : objs ) {
-        l0 = l0 + l;
-     }
-     return l0;
-  };
-#else
+#ifndef R__USE_IMT
   (void)nChunks;
 
   // If IMT is disabled, force the execution policy to the serial case
@@ -1074,22 +1114,13 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
   double logl{};
   double sumW{};
   double sumW2{};
-  if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
-    for (unsigned int i=0; i<n; ++i) {
-      auto resArray = mapFunction(i);
-      logl+=resArray.logvalue;
-      sumW+=resArray.weight;
-      sumW2+=resArray.weight2;
-    }
-#ifdef R__USE_IMT
-  } else if(executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-    ROOT::TThreadExecutor pool;
-    auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    auto resArray = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+  if (executionPolicy == ROOT::EExecutionPolicy::kSequential ||
+      executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+    // the function values are computed for many points at once
+    auto resArray = MapReducePoints<LikelihoodAux<double>>(func, data, p, pointLogL, executionPolicy, nChunks);
     logl=resArray.logvalue;
     sumW=resArray.weight;
     sumW2=resArray.weight2;
-#endif
 //   } else if(executionPolicy == ROOT::Fit::kMultiProcess){
     // ROOT::TProcessExecutor pool;
     // res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
@@ -1493,9 +1524,59 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
    IntegralEvaluator<> igEval(func, p, useBinIntegral, igType);
 #endif
 
+   // contribution to the negative log likelihood of the point i given the function value fval
+   auto pointNLogL = [&](const unsigned i, double fval) {
+      auto y = *data.ValuePtr(i);
+
+      // EvalLog protects against 0 values of fval but don't want to add in the -log sum
+      // negative values of fval
+      fval = std::max(fval, 0.0);
+
+      double nloglike = 0; // negative loglikelihood
+      if (useW2) {
+         // apply weight correction . Effective weight is error^2/ y
+         // and expected events in bins is fval/weight
+         // can apply correction only when y is not zero otherwise weight is undefined
+         // (in case of weighted likelihood I don't care about the constant term due to
+         // the saturated model)
+
+         // use for the empty bins the global weight
+         double weight = 1.0;
+         if (y != 0) {
+            double error = data.Error(i);
+            weight = (error * error) / y; // this is the bin effective weight
+            nloglike -= weight * y * ( ROOT::Math::Util::EvalLog(fval/y) );
+         }
+         else {
+            // for empty bin use the average weight  computed from the total data weight
+            weight = data.SumOfError2()/ data.SumOfContent();
+         }
+         if (extended) {
+            nloglike += weight  *  ( fval - y);
+         }
+
+      } else {
+         // standard case no weights or iWeight=1
+         // this is needed for Poisson likelihood (which are extended and not for multinomial)
+         // the formula below  include constant term due to likelihood of saturated model (f(x) = y)
+         // (same formula as in Baker-Cousins paper, page 439 except a factor of 2
+         if (extended) nloglike = fval - y;
+
+         if (y >  0) {
+            nloglike += y * (ROOT::Math::Util::EvalLog(y) - ROOT::Math::Util::EvalLog(fval));
+         }
+      }
+#ifdef DEBUG
+      {
+         R__LOCKGUARD(gROOTMutex);
+         std::cout << " nll = " << nloglike << std::endl;
+      }
+#endif
+      return nloglike;
+   };
+
    auto mapFunction = [&](const unsigned i) {
       auto x1 = data.GetCoordComponent(i, 0);
-      auto y = *data.ValuePtr(i);
 
       const double *x = nullptr;
       std::vector<double> xc;
@@ -1553,56 +1634,12 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
             for (unsigned int j = 0; j < func.NDim(); ++j) std::cout << data.GetBinUpEdgeComponent(i, j) << " , ";
             std::cout << "] ";
          }
-         std::cout << "  y = " << y << " fval = " << fval << std::endl;
+         std::cout << "  y = " << *data.ValuePtr(i) << " fval = " << fval << std::endl;
       }
 #endif
 
 
-      // EvalLog protects against 0 values of fval but don't want to add in the -log sum
-      // negative values of fval
-      fval = std::max(fval, 0.0);
-
-      double nloglike = 0; // negative loglikelihood
-      if (useW2) {
-         // apply weight correction . Effective weight is error^2/ y
-         // and expected events in bins is fval/weight
-         // can apply correction only when y is not zero otherwise weight is undefined
-         // (in case of weighted likelihood I don't care about the constant term due to
-         // the saturated model)
-
-         // use for the empty bins the global weight
-         double weight = 1.0;
-         if (y != 0) {
-            double error = data.Error(i);
-            weight = (error * error) / y; // this is the bin effective weight
-            nloglike -= weight * y * ( ROOT::Math::Util::EvalLog(fval/y) );
-         }
-         else {
-            // for empty bin use the average weight  computed from the total data weight
-            weight = data.SumOfError2()/ data.SumOfContent();
-         }
-         if (extended) {
-            nloglike += weight  *  ( fval - y);
-         }
-
-      } else {
-         // standard case no weights or iWeight=1
-         // this is needed for Poisson likelihood (which are extended and not for multinomial)
-         // the formula below  include constant term due to likelihood of saturated model (f(x) = y)
-         // (same formula as in Baker-Cousins paper, page 439 except a factor of 2
-         if (extended) nloglike = fval - y;
-
-         if (y >  0) {
-            nloglike += y * (ROOT::Math::Util::EvalLog(y) - ROOT::Math::Util::EvalLog(fval));
-         }
-      }
-#ifdef DEBUG
-      {
-         R__LOCKGUARD(gROOTMutex);
-         std::cout << " nll = " << nloglike << std::endl;
-      }
-#endif
-      return nloglike;
+      return pointNLogL(i, fval);
    };
 
 #ifdef R__USE_IMT
@@ -1621,7 +1658,10 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
 #endif
 
    double res{};
-   if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
+   if (executionPolicy != ROOT::EExecutionPolicy::kMultiProcess && !useBinIntegral && !useBinVolume) {
+      // the function is evaluated at the bin coordinates, which can be done for many bins at once
+      res = MapReducePoints<double>(func, data, p, pointNLogL, executionPolicy, nChunks);
+   } else if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
       for (unsigned int i = 0; i < n; ++i) {
          res += mapFunction(i);
       }
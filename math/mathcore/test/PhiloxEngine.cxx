@@ -0,0 +1,118 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "Math/PhiloxEngine.h"
+#include "TRandomGen.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace ROOT::Math;
+
+namespace {
+void CheckBlock(const uint32_t in[4], const uint32_t key[2], const uint32_t expected[4])
+{
+   uint32_t out[4];
+   const uint64_t block = (uint64_t(in[1]) << 32) | in[0];
+   const uint64_t stream = (uint64_t(in[3]) << 32) | in[2];
+   PhiloxEngine::Block(key, stream, block, out);
+   for (int i = 0; i < 4; ++i)
+      EXPECT_EQ(out[i], expected[i]);
+}
+} // namespace
+
+TEST(PhiloxEngine, KnownAnswers)
+{
+   // Test vectors of the Random123 library for philox4x32, 10 rounds
+   {
+      const uint32_t in[4] = {0, 0, 0, 0}, key[2] = {0, 0};
+      const uint32_t out[4] = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+      CheckBlock(in, key, out);
+   }
+   {
+      const uint32_t in[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, key[2] = {0xffffffff, 0xffffffff};
+      const uint32_t out[4] = {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd};
+      CheckBlock(in, key, out);
+   }
+   {
+      const uint32_t in[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, key[2] = {0xa4093822, 0x299f31d0};
+      const uint32_t out[4] = {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1};
+      CheckBlock(in, key, out);
+   }
+}
+
+TEST(PhiloxEngine, Skip)
+{
+   PhiloxEngine rng(42, 3);
+   std::vector<double> ref(20);
+   for (auto &x : ref)
+      x = rng();
+
+   for (unsigned int n = 0; n < ref.size(); ++n) {
+      PhiloxEngine skipped(42, 3);
+      skipped.Skip(n);
+      EXPECT_EQ(skipped(), ref[n]);
+   }
+
+   // skipping within the current block
+   PhiloxEngine partial(42, 3);
+   partial();
+   partial.Skip(2);
+   EXPECT_EQ(partial(), ref[3]);
+   EXPECT_EQ(partial.Counter(), 4u);
+}
+
+TEST(PhiloxEngine, RndmArray)
+{
+   PhiloxEngine ref(123);
+   PhiloxEngine rng(123);
+   std::vector<double> array(17);
+   // odd sizes, to start and end in the middle of a block
+   rng.RndmArray(1, array.data());
+   rng.RndmArray(8, array.data() + 1);
+   rng.RndmArray(8, array.data() + 9);
+   for (auto x : array) {
+      EXPECT_EQ(x, ref());
+      EXPECT_GT(x, 0.);
+      EXPECT_LT(x, 1.);
+   }
+   EXPECT_EQ(rng(), ref());
+}
+
+TEST(PhiloxEngine, Streams)
+{
+   PhiloxEngine a(7, 0), b(7, 1), c(8, 0);
+   const double xa = a(), xb = b(), xc = c();
+   EXPECT_NE(xa, xb);
+   EXPECT_NE(xa, xc);
+
+   // restarting a stream reproduces it
+   b.SetStream(0);
+   EXPECT_EQ(b(), xa);
+   a.SetSeed(8);
+   EXPECT_EQ(a(), xc);
+}
+
+TEST(TRandomPhilox, Streams)
+{
+   TRandomPhilox rng(7, 5);
+   PhiloxEngine engine(7, 5);
+   EXPECT_EQ(rng.Rndm(), engine());
+
+   double array[5];
+   rng.RndmArray(5, array);
+   for (auto x : array)
+      EXPECT_EQ(x, engine());
+
+   rng.SetStream(2);
+   engine.SetStream(2);
+   rng.Skip(10);
+   engine.Skip(10);
+   EXPECT_EQ(rng.Rndm(), engine());
+}
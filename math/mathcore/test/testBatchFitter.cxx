@@ -0,0 +1,107 @@
+// Tests for ROOT::Fit::BatchFitter
+
+#include "RConfigure.h"
+#include "Fit/BatchFitter.h"
+#include "Fit/BinData.h"
+#include "Fit/Fitter.h"
+#include "HFitInterface.h"
+#include "Math/WrappedMultiTF1.h"
+#include "TF1.h"
+#include "TH1.h"
+#include "TRandom3.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+class BatchFitterTest : public ::testing::Test {
+protected:
+   void SetUp() override
+   {
+      TRandom3 rndm(17);
+      for (int i = 0; i < kNFits; ++i) {
+         TH1D h("h", "h", 50, -5, 5);
+         h.SetDirectory(nullptr);
+         for (int j = 0; j < 1000; ++j)
+            h.Fill(rndm.Gaus(-2. + 0.2 * i, 0.5 + 0.01 * i));
+         fData.emplace_back();
+         ROOT::Fit::FillData(fData.back(), &h);
+      }
+      fFunc.reset(new TF1("gausModel", "gaus", -5, 5));
+      fModel.reset(new ROOT::Math::WrappedMultiTF1(*fFunc, 1));
+      // each worker needs its own TF1
+      fModel->SetAndCopyFunction();
+   }
+
+   /// Initial parameter values from the data: maximum, mean and standard deviation
+   static void InitGaus(unsigned int, const ROOT::Fit::BinData &data, double *p)
+   {
+      double sumw = 0, sumwx = 0, sumwx2 = 0, max = 0;
+      for (unsigned int i = 0; i < data.Size(); ++i) {
+         const double x = *data.GetCoordComponent(i, 0);
+         const double w = data.Value(i);
+         sumw += w;
+         sumwx += w * x;
+         sumwx2 += w * x * x;
+         max = std::max(max, w);
+      }
+      p[0] = max;
+      p[1] = sumwx / sumw;
+      p[2] = std::sqrt(sumwx2 / sumw - p[1] * p[1]);
+   }
+
+   static constexpr int kNFits = 20;
+   std::vector<ROOT::Fit::BinData> fData;
+   std::unique_ptr<TF1> fFunc;
+   std::unique_ptr<ROOT::Math::WrappedMultiTF1> fModel;
+};
+
+// The batch fits give the same results as a Fitter for each data set
+TEST_F(BatchFitterTest, SameAsFitter)
+{
+   ROOT::Fit::BatchFitter batchFitter(*fModel);
+   batchFitter.SetParameterInitializer(InitGaus);
+   for (bool likelihood : {false, true}) {
+      auto results = likelihood ? batchFitter.LikelihoodFit(fData) : batchFitter.LeastSquareFit(fData);
+      ASSERT_EQ(results.size(), fData.size());
+      for (int i = 0; i < kNFits; ++i) {
+         ROOT::Fit::Fitter fitter;
+         fitter.SetFunction(*fModel, false);
+         double p[3];
+         InitGaus(i, fData[i], p);
+         fitter.Config().SetParamsSettings(batchFitter.Config().ParamsSettings());
+         for (unsigned int ipar = 0; ipar < 3; ++ipar)
+            fitter.Config().ParSettings(ipar).SetValue(p[ipar]);
+         ASSERT_TRUE(likelihood ? fitter.LikelihoodFit(fData[i]) : fitter.LeastSquareFit(fData[i]));
+         const auto &expected = fitter.Result();
+
+         EXPECT_TRUE(results[i].IsValid());
+         EXPECT_NEAR(results[i].MinFcnValue(), expected.MinFcnValue(), 1.E-6 * std::abs(expected.MinFcnValue()));
+         EXPECT_EQ(results[i].Ndf(), expected.Ndf());
+         EXPECT_NEAR(results[i].Chi2(), expected.Chi2(), 1.E-6 * expected.Chi2());
+         for (unsigned int ipar = 0; ipar < 3; ++ipar) {
+            EXPECT_NEAR(results[i].Parameter(ipar), expected.Parameter(ipar), 1.E-3 * expected.Error(ipar));
+            EXPECT_NEAR(results[i].Error(ipar), expected.Error(ipar), 1.E-3 * expected.Error(ipar));
+         }
+      }
+   }
+}
+
+#ifdef R__USE_IMT
+// The parallel fits give the same results as the sequential ones
+TEST_F(BatchFitterTest, MultiThread)
+{
+   ROOT::Fit::BatchFitter batchFitter(*fModel);
+   batchFitter.SetParameterInitializer(InitGaus);
+   auto expected = batchFitter.LeastSquareFit(fData);
+   auto results = batchFitter.LeastSquareFit(fData, ROOT::EExecutionPolicy::kMultiThread, 4);
+   ASSERT_EQ(results.size(), expected.size());
+   for (int i = 0; i < kNFits; ++i) {
+      EXPECT_EQ(results[i].MinFcnValue(), expected[i].MinFcnValue());
+      for (unsigned int ipar = 0; ipar < 3; ++ipar)
+         EXPECT_EQ(results[i].Parameter(ipar), expected[i].Parameter(ipar));
+   }
+}
+#endif
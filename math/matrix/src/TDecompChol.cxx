@@ -133,11 +133,12 @@ Bool_t TDecompChol::Decompose()
       const Double_t inv_ujj = 1.0 / ujj;
 
       if (icol < n-1) {
-         for (j = icol+1; j < n; j++) {
-            for (i = 0; i < icol; i++) {
-               const Int_t rowOff2 = i*n;
-               pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
-            }
+         // Row-wise updates, so that the inner loop runs over contiguous memory
+         for (i = 0; i < icol; i++) {
+            const Int_t rowOff2 = i*n;
+            const Double_t u_i_icol = pU[rowOff2+icol];
+            for (j = icol+1; j < n; j++)
+               pU[rowOff+j] -= pU[rowOff2+j]*u_i_icol;
          }
          for (j = icol+1; j < n; j++)
 	    pU[rowOff + j] *= inv_ujj;
@@ -12,6 +12,8 @@
 #include "TDecompLU.h"
 #include "TMath.h"
 
+#include <vector>
+
 ClassImp(TDecompLU);
 
 /** \class TDecompLU
@@ -624,17 +626,22 @@ Bool_t TDecompLU::DecomposeLUCrout(TMatrixD &lu,Int_t *index,Double_t &sign,
       scale[i] = (max == 0.0 ? 0.0 : 1.0/max);
    }
 
+   // Column j is processed in a contiguous copy, so that the inner products
+   // below run over contiguous memory instead of striding down the column.
+   std::vector<Double_t> col(n);
+
    for (Int_t j = 0; j < n; j++) {
       const Int_t off_j = j*n;
+      for (Int_t i = 0; i < n; i++)
+         col[i] = pLU[i*n+j];
+
       // Run down jth column from top to diag, to form the elements of U.
       for (Int_t i = 0; i < j; i++) {
          const Int_t off_i = i*n;
-         Double_t r = pLU[off_i+j];
-         for (Int_t k = 0; k < i; k++) {
-            const Int_t off_k = k*n;
-            r -= pLU[off_i+k]*pLU[off_k+j];
-         }
-         pLU[off_i+j] = r;
+         Double_t r = col[i];
+         for (Int_t k = 0; k < i; k++)
+            r -= pLU[off_i+k]*col[k];
+         col[i] = r;
       }
 
       // Run down jth subdiag to form the residuals after the elimination of
@@ -646,18 +653,18 @@ Bool_t TDecompLU::DecomposeLUCrout(TMatrixD &lu,Int_t *index,Double_t &sign,
       Int_t imax = 0;
       for (Int_t i = j; i < n; i++) {
          const Int_t off_i = i*n;
-         Double_t r = pLU[off_i+j];
-         for (Int_t k = 0; k < j; k++) {
-            const Int_t off_k = k*n;
-            r -= pLU[off_i+k]*pLU[off_k+j];
-         }
-         pLU[off_i+j] = r;
+         Double_t r = col[i];
+         for (Int_t k = 0; k < j; k++)
+            r -= pLU[off_i+k]*col[k];
+         col[i] = r;
          const Double_t tmp = scale[i]*TMath::Abs(r);
          if (tmp >= max) {
             max = tmp;
             imax = i;
          }
       }
+      for (Int_t i = 0; i < n; i++)
+         pLU[i*n+j] = col[i];
 
       // Permute current row with imax
       if (j != imax) {
@@ -20,7 +20,9 @@ See the \ref Matrix page for the documentation of the linear algebra package
 
 */
 
+#include <algorithm>
 #include <typeinfo>
+#include <vector>
 
 #include "TMatrixT.h"
 #include "TBuffer.h"
@@ -31,6 +33,12 @@ See the \ref Matrix page for the documentation of the linear algebra package
 #include "TMatrixDEigen.h"
 #include "TMath.h"
 
+#include "RConfigure.h" // R__USE_IMT
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h" // IsImplicitMTEnabled
+#endif
+
 templateClassImp(TMatrixT);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3074,74 +3082,136 @@ TMatrixT<Element> &TMatrixTAutoloadOps::ElementDiv(TMatrixT<Element> &target, co
    return target;
 }
 
+namespace {
+
+// Blocking of the multiplication kernels: a kBlockK x kBlockN panel of B (256 kB
+// in double precision) stays in the L2 cache while it is applied to the rows of A.
+constexpr Int_t kBlockK = 128;
+constexpr Int_t kBlockN = 256;
+
+// Products with fewer multiply-adds than this are not worth multi-threading;
+// larger ones are split in blocks of kParallelRows rows of the result.
+constexpr Long64_t kMinParallelFlops = 1 << 24;
+constexpr Int_t kParallelRows = 32;
+
 ////////////////////////////////////////////////////////////////////////////////
-/// Elementary routine to calculate matrix multiplication A*B
+/// Run f(rowBegin, rowEnd) on all nrows rows of a product, in parallel if implicit
+/// multi-threading is enabled and the product is large enough.
+
+template <class F>
+void ForEachRowBlock(Int_t nrows, Long64_t nFlops, F &&f)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nFlops >= kMinParallelFlops && nrows > kParallelRows) {
+      std::vector<Int_t> rowBegins;
+      for (Int_t i = 0; i < nrows; i += kParallelRows)
+         rowBegins.push_back(i);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t rowBegin) { f(rowBegin, std::min(rowBegin + kParallelRows, nrows)); }, rowBegins);
+      return;
+   }
+#else
+   (void)nFlops;
+#endif
+   f(0, nrows);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rows [rowBegin, rowEnd) of C = op(A) * B, with B of size nk x ncolsb. The
+/// element (i,k) of op(A) is at ap[i * strideRow + k * strideK].
+/// The innermost loop runs over contiguous rows of B and C, so that it can be
+/// vectorized; the sum over k is carried out in increasing order as in the
+/// naive algorithm.
 
 template <class Element>
-void TMatrixTAutoloadOps::AMultB(const Element *const ap, Int_t na, Int_t ncolsa, const Element *const bp, Int_t nb,
-                                 Int_t ncolsb, Element *cp)
+void MultRows(const Element *ap, Int_t strideRow, Int_t strideK, const Element *bp, Int_t nk, Int_t ncolsb,
+              Element *cp, Int_t rowBegin, Int_t rowEnd)
 {
-   const Element *arp0 = ap; // Pointer to  A[i,0];
-   while (arp0 < ap + na) {
-      for (const Element *bcp = bp; bcp < bp + ncolsb;) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
-         Element cij = 0;
-         while (bcp < bp + nb) {  // Scan the i-th row of A and
-            cij += *arp++ * *bcp; // the j-th col of B
-            bcp += ncolsb;
+   std::fill(cp + rowBegin * ncolsb, cp + rowEnd * ncolsb, Element(0));
+   for (Int_t k0 = 0; k0 < nk; k0 += kBlockK) {
+      const Int_t k1 = std::min(k0 + kBlockK, nk);
+      for (Int_t j0 = 0; j0 < ncolsb; j0 += kBlockN) {
+         const Int_t j1 = std::min(j0 + kBlockN, ncolsb);
+         for (Int_t i = rowBegin; i < rowEnd; ++i) {
+            const Element *aip = ap + i * strideRow;
+            Element *crp = cp + i * ncolsb;
+            for (Int_t k = k0; k < k1; ++k) {
+               const Element aik = aip[k * strideK];
+               const Element *brp = bp + k * ncolsb;
+               for (Int_t j = j0; j < j1; ++j)
+                  crp[j] += aik * brp[j];
+            }
          }
-         *cp++ = cij;
-         bcp -= nb - 1; // Set bcp to the (j+1)-th col
       }
-      arp0 += ncolsa; // Set ap to the (i+1)-th row
    }
 }
 
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Elementary routine to calculate matrix multiplication A*B
+///
+/// The product is computed in cache-sized blocks and, for large matrices with
+/// implicit multi-threading enabled, in parallel over blocks of rows.
+
+template <class Element>
+void TMatrixTAutoloadOps::AMultB(const Element *const ap, Int_t na, Int_t ncolsa, const Element *const bp, Int_t nb,
+                                 Int_t ncolsb, Element *cp)
+{
+   if (ncolsa == 0 || ncolsb == 0)
+      return;
+   const Int_t nrowsa = na / ncolsa;
+   const Int_t nrowsb = nb / ncolsb;
+   ForEachRowBlock(nrowsa, Long64_t(nrowsa) * nrowsb * ncolsb, [&](Int_t rowBegin, Int_t rowEnd) {
+      MultRows(ap, ncolsa, 1, bp, nrowsb, ncolsb, cp, rowBegin, rowEnd);
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A^T*B
+///
+/// See AMultB() for the blocking and multi-threading.
 
 template <class Element>
 void TMatrixTAutoloadOps::AtMultB(const Element *const ap, Int_t ncolsa, const Element *const bp, Int_t nb,
                                   Int_t ncolsb, Element *cp)
 {
-   const Element *acp0 = ap; // Pointer to  A[i,0];
-   while (acp0 < ap + ncolsa) {
-      for (const Element *bcp = bp; bcp < bp + ncolsb;) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp + nb) { // Scan the i-th column of A and
-            cij += *acp * *bcp;  // the j-th col of B
-            acp += ncolsa;
-            bcp += ncolsb;
-         }
-         *cp++ = cij;
-         bcp -= nb - 1; // Set bcp to the (j+1)-th col
-      }
-      acp0++; // Set acp0 to the (i+1)-th col
-   }
+   if (ncolsb == 0)
+      return;
+   const Int_t nrowsb = nb / ncolsb;
+   ForEachRowBlock(ncolsa, Long64_t(ncolsa) * nrowsb * ncolsb, [&](Int_t rowBegin, Int_t rowEnd) {
+      MultRows(ap, 1, ncolsa, bp, nrowsb, ncolsb, cp, rowBegin, rowEnd);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B^T
+///
+/// Every element is a dot product of two contiguous rows; large products are
+/// computed in parallel over blocks of rows of A.
 
 template <class Element>
 void TMatrixTAutoloadOps::AMultBt(const Element *const ap, Int_t na, Int_t ncolsa, const Element *const bp, Int_t nb,
                                   Int_t ncolsb, Element *cp)
 {
-   const Element *arp0 = ap; // Pointer to  A[i,0];
-   while (arp0 < ap + na) {
-      const Element *brp0 = bp; // Pointer to  B[j,0];
-      while (brp0 < bp + nb) {
-         const Element *arp = arp0; // Pointer to the i-th row of A, reset to A[i,0]
-         const Element *brp = brp0; // Pointer to the j-th row of B, reset to B[j,0]
-         Element cij = 0;
-         while (brp < brp0 + ncolsb) // Scan the i-th row of A and
-            cij += *arp++ * *brp++;  // the j-th row of B
-         *cp++ = cij;
-         brp0 += ncolsb; // Set brp0 to the (j+1)-th row
+   if (ncolsa == 0)
+      return;
+   const Int_t nrowsa = na / ncolsa;
+   const Int_t nrowsb = ncolsb ? nb / ncolsb : 0;
+   ForEachRowBlock(nrowsa, Long64_t(nrowsa) * nrowsb * ncolsb, [&](Int_t rowBegin, Int_t rowEnd) {
+      for (Int_t i = rowBegin; i < rowEnd; ++i) {
+         const Element *arp0 = ap + i * ncolsa; // Pointer to A[i,0]
+         Element *crp = cp + i * nrowsb;
+         for (Int_t j = 0; j < nrowsb; ++j) {
+            const Element *arp = arp0;              // Pointer to the i-th row of A, reset to A[i,0]
+            const Element *brp = bp + j * ncolsb;   // Pointer to the j-th row of B
+            Element cij = 0;
+            for (Int_t k = 0; k < ncolsb; ++k)     // Scan the i-th row of A and
+               cij += *arp++ * *brp++;             // the j-th row of B
+            crp[j] = cij;
+         }
       }
-      arp0 += ncolsa; // Set arp0 to the (i+1)-th row
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
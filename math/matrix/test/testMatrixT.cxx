@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <iostream>
 
 double tol = std::numeric_limits<double>::epsilon() * 100;
@@ -217,3 +218,36 @@ TEST_F(testMatrixD, Eigen)
 
    CompareTMatrix(B, C);
 }
+
+// Products larger than the blocks of the multiplication kernels, with sizes that are not multiples of them
+TEST(testMatrixD, MultLarge)
+{
+   const Int_t m = 150, k = 300, n = 270;
+   TMatrixD A(m, k), B(k, n);
+   for (Int_t i = 0; i < m; i++)
+      for (Int_t j = 0; j < k; j++)
+         A(i, j) = std::sin(i + 0.5 * j);
+   for (Int_t i = 0; i < k; i++)
+      for (Int_t j = 0; j < n; j++)
+         B(i, j) = std::cos(0.3 * i - j);
+
+   TMatrixD expected(m, n);
+   for (Int_t i = 0; i < m; i++)
+      for (Int_t j = 0; j < n; j++) {
+         Double_t sum = 0;
+         for (Int_t l = 0; l < k; l++)
+            sum += A(i, l) * B(l, j);
+         expected(i, j) = sum;
+      }
+
+   const TMatrixD AB(A, TMatrixD::kMult, B);
+   const TMatrixD AtB(TMatrixD(TMatrixD::kTransposed, A), TMatrixD::kTransposeMult, B);
+   const TMatrixD ABt(A, TMatrixD::kMultTranspose, TMatrixD(TMatrixD::kTransposed, B));
+   for (Int_t i = 0; i < m; i++) {
+      for (Int_t j = 0; j < n; j++) {
+         EXPECT_NEAR(AB(i, j), expected(i, j), 1e-10) << "  at entry (" << i << "," << j << ")";
+         EXPECT_NEAR(AtB(i, j), expected(i, j), 1e-10) << "  at entry (" << i << "," << j << ")";
+         EXPECT_NEAR(ABt(i, j), expected(i, j), 1e-10) << "  at entry (" << i << "," << j << ")";
+      }
+   }
+}
@@ -43,9 +43,14 @@ public:
 
    void SetErrorDef(double up) override { fUp = up; }
 
+   bool IsThreadSafe() const override { return fThreadSafe; }
+   /// declare that the wrapped function can be evaluated concurrently
+   void SetThreadSafe(bool on) { fThreadSafe = on; }
+
 private:
    const Function &fFunc;
    double fUp;
+   bool fThreadSafe = false;
 };
 
 } // end namespace Minuit2
@@ -132,6 +132,12 @@ public:
    virtual bool HasHessian() const { return false; }
 
    virtual bool HasG2() const { return false; }
+
+   /// Return true if the function can be evaluated concurrently from several threads.
+   /// Minuit then computes the numerical derivatives in parallel when the strategy asks for more than
+   /// one thread (see MnStrategy::SetNumberOfThreads).
+   virtual bool IsThreadSafe() const { return false; }
+
 };
 
 } // namespace Minuit2
@@ -0,0 +1,45 @@
+// @(#)root/minuit2:$Id$
+// Authors: M. Winkler, F. James, L. Moneta, A. Zsenei   2003-2005
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_MnLinearAlgebra
+#define ROOT_Minuit2_MnLinearAlgebra
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+/**
+    Selects the backend of the linear algebra on the packed symmetric matrices of Minuit.
+    By default the operations are done by the translations of the Fortran BLAS routines
+    and of the F77 Minuit inversion and eigenvalue routines that come with Minuit.
+    When Minuit2 is built with the minuit2_blas option, the rank-1 updates, the
+    matrix-vector products, the dot products, the inversion and the eigenvalues can
+    instead be computed by the optimized BLAS and LAPACK libraries of the system
+    (dspr, dspmv, ddot, dsptrf/dsptri and dspev), which is much faster for fits with
+    hundreds of parameters. The backend can be switched at run time with SetUseBlas.
+ */
+
+class MnLinearAlgebra {
+
+public:
+   /// return true if Minuit2 was built with the BLAS/LAPACK backend
+   static bool HasBlas();
+
+   /// return true if the BLAS/LAPACK backend is used (default is true when it is available)
+   static bool UseBlas();
+
+   /// select the BLAS/LAPACK backend; returns false, and does nothing, if it is not available
+   static bool SetUseBlas(bool on);
+};
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_MnLinearAlgebra
@@ -13,6 +13,7 @@
 #include "Minuit2/MnStrategy.h"
 
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 
@@ -57,6 +58,12 @@ public:
    /// can be printed via std::cout
    MinosError Minos(unsigned int, unsigned int maxcalls = 0, double toler = 0.1) const;
 
+   /// ask for the MinosError of several parameters
+   /// if the strategy asks for several threads and the FCN is thread-safe, all the
+   /// crossings (two per parameter) are computed in parallel
+   std::vector<MinosError>
+   Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls = 0, double toler = 0.1) const;
+
 protected:
    /// internal method to get crossing value via MnFunctionCross
    MnCross FindCrossValue(int dir, unsigned int, unsigned int maxcalls, double toler) const;
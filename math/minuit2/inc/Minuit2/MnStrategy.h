@@ -50,6 +50,8 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   unsigned int NumberOfThreads() const { return fNThreads; }
+
    bool IsLow() const { return fStrategy == 0; }
    bool IsMedium() const { return fStrategy == 1; }
    bool IsHigh() const { return fStrategy == 2; }
@@ -81,6 +83,10 @@ public:
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
 
+   // set number of threads used to compute the numerical derivatives of functions declaring
+   // themselves thread-safe with FCNBase::IsThreadSafe (default is 1, i.e. no threads)
+   void SetNumberOfThreads(unsigned int n) { fNThreads = n; }
+
 private:
    unsigned int fStrategy;
 
@@ -94,6 +100,7 @@ private:
    int fHessCFDG2;
    int fHessForcePosDef;
    int fStoreLevel;
+   unsigned int fNThreads;
 };
 
 } // namespace Minuit2
@@ -15,12 +15,18 @@ namespace ROOT {
 namespace Minuit2 {
 
 int mneigen(double *, unsigned int, unsigned int, unsigned int, double *, double);
+bool mnblas_eigenvalues(const LASymMatrix &, LAVector &);
 
 LAVector eigenvalues(const LASymMatrix &mat)
 {
    // calculate eigenvalues of symmetric matrices using mneigen function (translate from fortran Minuit)
    unsigned int nrow = mat.Nrow();
 
+   // use the LAPACK backend if selected, see MnLinearAlgebra
+   LAVector result(nrow);
+   if (mnblas_eigenvalues(mat, result))
+      return result;
+
    LAVector tmp(nrow * nrow);
    LAVector work(2 * nrow);
 
@@ -34,7 +40,6 @@ LAVector eigenvalues(const LASymMatrix &mat)
    (void)info;
    assert(info == 0);
 
-   LAVector result(nrow);
    for (unsigned int i = 0; i < nrow; i++)
       result(i) = work(i);
 
@@ -15,6 +15,7 @@ namespace ROOT {
 namespace Minuit2 {
 
 int mnvert(LASymMatrix &t);
+bool mnblas_invert(LASymMatrix &t, int &ifail);
 
 // symmetric matrix (positive definite only)
 
@@ -31,7 +32,7 @@ int Invert(LASymMatrix &t)
          ifail = 1;
       else
          t.Data()[0] = 1. / tmp;
-   } else {
+   } else if (!mnblas_invert(t, ifail)) {
       ifail = mnvert(t);
    }
 
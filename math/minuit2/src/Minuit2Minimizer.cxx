@@ -431,10 +431,18 @@ ROOT::Minuit2::MnStrategy customizedStrategy(unsigned int strategyLevel, ROOT::M
    st.SetGradientStepTolerance(customize("GradientStepTolerance", st.GradientStepTolerance()));
    st.SetHessianStepTolerance(customize("HessianStepTolerance", st.HessianStepTolerance()));
    st.SetHessianG2Tolerance(customize("HessianG2Tolerance", st.HessianG2Tolerance()));
+   st.SetNumberOfThreads(customize("NumberOfThreads", int(st.NumberOfThreads())));
 
    return st;
 }
 
+/// Requesting several threads with the NumberOfThreads option declares that the function is thread-safe
+void setThreadSafety(ROOT::Minuit2::FCNBase *fcn, ROOT::Minuit2::MnStrategy const &strategy)
+{
+   if (auto adapter = dynamic_cast<ROOT::Minuit2::FCNAdapter<ROOT::Math::IMultiGenFunction> *>(fcn))
+      adapter->SetThreadSafe(strategy.NumberOfThreads() > 1);
+}
+
 } // namespace
 
 bool Minuit2Minimizer::Minimize()
@@ -535,6 +543,7 @@ bool Minuit2Minimizer::Minimize()
    }
 
    const ROOT::Minuit2::MnStrategy strategy = customizedStrategy(strategyLevel, fOptions);
+   setThreadSafety(fMinuitFCN, strategy);
 
    ROOT::Minuit2::FunctionMinimum min = GetMinimizer()->Minimize(*fMinuitFCN, fState, strategy, maxfcn, tol);
    fMinimum = new ROOT::Minuit2::FunctionMinimum(min);
@@ -910,7 +919,11 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum);
+   // Minos keeps its default strategy, only the number of threads can be customized
+   ROOT::Minuit2::MnStrategy strategy(1);
+   strategy.SetNumberOfThreads(customizedStrategy(Strategy(), fOptions).NumberOfThreads());
+   setThreadSafety(fMinuitFCN, strategy);
+   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum, strategy);
 
    // run MnCross
    MnCross low;
@@ -932,7 +945,20 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       maxfcn_used = 2 * (nvar + 1) * (200 + 100 * nvar + 5 * nvar * nvar);
    }
 
-   if (runLower) {
+   ROOT::Minuit2::MinosError me;
+   const bool runInParallel = runLower && runUpper && strategy.NumberOfThreads() > 1 && fMinuitFCN->IsThreadSafe();
+   if (runInParallel) {
+      if (debugLevel >= 1) {
+         std::cout << "************************************************************************************************"
+                      "******\n";
+         std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS LOWER and UPPER errors in parallel for parameter #"
+                   << i << " : " << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol
+                   << std::endl;
+      }
+      // the crossings are computed in parallel by the batch interface of MnMinos
+      me = minos.Minos(std::vector<unsigned int>{i}, maxfcn, tol)[0];
+   }
+   if (runLower && !runInParallel) {
       if (debugLevel >= 1) {
          std::cout << "************************************************************************************************"
                       "******\n";
@@ -941,7 +967,7 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       }
       low = minos.Loval(i, maxfcn, tol);
    }
-   if (runUpper) {
+   if (runUpper && !runInParallel) {
       if (debugLevel >= 1) {
          std::cout << "************************************************************************************************"
                       "******\n";
@@ -951,7 +977,8 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       up = minos.Upval(i, maxfcn, tol);
    }
 
-   ROOT::Minuit2::MinosError me(i, fMinimum->UserState().Value(i), low, up);
+   if (!runInParallel)
+      me = ROOT::Minuit2::MinosError(i, fMinimum->UserState().Value(i), low, up);
 
    // restore global print level
    if (prev_level > -2)
@@ -1201,7 +1228,9 @@ bool Minuit2Minimizer::Hesse()
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse(customizedStrategy(Strategy(), fOptions));
+   const ROOT::Minuit2::MnStrategy strategy = customizedStrategy(Strategy(), fOptions);
+   setThreadSafety(fMinuitFCN, strategy);
+   ROOT::Minuit2::MnHesse hesse(strategy);
 
    // case when function minimum exists
    if (fMinimum) {
@@ -23,6 +23,11 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -298,8 +303,48 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    // off-diagonal Elements
    // initial starting values
    bool doCentralFD = fStrategy.HessianCentralFDMixedDerivatives();
-   if (n > 0) {
-      MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
+   // compute element (i, j) of the off-diagonal part, with xv the point shifted by dirin(i) in parameter i,
+   // leaving xv unchanged
+   auto mixedDerivative = [&](unsigned int i, unsigned int j, MnAlgebraicVector &xv) {
+      xv(j) += dirin(j);
+
+      double fs1 = mfcn(xv);
+      if(!doCentralFD) {
+         double elem = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+         vhmat(i, j) = elem;
+         xv(j) -= dirin(j);
+      } else {
+         // three more function evaluations required for central fd
+         xv(i) -= dirin(i); xv(i) -= dirin(i);double fs3 = mfcn(xv);
+         xv(j) -= dirin(j); xv(j) -= dirin(j);double fs4 = mfcn(xv);
+         xv(i) += dirin(i); xv(i) += dirin(i);double fs2 = mfcn(xv);
+         xv(j) += dirin(j);
+         double elem = (fs1 - fs2 - fs3 + fs4)/(4.*dirin(i)*dirin(j));
+         vhmat(i, j) = elem;
+      }
+   };
+   const unsigned int nThreads = n > 1 ? std::min(fStrategy.NumberOfThreads(), n - 1) : 1;
+   MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
+   if (nThreads > 1 && mfcn.Fcn().IsThreadSafe() && mpiprocOffDiagonal.GetMPISize() == 1) {
+      // the rows are distributed dynamically, the longest first, to threads working on their own point
+      std::atomic<unsigned int> nextRow{0};
+      auto work = [&]() {
+         MnAlgebraicVector xv = x;
+         for (unsigned int i = nextRow++; i < n - 1; i = nextRow++) {
+            xv(i) += dirin(i);
+            for (unsigned int j = i + 1; j < n; j++)
+               mixedDerivative(i, j, xv);
+            xv(i) -= dirin(i);
+         }
+      };
+      std::vector<std::thread> threads;
+      threads.reserve(nThreads - 1);
+      for (unsigned int k = 1; k < nThreads; k++)
+         threads.emplace_back(work);
+      work();
+      for (auto &thread : threads)
+         thread.join();
+   } else if (n > 0) {
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
 
@@ -318,22 +363,7 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          if ((i + 1) == j || in == startParIndexOffDiagonal)
             x(i) += dirin(i);
 
-         x(j) += dirin(j);
-
-         double fs1 = mfcn(x);
-         if(!doCentralFD) {
-            double elem = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
-            vhmat(i, j) = elem;
-            x(j) -= dirin(j);
-         } else {
-            // three more function evaluations required for central fd
-            x(i) -= dirin(i); x(i) -= dirin(i);double fs3 = mfcn(x);
-            x(j) -= dirin(j); x(j) -= dirin(j);double fs4 = mfcn(x);
-            x(i) += dirin(i); x(i) += dirin(i);double fs2 = mfcn(x);
-            x(j) += dirin(j);
-            double elem = (fs1 - fs2 - fs3 + fs4)/(4.*dirin(i)*dirin(j));
-            vhmat(i, j) = elem;
-         }
+         mixedDerivative(i, j, x);
 
          if (j % (n - 1) == 0 || in == endParIndexOffDiagonal - 1)
             x(i) -= dirin(i);
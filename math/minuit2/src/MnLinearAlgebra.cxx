@@ -0,0 +1,166 @@
+// @(#)root/minuit2:$Id$
+// Authors: M. Winkler, F. James, L. Moneta, A. Zsenei   2003-2005
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#include "Minuit2/MnLinearAlgebra.h"
+#include "Minuit2/LASymMatrix.h"
+#include "Minuit2/LAVector.h"
+
+#include <atomic>
+#include <vector>
+
+#ifdef MINUIT2_USE_BLAS
+// BLAS and LAPACK routines, with the Fortran calling convention.
+// The hidden length arguments of the character arguments are not needed for single characters.
+extern "C" {
+void dspr_(const char *uplo, const int *n, const double *alpha, const double *x, const int *incx, double *ap);
+void dspmv_(const char *uplo, const int *n, const double *alpha, const double *ap, const double *x, const int *incx,
+            const double *beta, double *y, const int *incy);
+double ddot_(const int *n, const double *dx, const int *incx, const double *dy, const int *incy);
+void dsptrf_(const char *uplo, const int *n, double *ap, int *ipiv, int *info);
+void dsptri_(const char *uplo, const int *n, double *ap, const int *ipiv, double *work, int *info);
+void dspev_(const char *jobz, const char *uplo, const int *n, double *ap, double *w, double *z, const int *ldz,
+            double *work, int *info);
+}
+#endif
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+namespace {
+
+#ifdef MINUIT2_USE_BLAS
+std::atomic<bool> gUseBlas{true};
+#else
+std::atomic<bool> gUseBlas{false};
+#endif
+
+} // namespace
+
+bool MnLinearAlgebra::HasBlas()
+{
+#ifdef MINUIT2_USE_BLAS
+   return true;
+#else
+   return false;
+#endif
+}
+
+bool MnLinearAlgebra::UseBlas()
+{
+   return gUseBlas;
+}
+
+bool MnLinearAlgebra::SetUseBlas(bool on)
+{
+   if (on && !HasBlas())
+      return false;
+   gUseBlas = on;
+   return true;
+}
+
+// The functions below do the operation with BLAS or LAPACK and return true if the backend is used,
+// otherwise they return false without doing anything and the caller falls back to the built-in routine.
+
+bool mnblas_dspr(const char *uplo, unsigned int n, double alpha, const double *x, int incx, double *ap)
+{
+#ifdef MINUIT2_USE_BLAS
+   if (!gUseBlas)
+      return false;
+   const int nn = n;
+   dspr_(uplo, &nn, &alpha, x, &incx, ap);
+   return true;
+#else
+   (void)uplo, (void)n, (void)alpha, (void)x, (void)incx, (void)ap;
+   return false;
+#endif
+}
+
+bool mnblas_dspmv(const char *uplo, unsigned int n, double alpha, const double *ap, const double *x, int incx,
+                  double beta, double *y, int incy)
+{
+#ifdef MINUIT2_USE_BLAS
+   if (!gUseBlas)
+      return false;
+   const int nn = n;
+   dspmv_(uplo, &nn, &alpha, ap, x, &incx, &beta, y, &incy);
+   return true;
+#else
+   (void)uplo, (void)n, (void)alpha, (void)ap, (void)x, (void)incx, (void)beta, (void)y, (void)incy;
+   return false;
+#endif
+}
+
+bool mnblas_ddot(unsigned int n, const double *dx, int incx, const double *dy, int incy, double &result)
+{
+#ifdef MINUIT2_USE_BLAS
+   if (!gUseBlas)
+      return false;
+   const int nn = n;
+   result = ddot_(&nn, dx, &incx, dy, &incy);
+   return true;
+#else
+   (void)n, (void)dx, (void)incx, (void)dy, (void)incy, (void)result;
+   return false;
+#endif
+}
+
+/// invert the symmetric matrix t; ifail is set to 1 if the matrix is singular or has
+/// a negative diagonal element, as for mnvert
+bool mnblas_invert(LASymMatrix &t, int &ifail)
+{
+#ifdef MINUIT2_USE_BLAS
+   if (!gUseBlas)
+      return false;
+   const int n = t.Nrow();
+   for (int i = 0; i < n; i++) {
+      if (t(i, i) < 0.) {
+         ifail = 1;
+         return true;
+      }
+   }
+   std::vector<int> ipiv(n);
+   std::vector<double> work(n);
+   int info = 0;
+   dsptrf_("U", &n, t.Data(), ipiv.data(), &info);
+   if (info == 0)
+      dsptri_("U", &n, t.Data(), ipiv.data(), work.data(), &info);
+   ifail = info == 0 ? 0 : 1;
+   return true;
+#else
+   (void)t, (void)ifail;
+   return false;
+#endif
+}
+
+/// compute in ascending order the eigenvalues of the symmetric matrix mat; in case LAPACK fails
+/// false is returned, so that the built-in routine is tried
+bool mnblas_eigenvalues(const LASymMatrix &mat, LAVector &result)
+{
+#ifdef MINUIT2_USE_BLAS
+   if (!gUseBlas)
+      return false;
+   const int n = mat.Nrow();
+   // dspev destroys the matrix
+   std::vector<double> ap(mat.Data(), mat.Data() + mat.size());
+   std::vector<double> work(3 * n);
+   double z = 0.;
+   const int ldz = 1;
+   int info = 0;
+   dspev_("N", "U", &n, ap.data(), result.Data(), &z, &ldz, work.data(), &info);
+   return info == 0;
+#else
+   (void)mat, (void)result;
+   return false;
+#endif
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
@@ -15,6 +15,10 @@
 #include "Minuit2/MinosError.h"
 #include "Minuit2/MnPrint.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -78,17 +82,56 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
 
    MnPrint print("MnMinos");
 
-   MnCross up = Upval(par, maxcalls, toler);
+   MinosError mnerr = Minos(std::vector<unsigned int>{par}, maxcalls, toler)[0];
 
-   print.Debug("Function calls to find upper error", up.NFcn());
+   print.Debug("Function calls to find the errors", mnerr.NFcn());
 
-   MnCross lo = Loval(par, maxcalls, toler);
+   print.Debug("return Minos error", mnerr.Lower(), ",", mnerr.Upper());
 
-   print.Debug("Function calls to find lower error", lo.NFcn());
+   return mnerr;
+}
 
-   print.Debug("return Minos error", lo.Value(), ",", up.Value());
+std::vector<MinosError>
+MnMinos::Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls, double toler) const
+{
+   // do full minos error analysis (lower + upper) for the parameters pars
+
+   // crossing k is the upper (k even) or the lower (k odd) crossing of parameter pars[k / 2]
+   const unsigned int nCross = 2 * pars.size();
+   std::vector<MnCross> crossings(nCross);
+   auto findCrossing = [&](const MnMinos &minos, unsigned int k) {
+      crossings[k] =
+         (k % 2 == 0) ? minos.Upval(pars[k / 2], maxcalls, toler) : minos.Loval(pars[k / 2], maxcalls, toler);
+   };
+
+   const unsigned int nThreads = std::min(fStrategy.NumberOfThreads(), nCross);
+   if (nThreads > 1 && fFCN.IsThreadSafe()) {
+      // the crossings run in parallel, so the minimizations inside them use a single thread
+      MnStrategy serial(fStrategy);
+      serial.SetNumberOfThreads(1);
+      MnMinos minos(fFCN, fMinimum, serial);
+      std::atomic<unsigned int> next{0};
+      auto work = [&]() {
+         for (unsigned int k = next++; k < nCross; k = next++)
+            findCrossing(minos, k);
+      };
+      std::vector<std::thread> threads;
+      threads.reserve(nThreads - 1);
+      for (unsigned int i = 1; i < nThreads; i++)
+         threads.emplace_back(work);
+      work();
+      for (auto &thread : threads)
+         thread.join();
+   } else {
+      for (unsigned int k = 0; k < nCross; k++)
+         findCrossing(*this, k);
+   }
 
-   return MinosError(par, fMinimum.UserState().Value(par), lo, up);
+   std::vector<MinosError> result;
+   result.reserve(pars.size());
+   for (unsigned int i = 0; i < pars.size(); i++)
+      result.emplace_back(pars[i], fMinimum.UserState().Value(pars[i]), crossings[2 * i + 1], crossings[2 * i]);
+   return result;
 }
 
 MnCross MnMinos::FindCrossValue(int direction, unsigned int par, unsigned int maxcalls, double toler) const
@@ -8,6 +8,7 @@
  **********************************************************************/
 
 #include "Minuit2/Numerical2PGradientCalculator.h"
+#include "Minuit2/FCNBase.h"
 #include "Minuit2/InitialGradientCalculator.h"
 #include "Minuit2/MnFcn.h"
 #include "Minuit2/MnUserTransformation.h"
@@ -21,9 +22,13 @@
 #include <omp.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cassert>
 #include <iomanip>
+#include <thread>
+#include <vector>
 
 #include "Minuit2/MPIProcess.h"
 
@@ -97,35 +102,9 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around function value", fcnmin, "\n\t at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // compute the derivative of parameter i, with x the point around which it is computed
+   // and prt an instance of MnPrint that belongs to the calling thread
+   auto derivative = [&](unsigned int i, MnAlgebraicVector &x, MnPrint &prt) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -173,26 +152,14 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 #pragma omp critical
 #endif
          {
-#ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
             if (i == 0 && j == 0) {
-#ifdef _OPENMP
-               printtl.Trace([&](std::ostream &os) {
-#else
-               print.Trace([&](std::ostream &os) {
-#endif
+               prt.Trace([&](std::ostream &os) {
                   os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
                      << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
                      << std::setw(15) << "g2" << std::endl;
                });
             }
-#ifdef _OPENMP
-            printtl.Trace([&](std::ostream &os) {
-#else
-            print.Trace([&](std::ostream &os) {
-#endif
+            prt.Trace([&](std::ostream &os) {
                const int pr = os.precision(13);
                const int iext = Trafo().ExtOfInt(i);
                os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
@@ -209,12 +176,66 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
             break;
          }
       }
+   };
+
+#ifndef _OPENMP
+
+   MPIProcess mpiproc(n, 0);
+
+   unsigned int startElementIndex = mpiproc.StartElementIndex();
+   unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+   const unsigned int nThreads = std::min(Strategy().NumberOfThreads(), endElementIndex - startElementIndex);
+   if (nThreads > 1 && Fcn().Fcn().IsThreadSafe()) {
+
+      // the parameters are distributed dynamically, since their number of cycles differ
+      std::atomic<unsigned int> next{startElementIndex};
+      auto work = [&]() {
+         // each thread needs its own point and its own MnPrint instance
+         MnPrint printtl("Numerical2PGradientCalculator[thread]");
+         MnAlgebraicVector x = par.Vec();
+         for (unsigned int i = next++; i < endElementIndex; i = next++) {
+            derivative(i, x, printtl);
+         }
+      };
+      std::vector<std::thread> threads;
+      threads.reserve(nThreads - 1);
+      for (unsigned int k = 1; k < nThreads; ++k) {
+         threads.emplace_back(work);
+      }
+      work();
+      for (auto &thread : threads) {
+         thread.join();
+      }
+
+   } else {
+
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
+         derivative(i, x, print);
+      }
+   }
+
+#else
+
+   // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+   //#pragma omp for schedule (static, N_PARALLEL_PAR)
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
+   for (int i = 0; i < int(n); i++) {
+      // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      // must create thread-local MnPrint instances when printing inside threads
+      MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
+      derivative(i, x, printtl);
    }
 
+#endif
+
 #ifndef _OPENMP
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
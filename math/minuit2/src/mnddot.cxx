@@ -16,8 +16,15 @@ namespace ROOT {
 
 namespace Minuit2 {
 
+bool mnblas_ddot(unsigned int, const double *, int, const double *, int, double &);
+
 double mnddot(unsigned int n, const double *dx, int incx, const double *dy, int incy)
 {
+   // use the BLAS backend if selected, see MnLinearAlgebra
+   double result = 0.;
+   if (mnblas_ddot(n, dx, incx, dy, incy, result))
+      return result;
+
    /* System generated locals */
    int i__1;
    double ret_val;
@@ -18,10 +18,15 @@ namespace Minuit2 {
 
 bool mnlsame(const char *, const char *);
 int mnxerbla(const char *, int);
+bool mnblas_dspmv(const char *, unsigned int, double, const double *, const double *, int, double, double *, int);
 
 int Mndspmv(const char *uplo, unsigned int n, double alpha, const double *ap, const double *x, int incx, double beta,
             double *y, int incy)
 {
+   // use the BLAS backend if selected, see MnLinearAlgebra
+   if (mnblas_dspmv(uplo, n, alpha, ap, x, incx, beta, y, incy))
+      return 0;
+
    /* System generated locals */
    int i__1, i__2;
 
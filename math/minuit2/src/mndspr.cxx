@@ -18,9 +18,14 @@ namespace Minuit2 {
 
 bool mnlsame(const char *, const char *);
 int mnxerbla(const char *, int);
+bool mnblas_dspr(const char *, unsigned int, double, const double *, int, double *);
 
 int mndspr(const char *uplo, unsigned int n, double alpha, const double *x, int incx, double *ap)
 {
+   // use the BLAS backend if selected, see MnLinearAlgebra
+   if (mnblas_dspr(uplo, n, alpha, x, incx, ap))
+      return 0;
+
    /* System generated locals */
    int i__1, i__2;
 
@@ -0,0 +1,260 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+// Test of the BLAS/LAPACK backend of the Minuit2 linear algebra (see MnLinearAlgebra):
+// the packed symmetric matrix operations done by BLAS and LAPACK must give the same
+// results as the built-in routines, and so must a fit. When Minuit2 is built without
+// the minuit2_blas option, only the selection of the backend is tested.
+
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/LaOuterProduct.h"
+#include "Minuit2/LaProd.h"
+#include "Minuit2/MnLinearAlgebra.h"
+#include "Minuit2/MnMatrix.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnUserParameters.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+// not in the public headers
+double inner_product(const LAVector &, const LAVector &);
+double similarity(const LAVector &, const LASymMatrix &);
+LAVector eigenvalues(const LASymMatrix &);
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+using namespace ROOT::Minuit2;
+
+const unsigned int kN = 25;
+
+// deterministic pseudo-random numbers in [-1, 1)
+double Random()
+{
+   static std::uint32_t seed = 4357;
+   seed = seed * 1664525u + 1013904223u;
+   return (seed >> 8) * (2. / 16777216.) - 1.;
+}
+
+MnAlgebraicVector RandomVector()
+{
+   MnAlgebraicVector v(kN);
+   for (unsigned int i = 0; i < kN; ++i)
+      v(i) = Random();
+   return v;
+}
+
+// positive definite matrix, with a dominant diagonal
+MnAlgebraicSymMatrix RandomSymMatrix()
+{
+   MnAlgebraicSymMatrix m(kN);
+   for (unsigned int i = 0; i < kN; ++i) {
+      for (unsigned int j = 0; j < i; ++j)
+         m(i, j) = Random();
+      m(i, i) = kN + Random();
+   }
+   return m;
+}
+
+bool IsEqual(double x, double ref, double tol = 1.E-12)
+{
+   return std::abs(x - ref) <= tol * std::max(1., std::abs(ref));
+}
+
+int CompareVector(const MnAlgebraicVector &v, const MnAlgebraicVector &ref, const char *name, double tol = 1.E-12)
+{
+   for (unsigned int i = 0; i < ref.size(); ++i) {
+      if (!IsEqual(v(i), ref(i), tol)) {
+         std::cerr << name << ": element " << i << " = " << v(i) << " differs from " << ref(i) << std::endl;
+         return 1;
+      }
+   }
+   return 0;
+}
+
+int CompareMatrix(const MnAlgebraicSymMatrix &m, const MnAlgebraicSymMatrix &ref, const char *name,
+                  double tol = 1.E-12)
+{
+   for (unsigned int i = 0; i < ref.Nrow(); ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         if (!IsEqual(m(i, j), ref(i, j), tol)) {
+            std::cerr << name << ": element (" << i << ", " << j << ") = " << m(i, j) << " differs from "
+                      << ref(i, j) << std::endl;
+            return 1;
+         }
+      }
+   }
+   return 0;
+}
+
+struct Results {
+   MnAlgebraicSymMatrix fRank1{kN};
+   MnAlgebraicVector fProduct{kN};
+   double fDot = 0;
+   double fSimilarity = 0;
+   MnAlgebraicSymMatrix fInverse{kN};
+   int fInvertStatus = 0;
+   MnAlgebraicVector fEigenvalues{kN};
+};
+
+Results Compute(const MnAlgebraicSymMatrix &m, const MnAlgebraicVector &v, const MnAlgebraicVector &w)
+{
+   Results r;
+   // rank-1 update (dspr)
+   r.fRank1 = m;
+   r.fRank1 += 0.7 * Outer_product(v);
+   // matrix-vector product (dspmv)
+   r.fProduct = m * v;
+   // dot products (ddot)
+   r.fDot = inner_product(v, w);
+   r.fSimilarity = similarity(v, m);
+   // inversion (dsptrf/dsptri)
+   r.fInverse = m;
+   r.fInvertStatus = Invert(r.fInverse);
+   // eigenvalues (dspev)
+   r.fEigenvalues = eigenvalues(m);
+   return r;
+}
+
+int testPackedRoutines()
+{
+   int iret = 0;
+
+   const MnAlgebraicSymMatrix m = RandomSymMatrix();
+   const MnAlgebraicVector v = RandomVector();
+   const MnAlgebraicVector w = RandomVector();
+
+   MnLinearAlgebra::SetUseBlas(false);
+   const Results ref = Compute(m, v, w);
+   MnLinearAlgebra::SetUseBlas(true);
+   const Results r = Compute(m, v, w);
+
+   iret |= CompareMatrix(r.fRank1, ref.fRank1, "rank-1 update");
+   iret |= CompareVector(r.fProduct, ref.fProduct, "matrix-vector product");
+   if (!IsEqual(r.fDot, ref.fDot)) {
+      std::cerr << "dot product: " << r.fDot << " differs from " << ref.fDot << std::endl;
+      iret = 1;
+   }
+   if (!IsEqual(r.fSimilarity, ref.fSimilarity)) {
+      std::cerr << "similarity: " << r.fSimilarity << " differs from " << ref.fSimilarity << std::endl;
+      iret = 1;
+   }
+   if (r.fInvertStatus != 0 || ref.fInvertStatus != 0) {
+      std::cerr << "inversion failed: " << r.fInvertStatus << " " << ref.fInvertStatus << std::endl;
+      iret = 1;
+   }
+   iret |= CompareMatrix(r.fInverse, ref.fInverse, "inverse", 1.E-10);
+   // the built-in eigenvalue routine is called with a precision of 1.E-6
+   iret |= CompareVector(r.fEigenvalues, ref.fEigenvalues, "eigenvalues", 1.E-6);
+
+   // a negative diagonal element is a failure of the inversion for both backends
+   MnAlgebraicSymMatrix bad = m;
+   bad(3, 3) = -1.;
+   MnAlgebraicSymMatrix bad2 = bad;
+   MnLinearAlgebra::SetUseBlas(false);
+   const int refStatus = Invert(bad);
+   MnLinearAlgebra::SetUseBlas(true);
+   if (Invert(bad2) == 0 || refStatus == 0) {
+      std::cerr << "inversion of a matrix with a negative diagonal element did not fail" << std::endl;
+      iret = 1;
+   }
+
+   return iret;
+}
+
+// quadratic form plus a quartic term, with correlated parameters
+class CorrelatedQuartic : public FCNBase {
+
+public:
+   CorrelatedQuartic() : fA(RandomSymMatrix()), fX0(RandomVector()) {}
+
+   double operator()(std::vector<double> const &par) const override
+   {
+      MnAlgebraicVector d(kN);
+      double quartic = 0;
+      for (unsigned int i = 0; i < kN; ++i) {
+         d(i) = par[i] - fX0(i);
+         quartic += d(i) * d(i) * d(i) * d(i);
+      }
+      return similarity(d, fA) + 0.1 * quartic;
+   }
+
+   double Up() const override { return 1.; }
+
+private:
+   MnAlgebraicSymMatrix fA;
+   MnAlgebraicVector fX0;
+};
+
+int testFit()
+{
+   int iret = 0;
+
+   CorrelatedQuartic fcn;
+   MnUserParameters upar;
+   for (unsigned int i = 0; i < kN; ++i)
+      upar.Add("x" + std::to_string(i), 0., 0.1);
+
+   MnLinearAlgebra::SetUseBlas(false);
+   FunctionMinimum ref = MnMigrad(fcn, upar)();
+   MnLinearAlgebra::SetUseBlas(true);
+   FunctionMinimum min = MnMigrad(fcn, upar)();
+
+   if (!min.IsValid() || !ref.IsValid()) {
+      std::cerr << "fit: invalid minimum" << std::endl;
+      return 1;
+   }
+   // the rounding differs between the backends, so the two fits do not follow exactly the same path
+   for (unsigned int i = 0; i < kN; ++i) {
+      const double err = ref.UserState().Error(i);
+      if (std::abs(min.UserState().Value(i) - ref.UserState().Value(i)) > 1.E-3 * err ||
+          !IsEqual(min.UserState().Error(i), err, 1.E-3)) {
+         std::cerr << "fit: parameter " << i << " = " << min.UserState().Value(i) << " +/- "
+                   << min.UserState().Error(i) << " differs from " << ref.UserState().Value(i) << " +/- " << err
+                   << std::endl;
+         iret = 1;
+      }
+   }
+
+   return iret;
+}
+
+int main()
+{
+   int iret = 0;
+
+   if (!MnLinearAlgebra::HasBlas()) {
+      // nothing to compare with
+      if (MnLinearAlgebra::UseBlas() || MnLinearAlgebra::SetUseBlas(true)) {
+         std::cerr << "testMinuit2Blas : the BLAS backend is selected but not available" << std::endl;
+         iret = 1;
+      }
+   } else {
+      if (!MnLinearAlgebra::UseBlas()) {
+         std::cerr << "testMinuit2Blas : the BLAS backend is not selected by default" << std::endl;
+         iret = 1;
+      }
+      iret |= testPackedRoutines();
+      iret |= testFit();
+   }
+
+   if (iret != 0)
+      std::cerr << "testMinuit2Blas :\t FAILED " << std::endl;
+   else
+      std::cerr << "testMinuit2Blas :\t OK " << std::endl;
+   return iret;
+}
@@ -0,0 +1,268 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+// Test of the computation of the numerical derivatives, of the Hessian and of the
+// Minos errors in several threads (see MnStrategy::SetNumberOfThreads and
+// FCNBase::IsThreadSafe): the threaded fit must give the same result as the serial
+// one, and a function that does not declare itself thread-safe must always be
+// evaluated in the calling thread.
+
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MinosError.h"
+#include "Minuit2/MnContours.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnMinos.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/MnUserParameters.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+// chi2 fit of a Gaussian peak on top of a linear background, recording the threads evaluating it
+class GausPlusLineChi2 : public FCNBase {
+
+public:
+   GausPlusLineChi2(bool threadSafe, unsigned int nbins = 1000) : fThreadSafe(threadSafe)
+   {
+      // deterministic pseudo-random noise, so that the test does not depend on a random generator
+      std::uint32_t seed = 12345;
+      auto uniform = [&seed]() {
+         seed = seed * 1664525u + 1013904223u;
+         return (seed >> 8) * (1. / 16777216.);
+      };
+      const std::vector<double> truePar{50., 0.5, 0.8, 10., 1.};
+      for (unsigned int i = 0; i < nbins; ++i) {
+         const double x = -5. + 10. * (i + 0.5) / nbins;
+         fX.push_back(x);
+         fY.push_back(Model(x, truePar) + 2. * (uniform() + uniform() + uniform() - 1.5));
+      }
+   }
+
+   static double Model(double x, std::vector<double> const &p)
+   {
+      const double t = (x - p[1]) / p[2];
+      return p[0] * std::exp(-0.5 * t * t) + p[3] + p[4] * x;
+   }
+
+   double operator()(std::vector<double> const &par) const override
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fThreads.insert(std::this_thread::get_id());
+      }
+      double chi2 = 0;
+      for (std::size_t i = 0; i < fX.size(); ++i) {
+         const double d = fY[i] - Model(fX[i], par);
+         chi2 += d * d;
+      }
+      return chi2;
+   }
+
+   double Up() const override { return 1.; }
+
+   bool IsThreadSafe() const override { return fThreadSafe; }
+
+   std::set<std::thread::id> Threads() const
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fThreads;
+   }
+
+   void ResetThreads()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fThreads.clear();
+   }
+
+private:
+   bool fThreadSafe;
+   std::vector<double> fX;
+   std::vector<double> fY;
+   mutable std::mutex fMutex;
+   mutable std::set<std::thread::id> fThreads;
+};
+
+MnUserParameters InitialParameters()
+{
+   MnUserParameters upar;
+   upar.Add("norm", 30., 1.);
+   upar.Add("mean", 0., 0.1);
+   upar.Add("sigma", 1., 0.1);
+   upar.Add("p0", 5., 1.);
+   upar.Add("p1", 0., 0.1);
+   return upar;
+}
+
+MnStrategy Strategy(unsigned int nthreads)
+{
+   MnStrategy strategy(1);
+   strategy.SetNumberOfThreads(nthreads);
+   return strategy;
+}
+
+FunctionMinimum Fit(const FCNBase &fcn, unsigned int nthreads)
+{
+   MnMigrad migrad(fcn, InitialParameters(), Strategy(nthreads));
+   return migrad();
+}
+
+bool IsEqual(double x, double ref, double tol = 1.E-10)
+{
+   return std::abs(x - ref) <= tol * std::max(1., std::abs(ref));
+}
+
+// compare the result of a fit with the one of the reference fit
+int CompareMinimum(const FunctionMinimum &min, const FunctionMinimum &ref, const char *name)
+{
+   int iret = 0;
+   if (!min.IsValid() || !ref.IsValid()) {
+      std::cerr << name << ": invalid minimum" << std::endl;
+      return 1;
+   }
+   if (!IsEqual(min.Fval(), ref.Fval())) {
+      std::cerr << name << ": function value " << min.Fval() << " differs from " << ref.Fval() << std::endl;
+      iret = 1;
+   }
+   if (min.NFcn() != ref.NFcn()) {
+      std::cerr << name << ": number of calls " << min.NFcn() << " differs from " << ref.NFcn() << std::endl;
+      iret = 1;
+   }
+   for (unsigned int i = 0; i < ref.UserState().Params().size(); ++i) {
+      if (!IsEqual(min.UserState().Value(i), ref.UserState().Value(i)) ||
+          !IsEqual(min.UserState().Error(i), ref.UserState().Error(i))) {
+         std::cerr << name << ": parameter " << i << " = " << min.UserState().Value(i) << " +/- "
+                   << min.UserState().Error(i) << " differs from " << ref.UserState().Value(i) << " +/- "
+                   << ref.UserState().Error(i) << std::endl;
+         iret = 1;
+      }
+   }
+   return iret;
+}
+
+int testThreadedGradient()
+{
+   int iret = 0;
+
+   GausPlusLineChi2 serialFcn(true);
+   FunctionMinimum ref = Fit(serialFcn, 1);
+   if (serialFcn.Threads().size() != 1) {
+      std::cerr << "serial fit: function evaluated in " << serialFcn.Threads().size() << " threads" << std::endl;
+      iret = 1;
+   }
+
+   GausPlusLineChi2 threadedFcn(true);
+   iret |= CompareMinimum(Fit(threadedFcn, 4), ref, "threaded gradient");
+   if (std::thread::hardware_concurrency() > 1 && threadedFcn.Threads().size() < 2) {
+      std::cerr << "threaded gradient: function evaluated in a single thread" << std::endl;
+      iret = 1;
+   }
+
+   // a function that is not thread-safe must stay serial, whatever the strategy asks for
+   GausPlusLineChi2 unsafeFcn(false);
+   iret |= CompareMinimum(Fit(unsafeFcn, 4), ref, "not thread-safe function");
+   const auto threads = unsafeFcn.Threads();
+   if (threads.size() != 1 || *threads.begin() != std::this_thread::get_id()) {
+      std::cerr << "not thread-safe function: evaluated outside of the calling thread" << std::endl;
+      iret = 1;
+   }
+
+   return iret;
+}
+
+int testThreadedHesseMinos()
+{
+   int iret = 0;
+
+   GausPlusLineChi2 serialFcn(true);
+   FunctionMinimum ref = Fit(serialFcn, 1);
+   GausPlusLineChi2 threadedFcn(true);
+   FunctionMinimum min = Fit(threadedFcn, 1);
+
+   // Hesse
+   MnHesse(Strategy(1))(serialFcn, ref);
+   MnHesse(Strategy(4))(threadedFcn, min);
+   iret |= CompareMinimum(min, ref, "threaded Hesse");
+   const unsigned int npar = ref.UserState().Params().size();
+   for (unsigned int i = 0; i < npar; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         const double cov = min.UserState().Covariance()(i, j);
+         const double refCov = ref.UserState().Covariance()(i, j);
+         if (!IsEqual(cov, refCov)) {
+            std::cerr << "threaded Hesse: covariance(" << i << ", " << j << ") = " << cov << " differs from "
+                      << refCov << std::endl;
+            iret = 1;
+         }
+      }
+   }
+
+   // Minos, all the parameters at once
+   std::vector<unsigned int> pars(npar);
+   for (unsigned int i = 0; i < npar; ++i)
+      pars[i] = i;
+   threadedFcn.ResetThreads();
+   const std::vector<MinosError> errors = MnMinos(threadedFcn, min, Strategy(4)).Minos(pars);
+   if (std::thread::hardware_concurrency() > 1 && threadedFcn.Threads().size() < 2) {
+      std::cerr << "threaded Minos: function evaluated in a single thread" << std::endl;
+      iret = 1;
+   }
+   MnMinos serialMinos(serialFcn, ref, Strategy(1));
+   if (errors.size() != npar) {
+      std::cerr << "threaded Minos: " << errors.size() << " errors for " << npar << " parameters" << std::endl;
+      return 1;
+   }
+   for (unsigned int i = 0; i < npar; ++i) {
+      const MinosError refError = serialMinos.Minos(i);
+      if (!errors[i].IsValid() || !refError.IsValid() || !IsEqual(errors[i].Lower(), refError.Lower()) ||
+          !IsEqual(errors[i].Upper(), refError.Upper())) {
+         std::cerr << "threaded Minos: error of parameter " << i << " [" << errors[i].Lower() << ", "
+                   << errors[i].Upper() << "] differs from [" << refError.Lower() << ", " << refError.Upper()
+                   << "]" << std::endl;
+         iret = 1;
+      }
+   }
+
+   // contour of mean and sigma, which goes through the Minos errors of both parameters
+   const auto contour = MnContours(threadedFcn, min, Strategy(4))(1, 2, 12);
+   const auto refContour = MnContours(serialFcn, ref, Strategy(1))(1, 2, 12);
+   if (contour.size() != refContour.size() || contour.empty()) {
+      std::cerr << "threaded contour: " << contour.size() << " points instead of " << refContour.size() << std::endl;
+      return 1;
+   }
+   for (std::size_t k = 0; k < contour.size(); ++k) {
+      if (!IsEqual(contour[k].first, refContour[k].first) || !IsEqual(contour[k].second, refContour[k].second)) {
+         std::cerr << "threaded contour: point " << k << " (" << contour[k].first << ", " << contour[k].second
+                   << ") differs from (" << refContour[k].first << ", " << refContour[k].second << ")" << std::endl;
+         iret = 1;
+      }
+   }
+
+   return iret;
+}
+
+int main()
+{
+   int iret = 0;
+
+   iret |= testThreadedGradient();
+   iret |= testThreadedHesseMinos();
+
+   if (iret != 0)
+      std::cerr << "testMinuit2Threads :\t FAILED " << std::endl;
+   else
+      std::cerr << "testMinuit2Threads :\t OK " << std::endl;
+   return iret;
+}
@@ -0,0 +1,345 @@
+// @(#)root/smatrix:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_Math_SMatrixBatch
+#define ROOT_Math_SMatrixBatch
+
+#include "Math/SMatrix.h"
+#include "Math/SVector.h"
+
+#include <cmath>
+
+namespace ROOT {
+
+namespace Math {
+
+//____________________________________________________________________________________________________________
+/**
+    SMatrixBatch: N fixed size D1 x D2 matrices stored as structure of arrays.
+
+    The element (i,j) of all N matrices is stored contiguously, so that the
+    operations below (Multiply(), Similarity(), InvertChol()) compute the same
+    element of all N results in one loop over the batch, which the compiler
+    vectorizes. This is the layout to use for the many small, independent
+    updates of e.g. a track fit, where a single SMatrix leaves the SIMD lanes
+    idle. N should be a multiple of the SIMD width, e.g. 8 or 16.
+
+    Matrices are moved in and out of the batch as SMatrix objects with Load()
+    and Store(); the elements can also be accessed directly with
+    `operator()(n, i, j)`.
+
+    @code
+    ROOT::Math::SMatrixBatch<double, 5, 5, 16> jac, cov, result;
+    for (unsigned int n = 0; n < 16; ++n) {
+       jac.Load(n, tracks[n].Jacobian());
+       cov.Load(n, tracks[n].Covariance());
+    }
+    ROOT::Math::Similarity(jac, cov, result);
+    @endcode
+
+    @ingroup SMatrixGroup
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+class SMatrixBatch {
+public:
+   typedef T value_type;
+
+   enum {
+      /// number of rows of every matrix
+      kRows = D1,
+      /// number of columns of every matrix
+      kCols = D2,
+      /// number of matrices in the batch
+      kBatchSize = N
+   };
+
+   /// element (i,j) of matrix n
+   T &operator()(unsigned int n, unsigned int i, unsigned int j) { return fArray[(i * D2 + j) * N + n]; }
+   const T &operator()(unsigned int n, unsigned int i, unsigned int j) const { return fArray[(i * D2 + j) * N + n]; }
+
+   /// the element (i,j) of all N matrices, contiguous in memory
+   T *Plane(unsigned int i, unsigned int j) { return fArray + (i * D2 + j) * N; }
+   const T *Plane(unsigned int i, unsigned int j) const { return fArray + (i * D2 + j) * N; }
+
+   /// set matrix n to m
+   template <class R>
+   void Load(unsigned int n, const SMatrix<T, D1, D2, R> &m)
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            (*this)(n, i, j) = m(i, j);
+   }
+
+   /// copy matrix n to m
+   template <class R>
+   void Store(unsigned int n, SMatrix<T, D1, D2, R> &m) const
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            m(i, j) = (*this)(n, i, j);
+   }
+
+   /// matrix n as a SMatrix
+   SMatrix<T, D1, D2> Get(unsigned int n) const
+   {
+      SMatrix<T, D1, D2> m;
+      Store(n, m);
+      return m;
+   }
+
+   /// set all elements of all matrices to value
+   void SetAll(T value)
+   {
+      for (unsigned int k = 0; k < D1 * D2 * N; ++k)
+         fArray[k] = value;
+   }
+
+   T *Array() { return fArray; }
+   const T *Array() const { return fArray; }
+
+private:
+   T fArray[D1 * D2 * N];
+};
+
+//____________________________________________________________________________________________________________
+/**
+    SVectorBatch: N fixed size vectors of dimension D stored as structure of
+    arrays, the vector counterpart of SMatrixBatch.
+
+    @ingroup SMatrixGroup
+*/
+template <class T, unsigned int D, unsigned int N>
+class SVectorBatch {
+public:
+   typedef T value_type;
+
+   enum {
+      /// dimension of every vector
+      kSize = D,
+      /// number of vectors in the batch
+      kBatchSize = N
+   };
+
+   /// element i of vector n
+   T &operator()(unsigned int n, unsigned int i) { return fArray[i * N + n]; }
+   const T &operator()(unsigned int n, unsigned int i) const { return fArray[i * N + n]; }
+
+   /// the element i of all N vectors, contiguous in memory
+   T *Plane(unsigned int i) { return fArray + i * N; }
+   const T *Plane(unsigned int i) const { return fArray + i * N; }
+
+   /// set vector n to v
+   void Load(unsigned int n, const SVector<T, D> &v)
+   {
+      for (unsigned int i = 0; i < D; ++i)
+         (*this)(n, i) = v(i);
+   }
+
+   /// copy vector n to v
+   void Store(unsigned int n, SVector<T, D> &v) const
+   {
+      for (unsigned int i = 0; i < D; ++i)
+         v(i) = (*this)(n, i);
+   }
+
+   /// vector n as a SVector
+   SVector<T, D> Get(unsigned int n) const
+   {
+      SVector<T, D> v;
+      Store(n, v);
+      return v;
+   }
+
+   T *Array() { return fArray; }
+   const T *Array() const { return fArray; }
+
+private:
+   T fArray[D * N];
+};
+
+/// \name Batched operations
+/// The result must not be one of the arguments.
+/// @ingroup SMatrixGroup
+///\{
+
+/// C = A * B for all matrices of the batch
+template <class T, unsigned int D1, unsigned int D, unsigned int D2, unsigned int N>
+void Multiply(const SMatrixBatch<T, D1, D, N> &a, const SMatrixBatch<T, D, D2, N> &b, SMatrixBatch<T, D1, D2, N> &c)
+{
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *cij = c.Plane(i, j);
+         const T *ai0 = a.Plane(i, 0);
+         const T *b0j = b.Plane(0, j);
+         for (unsigned int n = 0; n < N; ++n)
+            cij[n] = ai0[n] * b0j[n];
+         for (unsigned int k = 1; k < D; ++k) {
+            const T *aik = a.Plane(i, k);
+            const T *bkj = b.Plane(k, j);
+            for (unsigned int n = 0; n < N; ++n)
+               cij[n] += aik[n] * bkj[n];
+         }
+      }
+   }
+}
+
+/// y = A * x for all matrices and vectors of the batch
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+void Multiply(const SMatrixBatch<T, D1, D2, N> &a, const SVectorBatch<T, D2, N> &x, SVectorBatch<T, D1, N> &y)
+{
+   for (unsigned int i = 0; i < D1; ++i) {
+      T *yi = y.Plane(i);
+      const T *ai0 = a.Plane(i, 0);
+      const T *x0 = x.Plane(0);
+      for (unsigned int n = 0; n < N; ++n)
+         yi[n] = ai0[n] * x0[n];
+      for (unsigned int k = 1; k < D2; ++k) {
+         const T *aik = a.Plane(i, k);
+         const T *xk = x.Plane(k);
+         for (unsigned int n = 0; n < N; ++n)
+            yi[n] += aik[n] * xk[n];
+      }
+   }
+}
+
+/// C = A * S * A^T for all matrices of the batch, with S symmetric; C is symmetric
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+void Similarity(const SMatrixBatch<T, D1, D2, N> &a, const SMatrixBatch<T, D2, D2, N> &s, SMatrixBatch<T, D1, D1, N> &c)
+{
+   SMatrixBatch<T, D1, D2, N> as;
+   Multiply(a, s, as);
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *cij = c.Plane(i, j);
+         const T *asi0 = as.Plane(i, 0);
+         const T *aj0 = a.Plane(j, 0);
+         for (unsigned int n = 0; n < N; ++n)
+            cij[n] = asi0[n] * aj0[n];
+         for (unsigned int k = 1; k < D2; ++k) {
+            const T *asik = as.Plane(i, k);
+            const T *ajk = a.Plane(j, k);
+            for (unsigned int n = 0; n < N; ++n)
+               cij[n] += asik[n] * ajk[n];
+         }
+         if (i != j) {
+            T *cji = c.Plane(j, i);
+            for (unsigned int n = 0; n < N; ++n)
+               cji[n] = cij[n];
+         }
+      }
+   }
+}
+
+/**
+   Invert all symmetric positive definite matrices of the batch in place,
+   through their Cholesky decomposition (see CholeskyDecomp for the single
+   matrix version). Returns true if all matrices are positive definite; if
+   ok is given, ok[n] tells whether matrix n was inverted. The content of the
+   matrices that are not positive definite is unspecified.
+*/
+template <class T, unsigned int D, unsigned int N>
+bool InvertChol(SMatrixBatch<T, D, D, N> &m, bool *ok = nullptr)
+{
+   // lower triangle of L, packed by rows, with the inverse of the diagonal
+   T l[D * (D + 1) / 2][N];
+   bool good[N];
+   for (unsigned int n = 0; n < N; ++n)
+      good[n] = true;
+
+   // decomposition m = L L^T
+   for (unsigned int j = 0; j < D; ++j) {
+      T *ljj = l[j * (j + 1) / 2 + j];
+      const T *mjj = m.Plane(j, j);
+      for (unsigned int n = 0; n < N; ++n)
+         ljj[n] = mjj[n];
+      for (unsigned int k = 0; k < j; ++k) {
+         const T *ljk = l[j * (j + 1) / 2 + k];
+         for (unsigned int n = 0; n < N; ++n)
+            ljj[n] -= ljk[n] * ljk[n];
+      }
+      for (unsigned int n = 0; n < N; ++n) {
+         good[n] = good[n] && ljj[n] > T(0);
+         // keep the lanes of failing matrices finite
+         ljj[n] = T(1) / std::sqrt(ljj[n] > T(0) ? ljj[n] : T(1));
+      }
+      for (unsigned int i = j + 1; i < D; ++i) {
+         T *lij = l[i * (i + 1) / 2 + j];
+         const T *mij = m.Plane(i, j);
+         for (unsigned int n = 0; n < N; ++n)
+            lij[n] = mij[n];
+         for (unsigned int k = 0; k < j; ++k) {
+            const T *lik = l[i * (i + 1) / 2 + k];
+            const T *ljk = l[j * (j + 1) / 2 + k];
+            for (unsigned int n = 0; n < N; ++n)
+               lij[n] -= lik[n] * ljk[n];
+         }
+         for (unsigned int n = 0; n < N; ++n)
+            lij[n] *= ljj[n];
+      }
+   }
+
+   // in place inversion of L, column by column
+   for (unsigned int j = 0; j < D; ++j) {
+      for (unsigned int i = j + 1; i < D; ++i) {
+         T *lij = l[i * (i + 1) / 2 + j];
+         const T *lii = l[i * (i + 1) / 2 + i];
+         const T *ljj = l[j * (j + 1) / 2 + j];
+         // sum over k in [j, i) of L(i,k) Linv(k,j), where Linv(j,j) is the stored inverse diagonal
+         for (unsigned int n = 0; n < N; ++n)
+            lij[n] *= ljj[n];
+         for (unsigned int k = j + 1; k < i; ++k) {
+            const T *lik = l[i * (i + 1) / 2 + k];
+            const T *lkj = l[k * (k + 1) / 2 + j];
+            for (unsigned int n = 0; n < N; ++n)
+               lij[n] += lik[n] * lkj[n];
+         }
+         for (unsigned int n = 0; n < N; ++n)
+            lij[n] *= -lii[n];
+      }
+   }
+
+   // m^-1 = Linv^T Linv
+   for (unsigned int i = 0; i < D; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *mij = m.Plane(i, j);
+         const T *lii = l[i * (i + 1) / 2 + i];
+         const T *lij = l[i * (i + 1) / 2 + j];
+         for (unsigned int n = 0; n < N; ++n)
+            mij[n] = lii[n] * lij[n];
+         for (unsigned int k = i + 1; k < D; ++k) {
+            const T *lki = l[k * (k + 1) / 2 + i];
+            const T *lkj = l[k * (k + 1) / 2 + j];
+            for (unsigned int n = 0; n < N; ++n)
+               mij[n] += lki[n] * lkj[n];
+         }
+         if (i != j) {
+            T *mji = m.Plane(j, i);
+            for (unsigned int n = 0; n < N; ++n)
+               mji[n] = mij[n];
+         }
+      }
+   }
+
+   bool all = true;
+   for (unsigned int n = 0; n < N; ++n) {
+      all = all && good[n];
+      if (ok)
+         ok[n] = good[n];
+   }
+   return all;
+}
+
+///\}
+
+} // namespace Math
+
+} // namespace ROOT
+
+#endif
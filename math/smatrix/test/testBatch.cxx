@@ -0,0 +1,102 @@
+// test of the batched SMatrix operations against the single matrix ones
+#include "Math/SMatrix.h"
+#include "Math/SMatrixBatch.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+using namespace ROOT::Math;
+
+constexpr unsigned int kN = 16;
+
+typedef SMatrix<double, 5, 5> SMatrix55;
+typedef SMatrix<double, 5, 5, MatRepSym<double, 5>> SMatrixSym5;
+
+bool isNear(const SMatrix55 &a, const SMatrix55 &b, double tol = 1e-10)
+{
+   for (unsigned int i = 0; i < 5; ++i)
+      for (unsigned int j = 0; j < 5; ++j)
+         if (std::abs(a(i, j) - b(i, j)) > tol * (1 + std::abs(b(i, j))))
+            return false;
+   return true;
+}
+
+SMatrix55 randomMatrix()
+{
+   SMatrix55 m;
+   for (unsigned int i = 0; i < 5; ++i)
+      for (unsigned int j = 0; j < 5; ++j)
+         m(i, j) = std::rand() / double(RAND_MAX) - 0.5;
+   return m;
+}
+
+int main()
+{
+   int iret = 0;
+
+   SMatrixBatch<double, 5, 5, kN> a, s, result;
+   SMatrix55 single[kN], cov[kN];
+   for (unsigned int n = 0; n < kN; ++n) {
+      single[n] = randomMatrix();
+      // positive definite
+      const SMatrix55 r = randomMatrix();
+      cov[n] = r * Transpose(r);
+      for (unsigned int i = 0; i < 5; ++i)
+         cov[n](i, i) += 1;
+      a.Load(n, single[n]);
+      s.Load(n, cov[n]);
+   }
+
+   Multiply(a, s, result);
+   for (unsigned int n = 0; n < kN; ++n) {
+      if (!isNear(result.Get(n), single[n] * cov[n])) {
+         std::cerr << "Multiply failed for matrix " << n << std::endl;
+         iret = 1;
+      }
+   }
+
+   Similarity(a, s, result);
+   for (unsigned int n = 0; n < kN; ++n) {
+      SMatrixSym5 covSym;
+      for (unsigned int i = 0; i < 5; ++i)
+         for (unsigned int j = 0; j <= i; ++j)
+            covSym(i, j) = cov[n](i, j);
+      SMatrix55 expected;
+      const SMatrixSym5 sim = ROOT::Math::Similarity(single[n], covSym);
+      for (unsigned int i = 0; i < 5; ++i)
+         for (unsigned int j = 0; j < 5; ++j)
+            expected(i, j) = sim(i, j);
+      if (!isNear(result.Get(n), expected)) {
+         std::cerr << "Similarity failed for matrix " << n << std::endl;
+         iret = 1;
+      }
+   }
+
+   bool ok[kN];
+   if (!InvertChol(s, ok)) {
+      std::cerr << "InvertChol failed for a positive definite matrix" << std::endl;
+      iret = 1;
+   }
+   for (unsigned int n = 0; n < kN; ++n) {
+      const SMatrix55 identity = SMatrixIdentity();
+      if (!ok[n] || !isNear(s.Get(n) * cov[n], identity)) {
+         std::cerr << "InvertChol failed for matrix " << n << std::endl;
+         iret = 1;
+      }
+   }
+
+   // a matrix that is not positive definite is reported
+   const SMatrix55 negative = -cov[0];
+   s.Load(0, negative);
+   s.Load(1, cov[1]);
+   InvertChol(s, ok);
+   if (ok[0] || !ok[1]) {
+      std::cerr << "InvertChol did not detect the matrix that is not positive definite" << std::endl;
+      iret = 1;
+   }
+
+   if (iret == 0)
+      std::cout << "Test of SMatrixBatch: OK" << std::endl;
+   return iret;
+}
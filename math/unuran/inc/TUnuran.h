@@ -209,6 +209,14 @@ public:
    */
    int SampleDiscr();
 
+   /**
+      Sample n values of a one-dimensional (continuous or discrete) distribution
+      and store them in x. This is equivalent to calling n times Sample() or
+      SampleDiscr(), without the overhead of a call per value.
+      Return false if the generator is not initialized or not one-dimensional.
+   */
+   bool SampleN(unsigned int n, double * x);
+
    /**
       Set the random engine.
       Must be called before init to have effect
@@ -166,6 +166,20 @@ public:
     */
    bool SampleBin(double prob, double & value, double *error = nullptr) override;
 
+   /**
+      sample n events and store them in x, one event after the other
+      (n * NDim() values). For one-dimensional distributions the values are
+      generated in a single loop inside TUnuran::SampleN
+   */
+   bool SampleN(unsigned int n, double * x);
+
+   using DistSampler::Generate;
+   /**
+      generate a vector of events, see DistSampler::Generate.
+      Uses SampleN for one-dimensional distributions
+   */
+   bool Generate(unsigned int nevt, double * data, bool eventRow = false) override;
+
 
 
 protected:
@@ -418,6 +418,22 @@ double TUnuran::Sample()
    return unur_sample_cont(fGen);
 }
 
+bool TUnuran::SampleN(unsigned int n, double * x)
+{
+   // sample n values of a one-dimensional distribution
+   if (fGen == nullptr) return false;
+   const UNUR_DISTR * distr = unur_get_distr(fGen);
+   if (unur_distr_is_discr(distr)) {
+      for (unsigned int i = 0; i < n; ++i)
+         x[i] = unur_sample_discr(fGen);
+      return true;
+   }
+   if (!unur_distr_is_cont(distr) && !unur_distr_is_cemp(distr)) return false;
+   for (unsigned int i = 0; i < n; ++i)
+      x[i] = unur_sample_cont(fGen);
+   return true;
+}
+
 bool TUnuran::SampleMulti(double * x)
 {
    // sample multidimensional distribution
@@ -277,6 +277,27 @@ bool TUnuranSampler::Sample(double * x) {
 }
 
 
+bool TUnuranSampler::SampleN(unsigned int n, double * x) {
+   // sample n events, stored one after the other
+   if (!fUnuran) return false;
+   if (fOneDim) return fUnuran->SampleN(n, x);
+   const unsigned int ndim = NDim();
+   for (unsigned int i = 0; i < n; ++i) {
+      if (!fUnuran->SampleMulti(x + i * ndim)) return false;
+   }
+   return true;
+}
+
+bool TUnuranSampler::Generate(unsigned int nevt, double * data, bool eventRow) {
+   // in one dimension the layout of the events does not matter
+   if (!fOneDim) return DistSampler::Generate(nevt, data, eventRow);
+   if (!IsInitialized()) {
+      Warning("TUnuranSampler::Generate","sampler has not been initialized correctly");
+      return false;
+   }
+   return SampleN(nevt, data);
+}
+
 bool TUnuranSampler::SampleBin(double prob, double & value, double *error) {
    // sample a bin according to Poisson statistics
    TRandom * r = fUnuran->GetRandom();
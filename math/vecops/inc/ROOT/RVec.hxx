@@ -121,6 +121,54 @@ auto MapFromTuple(Tuple_t &&t, std::index_sequence<Is...>)
    return MapImpl(std::get<tupleSizeM1>(t), std::get<Is>(t)...);
 }
 
+/// Return an RVec of size n with the elements f(i). For trivial types, the elements are assigned
+/// without the capacity check of emplace_back, so that the loop can be vectorized.
+template <typename T, typename F>
+RVec<T> FillRVec(std::size_t n, F &&f)
+{
+   RVec<T> ret;
+   if constexpr (std::is_trivially_default_constructible<T>::value) {
+      ret.resize(n);
+      T *out = ret.data();
+      for (std::size_t i = 0; i < n; ++i)
+         out[i] = f(i);
+   } else {
+      ret.reserve(n);
+      for (std::size_t i = 0; i < n; ++i)
+         ret.emplace_back(f(i));
+   }
+   return ret;
+}
+
+// Scalar kernels of the RVec functions taking the FastMath_t tag: vdt if available, std otherwise
+#ifdef R__HAS_VDT
+#define RVEC_FAST_KERNEL(F)                                                    \
+   template <typename T>                                                       \
+   T Fast_##F(T x)                                                             \
+   {                                                                           \
+      return std::F(x);                                                        \
+   }                                                                           \
+   inline float Fast_##F(float x) { return vdt::fast_##F##f(x); }              \
+   inline double Fast_##F(double x) { return vdt::fast_##F(x); }
+#else
+#define RVEC_FAST_KERNEL(F)                                                    \
+   template <typename T>                                                       \
+   T Fast_##F(T x)                                                             \
+   {                                                                           \
+      return std::F(x);                                                        \
+   }
+#endif
+
+RVEC_FAST_KERNEL(exp)
+RVEC_FAST_KERNEL(log)
+RVEC_FAST_KERNEL(sin)
+RVEC_FAST_KERNEL(cos)
+RVEC_FAST_KERNEL(tan)
+RVEC_FAST_KERNEL(asin)
+RVEC_FAST_KERNEL(acos)
+RVEC_FAST_KERNEL(atan)
+#undef RVEC_FAST_KERNEL
+
 /// Return the next power of two (in 64-bits) that is strictly greater than A.
 /// Return zero on overflow.
 inline uint64_t NextPowerOf2(uint64_t A)
@@ -160,6 +208,10 @@ protected:
    /// This function will report a fatal error if it cannot increase capacity.
    void grow_pod(void *FirstEl, size_t MinSize, size_t TSize);
 
+   /// Free the heap buffer of Bytes bytes of an RVec, or keep it for reuse if the buffer pool of
+   /// the calling thread is enabled (see RVecBufferPoolRAII).
+   static void free_buffer(void *Buffer, size_t Bytes);
+
    /// Report that MinSize doesn't fit into this vector's size type. Throws
    /// std::length_error or calls report_fatal_error.
    static void report_size_overflow(size_t MinSize);
@@ -194,6 +246,20 @@ public:
    }
 };
 
+/// Enable, for the lifetime of the object, the recycling of the heap buffers of RVecs on the calling thread.
+/// The buffers of the RVecs destroyed meanwhile are kept (a few for each power-of-two size up to 64 KiB)
+/// and reused by the next RVecs of a similar size, instead of being freed and allocated again.
+/// RDataFrame enables it in each task of the event loop, where the temporary RVecs of the expressions
+/// of Defines and Filters (e.g. `Jet_pt[Jet_eta < 2.4]`) are created and destroyed at each entry.
+/// The kept buffers are freed when the last such object of the thread is destroyed.
+class RVecBufferPoolRAII {
+public:
+   RVecBufferPoolRAII();
+   ~RVecBufferPoolRAII();
+   RVecBufferPoolRAII(const RVecBufferPoolRAII &) = delete;
+   RVecBufferPoolRAII &operator=(const RVecBufferPoolRAII &) = delete;
+};
+
 /// Used to figure out the offset of the first element of an RVec
 template <class T>
 struct SmallVectorAlignmentAndSize {
@@ -413,7 +479,7 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
 
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall())
-         free(this->begin());
+         this->free_buffer(this->begin(), this->capacity() * sizeof(T));
    }
 
    this->fBeginX = NewElts;
@@ -579,7 +645,7 @@ public:
       // Subclass has already destructed this vector's elements.
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall() && this->Owns())
-         free(this->begin());
+         this->free_buffer(this->begin(), this->capacity() * sizeof(T));
    }
 
    // also give up adopted memory if applicable
@@ -1056,7 +1122,7 @@ RVecImpl<T> &RVecImpl<T>::operator=(RVecImpl<T> &&RHS)
       if (this->Owns()) {
          this->destroy_range(this->begin(), this->end());
          if (!this->isSmall())
-            free(this->begin());
+            this->free_buffer(this->begin(), this->capacity() * sizeof(T));
       }
       this->fBeginX = RHS.fBeginX;
       this->fSize = RHS.fSize;
@@ -1430,6 +1496,10 @@ are vectorized:
  - fast_expf, fast_logf, fast_sinf, fast_cosf, fast_tanf, fast_asinf, fast_acosf, fast_atanf
  - fast_exp, fast_log, fast_sin, fast_cos, fast_tan, fast_asin, fast_acos, fast_atan
 
+The same functions can be selected with the `kFastMath` tag, for float and double elements alike,
+e.g. `exp(v, kFastMath)`. Without VDT, the tagged overloads use the std functions:
+ - exp, log, sin, cos, tan, asin, acos, atan
+
 \anchor owningandadoptingmemory
 ## Owning and adopting memory
 RVec has contiguous memory associated to it. It can own it or simply adopt it. In the latter case,
@@ -1906,6 +1976,40 @@ RVEC_VDT_UNARY_FUNCTION(fast_atan)
 
 #undef RVEC_UNARY_FUNCTION
 
+///@}
+///@name RVec Fast Mathematical Functions selected by a Tag
+///@{
+
+/// Tag selecting the fast approximations of the mathematical functions, e.g. `exp(v, kFastMath)`.
+/// If the VDT library is available, its inlined functions (e.g. vdt::fast_expf for floats and
+/// vdt::fast_exp for doubles) are used, which the compiler vectorizes, otherwise the std functions.
+struct FastMath_t {};
+inline constexpr FastMath_t kFastMath{};
+
+#define RVEC_FAST_UNARY_FUNCTION(F)                                            \
+   template <typename T>                                                       \
+   RVec<PromoteType<T>> F(const RVec<T> &v, FastMath_t)                        \
+   {                                                                           \
+      using Ret_t = PromoteType<T>;                                            \
+      const std::size_t size = v.size();                                       \
+      RVec<Ret_t> ret(size);                                                   \
+      const T *in = v.data();                                                  \
+      Ret_t *out = ret.data();                                                 \
+      for (std::size_t i = 0; i < size; ++i)                                   \
+         out[i] = ROOT::Internal::VecOps::Fast_##F(static_cast<Ret_t>(in[i])); \
+      return ret;                                                              \
+   }
+
+RVEC_FAST_UNARY_FUNCTION(exp)
+RVEC_FAST_UNARY_FUNCTION(log)
+RVEC_FAST_UNARY_FUNCTION(sin)
+RVEC_FAST_UNARY_FUNCTION(cos)
+RVEC_FAST_UNARY_FUNCTION(tan)
+RVEC_FAST_UNARY_FUNCTION(asin)
+RVEC_FAST_UNARY_FUNCTION(acos)
+RVEC_FAST_UNARY_FUNCTION(atan)
+#undef RVEC_FAST_UNARY_FUNCTION
+
 ///@}
 
 /// Inner product
@@ -2791,14 +2895,7 @@ RVec<T> Intersect(const RVec<T>& v1, const RVec<T>& v2, bool v2_is_sorted = fals
 template <typename T>
 RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2[i]);
-   }
-   return r;
+   return ROOT::Internal::VecOps::FillRVec<T>(c.size(), [&](std::size_t i) { return c[i] != 0 ? v1[i] : v2[i]; });
 }
 
 /// Return the elements of v1 if the condition c is true and sets the value v2
@@ -2819,14 +2916,7 @@ RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 template <typename T>
 RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_type v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2);
-   }
-   return r;
+   return ROOT::Internal::VecOps::FillRVec<T>(c.size(), [&](std::size_t i) { return c[i] != 0 ? v1[i] : v2; });
 }
 
 /// Return the elements of v2 if the condition c is false and sets the value v1
@@ -2847,14 +2937,7 @@ RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_typ
 template <typename T>
 RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>& v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2[i]);
-   }
-   return r;
+   return ROOT::Internal::VecOps::FillRVec<T>(c.size(), [&](std::size_t i) { return c[i] != 0 ? v1 : v2[i]; });
 }
 
 /// Return a vector with the value v2 if the condition c is false and sets the
@@ -2873,14 +2956,7 @@ RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>
 template <typename T>
 RVec<T> Where(const RVec<int>& c, T v1, T v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2);
-   }
-   return r;
+   return ROOT::Internal::VecOps::FillRVec<T>(c.size(), [&](std::size_t i) { return c[i] != 0 ? v1 : v2; });
 }
 
 /// Return the concatenation of two RVecs.
@@ -2988,8 +3064,15 @@ RVec<Common_t> DeltaPhi(T0 v1, const RVec<T1>& v2, const Common_t c = M_PI)
 template <typename T0, typename T1 = T0, typename T2 = T0, typename T3 = T0, typename Common_t = std::common_type_t<T0, T1, T2, T3>>
 RVec<Common_t> DeltaR2(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2>& phi1, const RVec<T3>& phi2, const Common_t c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   const auto size = ROOT::Internal::VecOps::GetVectorsSize("DeltaR2", eta1, eta2, phi1, phi2);
+   // a single loop, without the temporary RVecs of the arithmetic operators
+   RVec<Common_t> r(size);
+   for (std::size_t i = 0; i < size; ++i) {
+      const Common_t deta = eta1[i] - eta2[i];
+      const Common_t dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = deta * deta + dphi * dphi;
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -3002,7 +3085,10 @@ RVec<Common_t> DeltaR2(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2
 template <typename T0, typename T1 = T0, typename T2 = T0, typename T3 = T0, typename Common_t = std::common_type_t<T0, T1, T2, T3>>
 RVec<Common_t> DeltaR(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2>& phi1, const RVec<T3>& phi2, const Common_t c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   auto r = DeltaR2(eta1, eta2, phi1, phi2, c);
+   for (auto &x : r)
+      x = std::sqrt(x);
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -34,6 +34,79 @@ static_assert(sizeof(RVec<void *>) ==
                     (1 + ROOT::Internal::VecOps::RVecInlineStorageSize<void *>::value) * sizeof(void *),
               "wasted space in RVec");
 
+namespace {
+/// Heap buffers of destroyed RVecs kept for reuse by the thread, by power-of-two size class.
+/// It is trivially destructible, so that it can still be used by RVecs destroyed at thread exit.
+struct RVecBufferPool {
+   static constexpr unsigned kMinLog2 = 6;    // 64 B: smaller buffers are not worth keeping
+   static constexpr unsigned kMaxLog2 = 16;   // 64 KiB
+   static constexpr unsigned kMaxBuffers = 8; // per size class
+   static constexpr unsigned kNClasses = kMaxLog2 - kMinLog2 + 1;
+
+   unsigned fNActive;                      ///< number of RVecBufferPoolRAII alive on the thread
+   unsigned fNBuffers[kNClasses];          ///< number of buffers kept in each size class
+   void *fBuffers[kNClasses][kMaxBuffers]; ///< buffers of 2^(kMinLog2 + class) bytes or more
+
+   void Clear()
+   {
+      for (unsigned c = 0; c < kNClasses; ++c) {
+         for (unsigned i = 0; i < fNBuffers[c]; ++i)
+            free(fBuffers[c][i]);
+         fNBuffers[c] = 0;
+      }
+   }
+};
+
+thread_local RVecBufferPool gBufferPool{};
+
+/// Allocate a buffer of at least Bytes bytes, which on return holds the actual size of the buffer.
+/// If the pool is enabled, the buffer is taken from the pool if possible, and its size rounded up to a power of two.
+void *AllocateBuffer(size_t &Bytes)
+{
+   RVecBufferPool &pool = gBufferPool;
+   if (pool.fNActive > 0 && Bytes <= (size_t(1) << RVecBufferPool::kMaxLog2)) {
+      unsigned log2 = RVecBufferPool::kMinLog2;
+      while ((size_t(1) << log2) < Bytes)
+         ++log2;
+      Bytes = size_t(1) << log2;
+      const unsigned c = log2 - RVecBufferPool::kMinLog2;
+      if (pool.fNBuffers[c] > 0)
+         return pool.fBuffers[c][--pool.fNBuffers[c]];
+   }
+   return malloc(Bytes);
+}
+} // namespace
+
+ROOT::Internal::VecOps::RVecBufferPoolRAII::RVecBufferPoolRAII()
+{
+   ++gBufferPool.fNActive;
+}
+
+ROOT::Internal::VecOps::RVecBufferPoolRAII::~RVecBufferPoolRAII()
+{
+   RVecBufferPool &pool = gBufferPool;
+   if (--pool.fNActive == 0)
+      pool.Clear();
+}
+
+void ROOT::Internal::VecOps::SmallVectorBase::free_buffer(void *Buffer, size_t Bytes)
+{
+   RVecBufferPool &pool = gBufferPool;
+   if (pool.fNActive > 0 && Bytes >= (size_t(1) << RVecBufferPool::kMinLog2) &&
+       Bytes < (size_t(2) << RVecBufferPool::kMaxLog2)) {
+      // the buffer goes into the class of the largest power of two it can hold
+      unsigned log2 = RVecBufferPool::kMinLog2;
+      while ((size_t(2) << log2) <= Bytes)
+         ++log2;
+      const unsigned c = log2 - RVecBufferPool::kMinLog2;
+      if (pool.fNBuffers[c] < RVecBufferPool::kMaxBuffers) {
+         pool.fBuffers[c][pool.fNBuffers[c]++] = Buffer;
+         return;
+      }
+   }
+   free(Buffer);
+}
+
 void ROOT::Internal::VecOps::SmallVectorBase::report_size_overflow(size_t MinSize)
 {
    std::string Reason = "RVec unable to grow. Requested capacity (" + std::to_string(MinSize) +
@@ -68,12 +141,19 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    NewCapacity = std::min(std::max(NewCapacity, MinSize), SizeTypeMax());
 
    void *NewElts;
+   size_t NewBytes = NewCapacity * TSize;
    if (fBeginX == FirstEl || !this->Owns()) {
-      NewElts = malloc(NewCapacity * TSize);
+      NewElts = AllocateBuffer(NewBytes);
       R__ASSERT(NewElts != nullptr);
 
       // Copy the elements over.  No need to run dtors on PODs.
       memcpy(NewElts, this->fBeginX, size() * TSize);
+   } else if (gBufferPool.fNActive > 0) {
+      // Take a buffer from the pool, and give it the old one, rather than reallocating.
+      NewElts = AllocateBuffer(NewBytes);
+      R__ASSERT(NewElts != nullptr);
+      memcpy(NewElts, this->fBeginX, size() * TSize);
+      free_buffer(this->fBeginX, capacity() * TSize);
    } else {
       // If this wasn't grown from the inline copy, grow the allocated space.
       NewElts = realloc(this->fBeginX, NewCapacity * TSize);
@@ -81,7 +161,7 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    }
 
    this->fBeginX = NewElts;
-   this->fCapacity = NewCapacity;
+   this->fCapacity = std::min(NewBytes / TSize, SizeTypeMax());
 }
 
 #if (_VECOPS_USE_EXTERN_TEMPLATES)
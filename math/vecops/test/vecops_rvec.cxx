@@ -493,6 +493,38 @@ TEST(VecOps, MathFuncs)
 #endif
 }
 
+TEST(VecOps, FastMathFuncs)
+{
+   RVec<double> v{0.1, 0.2, 0.5, 0.9};
+   RVec<float> vf{0.1f, 0.2f, 0.5f, 0.9f};
+   // integers are promoted to double
+   RVec<int> vi{1};
+
+#define CHECK_FAST_FUNC(F)                                                                  \
+   {                                                                                        \
+      auto r = F(v, kFastMath);                                                             \
+      auto rf = F(vf, kFastMath);                                                           \
+      static_assert(std::is_same<decltype(rf), RVec<float>>::value, "wrong type of " #F);   \
+      auto ri = F(vi, kFastMath);                                                           \
+      static_assert(std::is_same<decltype(ri), RVec<double>>::value, "wrong type of " #F);  \
+      for (std::size_t i = 0; i < v.size(); ++i) {                                          \
+         EXPECT_NEAR(r[i], std::F(v[i]), 1e-14) << "error checking fast function " #F;      \
+         EXPECT_NEAR(rf[i], std::F(vf[i]), 1e-6) << "error checking fast function " #F;     \
+      }                                                                                     \
+      EXPECT_NEAR(ri[0], std::F(1.), 1e-14) << "error checking fast function " #F;          \
+   }
+
+   CHECK_FAST_FUNC(exp)
+   CHECK_FAST_FUNC(log)
+   CHECK_FAST_FUNC(sin)
+   CHECK_FAST_FUNC(cos)
+   CHECK_FAST_FUNC(tan)
+   CHECK_FAST_FUNC(asin)
+   CHECK_FAST_FUNC(acos)
+   CHECK_FAST_FUNC(atan)
+#undef CHECK_FAST_FUNC
+}
+
 TEST(VecOps, PhysicsSelections)
 {
    // We emulate 8 muons
@@ -1110,6 +1142,34 @@ TEST(VecOps, Intersect)
    CheckEqual(v6, ref1);
 }
 
+TEST(VecOps, BufferPool)
+{
+   ROOT::Internal::VecOps::RVecBufferPoolRAII pool;
+   const double *buffer = nullptr;
+   {
+      RVecD v(100, 1.);
+      buffer = v.data();
+   }
+   // the buffer of the destroyed RVec is reused
+   {
+      RVecD v(100, 2.);
+      EXPECT_EQ(v.data(), buffer);
+      EXPECT_GE(v.capacity(), 100u);
+      CheckEqual(v, RVecD(100, 2.));
+      // growing takes a larger buffer and gives back the old one
+      v.resize(1000, 3.);
+      EXPECT_NE(v.data(), buffer);
+      EXPECT_EQ(v[99], 2.);
+      EXPECT_EQ(v[999], 3.);
+      RVecD v1(100, 4.);
+      EXPECT_EQ(v1.data(), buffer);
+      buffer = v.data();
+   }
+   RVecD v(1000, 5.);
+   EXPECT_EQ(v.data(), buffer);
+   CheckEqual(v, RVecD(1000, 5.));
+}
+
 TEST(VecOps, Where)
 {
    // Use two vectors as arguments
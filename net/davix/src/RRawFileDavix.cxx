@@ -10,6 +10,7 @@
  *************************************************************************/
 
 #include "ROOT/RRawFileDavix.hxx"
+#include "TDavixFileInternal.h"
 
 #include <TError.h>
 
@@ -27,14 +28,16 @@ constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k b
 namespace ROOT {
 namespace Internal {
 
+/// All RRawFileDavix instances share the process-wide Davix context of TDavixFile, so that their requests reuse
+/// the pooled sessions instead of connecting to the server again for every file
 struct RDavixFileDes {
-   RDavixFileDes() : fd(nullptr), pos(&ctx) {}
+   RDavixFileDes() : fd(nullptr), ctx(TDavixFileInternal::getDavixInstance()), pos(ctx) {}
    RDavixFileDes(const RDavixFileDes &) = delete;
    RDavixFileDes &operator=(const RDavixFileDes &) = delete;
    ~RDavixFileDes() = default;
 
    DAVIX_FD *fd;
-   Davix::Context ctx;
+   Davix::Context *ctx;
    Davix::DavPosix pos;
 };
 
@@ -102,6 +105,17 @@ void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       R__ASSERT(ioVec[i].fSize > 0);
    }
 
+   if (TDavixFileInternal::getNumRangeRequests(nReq) > 1) {
+      std::string errMsg;
+      auto ret =
+         TDavixFileInternal::readVecConcurrent(fFileDes->ctx, nullptr, fUrl, in.data(), out.data(), nReq, errMsg);
+      if (ret < 0)
+         throw std::runtime_error("Cannot do vector read from '" + fUrl + "', error: " + errMsg);
+      for (unsigned int i = 0; i < nReq; ++i)
+         ioVec[i].fOutBytes = out[i].diov_size;
+      return;
+   }
+
    auto ret = fFileDes->pos.preadVec(fFileDes->fd, in.data(), out.data(), nReq, &davixErr);
    if (ret < 0) {
       throw std::runtime_error("Cannot do vector read from '" + fUrl + "', error: " + davixErr->getErrMsg());
@@ -51,6 +51,7 @@
 #include <string>
 #include <cstring>
 #include <memory>
+#include <thread>
 
 static const std::string VERSION = "0.2.0";
 
@@ -360,6 +361,68 @@ Context *TDavixFileInternal::getDavixInstance()
    return davix_context_s;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Number of range requests that a vector read of `nbuf` buffers is split into.
+/// The requests are sent concurrently and are served by the session pool of the
+/// shared Davix context, so that several connections to the same endpoint are
+/// kept busy. The maximum is set by Davix.ConcurrentRanges (default 4); 1
+/// sends every vector read as a single request.
+
+Int_t TDavixFileInternal::getNumRangeRequests(Int_t nbuf)
+{
+   // Below this number of ranges per request, splitting does not pay off
+   constexpr Int_t kMinRangesPerRequest = 8;
+   static const Int_t maxRequests = std::max(1, gEnv->GetValue("Davix.ConcurrentRanges", 4));
+   return std::min(maxRequests, (nbuf + kMinRangesPerRequest - 1) / kMinRangesPerRequest);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the `nbuf` ranges described by `in` with getNumRangeRequests(nbuf)
+/// concurrent multi-range requests. Returns the number of bytes read, or -1
+/// with the error message in `errMsg`.
+
+Long64_t TDavixFileInternal::readVecConcurrent(Context *context, const RequestParams *params,
+                                               const std::string &url, DavIOVecInput *in,
+                                               DavIOVecOuput *out, Int_t nbuf, std::string &errMsg)
+{
+   const Int_t nRequests = std::max(1, getNumRangeRequests(nbuf));
+   std::vector<Long64_t> results(nRequests, -1);
+   std::vector<std::string> errors(nRequests);
+
+   auto readSlice = [&](Int_t slice) {
+      const Int_t first = slice * nbuf / nRequests;
+      const Int_t last = (slice + 1) * nbuf / nRequests;
+      DavixError *davixErr = NULL;
+      try {
+         DavFile file(*context, Davix::Uri(url));
+         results[slice] = file.readPartialBufferVec(params, in + first, out + first, last - first, &davixErr);
+      } catch (const std::exception &e) {
+         errors[slice] = e.what();
+         return;
+      }
+      if (results[slice] < 0)
+         errors[slice] = davixErr ? davixErr->getErrMsg() : "unknown error";
+      DavixError::clearError(&davixErr);
+   };
+
+   std::vector<std::thread> threads;
+   for (Int_t slice = 1; slice < nRequests; ++slice)
+      threads.emplace_back(readSlice, slice);
+   readSlice(0);
+   for (auto &t : threads)
+      t.join();
+
+   Long64_t total = 0;
+   for (Int_t slice = 0; slice < nRequests; ++slice) {
+      if (results[slice] < 0) {
+         errMsg = errors[slice];
+         return -1;
+      }
+      total += results[slice];
+   }
+   return total;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Davix_fd *TDavixFileInternal::Open()
@@ -793,6 +856,13 @@ Bool_t TDavixFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
 
+   if (auto cache = GetBlockCache()) {
+      return ReadBuffersBlockCached(*cache, buf, pos, len, nbuf,
+                                    [this, fd](char *b, Long64_t *p, Int_t *l, Int_t n) {
+                                       return DavixReadBuffers(fd, b, p, l, n) < 0;
+                                    });
+   }
+
    Long64_t ret = DavixReadBuffers(fd, buf, pos, len, nbuf);
    if (ret < 0)
       return kTRUE;
@@ -983,6 +1053,17 @@ Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, In
       lastPos += len[i];
    }
 
+   if (TDavixFileInternal::getNumRangeRequests(nbuf) > 1) {
+      std::string errMsg;
+      Long64_t ret = TDavixFileInternal::readVecConcurrent(d_ptr->davixContext, d_ptr->davixParam,
+                                                           d_ptr->fUrl.GetUrl(), in.get(), out.get(), nbuf, errMsg);
+      if (ret < 0)
+         Error("DavixReadBuffers", "can not read data with davix: %s", errMsg.c_str());
+      else
+         eventStop(start_time, ret);
+      return ret;
+   }
+
    Long64_t ret = d_ptr->davixPosix->preadVec(fd, in.get(), out.get(), nbuf, &davixErr);
    if (ret < 0) {
       Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
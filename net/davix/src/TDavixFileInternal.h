@@ -46,6 +46,8 @@ namespace Davix {
    class RequestParams;
    class DavPosix;
    class DavFile;
+   struct DavIOVecInput;
+   struct DavIOVecOuput;
 }
 struct Davix_fd;
 
@@ -142,6 +144,12 @@ public:
    Int_t DavixStat(const char *url, struct stat *st);
 
    static Davix::Context* getDavixInstance();
+
+   static Int_t getNumRangeRequests(Int_t nbuf);
+
+   static Long64_t readVecConcurrent(Davix::Context *context, const Davix::RequestParams *params,
+                                     const std::string &url, Davix::DavIOVecInput *in,
+                                     Davix::DavIOVecOuput *out, Int_t nbuf, std::string &errMsg);
 };
 
 #endif
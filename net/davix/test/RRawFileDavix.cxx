@@ -2,6 +2,7 @@
 #include "ROOT/RRawFileDavix.hxx"
 
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -63,3 +64,26 @@ TEST(RRawFileDavix, ReadV)
    EXPECT_EQ('H', buffer[0]);
    EXPECT_EQ('d', buffer[1]);
 }
+
+TEST(RRawFileDavix, ReadVConcurrent)
+{
+   // Enough ranges for the vector read to be split into several concurrent requests
+   RRawFile::ROptions options;
+   options.fBlockSize = 0;
+   std::unique_ptr<RRawFileDavix> f(new RRawFileDavix("http://root.cern/files/davix.test", options));
+
+   const std::string expected = "Hello, World";
+   std::vector<char> buffer(expected.size(), 0);
+   std::vector<RRawFile::RIOVec> iovec(expected.size());
+   for (std::size_t i = 0; i < expected.size(); ++i) {
+      iovec[i].fBuffer = &buffer[i];
+      iovec[i].fOffset = i;
+      iovec[i].fSize = 1;
+   }
+   f->ReadV(iovec.data(), iovec.size());
+
+   for (std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(1U, iovec[i].fOutBytes);
+      EXPECT_EQ(expected[i], buffer[i]);
+   }
+}
@@ -60,6 +60,18 @@ protected:
    std::mutex fWSMutex;                                      ///<! mutex to protect WS handler lists
    std::vector<std::shared_ptr<THttpWSHandler>> fWSHandlers; ///<! list of WS handlers
 
+   /** Snapshot of an object published by the application */
+   struct PublishedObject {
+      std::string fSubfolder;      ///<! folder where the snapshot is registered
+      TObject *fSnapshot{nullptr}; ///<! copy registered in the sniffer
+      TObject *fPending{nullptr};  ///<! newer copy, registered before processing next requests
+   };
+
+   std::mutex fPublishMutex;                              ///<! mutex to protect published objects
+   std::map<const TObject *, PublishedObject> fPublished; ///<! snapshots of the published objects
+   std::vector<TObject *> fRetiredSnapshots;             ///<! snapshots to unregister and delete
+   Bool_t fPublishChanged{kFALSE};                        ///<! true when new snapshots have to be registered
+
    virtual void MissedRequest(THttpCallArg *arg);
 
    virtual void ProcessRequest(std::shared_ptr<THttpCallArg> arg);
@@ -68,6 +80,8 @@ protected:
 
    void StopServerThread();
 
+   void UpdatePublished();
+
    std::string BuildWSEntryPage();
 
    void ReplaceJSROOTLinks(std::shared_ptr<THttpCallArg> &arg, const std::string &version = "");
@@ -159,6 +173,9 @@ public:
    /** Unregister object */
    Bool_t Unregister(TObject *obj);
 
+   /** Register or update snapshot of object in subfolder */
+   Bool_t Publish(const char *subfolder, TObject *obj);
+
    /** Register WS handler*/
    void RegisterWS(std::shared_ptr<THttpWSHandler> ws);
 
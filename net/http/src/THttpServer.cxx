@@ -19,6 +19,7 @@
 #include "TEnv.h"
 #include "TError.h"
 #include "TClass.h"
+#include "TDirectory.h"
 #include "RConfigure.h"
 #include "TRegexp.h"
 #include "TObjArray.h"
@@ -254,6 +255,18 @@ THttpServer::~THttpServer()
 
    fEngines.Delete();
 
+   for (auto &entry : fPublished) {
+      fRetiredSnapshots.emplace_back(entry.second.fSnapshot);
+      fRetiredSnapshots.emplace_back(entry.second.fPending);
+   }
+   fPublished.clear();
+   for (auto obj : fRetiredSnapshots) {
+      if (fSniffer)
+         fSniffer->UnregisterObject(obj);
+      delete obj;
+   }
+   fRetiredSnapshots.clear();
+
    SetSniffer(nullptr);
 
    SetTimer(0);
@@ -726,8 +739,10 @@ Int_t THttpServer::ProcessRequests()
       }
    }
 
-   if (!recursion)
+   if (!recursion) {
       fProcessingThrdId = id;
+      UpdatePublished();
+   }
 
    Int_t cnt = 0;
 
@@ -1249,9 +1264,109 @@ Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 
 Bool_t THttpServer::Unregister(TObject *obj)
 {
+   {
+      std::lock_guard<std::mutex> grd(fPublishMutex);
+      auto iter = fPublished.find(obj);
+      if (iter != fPublished.end()) {
+         // snapshots are unregistered and deleted in the thread processing the requests
+         fRetiredSnapshots.emplace_back(iter->second.fSnapshot);
+         fRetiredSnapshots.emplace_back(iter->second.fPending);
+         fPublished.erase(iter);
+         fPublishChanged = kTRUE;
+         return kTRUE;
+      }
+   }
    return fSniffer->UnregisterObject(obj);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Publish snapshot of the object in the folders hierarchy
+///
+/// A copy of the object is registered in the subfolder (see Register()) instead of the
+/// object itself, and is replaced by a new copy at each following call of Publish().
+/// The requests only access the copy, hence they can be processed in the server thread
+/// (see CreateServerThread()) while the application keeps modifying the object: the
+/// application is not blocked by the requests, it only copies the object and hands it
+/// over to the thread processing the requests, which registers it before its next
+/// requests. Unregister() with the original object removes the snapshot.
+///
+///     serv->CreateServerThread();
+///     for (...) {
+///        hist->Fill(...);
+///        if (update)
+///           serv->Publish("/Monitoring", hist);
+///     }
+
+Bool_t THttpServer::Publish(const char *subfolder, TObject *obj)
+{
+   if (!obj)
+      return kFALSE;
+
+   TObject *copy = nullptr;
+   {
+      // the copy must not be added to the current directory, as histograms do
+      TDirectory::TContext ctxt(nullptr);
+      copy = obj->Clone();
+   }
+   if (!copy)
+      return kFALSE;
+
+   TObject *prev = nullptr;
+   {
+      std::lock_guard<std::mutex> grd(fPublishMutex);
+      auto &entry = fPublished[obj];
+      if (entry.fSubfolder.empty())
+         entry.fSubfolder = subfolder ? subfolder : "";
+      // a copy not yet registered can be deleted directly
+      prev = entry.fPending;
+      entry.fPending = copy;
+      fPublishChanged = kTRUE;
+   }
+   delete prev;
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register the new snapshots of the published objects, and delete the replaced ones
+///
+/// Called in the thread processing the requests, before processing them
+
+void THttpServer::UpdatePublished()
+{
+   std::vector<PublishedObject> changed;
+   std::vector<TObject *> retired;
+   {
+      std::lock_guard<std::mutex> grd(fPublishMutex);
+      if (!fPublishChanged)
+         return;
+      for (auto &entry : fPublished) {
+         if (entry.second.fPending) {
+            changed.emplace_back(entry.second);
+            entry.second.fSnapshot = entry.second.fPending;
+            entry.second.fPending = nullptr;
+         }
+      }
+      std::swap(retired, fRetiredSnapshots);
+      fPublishChanged = kFALSE;
+   }
+
+   for (auto &entry : changed) {
+      if (entry.fSnapshot) {
+         fSniffer->UnregisterObject(entry.fSnapshot);
+         delete entry.fSnapshot;
+      }
+      fSniffer->RegisterObject(entry.fSubfolder.c_str(), entry.fPending);
+   }
+
+   for (auto obj : retired) {
+      if (obj) {
+         fSniffer->UnregisterObject(obj);
+         delete obj;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Register WS handler to the THttpServer
 ///
@@ -1151,9 +1151,15 @@ Bool_t TRootSniffer::ProduceJson(const std::string &path, const std::string &opt
    if (!obj_ptr || (!obj_cl && !member))
       return kFALSE;
 
-   // TODO: implement direct storage into std::string
-   TString buf = TBufferJSON::ConvertToJSON(obj_ptr, obj_cl, compact >= 0 ? compact : 0, member ? member->GetName() : nullptr);
-   res = buf.Data();
+   if (member) {
+      TString buf = TBufferJSON::ConvertToJSON(obj_ptr, obj_cl, compact >= 0 ? compact : 0, member->GetName());
+      res = buf.Data();
+   } else {
+      // store JSON code directly in the reply, without an intermediate copy of the complete object
+      res.clear();
+      TBufferJSON::ExportToSink([&res](const char *data, std::size_t len) { res.append(data, len); }, obj_ptr,
+                                obj_cl, compact >= 0 ? compact : 0);
+   }
 
    return !res.empty();
 }
@@ -36,6 +36,15 @@
 #include "TStreamerInfo.h"
 #include "TProcessID.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <vector>
+#ifndef R__WIN32
+#include <climits>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
 
 ULong64_t TSocket::fgBytesSent = 0;
 ULong64_t TSocket::fgBytesRecv = 0;
@@ -641,6 +650,85 @@ Int_t TSocket::SendRaw(const void *buffer, Int_t length, ESendRecvOptions opt)
    return nsent;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Send nbuffers raw buffers back to back, as if they were one buffer, with
+/// a single gather system call (sendmsg) instead of first copying them into
+/// a contiguous buffer. Returns the total number of bytes sent or -1 in case
+/// of error. Returns -5 if pipe broken or reset by peer (EPIPE || ECONNRESET).
+/// Derived sockets with their own transport (e.g. TPSocket, TSSLSocket) and
+/// Windows send the buffers one by one with SendRaw().
+
+Int_t TSocket::SendRawV(const void *const *buffers, const Int_t *lengths, Int_t nbuffers)
+{
+#ifndef R__WIN32
+   TSystem::ResetErrno();
+
+   if (!IsValid()) return -1;
+
+   if (IsA() == TSocket::Class()) {
+      ResetBit(TSocket::kBrokenConn);
+
+      std::vector<iovec> iov;
+      iov.reserve(nbuffers);
+      for (Int_t i = 0; i < nbuffers; ++i) {
+         if (lengths[i] > 0)
+            iov.push_back(iovec{const_cast<void *>(buffers[i]), static_cast<size_t>(lengths[i])});
+      }
+
+      Int_t nsent = 0;
+      std::size_t first = 0;
+      while (first < iov.size()) {
+         msghdr msg = {};
+         msg.msg_iov = iov.data() + first;
+         msg.msg_iovlen = std::min<std::size_t>(iov.size() - first, IOV_MAX);
+#ifdef MSG_NOSIGNAL
+         ssize_t n = sendmsg(fSocket, &msg, MSG_NOSIGNAL);
+#else
+         ssize_t n = sendmsg(fSocket, &msg, 0);
+#endif
+         if (n < 0) {
+            if (errno == EINTR)
+               continue;
+            if (errno == EPIPE || errno == ECONNRESET) {
+               MarkBrokenConnection();
+               return -5;
+            }
+            SysError("SendRawV", "cannot send buffers");
+            return -1;
+         }
+         nsent += n;
+         // Skip the fully sent buffers and advance into the partially sent one
+         while (n > 0 && first < iov.size()) {
+            std::size_t step = std::min<std::size_t>(n, iov[first].iov_len);
+            iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + step;
+            iov[first].iov_len -= step;
+            n -= step;
+            if (iov[first].iov_len == 0)
+               ++first;
+         }
+      }
+
+      fBytesSent  += nsent;
+      fgBytesSent += nsent;
+
+      Touch();  // update usage timestamp
+
+      return nsent;
+   }
+#endif
+
+   Int_t nsent = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      if (lengths[i] <= 0)
+         continue;
+      Int_t n = SendRaw(buffers[i], lengths[i]);
+      if (n <= 0)
+         return n;
+      nsent += n;
+   }
+   return nsent;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Check if TStreamerInfo must be sent. The list of TStreamerInfo of classes
 /// in the object in the message is in the fInfos list of the message.
@@ -51,12 +51,16 @@ private:
    Int_t                   fReadvIorMax; // Max size of a single readv chunk
    Int_t                   fReadvIovMax; // Max number of readv chunks
    Int_t                   fQueryReadVParams;
+   Int_t                   fReadvCoalesceGap; // Max gap of merged readv chunks, -1 for adaptive
+   Double_t                fReadvLatency;     // Smallest readv round trip seen, in seconds
+   Double_t                fReadvBandwidth;   // Readv throughput estimate, in bytes per second
    TString                 fNewUrl;
 
 public:
    TNetXNGFile() : TFile(),
       fFile(nullptr), fUrl(nullptr), fMode(XrdCl::OpenFlags::None), fInitCondVar(nullptr),
-      fReadvIorMax(0), fReadvIovMax(0) {}
+      fReadvIorMax(0), fReadvIovMax(0), fQueryReadVParams(1), fReadvCoalesceGap(-1),
+      fReadvLatency(0), fReadvBandwidth(0) {}
    TNetXNGFile(const char *url, const char *lurl, Option_t *mode, const char *title,
                Int_t compress, Int_t netopt, Bool_t parallelopen);
    TNetXNGFile(const char *url, Option_t *mode = "", const char *title = "",
@@ -83,6 +87,10 @@ private:
    virtual Bool_t IsUseable() const;
    virtual Bool_t GetVectorReadLimits();
    virtual void   SetEnv();
+   Bool_t   ReadBuffersRemote(char *buffer, Long64_t *position, Int_t *length, Int_t nbuffs);
+   Int_t    GetReadvCoalesceGap() const;
+   Long64_t GetReadvRequestSize() const;
+   void     UpdateReadvEstimate(Long64_t bytes, Double_t elapsed);
    Int_t ParseOpenMode(Option_t *in, TString &modestr,
                        XrdCl::OpenFlags::Flags &mode, Bool_t assumeRead);
 
@@ -30,6 +30,9 @@
 #include <XrdCl/XrdClXRootDResponses.hh>
 #include <XrdCl/XrdClDefaultEnv.hh>
 #include <XrdVersion.hh>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
 //------------------------------------------------------------------------------
@@ -159,6 +162,9 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
    fQueryReadVParams = 1;
    fReadvIorMax = 2097136;
    fReadvIovMax = 1024;
+   fReadvCoalesceGap = -1;
+   fReadvLatency = 0;
+   fReadvBandwidth = 0;
 
    if (ParseOpenMode(mode, fOption, fMode, kTRUE)<0) {
       Error("Open", "could not parse open mode %s", mode);
@@ -465,9 +471,28 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
 ///                 position[i]
 /// param nbuffs:   number of chunks
 /// returns:        kTRUE in case of failure
+///
+/// The chunks are served from the local block cache if one is configured, see
+/// TFile::GetBlockCache().
 
 Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       Int_t nbuffs)
+{
+   if (auto cache = GetBlockCache()) {
+      return ReadBuffersBlockCached(*cache, buffer, position, length, nbuffs,
+                                    [this](char *buf, Long64_t *pos, Int_t *len, Int_t nbuf) {
+                                       return ReadBuffersRemote(buf, pos, len, nbuf);
+                                    });
+   }
+   return ReadBuffersRemote(buffer, position, length, nbuffs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read scattered data chunks from the server in one or more vector reads,
+/// bypassing the local block cache. Same arguments as ReadBuffers().
+
+Bool_t TNetXNGFile::ReadBuffersRemote(char *buffer, Long64_t *position, Int_t *length,
+      Int_t nbuffs)
 {
    using namespace XrdCl;
 
@@ -480,8 +505,8 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    std::vector<XRootDStatus*> *statuses;
    TSemaphore                 *semaphore;
    Int_t                       totalBytes = 0;
-   Long64_t                    offset     = 0;
-   char                       *cursor     = buffer;
+   Long64_t                    wireBytes  = 0;
+   Long64_t                    listBytes  = 0;
 
    Double_t start = 0;
    if (gPerfStats) start = TTimeStamp();
@@ -490,41 +515,74 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       for (Int_t i = 0; i < nbuffs; i++)
          position[i] += fArchiveOffset;
 
-   // Build a list of chunks. Put the buffers in the ChunkInfo's
+   // Merge neighbouring requests into one range when the gap between them
+   // costs less than an extra round trip. Ranges with gaps are read into a
+   // scratch buffer and the requested pieces are copied out afterwards.
+   struct ReadvRange {
+      Long64_t fPosition; // Offset of the range in the file
+      Int_t    fLength;   // Length of the range, gaps included
+      Int_t    fFirst;    // Index of the first request in the range
+      Int_t    fLast;     // Index of the last request in the range
+      Bool_t   fHasGaps;  // Whether the range contains unrequested bytes
+      char    *fBuffer;   // Where the range is read to
+   };
+   const Int_t maxGap = GetReadvCoalesceGap();
+   std::vector<ReadvRange> ranges;
+   std::vector<Int_t>      offsets(nbuffs); // Offset of each request in buffer
+   Long64_t                scratchSize = 0;
    for (Int_t i = 0; i < nbuffs; ++i) {
+      offsets[i] = totalBytes;
       totalBytes += length[i];
 
-      // If the length is bigger than max readv size, split into smaller chunks
-      if (length[i] > fReadvIorMax) {
-         Int_t nsplit = length[i] / fReadvIorMax;
-         Int_t rem    = length[i] % fReadvIorMax;
-         Int_t j;
-
-         // Add as many max-size chunks as are divisible
-         for (j = 0; j < nsplit; ++j) {
-            offset = position[i] + (j * fReadvIorMax);
-            chunks.push_back(ChunkInfo(offset, fReadvIorMax, cursor));
-            cursor += fReadvIorMax;
+      if (!ranges.empty()) {
+         ReadvRange &last = ranges.back();
+         Long64_t gap = position[i] - (last.fPosition + last.fLength);
+         if (gap >= 0 && gap <= maxGap && last.fLength + gap + length[i] <= fReadvIorMax) {
+            last.fLength += gap + length[i];
+            last.fLast = i;
+            last.fHasGaps = last.fHasGaps || gap > 0;
+            continue;
          }
-
-         // Add the remainder
-         offset = position[i] + (j * fReadvIorMax);
-         chunks.push_back(ChunkInfo(offset, rem, cursor));
-         cursor += rem;
+      }
+      ranges.push_back(ReadvRange{position[i], length[i], i, i, kFALSE, nullptr});
+   }
+   for (auto &range : ranges)
+      if (range.fHasGaps)
+         scratchSize += range.fLength;
+   std::vector<char> scratch(scratchSize);
+   scratchSize = 0;
+   for (auto &range : ranges) {
+      if (range.fHasGaps) {
+         range.fBuffer = scratch.data() + scratchSize;
+         scratchSize += range.fLength;
       } else {
-         chunks.push_back(ChunkInfo(position[i], length[i], cursor));
-         cursor += length[i];
+         range.fBuffer = buffer + offsets[range.fFirst];
       }
+   }
 
-      // If there are more than or equal to max chunks, make another chunk list
-      if ((Int_t) chunks.size() == fReadvIovMax) {
+   // Build the chunk lists. A list is closed when it reaches the maximum
+   // number of chunks or the request size derived from the bandwidth-delay
+   // product, so that several vector reads are in flight at the same time.
+   const Long64_t requestSize = GetReadvRequestSize();
+   auto addChunk = [&](Long64_t offset, Int_t len, char *cursor) {
+      chunks.push_back(ChunkInfo(offset, len, cursor));
+      listBytes += len;
+      if ((Int_t) chunks.size() >= fReadvIovMax || listBytes >= requestSize) {
          chunkLists.push_back(chunks);
          chunks = ChunkList();
-      } else if ((Int_t) chunks.size() > fReadvIovMax) {
-         chunkLists.push_back(ChunkList(chunks.begin(),
-                                        chunks.begin() + fReadvIovMax));
-         chunks = ChunkList(chunks.begin() + fReadvIovMax, chunks.end());
+         listBytes = 0;
       }
+   };
+   for (auto &range : ranges) {
+      wireBytes += range.fLength;
+
+      // If the length is bigger than max readv size, split into smaller chunks
+      Int_t done = 0;
+      while (range.fLength - done > fReadvIorMax) {
+         addChunk(range.fPosition + done, fReadvIorMax, range.fBuffer + done);
+         done += fReadvIorMax;
+      }
+      addChunk(range.fPosition + done, range.fLength - done, range.fBuffer + done);
    }
 
    // Push back the last chunk list
@@ -533,6 +591,7 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
 
    TAsyncReadvHandler *handler;
    XRootDStatus        status;
+   auto readStart = std::chrono::steady_clock::now();
    semaphore = new TSemaphore(0);
    statuses  = new std::vector<XRootDStatus*>(chunkLists.size());
 
@@ -574,6 +633,17 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       delete st;
    }
 
+   std::chrono::duration<Double_t> elapsed = std::chrono::steady_clock::now() - readStart;
+   UpdateReadvEstimate(wireBytes, elapsed.count());
+
+   // Copy the requested pieces out of the coalesced ranges
+   for (auto &range : ranges) {
+      if (!range.fHasGaps)
+         continue;
+      for (Int_t i = range.fFirst; i <= range.fLast; ++i)
+         memcpy(buffer + offsets[i], range.fBuffer + (position[i] - range.fPosition), length[i]);
+   }
+
    // Bump the globals
    fBytesRead  += totalBytes;
    fgBytesRead += totalBytes;
@@ -724,6 +794,56 @@ Bool_t TNetXNGFile::IsUseable() const
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Largest gap, in bytes, between two requested chunks that ReadBuffers reads
+/// through instead of issuing a separate chunk. Set by NetXNG.ReadvCoalesceGap;
+/// a negative value (the default) sizes the gap from the bandwidth-delay
+/// product measured on the connection, i.e. the number of bytes that could be
+/// transferred during one round trip.
+
+Int_t TNetXNGFile::GetReadvCoalesceGap() const
+{
+   if (fReadvCoalesceGap >= 0)
+      return fReadvCoalesceGap;
+   // Until the connection has been measured, only merge across small holes
+   if (fReadvBandwidth <= 0)
+      return 4096;
+   Double_t bdp = fReadvLatency * fReadvBandwidth;
+   return (Int_t) std::min<Double_t>(bdp, fReadvIorMax / 16);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of bytes after which ReadBuffers starts a new vector read, so that a
+/// large request is spread over several pipelined vector reads each big
+/// enough to fill the bandwidth-delay product of the connection.
+
+Long64_t TNetXNGFile::GetReadvRequestSize() const
+{
+   if (fReadvBandwidth <= 0)
+      return (Long64_t) fReadvIorMax * fReadvIovMax;
+   Long64_t bdp = (Long64_t) (fReadvLatency * fReadvBandwidth);
+   return std::max<Long64_t>(bdp, fReadvIorMax);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Update the latency and bandwidth estimates of the connection with a vector
+/// read of `bytes` bytes that completed in `elapsed` seconds. The latency is
+/// the fastest round trip seen; the bandwidth is a running average over the
+/// reads whose transfer time clearly exceeds the latency.
+
+void TNetXNGFile::UpdateReadvEstimate(Long64_t bytes, Double_t elapsed)
+{
+   if (elapsed <= 0)
+      return;
+   if (fReadvLatency <= 0 || elapsed < fReadvLatency)
+      fReadvLatency = elapsed;
+   Double_t transfer = elapsed - fReadvLatency;
+   if (transfer < fReadvLatency)
+      return;
+   Double_t bandwidth = bytes / transfer;
+   fReadvBandwidth = fReadvBandwidth > 0 ? 0.75 * fReadvBandwidth + 0.25 * bandwidth : bandwidth;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Find the server-specific readv config params. Returns kFALSE in case of
 /// error, kTRUE otherwise.
@@ -877,6 +997,7 @@ void TNetXNGFile::SetEnv()
       env->PutString("ClientMonitorParam", val.Data());
 
    fQueryReadVParams = gEnv->GetValue("NetXNG.QueryReadVParams", 1);
+   fReadvCoalesceGap = gEnv->GetValue("NetXNG.ReadvCoalesceGap", -1);
    env->PutInt( "MultiProtocol", gEnv->GetValue("TFile.CrossProtocolRedirects", 1));
 
    // Old style netrc file
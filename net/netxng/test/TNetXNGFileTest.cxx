@@ -1,6 +1,9 @@
 #include "RConfigure.h"
 
+#include <cstring>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -31,3 +34,28 @@ TEST(TNetXNGFileTest, DoubleClose)
    EXPECT_FALSE(f->IsOpen());
    delete f;
 }
+
+TEST(TNetXNGFileTest, ReadBuffersCoalescing)
+{
+   std::unique_ptr<TFile> f(TFile::Open(fileName));
+   ASSERT_TRUE(f != nullptr);
+   ASSERT_FALSE(f->IsZombie());
+
+   // Sparse chunks with small and large holes, and one chunk above the readv chunk limit
+   std::vector<Long64_t> position{100, 300, 1000, 1200000, 1200500, 4000000};
+   std::vector<Int_t> length{100, 500, 100, 100, 3000000, 1000};
+   Int_t total = 0;
+   for (auto len : length)
+      total += len;
+
+   std::vector<char> buffer(total);
+   ASSERT_FALSE(f->ReadBuffers(buffer.data(), position.data(), length.data(), position.size()));
+
+   Int_t offset = 0;
+   for (std::size_t i = 0; i < position.size(); ++i) {
+      std::vector<char> expected(length[i]);
+      ASSERT_FALSE(f->ReadBuffer(expected.data(), position[i], length[i]));
+      EXPECT_EQ(0, memcmp(expected.data(), buffer.data() + offset, length[i])) << "chunk " << i;
+      offset += length[i];
+   }
+}
@@ -57,9 +57,13 @@ public:
    bool useCuda() const { return _cudaStream != nullptr; }
    void setCudaStream(CudaInterface::CudaStream *cudaStream) { _cudaStream = cudaStream; }
    CudaInterface::CudaStream *cudaStream() const { return _cudaStream; }
+   /// Whether the CPU computations may be split among the threads of the implicit multi-threading pool.
+   bool useMultiThreading() const { return _useMultiThreading; }
+   void setUseMultiThreading(bool useMultiThreading) { _useMultiThreading = useMultiThreading; }
 
 private:
    CudaInterface::CudaStream *_cudaStream = nullptr;
+   bool _useMultiThreading = false;
 };
 
 enum class Architecture { AVX512, AVX2, AVX, SSE4, GENERIC, CUDA };
@@ -26,7 +26,9 @@ This file contains the code for cpu computations using the RooBatchCompute libra
 #include <ROOT/RConfig.hxx>
 
 #ifdef ROOBATCHCOMPUTE_USE_IMT
-#include <ROOT/TExecutor.hxx>
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
 #endif
 
 #include <Math/Util.h>
@@ -49,6 +51,9 @@ namespace RF_ARCH {
 
 namespace {
 
+/// Minimum number of events per task of the multi-threaded computations
+constexpr std::size_t minEventsPerTask = 16384;
+
 void fillBatches(Batches &batches, double *output, size_t nEvents, std::size_t nBatches, ArgSpan extraArgs)
 {
    batches.extra = extraArgs.data();
@@ -125,6 +130,8 @@ public:
    bool cudaStreamIsActive(CudaInterface::CudaStream *) const override { throw std::bad_function_call(); }
 
 private:
+   void computeRange(Computer computer, double *output, VarSpan vars, ArgSpan extraArgs, std::size_t nEvents,
+                     std::size_t begin, std::size_t n) const;
 #ifdef ROOBATCHCOMPUTE_USE_IMT
    void computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs);
 #endif
@@ -132,110 +139,84 @@ private:
    const std::vector<void (*)(Batches &)> _computeFunctions;
 };
 
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-void RooBatchComputeClass::computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs)
+/// Computes the events [begin, begin + n) of the output, vectors in `vars` having nEvents elements
+void RooBatchComputeClass::computeRange(Computer computer, double *output, VarSpan vars, ArgSpan extraArgs,
+                                        std::size_t nEvents, std::size_t begin, std::size_t n) const
 {
-   std::size_t nEvents = output.size();
-
-   if (nEvents == 0)
-      return;
-   ROOT::Internal::TExecutor ex;
-   std::size_t nThreads = ex.GetPoolSize();
-
-   std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
-
-   // Reset the number of threads to the number we actually need given nEventsPerThread
-   nThreads = nEvents / nEventsPerThread + (nEvents % nEventsPerThread > 0);
-
-   auto task = [&](std::size_t idx) -> int {
-      // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-      // Then advance every object but the first to split the work between threads
-      Batches batches;
-      std::vector<Batch> arrays(vars.size());
-      fillBatches(batches, output.data(), nEventsPerThread, vars.size(), extraArgs);
-      fillArrays(arrays, vars, nEvents);
-      batches.args = arrays.data();
-      advance(batches, batches.nEvents * idx);
-
-      // Set the number of events of the last Batches object as the remaining events
-      if (idx == nThreads - 1) {
-         batches.nEvents = nEvents - idx * batches.nEvents;
-      }
+   Batches batches;
+   std::vector<Batch> arrays(vars.size());
+   fillBatches(batches, output, n, vars.size(), extraArgs);
+   fillArrays(arrays, vars, nEvents);
+   batches.args = arrays.data();
+   advance(batches, begin);
 
-      std::size_t events = batches.nEvents;
-      batches.nEvents = bufferSize;
-      while (events > bufferSize) {
-         _computeFunctions[computer](batches);
-         advance(batches, bufferSize);
-         events -= bufferSize;
-      }
-      batches.nEvents = events;
+   std::size_t events = batches.nEvents;
+   batches.nEvents = bufferSize;
+   while (events > bufferSize) {
       _computeFunctions[computer](batches);
-      return 0;
-   };
+      advance(batches, bufferSize);
+      events -= bufferSize;
+   }
+   batches.nEvents = events;
+   _computeFunctions[computer](batches);
+}
 
-   std::vector<std::size_t> indices(nThreads);
-   for (unsigned int i = 1; i < nThreads; i++) {
-      indices[i] = i;
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+/// Splits the events in ranges of a multiple of bufferSize events, a few per thread, computed in parallel
+void RooBatchComputeClass::computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs)
+{
+   const std::size_t nEvents = output.size();
+   ROOT::TThreadExecutor ex;
+   const std::size_t nTasksMax = std::max<std::size_t>(1, std::min<std::size_t>(4 * ex.GetPoolSize(),
+                                                                                  nEvents / minEventsPerTask));
+   const std::size_t nEventsPerTask =
+      ((nEvents + nTasksMax - 1) / nTasksMax + bufferSize - 1) / bufferSize * bufferSize;
+   const unsigned int nTasks = (nEvents + nEventsPerTask - 1) / nEventsPerTask;
+
+   // Some kernels accumulate into the extra arguments (e.g. the evaluation errors of NormalizedPdf): every task
+   // works on its own copy, and what the tasks added is added to the extra arguments at the end
+   std::vector<std::vector<double>> taskExtraArgs(nTasks, std::vector<double>(extraArgs.begin(), extraArgs.end()));
+   ex.Foreach(
+      [&](unsigned int i) {
+         const std::size_t begin = i * nEventsPerTask;
+         computeRange(computer, output.data(), vars, taskExtraArgs[i], nEvents, begin,
+                      std::min(nEventsPerTask, nEvents - begin));
+      },
+      ROOT::TSeq<unsigned int>(nTasks));
+   for (std::size_t j = 0; j < extraArgs.size(); ++j) {
+      const double initial = extraArgs[j];
+      for (auto const &args : taskExtraArgs)
+         extraArgs[j] += args[j] - initial;
    }
-   ex.Map(task, indices);
 }
 #endif
 
 /** Compute multiple values using optimized functions.
 This method creates a Batches object and passes it to the correct compute function.
-In case Implicit Multithreading is enabled, the events to be processed are equally
-divided among the tasks to be generated and computed in parallel.
+If the configuration asks for multi-threading and implicit multi-threading is enabled
+(ROOT::EnableImplicitMT()), the events are divided among tasks computed in parallel,
+provided there are enough of them that the parallelization pays off.
+\param cfg The configuration of the computation, see Config::setUseMultiThreading().
 \param computer An enum specifying the compute function to be used.
 \param output The array where the computation results are stored.
 \param vars A std::span containing pointers to the variables involved in the computation.
 \param extraArgs An optional std::span containing extra double values that may participate in the computation. **/
-void RooBatchComputeClass::compute(Config const &, Computer computer, std::span<double> output, VarSpan vars,
+void RooBatchComputeClass::compute(Config const &cfg, Computer computer, std::span<double> output, VarSpan vars,
                                    ArgSpan extraArgs)
 {
-   // In the original implementation of this library, the evaluation was done
-   // multi-threaded in implicit multi-threading was enabled in ROOT with
-   // ROOT::EnableImplicitMT().
-   //
-   // However, this multithreaded mode was not carefully validated and is
-   // therefore not production ready. One would first have to study the
-   // overhead for different numbers of cores, number of events, and model
-   // complexity. The, we should only consider implicit multithreading here if
-   // there is no performance penalty for any scenario, to not surprise the
-   // users with unexpected slowdows!
-   //
-   // Note that the priority of investigating this is not high, because RooFit
-   // R & D efforts currently go in the direction of parallelization at the
-   // level of the gradient components, or achieving single-threaded speedup
-   // with automatic differentiation. Furthermore, the single-threaded
-   // performance of the new CPU evaluation backend with the RooBatchCompute
-   // library, is generally much faster than the legacy evaluation backend
-   // already, even if the latter uses multi-threading.
+   // The multi-threaded evaluation is opt-in: the RooFit::Evaluator requests it for its nodes if implicit
+   // multi-threading was enabled when it was created. Small outputs are always computed sequentially, because
+   // the scheduling overhead would dominate.
 #ifdef ROOBATCHCOMPUTE_USE_IMT
-   if (ROOT::IsImplicitMTEnabled()) {
+   if (cfg.useMultiThreading() && output.size() >= 2 * minEventsPerTask && ROOT::IsImplicitMTEnabled()) {
       computeIMT(computer, output, vars, extraArgs);
+      return;
    }
+#else
+   (void)cfg;
 #endif
 
-   std::size_t nEvents = output.size();
-
-   // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-   // Then advance every object but the first to split the work between threads
-   Batches batches;
-   std::vector<Batch> arrays(vars.size());
-   fillBatches(batches, output.data(), nEvents, vars.size(), extraArgs);
-   fillArrays(arrays, vars, nEvents);
-   batches.args = arrays.data();
-
-   std::size_t events = batches.nEvents;
-   batches.nEvents = bufferSize;
-   while (events > bufferSize) {
-      _computeFunctions[computer](batches);
-      advance(batches, bufferSize);
-      events -= bufferSize;
-   }
-   batches.nEvents = events;
-   _computeFunctions[computer](batches);
+   computeRange(computer, output.data(), vars, extraArgs, output.size(), 0, output.size());
 }
 
 namespace {
@@ -266,25 +247,28 @@ double RooBatchComputeClass::reduceSum(Config const &, InputArr input, size_t n)
    return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
 }
 
-ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const double> probas,
-                                                std::span<const double> weights, std::span<const double> offsetProbas)
-{
-   ReduceNLLOutput out;
+namespace {
 
+/// Partial sums of reduceNLL over a range of events
+struct NLLRangeSum {
+   ReduceNLLOutput out; ///< Only the counters are used
    double badness = 0.0;
-
    ROOT::Math::KahanSum<double> nllSum;
+};
 
-   for (std::size_t i = 0; i < probas.size(); ++i) {
+void sumNLLRange(NLLRangeSum &sum, std::span<const double> probas, std::span<const double> weights,
+                 std::span<const double> offsetProbas, std::size_t begin, std::size_t end)
+{
+   for (std::size_t i = begin; i < end; ++i) {
 
       const double eventWeight = weights.size() > 1 ? weights[i] : weights[0];
 
       if (0. == eventWeight)
          continue;
 
-      std::pair<double, double> logOut = getLog(probas[i], out);
+      std::pair<double, double> logOut = getLog(probas[i], sum.out);
       double term = logOut.first;
-      badness += logOut.second;
+      sum.badness += logOut.second;
 
       if (!offsetProbas.empty()) {
          term -= std::log(offsetProbas[i]);
@@ -292,7 +276,50 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const
 
       term *= -eventWeight;
 
-      nllSum.Add(term);
+      sum.nllSum.Add(term);
+   }
+}
+
+} // namespace
+
+ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &cfg, std::span<const double> probas,
+                                                std::span<const double> weights, std::span<const double> offsetProbas)
+{
+   std::vector<NLLRangeSum> sums(1);
+
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+   const bool parallel =
+      cfg.useMultiThreading() && probas.size() >= 2 * minEventsPerTask && ROOT::IsImplicitMTEnabled();
+#else
+   (void)cfg;
+   const bool parallel = false;
+#endif
+   if (parallel) {
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+      // The ranges don't depend on the number of threads, so that the result is reproducible
+      const unsigned int nRanges = (probas.size() + minEventsPerTask - 1) / minEventsPerTask;
+      sums.resize(nRanges);
+      ROOT::TThreadExecutor ex;
+      ex.Foreach(
+         [&](unsigned int i) {
+            sumNLLRange(sums[i], probas, weights, offsetProbas, i * minEventsPerTask,
+                        std::min((i + 1) * minEventsPerTask, probas.size()));
+         },
+         ROOT::TSeq<unsigned int>(nRanges));
+#endif
+   } else {
+      sumNLLRange(sums[0], probas, weights, offsetProbas, 0, probas.size());
+   }
+
+   ReduceNLLOutput out;
+   double badness = 0.0;
+   ROOT::Math::KahanSum<double> nllSum;
+   for (NLLRangeSum const &sum : sums) {
+      out.nInfiniteValues += sum.out.nInfiniteValues;
+      out.nNonPositiveValues += sum.out.nNonPositiveValues;
+      out.nNaNValues += sum.out.nNaNValues;
+      badness += sum.badness;
+      nllSum += sum.nllSum;
    }
 
    out.nllSum = nllSum.Sum();
@@ -222,26 +222,21 @@ void FlexibleInterpVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
 {
    unsigned int n = _interpCode.size();
 
-   int interpCode = _interpCode[0];
-   if (interpCode < 0 || interpCode > 4) {
-      coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  param " << 0
-                            << " with unknown interpolation code" << std::endl;
-   }
-   // To get consistent codes with the PiecewiseInterpolation
-   if (interpCode == 4) {
-      interpCode = 5;
-   }
-
-   for (unsigned int i = 1; i < n; i++) {
-      if (_interpCode[i] != _interpCode[0]) {
-         coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  Code Squashing AD does not yet support having "
-                                  "different interpolation codes for the same class object "
-                               << std::endl;
+   std::vector<int> interpCodes(_interpCode);
+   for (unsigned int i = 0; i < n; i++) {
+      if (interpCodes[i] < 0 || interpCodes[i] > 4) {
+         coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  param " << i
+                               << " with unknown interpolation code" << std::endl;
+      }
+      // To get consistent codes with the PiecewiseInterpolation
+      if (interpCodes[i] == 4) {
+         interpCodes[i] = 5;
       }
    }
 
-   std::string const &resName = ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterp", interpCode,
-                                              _paramList, n, _low, _high, _interpBoundary, _nominal, 1.0);
+   std::string const &resName =
+      ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterp", std::span<const int>{interpCodes.data(), n},
+                    _paramList, n, _low, _high, _interpBoundary, _nominal, 1.0);
    ctx.addResult(this, resName);
 }
 
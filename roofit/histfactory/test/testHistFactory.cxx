@@ -779,7 +779,7 @@ INSTANTIATE_TEST_SUITE_P(HistFactory, HFFixtureFit,
 INSTANTIATE_TEST_SUITE_P(HistFactoryCodeGen, HFFixtureFit,
                          testing::Combine(testing::Values(MakeModelMode::OverallSyst, MakeModelMode::HistoSyst,
                                                           MakeModelMode::StatSyst, MakeModelMode::ShapeSyst),
-                                          testing::Values(false), // no non-uniform bins
+                                          testing::Values(false, true), // non-uniform bins or not
                                           testing::Values(RooFit::EvalBackend::Codegen())),
                          getNameFromInfo);
 #endif // TEST_CODEGEN_AD
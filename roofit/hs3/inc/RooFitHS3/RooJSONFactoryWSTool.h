@@ -23,6 +23,7 @@
 #include <map>
 #include <stdexcept>
 #include <set>
+#include <unordered_map>
 
 namespace RooFit {
 namespace JSONIO {
@@ -192,6 +193,8 @@ private:
    template <class T>
    T *requestImpl(const std::string &objname);
 
+   RooFit::Detail::JSONNode const *findInputChild(std::string const &listName, std::string const &name);
+
    void exportObject(RooAbsArg const &func, std::set<std::string> &exportedObjectNames);
 
    // To export multiple objects sorted alphabetically
@@ -231,6 +234,8 @@ private:
    // member variables
    const RooFit::Detail::JSONNode *_rootnodeInput = nullptr;
    const RooFit::Detail::JSONNode *_attributesNode = nullptr;
+   // index of the named children of the lists in the input, built when first needed
+   std::map<std::string, std::unordered_map<std::string, const RooFit::Detail::JSONNode *>> _inputIndex;
    RooFit::Detail::JSONNode *_rootnodeOutput = nullptr;
    RooFit::Detail::JSONNode *_varsNode = nullptr;
    RooWorkspace &_workspace;
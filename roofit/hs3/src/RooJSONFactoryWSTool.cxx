@@ -873,6 +873,39 @@ JSONNode const *RooJSONFactoryWSTool::findNamedChild(JSONNode const &node, std::
    return nullptr;
 }
 
+/**
+ * @brief Find the child with the given name in a list of the input, like "functions" or "distributions".
+ *
+ * Unlike findNamedChild(), which scans the list, this looks the name up in an index of the list that
+ * is built on first use, so that resolving all dependencies of a large workspace does not scale
+ * quadratically with the number of objects.
+ *
+ * @param listName The key of the list in the input root node.
+ * @param name The name of the child.
+ * @return JSONNode const* The child node, or nullptr if there is none.
+ */
+JSONNode const *RooJSONFactoryWSTool::findInputChild(std::string const &listName, std::string const &name)
+{
+   JSONNode const *listNode = _rootnodeInput ? _rootnodeInput->find(listName) : nullptr;
+   if (!listNode)
+      return nullptr;
+   if (!useListsInsteadOfDicts || !listNode->is_seq())
+      return findNamedChild(*listNode, name);
+
+   auto indexFound = _inputIndex.find(listName);
+   if (indexFound == _inputIndex.end()) {
+      auto &index = _inputIndex[listName];
+      for (JSONNode const &child : listNode->children()) {
+         // the first of several children with the same name wins, as in findNamedChild()
+         if (child.is_map() && child.has_child("name"))
+            index.emplace(child["name"].val(), &child);
+      }
+      indexFound = _inputIndex.find(listName);
+   }
+   auto found = indexFound->second.find(name);
+   return found != indexFound->second.end() ? found->second : nullptr;
+}
+
 std::string RooJSONFactoryWSTool::name(const JSONNode &n)
 {
    return useListsInsteadOfDicts ? n["name"].val() : n.key();
@@ -903,12 +936,10 @@ RooAbsPdf *RooJSONFactoryWSTool::requestImpl<RooAbsPdf>(const std::string &objna
 {
    if (RooAbsPdf *retval = _workspace.pdf(objname))
       return retval;
-   if (auto distributionsNode = _rootnodeInput->find("distributions")) {
-      if (auto child = findNamedChild(*distributionsNode, objname)) {
-         this->importFunction(*child, true);
-         if (RooAbsPdf *retval = _workspace.pdf(objname))
-            return retval;
-      }
+   if (auto child = findInputChild("distributions", objname)) {
+      this->importFunction(*child, true);
+      if (RooAbsPdf *retval = _workspace.pdf(objname))
+         return retval;
    }
    return nullptr;
 }
@@ -924,12 +955,10 @@ RooAbsReal *RooJSONFactoryWSTool::requestImpl<RooAbsReal>(const std::string &obj
       return pdf;
    if (RooRealVar *var = requestImpl<RooRealVar>(objname))
       return var;
-   if (auto functionNode = _rootnodeInput->find("functions")) {
-      if (auto child = findNamedChild(*functionNode, objname)) {
-         this->importFunction(*child, true);
-         if (RooAbsReal *retval = _workspace.function(objname))
-            return retval;
-      }
+   if (auto child = findInputChild("functions", objname)) {
+      this->importFunction(*child, true);
+      if (RooAbsReal *retval = _workspace.function(objname))
+         return retval;
    }
    return nullptr;
 }
@@ -2111,6 +2140,7 @@ void RooJSONFactoryWSTool::importAllNodes(const JSONNode &n)
    _domains->populate(_workspace);
 
    _rootnodeInput = &n;
+   _inputIndex.clear();
 
    _attributesNode = findRooFitInternal(*_rootnodeInput, "attributes");
 
@@ -2175,6 +2205,7 @@ void RooJSONFactoryWSTool::importAllNodes(const JSONNode &n)
    }
 
    _rootnodeInput = nullptr;
+   _inputIndex.clear();
    _domains.reset();
 }
 
@@ -2274,6 +2305,7 @@ void RooJSONFactoryWSTool::importVariableElement(const JSONNode &elementNode)
       _domains->readJSON(*domains);
 
    _rootnodeInput = &n;
+   _inputIndex.clear();
    _attributesNode = findRooFitInternal(*_rootnodeInput, "attributes");
 
    JSONNode const *varsNode = getVariablesNode(n);
@@ -2300,6 +2332,7 @@ void RooJSONFactoryWSTool::importVariableElement(const JSONNode &elementNode)
 
    _attributesNode = nullptr;
    _rootnodeInput = nullptr;
+   _inputIndex.clear();
    _domains.reset();
 }
 
@@ -4,6 +4,7 @@
 
 #include <RooFitHS3/JSONIO.h>
 #include <RooFitHS3/RooJSONFactoryWSTool.h>
+#include <RooFit/Detail/JSONInterface.h>
 
 #include <RooAddPdf.h>
 #include <RooCategory.h>
@@ -404,3 +405,66 @@ TEST(RooFitHS3, SimultaneousGaussians)
    int status = validate(simPdf);
    EXPECT_EQ(status, 0);
 }
+
+// Test the import of a model with many objects that refer to each other by
+// name, which are looked up in the "functions" and "distributions" lists.
+TEST(RooFitHS3, ManyNamedInputs)
+{
+   RooWorkspace ws;
+   ws.factory("x[-10, 10]");
+   ws.factory("sigma[2.0, 0.1, 10]");
+   ws.factory("expr::m0('0.1 * x', x)");
+   std::string prodArgs;
+   for (int i = 0; i < 20; ++i) {
+      const std::string idx = std::to_string(i);
+      if (i > 0) {
+         ws.factory("expr::m" + idx + "('m" + std::to_string(i - 1) + " + c" + idx + "', m" +
+                    std::to_string(i - 1) + ", c" + idx + "[0.05])");
+      }
+      ws.factory("Gaussian::g" + idx + "(x, m" + idx + ", sigma)");
+      prodArgs += (i > 0 ? ", g" : "g") + idx;
+   }
+   ws.factory("PROD::model(" + prodArgs + ")");
+
+   int status = validate(ws, "model");
+   EXPECT_EQ(status, 0);
+}
+
+// Test that repeated lookups in a JSON tree hand out the same nodes, so that
+// the node cache of the tree does not grow with the number of lookups.
+TEST(RooFitHS3, JSONNodeCacheReuse)
+{
+   const std::string backend = RooFit::Detail::JSONTree::getBackend();
+   RooFit::Detail::JSONTree::setBackend("nlohmann-json");
+
+   RooWorkspace ws;
+   ws.factory("Gaussian::g0(x[-10, 10], mean[0, -10, 10], sigma[2.0, 0.1, 10])");
+   ws.factory("Gaussian::g1(x, mean, sigma2[3.0, 0.1, 10])");
+   ws.factory("SUM::model(f[0.5, 0, 1] * g0, g1)");
+
+   auto tree = RooFit::Detail::JSONTree::create(RooJSONFactoryWSTool{ws}.exportJSONtoString());
+   RooFit::Detail::JSONNode const &root = tree->rootnode();
+
+   RooFit::Detail::JSONNode const *dists = root.find("distributions");
+   ASSERT_NE(dists, nullptr);
+   EXPECT_EQ(root.find("distributions"), dists);
+
+   std::vector<RooFit::Detail::JSONNode const *> children;
+   for (auto const &child : dists->children()) {
+      children.push_back(&child);
+   }
+   ASSERT_EQ(children.size(), 3);
+
+   for (int iPass = 0; iPass < 10; ++iPass) {
+      std::size_t i = 0;
+      for (auto const &child : dists->children()) {
+         ASSERT_LT(i, children.size());
+         EXPECT_EQ(&child, children[i]);
+         EXPECT_EQ(child.find("name"), children[i]->find("name"));
+         ++i;
+      }
+      EXPECT_EQ(i, children.size());
+   }
+
+   RooFit::Detail::JSONTree::setBackend(backend);
+}
@@ -35,15 +35,9 @@ TJSONTree::TJSONTree(std::istream &is) : root(this, is){};
 
 TJSONTree::~TJSONTree()
 {
-   TJSONTree::_nodecache.clear();
+   clearcache();
 };
 
-TJSONTree::Node &TJSONTree::incache(const TJSONTree::Node &n)
-{
-   _nodecache.push_back(n);
-   return _nodecache.back();
-}
-
 const TJSONTree::Node::Impl &TJSONTree::Node::get_node() const
 {
    return *node;
@@ -56,7 +50,8 @@ TJSONTree::Node::Impl &TJSONTree::Node::get_node()
 
 void TJSONTree::clearcache()
 {
-   TJSONTree::_nodecache.clear();
+   _nodeindex.clear();
+   _nodecache.clear();
 }
 
 // TJSONTree::Node implementation
@@ -95,6 +90,21 @@ public:
    NodeRef(const NodeRef &other) : Impl(other.key()), node(other.node) {}
 };
 
+TJSONTree::Node &TJSONTree::incache(const TJSONTree::Node &n)
+{
+   // Every child access creates a node referring to an element of the
+   // document. Reuse the node if the element was accessed with the same key
+   // before, otherwise the cache grows with each lookup, e.g. quadratically
+   // when scanning lists by name.
+   const void *element = &n.get_node().get();
+   auto found = _nodeindex.find(element);
+   if (found != _nodeindex.end() && found->second->get_node().key() == n.get_node().key())
+      return *found->second;
+   _nodecache.push_back(n);
+   _nodeindex[element] = &_nodecache.back();
+   return _nodecache.back();
+}
+
 TJSONTree::Node &TJSONTree::Node::Impl::mkNode(TJSONTree *t, const std::string &k, nlohmann::json &n)
 {
    Node::Impl::NodeRef ref(k, n);
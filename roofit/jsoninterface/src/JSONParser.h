@@ -18,6 +18,7 @@
 #include <istream>
 #include <memory>
 #include <list>
+#include <unordered_map>
 
 class TJSONTree : public RooFit::Detail::JSONTree {
 public:
@@ -76,6 +77,8 @@ public:
 protected:
    Node root;
    std::list<Node> _nodecache;
+   // cached node for each element of the document, to hand out the same node on repeated lookups
+   std::unordered_map<const void *, Node *> _nodeindex;
    void clearcache();
 
 public:
@@ -36,6 +36,7 @@ public:
 
       static std::size_t defaultNEventTasks;
       static std::size_t defaultNComponentTasks;
+      static bool defaultBalanceComponentTasks;
    };
 
    struct Queue {
@@ -0,0 +1,53 @@
+/*
+ * Project: RooFit
+ * Authors:
+ *   PB, Patrick Bos, Netherlands eScience Center, p.bos@esciencecenter.nl
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+#ifndef ROOT_ROOFIT_MultiProcess_StateRing
+#define ROOT_ROOFIT_MultiProcess_StateRing
+
+#include "RooFit/MultiProcess/types.h"
+
+#include <cstddef>
+
+namespace RooFit {
+namespace MultiProcess {
+
+class StateRing {
+public:
+   StateRing(std::size_t slot_size, std::size_t N_slots = 4);
+   ~StateRing();
+   StateRing(const StateRing &) = delete;
+   StateRing &operator=(const StateRing &) = delete;
+
+   std::size_t slot_size() const { return slot_size_; }
+
+   // master side
+   void *begin_write(State state_id);
+   void end_write(State state_id);
+
+   // worker side
+   const void *begin_read(State state_id) const;
+   bool end_read(State state_id) const;
+
+private:
+   struct SlotHeader;
+   SlotHeader *header(State state_id) const;
+
+   std::size_t slot_size_;
+   std::size_t slot_stride_;
+   std::size_t N_slots_;
+   std::size_t mapped_size_;
+   char *memory_;
+};
+
+} // namespace MultiProcess
+} // namespace RooFit
+
+#endif // ROOT_ROOFIT_MultiProcess_StateRing
@@ -31,7 +31,8 @@ namespace MultiProcess {
  * are:
  * 1. the number of workers to be deployed,
  * 2. the number of event-tasks in LikelihoodJobs,
- * 3. and the number of component-tasks in LikelihoodJobs.
+ * 3. the number of component-tasks in LikelihoodJobs,
+ * 4. and whether LikelihoodJobs balance their component-tasks automatically.
  *
  * The default number of workers is set using 'std::thread::hardware_concurrency()'.
  * To change it, use 'Config::setDefaultNWorkers()' to set it to a different value
@@ -55,6 +56,15 @@ namespace MultiProcess {
  * components, the automatic mode uses just 1 task for all components. These automatic
  * modes may change in the future (for instance, we may switch them around).
  *
+ * By default, component-tasks get equal numbers of components, which leaves most
+ * workers idle when a few components dominate the evaluation time, e.g. in
+ * simultaneous fits with a few large channels. When defaultBalanceComponentTasks is
+ * set to true, newly created LikelihoodJobs measure the evaluation time of each
+ * component on the workers, and redistribute the components over the tasks between
+ * evaluations, so that the tasks take roughly equal times. Since the grouping then
+ * depends on the measured timings, the last bits of the likelihood value may differ
+ * between runs, which is why this is off by default.
+ *
  * Under Config::Queue, we can set the desired queue type: FIFO or Priority. This
  * setting is used when a JobManager is spun up, i.e. usually when the first Job
  * starts. At this point, the Queue is also created according to the setting. The
@@ -146,6 +156,7 @@ void Config::Queue::suggestTaskOrder(std::size_t job_id, const std::vector<Task>
 unsigned int Config::defaultNWorkers_ = std::thread::hardware_concurrency();
 std::size_t Config::LikelihoodJob::defaultNEventTasks = Config::LikelihoodJob::automaticNEventTasks;
 std::size_t Config::LikelihoodJob::defaultNComponentTasks = Config::LikelihoodJob::automaticNComponentTasks;
+bool Config::LikelihoodJob::defaultBalanceComponentTasks = false;
 Config::Queue::QueueType Config::Queue::queueType_ = Config::Queue::QueueType::FIFO;
 bool Config::timingAnalysis_ = false;
 
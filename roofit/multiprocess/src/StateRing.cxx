@@ -0,0 +1,119 @@
+/*
+ * Project: RooFit
+ * Authors:
+ *   PB, Patrick Bos, Netherlands eScience Center, p.bos@esciencecenter.nl
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooFit/MultiProcess/StateRing.h"
+
+#include <sys/mman.h> // mmap
+#include <atomic>
+#include <cerrno>
+#include <cstring> // strerror
+#include <limits>
+#include <new> // placement new
+#include <stdexcept>
+#include <string>
+
+namespace RooFit {
+namespace MultiProcess {
+
+/** \class StateRing
+ *
+ * \brief Ring of shared memory slots to broadcast large Job states from master to workers
+ *
+ * Jobs that must send a large state to all workers on every update can write it into
+ * a StateRing instead of publishing it through the Messenger, which would copy it once
+ * per worker. The ring is an anonymous shared memory mapping, so it must be created
+ * before the JobManager forks the workers, i.e. in the Job constructor.
+ *
+ * The state with id `state_id` is written into slot `state_id % N_slots`. The master
+ * fills the slot between begin_write and end_write and then publishes only the state id
+ * (and any small data) through the Messenger as usual. A worker that receives that state
+ * id copies the slot contents between begin_read and end_read. Each slot is guarded by
+ * a sequence number, so that a worker that lags so far behind that the master has
+ * meanwhile reused the slot for a newer state can detect it: begin_read then returns
+ * nullptr or end_read returns false. Since the slot was only reused for a newer state,
+ * the worker will receive that state later, and can just skip the outdated one.
+ */
+
+namespace {
+constexpr std::size_t kWriting = std::numeric_limits<std::size_t>::max();
+constexpr std::size_t kAlignment = 64; // cache line, to avoid false sharing between slots
+} // namespace
+
+struct StateRing::SlotHeader {
+   std::atomic<std::size_t> state_id;
+};
+static_assert(std::atomic<std::size_t>::is_always_lock_free,
+              "StateRing needs lock-free atomics to synchronize between processes");
+
+StateRing::StateRing(std::size_t slot_size, std::size_t N_slots)
+   : slot_size_(slot_size),
+     slot_stride_(((kAlignment + slot_size + kAlignment - 1) / kAlignment) * kAlignment),
+     N_slots_(N_slots),
+     mapped_size_(slot_stride_ * N_slots)
+{
+   void *memory = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+   if (memory == MAP_FAILED) {
+      throw std::runtime_error(std::string("StateRing: could not map shared memory: ") + std::strerror(errno));
+   }
+   memory_ = static_cast<char *>(memory);
+   for (std::size_t i = 0; i < N_slots_; ++i) {
+      // no state has id kWriting, so the empty slots are never read
+      new (memory_ + i * slot_stride_) SlotHeader{kWriting};
+   }
+}
+
+StateRing::~StateRing()
+{
+   munmap(memory_, mapped_size_);
+}
+
+StateRing::SlotHeader *StateRing::header(State state_id) const
+{
+   return reinterpret_cast<SlotHeader *>(memory_ + (state_id % N_slots_) * slot_stride_);
+}
+
+/// Returns the slot of state_id, to be filled with at most slot_size() bytes before calling end_write.
+void *StateRing::begin_write(State state_id)
+{
+   SlotHeader *slot = header(state_id);
+   slot->state_id.store(kWriting, std::memory_order_relaxed);
+   // the readers must not see the new contents before they see the slot is being written
+   std::atomic_thread_fence(std::memory_order_release);
+   return reinterpret_cast<char *>(slot) + kAlignment;
+}
+
+void StateRing::end_write(State state_id)
+{
+   header(state_id)->state_id.store(state_id, std::memory_order_release);
+}
+
+/// Returns the slot of state_id, or nullptr if it no longer (or not yet) contains that state.
+/// The contents must be copied out and then validated by calling end_read.
+const void *StateRing::begin_read(State state_id) const
+{
+   SlotHeader *slot = header(state_id);
+   if (slot->state_id.load(std::memory_order_acquire) != state_id) {
+      return nullptr;
+   }
+   return reinterpret_cast<char *>(slot) + kAlignment;
+}
+
+/// Returns whether the contents copied since begin_read are those of state_id, i.e. whether
+/// the master did not start writing a newer state into the slot meanwhile.
+bool StateRing::end_read(State state_id) const
+{
+   std::atomic_thread_fence(std::memory_order_acquire);
+   return header(state_id)->state_id.load(std::memory_order_relaxed) == state_id;
+}
+
+} // namespace MultiProcess
+} // namespace RooFit
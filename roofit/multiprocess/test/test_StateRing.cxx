@@ -0,0 +1,85 @@
+/*
+ * Project: RooFit
+ * Authors:
+ *   PB, Patrick Bos, Netherlands eScience Center, p.bos@esciencecenter.nl
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooFit/MultiProcess/StateRing.h"
+
+#include "gtest/gtest.h"
+
+#include <sys/wait.h> // waitpid
+#include <unistd.h>   // fork, pipe
+#include <cstring>    // memcpy
+
+using RooFit::MultiProcess::StateRing;
+
+TEST(TestMPStateRing, ReadWrite)
+{
+   StateRing ring(sizeof(double), 2);
+
+   // nothing was written yet
+   EXPECT_EQ(ring.begin_read(1), nullptr);
+
+   double value = 1.5;
+   memcpy(ring.begin_write(1), &value, sizeof(double));
+   ring.end_write(1);
+
+   const void *slot = ring.begin_read(1);
+   ASSERT_NE(slot, nullptr);
+   double read_value;
+   memcpy(&read_value, slot, sizeof(double));
+   EXPECT_TRUE(ring.end_read(1));
+   EXPECT_EQ(read_value, 1.5);
+
+   // state 3 reuses the slot of state 1
+   slot = ring.begin_read(1);
+   ASSERT_NE(slot, nullptr);
+   ring.begin_write(3);
+   ring.end_write(3);
+   EXPECT_FALSE(ring.end_read(1));
+   EXPECT_EQ(ring.begin_read(1), nullptr);
+   EXPECT_NE(ring.begin_read(3), nullptr);
+}
+
+TEST(TestMPStateRing, SharedWithForkedProcess)
+{
+   StateRing ring(sizeof(double));
+   int state_written[2];
+   ASSERT_EQ(pipe(state_written), 0);
+
+   pid_t child = fork();
+   ASSERT_GE(child, 0);
+   if (child == 0) {
+      // wait for the parent to write the state, then check it
+      char dummy;
+      int exit_code = read(state_written[0], &dummy, 1) == 1 ? 0 : 2;
+      const void *slot = ring.begin_read(1);
+      double value = 0;
+      if (slot) {
+         memcpy(&value, slot, sizeof(double));
+      }
+      if (!slot || !ring.end_read(1) || value != 2.5) {
+         exit_code = 1;
+      }
+      _exit(exit_code);
+   }
+
+   double value = 2.5;
+   memcpy(ring.begin_write(1), &value, sizeof(double));
+   ring.end_write(1);
+   ASSERT_EQ(write(state_written[1], "x", 1), 1);
+
+   int status;
+   waitpid(child, &status, 0);
+   close(state_written[0]);
+   close(state_written[1]);
+   ASSERT_TRUE(WIFEXITED(status));
+   EXPECT_EQ(WEXITSTATUS(status), 0);
+}
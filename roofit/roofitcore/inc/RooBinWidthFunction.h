@@ -68,6 +68,7 @@ public:
   const RooHistFunc& histFunc() const { return (*_histFunc); }
   double evaluate() const override;
   void doEval(RooFit::EvalContext &) const override;
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
 
 private:
   RooTemplateProxy<const RooHistFunc> _histFunc;
@@ -175,6 +175,22 @@ inline unsigned int getUniformBinning(double low, double high, double val, unsig
    return val >= high ? numBins - 1 : std::abs((val - low) / binWidth);
 }
 
+/// The bin of val in a binning with the given numBins + 1 boundaries, clamped to the first and last bins.
+inline unsigned int getNonUniformBinning(double const *boundaries, unsigned int numBins, double val)
+{
+   unsigned int lo = 0;
+   unsigned int hi = numBins;
+   while (hi - lo > 1) {
+      unsigned int mid = (lo + hi) / 2;
+      if (val >= boundaries[mid]) {
+         lo = mid;
+      } else {
+         hi = mid;
+      }
+   }
+   return lo;
+}
+
 inline double interpolate1d(double low, double high, double val, unsigned int numBins, double const* vals)
 {
    double binWidth = (high - low) / numBins;
@@ -317,12 +333,12 @@ inline double flexibleInterpSingle(unsigned int code, double low, double high, d
    return 0.0;
 }
 
-inline double flexibleInterp(unsigned int code, double const *params, unsigned int n, double const *low,
+inline double flexibleInterp(int const *codes, double const *params, unsigned int n, double const *low,
                              double const *high, double boundary, double nominal, int doCutoff)
 {
    double total = nominal;
    for (std::size_t i = 0; i < n; ++i) {
-      total += flexibleInterpSingle(code, low[i], high[i], boundary, nominal, params[i], total);
+      total += flexibleInterpSingle(codes[i], low[i], high[i], boundary, nominal, params[i], total);
    }
 
    return doCutoff && total <= 0 ? TMath::Limits<double>::Min() : total;
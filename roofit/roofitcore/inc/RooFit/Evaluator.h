@@ -48,10 +48,14 @@ public:
 private:
    void processVariable(NodeInfo &nodeInfo);
    void setClientsDirty(NodeInfo &nodeInfo);
+   bool restoreCachedOutput(NodeInfo &info);
    std::span<const double> getValHeterogeneous();
    void markGPUNodes();
    void assignToGPU(NodeInfo &info);
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
+   void computeFusedNodes(NodeInfo &rootInfo);
+   void fuseNodes();
+   void setupOutputCaches();
    void setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode);
    void syncDataTokens();
    void updateOutputSizes();
@@ -171,6 +171,7 @@ public:
   const RooVectorDataStore* cache() const { return _cache ; }
 
   void loadValues(const RooAbsDataStore *tds, const RooFormulaVar* select=nullptr, const char* rangeName=nullptr, std::size_t nStart=0, std::size_t nStop = std::numeric_limits<std::size_t>::max()) override;
+  void loadValues(const TTree *t, const RooFormulaVar* select=nullptr);
 
   void dump() override;
 
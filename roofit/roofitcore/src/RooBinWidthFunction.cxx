@@ -30,6 +30,7 @@
 #include "RooConstVar.h"
 #include "RooDataHist.h"
 #include "RooGlobalFunc.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 bool RooBinWidthFunction::_enabled = true;
 
@@ -122,6 +123,26 @@ void RooBinWidthFunction::doEval(RooFit::EvalContext &ctx) const
 }
 
 
+/// Generate the code returning the volume or inverse volume of the current bin.
+void RooBinWidthFunction::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   if (!_enabled) {
+      ctx.addResult(this, "1.0");
+      return;
+   }
+   const RooDataHist &dataHist = _histFunc->dataHist();
+   std::span<const double> volumes = dataHist.binVolumes(0, dataHist.numEntries());
+   std::vector<double> vals(volumes.begin(), volumes.end());
+   if (_divideByBinWidth) {
+      for (double &val : vals) {
+         val = 1. / val;
+      }
+   }
+   std::string const &idx = dataHist.calculateTreeIndexForCodeSquash(this, ctx, _histFunc->variables());
+   ctx.addResult(this, "*(" + ctx.buildArg(vals) + " + " + idx + ")");
+}
+
+
 std::unique_ptr<RooAbsArg>
 RooBinWidthFunction::compileForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext &ctx) const
 {
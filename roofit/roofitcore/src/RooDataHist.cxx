@@ -1027,15 +1027,22 @@ std::string RooDataHist::calculateTreeIndexForCodeSquash(RooAbsArg const * /*kla
          coutE(InputArguments) << "RooHistPdf::weight(" << GetName()
                                << ") ERROR: Code Squashing currently does not support category values." << std::endl;
          return "";
-      } else if (!dynamic_cast<RooUniformBinning const *>(binning)) {
+      }
+
+      std::string bin;
+      if (dynamic_cast<RooUniformBinning const *>(binning)) {
+         bin = ctx.buildCall("RooFit::Detail::MathFuncs::getUniformBinning", binning->lowBound(),
+                             binning->highBound(), *theVar, binning->numBins());
+      } else if (dynamic_cast<RooBinning const *>(binning)) {
+         std::span<const double> boundaries{binning->array(), std::size_t(binning->numBins() + 1)};
+         bin = ctx.buildCall("RooFit::Detail::MathFuncs::getNonUniformBinning", boundaries, binning->numBins(),
+                             *theVar);
+      } else {
          coutE(InputArguments) << "RooHistPdf::weight(" << GetName()
-                               << ") ERROR: Code Squashing currently only supports uniformly binned cases."
+                               << ") ERROR: Code Squashing currently only supports uniform and variable binnings."
                                << std::endl;
          return "";
       }
-
-      std::string const &bin = ctx.buildCall("RooFit::Detail::MathFuncs::getUniformBinning", binning->lowBound(),
-                                             binning->highBound(), *theVar, binning->numBins());
       code += " + " + std::to_string(idxMult) + " * " + bin;
 
       // Use RooAbsLValue here because it also generalized to categories, which
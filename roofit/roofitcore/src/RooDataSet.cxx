@@ -512,6 +512,8 @@ RooDataSet::RooDataSet(RooStringView name, RooStringView title, const RooArgSet&
 
       if (tstore) {
          tstore->loadValues(impTree, cutVar, cutRange);
+      } else if (auto vstore = dynamic_cast<RooVectorDataStore *>(_dstore.get())) {
+         vstore->loadValues(impTree, cutVar);
       } else {
          RooTreeDataStore tmpstore(name, title, _vars, wgtVarName);
          tmpstore.loadValues(impTree, cutVar, cutRange);
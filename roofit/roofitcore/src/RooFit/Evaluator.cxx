@@ -24,6 +24,24 @@ computations take place in the RooBatchCompute library and can be carried off
 by either the CPU or a CUDA-supporting GPU. The Evaluator class takes care
 of data transfers. An instance of this class is created every time
 RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
+
+If implicit multi-threading is enabled with ROOT::EnableImplicitMT() when the
+Evaluator is created, the CPU computations of the nodes with many events, and
+the reduction of the likelihood, are split among the threads of the pool.
+
+Otherwise, the CPU computations of chains of elementwise nodes are fused: a
+node whose clients all belong to the same chain has no buffer for all the
+events, and the chain is evaluated over tiles of events that fit in the cache,
+writing only the output of its last node to memory. The nodes that can be fused
+are the non-reducer nodes that can be computed with CUDA, whose outputs only
+depend on their inputs for the same events.
+
+In the CPU mode, the nodes with a buffer for all the events also keep their
+previous output, with the values of the parameters it was computed for. During
+the computation of a numerical gradient, where one parameter is stepped and then
+reset, the nodes that depend on that parameter restore the output for the reset
+value instead of computing it again, and the nodes whose parameters did not
+change are not computed again.
 **/
 
 #include <RooFit/Evaluator.h>
@@ -37,13 +55,18 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include <RooNameReg.h>
 #include <RooSimultaneous.h>
 
+#include <ROOT/RTrace.hxx>
+#include <TROOT.h>
+
 #include <RooBatchCompute.h>
 
 #include "RooFit/Detail/BatchModeDataHelpers.h"
 #include "RooFitImplHelpers.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
+#include <iterator>
 #include <numeric>
 #include <thread>
 
@@ -51,6 +74,9 @@ namespace RooFit {
 
 namespace {
 
+// Maximum number of events evaluated at once by the fused nodes
+constexpr std::size_t fusedTileSize = 4096;
+
 // To avoid deleted move assignment.
 template <class T>
 void assignSpan(std::span<T> &to, std::span<T> const &from)
@@ -119,6 +145,18 @@ struct NodeInfo {
    std::vector<NodeInfo *> serverInfos;
    std::vector<NodeInfo *> clientInfos;
 
+   NodeInfo *fusedRoot = nullptr;        ///< Last node of the fused chain, if this node is computed with it
+   std::vector<NodeInfo *> fusedNodes;   ///< For the last node of a fused chain, the other nodes of the chain
+   std::vector<NodeInfo *> fusedInputs;  ///< For the last node of a fused chain, the vector inputs of the chain
+   std::vector<double> tileBuffer;       ///< Output of a fused node for the current tile of events
+
+   std::vector<NodeInfo *> parameterInfos; ///< Variables the output depends on, if the outputs are cached
+   std::vector<double> outputKey;          ///< Values of the parameters the output was computed for
+   std::shared_ptr<RooBatchCompute::AbsBuffer> savedBuffer; ///< The previous output that is kept
+   std::vector<double> savedKey;           ///< Values of the parameters the previous output was computed for
+   int outputEvaluation = 0;               ///< Evaluation in which the output was computed or restored
+   bool outputRestored = false;            ///< Whether the output was restored from the saved one
+
    RooBatchCompute::CudaInterface::CudaEvent *event = nullptr;
    RooBatchCompute::CudaInterface::CudaStream *stream = nullptr;
 
@@ -207,6 +245,15 @@ Evaluator::Evaluator(const RooAbsReal &absReal, bool useGPU)
 
    syncDataTokens();
 
+   if (!_useGPU && ROOT::IsImplicitMTEnabled()) {
+      // split the computations of the large nodes among the threads of the implicit multi-threading pool
+      RooBatchCompute::Config cfg;
+      cfg.setUseMultiThreading(true);
+      for (auto &info : _nodes) {
+         _evalContextCPU.setConfig(info.absArg, cfg);
+      }
+   }
+
    if (_useGPU) {
       // create events and streams for every node
       for (auto &info : _nodes) {
@@ -324,6 +371,11 @@ void Evaluator::updateOutputSizes()
 
    if (_useGPU) {
       markGPUNodes();
+   } else {
+      if (!ROOT::IsImplicitMTEnabled()) {
+         fuseNodes();
+      }
+      setupOutputCaches();
    }
 
    _needToUpdateOutputSizes = false;
@@ -341,6 +393,7 @@ Evaluator::~Evaluator()
 void Evaluator::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
 {
    using namespace Detail;
+   R__TRACE_SCOPE("roofit", "Evaluator::computeCPUNode");
 
    const std::size_t nOut = info.outputSize;
 
@@ -391,6 +444,52 @@ void Evaluator::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
    }
 }
 
+/// Computes the last node of a fused chain together with the other nodes of
+/// the chain, tile by tile. Only the output of the last node is stored for all
+/// the events.
+void Evaluator::computeFusedNodes(NodeInfo &rootInfo)
+{
+   const std::size_t nOut = rootInfo.outputSize;
+   if (!rootInfo.buffer) {
+      rootInfo.buffer = _bufferManager->makeCpuBuffer(nOut);
+   }
+   double *output = rootInfo.buffer->hostWritePtr();
+
+   std::vector<std::span<const double>> inputs;
+   inputs.reserve(rootInfo.fusedInputs.size());
+   for (NodeInfo *inputInfo : rootInfo.fusedInputs) {
+      inputs.emplace_back(_evalContextCPU.at(inputInfo->absArg));
+   }
+
+   auto computeTile = [&](NodeInfo &info, std::span<double> tileOutput) {
+      assignSpan(_evalContextCPU._currentOutput, tileOutput);
+      _evalContextCPU.set(info.absArg, {tileOutput.data(), tileOutput.size()});
+      _evalContextCPU.enableVectorBuffers(true);
+      static_cast<RooAbsReal const *>(info.absArg)->doEval(_evalContextCPU);
+      _evalContextCPU.resetVectorBuffers();
+      _evalContextCPU.enableVectorBuffers(false);
+   };
+
+   // Tiles of equal sizes, so that none of them has a single event and looks like a scalar
+   const std::size_t nTiles = (nOut + fusedTileSize - 1) / fusedTileSize;
+   for (std::size_t iTile = 0; iTile < nTiles; ++iTile) {
+      const std::size_t begin = iTile * nOut / nTiles;
+      const std::size_t n = (iTile + 1) * nOut / nTiles - begin;
+      for (std::size_t i = 0; i < inputs.size(); ++i) {
+         _evalContextCPU.set(rootInfo.fusedInputs[i]->absArg, {inputs[i].data() + begin, n});
+      }
+      for (NodeInfo *info : rootInfo.fusedNodes) {
+         computeTile(*info, {info->tileBuffer.data(), n});
+      }
+      computeTile(rootInfo, {output + begin, n});
+   }
+
+   for (std::size_t i = 0; i < inputs.size(); ++i) {
+      _evalContextCPU.set(rootInfo.fusedInputs[i]->absArg, inputs[i]);
+   }
+   _evalContextCPU.set(rootInfo.absArg, {output, nOut});
+}
+
 /// Process a variable in the computation graph. This is a separate non-inlined
 /// function such that we can see in performance profiles how long this takes.
 void Evaluator::processVariable(NodeInfo &nodeInfo)
@@ -398,7 +497,12 @@ void Evaluator::processVariable(NodeInfo &nodeInfo)
    RooAbsArg *node = nodeInfo.absArg;
    auto *var = static_cast<RooRealVar const *>(node);
    if (nodeInfo.lastSetValCount != var->valueResetCounter()) {
+      const bool isFirst = nodeInfo.lastSetValCount == std::numeric_limits<std::size_t>::max();
       nodeInfo.lastSetValCount = var->valueResetCounter();
+      // a variable set again to the same value doesn't change its clients
+      if (!isFirst && var->getVal() == nodeInfo.scalarBuffer) {
+         return;
+      }
       for (NodeInfo *clientInfo : nodeInfo.clientInfos) {
          clientInfo->isDirty = true;
       }
@@ -407,6 +511,44 @@ void Evaluator::processVariable(NodeInfo &nodeInfo)
    }
 }
 
+/// Called for a dirty node with a cached output, before computing it. Returns
+/// true if the output doesn't need to be computed: either the parameters it
+/// depends on didn't change, or the output for their values was saved and has
+/// been restored. Otherwise, saves the current output if it is worth keeping,
+/// and the node must be computed.
+bool Evaluator::restoreCachedOutput(NodeInfo &info)
+{
+   std::vector<double> key;
+   key.reserve(info.parameterInfos.size());
+   for (NodeInfo *paramInfo : info.parameterInfos) {
+      key.push_back(static_cast<RooRealVar const *>(paramInfo->absArg)->getVal());
+   }
+
+   if (info.buffer && key == info.outputKey) {
+      return true;
+   }
+   if (info.savedBuffer && key == info.savedKey) {
+      std::swap(info.buffer, info.savedBuffer);
+      std::swap(info.outputKey, info.savedKey);
+      info.outputEvaluation = _nEvaluations;
+      info.outputRestored = true;
+      _evalContextCPU.set(info.absArg, {info.buffer->hostReadPtr(), info.outputSize});
+      return true;
+   }
+
+   // The steps of a numerical derivative are only current for one evaluation
+   // and are not needed again. The output that was current for longer, or that
+   // was already restored, is the one that is likely to be needed again.
+   if (info.buffer && (!info.savedBuffer || info.outputRestored || _nEvaluations - info.outputEvaluation > 1)) {
+      std::swap(info.buffer, info.savedBuffer);
+      std::swap(info.outputKey, info.savedKey);
+   }
+   info.outputKey = std::move(key);
+   info.outputEvaluation = _nEvaluations;
+   info.outputRestored = false;
+   return false;
+}
+
 /// Flags all the clients of a given node dirty. This is a separate non-inlined
 /// function such that we can see in performance profiles how long this takes.
 void Evaluator::setClientsDirty(NodeInfo &nodeInfo)
@@ -432,10 +574,28 @@ std::span<const double> Evaluator::run()
       if (!nodeInfo.fromArrayInput) {
          if (nodeInfo.isVariable) {
             processVariable(nodeInfo);
+         } else if (nodeInfo.fusedRoot) {
+            // computed with the last node of its chain
+            continue;
+         } else if (!nodeInfo.fusedNodes.empty()) {
+            bool isDirty = nodeInfo.isDirty;
+            for (NodeInfo *info : nodeInfo.fusedNodes) {
+               isDirty |= info->isDirty;
+               info->isDirty = false;
+            }
+            if (isDirty) {
+               setClientsDirty(nodeInfo);
+               if (nodeInfo.parameterInfos.empty() || !restoreCachedOutput(nodeInfo)) {
+                  computeFusedNodes(nodeInfo);
+               }
+               nodeInfo.isDirty = false;
+            }
          } else {
             if (nodeInfo.isDirty) {
                setClientsDirty(nodeInfo);
-               computeCPUNode(nodeInfo.absArg, nodeInfo);
+               if (nodeInfo.parameterInfos.empty() || !restoreCachedOutput(nodeInfo)) {
+                  computeCPUNode(nodeInfo.absArg, nodeInfo);
+               }
                nodeInfo.isDirty = false;
             }
          }
@@ -573,6 +733,108 @@ void Evaluator::markGPUNodes()
    }
 }
 
+/// Finds the chains of elementwise nodes that are computed together in the CPU
+/// mode. A node is fused with the last node of a chain if all its clients are
+/// in that chain, so that its output is only needed tile by tile.
+void Evaluator::fuseNodes()
+{
+   for (auto &info : _nodes) {
+      info.fusedRoot = nullptr;
+      info.fusedNodes.clear();
+      info.fusedInputs.clear();
+      info.tileBuffer.clear();
+   }
+
+   auto isElementwise = [](NodeInfo const &info) {
+      RooAbsArg const &arg = *info.absArg;
+      if (info.isVariable || info.fromArrayInput || info.isCategory || info.isScalar() || arg.isReducerNode() ||
+          !arg.canComputeBatchWithCuda()) {
+         return false;
+      }
+      for (NodeInfo *serverInfo : info.serverInfos) {
+         if (!serverInfo->isScalar() && serverInfo->outputSize != info.outputSize) {
+            return false;
+         }
+      }
+      return true;
+   };
+
+   // Going from the top node down, so that the chains of the clients are known
+   std::vector<NodeInfo *> chains(_nodes.size(), nullptr);
+   for (auto it = _nodes.rbegin(); it != _nodes.rend(); ++it) {
+      NodeInfo &info = *it;
+      if (!isElementwise(info)) {
+         continue;
+      }
+      NodeInfo *root = nullptr;
+      bool isFused = &info != &_nodes.back() && !info.clientInfos.empty();
+      for (NodeInfo *clientInfo : info.clientInfos) {
+         NodeInfo *clientRoot = chains[clientInfo->iNode];
+         if (!clientRoot || (root && clientRoot != root)) {
+            isFused = false;
+            break;
+         }
+         root = clientRoot;
+      }
+      chains[info.iNode] = isFused ? root : &info;
+      info.fusedRoot = isFused ? root : nullptr;
+   }
+
+   // The nodes of each chain in the order of the computation graph, and their inputs from outside the chain
+   for (auto &info : _nodes) {
+      NodeInfo *root = chains[info.iNode];
+      if (!root) {
+         continue;
+      }
+      if (info.fusedRoot) {
+         root->fusedNodes.push_back(&info);
+         info.tileBuffer.resize(std::min(fusedTileSize, info.outputSize));
+         info.buffer.reset();
+      }
+      for (NodeInfo *serverInfo : info.serverInfos) {
+         auto &inputs = root->fusedInputs;
+         if (!serverInfo->isScalar() && chains[serverInfo->iNode] != root &&
+             std::find(inputs.begin(), inputs.end(), serverInfo) == inputs.end()) {
+            inputs.push_back(serverInfo);
+         }
+      }
+   }
+}
+
+/// Finds the variables the output of each node depends on, and enables the
+/// caching of the outputs of the nodes with a buffer for all the events, in the
+/// CPU mode. The outputs of the scalar nodes are cheap to compute again.
+void Evaluator::setupOutputCaches()
+{
+   // The variables each node depends on, ordered by their position in the graph
+   std::vector<std::vector<NodeInfo *>> parameters(_nodes.size());
+   for (auto &info : _nodes) {
+      info.parameterInfos.clear();
+      info.outputKey.clear();
+      info.savedBuffer.reset();
+      info.savedKey.clear();
+      info.outputRestored = false;
+
+      auto &params = parameters[info.iNode];
+      if (info.isVariable && !info.fromArrayInput) {
+         params.push_back(&info);
+         continue;
+      }
+      for (NodeInfo *serverInfo : info.serverInfos) {
+         auto const &serverParams = parameters[serverInfo->iNode];
+         std::vector<NodeInfo *> merged;
+         merged.reserve(params.size() + serverParams.size());
+         std::set_union(params.begin(), params.end(), serverParams.begin(), serverParams.end(),
+                        std::back_inserter(merged), [](NodeInfo *a, NodeInfo *b) { return a->iNode < b->iNode; });
+         params = std::move(merged);
+      }
+      if (!info.isScalar() && !info.fromArrayInput && !info.isCategory && !info.fusedRoot &&
+          !info.absArg->isReducerNode()) {
+         info.parameterInfos = params;
+      }
+   }
+}
+
 /// Temporarily change the operation mode of a RooAbsArg until the
 /// Evaluator gets deleted.
 void Evaluator::setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode)
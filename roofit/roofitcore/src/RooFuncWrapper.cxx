@@ -28,6 +28,8 @@
 
 #include <fstream>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace {
 
@@ -42,6 +44,23 @@ void replaceAll(std::string &str, const std::string &from, const std::string &to
    }
 }
 
+/// The names of the functions declared to the interpreter, by their body. The
+/// wrappers of the same model with the same data layout, as created for every
+/// toy of a study or every point of a likelihood scan, generate the same code:
+/// they reuse the compiled function instead of declaring it again.
+std::unordered_map<std::string, std::string> &declaredFunctions()
+{
+   static std::unordered_map<std::string, std::string> functions;
+   return functions;
+}
+
+/// The declared functions whose gradient was already generated with Clad.
+std::unordered_set<std::string> &differentiatedFunctions()
+{
+   static std::unordered_set<std::string> functions;
+   return functions;
+}
+
 } // namespace
 
 namespace RooFit {
@@ -140,6 +159,12 @@ void RooFuncWrapper::loadParamsAndData(RooAbsArg const *head, RooArgSet const &p
 
 std::string RooFuncWrapper::declareFunction(std::string const &funcBody)
 {
+   auto found = declaredFunctions().find(funcBody);
+   if (found != declaredFunctions().end()) {
+      _collectedFunctions.emplace_back(found->second);
+      return found->second;
+   }
+
    static int iFuncWrapper = 0;
    auto funcName = "roo_func_wrapper_" + std::to_string(iFuncWrapper++);
 
@@ -154,6 +179,7 @@ std::string RooFuncWrapper::declareFunction(std::string const &funcBody)
       oocoutE(nullptr, InputArguments) << errorMsg.str() << std::endl;
       throw std::runtime_error(errorMsg.str().c_str());
    }
+   declaredFunctions().emplace(funcBody, funcName);
    return funcName;
 }
 
@@ -162,6 +188,13 @@ void RooFuncWrapper::createGradient()
    std::string gradName = _funcName + "_grad_0";
    std::string requestName = _funcName + "_req";
 
+   // The gradient of a function that was declared for a previous wrapper is already there
+   if (differentiatedFunctions().count(_funcName)) {
+      _grad = reinterpret_cast<Grad>(gInterpreter->ProcessLine((gradName + ";").c_str()));
+      _hasGradient = true;
+      return;
+   }
+
    // Calculate gradient
    gInterpreter->Declare("#include <Math/CladDerivator.h>\n");
    // disable clang-format for making the following code unreadable.
@@ -180,6 +213,8 @@ void RooFuncWrapper::createGradient()
       throw std::runtime_error(errorMsg.str().c_str());
    }
 
+   differentiatedFunctions().insert(_funcName);
+
    _grad = reinterpret_cast<Grad>(gInterpreter->ProcessLine((gradName + ";").c_str()));
    _hasGradient = true;
 }
@@ -45,6 +45,7 @@ which returns spans pointing directly to the data.
 #include "Math/Util.h"
 #include "ROOT/StringUtils.hxx"
 #include "TBuffer.h"
+#include "TTree.h"
 
 #include <iomanip>
 using std::string, std::vector, std::cout, std::endl, std::list;
@@ -489,7 +490,111 @@ void RooVectorDataStore::weightError(double& lo, double& hi, RooAbsData::ErrorTy
 
 
 ////////////////////////////////////////////////////////////////////////////////
+/// Load values from tree 't' into this data collection, optionally
+/// selecting events using the RooFormulaVar 'select'.
 ///
+/// Same as RooTreeDataStore::loadValues(), but the values are copied directly
+/// into the vectors, instead of into an intermediate RooTreeDataStore. The
+/// source tree 't' is cloned to not disturb its branch structure when
+/// retrieving information from it.
+
+void RooVectorDataStore::loadValues(const TTree *t, const RooFormulaVar* select)
+{
+  // Make our local copy of the tree, so we can safely loop through it.
+  // We need a custom deleter, because if we don't deregister the Tree from the directory
+  // of the original, it tears it down at destruction time!
+  auto deleter = [](TTree* tree){tree->SetDirectory(nullptr); delete tree;};
+  std::unique_ptr<TTree, decltype(deleter)> tClone(static_cast<TTree*>(t->Clone()), deleter);
+  tClone->SetDirectory(t->GetDirectory());
+
+  // Clone list of variables
+  RooArgSet sourceArgSet;
+  _varsww.snapshot(sourceArgSet, false);
+
+  // Check that we have the branches:
+  bool missingBranches = false;
+  for (const auto var : sourceArgSet) {
+     if (!tClone->GetBranch(var->GetName())) {
+        missingBranches = true;
+        coutE(InputArguments) << "Didn't find a branch in Tree '" << tClone->GetName() << "' to read variable '"
+                              << var->GetName() << "' from."
+                              << "\n\tNote: Name the RooFit variable the same as the branch." << std::endl;
+     }
+  }
+  if (missingBranches) {
+     coutE(InputArguments) << "Cannot import data from TTree '" << tClone->GetName()
+                           << "' because some branches are missing !" << std::endl;
+     return;
+  }
+
+  // Attach args in cloned list to cloned source tree
+  for (const auto sourceArg : sourceArgSet) {
+    sourceArg->attachToTree(*tClone) ;
+  }
+
+  // Redirect formula servers to sourceArgSet
+  std::unique_ptr<RooFormulaVar> selectClone;
+  if (select) {
+    selectClone.reset( static_cast<RooFormulaVar*>(select->cloneTree()) );
+    selectClone->recursiveRedirectServers(sourceArgSet) ;
+    selectClone->setOperMode(RooAbsArg::ADirty,true) ;
+  }
+
+  // Loop over events in source tree, filling our vectors directly
+  Int_t numInvalid(0) ;
+  const Long64_t nevent = tClone->GetEntries();
+  reserve(numEntries() + nevent);
+  for(Long64_t i=0; i < nevent; ++i) {
+    const auto entryNumber = tClone->GetEntryNumber(i);
+    if (entryNumber<0) break;
+    tClone->GetEntry(entryNumber,1);
+
+    // Copy from source to destination
+    bool allOK(true) ;
+    for (unsigned int j=0; j < sourceArgSet.size(); ++j) {
+      auto destArg = _varsww[j];
+      const auto sourceArg = sourceArgSet[j];
+
+      destArg->copyCache(sourceArg) ;
+      sourceArg->copyCache(destArg) ;
+      if (!destArg->isValid()) {
+        numInvalid++ ;
+        allOK=false ;
+        if (numInvalid < 5) {
+          auto& log = coutI(DataHandling);
+          log << "RooVectorDataStore::loadValues(" << GetName() << ") Skipping event #" << i << " because "
+              << destArg->GetName() << " cannot accommodate the value ";
+          if(sourceArg->isCategory()) {
+            log << static_cast<RooAbsCategory*>(sourceArg)->getCurrentIndex();
+          } else {
+            log << static_cast<RooAbsReal*>(sourceArg)->getVal();
+          }
+          log << std::endl;
+        } else if (numInvalid == 5) {
+          coutI(DataHandling) << "RooVectorDataStore::loadValues(" << GetName() << ") Skipping ..." << std::endl;
+        }
+        break ;
+      }
+    }
+
+    // Does this event pass the cuts?
+    if (!allOK || (selectClone && selectClone->getVal()==0)) {
+      continue ;
+    }
+
+    fill() ;
+  }
+
+  if (numInvalid>0) {
+    coutW(DataHandling) << "RooVectorDataStore::loadValues(" << GetName() << ") Ignored " << numInvalid
+                        << " out-of-range events" << endl ;
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load values from dataset 't' into this data collection, optionally
+/// selecting events using 'select' RooFormulaVar
 
 void RooVectorDataStore::loadValues(const RooAbsDataStore *ads, const RooFormulaVar* select, const char* rangeName, std::size_t nStart, std::size_t nStop)
 {
@@ -22,6 +22,8 @@
 
 #include "Minuit2/MnStrategy.h"
 
+#include <cstring> // memcpy
+
 namespace RooFit {
 namespace TestStatistics {
 
@@ -31,7 +33,11 @@ LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood
    : LikelihoodGradientWrapper(std::move(likelihood), std::move(calculation_is_clean), N_dim, minimizer,
                                std::move(offset)),
      grad_(N_dim),
-     N_tasks_(N_dim)
+     N_tasks_(N_dim),
+     // created here, before the workers are forked, so that they share it
+     state_ring_(std::make_shared<MultiProcess::StateRing>(sizeof(std::size_t) +
+                                                           N_dim * sizeof(ROOT::Minuit2::DerivatorElement) +
+                                                           N_dim * sizeof(double)))
 {
    minuit_internal_x_.reserve(N_dim);
    offsets_previous_ = shared_offset_.offsets();
@@ -116,25 +122,58 @@ bool LikelihoodGradientJob::receive_task_result_on_master(const zmq::message_t &
 
 // SYNCHRONIZATION FROM MASTER TO WORKERS (STATE)
 
+/// Layout of a state_ring_ slot: the number of Minuit internal parameter values, the N_tasks_ gradient elements and
+/// the Minuit internal parameter values.
+void LikelihoodGradientJob::write_state_to_ring()
+{
+   assert(minuit_internal_x_.size() <= N_tasks_);
+   auto slot = static_cast<char *>(state_ring_->begin_write(state_id_));
+   std::size_t N_x = minuit_internal_x_.size();
+   memcpy(slot, &N_x, sizeof(std::size_t));
+   slot += sizeof(std::size_t);
+   memcpy(slot, grad_.data(), N_tasks_ * sizeof(ROOT::Minuit2::DerivatorElement));
+   slot += N_tasks_ * sizeof(ROOT::Minuit2::DerivatorElement);
+   memcpy(slot, minuit_internal_x_.data(), N_x * sizeof(double));
+   state_ring_->end_write(state_id_);
+}
+
+/// Returns false if the slot of state_id_ was already overwritten by a newer state, which will be received later.
+bool LikelihoodGradientJob::read_state_from_ring()
+{
+   auto slot = static_cast<const char *>(state_ring_->begin_read(state_id_));
+   if (slot == nullptr) {
+      return false;
+   }
+   std::size_t N_x;
+   memcpy(&N_x, slot, sizeof(std::size_t));
+   if (N_x > N_tasks_) {
+      // torn read of a slot that is being rewritten
+      return false;
+   }
+   slot += sizeof(std::size_t);
+   memcpy(grad_.data(), slot, N_tasks_ * sizeof(ROOT::Minuit2::DerivatorElement));
+   slot += N_tasks_ * sizeof(ROOT::Minuit2::DerivatorElement);
+   minuit_internal_x_.resize(N_x);
+   memcpy(minuit_internal_x_.data(), slot, N_x * sizeof(double));
+   return state_ring_->end_read(state_id_);
+}
+
 void LikelihoodGradientJob::update_workers_state()
 {
-   // TODO optimization: only send changed parameters (now sending all)
-   zmq::message_t gradient_message(grad_.begin(), grad_.end());
-   zmq::message_t minuit_internal_x_message(minuit_internal_x_.begin(), minuit_internal_x_.end());
+   // The gradient and the parameter values go through shared memory instead of being copied into every worker's
+   // subscriber socket; only the small state below is published.
    double maxFCN = minimizer_->maxFCN();
    double fcnOffset = minimizer_->fcnOffset();
    ++state_id_;
+   write_state_to_ring();
 
    if (shared_offset_.offsets() != offsets_previous_) {
       zmq::message_t offsets_message(shared_offset_.offsets().begin(), shared_offset_.offsets().end());
-      get_manager()->messenger().publish_from_master_to_workers(
-         id_, state_id_, isCalculating_, maxFCN, fcnOffset, std::move(gradient_message),
-         std::move(minuit_internal_x_message), std::move(offsets_message));
+      get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, maxFCN, fcnOffset,
+                                                                std::move(offsets_message));
       offsets_previous_ = shared_offset_.offsets();
    } else {
-      get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, maxFCN, fcnOffset,
-                                                                std::move(gradient_message),
-                                                                std::move(minuit_internal_x_message));
+      get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, maxFCN, fcnOffset);
    }
 }
 
@@ -159,20 +198,8 @@ void LikelihoodGradientJob::update_state()
 
       auto fcnOffset = get_manager()->messenger().receive_from_master_on_worker<double>(&more);
       minimizer_->fcnOffset() = fcnOffset;
-      assert(more);
 
-      auto gradient_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
-      assert(more);
-      auto gradient_message_begin = gradient_message.data<ROOT::Minuit2::DerivatorElement>();
-      auto gradient_message_end =
-         gradient_message_begin + gradient_message.size() / sizeof(ROOT::Minuit2::DerivatorElement);
-      std::copy(gradient_message_begin, gradient_message_end, grad_.begin());
-
-      auto minuit_internal_x_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
-      auto minuit_internal_x_message_begin = minuit_internal_x_message.data<double>();
-      auto minuit_internal_x_message_end =
-         minuit_internal_x_message_begin + minuit_internal_x_message.size() / sizeof(double);
-      std::copy(minuit_internal_x_message_begin, minuit_internal_x_message_end, minuit_internal_x_.begin());
+      bool state_is_current = read_state_from_ring();
 
       if (more) {
          // offsets also incoming
@@ -185,6 +212,12 @@ void LikelihoodGradientJob::update_state()
          std::copy(offsets_message_begin, offsets_message_end, shared_offset_.offsets().begin());
       }
 
+      if (!state_is_current) {
+         // this worker lagged behind and the master already published a newer state in the same slot, no need to
+         // set up the derivator for this one
+         return;
+      }
+
       // note: the next call must stay after the (possible) update of the offset, because it
       // calls the likelihood function, so the offset must be correct at this point
       gradf_.SetupDifferentiate(minimizer_->getMultiGenFcn(), minuit_internal_x_.data(),
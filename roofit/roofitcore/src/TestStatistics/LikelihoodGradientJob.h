@@ -14,12 +14,14 @@
 #define ROOT_ROOFIT_TESTSTATISTICS_LikelihoodGradientJob
 
 #include "RooFit/MultiProcess/Job.h"
+#include "RooFit/MultiProcess/StateRing.h"
 #include "RooFit/TestStatistics/LikelihoodGradientWrapper.h"
 
 #include "Math/MinimizerOptions.h"
 #include "Minuit2/NumericalDerivator.h"
 #include "Minuit2/MnMatrix.h"
 
+#include <memory>
 #include <vector>
 
 namespace RooFit {
@@ -72,6 +74,8 @@ private:
 
    void update_workers_state();
    void update_workers_state_isCalculating();
+   void write_state_to_ring();
+   bool read_state_from_ring();
    void calculate_all();
 
    // members
@@ -83,6 +87,8 @@ private:
    std::size_t N_tasks_ = 0;
    std::size_t N_tasks_at_workers_ = 0;
    std::vector<double> minuit_internal_x_;
+   // shared memory that carries grad_ and minuit_internal_x_ from master to workers, see update_workers_state
+   std::shared_ptr<MultiProcess::StateRing> state_ring_;
 
    mutable bool isCalculating_ = false;
 
@@ -29,6 +29,10 @@
 
 #include "TMath.h" // IsNaN
 
+#include <algorithm> // clamp, lower_bound
+#include <chrono>
+#include <numeric> // partial_sum
+
 namespace RooFit {
 namespace TestStatistics {
 
@@ -37,6 +41,7 @@ LikelihoodJob::LikelihoodJob(std::shared_ptr<RooAbsL> likelihood,
    : LikelihoodWrapper(std::move(likelihood), std::move(calculation_is_clean), std::move(offset)),
      n_event_tasks_(MultiProcess::Config::LikelihoodJob::defaultNEventTasks),
      n_component_tasks_(MultiProcess::Config::LikelihoodJob::defaultNComponentTasks),
+     balance_component_tasks_(MultiProcess::Config::LikelihoodJob::defaultBalanceComponentTasks),
      likelihood_serial_(likelihood_, calculation_is_clean_, shared_offset_)
 {
    init_vars();
@@ -108,6 +113,15 @@ void LikelihoodJob::update_state()
          assert(!more);
          break;
       }
+      case update_state_mode::component_tasks: {
+         state_id_ = get_manager()->messenger().receive_from_master_on_worker<RooFit::MultiProcess::State>(&more);
+         assert(more);
+         auto message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
+         assert(!more);
+         auto message_begin = message.data<std::size_t>();
+         component_task_bounds_.assign(message_begin, message_begin + message.size() / sizeof(std::size_t));
+         break;
+      }
       }
    }
 }
@@ -139,6 +153,15 @@ std::size_t LikelihoodJob::getNComponentTasks()
    return val;
 }
 
+/// First component of a component task; for component_task == getNComponentTasks(), the number of components.
+std::size_t LikelihoodJob::getComponentsFirst(std::size_t component_task)
+{
+   if (!component_task_bounds_.empty()) {
+      return component_task_bounds_[component_task];
+   }
+   return likelihood_->getNComponents() * component_task / getNComponentTasks();
+}
+
 void LikelihoodJob::updateWorkersParameters()
 {
    if (get_manager()->process_manager().is_master()) {
@@ -191,6 +214,58 @@ void LikelihoodJob::updateWorkersOffsetting()
    get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::offsetting, isOffsetting());
 }
 
+/// Redistributes the components over the component tasks, so that the tasks take roughly equal times according to
+/// the component evaluation times measured in the previous evaluation. The tasks keep contiguous ranges of at least
+/// one component. The new ranges are only sent to the workers if they reduce the time of the slowest task by more
+/// than 10%, to avoid reshuffling on timing noise.
+void LikelihoodJob::updateWorkersComponentTasks()
+{
+   std::size_t n_tasks = getNComponentTasks();
+   std::size_t n_components = likelihood_->getNComponents();
+   std::vector<double> costs;
+   std::swap(costs, component_costs_);
+   if (!balance_component_tasks_ || likelihood_type_ != LikelihoodType::sum || n_tasks < 2 ||
+       costs.size() != n_components) {
+      return;
+   }
+
+   std::vector<double> cumulative(n_components + 1, 0.);
+   std::partial_sum(costs.begin(), costs.end(), cumulative.begin() + 1);
+   double total = cumulative.back();
+   if (!(total > 0)) {
+      return;
+   }
+
+   std::vector<std::size_t> bounds(n_tasks + 1);
+   bounds[0] = 0;
+   bounds[n_tasks] = n_components;
+   for (std::size_t k = 1; k < n_tasks; ++k) {
+      double target = total * k / n_tasks;
+      std::size_t i = std::lower_bound(cumulative.begin(), cumulative.end(), target) - cumulative.begin();
+      if (i > 0 && target - cumulative[i - 1] < cumulative[i] - target) {
+         --i;
+      }
+      bounds[k] = std::clamp(i, bounds[k - 1] + 1, n_components - (n_tasks - k));
+   }
+
+   auto slowestTask = [&](auto getFirst) {
+      double slowest = 0;
+      for (std::size_t k = 0; k < n_tasks; ++k) {
+         slowest = std::max(slowest, cumulative[getFirst(k + 1)] - cumulative[getFirst(k)]);
+      }
+      return slowest;
+   };
+   double slowest_new = slowestTask([&](std::size_t k) { return bounds[k]; });
+   double slowest_current = slowestTask([&](std::size_t k) { return getComponentsFirst(k); });
+   if (slowest_new < 0.9 * slowest_current) {
+      component_task_bounds_ = bounds;
+      ++state_id_;
+      zmq::message_t message(bounds.begin(), bounds.end());
+      get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::component_tasks, state_id_,
+                                                                std::move(message));
+   }
+}
+
 void LikelihoodJob::evaluate()
 {
    if (get_manager()->process_manager().is_master()) {
@@ -203,6 +278,7 @@ void LikelihoodJob::evaluate()
 
       // update parameters that changed since last calculation (or creation if first time)
       updateWorkersParameters();
+      updateWorkersComponentTasks();
 
       // master fills queue with tasks
       auto N_tasks = getNEventTasks() * getNComponentTasks();
@@ -249,9 +325,12 @@ void LikelihoodJob::send_back_task_result_from_worker(std::size_t /*task*/)
       RooAbsReal::clearEvalErrorLog();
    }
 
-   task_result_t task_result{id_, result_.Result(), result_.Carry(), numErrors > 0};
-   zmq::message_t message(sizeof(task_result_t));
+   task_result_t task_result{id_,           result_.Result(),       result_.Carry(),
+                             numErrors > 0, component_times_first_, component_times_.size()};
+   std::size_t times_size = component_times_.size() * sizeof(double);
+   zmq::message_t message(sizeof(task_result_t) + times_size);
    memcpy(message.data(), &task_result, sizeof(task_result_t));
+   memcpy(static_cast<char *>(message.data()) + sizeof(task_result_t), component_times_.data(), times_size);
    get_manager()->messenger().send_from_worker_to_master(std::move(message));
 }
 
@@ -259,6 +338,16 @@ bool LikelihoodJob::receive_task_result_on_master(const zmq::message_t &message)
 {
    auto task_result = message.data<task_result_t>();
    results_.emplace_back(task_result->value, task_result->carry);
+   if (task_result->n_component_times > 0) {
+      // summed over the event tasks
+      component_costs_.resize(likelihood_->getNComponents(), 0.);
+      auto times = static_cast<const char *>(message.data()) + sizeof(task_result_t);
+      for (std::size_t ix = 0; ix < task_result->n_component_times; ++ix) {
+         double time;
+         memcpy(&time, times + ix * sizeof(double), sizeof(double));
+         component_costs_[task_result->components_first + ix] += time;
+      }
+   }
    if (task_result->has_errors) {
       RooAbsReal::logEvalError(nullptr, "LikelihoodJob", "evaluation errors at the worker processes", "no servervalue");
    }
@@ -273,6 +362,7 @@ void LikelihoodJob::evaluate_task(std::size_t task)
 {
    assert(get_manager()->process_manager().is_worker());
 
+   component_times_.clear();
    double section_first = 0;
    double section_last = 1;
    if (getNEventTasks() > 1) {
@@ -310,18 +400,20 @@ void LikelihoodJob::evaluate_task(std::size_t task)
       std::size_t components_last = likelihood_->getNComponents();
       if (getNComponentTasks() > 1) {
          std::size_t component_task = task / getNEventTasks();
-         components_first = likelihood_->getNComponents() * component_task / getNComponentTasks();
-         if (component_task == getNComponentTasks() - 1) {
-            components_last = likelihood_->getNComponents();
-         } else {
-            components_last = likelihood_->getNComponents() * (component_task + 1) / getNComponentTasks();
-         }
+         components_first = getComponentsFirst(component_task);
+         components_last = getComponentsFirst(component_task + 1);
       }
+      component_times_first_ = components_first;
 
       result_ = ROOT::Math::KahanSum<double>();
       RooNaNPacker packedNaN;
       for (std::size_t comp_ix = components_first; comp_ix < components_last; ++comp_ix) {
+         auto start = std::chrono::steady_clock::now();
          auto component_result = likelihood_->evaluatePartition({section_first, section_last}, comp_ix, comp_ix + 1);
+         if (balance_component_tasks_) {
+            component_times_.push_back(
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+         }
          packedNaN.accumulate(component_result.Sum());
          if (do_offset_ && section_last == 1 &&
              shared_offset_.offsets()[comp_ix] != ROOT::Math::KahanSum<double>(0, 0)) {
@@ -364,6 +456,7 @@ std::ostream &operator<<(std::ostream &out, const LikelihoodJob::update_state_mo
    switch (value) {
       PROCESS_VAL(LikelihoodJob::update_state_mode::offsetting);
       PROCESS_VAL(LikelihoodJob::update_state_mode::parameters);
+      PROCESS_VAL(LikelihoodJob::update_state_mode::component_tasks);
    default: s = std::to_string(static_cast<int>(value));
    }
    return out << s;
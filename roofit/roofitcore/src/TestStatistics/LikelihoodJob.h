@@ -40,6 +40,7 @@ public:
 
    void updateWorkersParameters(); // helper for evaluate
    void updateWorkersOffsetting(); // helper for enableOffsetting
+   void updateWorkersComponentTasks(); // helper for evaluate
 
    // Job overrides:
    void evaluate_task(std::size_t task) override;
@@ -50,7 +51,7 @@ public:
       double value;
       bool is_constant;
    };
-   enum class update_state_mode : int { parameters, offsetting };
+   enum class update_state_mode : int { parameters, offsetting, component_tasks };
 
    // --- RESULT LOGISTICS ---
    struct task_result_t {
@@ -58,6 +59,9 @@ public:
       double value;
       double carry;
       bool has_errors;
+      // when balancing component tasks, the message is followed by the evaluation times of these components:
+      std::size_t components_first;
+      std::size_t n_component_times;
    };
 
    void send_back_task_result_from_worker(std::size_t task) override;
@@ -79,6 +83,15 @@ private:
    std::size_t n_component_tasks_;
    std::size_t getNEventTasks();
    std::size_t getNComponentTasks();
+   std::size_t getComponentsFirst(std::size_t component_task);
+
+   bool balance_component_tasks_;
+   // first component of each component task, plus the total number of components; empty means equal numbers of
+   // components per task
+   std::vector<std::size_t> component_task_bounds_;
+   std::vector<double> component_times_; // worker: times of the components of the last task, in seconds
+   std::size_t component_times_first_ = 0;
+   std::vector<double> component_costs_; // master: times of all the components in the last evaluation
 
    SharedOffset::OffsetVec offsets_previous_;
    LikelihoodSerial likelihood_serial_;
@@ -28,6 +28,7 @@
 
 #include "Math/Util.h" // KahanSum
 
+#include <cmath>     // abs
 #include <stdexcept> // runtime_error
 
 #include "../gtest_wrapper.h"
@@ -380,6 +381,52 @@ TEST_F(LikelihoodJobTest, SimUnbinned)
       RooFit::MultiProcess::Config::LikelihoodJob::automaticNComponentTasks;
 }
 
+TEST_F(LikelihoodJobTest, SimUnbinnedBalancedComponentTasks)
+{
+   // One channel dominates the evaluation time, so the balancing should give it a component task of its own; the
+   // likelihood values must not change with the grouping of the components.
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNEventTasks = 1;
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNComponentTasks = 2;
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultBalanceComponentTasks = true;
+
+   w.factory("Gaussian::gA(x[-10,10],mA[2,-10,10],s[3,0.1,10])");
+   w.factory("Gaussian::gB(x,mB[-2,-10,10],s)");
+   w.factory("Gaussian::gC(x,mC[0,-10,10],s)");
+   w.factory("Gaussian::gD(x,mD[1,-10,10],s)");
+   w.factory("SIMUL::model(index[A,B,C,D],A=gA,B=gB,C=gC,D=gD)");
+
+   pdf = w.pdf("model");
+   RooArgSet observables{*w.var("x"), *w.cat("index")};
+   data = std::make_unique<RooDataSet>("data", "data", observables);
+   for (auto [label, n] : {std::make_pair("A", 20000), std::make_pair("B", 100), std::make_pair("C", 100),
+                           std::make_pair("D", 100)}) {
+      w.cat("index")->setLabel(label);
+      std::unique_ptr<RooDataSet> channel{w.pdf(std::string("g") + label)->generate(*w.var("x"), n)};
+      channel->addColumn(*w.cat("index"));
+      static_cast<RooDataSet &>(*data).append(*channel);
+   }
+
+   nll = std::unique_ptr<RooAbsReal>{pdf->createNLL(*data)};
+
+   likelihood = RooFit::TestStatistics::buildLikelihood(pdf, data.get());
+   SharedOffset offset;
+   auto nll_ts =
+      LikelihoodWrapper::create(RooFit::TestStatistics::LikelihoodMode::multiprocess, likelihood, clean_flags, offset);
+
+   for (double mA : {2.0, 2.1, 2.2, 2.3}) {
+      w.var("mA")->setVal(mA);
+      nll_ts->evaluate();
+      EXPECT_NEAR(nll->getVal(), nll_ts->getResult().Sum(), 1e-10 * std::abs(nll->getVal()));
+   }
+
+   // reset static variables to automatic
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNEventTasks =
+      RooFit::MultiProcess::Config::LikelihoodJob::automaticNEventTasks;
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNComponentTasks =
+      RooFit::MultiProcess::Config::LikelihoodJob::automaticNComponentTasks;
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultBalanceComponentTasks = false;
+}
+
 TEST_F(LikelihoodJobTest, SimUnbinnedNonExtended)
 {
    // SIMULTANEOUS FIT OF 2 UNBINNED DATASETS
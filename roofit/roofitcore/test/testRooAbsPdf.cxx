@@ -21,6 +21,7 @@
 
 #include <TClass.h>
 #include <TRandom.h>
+#include <TROOT.h>
 
 #include "gtest_wrapper.h"
 
@@ -397,6 +398,35 @@ TEST(RooAbsPdf, NormSetChange)
    EXPECT_NE(v1, v2);
 }
 
+#ifdef R__USE_IMT
+// The likelihood evaluated with the CPU backend is the same when the computations are split among threads.
+TEST(RooAbsPdf, MultiThreadedNLL)
+{
+   using namespace RooFit;
+
+   RooWorkspace ws;
+   ws.factory("SUM::model(f[0.3, 0, 1] * Gaussian::sig(x[0, 10], mu[5, 0, 10], sigma[1, 0.1, 5]),"
+              " Exponential::bkg(x, c[-0.2, -1, 0]))");
+   RooRealVar &x = *ws.var("x");
+   RooAbsPdf &model = *ws.pdf("model");
+   RooRandom::randomGenerator()->SetSeed(1337);
+   std::unique_ptr<RooDataSet> data{model.generate(x, 200000)};
+
+   std::unique_ptr<RooAbsReal> nllSequential{model.createNLL(*data, EvalBackend::Cpu())};
+   const double valSequential = nllSequential->getVal();
+
+   ROOT::EnableImplicitMT(4);
+   std::unique_ptr<RooAbsReal> nllParallel{model.createNLL(*data, EvalBackend::Cpu())};
+   const double valParallel = nllParallel->getVal();
+   ws.var("mu")->setVal(5.1);
+   const double valParallelMoved = nllParallel->getVal();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_NEAR(valParallel, valSequential, 1e-10 * std::abs(valSequential));
+   EXPECT_NEAR(valParallelMoved, nllSequential->getVal(), 1e-10 * std::abs(valSequential));
+}
+#endif
+
 INSTANTIATE_TEST_SUITE_P(RooAbsPdf, FitTest, testing::Values(ROOFIT_EVAL_BACKENDS),
                          [](testing::TestParamInfo<FitTest::ParamType> const &paramInfo) {
                             std::stringstream ss;
@@ -17,6 +17,7 @@
 #include "gtest_wrapper.h"
 
 #include <memory>
+#include <vector>
 
 /// Verify that sPlot does work with a RooAddPdf. This reproduces GitHub issue
 /// #10869, where creating an SPlot from a RooAdPdf unreasonably changed the
@@ -382,3 +383,90 @@ TEST(RooAddPdf, ImplicitDimensions)
    EXPECT_DOUBLE_EQ(pdf.getVal(normSet), refVal);
    EXPECT_DOUBLE_EQ(evaluator.run()[0], refVal);
 }
+
+/// The Evaluator computes the chain of elementwise nodes of a RooAddPdf over
+/// tiles of events. Over many events, and after changing a parameter of one
+/// of the components, it gives the same values as the getVal() interface.
+TEST(RooAddPdf, FusedEvaluation)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("SUM::model(f[0.3, 0, 1] * Gaussian::sig(x[0, 10], mu[5, 0, 10], sigma[1, 0.1, 5]),"
+              " Exponential::bkg(x, c[-0.2, -1, 0]))");
+   RooRealVar &x = *ws.var("x");
+   RooAbsPdf &model = *ws.pdf("model");
+   RooArgSet normSet{x};
+
+   std::unique_ptr<RooAbsReal> modelCompiled{RooFit::Detail::compileForNormSet(model, normSet)};
+   RooFit::Evaluator evaluator{*modelCompiled};
+
+   std::vector<double> xValues(10001);
+   for (std::size_t i = 0; i < xValues.size(); ++i) {
+      xValues[i] = 10. * i / xValues.size();
+   }
+   evaluator.setInput("x", xValues, false);
+
+   for (double mu : {5., 5.5}) {
+      ws.var("mu")->setVal(mu);
+      std::span<const double> values = evaluator.run();
+      ASSERT_EQ(values.size(), xValues.size());
+      for (std::size_t i = 0; i < xValues.size(); i += 97) {
+         x.setVal(xValues[i]);
+         EXPECT_NEAR(values[i], model.getVal(normSet), 1e-10) << "mu = " << mu << ", x = " << xValues[i];
+      }
+   }
+}
+
+/// The Evaluator keeps the previous outputs of the nodes, to restore them when
+/// a parameter is reset to a previous value like in the computation of a
+/// numerical gradient. The restored outputs and the outputs of the nodes that
+/// don't depend on the stepped parameter must be the ones for the current
+/// parameter values.
+TEST(RooAddPdf, CachedOutputs)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("SUM::model(f[0.3, 0, 1] * Gaussian::sig(x[0, 10], mu[5, 0, 10], sigma[1, 0.1, 5]),"
+              " Exponential::bkg(x, c[-0.2, -1, 0]))");
+   RooRealVar &x = *ws.var("x");
+   RooAbsPdf &model = *ws.pdf("model");
+   RooArgSet normSet{x};
+
+   std::unique_ptr<RooAbsReal> modelCompiled{RooFit::Detail::compileForNormSet(model, normSet)};
+   RooFit::Evaluator evaluator{*modelCompiled};
+
+   std::vector<double> xValues(1000);
+   for (std::size_t i = 0; i < xValues.size(); ++i) {
+      xValues[i] = 10. * i / xValues.size();
+   }
+   evaluator.setInput("x", xValues, false);
+
+   auto run = [&]() {
+      std::span<const double> values = evaluator.run();
+      return std::vector<double>(values.begin(), values.end());
+   };
+
+   const std::vector<double> nominal = run();
+
+   // parameter steps of a central derivative, and reset to the nominal values
+   for (auto [name, step] : {std::make_pair("mu", 0.01), std::make_pair("c", 0.001), std::make_pair("f", 0.01)}) {
+      RooRealVar &var = *ws.var(name);
+      const double value = var.getVal();
+      for (double shifted : {value + step, value - step, value + 0.5 * step, value - 0.5 * step}) {
+         var.setVal(shifted);
+         const std::vector<double> values = run();
+         for (std::size_t i = 0; i < xValues.size(); i += 37) {
+            x.setVal(xValues[i]);
+            EXPECT_NEAR(values[i], model.getVal(normSet), 1e-10) << name << " = " << shifted << ", x = " << xValues[i];
+         }
+      }
+      var.setVal(value);
+      EXPECT_EQ(run(), nominal) << "after resetting " << name;
+   }
+
+   // setting the same value again doesn't change the output
+   ws.var("sigma")->setVal(ws.var("sigma")->getVal());
+   EXPECT_EQ(run(), nominal);
+}
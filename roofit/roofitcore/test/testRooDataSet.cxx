@@ -65,6 +65,54 @@ TEST(RooDataSet, ImportFromTreeWithCut)
 }
 #endif
 
+/// The vector storage reads the TTree directly, without going through a RooTreeDataStore. Check that it imports the
+/// same events, values and weights as the tree storage, also for branches that are not of type double.
+TEST(RooDataSet, ImportFromTreeSameAsTreeStorage)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   TTree tree("tree", "tree");
+   float theXVal;
+   int theCatVal;
+   double theWeight;
+   tree.Branch("x", &theXVal);
+   tree.Branch("c", &theCatVal);
+   tree.Branch("w", &theWeight);
+   for (int i = 0; i < 100; ++i) {
+      theXVal = 0.25 * i - 2.;
+      theCatVal = i % 3;
+      theWeight = 0.5 + 0.01 * i;
+      tree.Fill();
+   }
+
+   RooRealVar x("x", "x", 0, 20); // the events with negative x are out of range, and skipped
+   RooCategory c("c", "c", {{"zero", 0}, {"one", 1}, {"two", 2}});
+   RooRealVar w("w", "w", 1);
+
+   auto makeData = [&](RooAbsData::StorageType storageType) {
+      RooAbsData::setDefaultStorageType(storageType);
+      auto data = std::make_unique<RooDataSet>("data", "data", RooArgSet{x, c, w}, RooFit::Import(tree),
+                                               RooFit::WeightVar(w), RooFit::Cut("x < 15"));
+      RooAbsData::setDefaultStorageType(RooAbsData::Vector);
+      return data;
+   };
+   std::unique_ptr<RooDataSet> treeData = makeData(RooAbsData::Tree);
+   std::unique_ptr<RooDataSet> vectorData = makeData(RooAbsData::Vector);
+   ASSERT_NE(dynamic_cast<RooVectorDataStore const *>(vectorData->store()), nullptr);
+
+   ASSERT_EQ(vectorData->numEntries(), treeData->numEntries());
+   EXPECT_GT(vectorData->numEntries(), 0);
+   EXPECT_DOUBLE_EQ(vectorData->sumEntries(), treeData->sumEntries());
+   for (int i = 0; i < vectorData->numEntries(); ++i) {
+      const RooArgSet &vectorRow = *vectorData->get(i);
+      const double vectorWeight = vectorData->weight();
+      const RooArgSet &treeRow = *treeData->get(i);
+      EXPECT_EQ(vectorRow.getRealValue("x"), treeRow.getRealValue("x"));
+      EXPECT_EQ(vectorRow.getCatIndex("c"), treeRow.getCatIndex("c"));
+      EXPECT_EQ(vectorWeight, treeData->weight());
+   }
+}
+
 /// ROOT-9528 Branch names are capped after a certain number of characters
 TEST(RooDataSet, ImportLongBranchNames)
 {
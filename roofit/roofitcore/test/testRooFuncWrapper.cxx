@@ -124,6 +124,36 @@ TEST(RooFuncWrapper, GaussianNormalized)
    }
 }
 
+/// Wrappers of the same model with the same data layout, but different
+/// data, share the compiled function and its gradient.
+TEST(RooFuncWrapper, ReuseCompiledCode)
+{
+   RooWorkspace ws;
+   ws.factory("Gaussian::gauss(x[0, -10, 10], mu[1, -10, 10], sigma[2.0, 0.01, 10])");
+   RooAbsPdf &gauss = *ws.pdf("gauss");
+   RooRealVar &x = *ws.var("x");
+
+   std::unique_ptr<RooDataSet> data1{gauss.generate(x, 100)};
+   std::unique_ptr<RooDataSet> data2{gauss.generate(x, 100)};
+
+   std::unique_ptr<RooAbsReal> nll1{gauss.createNLL(*data1, RooFit::EvalBackend::Codegen())};
+   std::unique_ptr<RooAbsReal> nll2{gauss.createNLL(*data2, RooFit::EvalBackend::Codegen())};
+   std::unique_ptr<RooAbsReal> nllRef2{gauss.createNLL(*data2)};
+
+   auto &wrapper1 = static_cast<RooFit::Experimental::RooFuncWrapper &>(*nll1);
+   auto &wrapper2 = static_cast<RooFit::Experimental::RooFuncWrapper &>(*nll2);
+
+   EXPECT_EQ(wrapper1.funcName(), wrapper2.funcName());
+   EXPECT_NE(nll1->getVal(), nll2->getVal());
+   EXPECT_NEAR(nll2->getVal(), nllRef2->getVal(), 1e-8 * std::abs(nllRef2->getVal()));
+
+   std::vector<double> grad1(wrapper1.getNumParams());
+   std::vector<double> grad2(wrapper2.getNumParams());
+   wrapper1.gradient(grad1.data());
+   wrapper2.gradient(grad2.data());
+   EXPECT_NE(grad1, grad2);
+}
+
 TEST(RooFuncWrapper, Exponential)
 {
 
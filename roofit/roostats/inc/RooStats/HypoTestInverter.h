@@ -22,6 +22,7 @@ class TGraphErrors;
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RooStats {
 
@@ -146,6 +147,11 @@ public:
    /// set numerical error in test statistic evaluation (default is zero)
    void SetNumErr(double err) { fNumErr = err; }
 
+   /// Set the number of processes in which the points of a fixed scan are evaluated (default is 1, i.e. no
+   /// parallelisation). Each process is a fork of the current one, so the calculator must not use PROOF.
+   /// Not available on Windows, where the points are always evaluated sequentially.
+   void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
@@ -163,6 +169,10 @@ protected:
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
+   HypoTestResult *EvalPoint(double &rVal, bool adaptive, double clTarget) const;
+   void AddPointResult(double rVal, HypoTestResult *result) const;
+   bool RunParallelScan(const std::vector<double> &points) const;
+
    /// helper functions
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
@@ -199,6 +209,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   unsigned int fNWorkers = 1; ///<! number of processes for the fixed scans
 
 protected:
 
@@ -76,6 +76,10 @@ class ToyMCSampler: public TestStatSampler {
 
       void SetUseMultiGen(bool flag) { fUseMultiGen = flag ; }
 
+      /// Generate the toy datasets in batches of `size` toys, with a single call to RooAbsPdf::generate() per batch.
+      /// See ToyMCSampler::GenerateFromBatch() for the cases where this is possible. A size of 1 disables batching.
+      void SetToyBatchSize(Int_t size) { fToyBatchSize = size; }
+
       /// main interface
       SamplingDistribution* GetSamplingDistribution(RooArgSet& paramPoint) override;
       virtual RooDataSet* GetSamplingDistributions(RooArgSet& paramPoint);
@@ -237,6 +241,8 @@ class ToyMCSampler: public TestStatSampler {
 
       /// helper for GenerateToyData
       std::unique_ptr<RooAbsData> Generate(RooAbsPdf &pdf, RooArgSet &observables, const RooDataSet *protoData=nullptr, int forceEvents=0) const;
+      /// helper for Generate
+      std::unique_ptr<RooAbsData> GenerateFromBatch(RooAbsPdf &pdf, RooArgSet &observables) const;
 
       /// helper method for clearing  the cache
       virtual void ClearCache();
@@ -290,9 +296,16 @@ class ToyMCSampler: public TestStatSampler {
 
       static bool fgAlwaysUseMultiGen ;  ///< Use PrepareMultiGen always
       bool fUseMultiGen = false;         ///< Use PrepareMultiGen?
+      Int_t fToyBatchSize = 1;           ///< Number of toys generated at once
+
+      mutable std::unique_ptr<RooDataSet> _toyBatch; ///<! Generated events of the current batch of toys
+      mutable std::vector<Int_t> _toyBatchNEvents;   ///<! Number of events of each toy of the current batch
+      mutable std::size_t _toyBatchNext = 0;         ///<! Index of the next toy of the current batch
+      mutable Int_t _toyBatchFirstEvent = 0;         ///<! First event of the next toy in _toyBatch
+      mutable bool _toyBatchDisabled = false;        ///<! Whether the batch generation gave binned data
 
    protected:
-   ClassDefOverride(ToyMCSampler, 4) // A simple implementation of the TestStatSampler interface
+   ClassDefOverride(ToyMCSampler, 5) // A simple implementation of the TestStatSampler interface
 };
 }
 
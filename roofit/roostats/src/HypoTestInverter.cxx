@@ -64,6 +64,11 @@ call HypoTestInverter::UseCLs().
 
 #include "RooStats/ProofConfig.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <memory>
@@ -408,6 +413,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -604,7 +610,9 @@ HypoTestResult * HypoTestInverter::Eval(HypoTestCalculatorGeneric &hc, bool adap
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Run a Fixed scan in npoints between min and max
+/// Run a Fixed scan in npoints between min and max.
+/// If more than one worker was set with SetNWorkers, the points are evaluated in parallel in forked
+/// processes, see SetNWorkers.
 
 bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool scanLog ) const
 {
@@ -648,16 +656,25 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
-
-      if (i > 0) { // avoids case of nBins = 1
+   std::vector<double> points(nBins, xMin);
+   for (int i = 1; i < nBins; i++) { // avoids case of nBins = 1
       if (scanLog) {
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+            points[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
       } else {
-            thisX = xMin + i * (xMax - xMin) / (nBins - 1); // linear scan in x
-      }
+            points[i] = xMin + i * (xMax - xMin) / (nBins - 1); // linear scan in x
       }
+   }
+
+   if (fNWorkers > 1 && nBins > 1) {
+#ifndef _MSC_VER
+      return RunParallelScan(points);
+#else
+      oocoutW(nullptr, Eval) << "HypoTestInverter::RunFixedScan - parallel scans are not supported on Windows, "
+                             << "running the points sequentially" << std::endl;
+#endif
+   }
+
+   for (double thisX : points) {
 
       const bool status = RunOnePoint(thisX);
 
@@ -678,6 +695,18 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    CreateResults();
 
+   HypoTestResult *result = EvalPoint(rVal, adaptive, clTarget);
+   if (!result) return false;
+   AddPointResult(rVal, result);
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the hypothesis test at the given POI value, clipped to the range of the scanned variable.
+/// Returns the result, owned by the caller, or nullptr if the test failed or its result is invalid.
+
+HypoTestResult *HypoTestInverter::EvalPoint(double &rVal, bool adaptive, double clTarget) const
+{
    // check if rVal is in the range specified for fScannedVariable
    if ( rVal < fScannedVariable->getMin() ) {
       oocoutE(nullptr,InputArguments) << "HypoTestInverter::RunOnePoint - Out of range: using the lower bound "
@@ -716,7 +745,7 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!result) {
       oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " <<
    fScannedVariable->getVal() << endl;
-      return false;
+      return nullptr;
    }
    // in case of a dummy result
    const double nullPV = result->NullPValue();
@@ -724,9 +753,22 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!std::isfinite(nullPV) || nullPV < 0. || nullPV > 1. || !std::isfinite(altPV) || altPV < 0. || altPV > 1.) {
       oocoutW(nullptr,Eval) << "HypoTestInverter - Skipping invalid result for  point " << fScannedVariable->GetName() << " = " <<
          fScannedVariable->getVal() << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
-      return false;
+      return nullptr;
    }
 
+   fScannedVariable->setVal(oldValue);
+
+   return result.release();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the result of the point rVal to the results, taking ownership of it.
+/// If the last point of the results is also rVal, the two results are merged.
+
+void HypoTestInverter::AddPointResult(double rVal, HypoTestResult *resultPtr) const
+{
+   std::unique_ptr<HypoTestResult> result(resultPtr);
+
    double lastXtested;
    if ( fResults->ArraySize()!=0 ) lastXtested = fResults->GetXValue(fResults->ArraySize()-1);
    else lastXtested = -999;
@@ -756,11 +798,51 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
      fResults->fYObjects.Add(result.release());
 
    }
+}
 
-   fScannedVariable->setVal(oldValue);
+#ifndef _MSC_VER
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the points of a fixed scan in parallel, in fNWorkers forked processes, and add their results
+/// in the order of the points, as RunOnePoint would.
+/// Every point uses its own random seed, drawn from RooRandom::randomGenerator() before forking,
+/// so that the toys of different points are independent and the scan is reproducible.
+
+bool HypoTestInverter::RunParallelScan(const std::vector<double> &points) const
+{
+   std::vector<unsigned int> seeds(points.size());
+   for (auto &seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   oocoutI(nullptr, Eval) << "HypoTestInverter::RunFixedScan - running " << points.size() << " points in "
+                          << fNWorkers << " processes" << std::endl;
+
+   auto evalPoint = [&](unsigned int i) {
+      RooRandom::randomGenerator()->SetSeed(seeds[i]);
+      double rVal = points[i];
+      return EvalPoint(rVal, false, -1);
+   };
+   ROOT::TProcessExecutor workers(std::min<unsigned int>(fNWorkers, points.size()));
+   std::vector<HypoTestResult *> results = workers.Map(evalPoint, ROOT::TSeqU(points.size()));
+
+   for (std::size_t i = 0; i < points.size(); ++i) {
+      HypoTestResult *result = results[i];
+      if (!result) {
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << points[i]
+                               << " failed. Skipping." << std::endl;
+         continue;
+      }
+      // the toys were counted in the workers
+      if (result->GetNullDistribution() && result->GetAltDistribution()) {
+         fTotalToysRun += result->GetAltDistribution()->GetSize() + result->GetNullDistribution()->GetSize();
+      }
+      // same clipping to the range of the scanned variable as in the workers
+      const double rVal = std::min(std::max(points[i], fScannedVariable->getMin()), fScannedVariable->getMax());
+      AddPointResult(rVal, result);
+   }
 
    return true;
 }
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Run an automatic scan until the desired accuracy is reached.
@@ -552,6 +552,12 @@ std::unique_ptr<RooAbsData> ToyMCSampler::Generate(RooAbsPdf &pdf, RooArgSet &ob
   int events = forceEvents;
   if(events == 0) events = fNEvents;
 
+  if (fToyBatchSize > 1 && !protoData && forceEvents == 0 && &pdf == fPdf) {
+    if (auto toy = GenerateFromBatch(pdf, observables)) {
+      return toy;
+    }
+  }
+
   // cannot use multigen when the nuisance parameters change for every toy
   bool useMultiGen = (fUseMultiGen || fgAlwaysUseMultiGen) && !fNuisanceParametersSampler;
 
@@ -609,6 +615,71 @@ std::unique_ptr<RooAbsData> ToyMCSampler::Generate(RooAbsPdf &pdf, RooArgSet &ob
   return data;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the next toy of the current batch of toys, generating a new batch
+/// when the last one is used up, or nullptr if the toys cannot be generated in
+/// batches.
+///
+/// A batch of fToyBatchSize toys is generated with a single call to
+/// RooAbsPdf::generate(), which avoids setting up the generator for every toy.
+/// For extended pdfs, the number of events of each toy is first drawn from the
+/// Poisson distribution of the expected number of events; since the events are
+/// independent, splitting the batch into toys of these sizes gives the same
+/// distribution as generating the extended toys one by one.
+///
+/// This is only possible when all the toys of a run are generated from the same
+/// parameter values, i.e. without randomization of the nuisance parameters, and
+/// without prototype data or binned generation. The global observables are
+/// still generated for every toy. If the generation gives binned (weighted)
+/// data, for instance because of AutoBinned generation of a binned pdf, the
+/// batching is disabled, as binned generation is fast anyway.
+
+std::unique_ptr<RooAbsData> ToyMCSampler::GenerateFromBatch(RooAbsPdf &pdf, RooArgSet &observables) const {
+
+  if (_toyBatchDisabled || fNuisanceParametersSampler || fGenerateBinned) return nullptr;
+
+  if (_toyBatchNext == _toyBatchNEvents.size()) {
+    _toyBatch.reset();
+    _toyBatchNEvents.clear();
+    _toyBatchNext = 0;
+    _toyBatchFirstEvent = 0;
+
+    double expectedEvents = 0.;
+    if (fNEvents == 0) {
+      if (!pdf.canBeExtended()) return nullptr;
+      expectedEvents = pdf.expectedEvents(observables);
+      if (expectedEvents <= 0) return nullptr;
+    }
+    Int_t nTotal = 0;
+    for (Int_t i = 0; i < fToyBatchSize; ++i) {
+      Int_t nEvents = fNEvents == 0 ? RooRandom::randomGenerator()->Poisson(expectedEvents) : fNEvents;
+      _toyBatchNEvents.push_back(nEvents);
+      nTotal += nEvents;
+    }
+
+    if (nTotal > 0) {
+      _toyBatch = std::unique_ptr<RooDataSet>{pdf.generate(observables, NumEvents(nTotal),
+                                                              AutoBinned(fGenerateAutoBinned),
+                                                              GenBinned(fGenerateBinnedTag))};
+    } else {
+      _toyBatch = std::make_unique<RooDataSet>(pdf.GetName(), pdf.GetTitle(), observables);
+    }
+    if (!_toyBatch || _toyBatch->isWeighted() || _toyBatch->numEntries() != nTotal) {
+      oocoutI(nullptr, Generation) << "ToyMCSampler: the toys of pdf " << pdf.GetName()
+                                   << " cannot be generated in batches, generating them one by one" << endl;
+      _toyBatchDisabled = true;
+      _toyBatch.reset();
+      _toyBatchNEvents.clear();
+      return nullptr;
+    }
+  }
+
+  const Int_t first = _toyBatchFirstEvent;
+  const Int_t nEvents = _toyBatchNEvents[_toyBatchNext++];
+  _toyBatchFirstEvent += nEvents;
+  return std::unique_ptr<RooAbsData>{_toyBatch->reduce(EventRange(first, first + nEvents))};
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Extended interface to append to sampling distribution more samples
 
@@ -642,6 +713,12 @@ void ToyMCSampler::ClearCache() {
   _gs4 = nullptr;
   _allVars = nullptr;
 
+  _toyBatch = nullptr;
+  _toyBatchNEvents.clear();
+  _toyBatchNext = 0;
+  _toyBatchFirstEvent = 0;
+  _toyBatchDisabled = false;
+
   // no need to delete the _pdfList since it is managed by the RooSimultaneous object
   if (!_pdfList.empty()) {
     _pdfList.clear();
@@ -0,0 +1,76 @@
+// Tests for the RooStats::HypoTestInverter
+
+#include "RooRealVar.h"
+#include "RooDataSet.h"
+#include "RooWorkspace.h"
+#include "RooHelpers.h"
+#include "RooStats/AsymptoticCalculator.h"
+#include "RooStats/HypoTestInverter.h"
+#include "RooStats/HypoTestInverterResult.h"
+#include "RooStats/ModelConfig.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace RooStats;
+
+namespace {
+
+std::unique_ptr<HypoTestInverterResult> runFixedScan(RooWorkspace &w, RooAbsData &data, unsigned int nWorkers)
+{
+   auto sbModel = static_cast<ModelConfig *>(w.obj("sbModel"));
+   auto bModel = static_cast<ModelConfig *>(w.obj("bModel"));
+   AsymptoticCalculator calc(data, *bModel, *sbModel);
+   calc.SetOneSided(true);
+
+   HypoTestInverter inverter(calc);
+   inverter.SetConfidenceLevel(0.95);
+   inverter.UseCLs(true);
+   inverter.SetFixedScan(6, 0., 5.);
+   inverter.SetNWorkers(nWorkers);
+   return std::unique_ptr<HypoTestInverterResult>(inverter.GetInterval());
+}
+
+} // namespace
+
+#ifndef _MSC_VER
+// A fixed scan evaluated in parallel processes must give the same results as the sequential scan.
+TEST(HypoTestInverter, ParallelFixedScan)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace w("w");
+   w.factory("Poisson::pdf(n[0,50], sum::nexp(prod::sig(mu[1,0,10], s[3]), b[2]))");
+   RooRealVar &n = *w.var("n");
+   RooRealVar &mu = *w.var("mu");
+
+   ModelConfig sbModel("sbModel", &w);
+   sbModel.SetPdf("pdf");
+   sbModel.SetObservables("n");
+   sbModel.SetParametersOfInterest("mu");
+   sbModel.SetSnapshot(mu);
+   mu.setVal(0.);
+   ModelConfig bModel(sbModel);
+   bModel.SetName("bModel");
+   bModel.SetSnapshot(mu);
+   w.import(sbModel);
+   w.import(bModel);
+
+   RooDataSet data("data", "data", n);
+   n.setVal(5);
+   data.add(n);
+
+   auto sequential = runFixedScan(w, data, 1);
+   auto parallel = runFixedScan(w, data, 3);
+   ASSERT_NE(sequential, nullptr);
+   ASSERT_NE(parallel, nullptr);
+   ASSERT_EQ(sequential->ArraySize(), 6);
+   ASSERT_EQ(parallel->ArraySize(), sequential->ArraySize());
+   for (int i = 0; i < sequential->ArraySize(); ++i) {
+      EXPECT_DOUBLE_EQ(parallel->GetXValue(i), sequential->GetXValue(i));
+      EXPECT_NEAR(parallel->CLs(i), sequential->CLs(i), 1.E-10);
+   }
+   EXPECT_NEAR(parallel->UpperLimit(), sequential->UpperLimit(), 1.E-10);
+}
+#endif
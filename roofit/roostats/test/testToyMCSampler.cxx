@@ -0,0 +1,63 @@
+// Tests for the RooStats::ToyMCSampler
+
+#include "RooRealVar.h"
+#include "RooGaussian.h"
+#include "RooExtendPdf.h"
+#include "RooRandom.h"
+#include "RooHelpers.h"
+#include "RooStats/ToyMCSampler.h"
+#include "RooStats/NumEventsTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <numeric>
+
+// The toys generated in batches must have the same distribution of the number of events as the toys generated one
+// by one: Poisson for an extended pdf, fixed with SetNEventsPerToy.
+TEST(ToyMCSampler, ToyBatches)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+   RooRandom::randomGenerator()->SetSeed(1234);
+
+   RooRealVar x("x", "x", -10, 10);
+   RooRealVar mu("mu", "mu", 0, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 2, 0.1, 10);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+   RooRealVar nExpected("nExpected", "nExpected", 100, 0, 1000);
+   RooExtendPdf pdf("pdf", "pdf", gauss, nExpected);
+
+   RooStats::NumEventsTestStat testStat(pdf);
+   const int nToys = 2000;
+   RooStats::ToyMCSampler sampler(testStat, nToys);
+   RooArgSet observables{x};
+   RooArgSet poi{mu};
+   sampler.SetPdf(pdf);
+   sampler.SetObservables(observables);
+   sampler.SetParametersForTestStat(poi);
+   sampler.SetToyBatchSize(128);
+
+   RooArgSet paramPoint{mu, sigma, nExpected};
+   std::unique_ptr<RooStats::SamplingDistribution> dist{sampler.GetSamplingDistribution(paramPoint)};
+   ASSERT_NE(dist, nullptr);
+   const std::vector<double> &values = dist->GetSamplingDistribution();
+   ASSERT_EQ(values.size(), static_cast<std::size_t>(nToys));
+   const double mean = std::accumulate(values.begin(), values.end(), 0.) / nToys;
+   double variance = 0.;
+   for (double value : values) {
+      variance += (value - mean) * (value - mean) / (nToys - 1);
+   }
+   // the standard errors are of 0.22 for the mean and of 3.2 for the variance
+   EXPECT_NEAR(mean, 100., 1.);
+   EXPECT_NEAR(variance, 100., 15.);
+
+   sampler.SetNEventsPerToy(50);
+   sampler.SetNToys(300);
+   dist.reset(sampler.GetSamplingDistribution(paramPoint));
+   ASSERT_NE(dist, nullptr);
+   ASSERT_EQ(dist->GetSize(), 300);
+   for (double value : dist->GetSamplingDistribution()) {
+      EXPECT_EQ(value, 50.);
+   }
+}
@@ -0,0 +1,116 @@
+// @(#)root/test:$Id$
+
+//
+// This program benchmarks the byte swapping of arrays of primitive types
+// by TBufferFile::ReadFastArray and TBufferFile::WriteFastArray, against
+// a loop of frombuf/tobuf, one value at a time.
+//
+// Usage: bswapbm -h                   - to print a usage info
+//        bswapbm [nvalues] [ntimes]   - to run the benchmark
+//
+// parameters:
+//       nvalues       - number of values of the arrays
+//       ntimes        - number of times each array is read and written
+//
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Bytes.h"
+#include "TBufferFile.h"
+#include "TStopwatch.h"
+#include "ROOT/RByteSwap.hxx"
+
+Int_t nvalues = 100000; // Number of values of the arrays
+Int_t ntimes = 1000;    // Number of reads and writes of each array
+
+//_____________________________________________________________
+
+template <typename T>
+double Throughput(double seconds)
+{
+   // Return the processed megabytes per second.
+   return seconds > 0 ? 1e-6 * sizeof(T) * nvalues * ntimes / seconds : 0;
+}
+
+template <typename T>
+void Benchmark(const char *name)
+{
+   std::vector<T> values(nvalues), result(nvalues);
+   for (Int_t i = 0; i < nvalues; i++)
+      values[i] = T(i);
+
+   TBufferFile buf(TBuffer::kWrite, nvalues * sizeof(T) + 1024);
+   TStopwatch timer;
+
+   // TBufferFile array streaming
+   timer.Start();
+   for (Int_t t = 0; t < ntimes; t++) {
+      buf.SetBufferOffset(0);
+      buf.WriteFastArray(values.data(), nvalues);
+   }
+   timer.Stop();
+   const double writeFast = timer.RealTime();
+
+   timer.Start();
+   for (Int_t t = 0; t < ntimes; t++) {
+      buf.SetBufferOffset(0);
+      buf.ReadFastArray(result.data(), nvalues);
+   }
+   timer.Stop();
+   const double readFast = timer.RealTime();
+   if (result != values)
+      Printf("%-8s: FAILED, the values read differ from the values written", name);
+
+   // one value at a time
+   timer.Start();
+   for (Int_t t = 0; t < ntimes; t++) {
+      char *cur = buf.Buffer();
+      for (Int_t i = 0; i < nvalues; i++)
+         tobuf(cur, values[i]);
+   }
+   timer.Stop();
+   const double writeLoop = timer.RealTime();
+
+   timer.Start();
+   for (Int_t t = 0; t < ntimes; t++) {
+      char *cur = buf.Buffer();
+      for (Int_t i = 0; i < nvalues; i++)
+         frombuf(cur, &result[i]);
+   }
+   timer.Stop();
+   const double readLoop = timer.RealTime();
+
+   Printf("%-8s: read %8.0f MB/s (loop %8.0f MB/s), write %8.0f MB/s (loop %8.0f MB/s)", name,
+          Throughput<T>(readFast), Throughput<T>(readLoop), Throughput<T>(writeFast), Throughput<T>(writeLoop));
+}
+
+//_____________________________________________________________
+
+int main(int argc, char **argv)
+{
+   if (argc == 2 && !strcmp(argv[1], "-h")) {
+      Printf("Usage: bswapbm [nvalues] [ntimes]");
+      Printf("  nvalues   - number of values of the arrays");
+      Printf("  ntimes    - number of times each array is read and written");
+      return 1;
+   }
+   if (argc > 1)
+      nvalues = atoi(argv[1]);
+   if (argc > 2)
+      ntimes = atoi(argv[2]);
+   if (nvalues < 1 || ntimes < 1) {
+      Printf("Both nvalues and ntimes must be positive");
+      return 1;
+   }
+
+   Printf("Byte swapping implementation: %s", ROOT::Internal::GetByteSwapImplementation());
+   Printf("Arrays of %d values, read and written %d times", nvalues, ntimes);
+   Benchmark<Short_t>("Short_t");
+   Benchmark<Int_t>("Int_t");
+   Benchmark<Float_t>("Float_t");
+   Benchmark<Long64_t>("Long64_t");
+   Benchmark<Double_t>("Double_t");
+   return 0;
+}
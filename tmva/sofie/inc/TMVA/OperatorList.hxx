@@ -33,4 +33,7 @@
 #include "TMVA/ROperator_Comparision.hxx"
 #include "TMVA/ROperator_EyeLike.hxx"
 #include "TMVA/ROperator_Range.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/ROperator_DequantizeLinear.hxx"
+#include "TMVA/ROperator_QLinearMatMul.hxx"
 
@@ -34,6 +34,11 @@ private:
    std::vector<std::shared_ptr<RModel>> fSubGraphs;    ///<!  sub-graph models (transient)
    RModel * fParentGraph = nullptr;
 
+   bool fFuseOperators = true; ///<! fuse the elementwise activations into the operators producing their input
+   bool fPlanMemory = true;    ///<! share the memory of the intermediate tensors with disjoint lifetimes
+   std::unordered_map<std::string, size_t> fIntermediateMemoryOffsets; ///<! offsets of the tensors in the memory pools
+   std::map<ETensorType, size_t> fIntermediateMemoryPoolSizes;         ///<! sizes of the memory pools of each type
+
    const std::string SP = "   ";
 
 public:
@@ -140,13 +145,22 @@ public:
 
 protected:
    // internal functions
+   // fuse the elementwise activations into the operators producing their input
+   void FuseOperators();
+   // assign the intermediate tensors to offsets in memory pools, given the generated code of the operators
+   // (in execution order) and of the session constructor and data members
+   void PlanIntermediateMemory(const std::vector<std::string> &operatorsCode, const std::string &sessionCode);
    // generate code for the initialized tensors
    void GenerateInitializedTensorInfo();
    // generate code for the intermediate tensors
    void GenerateIntermediateTensorInfo();
    // generate code for the dynamic tensors
    void GenerateDynamicTensorInfo();
-   void GenerateOutput();
+   void GenerateOutput(const std::vector<std::string> &operatorsCode);
+   // generate the code of the Session constructor copying the tensors to the GPU
+   void GenerateGPUInitCode();
+   // generate the infer function of the GPU code, copying the inputs and outputs between host and device
+   void GenerateGPUOutput(const std::vector<std::string> &operatorsCode);
    // Generate all session code
    void GenerateSessionCode();
 
@@ -8,6 +8,7 @@
 #include <memory>
 #include <ctime>
 #include <set>
+#include <map>
 #include <iomanip>
 #include <fstream>
 #include <sstream>
@@ -26,6 +27,9 @@ enum class Options {
    kRootBinaryWeightFile = 0x4,
    kGNN = 0x8,
    kGNNComponent = 0x10,
+   kNoOperatorFusion = 0x20, ///< do not fuse the elementwise activations into the operators producing their input
+   kNoMemoryPlanning = 0x40, ///< allocate a separate buffer for each intermediate tensor
+   kGPU = 0x80,              ///< generate CUDA code running the inference on the GPU, to be compiled with nvcc
 };
 
 enum class WeightFileType { None, RootBinary, Text };
@@ -53,6 +57,7 @@ protected:
    bool fUseSession = true;
    bool fIsGNN = false;
    bool fIsGNNComponent = false;
+   bool fUseGPU = false;
 
 public:
    /**
@@ -31,6 +31,26 @@ public:
    virtual std::string GenerateSessionMembersCode(std::string /*opName*/) { return ""; }
    virtual std::string Header() { return "";}
 
+   // interface for the fusion of elementwise activations Y = f(X) into the operator producing X (see
+   // RModel::FuseOperators)
+   // return the activation type, its input and its output names if the operator is a fusable activation
+   virtual EActivationType GetFusableActivation(std::string & /*nameX*/, std::string & /*nameY*/) const {
+      return EActivationType::UNDEFINED;
+   }
+   // return the name of the output on which an activation can be applied in place, or an empty string
+   virtual std::string GetFusableOutput() const { return ""; }
+   // apply the activation in place on the output of the operator, which is renamed to nameY
+   virtual void FuseActivation(EActivationType /*activation*/, const std::string & /*nameY*/) {}
+
+   // interface for the GPU code generation (Options::kGPU), where all the tensors are in device memory
+   // and the operators run on the CUDA stream fStream of the Session
+   // generate the CUDA kernels used by the operator, which are defined before the Session
+   virtual std::string GenerateGPUKernels(std::string /*opName*/) { return ""; }
+   // generate the inference code of the operator running on the GPU
+   virtual std::string GenerateGPU(std::string /*opName*/) {
+      throw std::runtime_error("TMVA SOFIE: GPU code generation is not supported by this operator");
+   }
+
 
    //virtual void Forward_reference() = 0;
    //virtual void Forward_blas() = 0;
@@ -41,6 +61,57 @@ protected:
    const std::string SP = "   ";    ///< space used to correctly indent the generated C++ code
    bool fUseSession = false;        ///< flag to identify if using the session class
    bool fIsOutputConstant = false;  ///< flag to identify if operator has a constant output (no need to generate code)
+   EActivationType fFusedActivation = EActivationType::UNDEFINED; ///< activation fused into the operator
+
+   // generate the loop applying the fused activation in place on the first length elements of tensor
+   std::string GenerateFusedActivation(const std::string & tensor, const std::string & length) const {
+      if (fFusedActivation == EActivationType::UNDEFINED) return "";
+      std::stringstream out;
+      out << SP << "//--- fused activation\n";
+      out << SP << "for (size_t id = 0; id < " << length << " ; id++){\n";
+      out << SP << SP << tensor << "[id] = " << GenerateActivationCode(fFusedActivation, tensor + "[id]") << ";\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+   // generate an elementwise CUDA kernel computing out[id] = expression, where the expression uses
+   // the output out and the nInputs inputs in0, in1, ... of the kernel
+   std::string GenerateGPUElementwiseKernel(const std::string & kernelName, size_t nInputs,
+                                            const std::string & expression) const {
+      std::stringstream out;
+      out << "__global__ void " << kernelName << "(float * out, ";
+      for (size_t i = 0; i < nInputs; i++)
+         out << "const float * __restrict__ in" << i << ", ";
+      out << "size_t n) {\n";
+      out << SP << "size_t id = blockIdx.x * static_cast<size_t>(blockDim.x) + threadIdx.x;\n";
+      out << SP << "if (id < n) out[id] = " << expression << ";\n";
+      out << "}\n";
+      return out.str();
+   }
+
+   // generate the launch of an elementwise kernel on the first length elements of the output and input tensors
+   std::string GenerateGPUElementwiseLaunch(const std::string & kernelName, const std::string & output,
+                                            const std::vector<std::string> & inputs, const std::string & length) const {
+      std::stringstream out;
+      out << SP << kernelName << "<<<(" << length << " + 255) / 256, 256, 0, fStream>>>(" << output;
+      for (auto & input : inputs)
+         out << ", " << input;
+      out << ", " << length << ");\n";
+      out << SP << "GPU::Check(cudaGetLastError(), \"" << kernelName << "\");\n";
+      return out.str();
+   }
+
+   // generate the kernel and the launch applying the fused activation in place on the GPU
+   std::string GenerateGPUFusedActivationKernel(const std::string & opName) const {
+      if (fFusedActivation == EActivationType::UNDEFINED) return "";
+      return GenerateGPUElementwiseKernel("kernel_op_" + opName + "_activation", 0,
+                                          GenerateActivationCode(fFusedActivation, "out[id]"));
+   }
+   std::string GenerateGPUFusedActivation(const std::string & opName, const std::string & tensor,
+                                          const std::string & length) const {
+      if (fFusedActivation == EActivationType::UNDEFINED) return "";
+      return GenerateGPUElementwiseLaunch("kernel_op_" + opName + "_activation", tensor, {}, length);
+   }
 };
 
 
@@ -220,11 +220,51 @@ public:
       const std::string& nameA = fNBroadcastedA.empty()? fNA : fNBroadcastedA;
       const std::string& nameB = fNBroadcastedB.empty()? fNB : fNBroadcastedB;
       out << SP << "for (size_t id = 0; id < " << length << " ; id++){\n";
-      out << SP << SP << "tensor_" << fNY << "[id] = "  << BinaryOperatorTrait<T,Op>::Op( "tensor_" + nameA + "[id]" , "tensor_" + nameB + "[id]") <<  " ;\n";
+      std::string value = BinaryOperatorTrait<T,Op>::Op( "tensor_" + nameA + "[id]" , "tensor_" + nameB + "[id]");
+      if (fFusedActivation != EActivationType::UNDEFINED)
+         value = GenerateActivationCode(fFusedActivation, "(" + value + ")");
+      out << SP << SP << "tensor_" << fNY << "[id] = "  << value <<  " ;\n";
       out << SP << "}\n";
       return out.str();
    }
 
+   std::string GenerateGPUKernels(std::string OpName) override {
+      if (fIsOutputConstant) return "";
+      std::string value = BinaryOperatorTrait<T,Op>::Op("in0[id]", "in1[id]");
+      if (fFusedActivation != EActivationType::UNDEFINED)
+         value = GenerateActivationCode(fFusedActivation, "(" + value + ")");
+      return GenerateGPUElementwiseKernel("kernel_op_" + OpName, 2, value);
+   }
+
+   std::string GenerateGPU(std::string OpName) override {
+      if (fIsOutputConstant) return "";
+      if (fShapeY.empty()) {
+         throw std::runtime_error("TMVA SOFIE Binary Op called to Generate without being initialized first");
+      }
+      // the broadcasting of the input tensors computed during the inference is not supported on the GPU
+      if (fShapeA != fShapeY || fShapeB != fShapeY || TensorType<T>::Name() != std::string("float")) {
+         throw std::runtime_error("TMVA SOFIE Binary Op supports GPU code generation only for float tensors "
+                                  "of the same shape or initialized tensors");
+      }
+      const std::string& nameA = fNBroadcastedA.empty()? fNA : fNBroadcastedA;
+      const std::string& nameB = fNBroadcastedB.empty()? fNB : fNBroadcastedB;
+      std::stringstream out;
+      out << SP << "\n//------ " << BinaryOperatorTrait<T,Op>::Name() << " (GPU)\n";
+      out << GenerateGPUElementwiseLaunch("kernel_op_" + OpName, "tensor_" + fNY,
+                                          {"tensor_" + nameA, "tensor_" + nameB},
+                                          std::to_string(ConvertShapeToLength(fShapeY)));
+      return out.str();
+   }
+
+   std::string GetFusableOutput() const override {
+      return (fIsOutputConstant || fFusedActivation != EActivationType::UNDEFINED) ? "" : fNY;
+   }
+
+   void FuseActivation(EActivationType activation, const std::string & nameY) override {
+      fFusedActivation = activation;
+      fNY = nameY;
+   }
+
    std::vector<std::string> GetStdLibs() override {
       if (Op == EBasicBinaryOperator::Pow) {
          return { std::string("cmath") };
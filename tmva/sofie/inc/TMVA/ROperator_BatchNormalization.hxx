@@ -205,6 +205,15 @@ public:
       out << SP << "BLAS::saxpy_(&" << OpName << "_N, &" << OpName << "_alpha, " << "tensor_" << fNMean << ", &" << OpName << "_incx,"
          << "tensor_" << fNY <<", &" << OpName << "_incy);\n\n ";
 
+      if (fFusedActivation != EActivationType::UNDEFINED) {
+         //// Y = activation(Y * scale*var + Bbias) in a single loop
+         out << SP << "for (size_t i = 0; i < " << n << "; i++) {\n";
+         std::string value = "(tensor_" + fNY + "[i] * tensor_" + fNScale + "[i] + tensor_" + fNB + "[i])";
+         out << SP << SP << "tensor_" << fNY << "[i] = " << GenerateActivationCode(fFusedActivation, value) << ";\n";
+         out << SP << "}\n";
+         return out.str();
+      }
+
       //// Y *= scale*var
       out << SP << "for (size_t i = 0; i < " << n << "; i++) {\n";
       // scale tensor contains already the var
@@ -219,6 +228,15 @@ public:
       return out.str();
    }
 
+   std::string GetFusableOutput() const {
+      return (fFusedActivation == EActivationType::UNDEFINED) ? fNY : "";
+   }
+
+   void FuseActivation(EActivationType activation, const std::string & nameY) {
+      fFusedActivation = activation;
+      fNY = nameY;
+   }
+
    std::vector<std::string> GetBlasRoutines() { return { std::string("Copy"), std::string("Axpy") }; }
 };
 
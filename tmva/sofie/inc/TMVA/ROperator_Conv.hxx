@@ -531,11 +531,23 @@ public:
              << OpName << "_incx, tensor_" << fNY << " + out_offset, &" << OpName << "_incy);\n";
 
       }
+      // apply the fused activation while the output of the batch is still in cache
+      out << GenerateFusedActivation("(tensor_" + fNY + " + out_offset)",
+                                     std::to_string(fShapeY[1] * oDepth * oHeight * oWidth));
       out << SP << "}\n"; // end of batch size loop
 
       return out.str();
       }
 
+   std::string GetFusableOutput() const {
+      return (fFusedActivation == EActivationType::UNDEFINED) ? fNY : "";
+   }
+
+   void FuseActivation(EActivationType activation, const std::string & nameY) {
+      fFusedActivation = activation;
+      fNY = nameY;
+   }
+
    /*! \brief Returns the blas routines needed to compile the generated code
     */
    std::vector<std::string> GetBlasRoutines() { return { std::string("Gemm"), std::string("Axpy") }; }
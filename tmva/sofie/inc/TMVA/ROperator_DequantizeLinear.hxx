@@ -0,0 +1,111 @@
+#ifndef TMVA_SOFIE_ROPERATOR_DEQUANTIZELINEAR
+#define TMVA_SOFIE_ROPERATOR_DEQUANTIZELINEAR
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+// ONNX DequantizeLinear: y = (x - zero_point) * scale, with x of type int8, uint8 or int32 and y float.
+// Only per-tensor quantization is supported: the scale and the zero point must be initialized scalars.
+class ROperator_DequantizeLinear final : public ROperator
+{
+
+private:
+
+   std::string fNX;
+   std::string fNScale;
+   std::string fNZeroPoint;
+   std::string fNY;
+   ETensorType fTypeX = ETensorType::UNDEFINED;
+   std::vector<size_t> fShape;
+   float fScale = 1;
+   int fZeroPoint = 0;
+
+public:
+   ROperator_DequantizeLinear(){}
+   ROperator_DequantizeLinear(std::string nameX, std::string nameScale, std::string nameZeroPoint, std::string nameY):
+      fNX(UTILITY::Clean_name(nameX)), fNScale(UTILITY::Clean_name(nameScale)),
+      fNZeroPoint(UTILITY::Clean_name(nameZeroPoint)), fNY(UTILITY::Clean_name(nameY)) {}
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> /*input*/){
+      return { ETensorType::FLOAT };
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      auto ret = std::vector<std::vector<size_t>>(1, input[0]);
+      return ret;
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNX) == false){
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op Input Tensor " + fNX + " is not found in model");
+      }
+      fTypeX = model.GetTensorType(fNX);
+      if (fTypeX != ETensorType::INT8 && fTypeX != ETensorType::UNINT8 && fTypeX != ETensorType::INT32) {
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op supports only int8, uint8 and int32 inputs");
+      }
+      fShape = model.GetTensorShape(fNX);
+      // per-tensor scale and zero point, which are written in the generated code
+      if (!model.IsInitializedTensor(fNScale) || ConvertShapeToLength(model.GetTensorShape(fNScale)) != 1) {
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op supports only a scalar initialized scale");
+      }
+      fScale = UTILITY::GetValueAsDouble(model.GetTensorType(fNScale), model.GetInitializedTensorData(fNScale).get());
+      model.SetNotWritableInitializedTensor(fNScale);
+      if (!fNZeroPoint.empty()) {
+         if (!model.IsInitializedTensor(fNZeroPoint) || ConvertShapeToLength(model.GetTensorShape(fNZeroPoint)) != 1) {
+            throw std::runtime_error("TMVA SOFIE DequantizeLinear Op supports only a scalar initialized zero point");
+         }
+         fZeroPoint = UTILITY::GetValueAsDouble(model.GetTensorType(fNZeroPoint),
+                                                model.GetInitializedTensorData(fNZeroPoint).get());
+         model.SetNotWritableInitializedTensor(fNZeroPoint);
+      }
+
+      // quantized weights (QDQ format) are converted back to float here
+      if (model.IsInitializedTensor(fNX)) {
+         auto x = model.GetInitializedTensorData(fNX);
+         std::vector<float> y(ConvertShapeToLength(fShape));
+         for (size_t i = 0; i < y.size(); i++)
+            y[i] = static_cast<float>(UTILITY::GetValueAsDouble(fTypeX, x.get(), i) - fZeroPoint) * fScale;
+         model.AddConstantTensor<float>(fNY, fShape, y);
+         model.SetNotWritableInitializedTensor(fNX);
+         fIsOutputConstant = true;
+      } else {
+         model.AddIntermediateTensor(fNY, ETensorType::FLOAT, fShape);
+      }
+      if (model.Verbose()) {
+         std::cout << "DequantizeLinear : " << ConvertTypeToString(fTypeX) << " " << fNX << " -> " << fNY
+                   << " scale " << fScale << " zero point " << fZeroPoint;
+         if (fIsOutputConstant) std::cout << " (constant) ";
+         std::cout << std::endl;
+      }
+   }
+
+   std::string Generate(std::string OpName){
+      if (fIsOutputConstant) return "";
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      out << "\n//------ DequantizeLinear\n";
+      out << SP << "for (size_t id = 0; id < " << ConvertShapeToLength(fShape) << " ; id++){\n";
+      out << std::showpoint << std::setprecision(std::numeric_limits<float>::max_digits10);
+      out << SP << SP << "tensor_" << fNY << "[id] = static_cast<float>(static_cast<int32_t>(tensor_" << fNX
+          << "[id]) - " << fZeroPoint << ") * " << fScale << "f;\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_DEQUANTIZELINEAR
@@ -350,9 +350,78 @@ namespace SOFIE{
             out << "}\n"; // end of loop on the stacked multiplications
          }
 
+         out << GenerateFusedActivation("tensor_" + fNY, ConvertDynamicShapeToLength(fShapeY));
+
+         return out.str();
+      }
+
+      std::string GenerateGPUKernels(std::string opName){
+         return GenerateGPUFusedActivationKernel(opName);
+      }
+
+      std::string GenerateGPU(std::string opName){
+         if (fShapeA.empty() || fShapeB.empty() || fShapeY.empty() || (fNC != "" && fShapeC.empty())) {
+            throw std::runtime_error("TMVA SOFIE Gemm Op called to Generate without being initialized first");
+         }
+         if (fType != "float" || fIsDynamic) {
+            throw std::runtime_error(
+               "TMVA SOFIE Gemm Op supports GPU code generation only for float tensors with a fixed shape");
+         }
+         std::string kernelOpName = opName;
+         opName = "op_" + opName;
+         int64_t dimA = fShapeA.size();
+         int64_t dimB = fShapeB.size();
+         int64_t dimY = fShapeY.size();
+         if (dimA != dimB || dimA != dimY) {
+             throw std::runtime_error("TMVA SOFIE Gemm(MatMul) has invalid shape for inputs or output");
+         }
+         auto m = (fAttrTransA ? fShapeA[dimA-1].GetVal() : fShapeA[dimA-2].GetVal());
+         auto n = (fAttrTransB ? fShapeB[dimB-2].GetVal() : fShapeB[dimB-1].GetVal());
+         auto k = (fAttrTransA ? fShapeA[dimA-2].GetVal() : fShapeA[dimA-1].GetVal());
+         auto lengthGemm = ConvertDynamicShapeToLength({fShapeY[dimY-2], fShapeY[dimY-1]});
+         auto lengthExtra = ConvertDynamicShapeToLength(std::vector<Dim>(fShapeY.begin(), fShapeY.end() - 2));
+         if (!fNC.empty() && fNC2 == fNC && std::stoi(lengthGemm) != static_cast<int>(ConvertShapeToLength(fShapeC)))
+            throw std::runtime_error("TMVA SOFIE Gemm Op " + opName + " Bias tensor has not correct size "
+                                     + ConvertShapeToString(fShapeC) + " output length " + lengthGemm);
+         if (fNC.empty() && fAttrBeta != 0)
+            throw std::runtime_error("TMVA SOFIE Gemm Op " + opName +
+                                     " Bias tensor is not present but beta value in Gemm is not zero");
+
+         std::stringstream out;
+         out << "\n//--------- Gemm (GPU)\n";
+         out << SP << "float " << opName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+         out << SP << "float " << opName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
+         // stacked multiplications for MatMul with inputs of dim > 2
+         bool doStackMul = dimY > 2 && std::stoi(lengthExtra) > 1;
+         std::string yoffset = doStackMul ? " + i * " + lengthGemm : "";
+         if (doStackMul)
+            out << SP << "for (int i = 0; i < " << lengthExtra << "; i++){\n";
+         if (!fNC.empty()) {
+            out << SP << "GPU::Check(cudaMemcpyAsync(tensor_" << fNY << yoffset << ", tensor_" << fNC2 << ", "
+                << lengthGemm << " * sizeof(float), cudaMemcpyDeviceToDevice, fStream), \"cudaMemcpyAsync\");\n";
+         }
+         // cuBLAS uses as BLAS the column-major order: compute Y^T = B^T * A^T
+         out << SP << "GPU::Check(cublasSgemm(fCublasHandle, " << (fAttrTransB ? "CUBLAS_OP_T" : "CUBLAS_OP_N") << ", "
+             << (fAttrTransA ? "CUBLAS_OP_T" : "CUBLAS_OP_N") << ", " << n << ", " << m << ", " << k << ", &" << opName
+             << "_alpha, tensor_" << fNB << ", " << (fAttrTransB ? k : n) << ", tensor_" << fNA << ", "
+             << (fAttrTransA ? m : k) << ", &" << opName << "_beta, tensor_" << fNY << yoffset << ", " << n
+             << "), \"cublasSgemm\");\n";
+         if (doStackMul)
+            out << SP << "}\n";
+
+         out << GenerateGPUFusedActivation(kernelOpName, "tensor_" + fNY, ConvertDynamicShapeToLength(fShapeY));
          return out.str();
       }
 
+      std::string GetFusableOutput() const {
+         return (fFusedActivation == EActivationType::UNDEFINED) ? fNY : "";
+      }
+
+      void FuseActivation(EActivationType activation, const std::string & nameY) {
+         fFusedActivation = activation;
+         fNY = nameY;
+      }
+
       std::vector<std::string> GetBlasRoutines() { return { std::string("Gemm"), std::string("Gemv") }; }
 
    };
@@ -0,0 +1,214 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
+#define TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <cmath>
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+// ONNX QLinearMatMul: matrix product of the quantized tensors A [..., M, K] and B [K, N], with int8 or uint8
+// inputs and output. B must be an initialized tensor (the weights), with a per-tensor or per-column quantization;
+// A and Y have a per-tensor quantization. The products are accumulated in int32: the inner loop on K is a plain
+// dot product of the two 8-bit rows (using the transposed B), which the compiler can vectorize with the integer
+// dot product instructions of the target (e.g. AVX512-VNNI), and the zero points are applied afterwards.
+class ROperator_QLinearMatMul final : public ROperator
+{
+
+private:
+
+   std::string fNA;
+   std::string fNAScale;
+   std::string fNAZeroPoint;
+   std::string fNB;
+   std::string fNBScale;
+   std::string fNBZeroPoint;
+   std::string fNYScale;
+   std::string fNYZeroPoint;
+   std::string fNY;
+   std::string fNBT;          ///< transposed B
+   std::string fNOffset;      ///< constant term of the zero point correction for each column
+   std::string fNBZeroPoints; ///< zero point of B for each column
+   std::string fNMultiplier;  ///< A scale * B scale / Y scale for each column
+   ETensorType fTypeA = ETensorType::UNDEFINED;
+   ETensorType fTypeB = ETensorType::UNDEFINED;
+   ETensorType fTypeY = ETensorType::UNDEFINED;
+   std::vector<size_t> fShapeA;
+   std::vector<size_t> fShapeY;
+   size_t fM = 0;
+   size_t fN = 0;
+   size_t fK = 0;
+   int fAZeroPoint = 0;
+   int fYZeroPoint = 0;
+
+   // value of a scalar initialized tensor
+   static double GetScalar(RModel & model, const std::string & name) {
+      if (!model.IsInitializedTensor(name) || ConvertShapeToLength(model.GetTensorShape(name)) != 1) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op supports only a scalar initialized tensor for " + name);
+      }
+      model.SetNotWritableInitializedTensor(name);
+      return UTILITY::GetValueAsDouble(model.GetTensorType(name), model.GetInitializedTensorData(name).get());
+   }
+
+   // values for each column of B of a per-tensor or per-column initialized tensor
+   std::vector<double> GetColumnValues(RModel & model, const std::string & name) const {
+      if (!model.IsInitializedTensor(name)) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op supports only initialized tensor for " + name);
+      }
+      size_t length = ConvertShapeToLength(model.GetTensorShape(name));
+      if (length != 1 && length != fN) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op: " + name + " has not a per-tensor or per-column shape");
+      }
+      auto data = model.GetInitializedTensorData(name);
+      std::vector<double> values(fN);
+      for (size_t j = 0; j < fN; j++)
+         values[j] = UTILITY::GetValueAsDouble(model.GetTensorType(name), data.get(), length == 1 ? 0 : j);
+      model.SetNotWritableInitializedTensor(name);
+      return values;
+   }
+
+public:
+   ROperator_QLinearMatMul(){}
+   ROperator_QLinearMatMul(std::string nameA, std::string nameAScale, std::string nameAZeroPoint, std::string nameB,
+                           std::string nameBScale, std::string nameBZeroPoint, std::string nameYScale,
+                           std::string nameYZeroPoint, std::string nameY):
+      fNA(UTILITY::Clean_name(nameA)), fNAScale(UTILITY::Clean_name(nameAScale)),
+      fNAZeroPoint(UTILITY::Clean_name(nameAZeroPoint)), fNB(UTILITY::Clean_name(nameB)),
+      fNBScale(UTILITY::Clean_name(nameBScale)), fNBZeroPoint(UTILITY::Clean_name(nameBZeroPoint)),
+      fNYScale(UTILITY::Clean_name(nameYScale)), fNYZeroPoint(UTILITY::Clean_name(nameYZeroPoint)),
+      fNY(UTILITY::Clean_name(nameY)) {}
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
+      return { input[7] };
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      auto shapeY = input[0];
+      shapeY.back() = input[1].back();
+      return { shapeY };
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNA) == false){
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op Input Tensor " + fNA + " is not found in model");
+      }
+      if (!model.IsInitializedTensor(fNB)) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op supports only an initialized tensor B");
+      }
+      fTypeA = model.GetTensorType(fNA);
+      fTypeB = model.GetTensorType(fNB);
+      fTypeY = model.GetTensorType(fNYZeroPoint);
+      for (auto type : {fTypeA, fTypeB, fTypeY}) {
+         if (type != ETensorType::INT8 && type != ETensorType::UNINT8)
+            throw std::runtime_error("TMVA SOFIE QLinearMatMul Op supports only int8 and uint8 tensors");
+      }
+      fShapeA = model.GetTensorShape(fNA);
+      auto shapeB = model.GetTensorShape(fNB);
+      if (fShapeA.size() < 2 || shapeB.size() != 2 || fShapeA.back() != shapeB[0]) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op has invalid shapes " + ConvertShapeToString(fShapeA) +
+                                  " and " + ConvertShapeToString(shapeB));
+      }
+      fK = shapeB[0];
+      fN = shapeB[1];
+      fM = ConvertShapeToLength(fShapeA) / fK;
+      fShapeY = ShapeInference({fShapeA, shapeB})[0];
+
+      double scaleA = GetScalar(model, fNAScale);
+      fAZeroPoint = static_cast<int>(GetScalar(model, fNAZeroPoint));
+      double scaleY = GetScalar(model, fNYScale);
+      fYZeroPoint = static_cast<int>(GetScalar(model, fNYZeroPoint));
+      auto scaleB = GetColumnValues(model, fNBScale);
+      auto zeroPointB = GetColumnValues(model, fNBZeroPoint);
+
+      // transpose B to have contiguous columns, and precompute the per-column terms of
+      // sum_k (a_k - za) (b_kj - zb_j) = sum_k a_k b_kj - zb_j sum_k a_k + K za zb_j - za sum_k b_kj
+      auto dataB = model.GetInitializedTensorData(fNB);
+      std::vector<int8_t> bTInt8(fTypeB == ETensorType::INT8 ? fN * fK : 0);
+      std::vector<uint8_t> bTUInt8(fTypeB == ETensorType::UNINT8 ? fN * fK : 0);
+      std::vector<int32_t> offset(fN);
+      std::vector<int32_t> zb(fN);
+      std::vector<float> multiplier(fN);
+      for (size_t j = 0; j < fN; j++) {
+         int32_t sumB = 0;
+         for (size_t k = 0; k < fK; k++) {
+            auto b = static_cast<int32_t>(UTILITY::GetValueAsDouble(fTypeB, dataB.get(), k * fN + j));
+            sumB += b;
+            if (fTypeB == ETensorType::INT8)
+               bTInt8[j * fK + k] = b;
+            else
+               bTUInt8[j * fK + k] = b;
+         }
+         zb[j] = static_cast<int32_t>(zeroPointB[j]);
+         offset[j] = static_cast<int32_t>(fK) * fAZeroPoint * zb[j] - fAZeroPoint * sumB;
+         multiplier[j] = scaleA * scaleB[j] / scaleY;
+      }
+      fNBT = fNY + "_BT";
+      fNOffset = fNY + "_offset";
+      fNBZeroPoints = fNY + "_bzeropoint";
+      fNMultiplier = fNY + "_multiplier";
+      if (fTypeB == ETensorType::INT8)
+         model.AddConstantTensor<int8_t>(fNBT, {fN, fK}, bTInt8);
+      else
+         model.AddConstantTensor<uint8_t>(fNBT, {fN, fK}, bTUInt8);
+      model.AddConstantTensor<int32_t>(fNOffset, {fN}, offset);
+      model.AddConstantTensor<int32_t>(fNBZeroPoints, {fN}, zb);
+      model.AddConstantTensor<float>(fNMultiplier, {fN}, multiplier);
+      model.SetNotWritableInitializedTensor(fNB);
+
+      model.AddIntermediateTensor(fNY, fTypeY, fShapeY);
+      if (model.Verbose()) {
+         std::cout << "QLinearMatMul : " << fNA << " " << ConvertShapeToString(fShapeA) << " x " << fNB << " "
+                   << ConvertShapeToString(shapeB) << " -> " << fNY << " " << ConvertShapeToString(fShapeY)
+                   << std::endl;
+      }
+   }
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShapeY.empty()) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op called to Generate without being initialized first");
+      }
+      std::string typeA = ConvertTypeToString(fTypeA);
+      std::string typeB = ConvertTypeToString(fTypeB);
+      bool isSigned = fTypeY == ETensorType::INT8;
+      std::stringstream out;
+      out << "\n//------ QLinearMatMul\n";
+      out << SP << "for (size_t i = 0; i < " << fM << "; i++) {\n";
+      out << SP << SP << "const " << typeA << " * " << OpName << "_a = tensor_" << fNA << " + i * " << fK << ";\n";
+      out << SP << SP << "int32_t " << OpName << "_sumA = 0;\n";
+      out << SP << SP << "for (size_t k = 0; k < " << fK << "; k++)\n";
+      out << SP << SP << SP << OpName << "_sumA += " << OpName << "_a[k];\n";
+      out << SP << SP << "for (size_t j = 0; j < " << fN << "; j++) {\n";
+      out << SP << SP << SP << "const " << typeB << " * " << OpName << "_b = tensor_" << fNBT << " + j * " << fK
+          << ";\n";
+      out << SP << SP << SP << "int32_t " << OpName << "_acc = 0;\n";
+      out << SP << SP << SP << "for (size_t k = 0; k < " << fK << "; k++)\n";
+      out << SP << SP << SP << SP << OpName << "_acc += static_cast<int32_t>(" << OpName
+          << "_a[k]) * static_cast<int32_t>(" << OpName << "_b[k]);\n";
+      out << SP << SP << SP << OpName << "_acc += tensor_" << fNOffset << "[j] - tensor_" << fNBZeroPoints << "[j] * "
+          << OpName << "_sumA;\n";
+      // requantize, rounding to nearest even and saturating in float
+      out << SP << SP << SP << "float " << OpName << "_y = std::nearbyint(" << OpName << "_acc * tensor_"
+          << fNMultiplier << "[j]) + " << fYZeroPoint << ";\n";
+      out << SP << SP << SP << "tensor_" << fNY << "[i * " << fN << " + j] = static_cast<"
+          << ConvertTypeToString(fTypeY) << ">(std::min(std::max(" << OpName << "_y, "
+          << (isSigned ? "-128.f" : "0.f") << "), " << (isSigned ? "127.f" : "255.f") << "));\n";
+      out << SP << SP << "}\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+   std::vector<std::string> GetStdLibs() { return { std::string("cmath"), std::string("algorithm") }; }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
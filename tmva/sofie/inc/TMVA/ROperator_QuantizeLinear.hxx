@@ -0,0 +1,132 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
+#define TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <cmath>
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+// ONNX QuantizeLinear: y = saturate(round(x / scale) + zero_point), with y of type int8 or uint8.
+// Only per-tensor quantization is supported: the scale and the zero point must be initialized scalars.
+class ROperator_QuantizeLinear final : public ROperator
+{
+
+private:
+
+   std::string fNX;
+   std::string fNScale;
+   std::string fNZeroPoint;
+   std::string fNY;
+   ETensorType fTypeY = ETensorType::UNINT8;
+   std::vector<size_t> fShape;
+   float fScale = 1;
+   int fZeroPoint = 0;
+
+   template <typename T>
+   void AddConstantOutput(RModel & model, const float * x, size_t length) {
+      std::vector<T> y(length);
+      float minValue = std::numeric_limits<T>::min();
+      float maxValue = std::numeric_limits<T>::max();
+      for (size_t i = 0; i < length; i++)
+         y[i] = static_cast<T>(std::min(std::max(std::nearbyint(x[i] / fScale) + fZeroPoint, minValue), maxValue));
+      model.AddConstantTensor<T>(fNY, fShape, y);
+   }
+
+public:
+   ROperator_QuantizeLinear(){}
+   ROperator_QuantizeLinear(std::string nameX, std::string nameScale, std::string nameZeroPoint, std::string nameY,
+                            ETensorType typeY):
+      fNX(UTILITY::Clean_name(nameX)), fNScale(UTILITY::Clean_name(nameScale)),
+      fNZeroPoint(UTILITY::Clean_name(nameZeroPoint)), fNY(UTILITY::Clean_name(nameY)), fTypeY(typeY) {}
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> /*input*/){
+      return { fTypeY };
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      auto ret = std::vector<std::vector<size_t>>(1, input[0]);
+      return ret;
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNX) == false){
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op Input Tensor " + fNX + " is not found in model");
+      }
+      if (fTypeY != ETensorType::INT8 && fTypeY != ETensorType::UNINT8) {
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op supports only int8 and uint8 outputs");
+      }
+      if (model.GetTensorType(fNX) != ETensorType::FLOAT) {
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op supports only float inputs");
+      }
+      fShape = model.GetTensorShape(fNX);
+      // per-tensor scale and zero point, which are written in the generated code
+      if (!model.IsInitializedTensor(fNScale) || ConvertShapeToLength(model.GetTensorShape(fNScale)) != 1) {
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op supports only a scalar initialized scale");
+      }
+      fScale = UTILITY::GetValueAsDouble(model.GetTensorType(fNScale), model.GetInitializedTensorData(fNScale).get());
+      model.SetNotWritableInitializedTensor(fNScale);
+      if (!fNZeroPoint.empty()) {
+         if (!model.IsInitializedTensor(fNZeroPoint) || ConvertShapeToLength(model.GetTensorShape(fNZeroPoint)) != 1) {
+            throw std::runtime_error("TMVA SOFIE QuantizeLinear Op supports only a scalar initialized zero point");
+         }
+         fZeroPoint = UTILITY::GetValueAsDouble(model.GetTensorType(fNZeroPoint),
+                                                model.GetInitializedTensorData(fNZeroPoint).get());
+         model.SetNotWritableInitializedTensor(fNZeroPoint);
+      }
+
+      // quantized weights are computed here
+      if (model.IsInitializedTensor(fNX)) {
+         auto x = static_cast<float *>(model.GetInitializedTensorData(fNX).get());
+         if (fTypeY == ETensorType::INT8)
+            AddConstantOutput<int8_t>(model, x, ConvertShapeToLength(fShape));
+         else
+            AddConstantOutput<uint8_t>(model, x, ConvertShapeToLength(fShape));
+         model.SetNotWritableInitializedTensor(fNX);
+         fIsOutputConstant = true;
+      } else {
+         model.AddIntermediateTensor(fNY, fTypeY, fShape);
+      }
+      if (model.Verbose()) {
+         std::cout << "QuantizeLinear : " << fNX << " -> " << fNY << " " << ConvertTypeToString(fTypeY)
+                   << " scale " << fScale << " zero point " << fZeroPoint;
+         if (fIsOutputConstant) std::cout << " (constant) ";
+         std::cout << std::endl;
+      }
+   }
+
+   std::string Generate(std::string OpName){
+      if (fIsOutputConstant) return "";
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op called to Generate without being initialized first");
+      }
+      std::string type = ConvertTypeToString(fTypeY);
+      bool isSigned = fTypeY == ETensorType::INT8;
+      std::stringstream out;
+      out << "\n//------ QuantizeLinear\n";
+      out << SP << "for (size_t id = 0; id < " << ConvertShapeToLength(fShape) << " ; id++){\n";
+      // round to nearest even and saturate, in float to avoid overflows in the conversion
+      out << std::showpoint << std::setprecision(std::numeric_limits<float>::max_digits10);
+      out << SP << SP << "float " << OpName << "_y = std::nearbyint(tensor_" << fNX << "[id] / " << fScale << "f) + "
+          << fZeroPoint << ";\n";
+      out << SP << SP << "tensor_" << fNY << "[id] = static_cast<" << type << ">(std::min(std::max(" << OpName
+          << "_y, " << (isSigned ? "-128.f" : "0.f") << "), " << (isSigned ? "127.f" : "255.f") << "));\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+   std::vector<std::string> GetStdLibs() { return { std::string("cmath"), std::string("algorithm") }; }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
@@ -49,6 +49,25 @@ public:
    }
 
 
+   EActivationType GetFusableActivation(std::string & nameX, std::string & nameY) const {
+      nameX = fNX;
+      nameY = fNY;
+      return EActivationType::RELU;
+   }
+
+   std::string GenerateGPUKernels(std::string OpName){
+      std::string value = GenerateActivationCode(EActivationType::RELU, "in0[id]");
+      return GenerateGPUElementwiseKernel("kernel_op_" + OpName, 1, value);
+   }
+
+   std::string GenerateGPU(std::string OpName){
+      auto length = ConvertDynamicShapeToLength(fShape);
+      std::stringstream out;
+      out << "\n//------ RELU (GPU)\n";
+      out << GenerateGPUElementwiseLaunch("kernel_op_" + OpName, "tensor_" + fNY, {"tensor_" + fNX}, length);
+      return out.str();
+   }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
       if (fShape.empty()) {
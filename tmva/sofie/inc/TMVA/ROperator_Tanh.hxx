@@ -46,6 +46,25 @@ public:
    }
 
 
+   EActivationType GetFusableActivation(std::string & nameX, std::string & nameY) const {
+      nameX = fNX;
+      nameY = fNY;
+      return EActivationType::TANH;
+   }
+
+   std::string GenerateGPUKernels(std::string OpName){
+      std::string value = GenerateActivationCode(EActivationType::TANH, "in0[id]");
+      return GenerateGPUElementwiseKernel("kernel_op_" + OpName, 1, value);
+   }
+
+   std::string GenerateGPU(std::string OpName){
+      auto length = std::to_string(ConvertShapeToLength(fShape));
+      std::stringstream out;
+      out << "\n//------ TANH (GPU)\n";
+      out << GenerateGPUElementwiseLaunch("kernel_op_" + OpName, "tensor_" + fNY, {"tensor_" + fNX}, length);
+      return out.str();
+   }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
       if (fShape.empty()) {
@@ -2,15 +2,126 @@
 #define TMVA_SOFIE_SOFIE_HELPERS
 
 
+#include "RConfigure.h"
+
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 
 namespace TMVA{
 namespace Experimental{
 
+/// SofieSessionPool : thread-safe evaluation of a model generated by SOFIE.
+/// The infer function of a generated Session uses the intermediate tensors and work buffers
+/// stored as data members of the Session, so that a Session cannot be used concurrently by several threads.
+/// The pool keeps a set of Sessions used as per-thread workspaces: each Infer call takes a free Session
+/// from the pool (creating a new one if all are in use) and gives it back once the inference is done.
+/// The number of Sessions is therefore bounded by the number of threads calling Infer at the same time.
+/// Note that each Session contains also its own copy of the model weights.
+///
+/// InferBatches evaluates in parallel, using the ROOT implicit multi-threading pool if enabled,
+/// consecutive batches of the input of a model with a single input and output tensor.
+template <typename Session_t>
+class SofieSessionPool {
+   std::string fFileName;                         ///< weight file passed to the Session constructor
+   std::vector<std::unique_ptr<Session_t>> fFree; ///< Sessions not in use
+   std::mutex fMutex;                             ///< protects fFree
+
+   /// gives back a Session to the pool when going out of scope
+   class SessionGuard {
+      SofieSessionPool &fPool;
+      std::unique_ptr<Session_t> fSession;
+
+   public:
+      SessionGuard(SofieSessionPool &pool) : fPool(pool), fSession(pool.Acquire()) {}
+      ~SessionGuard() { fPool.Release(std::move(fSession)); }
+      Session_t &operator*() { return *fSession; }
+   };
+
+   std::unique_ptr<Session_t> CreateSession() const
+   {
+      if (fFileName.empty())
+         return std::make_unique<Session_t>();
+      return std::make_unique<Session_t>(fFileName);
+   }
+
+public:
+   /// Create the pool with nSessions Sessions created upfront, to avoid creating them during the evaluation
+   SofieSessionPool(unsigned int nSessions = 1, const std::string &filename = "") : fFileName(filename)
+   {
+      fFree.reserve(nSessions);
+      for (unsigned int i = 0; i < nSessions; i++)
+         fFree.emplace_back(CreateSession());
+   }
+
+   /// Take a free Session, or create a new one if all are in use
+   std::unique_ptr<Session_t> Acquire()
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         if (!fFree.empty()) {
+            auto session = std::move(fFree.back());
+            fFree.pop_back();
+            return session;
+         }
+      }
+      return CreateSession();
+   }
+
+   /// Give back to the pool a Session obtained with Acquire
+   void Release(std::unique_ptr<Session_t> session)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fFree.emplace_back(std::move(session));
+   }
+
+   /// Call the infer function of a free Session with the given arguments. Can be called concurrently.
+   template <typename... Args>
+   auto Infer(Args &&...args) -> decltype(std::declval<Session_t &>().infer(std::forward<Args>(args)...))
+   {
+      SessionGuard session(*this);
+      return (*session).infer(std::forward<Args>(args)...);
+   }
+
+   /// Evaluate nBatches consecutive inputs of batchLength values each (i.e. the input size of the
+   /// batch size used to generate the model), starting at input, and return the concatenated outputs.
+   /// The batches are evaluated in parallel if implicit multi-threading is enabled.
+   template <typename T>
+   auto InferBatches(const T *input, std::size_t nBatches, std::size_t batchLength)
+      -> decltype(std::declval<Session_t &>().infer(const_cast<T *>(input)))
+   {
+      decltype(Infer(const_cast<T *>(input))) output;
+      std::vector<decltype(output)> outputs(nBatches);
+      auto inferBatch = [&](std::size_t i) { outputs[i] = Infer(const_cast<T *>(input) + i * batchLength); };
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && nBatches > 1) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(inferBatch, ROOT::TSeqUL(nBatches));
+      } else
+#endif
+      {
+         for (std::size_t i = 0; i < nBatches; i++)
+            inferBatch(i);
+      }
+      std::size_t size = 0;
+      for (auto &out : outputs)
+         size += out.size();
+      output.reserve(size);
+      for (auto &out : outputs)
+         output.insert(output.end(), out.begin(), out.end());
+      return output;
+   }
+};
+
 ///Helper class used by SOFIEFunctor to wrap the
 ///infer signature interface to RDataFrame
 template <typename I, typename F, typename T>
@@ -22,41 +133,41 @@ class SofieFunctorHelper<std::index_sequence<N...>, Session_t, T> {
    template <std::size_t Idx>
    using AlwaysT = T;
 
-   std::vector<std::vector<T>> fInput;
-   std::vector<Session_t> fSessions;
+   std::vector<std::unique_ptr<Session_t>> fSlotSessions; ///< one Session per slot, used without locking
+   // the pool is not movable because of its mutex
+   std::unique_ptr<SofieSessionPool<Session_t>> fSessions; ///< Sessions for slots beyond fSlotSessions
 
 public:
 
    SofieFunctorHelper(unsigned int nslots = 0, const std::string & filename = "") :
-      fInput(1)
+      fSessions(std::make_unique<SofieSessionPool<Session_t>>(nslots < 1 ? 1 : 0, filename))
    {
-      // create Sessions according to given number of slots.
-      // if number of slots is zero create a single session
-      if (nslots < 1) nslots = 1;
-      fInput.resize(nslots);
-      fSessions.reserve(nslots);
-      for (unsigned int i = 0; i < nslots; i++) {
-         if (filename.empty())
-            fSessions.emplace_back();
-         else
-            fSessions.emplace_back(filename);
-      }
+      // create one Session per slot, each slot is used by a single thread at a time.
+      // if number of slots is zero create a single session in the pool: more Sessions are created if needed
+      fSlotSessions.reserve(nslots);
+      for (unsigned int i = 0; i < nslots; i++)
+         fSlotSessions.emplace_back(filename.empty() ? std::make_unique<Session_t>()
+                                                     : std::make_unique<Session_t>(filename));
    }
 
    double operator()(unsigned slot, AlwaysT<N>... args) {
-      fInput[slot] = {args...};
-      auto y =  fSessions[slot].infer(fInput[slot].data());
+      T input[] = {args...};
+      if (slot < fSlotSessions.size()) {
+         auto y = fSlotSessions[slot]->infer(input);
+         return y[0];
+      }
+      auto y = fSessions->Infer(input);
       return y[0];
    }
 };
 
 /// SofieFunctor : used to wrap the infer function of the
 /// generated model by SOFIE in a RDF compatible signature.
-/// The number of slots is an optional parameter used to
-/// create multiple SOFIE Sessions, which can be run in a parallel
-/// model evaluation. One should use as number of slots the number of slots used by
-/// RDataFrame. By default, in case of `nslots=0`, only a single Session will be created
-/// and the Functor cannot be run in parallel.
+/// The number of slots is an optional parameter giving the number of SOFIE Sessions created upfront,
+/// one per slot, so that the Functor can be run in a parallel model evaluation without locking:
+/// one should use as number of slots the number of slots used by RDataFrame.
+/// Slots beyond that number, or all slots in case of `nslots=0`, take their Sessions from a
+/// SofieSessionPool, which creates the Sessions needed for a parallel evaluation during the event loop.
 /// Examples of using the SofieFunctor are the C++ tutorial TMVA_SOFIE_RDataFrame.C
 /// and the Python tutorial TMVA_SOFIE_RDataFrame.py which makes use of the ROOT JIT
 /// to compile on the fly the generated SOFIE model.
@@ -27,9 +27,16 @@ enum class ETensorType{
     FLOAT16 = 10, DOUBLE = 11, UINT32 = 12, UINT64 = 13, COMPLEX64 = 14, COMPLEX28 = 15, BFLOAT16 = 16
 };
 
+// elementwise activations which can be fused into the operator producing their input (see RModel::FuseOperators)
+enum class EActivationType{
+   UNDEFINED = 0, RELU = 1, SIGMOID = 2, TANH = 3
+};
+
 typedef std::int64_t int_t;
 
 std::string ConvertTypeToString(ETensorType type);
+// generate the expression of the activation of the given value
+std::string GenerateActivationCode(EActivationType activation, const std::string & value);
 ETensorType ConvertStringToType(std::string type);
 
 struct Dim{
@@ -194,6 +201,9 @@ ETensorType GetTemplatedType(T /*obj*/ ){
 }
 
 namespace UTILITY{
+// Get the value of element i of tensor data of the given numeric type, e.g. a quantization scale or zero point
+double GetValueAsDouble(ETensorType type, const void * data, size_t i = 0);
+
 // Check if two shapes are equal
 bool AreSameShape(const std::vector<size_t>&, const std::vector<size_t>&);
 bool AreSameShape(const std::vector<size_t>&, const std::vector<Dim>&);
@@ -13,6 +13,44 @@ namespace TMVA {
 namespace Experimental {
 namespace SOFIE {
 
+namespace {
+
+// ways a tensor is used in the generated code
+enum ETensorUse {
+   kPointerUse = 0x1,   // through the tensor_<name> pointer
+   kVectorUse = 0x2,    // through the fTensor_<name> vector
+   kPointerAssign = 0x4 // the tensor_<name> pointer is assigned, e.g. to alias another tensor
+};
+
+// find the names of the tensors used in a piece of generated code, with their ETensorUse flags
+std::unordered_map<std::string, int> FindUsedTensors(const std::string &code)
+{
+   std::unordered_map<std::string, int> used;
+   auto isIdentifierChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+   for (const std::string prefix : {"tensor_", "fTensor_"}) {
+      const int use = (prefix == "tensor_") ? kPointerUse : kVectorUse;
+      for (auto pos = code.find(prefix); pos != std::string::npos; pos = code.find(prefix, pos + 1)) {
+         if (pos > 0 && isIdentifierChar(code[pos - 1]))
+            continue;
+         const auto begin = pos + prefix.size();
+         auto end = begin;
+         while (end < code.size() && isIdentifierChar(code[end]))
+            end++;
+         if (end == begin)
+            continue;
+         int flags = use;
+         const auto next = code.find_first_not_of(" \t", end);
+         if (use == kPointerUse && next != std::string::npos && code[next] == '=' &&
+             (next + 1 == code.size() || code[next + 1] != '='))
+            flags |= kPointerAssign;
+         used[code.substr(begin, end - begin)] |= flags;
+      }
+   }
+   return used;
+}
+
+} // namespace
+
 std::underlying_type_t<Options> operator|(Options opA, Options opB) {
     return static_cast<std::underlying_type_t<Options>>(opA) | static_cast<std::underlying_type_t<Options>>(opB);
 }
@@ -415,13 +453,16 @@ void RModel::GenerateInitializedTensorInfo() {
             //std::cout << "write tensor " << i.first << std::endl;
             std::stringstream strs;
             if (i.second.type() == ETensorType::FLOAT) {
-               strs << "float tensor_" << i.first << "[" << length << "] = {";
+               // for the GPU the tensor pointer is moved to the device memory in the Session constructor
+               strs << "float " << (fUseGPU ? "fTensor_" : "tensor_") << i.first << "[" << length << "] = {";
                float const *data = i.second.data<float>();
                for (size_t idx = 0; idx < length; idx++) {
                   strs << std::setprecision(std::numeric_limits<float>::max_digits10) << data[idx];
                   if (idx < length-1) strs << ", ";
                }
                strs << "};\n";
+               if (fUseGPU)
+                  strs << "float * tensor_" << i.first << " = fTensor_" << i.first << ";\n";
             }
             else if (i.second.type() == ETensorType::INT64) {
                strs << "int64_t tensor_" << i.first << "[" << length << "] = {";
@@ -432,6 +473,16 @@ void RModel::GenerateInitializedTensorInfo() {
                }
                strs << "};\n";
             }
+            else if (i.second.type() == ETensorType::INT32 || i.second.type() == ETensorType::INT8 ||
+                     i.second.type() == ETensorType::UNINT8) {
+               // e.g. quantized weights: write the values as integers and not as characters
+               strs << ConvertTypeToString(i.second.type()) << " tensor_" << i.first << "[" << length << "] = {";
+               for (size_t idx = 0; idx < length; idx++) {
+                  strs << static_cast<int64_t>(UTILITY::GetValueAsDouble(i.second.type(), i.second.data<void>(), idx));
+                  if (idx < length-1) strs << ", ";
+               }
+               strs << "};\n";
+            }
             fGC += strs.str();
          }
          // case of tensors which are read from a file
@@ -445,9 +496,24 @@ void RModel::GenerateInitializedTensorInfo() {
 }
 
 void RModel::GenerateIntermediateTensorInfo() {
+   if (!fIntermediateMemoryPoolSizes.empty()) {
+      fGC += "\n//--- memory pools of the intermediate tensors, shared by the tensors with disjoint lifetimes\n";
+      for (auto &pool : fIntermediateMemoryPoolSizes) {
+         std::string type = ConvertTypeToString(pool.first);
+         fGC += "std::vector<" + type + "> fIntermediateMemoryPool_" + type + " = std::vector<" + type + ">(" +
+                std::to_string(pool.second) + ");\n";
+      }
+   }
    if (!fIntermediateTensorInfos.empty()) {
       fGC += "\n//--- declare and allocate the intermediate tensors\n";
       for (auto &i : fIntermediateTensorInfos) {
+         auto offset = fIntermediateMemoryOffsets.find(i.first);
+         if (offset != fIntermediateMemoryOffsets.end()) {
+            std::string type = ConvertTypeToString(i.second.type);
+            fGC += type + " * tensor_" + i.first + " = fIntermediateMemoryPool_" + type + ".data() + " +
+                   std::to_string(offset->second) + ";\n";
+            continue;
+         }
          size_t length = ConvertShapeToLength(i.second.shape);
          if (i.second.type == ETensorType::FLOAT) {
             fGC += "std::vector<float> fTensor_" + i.first + " = std::vector<float>(" + std::to_string(length) + ");\n";
@@ -461,6 +527,13 @@ void RModel::GenerateIntermediateTensorInfo() {
             fGC += "std::vector<int64_t> fTensor_" + i.first + " = std::vector<int64_t>(" + std::to_string(length) + ");\n";
             fGC += "int64_t * tensor_" + i.first + " = fTensor_" + i.first + ".data();\n";
          }
+         if (i.second.type == ETensorType::INT32 || i.second.type == ETensorType::INT8 ||
+             i.second.type == ETensorType::UNINT8) {
+            std::string type = ConvertTypeToString(i.second.type);
+            fGC += "std::vector<" + type + "> fTensor_" + i.first + " = std::vector<" + type + ">(" +
+                   std::to_string(length) + ");\n";
+            fGC += type + " * tensor_" + i.first + " = fTensor_" + i.first + ".data();\n";
+         }
          if (i.second.type == ETensorType::BOOL) {
             fGC += "std::vector<bool> fTensor_" + i.first + " = std::vector<bool>(" + std::to_string(length) + ");\n";
             // don't allocate pointer since boolean vector don't have the .data() member
@@ -533,7 +606,7 @@ std::string RModel::GenerateInferSignature(bool isdecl) {
    return rGC;
 }
 
-void RModel::GenerateOutput() {
+void RModel::GenerateOutput(const std::vector<std::string> &operatorsCode) {
 
    if (fVerbose)
       std::cout << "Generating main inference code for " << fName << std::endl;
@@ -565,8 +638,7 @@ void RModel::GenerateOutput() {
    fGC += "){\n";
 
    for (size_t id = 0; id < fOperators.size(); id++) {
-      if (fVerbose) std::cout << "Generating code for operator .... " << id << std::endl;
-      fGC += (fOperators[id]->Generate(std::to_string(id)));
+      fGC += operatorsCode[id];
    }
 
    if (outputSize == 1) {
@@ -618,8 +690,257 @@ void RModel::GenerateOutput() {
    fGC += "}\n";  // end of infer function scope
 }
 
+void RModel::GenerateGPUInitCode()
+{
+   fGC += "\n//--- create the CUDA stream and the cuBLAS handle, and copy the tensors to the device\n";
+   fGC += SP + "GPU::Check(cudaStreamCreate(&fStream), \"cudaStreamCreate\");\n";
+   fGC += SP + "GPU::Check(cublasCreate(&fCublasHandle), \"cublasCreate\");\n";
+   fGC += SP + "GPU::Check(cublasSetStream(fCublasHandle, fStream), \"cublasSetStream\");\n";
+   // only float tensors are used by the operators supporting the GPU code generation
+   for (auto &i : fInitializedTensors) {
+      if (i.second.type() != ETensorType::FLOAT)
+         continue;
+      std::string length = std::to_string(ConvertShapeToLength(i.second.shape()));
+      fGC += SP + "tensor_" + i.first + " = GPU::ToDevice(tensor_" + i.first + ", " + length + ", fDeviceBuffers);\n";
+      // release the host memory of the weights read from a file
+      if (fUseWeightFile && !i.second.IsConstantTensor())
+         fGC += SP + "std::vector<float>().swap(fTensor_" + i.first + ");\n";
+   }
+   // the intermediate tensors are copied as well, since they can be filled by the initialization code
+   for (auto &i : fIntermediateTensorInfos) {
+      if (i.second.type != ETensorType::FLOAT)
+         continue;
+      std::string length = std::to_string(ConvertShapeToLength(i.second.shape));
+      fGC += SP + "tensor_" + i.first + " = GPU::ToDevice(tensor_" + i.first + ", " + length + ", fDeviceBuffers);\n";
+      fGC += SP + "std::vector<float>().swap(fTensor_" + i.first + ");\n";
+   }
+   for (auto &name : fInputTensorNames) {
+      std::string length = std::to_string(ConvertShapeToLength(GetTensorShape(name)));
+      fGC += SP + "tensor_" + name + " = GPU::ToDevice(nullptr, " + length + ", fDeviceBuffers);\n";
+   }
+}
+
+void RModel::GenerateGPUOutput(const std::vector<std::string> &operatorsCode)
+{
+   if (fVerbose)
+      std::cout << "Generating main GPU inference code for " << fName << std::endl;
+
+   size_t outputSize = fOutputTensorNames.size();
+   if (outputSize == 0)
+      throw std::runtime_error("TMVA-SOFIE: output size=0 are not supported");
+   for (auto &name : fOutputTensorNames) {
+      if (!name.empty() && GetTensorType(name) != ETensorType::FLOAT)
+         throw std::runtime_error("TMVA-SOFIE: the GPU code generation supports only float output tensors");
+   }
+
+   // the inputs and the outputs are in host memory
+   fGC += (outputSize == 1) ? "std::vector<float> infer(" : "std::vector<std::vector<float>> infer(";
+   for (size_t i = 0; i < fInputTensorNames.size(); i++) {
+      if (GetTensorType(fInputTensorNames[i]) != ETensorType::FLOAT)
+         throw std::runtime_error("TMVA-SOFIE: the GPU code generation supports only float input tensors");
+      fGC += std::string(i > 0 ? ", " : "") + "const float * input_" + fInputTensorNames[i];
+   }
+   fGC += "){\n";
+
+   fGC += "\n//--- copy the inputs to the device\n";
+   for (auto &name : fInputTensorNames) {
+      std::string length = std::to_string(ConvertShapeToLength(GetTensorShape(name)));
+      fGC += SP + "GPU::Check(cudaMemcpyAsync(tensor_" + name + ", input_" + name + ", " + length +
+             " * sizeof(float), cudaMemcpyHostToDevice, fStream), \"cudaMemcpyAsync\");\n";
+   }
+
+   for (size_t id = 0; id < fOperators.size(); id++) {
+      fGC += operatorsCode[id];
+   }
+
+   fGC += "\n//--- copy the outputs from the device\n";
+   fGC += SP + "std::vector<std::vector<float>> ret(" + std::to_string(outputSize) + ");\n";
+   for (size_t i = 0; i < outputSize; i++) {
+      std::string &name = fOutputTensorNames[i];
+      if (name.empty())
+         continue;
+      std::string length = std::to_string(ConvertShapeToLength(GetTensorShape(name)));
+      std::string output = "ret[" + std::to_string(i) + "]";
+      fGC += SP + output + ".resize(" + length + ");\n";
+      fGC += SP + "GPU::Check(cudaMemcpyAsync(" + output + ".data(), tensor_" + name + ", " + length +
+             " * sizeof(float), cudaMemcpyDeviceToHost, fStream), \"cudaMemcpyAsync\");\n";
+   }
+   fGC += SP + "GPU::Check(cudaStreamSynchronize(fStream), \"cudaStreamSynchronize\");\n";
+   fGC += SP + ((outputSize == 1) ? "return std::move(ret[0]);\n" : "return ret;\n");
+   fGC += "}\n"; // end of infer function scope
+}
+
+void RModel::FuseOperators()
+{
+   if (!fFuseOperators)
+      return;
+
+   // find the operators using each tensor from their generated code
+   std::unordered_map<std::string, std::vector<size_t>> tensorUsers;
+   for (size_t id = 0; id < fOperators.size(); id++) {
+      std::string opName = std::to_string(id);
+      std::string code = fOperators[id]->Generate(opName);
+      if (fUseSession)
+         code += fOperators[id]->GenerateSessionMembersCode(opName) + fOperators[id]->GenerateInitCode();
+      for (auto &used : FindUsedTensors(code))
+         tensorUsers[used.first].push_back(id);
+   }
+   for (auto &name : fOutputTensorNames)
+      tensorUsers[name].push_back(fOperators.size()); // the outputs are also used by the caller
+
+   std::vector<bool> isFused(fOperators.size(), false);
+   for (size_t id = 0; id < fOperators.size(); id++) {
+      std::string nameX, nameY;
+      EActivationType activation = fOperators[id]->GetFusableActivation(nameX, nameY);
+      if (activation == EActivationType::UNDEFINED)
+         continue;
+      // X must be a float intermediate tensor used only by the operator producing it and by the activation
+      bool isIntermediate = fIntermediateTensorInfos.count(nameX) > 0 || fDynamicTensorInfos.count(nameX) > 0;
+      auto &users = tensorUsers[nameX];
+      if (!isIntermediate || GetTensorType(nameX) != ETensorType::FLOAT || users.size() != 2 || users[1] != id)
+         continue;
+      auto &producer = fOperators[users[0]];
+      if (isFused[users[0]] || producer->GetFusableOutput() != nameX)
+         continue;
+      if (fVerbose)
+         std::cout << "Fusing activation of operator " << id << " into operator " << users[0] << ": " << nameX
+                   << " -> " << nameY << std::endl;
+      // the producer writes now directly the output of the activation
+      producer->FuseActivation(activation, nameY);
+      isFused[id] = true;
+      fIntermediateTensorInfos.erase(nameX);
+      fDynamicTensorInfos.erase(nameX);
+      for (auto &user : tensorUsers[nameY]) {
+         if (user == id)
+            user = users[0];
+      }
+   }
+
+   size_t nOperators = 0;
+   for (size_t id = 0; id < fOperators.size(); id++) {
+      if (!isFused[id])
+         fOperators[nOperators++] = std::move(fOperators[id]);
+   }
+   fOperators.resize(nOperators);
+}
+
+void RModel::PlanIntermediateMemory(const std::vector<std::string> &operatorsCode, const std::string &sessionCode)
+{
+   fIntermediateMemoryOffsets.clear();
+   fIntermediateMemoryPoolSizes.clear();
+   if (!fPlanMemory)
+      return;
+
+   // lifetime of each tensor: first and last operator using it
+   std::unordered_map<std::string, std::pair<size_t, size_t>> lifetimes;
+   // tensors which need their own buffer
+   std::unordered_set<std::string> excluded(fOutputTensorNames.begin(), fOutputTensorNames.end());
+   for (size_t id = 0; id < operatorsCode.size(); id++) {
+      auto used = FindUsedTensors(operatorsCode[id]);
+      // an operator aliasing tensor pointers (e.g. Identity) extends the lifetimes of its tensors
+      bool isAliasing = false;
+      for (auto &u : used)
+         isAliasing |= (u.second & kPointerAssign) != 0;
+      for (auto &u : used) {
+         // the vector of the tensor is accessed directly (e.g. resized)
+         if (isAliasing || (u.second & kVectorUse))
+            excluded.insert(u.first);
+         auto lifetime = lifetimes.find(u.first);
+         if (lifetime == lifetimes.end())
+            lifetimes[u.first] = {id, id};
+         else
+            lifetime->second.second = id;
+      }
+   }
+   // the tensors used in the session constructor or data members are used outside of the infer function
+   for (auto &u : FindUsedTensors(sessionCode))
+      excluded.insert(u.first);
+
+   struct PlannedTensor {
+      std::string name;
+      size_t length;
+      std::pair<size_t, size_t> lifetime;
+      size_t offset;
+   };
+   std::map<ETensorType, std::vector<PlannedTensor>> tensorsByType;
+   for (auto &i : fIntermediateTensorInfos) {
+      auto type = i.second.type;
+      if (type != ETensorType::FLOAT && type != ETensorType::DOUBLE && type != ETensorType::INT64)
+         continue;
+      auto lifetime = lifetimes.find(i.first);
+      if (lifetime == lifetimes.end() || excluded.count(i.first) > 0)
+         continue;
+      // keep the tensors aligned to 64 bytes, as the start of the pool
+      constexpr size_t alignment = 16;
+      size_t length = (ConvertShapeToLength(i.second.shape) + alignment - 1) / alignment * alignment;
+      tensorsByType[type].push_back({i.first, length, lifetime->second, 0});
+   }
+
+   for (auto &typeTensors : tensorsByType) {
+      auto &tensors = typeTensors.second;
+      // greedy assignment from the largest to the smallest tensor, at the lowest offset where the tensor does not
+      // overlap in memory with any tensor already placed and alive at the same time
+      std::sort(tensors.begin(), tensors.end(), [](const PlannedTensor &a, const PlannedTensor &b) {
+         return a.length != b.length ? a.length > b.length : a.name < b.name;
+      });
+      size_t poolSize = 0;
+      for (size_t i = 0; i < tensors.size(); i++) {
+         std::vector<std::pair<size_t, size_t>> conflicts; // memory ranges of the tensors alive at the same time
+         for (size_t j = 0; j < i; j++) {
+            if (tensors[j].lifetime.first <= tensors[i].lifetime.second &&
+                tensors[i].lifetime.first <= tensors[j].lifetime.second)
+               conflicts.emplace_back(tensors[j].offset, tensors[j].offset + tensors[j].length);
+         }
+         std::sort(conflicts.begin(), conflicts.end());
+         size_t offset = 0;
+         for (auto &range : conflicts) {
+            if (offset + tensors[i].length <= range.first)
+               break;
+            offset = std::max(offset, range.second);
+         }
+         tensors[i].offset = offset;
+         fIntermediateMemoryOffsets[tensors[i].name] = offset;
+         poolSize = std::max(poolSize, offset + tensors[i].length);
+      }
+      fIntermediateMemoryPoolSizes[typeTensors.first] = poolSize;
+      if (fVerbose) {
+         size_t totalLength = 0;
+         for (auto &t : tensors)
+            totalLength += t.length;
+         std::cout << "Memory planning of the " << tensors.size() << " " << ConvertTypeToString(typeTensors.first)
+                   << " intermediate tensors: pool size " << poolSize << " instead of " << totalLength << std::endl;
+      }
+   }
+}
+
 void RModel::GenerateSessionCode()
 {
+   // generate first the code of the operators, in the same order as it is added: the memory planning of the
+   // intermediate tensors needs to know which operators use each tensor
+   std::vector<std::string> membersCode(fOperators.size());
+   std::vector<std::string> initCode(fOperators.size());
+   std::vector<std::string> operatorsCode(fOperators.size());
+   if (fUseSession) {
+      for (size_t id = 0; id < fOperators.size(); id++)
+         membersCode[id] = fOperators[id]->GenerateSessionMembersCode(std::to_string(id));
+      for (size_t id = 0; id < fOperators.size(); id++)
+         initCode[id] = fOperators[id]->GenerateInitCode();
+   }
+   for (size_t id = 0; id < fOperators.size(); id++) {
+      if (fVerbose) std::cout << "Generating code for operator .... " << id << std::endl;
+      operatorsCode[id] = fUseGPU ? fOperators[id]->GenerateGPU(std::to_string(id))
+                                  : fOperators[id]->Generate(std::to_string(id));
+   }
+   std::string sessionCode;
+   for (size_t id = 0; id < fOperators.size(); id++)
+      sessionCode += membersCode[id] + initCode[id];
+   PlanIntermediateMemory(operatorsCode, sessionCode);
+
+   if (fUseGPU) {
+      fGC += "\n//--- CUDA kernels of the operators\n";
+      for (size_t id = 0; id < fOperators.size(); id++)
+         fGC += fOperators[id]->GenerateGPUKernels(std::to_string(id));
+   }
 
    // define the Session struct (for GNN this is generated in RModel_GNN)
    if (fUseSession && !fIsGNNComponent) {
@@ -645,10 +966,18 @@ void RModel::GenerateSessionCode()
       // add here specific operator code that needs to define session data members
       fGC += "\n";
       for (size_t id = 0; id < fOperators.size(); id++) {
-         std::string opName = std::to_string(id);
-         fGC += fOperators[id]->GenerateSessionMembersCode(opName);
+         fGC += membersCode[id];
       }
       fGC += "\n";
+      if (fUseGPU) {
+         fGC += "//--- CUDA stream and cuBLAS handle used for the inference, and device buffers of the tensors\n";
+         fGC += "cudaStream_t fStream = nullptr;\n";
+         fGC += "cublasHandle_t fCublasHandle = nullptr;\n";
+         fGC += "std::vector<void *> fDeviceBuffers;\n";
+         for (auto &name : fInputTensorNames)
+            fGC += "float * tensor_" + name + " = nullptr;\n";
+         fGC += "\n";
+      }
       // here add initialization and reading of weight tensors
       if (fUseWeightFile) {
          std::string fileName = fName;
@@ -686,13 +1015,33 @@ void RModel::GenerateSessionCode()
 
       // add here initialization code  for operator
       for (size_t id = 0; id < fOperators.size(); id++) {
-         fGC += fOperators[id]->GenerateInitCode();
+         fGC += initCode[id];
       }
 
+      if (fUseGPU)
+         GenerateGPUInitCode();
+
       fGC += "}\n\n";
+
+      if (fUseGPU) {
+         // the Session owns the device memory
+         fGC += "~" + sessionName + "() {\n";
+         fGC += SP + "for (auto buffer : fDeviceBuffers)\n";
+         fGC += SP + SP + "cudaFree(buffer);\n";
+         fGC += SP + "if (fCublasHandle)\n";
+         fGC += SP + SP + "cublasDestroy(fCublasHandle);\n";
+         fGC += SP + "if (fStream)\n";
+         fGC += SP + SP + "cudaStreamDestroy(fStream);\n";
+         fGC += "}\n";
+         fGC += sessionName + "(const " + sessionName + " &) = delete;\n";
+         fGC += sessionName + " &operator=(const " + sessionName + " &) = delete;\n\n";
+      }
    }
 
-   GenerateOutput();
+   if (fUseGPU)
+      GenerateGPUOutput(operatorsCode);
+   else
+      GenerateOutput(operatorsCode);
 
    // end of session
    if (fUseSession && !fIsGNNComponent) {
@@ -728,10 +1077,36 @@ void RModel::Generate(std::underlying_type_t<Options> options, int batchSize, lo
       fIsGNN = true;
    if (static_cast<std::underlying_type_t<Options>>(Options::kGNNComponent) & options)
       fIsGNNComponent = true;
+   if (static_cast<std::underlying_type_t<Options>>(Options::kGPU) & options) {
+      if (!fUseSession || fIsGNN || fIsGNNComponent) {
+         throw std::runtime_error(
+            "TMVA-SOFIE: RModel::Generate: the GPU code generation requires a Session class and does not support GNN");
+      }
+      fUseGPU = true;
+   }
 
    // initialize the model including all operators and sub-graphs
    Initialize(batchSize, verbose);
 
+   if (static_cast<std::underlying_type_t<Options>>(Options::kNoOperatorFusion) & options)
+      fFuseOperators = false;
+   if (static_cast<std::underlying_type_t<Options>>(Options::kNoMemoryPlanning) & options)
+      fPlanMemory = false;
+   if (fUseGPU) {
+      if (!fSubGraphs.empty() || !fInputTensorInfos.empty() || !fDynamicTensorInfos.empty()) {
+         throw std::runtime_error(
+            "TMVA-SOFIE: RModel::Generate: the GPU code generation does not support sub-graphs and dynamic shapes");
+      }
+      // each tensor has its own device buffer
+      fPlanMemory = false;
+   }
+   for (auto &graph : fSubGraphs) {
+      graph->fFuseOperators = fFuseOperators;
+      graph->fPlanMemory = fPlanMemory;
+      graph->FuseOperators();
+   }
+   FuseOperators();
+
    std::string hgname;
    if (!fIsGNNComponent && !fIsSubGraph) {
       fGC.clear();
@@ -36,9 +36,37 @@ void RModel_Base::GenerateHeaderInfo(std::string& hgname) {
     // Include TFile when saving the weights in a binary ROOT file
     if (fWeightFile == WeightFileType::RootBinary)
         fGC += "#include \"TFile.h\"\n";
+    if (fUseGPU) {
+        fGC += "#include <stdexcept>\n";
+        fGC += "#include <cuda_runtime.h>\n";
+        fGC += "#include <cublas_v2.h>\n";
+    }
 
     fGC += "\nnamespace TMVA_SOFIE_" + fName + "{\n";
-    if (!fNeededBlasRoutines.empty()) {
+    if (fUseGPU) {
+        // the GPU code uses cuBLAS instead of BLAS
+        fGC += ("namespace GPU{\n"
+                "inline void Check(cudaError_t status, const char * what) {\n"
+                "   if (status != cudaSuccess)\n"
+                "      throw std::runtime_error(std::string(\"TMVA-SOFIE: \") + what + \" failed: \" +\n"
+                "                               cudaGetErrorString(status));\n"
+                "}\n"
+                "inline void Check(cublasStatus_t status, const char * what) {\n"
+                "   if (status != CUBLAS_STATUS_SUCCESS)\n"
+                "      throw std::runtime_error(std::string(\"TMVA-SOFIE: \") + what + \" failed with status \" +\n"
+                "                               std::to_string(static_cast<int>(status)));\n"
+                "}\n"
+                "// allocate a device buffer of n values, added to buffers, and copy there data if not null\n"
+                "inline float * ToDevice(const float * data, size_t n, std::vector<void *> & buffers) {\n"
+                "   void * buffer = nullptr;\n"
+                "   Check(cudaMalloc(&buffer, n * sizeof(float)), \"cudaMalloc\");\n"
+                "   buffers.push_back(buffer);\n"
+                "   if (data)\n"
+                "      Check(cudaMemcpy(buffer, data, n * sizeof(float), cudaMemcpyHostToDevice), \"cudaMemcpy\");\n"
+                "   return static_cast<float *>(buffer);\n"
+                "}\n"
+                "}//GPU\n");
+    } else if (!fNeededBlasRoutines.empty()) {
         fGC += ("namespace BLAS{\n");
         for (auto &routine : fNeededBlasRoutines) {
             if (routine == "Gemm") {
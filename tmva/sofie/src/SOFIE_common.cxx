@@ -59,6 +59,12 @@ std::string ConvertTypeToString(ETensorType type){
       case ETensorType::FLOAT : {
          return "float";
       }
+      case ETensorType::INT8 : {
+         return "int8_t";
+      }
+      case ETensorType::UNINT8 : {
+         return "uint8_t";
+      }
       case ETensorType::INT16 : {
          return "int16_t";
       }
@@ -89,6 +95,24 @@ std::string ConvertTypeToString(ETensorType type){
    }
 }
 
+std::string GenerateActivationCode(EActivationType activation, const std::string & value){
+   // same expressions as in the corresponding operators (ROperator_Relu, ROperator_Sigmoid and ROperator_Tanh)
+   switch(activation){
+      case EActivationType::RELU : {
+         return "((" + value + " > 0 )? " + value + " : 0)";
+      }
+      case EActivationType::SIGMOID : {
+         return "1 / (1 + std::exp( - " + value + "))";
+      }
+      case EActivationType::TANH : {
+         return "std::tanh(" + value + ")";
+      }
+      default : {
+         return value;
+      }
+   }
+}
+
 ETensorType ConvertStringToType(std::string type){
    if(type == "float32" || type == "float" || type == "Float"){
      return ETensorType::FLOAT;
@@ -96,6 +120,12 @@ ETensorType ConvertStringToType(std::string type){
    else if(type == "int64" || type == "int64_t"){
      return ETensorType::INT64;
    }
+   else if (type == "int8" || type == "int8_t"){
+      return ETensorType::INT8;
+   }
+   else if (type == "uint8" || type == "uint8_t"){
+      return ETensorType::UNINT8;
+   }
    else if (type == "double" || type == "float64"){
       return ETensorType::DOUBLE;
    }
@@ -170,6 +200,20 @@ static inline void copy_vector_data(int_t no_of_copies, int_t input_size, T* inp
 }
 }
 
+double UTILITY::GetValueAsDouble(ETensorType type, const void * data, size_t i) {
+   switch(type){
+      case ETensorType::FLOAT : return static_cast<const float *>(data)[i];
+      case ETensorType::DOUBLE : return static_cast<const double *>(data)[i];
+      case ETensorType::INT8 : return static_cast<const int8_t *>(data)[i];
+      case ETensorType::UNINT8 : return static_cast<const uint8_t *>(data)[i];
+      case ETensorType::INT32 : return static_cast<const int32_t *>(data)[i];
+      case ETensorType::INT64 : return static_cast<const int64_t *>(data)[i];
+      default:
+         throw std::runtime_error("TMVA::SOFIE - tensor type " + ConvertTypeToString(type) +
+                                  " cannot be converted to a numerical value");
+   }
+}
+
 bool UTILITY::AreSameShape(const std::vector<size_t>& shapeA, const std::vector<size_t>& shapeB) {
    if (shapeA.size() != shapeB.size()) {
       return false;
@@ -295,6 +295,18 @@
 #include "Tile5D_FromONNX.hxx"
 #include "input_models/references/Tile5D.ref.hxx"
 
+#include "QuantizeLinear_FromONNX.hxx"
+#include "input_models/references/QuantizeLinear.ref.hxx"
+
+#include "DequantizeLinear_FromONNX.hxx"
+#include "input_models/references/DequantizeLinear.ref.hxx"
+
+#include "QuantizeDequantizeLinear_FromONNX.hxx"
+#include "input_models/references/QuantizeDequantizeLinear.ref.hxx"
+
+#include "QLinearMatMul_FromONNX.hxx"
+#include "input_models/references/QLinearMatMul.ref.hxx"
+
 #include "gtest/gtest.h"
 
 constexpr float DEFAULT_TOLERANCE = 1e-3f;
@@ -2839,4 +2851,82 @@ TEST(ONNX, Tile5D) {
       for (size_t i = 0; i < output.size(); ++i) {
          EXPECT_LE(std::abs(output[i] - correct[i]), TOLERANCE);
       }
-}
\ No newline at end of file
+}
+
+TEST(ONNX, QuantizeLinear)
+{
+   // x / scale = 2.5, 3.5, -0.5 and -1.5 are rounded to the nearest even integer,
+   // 100 and -100 saturate the uint8 output
+   std::vector<float> input({1.25, 1.75, -0.25, -0.75, 100.0, -100.0, 63.25, -64.0});
+   TMVA_SOFIE_QuantizeLinear::Session s("QuantizeLinear_FromONNX.dat");
+   std::vector<uint8_t> output = s.infer(input.data());
+
+   // Checking output size
+   EXPECT_EQ(output.size(), sizeof(QuantizeLinear_ExpectedOutput::outputs) / sizeof(uint8_t));
+
+   uint8_t *correct = QuantizeLinear_ExpectedOutput::outputs;
+
+   // Checking every output value, one by one
+   for (size_t i = 0; i < output.size(); ++i) {
+      EXPECT_EQ(int(output[i]), int(correct[i]));
+   }
+}
+
+TEST(ONNX, DequantizeLinear)
+{
+   constexpr float TOLERANCE = DEFAULT_TOLERANCE;
+
+   std::vector<int8_t> input({-128, -3, 0, 5, 127, -1});
+   TMVA_SOFIE_DequantizeLinear::Session s("DequantizeLinear_FromONNX.dat");
+   std::vector<float> output = s.infer(input.data());
+
+   // Checking output size
+   EXPECT_EQ(output.size(), sizeof(DequantizeLinear_ExpectedOutput::outputs) / sizeof(float));
+
+   float *correct = DequantizeLinear_ExpectedOutput::outputs;
+
+   // Checking every output value, one by one
+   for (size_t i = 0; i < output.size(); ++i) {
+      EXPECT_LE(std::abs(output[i] - correct[i]), TOLERANCE);
+   }
+}
+
+TEST(ONNX, QuantizeDequantizeLinear)
+{
+   constexpr float TOLERANCE = DEFAULT_TOLERANCE;
+
+   // int8 quantization with zero point -3: rounding to nearest even, and saturation at 127 and -128
+   std::vector<float> input({1.25, 1.75, -0.25, -0.75, 100.0, -100.0, 63.25, -62.75});
+   TMVA_SOFIE_QuantizeDequantizeLinear::Session s("QuantizeDequantizeLinear_FromONNX.dat");
+   std::vector<float> output = s.infer(input.data());
+
+   // Checking output size
+   EXPECT_EQ(output.size(), sizeof(QuantizeDequantizeLinear_ExpectedOutput::outputs) / sizeof(float));
+
+   float *correct = QuantizeDequantizeLinear_ExpectedOutput::outputs;
+
+   // Checking every output value, one by one
+   for (size_t i = 0; i < output.size(); ++i) {
+      EXPECT_LE(std::abs(output[i] - correct[i]), TOLERANCE);
+   }
+}
+
+TEST(ONNX, QLinearMatMul)
+{
+   // uint8 A [2,3] with per-tensor quantization times int8 B [3,4] with per-column scales and zero points.
+   // The scales are powers of two, so that the requantized values are exact: 12.5 is rounded to 12,
+   // and the output saturates at 0 and 255
+   std::vector<uint8_t> input({10, 20, 30, 255, 0, 128});
+   TMVA_SOFIE_QLinearMatMul::Session s("QLinearMatMul_FromONNX.dat");
+   std::vector<uint8_t> output = s.infer(input.data());
+
+   // Checking output size
+   EXPECT_EQ(output.size(), sizeof(QLinearMatMul_ExpectedOutput::outputs) / sizeof(uint8_t));
+
+   uint8_t *correct = QLinearMatMul_ExpectedOutput::outputs;
+
+   // Checking every output value, one by one
+   for (size_t i = 0; i < output.size(); ++i) {
+      EXPECT_EQ(int(output[i]), int(correct[i]));
+   }
+}
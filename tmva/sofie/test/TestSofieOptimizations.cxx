@@ -0,0 +1,214 @@
+// Check that the operator fusion and the memory planning done by default in RModel::Generate
+// do not change the results: each model is compared with the same model generated with
+// Options::kNoOperatorFusion | Options::kNoMemoryPlanning (see EmitFromONNX.cxx.in).
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Linear_16_FromONNX.hxx"
+#include "Linear_16_Unoptimized_FromONNX.hxx"
+
+#include "Linear_32_FromONNX.hxx"
+#include "Linear_32_Unoptimized_FromONNX.hxx"
+
+#include "Linear_64_FromONNX.hxx"
+#include "Linear_64_Unoptimized_FromONNX.hxx"
+
+#include "LinearWithSelu_FromONNX.hxx"
+#include "LinearWithSelu_Unoptimized_FromONNX.hxx"
+
+#include "LinearWithSigmoid_FromONNX.hxx"
+#include "LinearWithSigmoid_Unoptimized_FromONNX.hxx"
+
+#include "LinearWithLeakyRelu_FromONNX.hxx"
+#include "LinearWithLeakyRelu_Unoptimized_FromONNX.hxx"
+
+#include "Tanh_FromONNX.hxx"
+#include "Tanh_Unoptimized_FromONNX.hxx"
+
+#include "ConvWithPadding_FromONNX.hxx"
+#include "ConvWithPadding_Unoptimized_FromONNX.hxx"
+
+#include "ConvWithStridesPadding_FromONNX.hxx"
+#include "ConvWithStridesPadding_Unoptimized_FromONNX.hxx"
+
+#include "ConvTransposeBias2d_FromONNX.hxx"
+#include "ConvTransposeBias2d_Unoptimized_FromONNX.hxx"
+
+#include "LayerNormalization4d_FromONNX.hxx"
+#include "LayerNormalization4d_Unoptimized_FromONNX.hxx"
+
+#include "AddBroadcast3_FromONNX.hxx"
+#include "AddBroadcast3_Unoptimized_FromONNX.hxx"
+
+#include "RNNBatchwise_FromONNX.hxx"
+#include "RNNBatchwise_Unoptimized_FromONNX.hxx"
+
+#include "LSTMBatchwise_FromONNX.hxx"
+#include "LSTMBatchwise_Unoptimized_FromONNX.hxx"
+
+#include "GRUBatchwise_FromONNX.hxx"
+#include "GRUBatchwise_Unoptimized_FromONNX.hxx"
+
+#include "gtest/gtest.h"
+
+constexpr float TOLERANCE = 1e-5f;
+
+/// Inputs with values of both signs, so that the fused activations are exercised on both branches
+std::vector<float> RandomInput(std::size_t n, unsigned seed = 42)
+{
+   std::mt19937 gen(seed);
+   std::uniform_real_distribution<float> dist(-2.f, 2.f);
+   std::vector<float> input(n);
+   for (auto &x : input)
+      x = dist(gen);
+   return input;
+}
+
+void ExpectSameOutput(const std::vector<float> &output, const std::vector<float> &expected)
+{
+   ASSERT_EQ(output.size(), expected.size());
+   for (std::size_t i = 0; i < output.size(); ++i) {
+      EXPECT_NEAR(output[i], expected[i], TOLERANCE * std::max(1.f, std::abs(expected[i]))) << "at index " << i;
+   }
+}
+
+void ExpectSameOutput(const std::vector<std::vector<float>> &output, const std::vector<std::vector<float>> &expected)
+{
+   ASSERT_EQ(output.size(), expected.size());
+   for (std::size_t i = 0; i < output.size(); ++i)
+      ExpectSameOutput(output[i], expected[i]);
+}
+
+/// Run the optimized and the unoptimized Session twice on the same inputs: the second call
+/// checks that the tensors sharing memory are correctly overwritten between calls
+template <typename Session_t, typename UnoptimizedSession_t, typename... Inputs>
+void ExpectSameInference(Session_t &s, UnoptimizedSession_t &ref, Inputs *...inputs)
+{
+   auto expected = ref.infer(inputs...);
+   ExpectSameOutput(s.infer(inputs...), expected);
+   ExpectSameOutput(s.infer(inputs...), expected);
+}
+
+TEST(SofieOptimizations, Linear16)
+{
+   auto input = RandomInput(1600);
+   TMVA_SOFIE_Linear_16::Session s("Linear_16_FromONNX.dat");
+   TMVA_SOFIE_Linear_16_Unoptimized::Session ref("Linear_16_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, Linear32)
+{
+   auto input = RandomInput(3200);
+   TMVA_SOFIE_Linear_32::Session s("Linear_32_FromONNX.dat");
+   TMVA_SOFIE_Linear_32_Unoptimized::Session ref("Linear_32_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, Linear64)
+{
+   auto input = RandomInput(6400);
+   TMVA_SOFIE_Linear_64::Session s("Linear_64_FromONNX.dat");
+   TMVA_SOFIE_Linear_64_Unoptimized::Session ref("Linear_64_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, LinearWithSelu)
+{
+   auto input = RandomInput(48);
+   TMVA_SOFIE_LinearWithSelu::Session s("LinearWithSelu_FromONNX.dat");
+   TMVA_SOFIE_LinearWithSelu_Unoptimized::Session ref("LinearWithSelu_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, LinearWithSigmoid)
+{
+   auto input = RandomInput(48);
+   TMVA_SOFIE_LinearWithSigmoid::Session s("LinearWithSigmoid_FromONNX.dat");
+   TMVA_SOFIE_LinearWithSigmoid_Unoptimized::Session ref("LinearWithSigmoid_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, LinearWithLeakyRelu)
+{
+   auto input = RandomInput(24);
+   TMVA_SOFIE_LinearWithLeakyRelu::Session s("LinearWithLeakyRelu_FromONNX.dat");
+   TMVA_SOFIE_LinearWithLeakyRelu_Unoptimized::Session ref("LinearWithLeakyRelu_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, Tanh)
+{
+   auto input = RandomInput(24);
+   TMVA_SOFIE_Tanh::Session s("Tanh_FromONNX.dat");
+   TMVA_SOFIE_Tanh_Unoptimized::Session ref("Tanh_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, ConvWithPadding)
+{
+   auto input = RandomInput(25);
+   TMVA_SOFIE_ConvWithPadding::Session s("ConvWithPadding_FromONNX.dat");
+   TMVA_SOFIE_ConvWithPadding_Unoptimized::Session ref("ConvWithPadding_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, ConvWithStridesPadding)
+{
+   auto input = RandomInput(35);
+   TMVA_SOFIE_ConvWithStridesPadding::Session s("ConvWithStridesPadding_FromONNX.dat");
+   TMVA_SOFIE_ConvWithStridesPadding_Unoptimized::Session ref("ConvWithStridesPadding_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, ConvTransposeBias2d)
+{
+   auto input = RandomInput(9);
+   TMVA_SOFIE_ConvTransposeBias2d::Session s("ConvTransposeBias2d_FromONNX.dat");
+   TMVA_SOFIE_ConvTransposeBias2d_Unoptimized::Session ref("ConvTransposeBias2d_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, LayerNormalization4d)
+{
+   auto input = RandomInput(120);
+   TMVA_SOFIE_LayerNormalization4d::Session s("LayerNormalization4d_FromONNX.dat");
+   TMVA_SOFIE_LayerNormalization4d_Unoptimized::Session ref("LayerNormalization4d_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, AddBroadcast3)
+{
+   auto a = RandomInput(10, 1);
+   auto b = RandomInput(120, 2);
+   TMVA_SOFIE_AddBroadcast3::Session s("AddBroadcast3_FromONNX.dat");
+   TMVA_SOFIE_AddBroadcast3_Unoptimized::Session ref("AddBroadcast3_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, a.data(), b.data());
+}
+
+TEST(SofieOptimizations, RNNBatchwise)
+{
+   auto input = RandomInput(6);
+   TMVA_SOFIE_RNNBatchwise::Session s("RNNBatchwise_FromONNX.dat");
+   TMVA_SOFIE_RNNBatchwise_Unoptimized::Session ref("RNNBatchwise_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, LSTMBatchwise)
+{
+   auto input = RandomInput(6);
+   TMVA_SOFIE_LSTMBatchwise::Session s("LSTMBatchwise_FromONNX.dat");
+   TMVA_SOFIE_LSTMBatchwise_Unoptimized::Session ref("LSTMBatchwise_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
+
+TEST(SofieOptimizations, GRUBatchwise)
+{
+   auto input = RandomInput(6);
+   TMVA_SOFIE_GRUBatchwise::Session s("GRUBatchwise_FromONNX.dat");
+   TMVA_SOFIE_GRUBatchwise_Unoptimized::Session ref("GRUBatchwise_Unoptimized_FromONNX.dat");
+   ExpectSameInference(s, ref, input.data());
+}
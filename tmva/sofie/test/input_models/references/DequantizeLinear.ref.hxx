@@ -0,0 +1,3 @@
+namespace DequantizeLinear_ExpectedOutput{
+	float outputs[] = {-12.5, 0, 0.3, 0.8, 13, 0.2};
+} // namespace DequantizeLinear_ExpectedOutput
@@ -0,0 +1,3 @@
+namespace QLinearMatMul_ExpectedOutput{
+	uint8_t outputs[] = {17, 0, 80, 1, 144, 0, 255, 255};
+} // namespace QLinearMatMul_ExpectedOutput
@@ -0,0 +1,3 @@
+namespace QuantizeDequantizeLinear_ExpectedOutput{
+	float outputs[] = {1.0, 2.0, 0.0, -1.0, 65.0, -62.5, 63.0, -62.5};
+} // namespace QuantizeDequantizeLinear_ExpectedOutput
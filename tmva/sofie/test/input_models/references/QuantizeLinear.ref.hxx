@@ -0,0 +1,3 @@
+namespace QuantizeLinear_ExpectedOutput{
+	uint8_t outputs[] = {130, 132, 128, 126, 255, 0, 254, 0};
+} // namespace QuantizeLinear_ExpectedOutput
@@ -0,0 +1,41 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_QLinearMatMul.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+ParserFuncSignature ParseQLinearMatMul = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   if (nodeproto.input_size() != 8) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearMatMul op has " +
+                               std::to_string(nodeproto.input_size()) + " inputs instead of 8");
+   }
+   // inputs: a, a_scale, a_zero_point, b, b_scale, b_zero_point, y_scale, y_zero_point
+   auto input_name = nodeproto.input(0);
+   if (!parser.IsRegisteredTensorType(input_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearMatMul op has input tensor " + input_name +
+                               " but its type is not yet registered");
+   }
+   auto zero_point_name = nodeproto.input(7);
+   if (!parser.IsRegisteredTensorType(zero_point_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearMatMul op has zero point tensor " + zero_point_name +
+                               " but its type is not yet registered");
+   }
+
+   std::string output_name = nodeproto.output(0);
+   std::unique_ptr<ROperator> op(new ROperator_QLinearMatMul(nodeproto.input(0), nodeproto.input(1), nodeproto.input(2),
+                                                             nodeproto.input(3), nodeproto.input(4), nodeproto.input(5),
+                                                             nodeproto.input(6), zero_point_name, output_name));
+
+   // the output has the type of its zero point
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, parser.GetTensorType(zero_point_name));
+   }
+
+   return op;
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
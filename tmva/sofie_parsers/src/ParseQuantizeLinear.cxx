@@ -0,0 +1,64 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/ROperator_DequantizeLinear.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+ParserFuncSignature ParseQuantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   auto input_name = nodeproto.input(0);
+   if (!parser.IsRegisteredTensorType(input_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QuantizeLinear op has input tensor " + input_name +
+                               " but its type is not yet registered");
+   }
+   std::string zero_point_name = (nodeproto.input_size() > 2) ? nodeproto.input(2) : "";
+
+   // the output type is the one of the zero point, or given by the output_dtype attribute, by default uint8
+   ETensorType output_type = ETensorType::UNINT8;
+   if (!zero_point_name.empty()) {
+      if (!parser.IsRegisteredTensorType(zero_point_name)) {
+         throw std::runtime_error("TMVA::SOFIE ONNX Parser QuantizeLinear op has zero point tensor " +
+                                  zero_point_name + " but its type is not yet registered");
+      }
+      output_type = parser.GetTensorType(zero_point_name);
+   }
+   for (int_t i = 0; i < nodeproto.attribute_size(); i++) {
+      if (nodeproto.attribute(i).name() == "output_dtype" && nodeproto.attribute(i).i() != 0)
+         output_type = static_cast<ETensorType>(nodeproto.attribute(i).i());
+   }
+
+   std::string output_name = nodeproto.output(0);
+   std::unique_ptr<ROperator> op(
+      new ROperator_QuantizeLinear(input_name, nodeproto.input(1), zero_point_name, output_name, output_type));
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, output_type);
+   }
+
+   return op;
+};
+
+ParserFuncSignature ParseDequantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   auto input_name = nodeproto.input(0);
+   if (!parser.IsRegisteredTensorType(input_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser DequantizeLinear op has input tensor " + input_name +
+                               " but its type is not yet registered");
+   }
+   std::string zero_point_name = (nodeproto.input_size() > 2) ? nodeproto.input(2) : "";
+
+   std::string output_name = nodeproto.output(0);
+   std::unique_ptr<ROperator> op(
+      new ROperator_DequantizeLinear(input_name, nodeproto.input(1), zero_point_name, output_name));
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, ETensorType::FLOAT);
+   }
+
+   return op;
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
@@ -79,6 +79,9 @@ extern ParserFuncSignature ParseTopK;
 extern ParserFuncSignature ParseTile;
 extern ParserFuncSignature ParseSplit;
 extern ParserFuncSignature ParseIf;
+extern ParserFuncSignature ParseQuantizeLinear;
+extern ParserFuncSignature ParseDequantizeLinear;
+extern ParserFuncSignature ParseQLinearMatMul;
 // Decalaration of fused operators
 extern ParserFuseFuncSignature ParseFuseConvAdd;
 extern ParserFuseFuncSignature ParseFuseConvTransposeAdd;
@@ -116,6 +119,21 @@ struct ExtractDataFromTP<int32_t> {
                                                             static_cast<int32_t *>(data));
    }
 };
+// 8-bit integers (e.g. quantized weights) are stored as int32 values in the TensorProto
+template<>
+struct ExtractDataFromTP<int8_t> {
+   static void Copy(onnx::TensorProto * tensor, void * data) {
+      for (int i = 0; i < tensor->int32_data_size(); i++)
+         static_cast<int8_t *>(data)[i] = tensor->int32_data(i);
+   }
+};
+template<>
+struct ExtractDataFromTP<uint8_t> {
+   static void Copy(onnx::TensorProto * tensor, void * data) {
+      for (int i = 0; i < tensor->int32_data_size(); i++)
+         static_cast<uint8_t *>(data)[i] = tensor->int32_data(i);
+   }
+};
 template<>
 struct ExtractDataFromTP<int64_t> {
    static void Copy(onnx::TensorProto * tensor, void * data) {
@@ -215,6 +233,9 @@ RModelParser_ONNX::RModelParser_ONNX() noexcept : fOperatorsMapImpl(std::make_un
    RegisterOperator("Tile", ParseTile);
    RegisterOperator("Split", ParseSplit);
    RegisterOperator("If", ParseIf);
+   RegisterOperator("QuantizeLinear", ParseQuantizeLinear);
+   RegisterOperator("DequantizeLinear", ParseDequantizeLinear);
+   RegisterOperator("QLinearMatMul", ParseQLinearMatMul);
 }
 
 // Destructor of the parser
@@ -492,6 +513,20 @@ void RModelParser_ONNX::ParseONNXGraph(RModel & rmodel, const onnx::GraphProto &
          allInitializedTensors[input_name] = i;
          break;
       }
+      case ETensorType::INT8: {
+         std::shared_ptr<void> data = GetInitializedTensorData<int8_t>(tensorproto, fLength);
+         if (verbose) std::cout << "add INT8 initialized tensor " << input_name << " shape " << ConvertShapeToString(shape) << std::endl;
+         rmodel.AddInitializedTensor(input_name, ETensorType::INT8, shape, data);
+         allInitializedTensors[input_name] = i;
+         break;
+      }
+      case ETensorType::UNINT8: {
+         std::shared_ptr<void> data = GetInitializedTensorData<uint8_t>(tensorproto, fLength);
+         if (verbose) std::cout << "add UINT8 initialized tensor " << input_name << " shape " << ConvertShapeToString(shape) << std::endl;
+         rmodel.AddInitializedTensor(input_name, ETensorType::UNINT8, shape, data);
+         allInitializedTensors[input_name] = i;
+         break;
+      }
       default:
          throw std::runtime_error("Data type in weight tensor " + graph.initializer(i).name() + " not supported!\n");
       }
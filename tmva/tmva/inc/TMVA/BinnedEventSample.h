@@ -0,0 +1,75 @@
+// @(#)root/tmva $Id$
+
+/**********************************************************************************
+ * Project: TMVA - a Root-integrated toolkit for multivariate data analysis       *
+ * Package: TMVA                                                                  *
+ * Class  : BinnedEventSample                                                     *
+ *                                                                                *
+ *                                                                                *
+ * Description:                                                                   *
+ *      Training events with their input variables binned in quantiles, stored    *
+ *      by variable, for the histogram based training of decision trees           *
+ *                                                                                *
+ * Copyright (c) 2005-2011:                                                       *
+ *      CERN, Switzerland                                                         *
+ *      U. of Victoria, Canada                                                    *
+ *      MPI-K Heidelberg, Germany                                                 *
+ *      U. of Bonn, Germany                                                       *
+ *                                                                                *
+ * Redistribution and use in source and binary forms, with or without             *
+ * modification, are permitted according to the terms listed in LICENSE           *
+ * (http://mva.sourceforge.net/license.txt)                                       *
+ *                                                                                *
+ **********************************************************************************/
+
+#ifndef ROOT_TMVA_BinnedEventSample
+#define ROOT_TMVA_BinnedEventSample
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// BinnedEventSample                                                    //
+//                                                                      //
+// Training events with their input variables binned in quantiles       //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace TMVA {
+
+   class Event;
+
+   class BinnedEventSample {
+
+   public:
+
+      // bin the variables of the events in at most maxBins bins each
+      BinnedEventSample( const std::vector<const TMVA::Event*> & events, UInt_t nvars, UInt_t maxBins );
+
+      UInt_t GetNVars() const { return fCutValues.size(); }
+
+      // number of bins of a variable
+      UInt_t GetNBins( UInt_t ivar ) const { return fCutValues[ivar].size() + 1; }
+
+      // lower edge of the bin ibin+1: the events of the bins up to ibin have values below this cut
+      Float_t GetCutValue( UInt_t ivar, UInt_t ibin ) const { return fCutValues[ivar][ibin]; }
+
+      // bin indices of all the events for a variable
+      const UShort_t* GetBins( UInt_t ivar ) const { return fBins[ivar].data(); }
+
+      // row of an event in the columns of the bin indices, -1 if the event is not in the sample
+      Int_t GetRow( const TMVA::Event* event ) const;
+
+   private:
+
+      std::vector< std::vector<Float_t> >  fCutValues; ///< inner bin edges of each variable
+      std::vector< std::vector<UShort_t> > fBins;      ///< bin index of the events, one column per variable
+      std::unordered_map<const TMVA::Event*, UInt_t> fRows; ///< row of each event in the columns
+   };
+
+} // namespace TMVA
+
+#endif
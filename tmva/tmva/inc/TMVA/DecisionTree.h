@@ -61,6 +61,7 @@ class TRandom3;
 namespace TMVA {
 
    class Event;
+   class BinnedEventSample;
 
    class DecisionTree : public BinaryTree {
 
@@ -192,6 +193,8 @@ namespace TMVA {
       inline void SetMinLinCorrForFisher(Double_t min){fMinLinCorrForFisher = min;}
       inline void SetUseExclusiveVars(Bool_t t=kTRUE){fUseExclusiveVars = t;}
       inline void SetNVars(Int_t n){fNvars = n;}
+      // use the histogram based training, with the binning of the variables of the training events
+      inline void SetBinnedSample(const BinnedEventSample *binned){fBinnedSample = binned;}
 
    private:
       // utility functions
@@ -202,6 +205,15 @@ namespace TMVA {
       // calculates the purity S/(S+B) of a given event sample
       Double_t SamplePurity(EventList eventSample);
 
+      // histogram based training
+      struct HistogramBin;
+      struct HistogramSample;
+      UInt_t BuildTreeHistogram( const EventConstList & eventSample );
+      void   FillNodeHistogram( const HistogramSample & sample, const std::vector<UInt_t> & events,
+                                std::vector<HistogramBin> & hist ) const;
+      void   TrainNodeHistogram( const HistogramSample & sample, DecisionTreeNode *node,
+                                 std::vector<UInt_t> & events, std::vector<HistogramBin> & hist );
+
       UInt_t    fNvars;               ///< number of variables used to separate S and B
       Int_t     fNCuts;               ///< number of grid point in variable cut scans
       Bool_t    fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
@@ -240,6 +252,8 @@ namespace TMVA {
 
       DataSetInfo*  fDataSetInfo;
 
+      const BinnedEventSample *fBinnedSample; ///<! binned training events for the histogram based training
+
       ClassDef(DecisionTree,0);               // implementation of a Decision Tree
    };
 
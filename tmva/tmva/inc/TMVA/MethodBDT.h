@@ -47,6 +47,7 @@
 #include "TTree.h"
 #include "TMVA/MethodBase.h"
 #include "TMVA/DecisionTree.h"
+#include "TMVA/BinnedEventSample.h"
 #include "TMVA/Event.h"
 #include "TMVA/LossFunction.h"
 
@@ -236,6 +237,8 @@ namespace TMVA {
       Bool_t                          fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
       Double_t                        fMinLinCorrForFisher; ///< the minimum linear correlation between two variables demanded for use in fisher criterium in node splitting
       Bool_t                          fUseExclusiveVars;    ///< individual variables already used in fisher criterium are not anymore analysed individually for node splitting
+      Bool_t                          fHistogramSplits;     ///< find the node splits in the histograms of the binned variables
+      std::unique_ptr<BinnedEventSample> fBinnedSample;     ///<! binned training events for the histogram based node splitting
       Bool_t                          fUseYesNoLeaf;        ///< use sig or bkg classification in leave nodes or sig/bkg
       Double_t                        fNodePurityLimit;     ///< purity limit for sig/bkg nodes
       UInt_t                          fNNodesMax;           ///< max # of nodes
@@ -62,6 +62,17 @@ public:
 
    RTensor<Value_t> Compute(RTensor<Value_t> const &x) const;
 
+   /// Generate the C++ code of an extern "C" function `void funcName(const float *x, float *out)` that
+   /// computes the raw scores of the forest (before the logistic or softmax transformation), with the trees
+   /// unrolled into nested comparisons.
+   std::string GenerateCode(std::string const &funcName) const;
+
+   /// Compile the generated code of the forest with ACLiC and use it in the subsequent calls of Compute.
+   void Compile(std::string const &cacheDir = "");
+
+   /// Whether the forest was compiled with Compile()
+   bool IsCompiled() const { return fCompiledForest != nullptr; }
+
    static RBDT LoadText(std::string const &txtpath, std::vector<std::string> &features, int nClasses, bool logistic,
                         Value_t baseScore);
 
@@ -71,6 +82,10 @@ private:
 
    void Softmax(const Value_t *array, Value_t *out) const;
    void ComputeImpl(const Value_t *array, Value_t *out) const;
+   void ComputeBatch(const Value_t *x, std::size_t nRows, std::size_t nCols, Value_t *out) const;
+   void Transform(Value_t *out) const;
+   void GenerateNodeCode(std::ostream &os, int index, std::size_t iOut, int depth) const;
+   void GenerateChildCode(std::ostream &os, int index, std::size_t iOut, int depth) const;
    Value_t EvaluateBinary(const Value_t *array) const;
    static void correctIndices(std::span<int> indices, IndexMap const &nodeIndices, IndexMap const &leafIndices);
    static void terminateTree(TMVA::Experimental::RBDT &ff, int &nPreviousNodes, int &nPreviousLeaves,
@@ -88,6 +103,7 @@ private:
    std::vector<Value_t> fBaseResponses;
    Value_t fBaseScore = 0.0;
    bool fLogistic = false;
+   void (*fCompiledForest)(const Value_t *, Value_t *) = nullptr; ///<! Compiled forest, see Compile()
 
    ClassDefNV(RBDT, 1);
 };
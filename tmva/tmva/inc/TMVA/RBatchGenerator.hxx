@@ -7,6 +7,10 @@
 #include <memory>
 #include <cmath>
 #include <mutex>
+#include <queue>
+#include <condition_variable>
+#include <algorithm>
+#include <numeric>
 
 #include "TMVA/RTensor.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
@@ -20,12 +24,23 @@ namespace TMVA {
 namespace Experimental {
 namespace Internal {
 
+/// \brief Generator of batches of a dataset, for the training of machine learning models.
+///
+/// The dataset is read in chunks of fChunkSize entries, which are split into training and validation events
+/// and then into batches. A chunk is a fixed range of entries of the dataset (of which only the events passing
+/// the filters are kept), so that the chunks can be loaded independently: each epoch loads them in a random
+/// order when shuffling, which mixes the events of all the files without reading the whole dataset at once.
+///
+/// The chunks are loaded by fNumLoadingThreads threads into a bounded pool of fNumLoadingThreads + 1 chunk
+/// buffers, and the filled chunks are split into batches by a separate thread. With a single loading thread,
+/// the next chunk is therefore loaded while the batches of the current one are created and consumed.
+/// With several loading threads the order of the chunks, and thus of the batches, is not reproducible.
 template <typename... Args>
 class RBatchGenerator {
 private:
    TMVA::RandomGenerator<TRandom3> fRng = TMVA::RandomGenerator<TRandom3>(0);
 
-   std::string fFileName;
+   std::vector<std::string> fFileNames;
    std::string fTreeName;
 
    std::vector<std::string> fCols;
@@ -37,22 +52,40 @@ private:
    std::size_t fMaxBatches;
    std::size_t fNumColumns;
    std::size_t fNumEntries;
-   std::size_t fCurrentRow = 0;
+   std::size_t fNumChunks;
+   std::size_t fNumLoadingThreads;
 
    float fValidationSplit;
 
    std::unique_ptr<TMVA::Experimental::Internal::RChunkLoader<Args...>> fChunkLoader;
    std::unique_ptr<TMVA::Experimental::Internal::RBatchLoader> fBatchLoader;
 
-   std::unique_ptr<std::thread> fLoadingThread;
+   std::vector<std::thread> fLoadingThreads;
+   std::unique_ptr<std::thread> fBatchingThread;
 
    bool fUseWholeFile = true;
 
-   std::unique_ptr<TMVA::Experimental::RTensor<float>> fChunkTensor;
-   std::unique_ptr<TMVA::Experimental::RTensor<float>> fCurrentBatch;
+   /// A loaded chunk, waiting to be split into batches
+   struct RLoadedChunk {
+      std::size_t fChunkIdx;
+      std::size_t fPassedEvents;
+      std::unique_ptr<TMVA::Experimental::RTensor<float>> fTensor;
+   };
+
+   // chunk buffers ready to be filled, and filled chunks ready to be split into batches
+   std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fFreeChunkTensors;
+   std::queue<RLoadedChunk> fLoadedChunks;
+   std::mutex fChunkLock;
+   std::condition_variable fChunkCondition;
+
+   // order in which the chunks are loaded in the current epoch, and next position in it
+   std::vector<std::size_t> fChunkOrder;
+   std::size_t fNextChunk = 0;
+   std::size_t fNumLoadingThreadsRunning = 0;
 
    std::vector<std::vector<std::size_t>> fTrainingIdxs;
    std::vector<std::vector<std::size_t>> fValidationIdxs;
+   std::vector<bool> fIsSplit;
 
    // filled batch elements
    std::mutex fIsActiveLock;
@@ -64,13 +97,13 @@ private:
    float fVecPadding;
 
 public:
-   RBatchGenerator(const std::string &treeName, const std::string &fileName, const std::size_t chunkSize,
-                   const std::size_t batchSize, const std::vector<std::string> &cols, const std::string &filters = "",
-                   const std::vector<std::size_t> &vecSizes = {}, const float vecPadding = 0.0,
-                   const float validationSplit = 0.0, const std::size_t maxChunks = 0, const std::size_t numColumns = 0,
-                   bool shuffle = true)
+   RBatchGenerator(const std::string &treeName, const std::vector<std::string> &fileNames,
+                   const std::size_t chunkSize, const std::size_t batchSize, const std::vector<std::string> &cols,
+                   const std::string &filters = "", const std::vector<std::size_t> &vecSizes = {},
+                   const float vecPadding = 0.0, const float validationSplit = 0.0, const std::size_t maxChunks = 0,
+                   const std::size_t numColumns = 0, bool shuffle = true, const std::size_t numLoadingThreads = 1)
       : fTreeName(treeName),
-        fFileName(fileName),
+        fFileNames(fileNames),
         fChunkSize(chunkSize),
         fBatchSize(batchSize),
         fCols(cols),
@@ -81,29 +114,50 @@ public:
         fMaxChunks(maxChunks),
         fNumColumns((numColumns != 0) ? numColumns : cols.size()),
         fShuffle(shuffle),
-        fUseWholeFile(maxChunks == 0)
+        fUseWholeFile(maxChunks == 0),
+        fNumLoadingThreads(std::max<std::size_t>(numLoadingThreads, 1))
    {
       // limits the number of batches that can be contained in the batchqueue based on the chunksize
       fMaxBatches = ceil((fChunkSize / fBatchSize) * (1 - fValidationSplit));
 
-      // get the number of fNumEntries in the dataframe
-      std::unique_ptr<TFile> f{TFile::Open(fFileName.c_str())};
-      std::unique_ptr<TTree> t{f->Get<TTree>(fTreeName.c_str())};
-      fNumEntries = t->GetEntries();
-
       fChunkLoader = std::make_unique<TMVA::Experimental::Internal::RChunkLoader<Args...>>(
-         fTreeName, fFileName, fChunkSize, fCols, fFilters, fVecSizes, fVecPadding);
+         fTreeName, fFileNames, fChunkSize, fCols, fFilters, fVecSizes, fVecPadding);
       fBatchLoader = std::make_unique<TMVA::Experimental::Internal::RBatchLoader>(fBatchSize, fNumColumns, fMaxBatches);
 
-      // Create tensor to load the chunk into
-      fChunkTensor =
-         std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>{fChunkSize, fNumColumns});
+      // get the number of fNumEntries in the dataset
+      fNumEntries = fChunkLoader->GetNumEntries();
+      fNumChunks = (fNumEntries + fChunkSize - 1) / fChunkSize;
+      if (!fUseWholeFile)
+         fNumChunks = std::min(fNumChunks, fMaxChunks);
+      fTrainingIdxs.resize(fNumChunks);
+      fValidationIdxs.resize(fNumChunks);
+      fIsSplit.resize(fNumChunks, false);
+
+      // several RDataFrames are run concurrently
+      if (fNumLoadingThreads > 1)
+         ROOT::EnableThreadSafety();
+
+      // Create the tensors to load the chunks into
+      for (std::size_t i = 0; i < fNumLoadingThreads + 1; i++) {
+         fFreeChunkTensors.emplace_back(
+            std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>{fChunkSize, fNumColumns}));
+      }
+   }
+
+   RBatchGenerator(const std::string &treeName, const std::string &fileName, const std::size_t chunkSize,
+                   const std::size_t batchSize, const std::vector<std::string> &cols, const std::string &filters = "",
+                   const std::vector<std::size_t> &vecSizes = {}, const float vecPadding = 0.0,
+                   const float validationSplit = 0.0, const std::size_t maxChunks = 0, const std::size_t numColumns = 0,
+                   bool shuffle = true, const std::size_t numLoadingThreads = 1)
+      : RBatchGenerator(treeName, std::vector<std::string>{fileName}, chunkSize, batchSize, cols, filters, vecSizes,
+                        vecPadding, validationSplit, maxChunks, numColumns, shuffle, numLoadingThreads)
+   {
    }
 
    ~RBatchGenerator() { DeActivate(); }
 
    /// \brief De-activate the loading process by deactivating the batchgenerator
-   /// and joining the loading thread
+   /// and joining the loading threads
    void DeActivate()
    {
       {
@@ -112,16 +166,34 @@ public:
       }
 
       fBatchLoader->DeActivate();
+      {
+         // the waiting threads must not miss the notification
+         std::lock_guard<std::mutex> lock(fChunkLock);
+      }
+      fChunkCondition.notify_all();
 
-      if (fLoadingThread) {
-         if (fLoadingThread->joinable()) {
-            fLoadingThread->join();
+      for (auto &thread : fLoadingThreads) {
+         if (thread.joinable()) {
+            thread.join();
          }
       }
+      fLoadingThreads.clear();
+
+      if (fBatchingThread) {
+         if (fBatchingThread->joinable()) {
+            fBatchingThread->join();
+         }
+      }
+
+      // give back the buffers of the chunks that were loaded but not split into batches
+      while (!fLoadedChunks.empty()) {
+         fFreeChunkTensors.emplace_back(std::move(fLoadedChunks.front().fTensor));
+         fLoadedChunks.pop();
+      }
    }
 
    /// \brief Activate the loading process by starting the batchloader, and
-   /// spawning the loading thread.
+   /// spawning the loading and batching threads.
    void Activate()
    {
       if (fIsActive)
@@ -132,9 +204,19 @@ public:
          fIsActive = true;
       }
 
-      fCurrentRow = 0;
+      fChunkOrder.resize(fNumChunks);
+      std::iota(fChunkOrder.begin(), fChunkOrder.end(), 0);
+      if (fShuffle) {
+         std::shuffle(fChunkOrder.begin(), fChunkOrder.end(), fRng);
+      }
+      fNextChunk = 0;
+      fNumLoadingThreadsRunning = fNumLoadingThreads;
+
       fBatchLoader->Activate();
-      fLoadingThread = std::make_unique<std::thread>(&RBatchGenerator::LoadChunks, this);
+      for (std::size_t i = 0; i < fNumLoadingThreads; i++) {
+         fLoadingThreads.emplace_back(&RBatchGenerator::LoadChunks, this);
+      }
+      fBatchingThread = std::make_unique<std::thread>(&RBatchGenerator::BatchChunks, this);
    }
 
    /// \brief Returns the next batch of training data if available.
@@ -159,56 +241,94 @@ public:
 
    bool HasValidationData() { return fBatchLoader->HasValidationData(); }
 
+   /// \brief Load the next chunks of the epoch into the free chunk buffers, until all the chunks are loaded.
+   /// Run by each of the loading threads.
    void LoadChunks()
    {
-      for (std::size_t current_chunk = 0; ((current_chunk < fMaxChunks) || fUseWholeFile) && fCurrentRow < fNumEntries;
-           current_chunk++) {
-
-         // stop the loop when the loading is not active anymore
+      while (true) {
+         std::size_t chunkIdx;
+         std::unique_ptr<TMVA::Experimental::RTensor<float>> chunkTensor;
          {
-            std::lock_guard<std::mutex> lock(fIsActiveLock);
-            if (!fIsActive)
+            std::unique_lock<std::mutex> lock(fChunkLock);
+            fChunkCondition.wait(lock, [this]() {
+               return !fFreeChunkTensors.empty() || fNextChunk == fChunkOrder.size() || !IsActive();
+            });
+            if (!IsActive() || fNextChunk == fChunkOrder.size()) {
+               if (--fNumLoadingThreadsRunning == 0)
+                  fChunkCondition.notify_all();
                return;
+            }
+            chunkIdx = fChunkOrder[fNextChunk++];
+            chunkTensor = std::move(fFreeChunkTensors.back());
+            fFreeChunkTensors.pop_back();
          }
 
+         const std::size_t start = chunkIdx * fChunkSize;
+         const std::size_t end = std::min(start + fChunkSize, fNumEntries);
          // A pair that consists the proccessed, and passed events while loading the chunk
-         std::pair<std::size_t, std::size_t> report = fChunkLoader->LoadChunk(*fChunkTensor, fCurrentRow);
-         fCurrentRow += report.first;
+         std::pair<std::size_t, std::size_t> report = fChunkLoader->LoadChunk(*chunkTensor, start, end);
+
+         {
+            std::lock_guard<std::mutex> lock(fChunkLock);
+            fLoadedChunks.push({chunkIdx, report.second, std::move(chunkTensor)});
+         }
+         fChunkCondition.notify_all();
+      }
+   }
+
+   /// \brief Split the loaded chunks into batches, and give their buffers back to the loading threads.
+   /// Run by the batching thread.
+   void BatchChunks()
+   {
+      while (true) {
+         RLoadedChunk chunk;
+         {
+            std::unique_lock<std::mutex> lock(fChunkLock);
+            fChunkCondition.wait(
+               lock, [this]() { return !fLoadedChunks.empty() || fNumLoadingThreadsRunning == 0 || !IsActive(); });
+            if (fLoadedChunks.empty() || !IsActive())
+               break;
+            chunk = std::move(fLoadedChunks.front());
+            fLoadedChunks.pop();
+         }
 
-         CreateBatches(current_chunk, report.second);
+         CreateBatches(chunk.fChunkIdx, *chunk.fTensor, chunk.fPassedEvents);
 
-         // Stop loading if the number of processed events is smaller than the desired chunk size
-         if (report.first < fChunkSize) {
-            break;
+         {
+            std::lock_guard<std::mutex> lock(fChunkLock);
+            fFreeChunkTensors.emplace_back(std::move(chunk.fTensor));
          }
+         fChunkCondition.notify_all();
       }
 
       fBatchLoader->DeActivate();
    }
 
-   /// \brief Create batches for the current_chunk.
-   /// \param currentChunk
-   /// \param processedEvents
-   void CreateBatches(std::size_t currentChunk, std::size_t processedEvents)
+   /// \brief Create batches for the given chunk.
+   /// \param chunkIdx
+   /// \param chunkTensor
+   /// \param passedEvents
+   void CreateBatches(std::size_t chunkIdx, const TMVA::Experimental::RTensor<float> &chunkTensor,
+                      std::size_t passedEvents)
    {
-
       // Check if the indices in this chunk where already split in train and validations
-      if (fTrainingIdxs.size() > currentChunk) {
-         fBatchLoader->CreateTrainingBatches(*fChunkTensor, fTrainingIdxs[currentChunk], fShuffle);
+      if (fIsSplit[chunkIdx]) {
+         fBatchLoader->CreateTrainingBatches(chunkTensor, fTrainingIdxs[chunkIdx], fShuffle);
       } else {
-         // Create the Validation batches if this is not the first epoch
-         createIdxs(processedEvents);
-         fBatchLoader->CreateTrainingBatches(*fChunkTensor, fTrainingIdxs[currentChunk], fShuffle);
-         fBatchLoader->CreateValidationBatches(*fChunkTensor, fValidationIdxs[currentChunk]);
+         // Create the Validation batches if this is the first epoch
+         createIdxs(chunkIdx, passedEvents);
+         fBatchLoader->CreateTrainingBatches(chunkTensor, fTrainingIdxs[chunkIdx], fShuffle);
+         fBatchLoader->CreateValidationBatches(chunkTensor, fValidationIdxs[chunkIdx]);
       }
    }
 
-   /// \brief plit the events of the current chunk into validation and training events
-   /// \param processedEvents
-   void createIdxs(std::size_t processedEvents)
+   /// \brief Split the events of the given chunk into validation and training events
+   /// \param chunkIdx
+   /// \param passedEvents
+   void createIdxs(std::size_t chunkIdx, std::size_t passedEvents)
    {
-      // Create a vector of number 1..processedEvents
-      std::vector<std::size_t> row_order = std::vector<std::size_t>(processedEvents);
+      // Create a vector of number 1..passedEvents
+      std::vector<std::size_t> row_order = std::vector<std::size_t>(passedEvents);
       std::iota(row_order.begin(), row_order.end(), 0);
 
       if (fShuffle) {
@@ -216,18 +336,20 @@ public:
       }
 
       // calculate the number of events used for validation
-      std::size_t num_validation = ceil(processedEvents * fValidationSplit);
+      std::size_t num_validation = ceil(passedEvents * fValidationSplit);
 
       // Devide the vector into training and validation
-      std::vector<std::size_t> valid_idx({row_order.begin(), row_order.begin() + num_validation});
-      std::vector<std::size_t> train_idx({row_order.begin() + num_validation, row_order.end()});
-
-      fTrainingIdxs.push_back(train_idx);
-      fValidationIdxs.push_back(valid_idx);
+      fValidationIdxs[chunkIdx].assign(row_order.begin(), row_order.begin() + num_validation);
+      fTrainingIdxs[chunkIdx].assign(row_order.begin() + num_validation, row_order.end());
+      fIsSplit[chunkIdx] = true;
    }
 
    void StartValidation() { fBatchLoader->StartValidation(); }
-   bool IsActive() { return fIsActive; }
+   bool IsActive()
+   {
+      std::lock_guard<std::mutex> lock(fIsActiveLock);
+      return fIsActive;
+   }
 };
 
 } // namespace Internal
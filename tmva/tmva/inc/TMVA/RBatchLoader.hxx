@@ -102,11 +102,13 @@ public:
       return fValidationIdx < fValidationBatches.size();
    }
 
-   /// \brief Activate the batchloader so it will accept chunks to batch
+   /// \brief Activate the batchloader so it will accept chunks to batch.
+   /// The training batches left over from a previous epoch that was stopped early are dropped.
    void Activate()
    {
       {
          std::lock_guard<std::mutex> lock(fBatchLock);
+         std::queue<std::unique_ptr<TMVA::Experimental::RTensor<float>>>().swap(fTrainingBatchQueue);
          fIsActive = true;
       }
       fBatchCondition.notify_all();
@@ -6,7 +6,10 @@
 
 #include "TMVA/RTensor.hxx"
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include "ROOT/RVec.hxx"
+#include "TChain.h"
+#include "TFile.h"
 
 #include "ROOT/RLogger.hxx"
 
@@ -115,7 +118,7 @@ class RChunkLoader {
 
 private:
    std::string fTreeName;
-   std::string fFileName;
+   std::vector<std::string> fFileNames;
    std::size_t fChunkSize;
    std::size_t fNumColumns;
 
@@ -123,22 +126,24 @@ private:
    std::string fFilters;
 
    std::vector<std::size_t> fVecSizes;
-   std::size_t fVecPadding;
+   float fVecPadding;
+
+   bool fIsTTree = true;
 
 public:
    /// \brief Constructor for the RChunkLoader
-   /// \param treeName
-   /// \param fileName
+   /// \param treeName name of the TTree or RNTuple
+   /// \param fileNames files of the dataset, which can contain either TTrees or RNTuples
    /// \param chunkSize
    /// \param cols
    /// \param filters
    /// \param vecSizes
    /// \param vecPadding
-   RChunkLoader(const std::string &treeName, const std::string &fileName, const std::size_t chunkSize,
+   RChunkLoader(const std::string &treeName, const std::vector<std::string> &fileNames, const std::size_t chunkSize,
                 const std::vector<std::string> &cols, const std::string &filters = "",
                 const std::vector<std::size_t> &vecSizes = {}, const float vecPadding = 0.0)
       : fTreeName(treeName),
-        fFileName(fileName),
+        fFileNames(fileNames),
         fChunkSize(chunkSize),
         fCols(cols),
         fFilters(filters),
@@ -146,27 +151,60 @@ public:
         fVecPadding(vecPadding),
         fNumColumns(cols.size())
    {
+      std::unique_ptr<TFile> f{TFile::Open(fFileNames.at(0).c_str())};
+      fIsTTree = f && f->Get<TTree>(fTreeName.c_str());
+   }
+
+   /// \brief Returns the number of entries of the dataset
+   std::size_t GetNumEntries() const
+   {
+      if (fIsTTree) {
+         TChain chain(fTreeName.c_str());
+         for (const auto &fileName : fFileNames)
+            chain.Add(fileName.c_str());
+         return chain.GetEntries();
+      }
+      // counting the entries of an RNTuple does not read any column
+      return *ROOT::RDataFrame(fTreeName, fFileNames).Count();
    }
 
-   /// \brief Load a chunk of data using the RChunkLoaderFunctor
-   /// \param chunkTensor
-   /// \param currentRow
+   /// \brief Load the entries [start, end) of the dataset that pass the filters using the RChunkLoaderFunctor.
+   /// The chunks do not depend on each other, so they can be loaded concurrently and in any order.
+   /// \param chunkTensor tensor of at least (end - start) rows
+   /// \param start
+   /// \param end
    /// \return A pair of size_t defining the number of events processed and how many passed all filters
    std::pair<std::size_t, std::size_t>
-   LoadChunk(TMVA::Experimental::RTensor<float> &chunkTensor, const std::size_t currentRow)
+   LoadChunk(TMVA::Experimental::RTensor<float> &chunkTensor, const std::size_t start, const std::size_t end)
    {
       RChunkLoaderFunctor<Args...> func(chunkTensor, fVecSizes, fVecPadding);
 
-      // Create TDataFrame of the chunk
-      // Use RDatasetSpec to start reading at the current row
-      long long start_l = currentRow;
+      if (!fIsTTree) {
+         // RNTuple columns are read by entry number, so the skipped entries are not read and the chunk can be
+         // processed in bulk
+         ROOT::RDataFrame x_rdf(fTreeName, fFileNames);
+         auto x_ranged = x_rdf.Range(start, end);
+         ROOT::RDF::Experimental::EnableBulkExecution(x_rdf);
+         return loadChunk(x_ranged, func);
+      }
+
+      // Use RDatasetSpec to read only the entries of the chunk
       ROOT::RDF::Experimental::RDatasetSpec x_spec =
          ROOT::RDF::Experimental::RDatasetSpec()
-            .AddSample({"", fTreeName, fFileName})
-            .WithGlobalRange({start_l, std::numeric_limits<Long64_t>::max()});
+            .AddSample({"", fTreeName, fFileNames})
+            .WithGlobalRange({static_cast<Long64_t>(start), static_cast<Long64_t>(end)});
 
       ROOT::RDataFrame x_rdf(x_spec);
+      return loadChunk(x_rdf, func);
+   }
 
+private:
+   /// \brief Load the events of the given dataframe into the chunk, applying the filters if any
+   /// \param x_rdf
+   /// \param func
+   /// \return A pair of size_t defining the number of events processed and how many passed all filters
+   std::pair<std::size_t, std::size_t> loadChunk(ROOT::RDF::RNode x_rdf, RChunkLoaderFunctor<Args...> &func)
+   {
       // Load events if filters are given
       if (fFilters.size() > 0) {
          return loadFiltered(x_rdf, func);
@@ -176,46 +214,36 @@ public:
       return loadNonFiltered(x_rdf, func);
    }
 
-private:
    /// \brief Add filters to the RDataFrame and load a chunk of data
    /// \param x_rdf
    /// \param func
    /// \return A pair of size_t defining the number of events processed and how many passed all filters
-   std::pair<std::size_t, std::size_t> loadFiltered(ROOT::RDataFrame &x_rdf, RChunkLoaderFunctor<Args...> &func)
+   std::pair<std::size_t, std::size_t> loadFiltered(ROOT::RDF::RNode &x_rdf, RChunkLoaderFunctor<Args...> &func)
    {
       // Add the given filters to the RDataFrame
       auto x_filter = x_rdf.Filter(fFilters, "RBatchGenerator_Filter");
-
-      // add range to the DataFrame
-      auto x_ranged = x_filter.Range(fChunkSize);
-      auto myReport = x_ranged.Report();
+      auto myReport = x_filter.Report();
 
       // load data
-      x_ranged.Foreach(func, fCols);
+      x_filter.Foreach(func, fCols);
 
       // Use the report to gather the number of events processed and passed.
-      // passed_events is used to determine the starting event of the next chunk
-      // processed_events is used to determine if the end of the database is reached.
       std::size_t processed_events = myReport.begin()->GetAll();
       std::size_t passed_events = (myReport.end() - 1)->GetPass();
 
       return std::make_pair(processed_events, passed_events);
    }
 
-   /// \brief Loop over the events in the dataframe untill either the end of the dataframe
-   /// is reached, or a full chunk is loaded
+   /// \brief Loop over the events in the dataframe and load them into the chunk
    /// \param x_rdf
    /// \param func
    /// \return A pair of size_t defining the number of events processed and how many passed all filters
-   std::pair<std::size_t, std::size_t> loadNonFiltered(ROOT::RDataFrame &x_rdf, RChunkLoaderFunctor<Args...> &func)
+   std::pair<std::size_t, std::size_t> loadNonFiltered(ROOT::RDF::RNode &x_rdf, RChunkLoaderFunctor<Args...> &func)
    {
-      // add range
-      auto x_ranged = x_rdf.Range(fChunkSize);
-      // auto x_ranged = x_rdf.Range(currentRow, currentRow + fChunkSize);
-      auto myCount = x_ranged.Count();
+      auto myCount = x_rdf.Count();
 
       // load data
-      x_ranged.Foreach(func, fCols);
+      x_rdf.Foreach(func, fCols);
 
       // get loading info
       std::size_t processed_events = myCount.GetValue();
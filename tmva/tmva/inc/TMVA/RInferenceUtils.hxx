@@ -1,7 +1,18 @@
 #ifndef TMVA_RINFERENCEUTILS
 #define TMVA_RINFERENCEUTILS
 
+#include "TMVA/RTensor.hxx"
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "ROOT/RResultPtr.hxx"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <utility> // std::forward, std::index_sequence
+#include <vector>
+
+class TTreeReader;
 
 namespace TMVA {
 namespace Experimental {
@@ -25,6 +36,115 @@ public:
    }
 };
 
+/// Action helper of ComputeInBatches
+template <typename I, typename T, typename F>
+class ComputeBatchesHelper;
+
+template <std::size_t... N, typename T, typename F>
+class ComputeBatchesHelper<std::index_sequence<N...>, T, F>
+   : public ROOT::Detail::RDF::RActionImpl<ComputeBatchesHelper<std::index_sequence<N...>, T, F>> {
+   template <std::size_t Idx>
+   using AlwaysT = T;
+
+public:
+   using Result_t = RTensor<T>;
+
+private:
+   /// Entries buffered by a processing slot, and outputs of its inferences
+   struct SlotBuffer {
+      std::vector<T> fInputs;           ///< inputs of the entries not yet evaluated, row-major
+      std::vector<ULong64_t> fEntries;  ///< entry numbers of all the evaluated and buffered entries
+      std::vector<T> fOutputs;          ///< outputs of the evaluated entries, row-major
+   };
+
+   F fModel;
+   std::size_t fBatchSize;
+   std::size_t fNOutputs = 0;
+   std::vector<SlotBuffer> fBuffers;
+   std::shared_ptr<Result_t> fResult;
+
+   /// Evaluate the model on the entries buffered by a slot
+   void ComputeBuffer(SlotBuffer &buffer)
+   {
+      const std::size_t nRows = buffer.fInputs.size() / sizeof...(N);
+      if (nRows == 0)
+         return;
+      RTensor<T> x(buffer.fInputs.data(), {nRows, sizeof...(N)});
+      auto y = fModel.Compute(x);
+      const std::size_t nOutputs = y.GetSize() / nRows;
+      if (y.GetShape().empty() || y.GetShape()[0] != nRows || nOutputs == 0 ||
+          (fNOutputs != 0 && nOutputs != fNOutputs))
+         throw std::runtime_error("ComputeInBatches: the model returned an output of unexpected shape");
+      fNOutputs = nOutputs;
+      // the outputs of the models are not necessarily row-major
+      const auto &strides = y.GetStrides();
+      const std::size_t rowStride = strides[0];
+      const std::size_t colStride = strides.size() > 1 ? strides[1] : 1;
+      for (std::size_t i = 0; i < nRows; ++i)
+         for (std::size_t j = 0; j < nOutputs; ++j)
+            buffer.fOutputs.push_back(y.GetData()[i * rowStride + j * colStride]);
+      buffer.fInputs.clear();
+   }
+
+public:
+   ComputeBatchesHelper(F &&f, std::size_t batchSize, unsigned int nSlots)
+      : fModel(std::forward<F>(f)), fBatchSize(std::max<std::size_t>(batchSize, 1)),
+        fBuffers(nSlots), fResult(std::make_shared<Result_t>(typename Result_t::Shape_t{0, 0}))
+   {
+      for (auto &buffer : fBuffers)
+         buffer.fInputs.reserve(fBatchSize * sizeof...(N));
+   }
+   ComputeBatchesHelper(ComputeBatchesHelper &&) = default;
+   ComputeBatchesHelper(const ComputeBatchesHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize() {}
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, ULong64_t entry, AlwaysT<N>... args)
+   {
+      auto &buffer = fBuffers[slot];
+      buffer.fEntries.push_back(entry);
+      buffer.fInputs.insert(buffer.fInputs.end(), {args...});
+      if (buffer.fInputs.size() == fBatchSize * sizeof...(N))
+         ComputeBuffer(buffer);
+   }
+
+   /// Evaluate the last partial batches and gather the outputs of all slots in the order of the entries
+   void Finalize()
+   {
+      std::vector<std::pair<ULong64_t, const T *>> rows;
+      for (auto &buffer : fBuffers) {
+         ComputeBuffer(buffer);
+         for (std::size_t i = 0; i < buffer.fEntries.size(); ++i)
+            rows.emplace_back(buffer.fEntries[i], buffer.fOutputs.data() + i * fNOutputs);
+      }
+      std::sort(rows.begin(), rows.end(),
+                [](const std::pair<ULong64_t, const T *> &a, const std::pair<ULong64_t, const T *> &b) {
+                   return a.first < b.first;
+                });
+      Result_t result({rows.size(), fNOutputs});
+      for (std::size_t i = 0; i < rows.size(); ++i)
+         std::copy(rows[i].second, rows[i].second + fNOutputs, result.GetData() + i * fNOutputs);
+      *fResult = result;
+      fBuffers.clear();
+   }
+
+   std::string GetActionName() { return "ComputeInBatches"; }
+
+   /// Book the action on the given columns, adding the entry number used to order the outputs
+   template <typename Node>
+   static ROOT::RDF::RResultPtr<Result_t>
+   Book(Node &df, ComputeBatchesHelper &&helper, const std::vector<std::string> &columns)
+   {
+      std::vector<std::string> bookedColumns{"rdfentry_"};
+      bookedColumns.insert(bookedColumns.end(), columns.begin(), columns.end());
+      return df.template Book<ULong64_t, AlwaysT<N>...>(std::move(helper), bookedColumns);
+   }
+};
+
 } // namespace Internal
 
 /// Helper to pass TMVA model to RDataFrame.Define nodes
@@ -34,6 +154,30 @@ auto Compute(F &&f) -> Internal::ComputeHelper<std::make_index_sequence<N>, T, F
    return Internal::ComputeHelper<std::make_index_sequence<N>, T, F>(std::forward<F>(f));
 }
 
+/// Evaluate a TMVA model on the entries of an RDataFrame, in batches of entries.
+///
+/// Each processing slot copies the N input columns (of type T) of its entries in a buffer, and calls
+/// `model.Compute(RTensor<T>)` on batches of batchSize entries, which avoids the per-entry calls of a Define with
+/// Compute and lets the model vectorize the evaluation of the batch (e.g. RBDT). The model is shared between the
+/// slots (and, as for Compute, is only referenced if passed as an lvalue), hence its Compute method must be
+/// thread-safe for multi-threaded event loops. The action returns a tensor with the outputs of the entries in the
+/// order of their entry numbers, of shape [entries, outputs].
+///
+/// ~~~{.cpp}
+/// RBDT bdt("myModel", "model.root");
+/// auto y = ComputeInBatches<4, float>(df, bdt, {"var1", "var2", "var3", "var4"});
+/// ~~~
+template <std::size_t N, typename T, typename F, typename Node>
+ROOT::RDF::RResultPtr<RTensor<T>>
+ComputeInBatches(Node &&df, F &&model, const std::vector<std::string> &columns, std::size_t batchSize = 256)
+{
+   if (columns.size() != N)
+      throw std::runtime_error("ComputeInBatches: expected " + std::to_string(N) + " input columns, got " +
+                               std::to_string(columns.size()));
+   using Helper_t = Internal::ComputeBatchesHelper<std::make_index_sequence<N>, T, F>;
+   return Helper_t::Book(df, Helper_t(std::forward<F>(model), batchSize, df.GetNSlots()), columns);
+}
+
 } // namespace Experimental
 } // namespace TMVA
 
@@ -0,0 +1,108 @@
+// @(#)root/tmva $Id$
+
+/**********************************************************************************
+ * Project: TMVA - a Root-integrated toolkit for multivariate data analysis       *
+ * Package: TMVA                                                                  *
+ * Class  : TMVA::BinnedEventSample                                               *
+ *                                                                                *
+ *                                                                                *
+ * Description:                                                                   *
+ *      Training events with their input variables binned in quantiles, stored    *
+ *      by variable, for the histogram based training of decision trees           *
+ *                                                                                *
+ * Copyright (c) 2005-2011:                                                       *
+ *      CERN, Switzerland                                                         *
+ *      U. of Victoria, Canada                                                    *
+ *      MPI-K Heidelberg, Germany                                                 *
+ *      U. of Bonn, Germany                                                       *
+ *                                                                                *
+ * Redistribution and use in source and binary forms, with or without             *
+ * modification, are permitted according to the terms listed in LICENSE           *
+ * (http://mva.sourceforge.net/license.txt)                                       *
+ *                                                                                *
+ **********************************************************************************/
+
+/*! \class TMVA::BinnedEventSample
+\ingroup TMVA
+
+Training events with their input variables binned in quantiles.
+
+The bins are computed once before the training of a forest, from the
+quantiles of each variable (or from its distinct values, if there are
+not more of them than bins), and the bin index of every event is stored
+per variable in a contiguous column. The decision trees can then fill
+the histograms of their nodes reading only these small integer columns,
+and scan the cuts at the bin edges, instead of recomputing a binning of
+the variables in every node. The edges are values of the variables in
+the sample, hence an event goes to the right of a cut at an edge
+(DecisionTreeNode::GoesRight) if and only if its bin is above the cut.
+
+*/
+
+#include "TMVA/BinnedEventSample.h"
+
+#include "TMVA/Config.h"
+#include "TMVA/Event.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace {
+   // maximal number of events used to compute the quantiles of a variable
+   const UInt_t kMaxQuantileEvents = 200000;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// bin the variables of the events in at most maxBins bins each
+
+TMVA::BinnedEventSample::BinnedEventSample( const std::vector<const TMVA::Event*> & events, UInt_t nvars,
+                                            UInt_t maxBins )
+   : fCutValues(nvars),
+     fBins(nvars)
+{
+   maxBins = std::max(2u, std::min<UInt_t>(maxBins, std::numeric_limits<UShort_t>::max() + 1));
+   const UInt_t nevents = events.size();
+   fRows.reserve(nevents);
+   for (UInt_t iev=0; iev<nevents; iev++) fRows.emplace(events[iev], iev);
+
+   // the quantiles are computed from a regular subset of the events for large samples
+   const UInt_t stride = nevents / kMaxQuantileEvents + 1;
+
+   auto binVariable = [&](UInt_t ivar) {
+      std::vector<Float_t> values;
+      values.reserve(nevents / stride + 1);
+      for (UInt_t iev=0; iev<nevents; iev+=stride) values.push_back(events[iev]->GetValueFast(ivar));
+      std::sort(values.begin(), values.end());
+
+      // the edges are values of the sample above its minimum, so that no bin is empty
+      std::vector<Float_t> &cuts = fCutValues[ivar];
+      std::vector<Float_t> distinct;
+      std::unique_copy(values.begin(), values.end(), std::back_inserter(distinct));
+      if (distinct.size() <= maxBins) {
+         cuts.assign(distinct.begin() + 1, distinct.end());
+      } else {
+         for (UInt_t ibin=1; ibin<maxBins; ibin++) {
+            const Float_t cut = values[ULong64_t(ibin) * values.size() / maxBins];
+            if (cut > values.front() && (cuts.empty() || cut > cuts.back())) cuts.push_back(cut);
+         }
+      }
+
+      std::vector<UShort_t> &bins = fBins[ivar];
+      bins.resize(nevents);
+      for (UInt_t iev=0; iev<nevents; iev++) {
+         const Float_t val = events[iev]->GetValueFast(ivar);
+         bins[iev] = std::upper_bound(cuts.begin(), cuts.end(), val) - cuts.begin();
+      }
+   };
+   TMVA::Config::Instance().GetThreadExecutor().Foreach(binVariable, ROOT::TSeqU(nvars));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// row of an event in the columns of the bin indices, -1 if the event is not in the sample
+
+Int_t TMVA::BinnedEventSample::GetRow( const TMVA::Event* event ) const
+{
+   auto it = fRows.find(event);
+   return it == fRows.end() ? -1 : Int_t(it->second);
+}
@@ -86,6 +86,27 @@ namespace TMVA {
    }
 }
 
+namespace {
+   // mix the events of class cls into the events of the classes before it: one event of the class is
+   // put after every cls events of the mixed vector, as long as there are enough of them; the rest of
+   // the events of the class is then appended. The mixing is done in a single pass (in linear time).
+   void InterleaveEvents( std::vector<TMVA::Event*>& mixed, const std::vector<TMVA::Event*>& events, UInt_t cls )
+   {
+      std::vector<TMVA::Event*> result;
+      result.reserve( mixed.size() + events.size() );
+      auto itMixed = mixed.begin();
+      auto itEvent = events.begin();
+      while (itEvent != events.end() && UInt_t(mixed.end() - itMixed) >= cls) {
+         result.insert( result.end(), itMixed, itMixed + cls );
+         itMixed += cls;
+         result.push_back( *itEvent++ );
+      }
+      result.insert( result.end(), itMixed, mixed.end() );
+      result.insert( result.end(), itEvent, events.end() );
+      mixed.swap( result );
+   }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// constructor
@@ -1390,46 +1411,16 @@ TMVA::DataSetFactory::MixEvents( DataSetInfo& dsi,
             Log() << kINFO << Form("Dataset[%s] : ",dsi.GetName()) << "Testing sample: You are trying to mix events in alternate mode although the classes have different event numbers. This works but the alternation stops at the last event of the smaller class."<<Endl;
          }
       }
-      typedef EventVector::iterator EvtVecIt;
-      EvtVecIt itEvent, itEventEnd;
-
       // insert first class
       Log() << kDEBUG << "insert class 0 into training and test vector" << Endl;
       trainingEventVector->insert( trainingEventVector->end(), tmpEventVector[Types::kTraining].at(0).begin(), tmpEventVector[Types::kTraining].at(0).end() );
       testingEventVector->insert( testingEventVector->end(),   tmpEventVector[Types::kTesting].at(0).begin(),  tmpEventVector[Types::kTesting].at(0).end() );
 
       // insert other classes
-      EvtVecIt itTarget;
       for( UInt_t cls = 1; cls < dsi.GetNClasses(); ++cls ){
          Log() << kDEBUG << Form("Dataset[%s] : ",dsi.GetName())<< "insert class " << cls << Endl;
-         // training vector
-         itTarget = trainingEventVector->begin() - 1; // start one before begin
-         // loop over source
-         for( itEvent = tmpEventVector[Types::kTraining].at(cls).begin(), itEventEnd = tmpEventVector[Types::kTraining].at(cls).end(); itEvent != itEventEnd; ++itEvent ){
-            //            if( std::distance( itTarget, trainingEventVector->end()) < Int_t(cls+1) ) {
-            if( (trainingEventVector->end() - itTarget) < Int_t(cls+1) ) {
-               itTarget = trainingEventVector->end();
-               trainingEventVector->insert( itTarget, itEvent, itEventEnd ); // fill in the rest without mixing
-               break;
-            }else{
-               itTarget += cls+1;
-               trainingEventVector->insert( itTarget, (*itEvent) ); // fill event
-            }
-         }
-         // testing vector
-         itTarget = testingEventVector->begin() - 1;
-         // loop over source
-         for( itEvent = tmpEventVector[Types::kTesting].at(cls).begin(), itEventEnd = tmpEventVector[Types::kTesting].at(cls).end(); itEvent != itEventEnd; ++itEvent ){
-            //             if( std::distance( itTarget, testingEventVector->end()) < Int_t(cls+1) ) {
-            if( ( testingEventVector->end() - itTarget ) < Int_t(cls+1) ) {
-               itTarget = testingEventVector->end();
-               testingEventVector->insert( itTarget, itEvent, itEventEnd ); // fill in the rest without mixing
-               break;
-            }else{
-               itTarget += cls+1;
-               testingEventVector->insert( itTarget, (*itEvent) ); // fill event
-            }
-         }
+         InterleaveEvents( *trainingEventVector, tmpEventVector[Types::kTraining].at(cls), cls );
+         InterleaveEvents( *testingEventVector,  tmpEventVector[Types::kTesting].at(cls),  cls );
       }
    }else{
       for( UInt_t cls = 0; cls < dsi.GetNClasses(); ++cls ){
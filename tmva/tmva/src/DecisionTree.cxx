@@ -61,6 +61,8 @@ more signal respective background events from the training sample.
 #include <algorithm>
 #include <vector>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <cassert>
 
 #include "TRandom3.h"
@@ -70,6 +72,7 @@ more signal respective background events from the training sample.
 #include "TMVA/MsgLogger.h"
 #include "TMVA/DecisionTree.h"
 #include "TMVA/DecisionTreeNode.h"
+#include "TMVA/BinnedEventSample.h"
 #include "TMVA/BinarySearchTree.h"
 
 #include "TMVA/Tools.h"
@@ -137,7 +140,8 @@ TMVA::DecisionTree::DecisionTree():
    fSigClass       (0),
    fTreeID         (0),
    fAnalysisType   (Types::kClassification),
-   fDataSetInfo    (NULL)
+   fDataSetInfo    (NULL),
+   fBinnedSample   (NULL)
 
 {}
 
@@ -174,7 +178,8 @@ TMVA::DecisionTree::DecisionTree( TMVA::SeparationBase *sepType, Float_t minSize
    fSigClass       (cls),
    fTreeID         (treeID),
    fAnalysisType   (Types::kClassification),
-   fDataSetInfo    (dataInfo)
+   fDataSetInfo    (dataInfo),
+   fBinnedSample   (NULL)
 {
    if (sepType == NULL) { // it is interpreted as a regression tree, where
                           // currently the separation type (simple least square)
@@ -221,7 +226,8 @@ TMVA::DecisionTree::DecisionTree( const DecisionTree &d ):
    fSigClass   (d.fSigClass),
    fTreeID     (d.fTreeID),
    fAnalysisType(d.fAnalysisType),
-   fDataSetInfo    (d.fDataSetInfo)
+   fDataSetInfo    (d.fDataSetInfo),
+   fBinnedSample   (NULL)
 {
    this->SetRoot( new TMVA::DecisionTreeNode ( *((DecisionTreeNode*)(d.GetRoot())) ) );
    this->SetParentTreeInNodes();
@@ -377,6 +383,7 @@ struct BuildNodeInfo{
 UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & eventSample,
                                       TMVA::DecisionTreeNode *node)
 {
+   if (node==NULL && fBinnedSample && fNCuts > 0 && !fUseFisherCuts) return BuildTreeHistogram(eventSample);
    if (node==NULL) {
       //start with the root node
       node = new TMVA::DecisionTreeNode();
@@ -634,6 +641,7 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
 UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & eventSample,
                                       TMVA::DecisionTreeNode *node)
 {
+   if (node==NULL && fBinnedSample && fNCuts > 0 && !fUseFisherCuts) return BuildTreeHistogram(eventSample);
    if (node==NULL) {
       //start with the root node
       node = new TMVA::DecisionTreeNode();
@@ -873,6 +881,325 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
 
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// Histogram based training of the decision tree
+//
+// With a BinnedEventSample (see SetBinnedSample) the variables of the training events are binned
+// once before the training of the forest, and every node is split at the best bin edge found in
+// the histograms of the sums of weights (and targets) of its events in the bins of each variable.
+// The histograms are filled reading only the columns of bin indices, in contiguous chunks of the
+// events of the node processed in parallel. Only the daughter node with less events fills its
+// histograms: the ones of the other daughter are the difference with the histograms of the mother.
+
+namespace {
+   // minimal number of events in a chunk filled in parallel in the histogram based training
+   const UInt_t kMinHistogramChunkSize = 10000;
+}
+
+struct TMVA::DecisionTree::HistogramBin {
+   Double_t fS = 0;       ///< sum of the weights of the signal events
+   Double_t fB = 0;       ///< sum of the weights of the background events
+   Double_t fNS = 0;      ///< number of signal events
+   Double_t fNB = 0;      ///< number of background events
+   Double_t fTarget = 0;  ///< sum of the weighted targets
+   Double_t fTarget2 = 0; ///< sum of the weighted squared targets
+
+   HistogramBin & operator+=( const HistogramBin & other ) {
+      fS += other.fS;
+      fB += other.fB;
+      fNS += other.fNS;
+      fNB += other.fNB;
+      fTarget += other.fTarget;
+      fTarget2 += other.fTarget2;
+      return *this;
+   }
+   HistogramBin & operator-=( const HistogramBin & other ) {
+      fS -= other.fS;
+      fB -= other.fB;
+      fNS -= other.fNS;
+      fNB -= other.fNB;
+      fTarget -= other.fTarget;
+      fTarget2 -= other.fTarget2;
+      // the numbers of events are exact, remove the rounding errors of the sums of empty bins
+      if (fNS == 0) fS = 0;
+      if (fNB == 0) fB = 0;
+      if (fNS + fNB == 0) fTarget = fTarget2 = 0;
+      return *this;
+   }
+};
+
+struct TMVA::DecisionTree::HistogramSample {
+   std::vector<UInt_t>   fRow;       ///< row of the events in the binned sample
+   std::vector<Double_t> fWeight;    ///< weight of the events
+   std::vector<Double_t> fOrgWeight; ///< unboosted weight of the events
+   std::vector<Char_t>   fIsSignal;  ///< whether the events are of the signal class
+   std::vector<Double_t> fTarget;    ///< target of the events, for regression
+   std::vector<UInt_t>   fOffset;    ///< first bin of the histogram of each variable
+   UInt_t fNBins = 0;                ///< total number of bins of the histograms of all variables
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// building the decision tree from the histograms of the binned variables of
+/// the events (returns the number of nodes)
+
+UInt_t TMVA::DecisionTree::BuildTreeHistogram( const EventConstList & eventSample )
+{
+   const UInt_t nevents = eventSample.size();
+   if (nevents == 0) Log() << kFATAL << ":<BuildTreeHistogram> eventsample Size == 0 " << Endl;
+   if (fNvars==0) fNvars = eventSample[0]->GetNVariables();
+   if (fBinnedSample->GetNVars() != fNvars) {
+      Log() << kFATAL << "<BuildTreeHistogram> the binned sample has " << fBinnedSample->GetNVars()
+            << " variables instead of " << fNvars << Endl;
+   }
+   fVariableImportance.resize(fNvars);
+
+   //start with the root node
+   TMVA::DecisionTreeNode *node = new TMVA::DecisionTreeNode();
+   fNNodes = 1;
+   this->SetRoot(node);
+   this->GetRoot()->SetPos('s');
+   this->GetRoot()->SetDepth(0);
+   this->GetRoot()->SetParentTree(this);
+   fMinSize = fMinNodeSize/100. * nevents;
+
+   // the events of this tree (with the current boost weights) by column
+   HistogramSample sample;
+   sample.fRow.resize(nevents);
+   sample.fWeight.resize(nevents);
+   sample.fOrgWeight.resize(nevents);
+   sample.fIsSignal.resize(nevents);
+   if (DoRegression()) sample.fTarget.resize(nevents);
+   for (UInt_t iev=0; iev<nevents; iev++) {
+      const TMVA::Event* evt = eventSample[iev];
+      const Int_t row = fBinnedSample->GetRow(evt);
+      if (row < 0) {
+         Log() << kFATAL << "<BuildTreeHistogram> event " << iev
+               << " of the training sample is not in the binned sample" << Endl;
+      }
+      sample.fRow[iev] = row;
+      sample.fWeight[iev] = evt->GetWeight();
+      sample.fOrgWeight[iev] = evt->GetOriginalWeight();
+      sample.fIsSignal[iev] = (evt->GetClass() == fSigClass);
+      if (DoRegression()) sample.fTarget[iev] = evt->GetTarget(0);
+   }
+   sample.fOffset.resize(fNvars);
+   for (UInt_t ivar=0; ivar<fNvars; ivar++) {
+      sample.fOffset[ivar] = sample.fNBins;
+      sample.fNBins += fBinnedSample->GetNBins(ivar);
+   }
+
+   std::vector<UInt_t> events(nevents);
+   std::iota(events.begin(), events.end(), 0);
+   std::vector<HistogramBin> hist;
+   FillNodeHistogram(sample, events, hist);
+   TrainNodeHistogram(sample, node, events, hist);
+
+   return fNNodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// fill the histograms of all the variables for the events of a node
+
+void TMVA::DecisionTree::FillNodeHistogram( const HistogramSample & sample, const std::vector<UInt_t> & events,
+                                            std::vector<HistogramBin> & hist ) const
+{
+   auto &executor = TMVA::Config::Instance().GetThreadExecutor();
+   const UInt_t nChunks = TMath::Max(1u, TMath::Min(executor.GetPoolSize(),
+                                                    UInt_t(events.size() / kMinHistogramChunkSize)));
+   std::vector< std::vector<HistogramBin> > chunkHist(nChunks);
+   const Bool_t doRegression = DoRegression();
+
+   auto fillChunk = [&](UInt_t ichunk) {
+      const size_t start = events.size() * ichunk / nChunks;
+      const size_t end   = events.size() * (ichunk + 1) / nChunks;
+      chunkHist[ichunk].resize(sample.fNBins);
+      for (UInt_t ivar=0; ivar<fNvars; ivar++) {
+         const UShort_t *bins = fBinnedSample->GetBins(ivar);
+         HistogramBin *varHist = chunkHist[ichunk].data() + sample.fOffset[ivar];
+         for (size_t i=start; i<end; i++) {
+            const UInt_t iev = events[i];
+            const Double_t weight = sample.fWeight[iev];
+            HistogramBin &bin = varHist[bins[sample.fRow[iev]]];
+            if (sample.fIsSignal[iev]) {
+               bin.fS += weight;
+               bin.fNS += 1;
+            }
+            else {
+               bin.fB += weight;
+               bin.fNB += 1;
+            }
+            if (doRegression) {
+               const Double_t tgt = sample.fTarget[iev];
+               bin.fTarget += weight*tgt;
+               bin.fTarget2 += weight*tgt*tgt;
+            }
+         }
+      }
+   };
+   if (nChunks > 1) executor.Foreach(fillChunk, ROOT::TSeqU(nChunks));
+   else fillChunk(0);
+
+   hist.swap(chunkHist[0]);
+   for (UInt_t ichunk=1; ichunk<nChunks; ichunk++) {
+      for (UInt_t ibin=0; ibin<sample.fNBins; ibin++) hist[ibin] += chunkHist[ichunk][ibin];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// split a node at the bin edge giving the best separation gain and build
+/// recursively its daughter nodes; the events and histograms of the node are
+/// reused for the daughters
+
+void TMVA::DecisionTree::TrainNodeHistogram( const HistogramSample & sample, TMVA::DecisionTreeNode *node,
+                                             std::vector<UInt_t> & events, std::vector<HistogramBin> & hist )
+{
+   // the totals of the node are the sums of the histogram of any variable
+   HistogramBin total;
+   for (UInt_t ibin=0; ibin<fBinnedSample->GetNBins(0); ibin++) total += hist[ibin];
+   Double_t sub=0, bub=0; // unboosted!
+   for (UInt_t iev : events) (sample.fIsSignal[iev] ? sub : bub) += sample.fOrgWeight[iev];
+   const Double_t s = total.fS;
+   const Double_t b = total.fB;
+
+   node->SetNSigEvents(s);
+   node->SetNBkgEvents(b);
+   node->SetNSigEvents_unweighted(total.fNS);
+   node->SetNBkgEvents_unweighted(total.fNB);
+   node->SetNSigEvents_unboosted(sub);
+   node->SetNBkgEvents_unboosted(bub);
+   node->SetPurity();
+   if (node == this->GetRoot()) {
+      node->SetNEvents(s+b);
+      node->SetNEvents_unweighted(total.fNS+total.fNB);
+      node->SetNEvents_unboosted(sub+bub);
+   }
+   if (DoRegression()) {
+      const Double_t mean = total.fTarget/(s+b);
+      const Double_t mean2 = total.fTarget2/(s+b);
+      node->SetSeparationIndex(fRegType->GetSeparationIndex(s+b,total.fTarget,total.fTarget2));
+      node->SetResponse(mean);
+      if (almost_equal_double(mean2, mean*mean)) node->SetRMS(0);
+      else node->SetRMS(TMath::Sqrt(mean2 - mean*mean));
+   }
+   else {
+      node->SetSeparationIndex(fSepType->GetSeparationIndex(s,b));
+   }
+
+   // find the best cut, the events of the bins up to cutBin being below the cut
+   Double_t separationGain = -1;
+   Int_t    mxVar = -1;
+   UInt_t   cutBin = 0;
+   HistogramBin below;
+   if ((events.size() >= 2*fMinSize && s+b >= 2*fMinSize) && node->GetDepth() < fMaxDepth
+       && ( ( s!=0 && b !=0 && !DoRegression()) || ( (s+b)!=0 && DoRegression()) ) ) {
+
+      std::unique_ptr<Bool_t[]> useVariable(new Bool_t[fNvars]);
+      std::unique_ptr<UInt_t[]> mapVariable(new UInt_t[fNvars]);
+      if (fRandomisedTree) { // choose for each node splitting a random subset of variables to choose from
+         UInt_t tmp=fUseNvars;
+         GetRandomisedVariables(useVariable.get(),mapVariable.get(),tmp);
+      }
+      else {
+         std::fill(useVariable.get(), useVariable.get()+fNvars, kTRUE);
+      }
+
+      for (UInt_t ivar=0; ivar<fNvars; ivar++) {
+         if (!useVariable[ivar]) continue;
+         const HistogramBin *varHist = hist.data() + sample.fOffset[ivar];
+         HistogramBin sel;
+         for (UInt_t ibin=0; ibin+1<fBinnedSample->GetNBins(ivar); ibin++) { // the last bin contains "all events"
+            sel += varHist[ibin];
+            // both daughter nodes need the minimal number of events, unweighted and weighted
+            const Double_t nSel = sel.fNS + sel.fNB;
+            const Double_t nRest = total.fNS + total.fNB - nSel;
+            const Double_t wSel = sel.fS + sel.fB;
+            const Double_t wRest = s + b - wSel;
+            if (nSel == 0 || nRest == 0 || nSel < fMinSize || nRest < fMinSize || wSel < fMinSize || wRest < fMinSize)
+               continue;
+            Double_t sepTmp;
+            if (DoRegression()) {
+               sepTmp = fRegType->GetSeparationGain(wSel, sel.fTarget, sel.fTarget2,
+                                                    s+b, total.fTarget, total.fTarget2);
+            } else {
+               sepTmp = fSepType->GetSeparationGain(sel.fS, sel.fB, s, b);
+            }
+            if (separationGain < sepTmp) {
+               separationGain = sepTmp;
+               mxVar = ivar;
+               cutBin = ibin;
+               below = sel;
+            }
+         }
+      }
+   }
+
+   if (mxVar < 0 || separationGain < std::numeric_limits<double>::epsilon()) { // it is a leaf node
+      if (!DoRegression()) {
+         if (node->GetPurity() > fNodePurityLimit) node->SetNodeType(1);
+         else node->SetNodeType(-1);
+      }
+      if (node->GetDepth() > this->GetTotalTreeDepth()) this->SetTotalTreeDepth(node->GetDepth());
+      return;
+   }
+
+   Bool_t cutType = kTRUE;
+   if (!DoRegression()) cutType = (below.fS/s > below.fB/b);
+   node->SetSelector((UInt_t)mxVar);
+   node->SetCutValue(fBinnedSample->GetCutValue(mxVar, cutBin));
+   node->SetCutType(cutType);
+   node->SetSeparationGain(separationGain);
+   node->SetNFisherCoeff(0);
+   fVariableImportance[mxVar] += separationGain*separationGain * (s+b) * (s+b);
+
+   // the events below the cut go to the left for the cut type kTRUE (see DecisionTreeNode::GoesRight)
+   std::vector<UInt_t> leftEvents; leftEvents.reserve(events.size());
+   std::vector<UInt_t> rightEvents; rightEvents.reserve(events.size());
+   Double_t nRight=0, nLeft=0;
+   Double_t nRightUnBoosted=0, nLeftUnBoosted=0;
+   const UShort_t *bins = fBinnedSample->GetBins(mxVar);
+   for (UInt_t iev : events) {
+      if ((bins[sample.fRow[iev]] > cutBin) == cutType) {
+         rightEvents.push_back(iev);
+         nRight += sample.fWeight[iev];
+         nRightUnBoosted += sample.fOrgWeight[iev];
+      }
+      else {
+         leftEvents.push_back(iev);
+         nLeft += sample.fWeight[iev];
+         nLeftUnBoosted += sample.fOrgWeight[iev];
+      }
+   }
+   std::vector<UInt_t>().swap(events);
+
+   // fill the histograms of the smaller daughter node, and subtract them from the ones of this node
+   const Bool_t rightIsSmaller = rightEvents.size() < leftEvents.size();
+   std::vector<HistogramBin> smallerHist;
+   FillNodeHistogram(sample, rightIsSmaller ? rightEvents : leftEvents, smallerHist);
+   for (UInt_t ibin=0; ibin<sample.fNBins; ibin++) hist[ibin] -= smallerHist[ibin];
+   std::vector<HistogramBin> &rightHist = rightIsSmaller ? smallerHist : hist;
+   std::vector<HistogramBin> &leftHist = rightIsSmaller ? hist : smallerHist;
+
+   // continue building daughter nodes for the left and the right eventsample
+   TMVA::DecisionTreeNode *rightNode = new TMVA::DecisionTreeNode(node,'r');
+   fNNodes++;
+   rightNode->SetNEvents(nRight);
+   rightNode->SetNEvents_unboosted(nRightUnBoosted);
+   rightNode->SetNEvents_unweighted(rightEvents.size());
+
+   TMVA::DecisionTreeNode *leftNode = new TMVA::DecisionTreeNode(node,'l');
+   fNNodes++;
+   leftNode->SetNEvents(nLeft);
+   leftNode->SetNEvents_unboosted(nLeftUnBoosted);
+   leftNode->SetNEvents_unweighted(leftEvents.size());
+
+   node->SetNodeType(0);
+   node->SetLeft(leftNode);
+   node->SetRight(rightNode);
+
+   this->TrainNodeHistogram(sample, rightNode, rightEvents, rightHist);
+   this->TrainNodeHistogram(sample, leftNode, leftEvents, leftHist);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// fill the existing the decision tree structure by filling event
 /// in from the top node and see where they happen to end up
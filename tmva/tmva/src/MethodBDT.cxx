@@ -181,6 +181,7 @@ TMVA::MethodBDT::MethodBDT( const TString& jobName,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -236,6 +237,7 @@ TMVA::MethodBDT::MethodBDT( DataSetInfo& theData,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -311,6 +313,8 @@ Bool_t TMVA::MethodBDT::HasAnalysisType( Types::EAnalysisType type, UInt_t numbe
 ///  - nCuts:           the number of steps in the optimisation of the cut for a node (if < 0, then
 ///                  step size is determined by the events)
 ///  - UseFisherCuts:   use multivariate splits using the Fisher criterion
+///  - HistogramSplits: bin the variables once before the training in (at most nCuts+1) quantiles, and
+///                  find the node splits in the histograms of these bins
 ///  - UseYesNoLeaf     decide if the classification is done simply by the node type, or the S/B
 ///                  (from the training) in the leaf node
 ///  - NodePurityLimit  the minimum purity to classify a node as a signal node (used in pruning and boosting to determine
@@ -412,6 +416,7 @@ void TMVA::MethodBDT::DeclareOptions()
    AddPreDefVal(TString("AbsoluteDeviation"));
    AddPreDefVal(TString("LeastSquares"));
 
+   DeclareOptionRef(fHistogramSplits=kFALSE, "HistogramSplits", "Bin the variables once before the training in nCuts+1 quantiles and find the node splits in the histograms of these bins (faster for large samples)");
    DeclareOptionRef(fHuberQuantile = 0.7, "HuberQuantile", "In the Huber loss function this is the quantile that separates the core from the tails in the residuals distribution.");
 
    DeclareOptionRef(fDoBoostMonitor=kFALSE,"DoBoostMonitor","Create control plot with ROC integral vs tree number");
@@ -606,6 +611,12 @@ void TMVA::MethodBDT::ProcessOptions()
       fNCuts=20;
    }
 
+   if (fHistogramSplits && (fNCuts <= 0 || fUseFisherCuts)) {
+      Log() << kWARNING << "The option HistogramSplits needs nCuts > 0 and cannot be used with UseFisherCuts,"
+            << " I will ignore it!" << Endl;
+      fHistogramSplits = kFALSE;
+   }
+
    if (fNTrees==0){
       Log() << kERROR << " Zero Decision Trees demanded... that does not work !! "
             << " I set it to 1 .. just so that the program does not crash"
@@ -1263,6 +1274,13 @@ void TMVA::MethodBDT::Train()
       InitGradBoost(fEventSample);
    }
 
+   // the variables of all the training events are binned once for all the trees
+   if (fHistogramSplits) {
+      Log() << kINFO << "Binning the variables in at most " << fNCuts+1
+            << " quantiles for the histogram based node splitting" << Endl;
+      fBinnedSample.reset(new BinnedEventSample(fEventSample, GetNvar(), fNCuts+1));
+   }
+
    Int_t itree=0;
    Bool_t continueBoost=kTRUE;
    //for (int itree=0; itree<fNTrees; itree++) {
@@ -1303,7 +1321,9 @@ void TMVA::MethodBDT::Train()
             }
             // the minimum linear correlation between two variables demanded for use in fisher criterion in node splitting
 
+            fForest.back()->SetBinnedSample(fBinnedSample.get());
             nNodesBeforePruning = fForest.back()->BuildTree(*fTrainSample);
+            fForest.back()->SetBinnedSample(nullptr);
             Double_t bw = this->Boost(*fTrainSample, fForest.back(),i);
             if (bw > 0) {
                fBoostWeights.push_back(bw);
@@ -1329,7 +1349,9 @@ void TMVA::MethodBDT::Train()
             fForest.back()->SetUseExclusiveVars(fUseExclusiveVars);
          }
 
+         fForest.back()->SetBinnedSample(fBinnedSample.get());
          nNodesBeforePruning = fForest.back()->BuildTree(*fTrainSample);
+         fForest.back()->SetBinnedSample(nullptr);
 
          if (fUseYesNoLeaf && !DoRegression() && fBoostType!="Grad") { // remove leaf nodes where both daughter nodes are of same type
             nNodesBeforePruning = fForest.back()->CleanTree();
@@ -1404,6 +1426,7 @@ void TMVA::MethodBDT::Train()
    // reset all previously stored/accumulated BOOST weights in the event sample
    //   for (UInt_t iev=0; iev<fEventSample.size(); iev++) fEventSample[iev]->SetBoostWeight(1.);
    Log() << kDEBUG << "Now I delete the privat data sample"<< Endl;
+   fBinnedSample.reset();
    for (UInt_t i=0; i<fEventSample.size();      i++) delete fEventSample[i];
    for (UInt_t i=0; i<fValidationSample.size(); i++) delete fValidationSample[i];
    fEventSample.clear();
@@ -17,15 +17,22 @@
  **********************************************************************************/
 
 #include <TMVA/RBDT.hxx>
+#include <TMVA/Config.h>
+#include <TMVA/Executor.h>
 
 #include <ROOT/StringUtils.hxx>
+#include <ROOT/TSeq.hxx>
 
 #include <TFile.h>
+#include <TMD5.h>
+#include <TROOT.h>
 #include <TSystem.h>
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <stdlib.h>
@@ -52,6 +59,25 @@ void softmaxTransformInplace(Value_t *out, int nOut)
    }
 }
 
+/// Number of events evaluated together with each tree by RBDT::ComputeBatch, so that the nodes of the
+/// tree stay in cache, and number of events traversing a tree in lockstep.
+constexpr std::size_t kTileSize = 64;
+constexpr std::size_t kLanes = 8;
+
+/// Write a float as a C++ literal with the exact same value
+void writeFloatLiteral(std::ostream &os, float value)
+{
+   if (std::isnan(value)) {
+      os << "std::numeric_limits<float>::quiet_NaN()";
+   } else if (std::isinf(value)) {
+      os << (value < 0 ? "-" : "") << "std::numeric_limits<float>::infinity()";
+   } else {
+      std::ostringstream literal;
+      literal << std::hexfloat << value << 'f';
+      os << literal.str();
+   }
+}
+
 namespace util {
 
 inline bool isInteger(const std::string &s)
@@ -106,26 +132,211 @@ inline NumericAfterSubstrOutput<NumericType> numericAfterSubstr(std::string cons
 using TMVA::Experimental::RTensor;
 
 /// Compute model prediction on input RTensor
+///
+/// The events are evaluated in tiles (see ComputeBatch), distributed over the threads of the
+/// TMVA thread executor if multi-threading is enabled (see TMVA::Config::EnableMT).
 RTensor<TMVA::Experimental::RBDT::Value_t> TMVA::Experimental::RBDT::Compute(RTensor<Value_t> const &x) const
 {
    std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
    const std::size_t rows = x.GetShape()[0];
    const std::size_t cols = x.GetShape()[1];
    RTensor<Value_t> y({rows, nOut}, MemoryLayout::ColumnMajor);
-   std::vector<Value_t> xRow(cols);
-   std::vector<Value_t> yRow(nOut);
-   for (std::size_t iRow = 0; iRow < rows; ++iRow) {
-      for (std::size_t iCol = 0; iCol < cols; ++iCol) {
-         xRow[iCol] = x({iRow, iCol});
+   // contiguous row-major input can be read in place, otherwise the rows of each tile are copied
+   const bool rowMajor = x.GetMemoryLayout() == MemoryLayout::RowMajor && x.GetStrides()[0] == cols &&
+                         x.GetStrides()[1] == 1;
+
+   auto computeTile = [&](std::size_t iTile) {
+      const std::size_t firstRow = iTile * kTileSize;
+      const std::size_t nRows = std::min(kTileSize, rows - firstRow);
+      std::vector<Value_t> xTile;
+      const Value_t *xData = x.GetData() + firstRow * cols;
+      if (!rowMajor) {
+         xTile.resize(nRows * cols);
+         for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+            for (std::size_t iCol = 0; iCol < cols; ++iCol) {
+               xTile[iRow * cols + iCol] = x({firstRow + iRow, iCol});
+            }
+         }
+         xData = xTile.data();
       }
-      ComputeImpl(xRow.data(), yRow.data());
-      for (std::size_t iOut = 0; iOut < nOut; ++iOut) {
-         y({iRow, iOut}) = yRow[iOut];
+      std::vector<Value_t> yTile(nRows * nOut);
+      ComputeBatch(xData, nRows, cols, yTile.data());
+      for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+         for (std::size_t iOut = 0; iOut < nOut; ++iOut) {
+            y({firstRow + iRow, iOut}) = yTile[iRow * nOut + iOut];
+         }
       }
+   };
+
+   const std::size_t nTiles = (rows + kTileSize - 1) / kTileSize;
+   auto &executor = TMVA::Config::Instance().GetThreadExecutor();
+   if (nTiles > 1 && executor.GetPoolSize() > 1) {
+      executor.Foreach(computeTile, ROOT::TSeq<std::size_t>(0, nTiles));
+   } else {
+      for (std::size_t iTile = 0; iTile < nTiles; ++iTile)
+         computeTile(iTile);
    }
    return y;
 }
 
+/// Compute the model predictions of nRows events, stored row-major in x with nCols features each,
+/// into out (row-major, with the number of outputs per event).
+///
+/// Each tree is evaluated for all the events before going to the next tree, so that its nodes stay in
+/// cache, and the events traverse the tree by groups of kLanes in lockstep, so that the memory accesses
+/// of the independent traversals can overlap. The responses of each event are summed in the tree order,
+/// so the results are identical to the ones of ComputeImpl.
+void TMVA::Experimental::RBDT::ComputeBatch(const Value_t *x, std::size_t nRows, std::size_t nCols,
+                                            Value_t *out) const
+{
+   const std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
+   if (fCompiledForest) {
+      for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+         fCompiledForest(x + iRow * nCols, out + iRow * nOut);
+         Transform(out + iRow * nOut);
+      }
+      return;
+   }
+
+   for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+      for (std::size_t iOut = 0; iOut < nOut; ++iOut) {
+         out[iRow * nOut + iOut] = fBaseScore + fBaseResponses[iOut];
+      }
+   }
+
+   const unsigned int *cutIndices = fCutIndices.data();
+   const Value_t *cutValues = fCutValues.data();
+   const int *leftIndices = fLeftIndices.data();
+   const int *rightIndices = fRightIndices.data();
+   int index[kLanes];
+   for (std::size_t iTree = 0; iTree < fRootIndices.size(); ++iTree) {
+      const std::size_t iOut = nOut > 1 ? fTreeNumbers[iTree] % nOut : 0;
+      for (std::size_t firstRow = 0; firstRow < nRows; firstRow += kLanes) {
+         const std::size_t nLanes = std::min(kLanes, nRows - firstRow);
+         const Value_t *xRows = x + firstRow * nCols;
+         // the root is always a node (the first step of the traversal in EvaluateBinary)
+         bool active = false;
+         for (std::size_t j = 0; j < nLanes; ++j) {
+            const int i = fRootIndices[iTree];
+            index[j] = xRows[j * nCols + cutIndices[i]] < cutValues[i] ? leftIndices[i] : rightIndices[i];
+            active |= index[j] > 0;
+         }
+         while (active) {
+            active = false;
+            for (std::size_t j = 0; j < nLanes; ++j) {
+               const int i = index[j];
+               if (i > 0) {
+                  index[j] = xRows[j * nCols + cutIndices[i]] < cutValues[i] ? leftIndices[i] : rightIndices[i];
+                  active |= index[j] > 0;
+               }
+            }
+         }
+         for (std::size_t j = 0; j < nLanes; ++j) {
+            out[(firstRow + j) * nOut + iOut] += fResponses[-index[j]];
+         }
+      }
+   }
+
+   for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+      Transform(out + iRow * nOut);
+   }
+}
+
+/// Apply the softmax (multiclass models) or logistic transformation to the raw scores of an event.
+void TMVA::Experimental::RBDT::Transform(Value_t *out) const
+{
+   const std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
+   if (nOut > 1) {
+      softmaxTransformInplace(out, nOut);
+   } else if (fLogistic) {
+      out[0] = 1.0 / (1.0 + std::exp(-out[0]));
+   }
+}
+
+std::string TMVA::Experimental::RBDT::GenerateCode(std::string const &funcName) const
+{
+   const std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
+   std::ostringstream os;
+   os << "#include <limits>\n\n"
+      << "extern \"C\" void " << funcName << "(const float *x, float *out)\n{\n";
+   for (std::size_t iOut = 0; iOut < nOut; ++iOut) {
+      os << "   out[" << iOut << "] = ";
+      writeFloatLiteral(os, fBaseScore + fBaseResponses[iOut]);
+      os << ";\n";
+   }
+   // the responses are added in the tree order, as in EvaluateBinary and Softmax
+   for (std::size_t iTree = 0; iTree < fRootIndices.size(); ++iTree) {
+      os << "   // tree " << iTree << "\n";
+      GenerateNodeCode(os, fRootIndices[iTree], nOut > 1 ? fTreeNumbers[iTree] % nOut : 0, 1);
+   }
+   os << "}\n";
+   return os.str();
+}
+
+/// Generate the code of the subtree starting at the node index, which must not be a leaf
+void TMVA::Experimental::RBDT::GenerateNodeCode(std::ostream &os, int index, std::size_t iOut, int depth) const
+{
+   const std::string indent(3 * depth, ' ');
+   os << indent << "if (x[" << fCutIndices[index] << "] < ";
+   writeFloatLiteral(os, fCutValues[index]);
+   os << ") {\n";
+   GenerateChildCode(os, fLeftIndices[index], iOut, depth + 1);
+   os << indent << "} else {\n";
+   GenerateChildCode(os, fRightIndices[index], iOut, depth + 1);
+   os << indent << "}\n";
+}
+
+/// Generate the code of a child node, which is a leaf if the index is not positive
+void TMVA::Experimental::RBDT::GenerateChildCode(std::ostream &os, int index, std::size_t iOut, int depth) const
+{
+   if (index > 0) {
+      GenerateNodeCode(os, index, iOut, depth);
+      return;
+   }
+   os << std::string(3 * depth, ' ') << "out[" << iOut << "] += ";
+   writeFloatLiteral(os, fResponses[-index]);
+   os << ";\n";
+}
+
+/// The generated code (see GenerateCode) is compiled by ACLiC into cacheDir, by default the temporary directory,
+/// and the library is loaded. The source and library are named after a hash of the code and of the ROOT build, so
+/// that processes using the same forest reuse the library compiled by the first one.
+/// The results are identical to the ones of the interpreted forest.
+void TMVA::Experimental::RBDT::Compile(std::string const &cacheDir)
+{
+   const std::string dir = cacheDir.empty() ? std::string(gSystem->TempDirectory()) : cacheDir;
+   if (gSystem->AccessPathName(dir.c_str()))
+      gSystem->mkdir(dir.c_str(), /*recursive=*/true);
+
+   const auto key = std::string(gROOT->GetVersion()) + gROOT->GetGitCommit() + GenerateCode("rbdt_forest");
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   const std::string funcName = std::string("rbdt_forest_") + md5.AsString();
+   const std::string sourcePath = dir + "/" + funcName + ".C";
+   const std::string libPath = dir + "/" + funcName + "_C." + gSystem->GetSoExt();
+
+   if (gSystem->AccessPathName(libPath.c_str())) {
+      // write the source under a temporary name, in case other processes are compiling the same forest
+      const auto tmpSourcePath = sourcePath + ".tmp" + std::to_string(gSystem->GetPid());
+      std::ofstream source(tmpSourcePath);
+      source << GenerateCode(funcName);
+      source.close();
+      gSystem->Rename(tmpSourcePath.c_str(), sourcePath.c_str());
+      if (!gSystem->CompileMacro(sourcePath.c_str(), "kOcs-", "", dir.c_str())) {
+         throw std::runtime_error("Failed to compile the RBDT forest in " + sourcePath);
+      }
+   }
+   if (gSystem->Load(libPath.c_str()) < 0) {
+      throw std::runtime_error("Failed to load the compiled RBDT forest " + libPath);
+   }
+   auto func = gSystem->DynFindSymbol(libPath.c_str(), funcName.c_str());
+   if (!func) {
+      throw std::runtime_error("Failed to find the compiled RBDT forest function " + funcName);
+   }
+   fCompiledForest = reinterpret_cast<void (*)(const Value_t *, Value_t *)>(func);
+}
+
 void TMVA::Experimental::RBDT::Softmax(const Value_t *array, Value_t *out) const
 {
    std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
@@ -155,6 +366,11 @@ void TMVA::Experimental::RBDT::Softmax(const Value_t *array, Value_t *out) const
 
 void TMVA::Experimental::RBDT::ComputeImpl(const Value_t *array, Value_t *out) const
 {
+   if (fCompiledForest) {
+      fCompiledForest(array, out);
+      Transform(out);
+      return;
+   }
    std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
    if (nOut > 1) {
       Softmax(array, out);
@@ -0,0 +1,80 @@
+// ROOT
+#include "TRandom3.h"
+
+// TMVA
+#include "TMVA/BinnedEventSample.h"
+#include "TMVA/DecisionTree.h"
+#include "TMVA/DecisionTreeNode.h"
+#include "TMVA/Event.h"
+#include "TMVA/GiniIndex.h"
+
+// Stdlib
+#include <memory>
+#include <vector>
+
+// External
+#include "gtest/gtest.h"
+
+class BinnedEventSampleTest : public ::testing::Test {
+protected:
+   void SetUp() override
+   {
+      // signal and background separated in the first variable, the second one has a few integer values
+      TRandom3 rndm(42);
+      for (int i = 0; i < kNEvents; ++i) {
+         const UInt_t cls = i % 2;
+         std::vector<Float_t> values{Float_t(rndm.Gaus(cls == 0 ? 1. : -1.)), Float_t(rndm.Integer(5))};
+         fEventStore.emplace_back(new TMVA::Event(values, cls));
+         fEvents.push_back(fEventStore.back().get());
+      }
+   }
+
+   static constexpr int kNEvents = 10000;
+   std::vector<std::unique_ptr<TMVA::Event>> fEventStore;
+   std::vector<const TMVA::Event *> fEvents;
+};
+
+// An event is above the cut at a bin edge if and only if its bin is above the cut
+TEST_F(BinnedEventSampleTest, BinsAndCuts)
+{
+   TMVA::BinnedEventSample binned(fEvents, 2, 21);
+   EXPECT_EQ(binned.GetNVars(), 2u);
+   EXPECT_LE(binned.GetNBins(0), 21u);
+   EXPECT_GE(binned.GetNBins(0), 15u);
+   // one bin for each of the distinct values
+   EXPECT_EQ(binned.GetNBins(1), 5u);
+   for (UInt_t ivar = 0; ivar < 2; ++ivar) {
+      const UShort_t *bins = binned.GetBins(ivar);
+      for (int iev = 0; iev < kNEvents; ++iev) {
+         ASSERT_EQ(binned.GetRow(fEvents[iev]), iev);
+         const Float_t value = fEvents[iev]->GetValueFast(ivar);
+         for (UInt_t ibin = 0; ibin + 1 < binned.GetNBins(ivar); ++ibin)
+            ASSERT_EQ(value >= binned.GetCutValue(ivar, ibin), bins[iev] > ibin);
+      }
+   }
+   TMVA::Event other(std::vector<Float_t>{0, 0}, 0);
+   EXPECT_EQ(binned.GetRow(&other), -1);
+}
+
+// The histogram based training finds the separating variable and classifies the events
+TEST_F(BinnedEventSampleTest, DecisionTree)
+{
+   TMVA::BinnedEventSample binned(fEvents, 2, 21);
+   TMVA::GiniIndex gini;
+   TMVA::DecisionTreeNode::SetIsTraining(true);
+   TMVA::DecisionTree tree(&gini, 5., 20, nullptr, 0, kFALSE, 0, kFALSE, 3);
+   tree.SetNVars(2);
+   tree.SetBinnedSample(&binned);
+   EXPECT_GT(tree.BuildTree(fEvents), 1u);
+   TMVA::DecisionTreeNode::SetIsTraining(false);
+
+   EXPECT_EQ(tree.GetRoot()->GetSelector(), 0);
+   EXPECT_NEAR(tree.GetRoot()->GetCutValue(), 0., 0.3);
+   EXPECT_DOUBLE_EQ(tree.GetRoot()->GetNEvents(), kNEvents);
+   int nCorrect = 0;
+   for (auto event : fEvents) {
+      const bool isSignal = tree.CheckEvent(event, kTRUE) > 0.5;
+      nCorrect += isSignal == (event->GetClass() == 0);
+   }
+   EXPECT_GT(nCorrect, 0.8 * kNEvents);
+}
@@ -0,0 +1,145 @@
+/// \file
+/// - Project   : TMVA - a Root-integrated toolkit for multivariate data analysis
+/// - Package   : TMVA
+///
+/// Verifies the order of the events of the training and test sets built with
+/// MixMode=Alternate. The events of each class are interleaved into the events
+/// of the classes before it, one after every cls events, until there are not
+/// enough of them; the rest of the class is appended. The expected order is
+/// computed with the element by element insertion that DataSetFactory used to
+/// do, for classes with equal and different numbers of events.
+
+#include "gtest/gtest.h"
+
+#include <TString.h>
+#include <TTree.h>
+
+#include "TMVA/DataLoader.h"
+#include "TMVA/DataSet.h"
+#include "TMVA/DataSetInfo.h"
+#include "TMVA/Event.h"
+#include "TMVA/MsgLogger.h"
+#include "TMVA/Tools.h"
+#include "TMVA/Types.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct ClassSizes {
+   int fTrain;
+   int fTest;
+};
+
+// the id of the events of class cls starts at 1000 * cls
+int FirstId(std::size_t cls)
+{
+   return 1000 * int(cls);
+}
+
+std::unique_ptr<TTree> CreateTree(int start, int nEntries)
+{
+   auto tree = std::make_unique<TTree>();
+   float x = 0.;
+   float id = start;
+   tree->Branch("x", &x, "x/F");
+   tree->Branch("id", &id, "id/F");
+   for (int i = 0; i < nEntries; ++i) {
+      x = 0.1 * i;
+      tree->Fill();
+      ++id;
+   }
+   tree->ResetBranchAddresses();
+   return tree;
+}
+
+// the mixing as it was done before, inserting the events one by one
+std::vector<int> ReferenceMixing(std::vector<std::vector<int>> const &classes)
+{
+   std::vector<int> mixed = classes[0];
+   for (std::size_t cls = 1; cls < classes.size(); ++cls) {
+      int target = -1; // start one before begin
+      for (std::size_t i = 0; i < classes[cls].size(); ++i) {
+         if (int(mixed.size()) - target < int(cls + 1)) {
+            // fill in the rest without mixing
+            mixed.insert(mixed.end(), classes[cls].begin() + i, classes[cls].end());
+            break;
+         }
+         target += cls + 1;
+         mixed.insert(mixed.begin() + target, classes[cls][i]);
+      }
+   }
+   return mixed;
+}
+
+// ids of the events of the given type, in the order of the data set
+std::vector<int> DataSetIds(TMVA::DataSet &ds, TMVA::Types::ETreeType type)
+{
+   std::vector<int> ids;
+   for (auto ev : ds.GetEventCollection(type))
+      ids.push_back(int(ev->GetSpectator(0)));
+   return ids;
+}
+
+void TestMixing(std::vector<ClassSizes> const &sizes)
+{
+   static int iDataSet = 0;
+   TMVA::Tools::Instance();
+   TMVA::MsgLogger::InhibitOutput();
+
+   TMVA::DataLoader loader(TString::Format("dataset_mixing_%d", iDataSet++));
+   std::vector<std::unique_ptr<TTree>> trees;
+   std::vector<std::vector<int>> trainIds(sizes.size());
+   std::vector<std::vector<int>> testIds(sizes.size());
+   TString options = "SplitMode=Block:MixMode=Alternate:NormMode=None:!V";
+   for (std::size_t cls = 0; cls < sizes.size(); ++cls) {
+      const TString name = TString::Format("class%zu", cls);
+      trees.push_back(CreateTree(FirstId(cls), sizes[cls].fTrain + sizes[cls].fTest));
+      loader.AddTree(trees.back().get(), name);
+      options += TString::Format(":nTrain_%s=%d:nTest_%s=%d", name.Data(), sizes[cls].fTrain, name.Data(),
+                                 sizes[cls].fTest);
+      // the block split takes the training events first
+      for (int i = 0; i < sizes[cls].fTrain; ++i)
+         trainIds[cls].push_back(FirstId(cls) + i);
+      for (int i = 0; i < sizes[cls].fTest; ++i)
+         testIds[cls].push_back(FirstId(cls) + sizes[cls].fTrain + i);
+   }
+   loader.AddVariable("x", 'F');
+   loader.AddSpectator("id", "id", "");
+   loader.PrepareTrainingAndTestTree("", options);
+
+   TMVA::DataSet *ds = loader.GetDataSetInfo().GetDataSet();
+   TMVA::MsgLogger::EnableOutput();
+
+   EXPECT_EQ(DataSetIds(*ds, TMVA::Types::kTraining), ReferenceMixing(trainIds));
+   EXPECT_EQ(DataSetIds(*ds, TMVA::Types::kTesting), ReferenceMixing(testIds));
+}
+
+} // namespace
+
+TEST(DataSetMixing, AlternateEqualSizes)
+{
+   TestMixing({{10, 5}, {10, 5}});
+   TestMixing({{6, 4}, {6, 4}, {6, 4}});
+}
+
+TEST(DataSetMixing, AlternateDifferentSizes)
+{
+   // smaller and larger classes than the first one
+   TestMixing({{10, 3}, {4, 7}});
+   TestMixing({{3, 2}, {12, 9}});
+   TestMixing({{7, 4}, {12, 2}, {3, 5}});
+   TestMixing({{1, 1}, {2, 3}, {9, 1}, {5, 6}});
+}
+
+TEST(DataSetMixing, AlternateAllSmallSizes)
+{
+   for (int n0 = 1; n0 <= 4; ++n0) {
+      for (int n1 = 1; n1 <= 4; ++n1) {
+         for (int n2 = 1; n2 <= 4; ++n2) {
+            TestMixing({{n0, n1}, {n1, n2}, {n2, n0}});
+         }
+      }
+   }
+}
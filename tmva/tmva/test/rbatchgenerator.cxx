@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <TFile.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include "TMVA/RBatchGenerator.hxx"
+#include "TMVA/RTensor.hxx"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+using TMVA::Experimental::RTensor;
+using TMVA::Experimental::Internal::RBatchGenerator;
+
+// The events of the dataset have x = entry and y = -entry. With the chunks of 300 events
+// and the batches of 64 events used below, each of the three full chunks gives 4 batches
+// and the last chunk of 100 events gives 1 batch; the events left in a chunk once its full
+// batches are made are dropped.
+class RBatchGeneratorTest : public ::testing::Test {
+protected:
+   static constexpr const char *fFileName = "rbatchgenerator.root";
+   static constexpr const char *fTreeName = "tree";
+   static constexpr std::size_t fNumEntries = 1000;
+   static constexpr std::size_t fChunkSize = 300;
+   static constexpr std::size_t fBatchSize = 64;
+
+   static void SetUpTestSuite()
+   {
+      TFile f(fFileName, "RECREATE");
+      TTree t(fTreeName, fTreeName);
+      float x{};
+      float y{};
+      t.Branch("x", &x, "x/F");
+      t.Branch("y", &y, "y/F");
+      for (std::size_t i = 0; i < fNumEntries; i++) {
+         x = i;
+         y = -x;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   static void TearDownTestSuite() { gSystem->Unlink(fFileName); }
+
+   static std::unique_ptr<RBatchGenerator<float, float>>
+   MakeGenerator(float validationSplit, bool shuffle, std::size_t numLoadingThreads = 1,
+                 std::size_t chunkSize = fChunkSize, std::size_t batchSize = fBatchSize)
+   {
+      return std::make_unique<RBatchGenerator<float, float>>(fTreeName, fFileName, chunkSize, batchSize,
+                                                             std::vector<std::string>{"x", "y"}, "",
+                                                             std::vector<std::size_t>{}, 0., validationSplit, 0, 0,
+                                                             shuffle, numLoadingThreads);
+   }
+
+   /// Take all the training batches of an epoch, and return the x of their events
+   static std::vector<std::vector<float>> TrainEpoch(RBatchGenerator<float, float> &generator)
+   {
+      std::vector<std::vector<float>> batches;
+      while (true) {
+         const RTensor<float> &batch = generator.GetTrainBatch();
+         if (batch.GetSize() == 0)
+            break;
+         batches.push_back(Events(batch));
+      }
+      EXPECT_FALSE(generator.HasTrainData());
+      return batches;
+   }
+
+   static std::vector<std::vector<float>> ValidationBatches(RBatchGenerator<float, float> &generator)
+   {
+      std::vector<std::vector<float>> batches;
+      generator.StartValidation();
+      while (generator.HasValidationData())
+         batches.push_back(Events(generator.GetValidationBatch()));
+      EXPECT_EQ(generator.GetValidationBatch().GetSize(), 0u);
+      return batches;
+   }
+
+   static std::vector<float> Events(const RTensor<float> &batch)
+   {
+      std::vector<float> events;
+      EXPECT_EQ(batch.GetShape(), (std::vector<std::size_t>{fBatchSize, 2}));
+      for (std::size_t i = 0; i < batch.GetShape()[0]; i++) {
+         EXPECT_EQ(batch(i, 1), -batch(i, 0));
+         events.push_back(batch(i, 0));
+      }
+      return events;
+   }
+
+   /// The batch of the consecutive events starting at the given entry
+   static std::vector<float> Consecutive(std::size_t start)
+   {
+      std::vector<float> events(fBatchSize);
+      std::iota(events.begin(), events.end(), float(start));
+      return events;
+   }
+
+   /// The training or validation batches of an epoch without shuffling: the first events of each
+   /// chunk are for validation, the others for training
+   static std::vector<std::vector<float>> ExpectedBatches(float validationSplit, bool validation)
+   {
+      std::vector<std::vector<float>> expected;
+      for (std::size_t start = 0; start < fNumEntries; start += fChunkSize) {
+         const std::size_t nEvents = std::min(fChunkSize, fNumEntries - start);
+         const std::size_t nValidation = std::ceil(nEvents * validationSplit);
+         const std::size_t first = validation ? start : start + nValidation;
+         const std::size_t nBatches = (validation ? nValidation : nEvents - nValidation) / fBatchSize;
+         for (std::size_t b = 0; b < nBatches; b++)
+            expected.push_back(Consecutive(first + b * fBatchSize));
+      }
+      return expected;
+   }
+
+   static std::vector<float> Sorted(const std::vector<std::vector<float>> &batches)
+   {
+      std::vector<float> events;
+      for (const auto &batch : batches)
+         events.insert(events.end(), batch.begin(), batch.end());
+      std::sort(events.begin(), events.end());
+      return events;
+   }
+};
+
+TEST_F(RBatchGeneratorTest, BatchCounts)
+{
+   auto generator = MakeGenerator(0., false);
+   generator->Activate();
+   const auto batches = TrainEpoch(*generator);
+   generator->DeActivate();
+
+   // 4 + 4 + 4 + 1 batches, with the consecutive events of each chunk
+   ASSERT_EQ(batches.size(), 13u);
+   EXPECT_EQ(batches, ExpectedBatches(0., false));
+   EXPECT_EQ(batches.back(), Consecutive(900));
+   EXPECT_TRUE(ValidationBatches(*generator).empty());
+}
+
+TEST_F(RBatchGeneratorTest, BatchCountsWithValidation)
+{
+   // the first 75 events of the full chunks and the first 25 of the last one are for validation:
+   // 3 + 3 + 3 + 1 training batches and 1 + 1 + 1 + 0 validation batches
+   auto generator = MakeGenerator(0.25, false);
+   for (int epoch = 0; epoch < 2; epoch++) {
+      generator->Activate();
+      const auto batches = TrainEpoch(*generator);
+      generator->DeActivate();
+      ASSERT_EQ(batches.size(), 10u) << "epoch " << epoch;
+      EXPECT_EQ(batches, ExpectedBatches(0.25, false)) << "epoch " << epoch;
+
+      // the validation batches are made in the first epoch only
+      EXPECT_EQ(ValidationBatches(*generator), ExpectedBatches(0.25, true)) << "epoch " << epoch;
+   }
+}
+
+TEST_F(RBatchGeneratorTest, BatchCountsParallelLoading)
+{
+   // the order of the chunks depends on the loading threads, but not the batches themselves
+   auto generator = MakeGenerator(0.25, false, 3);
+   generator->Activate();
+   const auto batches = TrainEpoch(*generator);
+   generator->DeActivate();
+   EXPECT_EQ(batches.size(), 10u);
+   EXPECT_EQ(Sorted(batches), Sorted(ExpectedBatches(0.25, false)));
+   EXPECT_EQ(ValidationBatches(*generator).size(), 3u);
+}
+
+TEST_F(RBatchGeneratorTest, ShuffledEpochs)
+{
+   // the shuffled epochs have the same number of batches, with distinct events of the training set
+   auto generator = MakeGenerator(0.25, true, 2);
+   std::vector<float> validation;
+   for (int epoch = 0; epoch < 2; epoch++) {
+      generator->Activate();
+      const auto events = Sorted(TrainEpoch(*generator));
+      generator->DeActivate();
+      EXPECT_EQ(events.size(), 10 * fBatchSize) << "epoch " << epoch;
+      EXPECT_EQ(std::adjacent_find(events.begin(), events.end()), events.end()) << "epoch " << epoch;
+
+      if (epoch == 0)
+         validation = Sorted(ValidationBatches(*generator));
+      EXPECT_EQ(validation.size(), 3 * fBatchSize);
+      std::vector<float> common;
+      std::set_intersection(events.begin(), events.end(), validation.begin(), validation.end(),
+                            std::back_inserter(common));
+      EXPECT_TRUE(common.empty()) << "epoch " << epoch;
+   }
+}
+
+TEST_F(RBatchGeneratorTest, EarlyStop)
+{
+   for (std::size_t numLoadingThreads : {1, 3}) {
+      auto generator = MakeGenerator(0.25, false, numLoadingThreads);
+
+      // stop while the loading threads are still producing
+      generator->Activate();
+      EXPECT_EQ(generator->GetTrainBatch().GetSize(), fBatchSize * 2);
+      generator->DeActivate();
+
+      // the next epoch is complete, without the batches left over from the stopped one
+      generator->Activate();
+      const auto batches = TrainEpoch(*generator);
+      generator->DeActivate();
+      if (numLoadingThreads == 1) {
+         EXPECT_EQ(batches, ExpectedBatches(0.25, false));
+      } else {
+         EXPECT_EQ(Sorted(batches), Sorted(ExpectedBatches(0.25, false)));
+      }
+      EXPECT_EQ(ValidationBatches(*generator).size(), 3u);
+   }
+}
+
+TEST_F(RBatchGeneratorTest, DestroyWhileProducing)
+{
+   // small batches, so that the batch queue and the chunk buffers are full while the consumer is gone
+   for (std::size_t numLoadingThreads : {1, 3}) {
+      {
+         auto generator = MakeGenerator(0., false, numLoadingThreads, 100, 10);
+         generator->Activate();
+      }
+      {
+         auto generator = MakeGenerator(0.5, true, numLoadingThreads, 100, 10);
+         generator->Activate();
+         EXPECT_EQ(generator->GetTrainBatch().GetSize(), 20u);
+      }
+      {
+         // never activated
+         auto generator = MakeGenerator(0., false, numLoadingThreads);
+      }
+   }
+}
@@ -67,6 +67,44 @@ def _test_XGBMulticlass(label):
     np.testing.assert_array_almost_equal(y_xgb, y_bdt)
 
 
+def _test_BatchSameAsSingleEvent(label, num_outputs):
+    """
+    Compare the batch inference on a tensor with the inference event by event.
+    """
+    x, y = create_dataset(1000, 10, num_outputs)
+    xgb = xgboost.XGBClassifier(n_estimators=20, max_depth=4)
+    xgb.fit(x, y)
+    ROOT.TMVA.Experimental.SaveXGBoost(xgb, "myModel", "testXGBBatch{}.root".format(label), num_inputs=10)
+    bdt = ROOT.TMVA.Experimental.RBDT("myModel", "testXGBBatch{}.root".format(label))
+
+    y_batch = np.asarray(bdt.Compute(x)).reshape(len(x), -1)
+    for i in range(len(x)):
+        y_single = np.asarray(bdt.Compute(ROOT.std.vector["float"](x[i])))
+        np.testing.assert_array_equal(y_batch[i], y_single)
+
+
+def _test_CompiledSameAsInterpreted(label, num_outputs):
+    """
+    Compare the inference of the compiled forest with the one of the interpreted forest.
+    """
+    x, y = create_dataset(1000, 10, num_outputs)
+    xgb = xgboost.XGBClassifier(n_estimators=20, max_depth=4)
+    xgb.fit(x, y)
+    ROOT.TMVA.Experimental.SaveXGBoost(xgb, "myModel", "testXGBCompiled{}.root".format(label), num_inputs=10)
+    bdt = ROOT.TMVA.Experimental.RBDT("myModel", "testXGBCompiled{}.root".format(label))
+
+    y_interpreted = np.asarray(bdt.Compute(x))
+    bdt.Compile()
+    assert bdt.IsCompiled()
+    y_compiled = np.asarray(bdt.Compute(x))
+    np.testing.assert_array_equal(y_interpreted, y_compiled)
+
+    # a second forest with the same model reuses the compiled library
+    bdt2 = ROOT.TMVA.Experimental.RBDT("myModel", "testXGBCompiled{}.root".format(label))
+    bdt2.Compile()
+    np.testing.assert_array_equal(y_interpreted, np.asarray(bdt2.Compute(x)))
+
+
 class RBDT(unittest.TestCase):
     """
     Test RBDT interface
@@ -90,6 +128,20 @@ class RBDT(unittest.TestCase):
         """
         _test_XGBRegression("default")
 
+    def test_BatchSameAsSingleEvent(self):
+        """
+        Test that the batch inference gives the same results as the single event inference.
+        """
+        _test_BatchSameAsSingleEvent("binary", 2)
+        _test_BatchSameAsSingleEvent("multiclass", 3)
+
+    def test_CompiledSameAsInterpreted(self):
+        """
+        Test that the compiled forest gives the same results as the interpreted forest.
+        """
+        _test_CompiledSameAsInterpreted("binary", 2)
+        _test_CompiledSameAsInterpreted("multiclass", 3)
+
 
 if __name__ == "__main__":
     unittest.main()
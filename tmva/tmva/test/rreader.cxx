@@ -187,6 +187,22 @@ TEST(RReader, ClassificationComputeDataFrame)
    EXPECT_EQ(y->size(), *c);
 }
 
+TEST(RReader, ClassificationComputeInBatches)
+{
+   TrainClassificationModel();
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   RReader model(modelClassification);
+   auto y = ComputeInBatches<4, float>(df, model, variablesClassification, 100);
+   auto expected = df.Define("y", Compute<4, float>(model), variablesClassification).Take<std::vector<float>>("y");
+
+   const auto shapeY = y->GetShape();
+   EXPECT_EQ(shapeY.size(), 2ul);
+   EXPECT_EQ(shapeY[0], expected->size());
+   EXPECT_EQ(shapeY[1], 1ul);
+   for (std::size_t i = 0; i < expected->size(); ++i)
+      EXPECT_FLOAT_EQ((*y)(i, 0), (*expected)[i][0]);
+}
+
 TEST(RReader, RegressionGetVariables)
 {
    TrainRegressionModel();
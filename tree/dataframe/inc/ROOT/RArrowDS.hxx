@@ -15,6 +15,8 @@
 #include <memory>
 
 namespace arrow {
+class RecordBatchReader;
+class Schema;
 class Table;
 }
 
@@ -30,6 +32,11 @@ namespace RDF {
 class RArrowDS final : public RDataSource {
 private:
    std::shared_ptr<arrow::Table> fTable;
+   /// The stream of record batches to read, if the data source was constructed from one (fTable is null then).
+   std::shared_ptr<arrow::RecordBatchReader> fBatchReader;
+   std::shared_ptr<arrow::Schema> fSchema;
+   /// The first entry of the next record batch read from fBatchReader.
+   ULong64_t fNextEntry = 0;
    std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
    std::vector<std::string> fColumnNames;
    size_t fNSlots = 0U;
@@ -40,6 +47,7 @@ private:
 
 public:
    RArrowDS(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
+   RArrowDS(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columns);
    ~RArrowDS();
    const std::vector<std::string> &GetColumnNames() const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
@@ -53,6 +61,8 @@ public:
 };
 
 RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columnNames);
+RDataFrame
+FromArrow(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columnNames);
 
 } // namespace RDF
 
@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include <set>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 #include <TRegexp.h>
@@ -46,6 +47,7 @@ private:
    bool fReadHeaders = false;
    unsigned int fNSlots = 0U;
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
+   std::string fUnparsedBytes; ///< Bytes read from fCsvFile that were not parsed yet, see ReadRecords()
    const char fDelimiter;
    const Long64_t fLinesChunkSize;
    ULong64_t fEntryRangesRequested = 0ULL;
@@ -64,7 +66,10 @@ private:
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   std::string_view NextField(std::string_view line, std::size_t &pos, std::string &scratch) const;
+   void FillRecord(std::string_view line, Record_t &record, std::vector<char> &colContainsEmpty) const;
+   void FillRecords(const std::vector<std::string_view> &lines);
+   void ReadRecords();
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
@@ -41,6 +41,7 @@
 #include "TGraphAsymmErrors.h"
 #include "TLeaf.h"
 #include "TObject.h"
+#include "TROOT.h" // IsImplicitMTEnabled
 #include "TTree.h"
 #include "TTreeReader.h" // for SnapshotHelper
 #include "TStatistic.h"
@@ -48,11 +49,14 @@
 #include "ROOT/RDF/RMergeableValue.hxx"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -62,6 +66,16 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+} // namespace RDF
+} // namespace Detail
+namespace RDF {
+template <typename Proxied, typename DataSource>
+class RInterface;
+} // namespace RDF
+
 namespace Internal {
 namespace RDF {
 using namespace ROOT::TypeTraits;
@@ -71,6 +85,12 @@ using namespace ROOT::Detail::RDF;
 
 using Hist_t = ::TH1D;
 
+/// Merge the objects with indices [1, nObjects) into the object with index 0 by calling `mergeInto(to, from)`.
+/// With implicit multi-threading enabled, the merges are arranged in a binary tree whose levels run in parallel,
+/// so that the merge takes O(log(nObjects)) sequential steps. `mergeInto` therefore must be safe to call
+/// concurrently for disjoint pairs of objects.
+void TreeReduce(std::size_t nObjects, const std::function<void(std::size_t, std::size_t)> &mergeInto);
+
 class RBranchSet {
    std::vector<TBranch *> fBranches;
    std::vector<std::string> fNames;
@@ -394,6 +414,25 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
                     "The type passed to Fill does not provide a Merge(TCollection*) or Merge(const std::vector&) method.");
    }
 
+   // Merge the histograms pairwise in parallel. That's only safe if they all have the same, fixed binning: if axes
+   // were extended or use labels, TH1::Merge needs to rebin, so we fall back to the serial Merge instead.
+   template <typename H = HIST, std::enable_if_t<std::is_base_of<TH1, H>::value, int> = 0>
+   bool TreeMergeIfPossible(std::vector<H *> &objs)
+   {
+      if (!ROOT::IsImplicitMTEnabled() || objs.size() < 4)
+         return false;
+      for (auto *h : objs) {
+         for (auto *axis : {h->GetXaxis(), h->GetYaxis(), h->GetZaxis()}) {
+            if (axis->CanExtend() || axis->GetLabels())
+               return false;
+         }
+      }
+      TreeReduce(objs.size(), [&objs](std::size_t to, std::size_t from) { objs[to]->Add(objs[from]); });
+      return true;
+   }
+
+   bool TreeMergeIfPossible(...) { return false; }
+
    // class which wraps a pointer and implements a no-op increment operator
    template <typename T>
    class ScalarConstIterator {
@@ -518,7 +557,8 @@ public:
       if (fObjects.size() == 1)
          return;
 
-      Merge(fObjects, /*toselectcorrectoverload=*/0);
+      if (!TreeMergeIfPossible(fObjects))
+         Merge(fObjects, /*toselectcorrectoverload=*/0);
 
       // delete the copies we created for the slots other than the first
       for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it)
@@ -557,6 +597,180 @@ public:
    }
 };
 
+/// Fills a single histogram shared by all slots, instead of one copy of the histogram per slot as FillHelper does.
+/// Each slot buffers its fills (coordinates and weight) and flushes them into the shared histogram under a lock
+/// once the buffer is full, in the spirit of ROOT 7's RHistConcurrentFiller. This trades some lock contention
+/// for a memory footprint and a merge cost that do not grow with the number of slots, which matters for large
+/// TH2Ds and TH3Ds in event loops with many threads. The axes of the histogram must not be extendable.
+template <typename HIST, std::size_t NDIM>
+class R__CLING_PTRCHECK(off) ConcurrentFillHelper : public RActionImpl<ConcurrentFillHelper<HIST, NDIM>> {
+   /// The coordinates and the weight of one fill
+   using Fill_t = std::array<double, NDIM + 1>;
+   /// Number of fills buffered by a slot before they are flushed into the shared histogram
+   static constexpr std::size_t fgBufSize = 1024;
+
+   std::shared_ptr<HIST> fResultHist;
+   std::vector<std::vector<Fill_t>> fBuffers;
+   /// Histograms containing "snapshots" of partial results. Non-null only if a registered callback requires it.
+   std::vector<std::unique_ptr<HIST>> fPartialHists;
+   /// Serializes the flushes into fResultHist
+   std::unique_ptr<std::mutex> fMutex;
+
+   // Scalars are used for all the elements of the containers, so their cursor is the value itself. Containers are
+   // walked with iterators, which works for any container type (e.g. std::list), not only random-access ones.
+   template <typename T, std::enable_if_t<!IsDataContainer<T>::value, int> = 0>
+   static double MakeCursor(const T &val)
+   {
+      return val;
+   }
+
+   template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
+   static auto MakeCursor(const T &vals)
+   {
+      return std::begin(vals);
+   }
+
+   static double GetValue(double val) { return val; }
+
+   template <typename It>
+   static double GetValue(const It &it)
+   {
+      return *it;
+   }
+
+   static void Advance(double &) {}
+
+   template <typename It>
+   static void Advance(It &it)
+   {
+      ++it;
+   }
+
+   template <typename T, std::enable_if_t<!IsDataContainer<T>::value, int> = 0>
+   static std::size_t GetSize(const T &)
+   {
+      return 0;
+   }
+
+   template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
+   static std::size_t GetSize(const T &vals)
+   {
+      return std::size(vals);
+   }
+
+   template <typename... Vals>
+   static Fill_t MakeFill(Vals... vals)
+   {
+      if constexpr (sizeof...(Vals) == NDIM)
+         return {{vals..., 1.}};
+      else
+         return {{vals...}};
+   }
+
+   template <std::size_t... Is>
+   void FillOne(const Fill_t &fill, std::index_sequence<Is...>)
+   {
+      fResultHist->Fill(fill[Is]..., fill[NDIM]);
+   }
+
+   /// Move the buffered fills into the shared histogram. The caller must hold fMutex.
+   void Flush(std::vector<Fill_t> &buffer)
+   {
+      for (const auto &fill : buffer)
+         FillOne(fill, std::make_index_sequence<NDIM>());
+      buffer.clear();
+   }
+
+public:
+   ConcurrentFillHelper(ConcurrentFillHelper &&) = default;
+   ConcurrentFillHelper(const ConcurrentFillHelper &) = delete;
+
+   ConcurrentFillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fResultHist(h), fBuffers(nSlots), fPartialHists(nSlots), fMutex(std::make_unique<std::mutex>())
+   {
+      for (auto &buffer : fBuffers)
+         buffer.reserve(fgBufSize);
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename... Xs>
+   void Exec(unsigned int slot, const Xs &...xs)
+   {
+      static_assert(sizeof...(Xs) == NDIM || sizeof...(Xs) == NDIM + 1,
+                    "The number of columns does not match the dimensionality of the histogram.");
+      auto &buffer = fBuffers[slot];
+      if constexpr (!Disjunction<IsDataContainer<Xs>...>::value) {
+         buffer.emplace_back(MakeFill(static_cast<double>(xs)...));
+      } else {
+         // all containers must have the same size, scalars are used for each of their elements
+         const std::array<std::size_t, sizeof...(Xs)> sizes{{GetSize(xs)...}};
+         constexpr std::array<bool, sizeof...(Xs)> isContainer{IsDataContainer<Xs>::value...};
+         const auto size = sizes[FindIdxTrue(isContainer)];
+         for (std::size_t i = 0; i < sizeof...(Xs); ++i) {
+            if (isContainer[i] && sizes[i] != size)
+               throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
+         }
+         auto cursors = std::make_tuple(MakeCursor(xs)...);
+         for (std::size_t i = 0; i < size; ++i) {
+            std::apply(
+               [&buffer](auto &...cursor) {
+                  buffer.emplace_back(MakeFill(GetValue(cursor)...));
+                  (Advance(cursor), ...);
+               },
+               cursors);
+         }
+      }
+
+      if (buffer.size() >= fgBufSize) {
+         std::lock_guard<std::mutex> lock(*fMutex);
+         Flush(buffer);
+      }
+   }
+
+   void Initialize() { /* noop */}
+
+   void Finalize()
+   {
+      for (auto &buffer : fBuffers)
+         Flush(buffer);
+   }
+
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      std::lock_guard<std::mutex> lock(*fMutex);
+      Flush(fBuffers[slot]);
+      auto &partialHist = fPartialHists[slot];
+      if (!partialHist) {
+         partialHist.reset(static_cast<HIST *>(fResultHist->Clone()));
+         partialHist->SetDirectory(nullptr);
+      } else {
+         partialHist->Reset();
+         partialHist->Add(fResultHist.get());
+      }
+      return *partialHist;
+   }
+
+   // Helper functions for RMergeableValue
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      return std::make_unique<RMergeableFill<HIST>>(*fResultHist);
+   }
+
+   std::string GetActionName()
+   {
+      return std::string(fResultHist->IsA()->GetName()) + "\\n" + std::string(fResultHist->GetName());
+   }
+
+   ConcurrentFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return ConcurrentFillHelper(result, fBuffers.size());
+   }
+};
+
 class R__CLING_PTRCHECK(off) FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
 public:
    using Result_t = ::TGraph;
@@ -991,6 +1205,119 @@ extern template class TakeHelper<float, float, std::vector<float>>;
 extern template class TakeHelper<double, double, std::vector<double>>;
 #endif
 
+/// Writes the values of one or more columns into caller-provided contiguous buffers, without intermediate copies.
+///
+/// All slots write into the same buffers: each slot atomically reserves slices of kSliceSize elements and fills them.
+/// At the end of the event loop, the values in the partly filled slices are moved to close the gaps, so that the
+/// first N elements of every buffer hold the N values taken. The values of the different columns of one entry are
+/// always stored at the same index. In multi-thread event loops, the order of the entries in the buffers is not
+/// the order of the dataset.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) TakeIntoHelper : public RActionImpl<TakeIntoHelper<ColTypes...>> {
+public:
+   using Result_t = std::size_t;
+   static constexpr std::size_t kSliceSize = 1024;
+
+private:
+   struct RSlice {
+      std::size_t fNext = 0; ///< Index of the next element to fill
+      std::size_t fEnd = 0;  ///< One past the last element reserved by the slot
+   };
+   struct RState {
+      std::atomic<std::size_t> fNReserved{0};
+      std::vector<RSlice> fSlices; ///< One per slot, spaced by CacheLineStep to avoid false sharing
+   };
+
+   std::tuple<ColTypes *...> fBuffers;
+   std::size_t fCapacity;
+   std::shared_ptr<std::size_t> fNTaken;
+   std::unique_ptr<RState> fState;
+
+   RSlice &GetSlice(unsigned int slot) { return fState->fSlices[slot * CacheLineStep<RSlice>()]; }
+
+   template <std::size_t... Idx>
+   void SetValues(std::size_t index, std::index_sequence<Idx...>, const ColTypes &...values)
+   {
+      int expander[] = {(std::get<Idx>(fBuffers)[index] = values, 0)..., 0};
+      (void)expander;
+   }
+
+   template <std::size_t... Idx>
+   void MoveValue(std::size_t to, std::size_t from, std::index_sequence<Idx...>)
+   {
+      int expander[] = {(std::get<Idx>(fBuffers)[to] = std::get<Idx>(fBuffers)[from], 0)..., 0};
+      (void)expander;
+   }
+
+public:
+   TakeIntoHelper(std::size_t capacity, unsigned int nSlots, ColTypes *...buffers)
+      : fBuffers(buffers...), fCapacity(capacity), fNTaken(std::make_shared<std::size_t>(0)),
+        fState(std::make_unique<RState>())
+   {
+      fState->fSlices.resize(nSlots * CacheLineStep<RSlice>());
+   }
+   TakeIntoHelper(TakeIntoHelper &&) = default;
+   TakeIntoHelper(const TakeIntoHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fNTaken; }
+
+   void Initialize()
+   {
+      fState->fNReserved = 0;
+      std::fill(fState->fSlices.begin(), fState->fSlices.end(), RSlice{});
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const ColTypes &...values)
+   {
+      auto &slice = GetSlice(slot);
+      if (slice.fNext == slice.fEnd) {
+         const auto begin = fState->fNReserved.fetch_add(kSliceSize, std::memory_order_relaxed);
+         if (begin >= fCapacity)
+            throw std::runtime_error("TakeInto: the buffers can hold only " + std::to_string(fCapacity) +
+                                     " values, but more entries are being processed.");
+         slice.fNext = begin;
+         slice.fEnd = std::min(begin + kSliceSize, fCapacity);
+      }
+      SetValues(slice.fNext++, std::index_sequence_for<ColTypes...>(), values...);
+   }
+
+   void Finalize()
+   {
+      // the unfilled tails of the slices that were last reserved by each slot, in increasing order
+      const auto nReserved = std::min<std::size_t>(fState->fNReserved, fCapacity);
+      std::vector<std::pair<std::size_t, std::size_t>> gaps;
+      std::size_t nGapElements = 0;
+      for (auto slot = 0u; slot * CacheLineStep<RSlice>() < fState->fSlices.size(); ++slot) {
+         const auto &slice = GetSlice(slot);
+         if (slice.fNext < slice.fEnd) {
+            gaps.emplace_back(slice.fNext, slice.fEnd);
+            nGapElements += slice.fEnd - slice.fNext;
+         }
+      }
+      std::sort(gaps.begin(), gaps.end());
+      const auto nTaken = nReserved - nGapElements;
+
+      // fill the gaps below nTaken with the values stored last, skipping the gaps above nTaken
+      auto from = nReserved;
+      auto gapAbove = gaps.rbegin();
+      for (const auto &gap : gaps) {
+         for (auto to = gap.first; to < std::min(gap.second, nTaken); ++to) {
+            --from;
+            while (gapAbove != gaps.rend() && from < gapAbove->first)
+               ++gapAbove;
+            if (gapAbove != gaps.rend() && from < gapAbove->second)
+               from = gapAbove->first - 1; // gaps never touch, and a value is stored just before each of them
+            MoveValue(to, from, std::index_sequence_for<ColTypes...>());
+         }
+      }
+      *fNTaken = nTaken;
+   }
+
+   std::string GetActionName() { return "TakeInto"; }
+};
+
 template <typename ResultType>
 class R__CLING_PTRCHECK(off) MinHelper : public RActionImpl<MinHelper<ResultType>> {
    std::shared_ptr<ResultType> fResultMin;
@@ -1818,6 +2145,104 @@ public:
    }
 };
 
+/// Type-erased writer for the RNTuple output format of Snapshot.
+/// It drives an RNTupleParallelWriter with one RNTupleFillContext per processing slot, so that clusters are
+/// compressed and written by the slots themselves. Defined in RDFActionHelpers.cxx, to keep the RNTuple headers out of
+/// the interface.
+class RSnapshotRNTupleWriter {
+   struct RImpl;
+   std::unique_ptr<RImpl> fImpl;
+
+public:
+   using OutputRDF_t = ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void>;
+   RSnapshotRNTupleWriter(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                          const ColumnNames_t &fieldNames, const std::vector<std::string> &typeNames,
+                          const RSnapshotOptions &options, std::shared_ptr<OutputRDF_t> outputRDF);
+   RSnapshotRNTupleWriter(const RSnapshotRNTupleWriter &) = delete;
+   RSnapshotRNTupleWriter &operator=(const RSnapshotRNTupleWriter &) = delete;
+   ~RSnapshotRNTupleWriter();
+
+   void Initialize();
+   void InitSlot(unsigned int slot);
+   /// Fill one entry from the given slot; `values` holds the address of the value of each field, in order.
+   void Fill(unsigned int slot, void *const *values);
+   void Finalize();
+   bool HasRun() const;
+};
+
+/// Helper object for a Snapshot action that writes an RNTuple, both single- and multi-thread.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fDirName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fInputColumnNames; // This contains the resolved aliases
+   ColumnNames_t fOutputFieldNames;
+   std::shared_ptr<RSnapshotRNTupleWriter::OutputRDF_t> fOutputRDF;
+   std::unique_ptr<RSnapshotRNTupleWriter> fWriter; // must be a ptr because the writer is not movable
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &vbnames, const ColumnNames_t &bnames,
+                         const RSnapshotOptions &options,
+                         std::shared_ptr<RSnapshotRNTupleWriter::OutputRDF_t> outputRDF)
+      : fNSlots(nSlots), fFileName(filename), fDirName(dirname), fNTupleName(ntuplename), fOptions(options),
+        fInputColumnNames(vbnames), fOutputFieldNames(ReplaceDotWithUnderscore(bnames)),
+        fOutputRDF(std::move(outputRDF))
+   {
+      if (!fDirName.empty())
+         throw std::invalid_argument("Snapshot: writing an RNTuple into a TFile subdirectory is not supported");
+      ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+   }
+
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && fOptions.fLazy && (!fWriter || !fWriter->HasRun()))
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void Initialize()
+   {
+      fWriter = std::make_unique<RSnapshotRNTupleWriter>(fNSlots, fFileName, fNTupleName, fOutputFieldNames,
+                                                         std::vector<std::string>{TypeID2TypeName(typeid(ColTypes))...},
+                                                         fOptions, fOutputRDF);
+      fWriter->Initialize();
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot) { fWriter->InitSlot(slot); }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      void *const addresses[] = {static_cast<void *>(&values)..., nullptr};
+      fWriter->Fill(slot, addresses);
+   }
+
+   void Finalize() { fWriter->Finalize(); }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   /**
+    * @brief Create a new SnapshotRNTupleHelper with a different output file name
+    *
+    * @param newName A type-erased string with the output file name
+    * @return SnapshotRNTupleHelper
+    *
+    * See SnapshotHelper::MakeNew.
+    */
+   SnapshotRNTupleHelper MakeNew(void *newName)
+   {
+      const std::string finalName = *reinterpret_cast<const std::string *>(newName);
+      // the RDF returned by the original Snapshot must keep pointing to the original output
+      return SnapshotRNTupleHelper{fNSlots,          finalName,        fDirName, fNTupleName,
+                                   fInputColumnNames, fOutputFieldNames, fOptions, nullptr};
+   }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
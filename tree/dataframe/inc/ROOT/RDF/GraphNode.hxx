@@ -125,6 +125,10 @@ public:
       };
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Adds the profile summary of the corresponding node of the computation graph to the label
+   void SetProfile(const std::string &summary) { fName += "\\n" + summary; }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Appends a node on the head of the current node
    void SetPrevNode(const std::shared_ptr<GraphNode> &node) { fPrevNode = node; }
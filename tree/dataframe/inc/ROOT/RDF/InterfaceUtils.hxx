@@ -29,6 +29,8 @@
 #include <ROOT/TypeTraits.hxx>
 #include <TError.h> // gErrorIgnoreLevel
 #include <TH1.h>
+#include <TH2.h>
+#include <TH3.h>
 #include <TROOT.h> // IsImplicitMTEnabled
 
 #include <deque>
@@ -125,6 +127,10 @@ struct HistoUtils<T, false> {
    static bool HasAxisLimits(T &) { return true; }
 };
 
+/// Whether Histo1D, Histo2D and Histo3D actions booked from now on fill a single histogram shared by all slots
+void SetConcurrentHistoFill(bool enable);
+bool IsConcurrentHistoFillEnabled();
+
 // Generic filling (covers Histo2D, Histo3D, HistoND, Profile1D and Profile2D actions, with and without weights)
 template <typename... ColTypes, typename ActionTag, typename ActionResultType, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -144,7 +150,11 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
 {
    auto hasAxisLimits = HistoUtils<::TH1D>::HasAxisLimits(*h);
 
-   if (hasAxisLimits || !IsImplicitMTEnabled()) {
+   if (hasAxisLimits && nSlots > 1 && IsConcurrentHistoFillEnabled()) {
+      using Helper_t = ConcurrentFillHelper<::TH1D, 1>;
+      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+   } else if (hasAxisLimits || !IsImplicitMTEnabled()) {
       using Helper_t = FillHelper<::TH1D>;
       using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
       return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
@@ -155,6 +165,37 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    }
 }
 
+// Histo2D and Histo3D filling (must handle the special case of the concurrent fill into a single histogram)
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH2D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo2D, const RColumnRegister &colRegister)
+{
+   if (nSlots > 1 && IsConcurrentHistoFillEnabled()) {
+      using Helper_t = ConcurrentFillHelper<::TH2D, 2>;
+      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+   }
+   using Helper_t = FillHelper<::TH2D>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH3D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo3D, const RColumnRegister &colRegister)
+{
+   if (nSlots > 1 && IsConcurrentHistoFillEnabled()) {
+      using Helper_t = ConcurrentFillHelper<::TH3D, 3>;
+      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+   }
+   using Helper_t = FillHelper<::TH3D>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
 BuildAction(const ColumnNames_t &bl, const std::shared_ptr<TGraph> &g, const unsigned int nSlots,
@@ -250,6 +291,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// The RDataFrame returned by Snapshot, pointed to the output RNTuple once written. Only used for that format.
+   std::shared_ptr<RSnapshotRNTupleWriter::OutputRDF_t> fOutputRDF;
 };
 
 // Snapshot action
@@ -271,7 +314,14 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
       isDefine[i] = colRegister.IsDefineOrAlias(colNames[i]);
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // single- and multi-thread snapshot to RNTuple, with one fill context per slot
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, colNames, outputColNames, options,
+                                            snapHelperArgs->fOutputRDF),
+                                   colNames, prevNode, colRegister));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -324,6 +374,9 @@ void CheckForNoVariations(const std::string &where, std::string_view definedColV
 
 std::string PrettyPrintAddr(const void *const addr);
 
+/// Set the directory of the cross-run cache of jitted Filter and Define expressions. An empty string disables it.
+void SetJitCacheDir(std::string_view cacheDir);
+
 std::shared_ptr<RJittedFilter> BookFilterJit(std::shared_ptr<RNodeBase> *prevNodeOnHeap, std::string_view name,
                                              std::string_view expression, const ColumnNames_t &branches,
                                              const RColumnRegister &colRegister, TTree *tree, RDataSource *ds);
@@ -728,6 +781,26 @@ struct ParsedTreePath {
 
 ParsedTreePath ParseTreePath(std::string_view fullTreeName);
 
+/// Name of the TTree that holds the entries of a persistent cache, see RInterface::PersistentCache.
+constexpr const char *kPersistentCacheTreeName = "rdfcache";
+
+/// Return the path of the file in cacheDir that holds the persistent cache of the given columns.
+/// The file name is a hash of the user key, the cached columns and their types, the filters and defines upstream
+/// and the input dataset (file names, sizes and modification times).
+std::string GetPersistentCachePath(std::string_view cacheDir, std::string_view key, const ColumnNames_t &columns,
+                                   const std::vector<std::string> &columnTypes,
+                                   const std::vector<std::string> &filterNames, const ColumnNames_t &definedColumns,
+                                   RLoopManager &lm);
+
+/// Return true if path is a complete persistent cache file.
+bool HasPersistentCache(const std::string &path);
+
+/// Create the cache directory if needed and return a process-specific temporary path to write the cache to.
+std::string GetPersistentCacheTmpPath(const std::string &path);
+
+/// Atomically move a freshly written persistent cache file to its final path.
+void CommitPersistentCache(const std::string &tmpPath, const std::string &path);
+
 // Check if a condition is true for all types
 template <bool...>
 struct TBoolPack;
@@ -12,7 +12,9 @@
 #define ROOT_PyROOTHelpers
 
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 
+#include <stdexcept>
 #include <vector>
 #include <string>
 #include <utility>
@@ -69,6 +71,27 @@ ROOT::RDF::RResultPtr<std::vector<T>> RDataFrameTake(ROOT::RDF::RNode df, std::s
    return df.Take<T>(column);
 }
 
+template <typename... ColTypes, std::size_t... Idx>
+ROOT::RDF::RResultPtr<std::size_t>
+RDataFrameTakeIntoImpl(std::index_sequence<Idx...>, ROOT::RDF::RNode df, const std::vector<std::string> &columns,
+                       const std::vector<ULong64_t> &addresses, std::size_t capacity)
+{
+   return ROOT::RDF::Experimental::TakeInto(df, columns, capacity, reinterpret_cast<ColTypes *>(addresses[Idx])...);
+}
+
+/// Write the values of the columns into the buffers at the given addresses, e.g. the data of NumPy arrays, with no
+/// intermediate copy. All buffers must be able to hold `capacity` elements.
+template <typename... ColTypes>
+ROOT::RDF::RResultPtr<std::size_t> RDataFrameTakeInto(ROOT::RDF::RNode df, const std::vector<std::string> &columns,
+                                                      const std::vector<ULong64_t> &addresses, std::size_t capacity)
+{
+   if (addresses.size() != sizeof...(ColTypes))
+      throw std::invalid_argument("RDataFrameTakeInto: the number of buffer addresses does not match the number of "
+                                  "column types.");
+   return RDataFrameTakeIntoImpl<ColTypes...>(std::index_sequence_for<ColTypes...>(), df, columns, addresses,
+                                              capacity);
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
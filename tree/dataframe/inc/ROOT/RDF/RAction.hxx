@@ -19,6 +19,7 @@
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RVariedAction.hxx"
 
+#include <algorithm> // std::count
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
@@ -122,12 +123,28 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevNode.CheckFilters(slot, entry))
+      if (fPrevNode.CheckFilters(slot, entry)) {
+         RNodeCallTimer timer(fProfile.get(), slot);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
    }
 
+   void RunBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask) final
+   {
+      fPrevNode.CheckFiltersBulk(slot, firstEntry, mask);
+      RNodeCallTimer timer(fProfile.get(), slot, fProfile ? std::count(mask.begin(), mask.end(), true) : 0);
+      for (std::size_t i = 0; i < mask.size(); ++i) {
+         if (mask[i])
+            CallExec(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
+   RNodeBase *GetPrevNode() const final { return &fPrevNode; }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -153,6 +170,8 @@ public:
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
       auto thisNode =
          std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName(), visitedMap.size(), nodeType);
+      if (fProfile)
+         thisNode->SetProfile(fProfile->GetSummary());
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
@@ -12,6 +12,7 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
@@ -25,6 +26,7 @@ namespace Detail {
 namespace RDF {
 class RLoopManager;
 class RDefineBase;
+class RNodeBase;
 class RMergeableValueBase;
 } // namespace RDF
 } // namespace Detail
@@ -52,6 +54,10 @@ private:
 
    RColumnRegister fColRegister;
 
+protected:
+   /// Call counters filled during the event loop if profiling is enabled, null otherwise.
+   std::unique_ptr<RNodeProfile> fProfile;
+
 public:
    RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RColumnRegister &colRegister,
                const std::vector<std::string> &prevVariations);
@@ -63,10 +69,24 @@ public:
    RColumnRegister &GetColRegister() { return fColRegister; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
+   /// Start profiling the next event loop from scratch, or stop profiling.
+   void EnableProfile(bool enable);
+   RNodeProfile *GetProfile() const { return fProfile.get(); }
+   /// The name of the action as shown in the computation graph, e.g. "Histo1D".
+   virtual std::string GetActionName() = 0;
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Run the action on the entries [firstEntry, firstEntry + mask.size()) that pass the upstream filters.
+   /// The mask is used as scratch space. The default implementation falls back to one Run call per entry.
+   virtual void RunBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask)
+   {
+      for (std::size_t i = 0; i < mask.size(); ++i)
+         Run(slot, firstEntry + i);
+   }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
+   /// Return the node this action is attached to, or nullptr if not known.
+   virtual RNodeBase *GetPrevNode() const { return nullptr; }
    virtual void FinalizeSlot(unsigned int) = 0;
    virtual void Finalize() = 0;
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// Call counters filled during the event loop if profiling is enabled, null otherwise.
+   std::unique_ptr<RDFInternal::RNodeProfile> fProfile;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -70,6 +73,12 @@ public:
    virtual void FinalizeSlot(unsigned int slot) = 0;
 
    const std::vector<std::string> &GetVariations() const { return fVariationDeps; }
+   /// Start profiling the next event loop from scratch, or stop profiling.
+   void EnableProfile(bool enable);
+   /// Return the profile of this Define, or null if it is not profiled. Overridden by RJittedDefine.
+   virtual RDFInternal::RNodeProfile *GetProfile() const { return fProfile.get(); }
+   const ROOT::RDF::ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
 
    /// Create clones of this Define that work with values in varied "universes".
    virtual void MakeVariations(const std::vector<std::string> &variations) = 0;
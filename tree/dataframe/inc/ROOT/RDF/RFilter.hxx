@@ -96,7 +96,10 @@ public:
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
+            RDFInternal::RNodeCallTimer timer(fProfile.get(), slot);
             auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            if (passed)
+               timer.AddPassed();
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = passed;
@@ -106,6 +109,34 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask) final
+   {
+      auto &result = fLastBulkResult[slot];
+      if (firstEntry != fLastCheckedBulk[slot] || result.size() != mask.size()) {
+         result.resize(mask.size());
+         fPrevNode.CheckFiltersBulk(slot, firstEntry, result);
+         // a tight loop over the block: the filter expression is called directly, without going through the graph
+         ULong64_t nAccepted = 0;
+         ULong64_t nRejected = 0;
+         {
+            const auto nCalls = fProfile ? std::count(result.begin(), result.end(), true) : 0;
+            RDFInternal::RNodeCallTimer timer(fProfile.get(), slot, nCalls);
+            for (std::size_t i = 0; i < result.size(); ++i) {
+               if (!result[i])
+                  continue;
+               const bool passed = CheckFilterHelper(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+               passed ? ++nAccepted : ++nRejected;
+               result[i] = passed;
+            }
+            timer.AddPassed(nAccepted);
+         }
+         fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+         fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+         fLastCheckedBulk[slot] = firstEntry;
+      }
+      std::copy(result.begin(), result.end(), mask.begin());
+   }
+
    template <typename ColType>
    auto GetValueChecked(unsigned int slot, std::size_t readerIdx, Long64_t entry) -> ColType &
    {
@@ -164,6 +195,8 @@ public:
       fPrevNode.IncrChildrenCount();
    }
 
+   RNodeBase *GetPrevNode() const final { return &fPrevNode; }
+
    void AddFilterName(std::vector<std::string> &filters) final
    {
       fPrevNode.AddFilterName(filters);
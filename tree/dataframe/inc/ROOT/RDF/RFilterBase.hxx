@@ -13,11 +13,13 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
 
 #include <cassert>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -47,7 +49,13 @@ protected:
    /// The nth flag signals whether the nth input column is a custom column or not.
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
+   /// First entry of the block last evaluated by CheckFiltersBulk, per slot. -1 if no block was evaluated yet.
+   std::vector<Long64_t> fLastCheckedBulk;
+   /// Results of the block last evaluated by CheckFiltersBulk, per slot.
+   std::vector<ROOT::RVecB> fLastBulkResult;
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// Call counters filled during the event loop if profiling is enabled, null otherwise.
+   std::unique_ptr<RDFInternal::RNodeProfile> fProfile;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -60,6 +68,8 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   const ROOT::RDF::ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
@@ -72,6 +82,9 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   /// Start profiling the next event loop from scratch, or stop profiling.
+   void EnableProfile(bool enable);
+   RDFInternal::RNodeProfile *GetProfile() const { return fProfile.get(); }
 };
 
 } // ns RDF
@@ -108,7 +108,10 @@ public:
             fLastResult[slot * cacheLineStepint] = false;
          } else {
             // evaluate this filter, cache the result
+            RDFInternal::RNodeCallTimer timer(fProfile.get(), slot);
             const bool valueIsMissing = fValues[slot]->template TryGet<void>(entry) == nullptr;
+            if (valueIsMissing != fDiscardEntryWithMissingValue)
+               timer.AddPassed();
             if (fDiscardEntryWithMissingValue) {
                valueIsMissing ? ++fRejected[slot * cacheLineStepULong64_t] : ++fAccepted[slot * cacheLineStepULong64_t];
                fLastResult[slot * cacheLineStepint] = !valueIsMissing;
@@ -122,6 +125,34 @@ public:
       return fLastResult[slot * cacheLineStepint];
    }
 
+   void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask) final
+   {
+      auto &result = fLastBulkResult[slot];
+      if (firstEntry != fLastCheckedBulk[slot] || result.size() != mask.size()) {
+         result.resize(mask.size());
+         fPrevNodePtr->CheckFiltersBulk(slot, firstEntry, result);
+         ULong64_t nAccepted = 0;
+         ULong64_t nRejected = 0;
+         {
+            const auto nCalls = fProfile ? std::count(result.begin(), result.end(), true) : 0;
+            RDFInternal::RNodeCallTimer timer(fProfile.get(), slot, nCalls);
+            for (std::size_t i = 0; i < result.size(); ++i) {
+               if (!result[i])
+                  continue;
+               const bool valueIsMissing = fValues[slot]->template TryGet<void>(firstEntry + i) == nullptr;
+               const bool passed = fDiscardEntryWithMissingValue ? !valueIsMissing : valueIsMissing;
+               passed ? ++nAccepted : ++nRejected;
+               result[i] = passed;
+            }
+            timer.AddPassed(nAccepted);
+         }
+         fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+         fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+         fLastCheckedBulk[slot] = firstEntry;
+      }
+      std::copy(result.begin(), result.end(), mask.begin());
+   }
+
    ROOT::Detail::RDF::RColumnReaderBase *GetOrCreateColumnReader(TTreeReader *r, unsigned int slot)
    {
       // Try to check if there is an available reader from the column register first
@@ -178,6 +209,8 @@ public:
       fPrevNodePtr->IncrChildrenCount();
    }
 
+   RNodeBase *GetPrevNode() const final { return fPrevNodePtr.get(); }
+
    void AddFilterName(std::vector<std::string> &filters) final
    {
       fPrevNodePtr->AddFilterName(filters);
@@ -90,6 +90,10 @@ namespace RDF {
 class GraphCreatorHelper;
 void ChangeEmptyEntryRange(const ROOT::RDF::RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
 void ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+void SetBulkSize(const ROOT::RDF::RNode &node, std::size_t bulkSize);
+void SetProfiling(const ROOT::RDF::RNode &node, bool enable);
+std::string GetProfileAsJSON(const ROOT::RDF::RNode &node);
+void SetNFilesToPrefetch(const ROOT::RDF::RNode &node, unsigned int nFiles);
 void TriggerRun(ROOT::RDF::RNode node);
 std::string GetDataSourceLabel(const ROOT::RDF::RNode &node);
 } // namespace RDF
@@ -124,6 +128,10 @@ class RInterface : public RInterfaceBase {
    friend void RDFInternal::TriggerRun(RNode node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
    friend void RDFInternal::ChangeSpec(const RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   friend void RDFInternal::SetBulkSize(const RNode &node, std::size_t bulkSize);
+   friend void RDFInternal::SetProfiling(const RNode &node, bool enable);
+   friend std::string RDFInternal::GetProfileAsJSON(const RNode &node);
+   friend void RDFInternal::SetNFilesToPrefetch(const RNode &node, unsigned int nFiles);
    friend std::string ROOT::Internal::RDF::GetDataSourceLabel(const RNode &node);
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -1277,6 +1285,14 @@ public:
    /// not meant to be written out with that name (which is not a valid C++ variable name). Instead, go through an
    /// Alias(): `df.Alias("nbar", "#bar").Snapshot(..., {"nbar"})`.
    ///
+   /// ### Writing an RNTuple
+   ///
+   /// Setting `RSnapshotOptions::fOutputFormat` to `ESnapshotOutputFormat::kRNTuple` writes an RNTuple instead of a
+   /// TTree. Each processing slot fills its own context of an RNTupleParallelWriter, so that clusters are compressed
+   /// and written in parallel without a merging step. As for TTrees written in multi-thread runs, clusters of entries
+   /// can be shuffled with respect to the input. Writing into a sub-directory and the TTree-specific options
+   /// (`fAutoFlush`, `fSplitLevel`) are not supported for this format.
+   ///
    /// ### Example invocations:
    ///
    /// ~~~{.cpp}
@@ -1338,7 +1354,7 @@ public:
 
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(
          RDFInternal::SnapshotHelperArgs{std::string(filename), std::string(dirname), std::string(treename),
-                                         colListWithAliasesAndSizeBranches, options});
+                                         colListWithAliasesAndSizeBranches, options, nullptr});
 
       ::TDirectory::TContext ctxt;
 
@@ -1347,8 +1363,15 @@ public:
       // filename we are using here corresponds to a file which does not exist yet,
       // i.e. the output file of the Snapshot call. Thus, checkFile=false will
       // prevent the function from trying to open a non-existent file.
-      auto newRDF = std::make_shared<RInterface<RLoopManager>>(ROOT::Detail::RDF::CreateLMFromTTree(
-         fullTreeName, filename, colListNoAliasesWithSizeBranches, /*checkFile*/ false));
+      // An RNTuple output is instead attached to the returned RDataFrame by the Snapshot action, once written.
+      std::shared_ptr<RInterface<RLoopManager>> newRDF;
+      if (options.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         newRDF = std::make_shared<RInterface<RLoopManager>>(std::make_shared<RLoopManager>(0ull));
+         snapHelperArgs->fOutputRDF = newRDF;
+      } else {
+         newRDF = std::make_shared<RInterface<RLoopManager>>(ROOT::Detail::RDF::CreateLMFromTTree(
+            fullTreeName, filename, colListNoAliasesWithSizeBranches, /*checkFile*/ false));
+      }
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -1549,6 +1572,51 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns to a file in a local cache directory, or reuse the file of a previous run.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] cacheDir directory that holds the cache files. It is created if it does not exist.
+   /// \param[in] key user-provided tag that is part of the cache key.
+   /// \return a `RDataFrame` that reads the cached dataset.
+   ///
+   /// Unlike Cache(), which keeps the values in memory, this method writes them to a TTree in a file in `cacheDir`,
+   /// so it works for datasets larger than memory and it survives across processes. The cached dataset is read back
+   /// like any other ROOT file, with implicit multi-threading if enabled.
+   ///
+   /// The cache file is identified by a hash of the cached columns and their types, the names of the filters and
+   /// defined columns upstream, the input files (names, sizes and modification times) and `key`. If a matching file
+   /// exists, no event loop is run and the file is reused; otherwise the columns are snapshotted into a temporary
+   /// file that is renamed once complete, so that concurrent processes never read a partial cache.
+   /// Note that the bodies of the Filter and Define expressions are not part of the hash: change `key` whenever the
+   /// computation changes without changing names.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto cached = df.Filter("pt > 20", "ptCut").Define("pt2", "pt*pt").PersistentCache({"pt", "pt2"}, "/tmp/rdfcache", "v1");
+   /// ~~~
+   RInterface<RLoopManager>
+   PersistentCache(const ColumnNames_t &columnList, std::string_view cacheDir, std::string_view key = "")
+   {
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "PersistentCache");
+      const auto validColumnNames =
+         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
+      std::vector<std::string> columnTypes;
+      for (const auto &col : validColumnNames)
+         columnTypes.emplace_back(GetColumnType(col));
+
+      const auto cachePath =
+         RDFInternal::GetPersistentCachePath(cacheDir, key, columnListWithoutSizeColumns, columnTypes,
+                                             GetFilterNames(), GetDefinedColumnNames(), *fLoopManager);
+      if (!RDFInternal::HasPersistentCache(cachePath)) {
+         const auto tmpPath = RDFInternal::GetPersistentCacheTmpPath(cachePath);
+         Snapshot(RDFInternal::kPersistentCacheTreeName, tmpPath, columnListWithoutSizeColumns);
+         RDFInternal::CommitPersistentCache(tmpPath, cachePath);
+      }
+
+      return RInterface<RLoopManager>(ROOT::Detail::RDF::CreateLMFromTTree(
+         RDFInternal::kPersistentCacheTreeName, cachePath, columnListWithoutSizeColumns));
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -1558,13 +1626,19 @@ public:
    /// \return the first node of the computation graph for which the event loop is limited to a certain range of entries.
    ///
    /// Note that in case of previous Ranges and Filters the selected range refers to the transformed dataset.
-   /// Ranges are only available if EnableImplicitMT has _not_ been called. Multi-thread ranges are not supported.
+   /// Once the end of the range is reached, the event loop stops early if no other node needs more entries.
+   ///
+   /// In multi-thread event loops (i.e. if EnableImplicitMT was called before constructing the RDataFrame), only
+   /// ranges that start at 0 with stride 1 are supported. They select `end` entries among those that pass the
+   /// upstream filters, but not necessarily the first ones in dataset order, since the processing slots compete for
+   /// them. When the quota is met, all slots stop processing and no new tasks or entry ranges are started.
    ///
    /// ### Example usage:
    /// ~~~{.cpp}
    /// auto d_0_30 = d.Range(0, 30); // Pick the first 30 entries
    /// auto d_15_end = d.Range(15, 0); // Pick all entries from 15 onwards
    /// auto d_15_end_3 = d.Range(15, 0, 3); // Stride: from event 15, pick an event every 3
+   /// auto some_100 = d.Filter("pt > 100").Range(100); // With ImplicitMT: 100 entries that pass the filter
    /// ~~~
    // clang-format on
    RInterface<RDFDetail::RRange<Proxied>, DS_t> Range(unsigned int begin, unsigned int end, unsigned int stride = 1)
@@ -1572,7 +1646,9 @@ public:
       // check invariants
       if (stride == 0 || (end != 0 && end < begin))
          throw std::runtime_error("Range: stride must be strictly greater than 0 and end must be greater than begin.");
-      CheckIMTDisabled("Range");
+      if (fLoopManager->GetNSlots() > 1 && (begin != 0 || stride != 1))
+         throw std::runtime_error("Range: with ImplicitMT enabled, only ranges with begin equal to 0 and stride equal "
+                                  "to 1 are supported.");
 
       using Range_t = RDFDetail::RRange<Proxied>;
       auto rangePtr = std::make_shared<Range_t>(begin, end, stride, fProxiedPtr);
@@ -3172,7 +3248,8 @@ private:
       const auto &dirname = parsedTreePath.fDirName;
 
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
-         std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
+         std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options,
+         nullptr});
 
       ::TDirectory::TContext ctxt;
 
@@ -3181,8 +3258,15 @@ private:
       // filename we are using here corresponds to a file which does not exist yet,
       // i.e. the output file of the Snapshot call. Thus, checkFile=false will
       // prevent the function from trying to open a non-existent file.
-      auto newRDF = std::make_shared<RInterface<RLoopManager>>(ROOT::Detail::RDF::CreateLMFromTTree(
-         fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns, /*checkFile=*/false));
+      // An RNTuple output is instead attached to the returned RDataFrame by the Snapshot action, once written.
+      std::shared_ptr<RInterface<RLoopManager>> newRDF;
+      if (options.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         newRDF = std::make_shared<RInterface<RLoopManager>>(std::make_shared<RLoopManager>(0ull));
+         snapHelperArgs->fOutputRDF = newRDF;
+      } else {
+         newRDF = std::make_shared<RInterface<RLoopManager>>(ROOT::Detail::RDF::CreateLMFromTTree(
+            fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns, /*checkFile=*/false));
+      }
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
@@ -54,6 +54,8 @@ public:
    ~RJittedDefine();
 
    void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   /// Return the concrete RDefine, or nullptr if jitting did not happen yet.
+   RDefineBase *GetConcreteDefine() const { return fConcreteDefine.get(); }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
@@ -63,6 +65,7 @@ public:
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
    RDefineBase &GetVariedDefine(const std::string &variationName) final;
+   RDFInternal::RNodeProfile *GetProfile() const final;
 };
 
 } // ns RDF
@@ -107,6 +107,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedDefine;
+class RJittedFilter;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -157,6 +159,16 @@ class RLoopManager : public RNodeBase {
    RDFInternal::RNewSampleNotifier fNewSampleNotifier;
    std::vector<ROOT::RDF::RSampleInfo> fSampleInfos;
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Number of entries handed to the nodes at a time in bulk execution mode. Zero means one entry at a time.
+   std::size_t fBulkSize{0};
+   /// Whether the current event loop runs in bulk execution mode, see InitNodes().
+   bool fRunBulk{false};
+   /// Scratch selection masks for bulk execution, one per slot.
+   std::vector<ROOT::RVecB> fBulkMasks;
+   /// Whether the nodes of the next event loops record their call counts and timings, see RNodeProfile.
+   bool fProfiling{false};
+   /// Number of files of a TChain opened in advance while the current file is processed, see RChainFilePrefetcher.
+   unsigned int fNFilesToPrefetch{0};
 
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
@@ -173,6 +185,8 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries);
+   bool CanRunBulk() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
@@ -181,6 +195,8 @@ class RLoopManager : public RNodeBase {
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
+   void FindUsedDefines();
+   void SetDataSourceRequiredColumns();
 
    // List of branches for which we want to suppress the printed error about
    // missing branch when switching to a new tree. This is modified by readers,
@@ -192,6 +208,15 @@ class RLoopManager : public RNodeBase {
    std::set<std::pair<std::string_view, std::unique_ptr<ROOT::Internal::RDF::RVariationsWithReaders>>>
       fUniqueVariationsWithReaders;
 
+   /// Jitted Defines and unnamed Filters booked so far, keyed by a signature of expression and resolved inputs.
+   /// Booking the same computation twice returns the node that was booked first (common-subexpression elimination).
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fJittedDefines;
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fJittedFilters;
+   /// Defines needed by at least one booked action or filter, filled by FindUsedDefines() at the start of each loop.
+   std::unordered_set<RDefineBase *> fUsedDefines;
+   /// Whether InitNodeSlots and CleanUpTask can skip the defines that are not in fUsedDefines.
+   bool fSkipUnusedDefines{false};
+
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
    RLoopManager(std::unique_ptr<TTree> tree, const ColumnNames_t &defaultBranches);
@@ -227,6 +252,7 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   void CheckFiltersBulk(unsigned int, Long64_t, ROOT::RVecB &mask) final;
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -237,6 +263,11 @@ public:
    void ToJitExec(const std::string &) const;
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   void SetBulkSize(std::size_t bulkSize) { fBulkSize = bulkSize; }
+   std::size_t GetBulkSize() const { return fBulkSize; }
+   void SetProfiling(bool enable) { fProfiling = enable; }
+   std::string GetProfileAsJSON() const;
+   void SetNFilesToPrefetch(unsigned int nFiles) { fNFilesToPrefetch = nFiles; }
    bool HasDataSourceColumnReaders(const std::string &col, const std::type_info &ti) const;
    void AddDataSourceColumnReaders(const std::string &col, std::vector<std::unique_ptr<RColumnReaderBase>> &&readers,
                                    const std::type_info &ti);
@@ -278,6 +309,11 @@ public:
       return fUniqueVariationsWithReaders;
    }
 
+   std::shared_ptr<RJittedDefine> GetJittedDefine(const std::string &signature);
+   void AddJittedDefine(const std::string &signature, const std::shared_ptr<RJittedDefine> &jittedDefine);
+   std::shared_ptr<RJittedFilter> GetJittedFilter(const std::string &signature);
+   void AddJittedFilter(const std::string &signature, const std::shared_ptr<RJittedFilter> &jittedFilter);
+
    std::vector<std::string> &GetSuppressErrorsForMissingBranches() { return fSuppressErrorsForMissingBranches; }
    const std::vector<std::string> &GetSuppressErrorsForMissingBranches() const
    {
@@ -11,9 +11,11 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,7 +46,9 @@ class RNodeBase {
 protected:
    RLoopManager *fLoopManager;
    unsigned int fNChildren{0};      ///< Number of nodes of the functional graph hanging from this object
-   unsigned int fNStopsReceived{0}; ///< Number of times that a children node signaled to stop processing entries.
+   /// Number of times that a children node signaled to stop processing entries. Atomic because in multi-thread event
+   /// loops the signal is sent by one processing slot and checked by the others.
+   std::atomic<unsigned int> fNStopsReceived{0};
    std::vector<std::string> fVariations; ///< List of systematic variations that affect this node.
 
 public:
@@ -54,6 +58,14 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Bulk version of CheckFilters: evaluate the entries [firstEntry, firstEntry + mask.size()) in one go and store
+   /// in mask whether each of them passes all filters up to this node. Used by RLoopManager in bulk execution mode.
+   /// The default implementation falls back to one CheckFilters call per entry.
+   virtual void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask)
+   {
+      for (std::size_t i = 0; i < mask.size(); ++i)
+         mask[i] = CheckFilters(slot, firstEntry + i);
+   }
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -71,6 +83,9 @@ public:
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
 
+   /// Return the node this one is attached to, or nullptr for the RLoopManager (and for nodes that do not know it).
+   virtual RNodeBase *GetPrevNode() const { return nullptr; }
+
    const std::vector<std::string> &GetVariations() const { return fVariations; }
 
    /// Return a clone of this node that acts as a Filter working with values in the variationName "universe".
@@ -0,0 +1,107 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODEPROFILE
+#define ROOT_RDF_RNODEPROFILE
+
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Per-slot counters of the calls to a node of the computation graph, filled when profiling is enabled.
+///
+/// Reading the clock around every call would cost as much as a cheap Filter expression, so only one call every
+/// kSamplingPeriod is timed and the time of all calls is extrapolated from the timed ones. Blocks of entries in bulk
+/// execution mode are always timed.
+class RNodeProfile {
+public:
+   struct RSlotStats {
+      ULong64_t fNCalls = 0;  ///< Number of entries evaluated by the node
+      ULong64_t fNPassed = 0; ///< Number of evaluated entries that passed the node (Filters only)
+      ULong64_t fNTimed = 0;  ///< Number of evaluated entries whose evaluation was timed
+      ULong64_t fTimedNs = 0; ///< Time spent in the timed evaluations, in nanoseconds
+   };
+
+   static constexpr ULong64_t kSamplingPeriod = 16;
+
+private:
+   std::vector<RSlotStats> fStats; ///< One entry per slot, spaced by CacheLineStep to avoid false sharing
+   unsigned int fNSlots;
+   bool fHasPassRate; ///< Whether fNPassed is meaningful for this node
+
+public:
+   RNodeProfile(unsigned int nSlots, bool hasPassRate)
+      : fStats(nSlots * CacheLineStep<RSlotStats>()), fNSlots(nSlots), fHasPassRate(hasPassRate)
+   {
+   }
+
+   RSlotStats &GetSlotStats(unsigned int slot) { return fStats[slot * CacheLineStep<RSlotStats>()]; }
+   const RSlotStats &GetSlotStats(unsigned int slot) const { return fStats[slot * CacheLineStep<RSlotStats>()]; }
+   unsigned int GetNSlots() const { return fNSlots; }
+   bool HasPassRate() const { return fHasPassRate; }
+
+   RSlotStats GetTotals() const;
+   /// Estimated time spent in all the calls counted by `stats`, in seconds.
+   static double GetEstimatedTime(const RSlotStats &stats);
+   /// A one-line summary of the totals, e.g. "0.12 s, 1000 calls, 45.2% passed".
+   std::string GetSummary() const;
+};
+
+/// Measures one call, or one block of calls, to a profiled node. Does nothing if the profile is null.
+class RNodeCallTimer {
+   RNodeProfile::RSlotStats *fStats = nullptr;
+   ULong64_t fNCalls = 0;
+   bool fIsTimed = false;
+   std::chrono::steady_clock::time_point fStart;
+
+public:
+   RNodeCallTimer(RNodeProfile *profile, unsigned int slot, ULong64_t nCalls = 1)
+   {
+      if (profile == nullptr)
+         return;
+      fStats = &profile->GetSlotStats(slot);
+      fNCalls = nCalls;
+      fIsTimed = nCalls > 1 || (nCalls == 1 && fStats->fNCalls % RNodeProfile::kSamplingPeriod == 0);
+      if (fIsTimed)
+         fStart = std::chrono::steady_clock::now();
+   }
+
+   RNodeCallTimer(const RNodeCallTimer &) = delete;
+   RNodeCallTimer &operator=(const RNodeCallTimer &) = delete;
+
+   ~RNodeCallTimer()
+   {
+      if (fStats == nullptr)
+         return;
+      if (fIsTimed) {
+         const auto elapsed = std::chrono::steady_clock::now() - fStart;
+         fStats->fTimedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+         fStats->fNTimed += fNCalls;
+      }
+      fStats->fNCalls += fNCalls;
+   }
+
+   void AddPassed(ULong64_t nPassed = 1)
+   {
+      if (fStats != nullptr)
+         fStats->fNPassed += nPassed;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RNODEPROFILE
@@ -66,28 +66,52 @@ public:
    /// Ranges act as filters when it comes to selecting entries that downstream nodes should process
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
-      if (entry != fLastCheckedEntry) {
-         if (fHasStopped)
+      auto &lastCheckedEntry = fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()];
+      auto &lastResult = fLastResult[slot * RDFInternal::CacheLineStep<int>()];
+      if (entry != lastCheckedEntry) {
+         if (fHasStopped.load(std::memory_order_relaxed))
             return false;
          if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
-            fLastResult = false;
+            lastResult = false;
          } else {
             // apply range filter logic, cache the result
-            if (fNProcessedEntries < fStart || (fStop > 0 && fNProcessedEntries >= fStop) ||
-                (fStride != 1 && (fNProcessedEntries - fStart) % fStride != 0))
-               fLastResult = false;
-            else
-               fLastResult = true;
-            ++fNProcessedEntries;
-            if (fNProcessedEntries == fStop) {
-               fHasStopped = true;
+            bool isLast = false;
+            lastResult = IsInRange(CountProcessedEntry(), isLast);
+            if (isLast)
                fPrevNode.StopProcessing();
+         }
+         lastCheckedEntry = entry;
+      }
+      return lastResult;
+   }
+
+   void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask) final
+   {
+      auto &lastBulkResult = fLastBulkResult[slot];
+      if (firstEntry != fLastCheckedBulk[slot] || lastBulkResult.size() != mask.size()) {
+         lastBulkResult.resize(mask.size());
+         if (fHasStopped.load(std::memory_order_relaxed)) {
+            std::fill(lastBulkResult.begin(), lastBulkResult.end(), false);
+         } else {
+            fPrevNode.CheckFiltersBulk(slot, firstEntry, lastBulkResult);
+            for (auto &&passed : lastBulkResult) {
+               if (!passed)
+                  continue;
+               if (fHasStopped.load(std::memory_order_relaxed)) {
+                  passed = false;
+                  continue;
+               }
+               // same range filter logic as in CheckFilters
+               bool isLast = false;
+               passed = IsInRange(CountProcessedEntry(), isLast);
+               if (isLast)
+                  fPrevNode.StopProcessing();
             }
          }
-         fLastCheckedEntry = entry;
+         fLastCheckedBulk[slot] = firstEntry;
       }
-      return fLastResult;
+      std::copy(lastBulkResult.begin(), lastBulkResult.end(), mask.begin());
    }
 
    // recursive chain of `Report`s
@@ -111,6 +135,8 @@ public:
          fPrevNode.IncrChildrenCount();
    }
 
+   RNodeBase *GetPrevNode() const final { return &fPrevNode; }
+
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) final { fPrevNode.AddFilterName(filters); }
    std::shared_ptr<RDFGraphDrawing::GraphNode>
@@ -12,9 +12,12 @@
 #define ROOT_RRANGEBASE
 
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
 #include "RtypesCore.h"
 
+#include <atomic>
 #include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -35,13 +38,39 @@ protected:
    unsigned int fStart;
    unsigned int fStop;
    unsigned int fStride;
-   Long64_t fLastCheckedEntry{-1};
-   bool fLastResult{true};
-   ULong64_t fNProcessedEntries{0};
-   bool fHasStopped{false};    ///< True if the end of the range has been reached
+   std::vector<Long64_t> fLastCheckedEntry;
+   std::vector<int> fLastResult; // std::vector<bool> cannot be used in a MT context safely
+   /// Number of entries that passed the upstream filters so far. Shared by all slots in multi-thread event loops,
+   /// where the range can only select the first fStop of them, in whatever order the slots process them.
+   std::atomic<ULong64_t> fNProcessedEntries{0};
+   std::atomic<bool> fHasStopped{false}; ///< True if the end of the range has been reached
+   std::vector<Long64_t> fLastCheckedBulk;   ///< First entry of the block last evaluated by CheckFiltersBulk, per slot
+   std::vector<ROOT::RVecB> fLastBulkResult; ///< Results of the block last evaluated by CheckFiltersBulk, per slot
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
    std::unordered_map<std::string, std::shared_ptr<RRangeBase>> fVariedRanges;
 
+   /// Count one more entry that passed the upstream filters and return the number of entries counted before it.
+   ULong64_t CountProcessedEntry()
+   {
+      if (fNSlots == 1) {
+         // no contention: avoid the cost of an atomic read-modify-write
+         const auto n = fNProcessedEntries.load(std::memory_order_relaxed);
+         fNProcessedEntries.store(n + 1, std::memory_order_relaxed);
+         return n;
+      }
+      return fNProcessedEntries.fetch_add(1, std::memory_order_relaxed);
+   }
+
+   /// Whether the entry that was counted after `n` other entries is in the range. Marks the range as stopped, and
+   /// returns true in `isLast`, for the entry that completes it.
+   bool IsInRange(ULong64_t n, bool &isLast)
+   {
+      isLast = fStop > 0 && n + 1 == fStop;
+      if (isLast)
+         fHasStopped = true;
+      return !(n < fStart || (fStop > 0 && n >= fStop) || (fStride != 1 && (n - fStart) % fStride != 0));
+   }
+
 public:
    RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
               const unsigned int nSlots, const std::vector<std::string> &prevVariations);
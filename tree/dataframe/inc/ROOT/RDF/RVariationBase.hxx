@@ -66,6 +66,8 @@ public:
    virtual const std::type_info &GetTypeId() const = 0;
    const std::vector<std::string> &GetColumnNames() const;
    const std::vector<std::string> &GetVariationNames() const;
+   const ColumnNames_t &GetInputColumnNames() const { return fInputColumns; }
+   const RColumnRegister &GetColRegister() const { return fColumnRegister; }
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
@@ -53,6 +53,12 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// For each variation, the index of the first variation with the same upstream node. Upstream nodes that do not
+   /// depend on a variation are shared with the nominal universe, so their result is checked once per entry.
+   std::vector<std::size_t> fPrevNodeOwners;
+   /// Whether the current entry passed the upstream nodes, per slot (outer dimension) and per variation
+   std::vector<std::vector<char>> fPassedFilters;
+
    /// \brief Creates new filter nodes, one per variation, from the upstream nominal one.
    /// \param nominal The nominal filter
    /// \return The varied filters
@@ -89,6 +95,13 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
 
       fLoopManager->Register(this);
 
+      fPrevNodeOwners.resize(fPrevNodes.size());
+      for (std::size_t i = 0; i < fPrevNodes.size(); ++i) {
+         const auto firstWithSameNode = std::find(fPrevNodes.begin(), fPrevNodes.end(), fPrevNodes[i]);
+         fPrevNodeOwners[i] = std::distance(fPrevNodes.begin(), firstWithSameNode);
+      }
+      fPassedFilters.resize(GetNSlots(), std::vector<char>(fPrevNodes.size()));
+
       for (auto i = 0u; i < columnNames.size(); ++i) {
          auto *define = colRegister.GetDefine(columnNames[i]);
          fIsDefine[i] = define != nullptr;
@@ -163,17 +176,27 @@ public:
 
    void Run(unsigned int slot, Long64_t entry) final
    {
+      auto &passed = fPassedFilters[slot];
       for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+         const auto owner = fPrevNodeOwners[varIdx];
+         passed[varIdx] = owner == varIdx ? fPrevNodes[varIdx]->CheckFilters(slot, entry) : passed[owner];
+         if (passed[varIdx]) {
+            RNodeCallTimer timer(fProfile.get(), slot);
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+         }
       }
    }
 
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
    void TriggerChildrenCount() final
    {
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
    }
 
+   /// The node of the nominal universe; the varied ones sit at the same position in the graph.
+   RNodeBase *GetPrevNode() const final { return fPrevNodes[0].get(); }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -219,8 +242,9 @@ public:
 
       // Action nodes do not need to go through CreateFilterNode: they are never common nodes between multiple branches
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
-      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>("Varied " + fHelpers[0].GetActionName(),
-                                                                   visitedMap.size(), nodeType);
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(GetActionName(), visitedMap.size(), nodeType);
+      if (fProfile)
+         thisNode->SetProfile(fProfile->GetSummary());
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
@@ -17,15 +17,23 @@
 #include <ROOT/RDF/RActionBase.hxx>
 #include <ROOT/RDF/RResultMap.hxx>
 #include <ROOT/RResultHandle.hxx> // users of RunGraphs might rely on this transitive include
+#include <ROOT/RVec.hxx>
 #include <ROOT/TypeTraits.hxx>
+#include <TList.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <functional>
 #include <map>
+#include <tuple>
+#include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -65,6 +73,112 @@ auto PassAsVec(F &&f) -> PassAsVecHelper<std::make_index_sequence<N>, T, F>
    return PassAsVecHelper<std::make_index_sequence<N>, T, F>(std::forward<F>(f));
 }
 
+/// Maps the key values of the entries of the right dataset of a join to the numbers of those entries.
+class RJoinIndex {
+   struct RKeyHash {
+      std::size_t operator()(const ROOT::RVec<ULong64_t> &key) const;
+   };
+   struct RKeyEqual {
+      bool operator()(const ROOT::RVec<ULong64_t> &a, const ROOT::RVec<ULong64_t> &b) const
+      {
+         return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+      }
+   };
+
+   std::unordered_map<ROOT::RVec<ULong64_t>, ROOT::RVec<ULong64_t>, RKeyHash, RKeyEqual> fIndex;
+   const ROOT::RVec<ULong64_t> fNoMatches;
+
+public:
+   /// The i-th element of `keys` is the key of the i-th entry.
+   explicit RJoinIndex(const std::vector<ROOT::RVec<ULong64_t>> &keys);
+   /// The entries with the given key, in increasing order.
+   const ROOT::RVec<ULong64_t> &GetMatches(const ROOT::RVec<ULong64_t> &key) const;
+};
+
+/// The expression of the column that holds the values of the key columns of a join, converted to ULong64_t.
+std::string GetJoinKeyExpression(const std::vector<std::string> &keyColumns);
+/// A new name for the internal columns of a join, unique within the process.
+std::string GetJoinColumnName(std::string_view what);
+
+template <typename T>
+ROOT::RDF::RNode DefineJoinedColumn(ROOT::RDF::RNode node, const std::string &name, const std::string &matchesColumn,
+                                    const std::vector<T> &rightValues)
+{
+   auto values = std::make_shared<const ROOT::RVec<T>>(rightValues.begin(), rightValues.end());
+   auto gather = [values](const ROOT::RVec<ULong64_t> &matches) { return ROOT::VecOps::Take(*values, matches); };
+   return node.Define(name, gather, {matchesColumn});
+}
+
+template <typename... ValueTypes, std::size_t... Idx>
+ROOT::RDF::RNode DefineJoinedColumns(std::index_sequence<Idx...>, ROOT::RDF::RNode node,
+                                     const std::vector<std::string> &names, const std::string &matchesColumn,
+                                     std::tuple<ROOT::RDF::RResultPtr<std::vector<ValueTypes>>...> &values)
+{
+   int expander[] = {(node = DefineJoinedColumn(node, names[Idx], matchesColumn, *std::get<Idx>(values)), 0)..., 0};
+   (void)expander;
+   return node;
+}
+
+/// Merge a partial result in another, for types that can be merged like histograms.
+template <typename T>
+auto MergePartialResult(T &into, const T &other, int) -> decltype(into.Merge(std::declval<TCollection *>()), void())
+{
+   TList list;
+   list.Add(const_cast<T *>(&other));
+   into.Merge(&list);
+}
+
+/// Merge a partial result in another, for types that can be summed like counts.
+template <typename T>
+auto MergePartialResult(T &into, const T &other, long) -> decltype(into += other, void())
+{
+   into += other;
+}
+
+/// The state shared by the slots of an event loop that stream merged partial results.
+///
+/// Each slot publishes a copy of its partial result, replacing the one it published before. The slot that publishes
+/// then merges all the published copies and passes them to the callback, unless another slot is already doing so or
+/// the previous merge is too recent: workers never wait for each other.
+template <typename T>
+class RMergedPartialResults {
+   std::vector<std::shared_ptr<const T>> fPublished; ///< Accessed with std::atomic_load and std::atomic_store only
+   std::mutex fMergeMutex;
+   std::chrono::steady_clock::time_point fLastMerge; ///< Guarded by fMergeMutex
+   std::chrono::steady_clock::duration fMinInterval;
+   std::function<void(const T &)> fCallback;
+
+public:
+   RMergedPartialResults(unsigned int nSlots, std::chrono::steady_clock::duration minInterval,
+                         std::function<void(const T &)> callback)
+      : fPublished(nSlots), fMinInterval(minInterval), fCallback(std::move(callback))
+   {
+   }
+
+   void Publish(unsigned int slot, const T &partialResult)
+   {
+      std::atomic_store(&fPublished[slot], std::shared_ptr<const T>(std::make_shared<T>(partialResult)));
+
+      std::unique_lock<std::mutex> lock(fMergeMutex, std::try_to_lock);
+      const auto now = std::chrono::steady_clock::now();
+      if (!lock.owns_lock() || (fLastMerge.time_since_epoch().count() != 0 && now - fLastMerge < fMinInterval))
+         return;
+      fLastMerge = now;
+
+      std::unique_ptr<T> merged;
+      for (auto &published : fPublished) {
+         const auto copy = std::atomic_load(&published);
+         if (!copy)
+            continue;
+         if (merged)
+            MergePartialResult(*merged, *copy, 0);
+         else
+            merged.reset(new T(*copy));
+      }
+      fCallback(*merged);
+   }
+};
+
 } // namespace RDF
 } // namespace Internal
 
@@ -297,6 +411,246 @@ void AddProgressBar(ROOT::RDF::RNode df);
 /// For more details see ROOT::RDF::Experimental::ProgressHelper Class.
 void AddProgressBar(ROOT::RDataFrame df);
 
+/// \brief Enable bulk execution for the computation graph of a ROOT::RDF::RNode
+/// \param[in] df Any node of the computation graph.
+/// \param[in] bulkSize Number of entries handed to the nodes at a time, 0 disables bulk execution.
+///
+/// In bulk execution mode the event loop processes blocks of entries instead of single entries: each Filter
+/// evaluates its expression in a tight loop over all entries of the block that passed the upstream filters and
+/// hands a selection mask to its children, and each action then runs on the selected entries of the block.
+/// This saves most of the per-entry virtual calls through the computation graph, which dominate the run time of
+/// graphs with many cheap filters.
+///
+/// Bulk execution is used for empty sources and RNTuple data sources, in the absence of systematic variations.
+/// It falls back to entry-wise processing otherwise. Note that a Define used by several filters or actions might be
+/// evaluated more than once per entry in this mode, so it should only be enabled for graphs with stateless
+/// expressions.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df(1000000);
+/// ROOT::RDF::Experimental::EnableBulkExecution(df);
+/// ~~~
+void EnableBulkExecution(ROOT::RDF::RNode df, std::size_t bulkSize = 256);
+
+/// \brief Profile the nodes of the computation graph of a ROOT::RDF::RNode
+/// \param[in] df Any node of the computation graph.
+/// \param[in] enable Whether the next event loops are profiled.
+///
+/// In a profiled event loop, each Filter, Define and action counts, per processing slot, how many entries it
+/// evaluated, how many of them passed (for Filters) and how long their evaluation took. The time of a Filter or
+/// action includes the time spent in the Defines it evaluates lazily, but not the time of upstream Filters. To keep
+/// the overhead low, only one evaluation every few is timed and the total time is extrapolated from those.
+///
+/// The profile of the last event loop can be retrieved with GetProfileAsJSON. SaveGraph also adds a summary of the
+/// profile to the label of each node.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableProfiling(df);
+/// auto h = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// h->Draw();
+/// std::cout << ROOT::RDF::Experimental::GetProfileAsJSON(df) << '\n';
+/// ROOT::RDF::SaveGraph(df, "graph.dot");
+/// ~~~
+void EnableProfiling(ROOT::RDF::RNode df, bool enable = true);
+
+/// \brief Return the profile of the nodes of the computation graph of a ROOT::RDF::RNode as a JSON string
+/// \param[in] df Any node of the computation graph.
+///
+/// The string contains one object per profiled node, with its type ("Filter", "Define" or "Action"), its name, the
+/// number of evaluated entries ("calls"), the number of entries that passed (Filters only), the estimated time spent
+/// in the node in seconds, and the same numbers for each processing slot:
+/// ~~~{.json}
+/// {"nodes":[{"type":"Filter","name":"Filter","calls":100,"passed":50,"time":1e-06,"slots":[...]}, ...]}
+/// ~~~
+/// See EnableProfiling.
+std::string GetProfileAsJSON(ROOT::RDF::RNode df);
+
+/// \brief Open the next files of a TChain in the background while the current one is processed
+/// \param[in] df Any node of the computation graph.
+/// \param[in] nFiles The maximum number of files opened in advance, zero (the default) disables the prefetching.
+///
+/// When a chain of remote files is processed sequentially, opening each file (connection, metadata, streamer infos)
+/// stalls the event loop at every file switch. With file prefetching, the next nFiles remote files of the chain are
+/// opened asynchronously with TFile::AsyncOpen, and the chain picks up the opened file when it reaches it. Only
+/// files read through XRootD support asynchronous opening, the other files are opened as usual.
+/// With implicit multi-threading, different files are already opened concurrently by different tasks, and this
+/// setting has no effect.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("events", {"root://server//file1.root", "root://server//file2.root", ...});
+/// ROOT::RDF::Experimental::PrefetchFiles(df, 2);
+/// ~~~
+void PrefetchFiles(ROOT::RDF::RNode df, unsigned int nFiles);
+
+/// \brief Book the writing of the values of columns into preallocated contiguous buffers
+/// \param[in] df The node from which the values are taken.
+/// \param[in] columns The names of the columns, one per buffer.
+/// \param[in] capacity The number of elements that each buffer can hold.
+/// \param[in] buffers The buffers, of the same types as the columns.
+/// \return The number of values written in each buffer, available after the event loop.
+///
+/// Contrary to Take, which collects the values of each processing slot in a separate std::vector and concatenates
+/// them at the end of the event loop, the values are written directly at their final place, e.g. in the memory of
+/// a NumPy array: in multi-thread event loops, the slots atomically reserve slices of the buffers and fill them.
+/// The first N elements of each buffer hold the N values taken, and the values of one entry are always at the same
+/// index in all buffers; with implicit multi-threading, however, the entries are not in dataset order.
+/// An exception is thrown if more than `capacity` entries are processed.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df(100);
+/// std::vector<double> x(100);
+/// std::vector<ULong64_t> e(100);
+/// auto nDefined = df.Define("x", "rdfentry_ * 0.5");
+/// auto n = ROOT::RDF::Experimental::TakeInto(nDefined, {"x", "rdfentry_"}, 100, x.data(), e.data());
+/// std::cout << *n << " values taken\n";
+/// ~~~
+template <typename... ColTypes>
+RResultPtr<std::size_t>
+TakeInto(ROOT::RDF::RNode df, const std::vector<std::string> &columns, std::size_t capacity, ColTypes *...buffers)
+{
+   if (columns.size() != sizeof...(ColTypes))
+      throw std::invalid_argument("TakeInto: " + std::to_string(columns.size()) + " columns were passed, but " +
+                                  std::to_string(sizeof...(ColTypes)) + " buffers.");
+   using Helper_t = ROOT::Internal::RDF::TakeIntoHelper<ColTypes...>;
+   return df.Book<ColTypes...>(Helper_t(capacity, df.GetNSlots(), buffers...), columns);
+}
+
+enum class EJoinType {
+   kInner, ///< Only the entries of the left dataset that have matches in the right dataset are kept
+   kLeft   ///< All the entries of the left dataset are kept
+};
+
+/// \brief Join the columns of another dataset to the entries of a dataset, matching them by key columns
+/// \param[in] left The dataset to which the columns are added.
+/// \param[in] right The dataset from which the columns are taken.
+/// \param[in] keyColumns The names of the key columns, which must be of integral types and present in both datasets.
+/// \param[in] rightColumns The names of the columns of `right` to join, one per type in ValueTypes.
+/// \param[in] joinType Whether the entries of `left` without matches are kept.
+/// \return A node of the computation graph of `left` in which each column of `rightColumns` is defined.
+///
+/// A hash index of the keys of `right` is built first, so Join immediately runs an event loop over `right` (in
+/// parallel if implicit multi-threading is enabled) that takes the keys and the values of `rightColumns`. The
+/// entries of `left` are then matched by looking up their keys in the index, without random access to `right`.
+///
+/// Since an RDataFrame cannot produce more entries than its dataset has, an entry of `left` matches any number of
+/// entries of `right`: the joined columns are RVecs holding the values of all the matching entries, in the order of
+/// `right` (they are empty for the unmatched entries kept by a left join).
+/// ~~~{.cpp}
+/// ROOT::RDataFrame events("events", "events.root");  // run, event, ...
+/// ROOT::RDataFrame tracks("tracks", "tracks.root");  // run, event, pt
+/// using ROOT::RDF::Experimental::Join;
+/// auto joined = Join<float>(events, tracks, {"run", "event"}, {"pt"});
+/// auto h = joined.Define("nTracks", "pt.size()").Histo1D("nTracks");
+/// ~~~
+template <typename... ValueTypes>
+ROOT::RDF::RNode Join(ROOT::RDF::RNode left, ROOT::RDF::RNode right, const std::vector<std::string> &keyColumns,
+                      const std::vector<std::string> &rightColumns, EJoinType joinType = EJoinType::kInner)
+{
+   if (keyColumns.empty())
+      throw std::invalid_argument("Join: at least one key column is required.");
+   if (rightColumns.size() != sizeof...(ValueTypes))
+      throw std::invalid_argument("Join: " + std::to_string(rightColumns.size()) + " columns were passed, but " +
+                                  std::to_string(sizeof...(ValueTypes)) + " column types.");
+
+   const auto keyExpression = RDFInternal::GetJoinKeyExpression(keyColumns);
+   const auto keyColumn = RDFInternal::GetJoinColumnName("key");
+   auto rightWithKey = right.Define(keyColumn, keyExpression);
+   auto keys = rightWithKey.Take<ROOT::RVec<ULong64_t>>(keyColumn);
+   std::size_t columnIdx = 0;
+   // the elements of a braced initializer list are evaluated in order
+   std::tuple<RResultPtr<std::vector<ValueTypes>>...> values{
+      rightWithKey.Take<ValueTypes>(rightColumns[columnIdx++])...};
+   auto index = std::make_shared<const RDFInternal::RJoinIndex>(*keys); // runs the event loop over `right`
+
+   const auto matchesColumn = RDFInternal::GetJoinColumnName("matches");
+   auto getMatches = [index](const ROOT::RVec<ULong64_t> &key) {
+      const auto &matches = index->GetMatches(key);
+      // a view of the entry numbers owned by the index
+      return ROOT::RVec<ULong64_t>(const_cast<ULong64_t *>(matches.data()), matches.size());
+   };
+   ROOT::RDF::RNode joined = left.Define(keyColumn, keyExpression).Define(matchesColumn, getMatches, {keyColumn});
+   if (joinType == EJoinType::kInner)
+      joined = joined.Filter([](const ROOT::RVec<ULong64_t> &matches) { return !matches.empty(); }, {matchesColumn});
+   return RDFInternal::DefineJoinedColumns<ValueTypes...>(std::index_sequence_for<ValueTypes...>(), joined,
+                                                          rightColumns, matchesColumn, values);
+}
+
+/// \brief Register a callback that receives the partial results of all slots, merged, while the event loop runs
+/// \param[in] result The result to stream. Its type must have a `Merge(TCollection *)` method, like histograms, or
+///            an `operator+=`, like counts.
+/// \param[in] everyNEvents Number of events that each slot processes between two updates of its partial result.
+/// \param[in] callback A callable with signature `void(const Value_t &)`, where Value_t is the type of the result.
+/// \param[in] minInterval Minimum time between two invocations of the callback.
+///
+/// Contrary to RResultPtr::OnPartialResult, which in multi-thread event loops only sees the partial result of one
+/// slot, the callback receives a merge of the latest partial results of all slots, e.g. to publish a histogram that
+/// covers all the events processed so far with THttpServer.
+///
+/// Every `everyNEvents` events, a slot stores a copy of its partial result. If the callback was not invoked in the
+/// last `minInterval` and no other slot is merging, the slot then merges the copies of all slots and invokes the
+/// callback with the merged result, which is only valid during the call. Slots never wait for each other: the
+/// overhead is one copy of the partial result every `everyNEvents` events and at most one merge per `minInterval`.
+/// The callback is never invoked concurrently and needs not be thread-safe.
+/// ~~~{.cpp}
+/// ROOT::EnableImplicitMT();
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Histo1D({"h", "h", 100, 0, 1}, "x");
+/// TH1D live("live", "live", 100, 0, 1);
+/// std::mutex liveMutex; // also locked by the code that serves `live`
+/// ROOT::RDF::Experimental::OnMergedPartialResult(h, 10000, [&](const TH1D &merged) {
+///    std::lock_guard<std::mutex> lock(liveMutex);
+///    merged.Copy(live);
+/// });
+/// h->Draw(); // runs the event loop
+/// ~~~
+template <typename T>
+RResultPtr<T> &OnMergedPartialResult(RResultPtr<T> &result, ULong64_t everyNEvents,
+                                     std::function<void(const T &)> callback,
+                                     std::chrono::milliseconds minInterval = std::chrono::milliseconds(500))
+{
+   if (everyNEvents == 0)
+      throw std::invalid_argument("OnMergedPartialResult: everyNEvents must be greater than 0.");
+   auto state = std::make_shared<RDFInternal::RMergedPartialResults<T>>(RDFInternal::GetResultNSlots(result),
+                                                                        minInterval, std::move(callback));
+   auto publish = [state](unsigned int slot, T &partialResult) { state->Publish(slot, partialResult); };
+   return result.OnPartialResultSlot(everyNEvents, std::move(publish));
+}
+
+/// \brief Enable the cross-run cache of jitted expressions
+/// \param[in] cacheDir Directory that holds the cache. An empty string disables the cache.
+///
+/// Every string expression passed to Filter, Define and similar transformations is compiled when the computation
+/// graph is booked. With the cache enabled, each new expression is also compiled by ACLiC into a shared library in
+/// `cacheDir`, keyed by a hash of its code (which includes the column types) and of the ROOT version. Later processes
+/// that book the same expression load the library and only declare the function to the interpreter, skipping its
+/// compilation. Expressions that cannot be compiled outside of the interpreter, e.g. because they call functions
+/// that were declared to the interpreter only, are remembered as such and always jitted.
+///
+/// The cache can also be enabled by setting the `ROOT_RDF_JIT_CACHE_DIR` environment variable.
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::EnableJitCache("/tmp/rdfjitcache");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// ~~~
+void EnableJitCache(std::string_view cacheDir);
+
+/// \brief Fill the histograms of Histo1D, Histo2D and Histo3D actions concurrently from all slots
+/// \param[in] enable Whether the actions booked after this call use concurrent filling.
+///
+/// By default, in multi-thread event loops, each slot fills its own copy of the histogram and the copies are merged
+/// at the end of the event loop. For histograms with many bins, e.g. 3D histograms with millions of bins, these
+/// copies cost a lot of memory and their merge takes long. With concurrent filling, all slots fill a single
+/// histogram instead: each slot buffers its fills and flushes them into the shared histogram under a lock.
+///
+/// The setting is read when an action is booked, so it can be toggled to select the strategy per action. It does
+/// not affect Histo1D actions without axis limits, whose binning is only decided at the end of the event loop.
+/// ~~~{.cpp}
+/// ROOT::EnableImplicitMT();
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableConcurrentHistoFill();
+/// auto h3 = df.Histo3D({"h3", "h3", 200, 0, 1, 200, 0, 1, 200, 0, 1}, "x", "y", "z"); // one shared histogram
+/// ROOT::RDF::Experimental::EnableConcurrentHistoFill(false);
+/// auto h1 = df.Histo1D({"h1", "h1", 100, 0, 1}, "x"); // one copy per slot
+/// ~~~
+void EnableConcurrentHistoFill(bool enable = true);
+
 class ProgressBarAction;
 
 /// RDF progress helper.
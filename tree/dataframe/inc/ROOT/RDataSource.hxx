@@ -192,6 +192,21 @@ public:
    // clang-format on
    virtual bool SetEntry(unsigned int slot, ULong64_t entry) = 0;
 
+   // clang-format off
+   /// \brief Inform the data source of the columns that the next event loop will read, right before Initialize().
+   /// \param[in] columns All the data source columns read by the computation graph.
+   /// \param[in] eagerColumns The subset of `columns` read for every entry, i.e. by nodes not preceded by any filter.
+   /// The other columns are only read for the entries that pass at least one filter.
+   ///
+   /// This lets a data source plan its I/O upfront, e.g. reading the (typically small) columns used by the first
+   /// filters before the payload columns that are only needed for the surviving entries. Columns are still obtained
+   /// via GetColumnReaders() as usual. The default implementation ignores this information.
+   // clang-format on
+   virtual void
+   SetRequiredColumns(const std::vector<std::string> & /*columns*/, const std::vector<std::string> & /*eagerColumns*/)
+   {
+   }
+
    // clang-format off
    /// \brief Convenience method called before starting an event-loop.
    /// This method might be called multiple times over the lifetime of a RDataSource, since
@@ -30,10 +30,12 @@
 #include <thread>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ROOT {
 namespace Experimental {
 
+class RClusterDescriptor;
 class RFieldBase;
 class RNTuple;
 class RNTupleDescriptor;
@@ -54,6 +56,16 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
       ULong64_t fFirstEntry = 0; ///< First entry index in fSource
       /// End entry index in fSource, e.g. the number of entries in the range is fLastEntry - fFirstEntry
       ULong64_t fLastEntry = 0;
+      /// The number of entries in the files that precede fSource in the same list of ranges. Used to translate
+      /// source entry numbers into global entry numbers; files (or clusters) can be skipped by cluster filters.
+      ULong64_t fFileOffset = 0;
+   };
+
+   /// A value range on a column registered through AddClusterFilter()
+   struct RClusterFilter {
+      std::string fFieldName; ///< Qualified name of the field that stores the values of the RDF column
+      double fMin = 0;
+      double fMax = 0;
    };
 
    /// A clone of the first pages source's descriptor.
@@ -100,6 +112,15 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    ULong64_t fSeenEntries = 0;                ///< The number of entries so far returned by GetEntryRanges()
    std::vector<REntryRangeDS> fCurrentRanges; ///< Basis for the ranges returned by the last GetEntryRanges() call
    std::vector<REntryRangeDS> fNextRanges;    ///< Basis for the ranges populated by the PrepareNextRanges() call
+   /// The number of entries of all the files covered by fCurrentRanges, including the skipped clusters
+   ULong64_t fNEntriesCurrentRanges = 0;
+   /// The number of entries of all the files covered by fNextRanges, including the skipped clusters
+   ULong64_t fNEntriesNextRanges = 0;
+   /// Clusters whose column statistics show that they contain no values within these ranges are skipped
+   std::vector<RClusterFilter> fClusterFilters;
+   /// Qualified names of the fields that are only read by columns accessed for entries passing the filters.
+   /// Their pages are loaded on demand instead of with their cluster, see SetRequiredColumns().
+   std::unordered_set<std::string> fDeferredFieldNames;
    /// Maps the first entries from the ranges of the last GetEntryRanges() call to their corresponding index in
    /// the fCurrentRanges vectors.  This is necessary because the returned ranges get distributed arbitrarily
    /// onto slots.  In the InitSlot method, the column readers use this map to find the correct range to connect to.
@@ -148,6 +169,11 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    /// Upon return, the fNextRanges list is ordered.  It has usually fNSlots elements; fewer if there
    /// is not enough work to give at least one cluster to every slot.
    void PrepareNextRanges();
+   /// Returns false if the column statistics of the cluster show that it has no entries passing the cluster filters
+   bool IsClusterSelected(const RNTupleDescriptor &desc, const RClusterDescriptor &clusterDesc) const;
+   /// Restricts the entry range [start, end) of the given page source to the span of clusters that may contain
+   /// entries passing the cluster filters. Returns false if no cluster in the range passes the filters.
+   bool ApplyClusterFilters(ROOT::Experimental::Internal::RPageSource &source, ULong64_t &start, ULong64_t &end) const;
 
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Internal::RPageSource> pageSource);
 
@@ -165,11 +191,23 @@ public:
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    std::string GetLabel() final { return "RNTupleDS"; }
 
+   /// Late materialization: the fields that are read only by the lazy columns, i.e. the ones that RDataFrame
+   /// accesses only for entries passing a filter, are deferred (see RPageSource::SetDeferredField()). Their pages
+   /// are read and decompressed only when an entry passing the filters needs them, which saves I/O and
+   /// decompression for selective filters on cheap columns.
+   void SetRequiredColumns(const std::vector<std::string> &columns, const std::vector<std::string> &eagerColumns) final;
    void Initialize() final;
    void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
    void FinalizeSlot(unsigned int slot) final;
    void Finalize() final;
 
+   /// Predicate pushdown: only entries with values of the column `colName` in [min, max] are of interest. Clusters
+   /// for which the column statistics (see RNTupleWriteOptions::SetEnableColumnStatistics()) show that there
+   /// is no such value are skipped. For collection columns, a cluster is skipped if none of the collection elements
+   /// is in the range. The filter is a hint: it does not remove entries of the processed clusters, so
+   /// the corresponding Filter() is still required in the computation graph. Must be called before the event loop.
+   void AddClusterFilter(std::string_view colName, double min, double max);
+
    std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
    GetColumnReaders(unsigned int /*slot*/, std::string_view /*name*/, const std::type_info &) final;
 
@@ -0,0 +1,34 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPARQUETDS
+#define ROOT_RPARQUETDS
+
+#include "ROOT/RDataFrame.hxx"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+
+/// An interval of values of a numerical column of a Parquet file, used to skip row groups when reading it.
+struct RParquetRange {
+   std::string fColumnName;
+   double fMin;
+   double fMax;
+};
+
+RDataFrame FromParquet(std::string_view fileName, const std::vector<std::string> &columnNames = {},
+                       const std::vector<RParquetRange> &ranges = {});
+
+} // namespace RDF
+} // namespace ROOT
+
+#endif
@@ -72,6 +72,13 @@ using SnapshotPtr_t = ROOT::RDF::RResultPtr<ROOT::RDF::RInterface<ROOT::Detail::
  * overwrite the same file.
  */
 SnapshotPtr_t CloneResultAndAction(const SnapshotPtr_t &inptr, const std::string &outputFileName);
+
+/// The number of processing slots of the event loop that produces a result.
+template <typename T>
+unsigned int GetResultNSlots(const ROOT::RDF::RResultPtr<T> &resPtr)
+{
+   return resPtr.fLoopManager->GetNSlots();
+}
 } // namespace RDF
 } // namespace Internal
 
@@ -150,6 +157,7 @@ class RResultPtr {
    friend class RResultHandle;
 
    friend RResultPtr<T> ROOT::Internal::RDF::CloneResultAndAction<T>(const RResultPtr<T> &inptr);
+   friend unsigned int ROOT::Internal::RDF::GetResultNSlots<T>(const RResultPtr<T> &resPtr);
    friend ROOT::Internal::RDF::SnapshotPtr_t
    ROOT::Internal::RDF::CloneResultAndAction(const ROOT::Internal::RDF::SnapshotPtr_t &inptr,
                                              const std::string &outputFileName);
@@ -18,6 +18,14 @@
 namespace ROOT {
 
 namespace RDF {
+
+/// Data format of the output of Snapshot
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently equivalent to kTTree
+   kTTree,   ///< Write a TTree (via TBufferMerger when running multi-threaded)
+   kRNTuple  ///< Write an RNTuple, with one RNTupleParallelWriter fill context per processing slot
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::RCompressionSetting::EAlgorithm::EValues;
@@ -43,6 +51,7 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                            ///< Split level of output tree
    bool fLazy = false;                              ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault; ///< Data format of the output dataset
 };
 } // namespace RDF
 } // namespace ROOT
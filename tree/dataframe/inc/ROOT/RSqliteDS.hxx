@@ -47,6 +47,10 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+SQlite returns the rows of a result set one after the other. The data source reads them in batches into per-column
+buffers, converting only the columns used by the RDF, and hands out one range of each batch to every slot. Only the
+reading of the batch is serialized, the event loop over its rows runs in parallel.
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -61,29 +65,39 @@ private:
    };
    // clang-format on
 
-   /// Used to hold a single "cell" of the SELECT query's result table. Can be changed to std::variant once available.
-   struct Value_t {
-      explicit Value_t(ETypes type);
+   /// Holds the values of one column of the SELECT query's result table for the rows of the current batch.
+   struct Column_t {
+      explicit Column_t(ETypes type) : fType(type) {}
 
       ETypes fType;
-      bool fIsActive; ///< Not all columns of the query are necessarily used by the RDF. Allows for skipping them.
-      Long64_t fInteger;
-      double fReal;
-      std::string fText;
-      std::vector<unsigned char> fBlob;
-      void *fNull;
-      void *fPtr; ///< Points to one of the values; an address to this pointer is returned by GetColumnReadersImpl.
+      /// Not all columns of the query are necessarily used by the RDF. Allows for skipping them.
+      bool fIsActive = false;
+      std::vector<Long64_t> fInteger;
+      std::vector<double> fReal;
+      std::vector<std::string> fText;
+      std::vector<std::vector<unsigned char>> fBlob;
+      void *fNull = nullptr;
+      /// One per slot, points to the value of the slot's current row; an address to it is returned by
+      /// GetColumnReadersImpl.
+      std::vector<void *> fPtrs;
    };
 
    void SqliteError(int errcode);
+   void FetchRow(std::size_t row);
 
    std::unique_ptr<Internal::RSqliteDSDataSet> fDataSet;
    unsigned int fNSlots;
    ULong64_t fNRow;
+   /// The entry number of the first row in the column buffers
+   ULong64_t fFirstRowInBatch;
    std::vector<std::string> fColumnNames;
    std::vector<ETypes> fColumnTypes;
-   /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
-   std::vector<Value_t> fValues;
+   /// Stepping through the result set is inherently serial. GetEntryRanges() therefore reads a batch of rows into
+   /// these column buffers, which are then processed by all the slots in parallel.
+   std::vector<Column_t> fColumns;
+
+   /// The number of rows read per slot and per call to GetEntryRanges()
+   static constexpr std::size_t kBatchRowsPerSlot = 1024;
 
    // clang-format off
    /// Corresponds to the types defined in ETypes.
@@ -26,3 +26,8 @@ RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() = default;
+
+void RActionBase::EnableProfile(bool enable)
+{
+   fProfile = enable ? std::make_unique<RNodeProfile>(fNSlots, /*hasPassRate=*/false) : nullptr;
+}
@@ -17,12 +17,22 @@ The RArrowDS implements a proxy RDataSource to be able to use Apache Arrow
 tables with RDataFrame.
 
 A RDataFrame that adapts an arrow::Table class can be constructed using the factory method
-ROOT::RDF::FromArrow, which accepts one parameter:
+ROOT::RDF::FromArrow, which accepts two parameters:
 1. An arrow::Table smart pointer.
+2. The names of the columns to expose, all the columns of the table if empty.
 
 The types of the columns are derived from the types in the associated
 arrow::Schema.
 
+Alternatively, FromArrow also accepts an arrow::RecordBatchReader, e.g. one that reads a Parquet file or a
+Flight stream. The record batches are then read while the event loop runs, a few at a time, so that datasets
+that do not fit in memory can be processed. Each record batch is processed as one entry range, hence in
+parallel to the other batches when implicit multi-threading is enabled. Since the stream of batches can be
+read only once, such an RDataFrame supports a single event loop.
+
+In both cases, values of primitive and list columns are not copied: the column readers point directly to the
+Arrow buffers, list columns being exposed as RVecs that view the memory of the list values.
+
 */
 // clang-format on
 
@@ -32,6 +42,7 @@ arrow::Schema.
 #include <snprintf.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -41,6 +52,7 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -216,18 +228,31 @@ private:
 
 public:
    TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0)
+   {
+      SetChunks(std::move(chunks), 0);
+      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
+         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
+      }
+   }
+
+   /// Replace the arrays to read from, the first of which starts at `firstEntry`. The addresses returned by
+   /// SlotPtrs() stay valid.
+   void SetChunks(arrow::ArrayVector chunks, ULong64_t firstEntry)
    {
+      fChunks = std::move(chunks);
+      fChunkIndex.clear();
+      fFirstEntryPerChunk.clear();
       fChunkIndex.reserve(fChunks.size());
-      size_t next = 0;
-      for (auto &chunk : chunks) {
+      auto next = firstEntry;
+      for (auto &chunk : fChunks) {
          fFirstEntryPerChunk.push_back(next);
          next += chunk->length();
          fChunkIndex.push_back(next);
       }
-      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
-         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
-      }
+      std::fill(fLastChunkPerSlot.begin(), fLastChunkPerSlot.end(), 0);
+      // force a lookup of the next entry requested by each slot
+      std::fill(fLastEntryPerSlot.begin(), fLastEntryPerSlot.end(), std::numeric_limits<ULong64_t>::max());
    }
 
    /// This returns the ptr to the ptr to actual data.
@@ -386,7 +411,7 @@ public:
 /// \param[in] inColumns the name of the columns to use
 /// In case columns is empty, we use all the columns found in the table
 RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::string> const &inColumns)
-   : fTable{inTable}, fColumnNames{inColumns}
+   : fTable{inTable}, fSchema{inTable->schema()}, fColumnNames{inColumns}
 {
    auto &columnNames = fColumnNames;
    auto &table = fTable;
@@ -455,6 +480,33 @@ RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::strin
    }
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create an Arrow RDataSource that streams the record batches of an arrow::RecordBatchReader.
+/// \param[in] batchReader the stream of record batches to read. It is consumed by the first event loop.
+/// \param[in] inColumns the name of the columns to use
+/// In case columns is empty, we use all the columns found in the schema of the batches
+RArrowDS::RArrowDS(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &inColumns)
+   : fBatchReader{batchReader}, fSchema{batchReader->schema()}, fColumnNames{inColumns}
+{
+   if (fColumnNames.empty()) {
+      for (auto &field : fSchema->fields())
+         fColumnNames.push_back(field->name());
+   }
+   if (fColumnNames.empty())
+      throw std::runtime_error("At least one column required");
+
+   for (auto &columnName : fColumnNames) {
+      const auto columnIdx = fSchema->GetFieldIndex(columnName);
+      if (columnIdx < 0)
+         throw std::runtime_error("The dataset does not have column " + columnName);
+      fGetterIndex.push_back(std::make_pair(columnIdx, fGetterIndex.size()));
+
+      VerifyValidColumnType verifyType;
+      if (!fSchema->field(columnIdx)->type()->Accept(&verifyType).ok())
+         throw std::runtime_error("Column " + columnName + " contains an unsupported type.");
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RArrowDS::~RArrowDS()
@@ -468,13 +520,39 @@ const std::vector<std::string> &RArrowDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::GetEntryRanges()
 {
-   auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+   if (!fBatchReader) {
+      auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+      return entryRanges;
+   }
+
+   // Read the next batches, one per slot, and point the value getters to their arrays. This releases the batches
+   // of the previous call, which have been processed by now.
+   std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   std::vector<arrow::ArrayVector> chunks(fGetterIndex.size());
+   const auto firstEntry = fNextEntry;
+   while (entryRanges.size() < fNSlots) {
+      std::shared_ptr<arrow::RecordBatch> batch;
+      auto status = fBatchReader->ReadNext(&batch);
+      if (!status.ok())
+         throw std::runtime_error("RArrowDS: could not read the next record batch: " + status.ToString());
+      if (!batch)
+         break; // end of the stream
+      if (batch->num_rows() == 0)
+         continue;
+      for (size_t ci = 0; ci != fGetterIndex.size(); ++ci)
+         chunks[ci].push_back(batch->column(fGetterIndex[ci].first));
+      entryRanges.emplace_back(fNextEntry, fNextEntry + batch->num_rows());
+      fNextEntry += batch->num_rows();
+   }
+   for (size_t ci = 0; ci != fGetterIndex.size(); ++ci)
+      fValueGetters[fGetterIndex[ci].second]->SetChunks(std::move(chunks[ci]), firstEntry);
+
    return entryRanges;
 }
 
 std::string RArrowDS::GetTypeName(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       std::string msg = "The dataset does not have column ";
       msg += colName;
@@ -492,7 +570,7 @@ std::string RArrowDS::GetTypeName(std::string_view colName) const
 
 bool RArrowDS::HasColumn(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       return false;
    }
@@ -560,8 +638,11 @@ void RArrowDS::SetNSlots(unsigned int nSlots)
 
    fValueGetters.clear();
    for (size_t ci = 0; ci != nColumns; ++ci) {
-      auto chunkedArray = getData(fTable->column(fGetterIndex[ci].first));
-      fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, chunkedArray->chunks()));
+      // in streaming mode, the arrays are only known once the batches are read, see GetEntryRanges()
+      arrow::ArrayVector chunks;
+      if (fTable)
+         chunks = getData(fTable->column(fGetterIndex[ci].first))->chunks();
+      fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, std::move(chunks)));
    }
 }
 
@@ -579,7 +660,7 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
       throw std::runtime_error("No column found at index " + std::to_string(column));
    };
 
-   const int columnIdx = fTable->schema()->GetFieldIndex(std::string(colName));
+   const int columnIdx = fSchema->GetFieldIndex(std::string(colName));
    const int getterIdx = findGetterIndex(columnIdx);
    assert(getterIdx != -1);
    assert((unsigned int)getterIdx < fValueGetters.size());
@@ -588,6 +669,12 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
 
 void RArrowDS::Initialize()
 {
+   if (fBatchReader) {
+      if (fNextEntry > 0)
+         throw std::runtime_error("RArrowDS: the record batches of an arrow::RecordBatchReader can only be read once, "
+                                  "so a single event loop can run on this data source.");
+      return;
+   }
    auto nRecords = getNRecords(fTable, fColumnNames);
    splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
 }
@@ -609,6 +696,20 @@ RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::strin
    return tdf;
 }
 
+/// \brief Factory method to create a Apache Arrow RDataFrame that streams record batches.
+///
+/// Creates a RDataFrame using an arrow::RecordBatchReader as input, e.g. a reader of a Parquet file.
+/// The batches are read during the event loop, so only one event loop can run on the RDataFrame.
+/// \param[in] batchReader the stream of record batches to read.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the schema of the batches
+RDataFrame
+FromArrow(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columnNames)
+{
+   ROOT::RDataFrame tdf(std::make_unique<RArrowDS>(batchReader, columnNames));
+   return tdf;
+}
+
 } // namespace RDF
 
 } // namespace ROOT
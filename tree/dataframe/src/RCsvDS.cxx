@@ -71,6 +71,10 @@ double-quote characters must be represented by a pair of double-quote characters
 The current implementation of RCsvDS reads the entire CSV file content into memory before
 RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
 important to check both how much memory is available and the size of the CSV file.
+For large files, a chunk size can be passed to read and process a given number of lines at a time.
+
+The file is read in large blocks; when implicit multi-threading is enabled, the lines of each block are split
+into chunks which are parsed in parallel.
 
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
@@ -81,13 +85,65 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 #include <ROOT/TSeq.hxx>
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <RConfigure.h> // R__USE_IMT
 #include <TError.h>
+#include <TROOT.h> // IsImplicitMTEnabled, GetThreadPoolSize
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
 #include <memory>
-#include <sstream>
+#include <stdexcept>
 #include <string>
 
+namespace {
+/// Number of bytes read from the CSV file at a time.
+constexpr std::size_t kBlockSize = 4 * 1024 * 1024;
+/// Minimum number of lines parsed by a task when the lines of a block are parsed in parallel.
+constexpr std::size_t kMinLinesPerTask = 4096;
+
+std::string_view TrimLeft(std::string_view field)
+{
+   while (!field.empty() && std::isspace(static_cast<unsigned char>(field.front())))
+      field.remove_prefix(1);
+   return field;
+}
+
+/// Parse an integer the way std::stoll does, without copying the field into a std::string.
+Long64_t ParseLong64(std::string_view field)
+{
+   field = TrimLeft(field);
+   if (field.size() > 1 && field.front() == '+' && field[1] != '-')
+      field.remove_prefix(1);
+   Long64_t value = 0;
+   const auto res = std::from_chars(field.data(), field.data() + field.size(), value);
+   if (res.ec == std::errc::invalid_argument)
+      throw std::invalid_argument("RCsvDS: cannot convert \"" + std::string(field) + "\" to Long64_t");
+   if (res.ec == std::errc::result_out_of_range)
+      throw std::out_of_range("RCsvDS: value \"" + std::string(field) + "\" is out of the range of Long64_t");
+   return value;
+}
+
+/// Parse a floating point number the way std::stod does. The field must be followed, in memory, by a character
+/// that cannot be part of the number (a delimiter, a line break or the null terminator of the buffer).
+double ParseDouble(std::string_view field)
+{
+   char *end = nullptr;
+   const double value = std::strtod(field.data(), &end);
+   if (end == field.data())
+      throw std::invalid_argument("RCsvDS: cannot convert \"" + std::string(field) + "\" to double");
+   if (end > field.data() + field.size()) // the delimiter looked like part of the number
+      return std::stod(std::string(field));
+   return value;
+}
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -117,47 +173,184 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+/// Return the field of `line` that starts at `pos`, and move `pos` to the delimiter that ends it (or to the end of
+/// the line). Unquoted fields are returned as views on the line; quoted fields are unescaped into `scratch`.
+/// Like ParseValue, empty fields and explicit nan/NaN are returned as "nan".
+std::string_view RCsvDS::NextField(std::string_view line, std::size_t &pos, std::string &scratch) const
 {
-   auto i = 0U;
-
-   auto columns = ParseColumns(line);
+   const auto start = pos;
+   bool quoted = false;
+   bool hasQuotes = false;
+   for (; pos < line.size(); ++pos) {
+      const char c = line[pos];
+      if (c == fDelimiter && !quoted) {
+         break;
+      } else if (c == '"') {
+         if (!hasQuotes) {
+            scratch.assign(line.data() + start, pos - start);
+            hasQuotes = true;
+         }
+         // Keep just one quote for escaped quotes, none for the normal quotes
+         if (pos + 1 < line.size() && line[pos + 1] == '"')
+            scratch += line[++pos];
+         else
+            quoted = !quoted;
+      } else if (hasQuotes) {
+         scratch += c;
+      }
+   }
 
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+   const auto field = hasQuotes ? std::string_view(scratch) : line.substr(start, pos - start);
+   if (pos == start || field == "nan" || field == "NaN")
+      return "nan";
+   return field;
+}
 
-      switch (colType) {
+/// Convert the fields of `line` to the column types and append them to `record`. The nth element of
+/// `colContainsEmpty` is set if the nth column has an empty cell that cannot be represented as NaN.
+/// Does not modify the data source, so that several lines can be processed concurrently.
+void RCsvDS::FillRecord(std::string_view line, Record_t &record, std::vector<char> &colContainsEmpty) const
+{
+   const auto nColumns = fHeaders.size();
+   record.reserve(nColumns);
+   std::string scratch;
+   auto colType = fColTypesList.begin();
+
+   auto addValue = [&](std::string_view field) {
+      if (record.size() == nColumns)
+         return; // ignore extra fields
+      const auto i = record.size();
+      switch (*colType) {
       case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
+         record.emplace_back(
+            new double((field != "nan") ? ParseDouble(field) : std::numeric_limits<double>::quiet_NaN()));
          break;
       }
       case 'L': {
-         if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
+         if (field != "nan") {
+            record.emplace_back(new Long64_t(ParseLong64(field)));
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
+            colContainsEmpty[i] = true;
             record.emplace_back(new Long64_t(0));
          }
          break;
       }
       case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
+         if (field != "nan") {
+            // same as reading with std::boolalpha: anything that does not start with "true" is false
+            record.emplace_back(new bool(TrimLeft(field).substr(0, 4) == "true"));
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
+            colContainsEmpty[i] = true;
+            record.emplace_back(new bool(false));
          }
          break;
       }
       case 'T': {
-         record.emplace_back(new std::string(col));
+         record.emplace_back(new std::string(field));
          break;
       }
       }
-      ++i;
+      ++colType;
+   };
+
+   for (std::size_t pos = 0; pos < line.size(); ++pos) {
+      addValue(NextField(line, pos, scratch));
+      // if the line ends with the delimiter, we need to append the default column value
+      // for the _next_, last column that won't be parsed (because we are out of characters)
+      if (pos == line.size() - 1 && line[pos] == fDelimiter)
+         addValue("nan");
    }
+   // missing trailing fields are treated as empty cells
+   while (record.size() < nColumns)
+      addValue("nan");
+}
+
+/// Parse `lines` and append them to fRecords. With implicit multi-threading enabled, large sets of lines are split
+/// into chunks that are parsed in parallel.
+void RCsvDS::FillRecords(const std::vector<std::string_view> &lines)
+{
+   const auto nLines = lines.size();
+   const auto firstRecord = fRecords.size();
+   fRecords.resize(firstRecord + nLines);
+
+   std::size_t nTasks = 1;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      const std::size_t maxTasks = 4 * ROOT::GetThreadPoolSize();
+      nTasks = std::max<std::size_t>(1, std::min(maxTasks, nLines / kMinLinesPerTask));
+   }
+#endif
+   std::vector<std::vector<char>> colContainsEmpty(nTasks, std::vector<char>(fHeaders.size(), false));
+   auto fillChunk = [&](unsigned int task) {
+      const auto begin = task * nLines / nTasks;
+      const auto end = (task + 1) * nLines / nTasks;
+      for (auto i = begin; i < end; ++i)
+         FillRecord(lines[i], fRecords[firstRecord + i], colContainsEmpty[task]);
+   };
+
+   if (nTasks == 1) {
+      fillChunk(0);
+   } else {
+#ifdef R__USE_IMT
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(fillChunk, ROOT::TSeqU(nTasks));
+#endif
+   }
+
+   for (const auto &flags : colContainsEmpty) {
+      for (auto i = 0u; i < flags.size(); ++i) {
+         if (flags[i])
+            fColContainingEmpty.insert(fHeaders[i]);
+      }
+   }
+}
+
+/// Parse the next fLinesChunkSize non-empty lines into fRecords, or all the remaining lines if fLinesChunkSize is -1.
+/// The file is read in blocks of kBlockSize bytes, and all the complete lines of a block are parsed in one go. The
+/// bytes that were read but not parsed yet are kept in fUnparsedBytes for the next call.
+void RCsvDS::ReadRecords()
+{
+   auto linesToRead = fLinesChunkSize;
+   auto pos = fCsvFile->GetFilePos(); // the position right after the content of fUnparsedBytes
+   auto &block = fUnparsedBytes;
+   std::vector<std::string_view> lines;
+   bool eof = false;
+
+   while (true) {
+      // collect the complete lines of the block; at the end of the file, the last line might lack the line break
+      lines.clear();
+      std::size_t lineStart = 0;
+      while (-1LL == fLinesChunkSize || 0 != linesToRead) {
+         auto lineEnd = block.find('\n', lineStart);
+         if (lineEnd == std::string::npos) {
+            if (!eof || lineStart == block.size())
+               break;
+            lineEnd = block.size();
+         }
+         std::string_view line(block.data() + lineStart, lineEnd - lineStart);
+         lineStart = std::min(lineEnd + 1, block.size());
+         if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1); // Windows line break
+         if (line.empty())
+            continue; // skip empty lines
+         lines.emplace_back(line);
+         --linesToRead;
+      }
+
+      FillRecords(lines);
+      block.erase(0, lineStart);
+      if (eof || (-1LL != fLinesChunkSize && 0 == linesToRead))
+         break;
+
+      const auto nCarried = block.size();
+      block.resize(nCarried + kBlockSize);
+      const auto nBytes = fCsvFile->ReadAt(&block[nCarried], kBlockSize, pos);
+      block.resize(nCarried + nBytes);
+      pos += nBytes;
+      eof = nBytes == 0;
+   }
+
+   fCsvFile->Seek(pos);
 }
 
 void RCsvDS::GenerateHeaders(size_t size)
@@ -413,6 +606,7 @@ RCsvDS::~RCsvDS()
 void RCsvDS::Finalize()
 {
    fCsvFile->Seek(fDataPos);
+   fUnparsedBytes.clear();
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
    FreeRecords();
@@ -426,16 +620,8 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
    // Read records and store them in memory
-   auto linesToRead = fLinesChunkSize;
    FreeRecords();
-
-   std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
-   }
+   ReadRecords();
 
    if (!fColContainingEmpty.empty()) {
       std::string msg = "";
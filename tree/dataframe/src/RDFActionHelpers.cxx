@@ -9,7 +9,23 @@
  *************************************************************************/
 
 #include "ROOT/RDF/ActionHelpers.hxx"
+#include "ROOT/RDF/RInterface.hxx" // for RSnapshotRNTupleWriter
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RConfigure.h"         // R__USE_IMT
+#include "TROOT.h"              // IsImplicitMTEnabled
+#include "TSystem.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RFieldBase.hxx"
+#include "ROOT/RNTupleFillContext.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx"
+#include "ROOT/RNTupleWriteOptions.hxx"
+#endif
 
 namespace ROOT {
 namespace Internal {
@@ -46,6 +62,26 @@ void BufferedFillHelper::UpdateMinMax(unsigned int slot, double v)
    thisMax = std::max(thisMax, v);
 }
 
+void TreeReduce(std::size_t nObjects, const std::function<void(std::size_t, std::size_t)> &mergeInto)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nObjects > 2) {
+      ROOT::TThreadExecutor pool;
+      std::vector<std::size_t> targets;
+      // at every level, object i absorbs object i + stride; the results are merged at the next level
+      for (std::size_t stride = 1; stride < nObjects; stride *= 2) {
+         targets.clear();
+         for (std::size_t i = 0; i + stride < nObjects; i += 2 * stride)
+            targets.emplace_back(i);
+         pool.Foreach([&](std::size_t i) { mergeInto(i, i + stride); }, targets);
+      }
+      return;
+   }
+#endif
+   for (std::size_t i = 1; i < nObjects; ++i)
+      mergeInto(0, i);
+}
+
 BufferedFillHelper::BufferedFillHelper(const std::shared_ptr<Hist_t> &h, const unsigned int nSlots)
    : fResultHist(h), fNSlots(nSlots), fBufSize(fgTotalBufSize / nSlots), fPartialHists(fNSlots),
      fMin(nSlots * CacheLineStep<BufEl_t>(), std::numeric_limits<BufEl_t>::max()),
@@ -242,6 +278,135 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+struct RSnapshotRNTupleWriter::RImpl {
+   std::string fFileName;
+   std::string fNTupleName;
+   ColumnNames_t fFieldNames;
+   std::vector<std::string> fTypeNames;
+   RSnapshotOptions fOptions;
+   std::shared_ptr<OutputRDF_t> fOutputRDF;
+   bool fHasRun = false;
+#ifdef R__HAS_ROOT7
+   /// The fill context of a slot, with an entry bound to the addresses of the values of the last Fill
+   struct RSlotWriter {
+      std::shared_ptr<ROOT::Experimental::RNTupleFillContext> fContext;
+      std::unique_ptr<ROOT::Experimental::REntry> fEntry;
+      std::vector<ROOT::Experimental::REntry::RFieldToken> fTokens;
+      std::vector<void *> fAddresses;
+   };
+   std::unique_ptr<TFile> fOutputFile; // only set when appending to an existing file
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<RSlotWriter> fSlotWriters;
+#endif
+};
+
+RSnapshotRNTupleWriter::RSnapshotRNTupleWriter(unsigned int nSlots, const std::string &fileName,
+                                               const std::string &ntupleName, const ColumnNames_t &fieldNames,
+                                               const std::vector<std::string> &typeNames,
+                                               const RSnapshotOptions &options, std::shared_ptr<OutputRDF_t> outputRDF)
+   : fImpl(new RImpl{fileName, ntupleName, fieldNames, typeNames, options, std::move(outputRDF)})
+{
+#ifdef R__HAS_ROOT7
+   fImpl->fSlotWriters.resize(nSlots);
+#else
+   (void)nSlots;
+#endif
+}
+
+RSnapshotRNTupleWriter::~RSnapshotRNTupleWriter() = default;
+
+void RSnapshotRNTupleWriter::Initialize()
+{
+#ifdef R__HAS_ROOT7
+   using ROOT::Experimental::RFieldBase;
+   using ROOT::Experimental::RNTupleModel;
+   using ROOT::Experimental::RNTupleParallelWriter;
+
+   // The model is only used as a template for the fill contexts, which bind their own entries: no default entry
+   auto model = RNTupleModel::CreateBare();
+   for (std::size_t i = 0; i < fImpl->fFieldNames.size(); ++i)
+      model->AddField(RFieldBase::Create(fImpl->fFieldNames[i], fImpl->fTypeNames[i]).Unwrap());
+
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(fImpl->fOptions.fCompressionAlgorithm, fImpl->fOptions.fCompressionLevel);
+
+   TString fileMode = fImpl->fOptions.fMode;
+   fileMode.ToLower();
+   if (fileMode == "update") {
+      fImpl->fOutputFile.reset(TFile::Open(fImpl->fFileName.c_str(), "update"));
+      if (!fImpl->fOutputFile || fImpl->fOutputFile->IsZombie())
+         throw std::runtime_error("Snapshot: could not open output file " + fImpl->fFileName);
+      fImpl->fWriter =
+         RNTupleParallelWriter::Append(std::move(model), fImpl->fNTupleName, *fImpl->fOutputFile, writeOptions);
+   } else {
+      if ((fileMode == "create" || fileMode == "new") && !gSystem->AccessPathName(fImpl->fFileName.c_str()))
+         throw std::runtime_error("Snapshot: output file " + fImpl->fFileName + " already exists");
+      fImpl->fWriter = RNTupleParallelWriter::Recreate(std::move(model), fImpl->fNTupleName, fImpl->fFileName,
+                                                       writeOptions);
+   }
+#else
+   throw std::runtime_error("Snapshot: the RNTuple output format requires ROOT to be built with root7=ON");
+#endif
+}
+
+void RSnapshotRNTupleWriter::InitSlot(unsigned int slot)
+{
+#ifdef R__HAS_ROOT7
+   auto &slotWriter = fImpl->fSlotWriters[slot];
+   if (slotWriter.fContext)
+      return;
+   // CreateFillContext is thread-safe; the context then prepares and compresses its clusters in this slot
+   slotWriter.fContext = fImpl->fWriter->CreateFillContext();
+   slotWriter.fEntry = slotWriter.fContext->GetModel().CreateBareEntry();
+   for (const auto &name : fImpl->fFieldNames)
+      slotWriter.fTokens.emplace_back(slotWriter.fEntry->GetToken(name));
+   slotWriter.fAddresses.assign(fImpl->fFieldNames.size(), nullptr);
+#else
+   (void)slot;
+#endif
+}
+
+void RSnapshotRNTupleWriter::Fill(unsigned int slot, void *const *values)
+{
+#ifdef R__HAS_ROOT7
+   auto &slotWriter = fImpl->fSlotWriters[slot];
+   // value addresses are usually stable within a task: only re-bind the ones that changed
+   for (std::size_t i = 0; i < slotWriter.fAddresses.size(); ++i) {
+      if (values[i] != slotWriter.fAddresses[i]) {
+         slotWriter.fEntry->BindRawPtr<void>(slotWriter.fTokens[i], values[i]);
+         slotWriter.fAddresses[i] = values[i];
+      }
+   }
+   slotWriter.fContext->Fill(*slotWriter.fEntry);
+#else
+   (void)slot;
+   (void)values;
+#endif
+}
+
+void RSnapshotRNTupleWriter::Finalize()
+{
+   fImpl->fHasRun = true;
+#ifdef R__HAS_ROOT7
+   // all fill contexts must be destroyed (i.e. flushed) before the writer commits the dataset
+   fImpl->fSlotWriters.clear();
+   fImpl->fWriter.reset();
+   if (fImpl->fOutputFile)
+      fImpl->fOutputFile->Close();
+   fImpl->fOutputFile.reset();
+
+   if (fImpl->fOutputRDF) {
+      *fImpl->fOutputRDF = OutputRDF_t(
+         ROOT::Detail::RDF::CreateLMFromRNTuple(fImpl->fNTupleName, fImpl->fFileName, fImpl->fFieldNames));
+   }
+#endif
+}
+
+bool RSnapshotRNTupleWriter::HasRun() const
+{
+   return fImpl->fHasRun;
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -28,6 +28,8 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
       return duplicateDefineIt->second;
 
    auto node = std::make_shared<GraphNode>("Define\\n" + columnName, visitedMap.size(), ENodeType::kDefine);
+   if (columnPtr && columnPtr->GetProfile())
+      node->SetProfile(columnPtr->GetProfile()->GetSummary());
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -45,6 +47,8 @@ GraphDrawing::CreateFilterNode(const ROOT::Detail::RDF::RFilterBase *filterPtr,
 
    auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter"), visitedMap.size(),
                                            ENodeType::kFilter);
+   if (filterPtr->GetProfile())
+      node->SetProfile(filterPtr->GetProfile()->GetSummary());
    visitedMap[(void *)filterPtr] = node;
    return node;
 }
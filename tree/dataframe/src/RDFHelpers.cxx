@@ -22,6 +22,7 @@
 #endif // R__USE_IMT
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <set>
 #include <cstdio>
@@ -132,6 +133,42 @@ unsigned int ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    return uniqueLoops.size();
 }
 
+std::size_t ROOT::Internal::RDF::RJoinIndex::RKeyHash::operator()(const ROOT::RVec<ULong64_t> &key) const
+{
+   // same combination as boost::hash_combine
+   std::size_t hash = 0;
+   for (auto value : key)
+      hash ^= std::hash<ULong64_t>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+   return hash;
+}
+
+ROOT::Internal::RDF::RJoinIndex::RJoinIndex(const std::vector<ROOT::RVec<ULong64_t>> &keys)
+{
+   fIndex.reserve(keys.size());
+   for (std::size_t entry = 0; entry < keys.size(); ++entry)
+      fIndex[keys[entry]].push_back(entry);
+}
+
+const ROOT::RVec<ULong64_t> &ROOT::Internal::RDF::RJoinIndex::GetMatches(const ROOT::RVec<ULong64_t> &key) const
+{
+   auto it = fIndex.find(key);
+   return it == fIndex.end() ? fNoMatches : it->second;
+}
+
+std::string ROOT::Internal::RDF::GetJoinKeyExpression(const std::vector<std::string> &keyColumns)
+{
+   std::string expression = "ROOT::RVec<ULong64_t>{";
+   for (std::size_t i = 0; i < keyColumns.size(); ++i)
+      expression += (i > 0 ? ", " : "") + std::string("static_cast<ULong64_t>(") + keyColumns[i] + ")";
+   return expression + "}";
+}
+
+std::string ROOT::Internal::RDF::GetJoinColumnName(std::string_view what)
+{
+   static std::atomic<unsigned int> nJoins{0};
+   return "rdfjoin" + std::to_string(nJoins++) + "_" + std::string(what) + "_";
+}
+
 ROOT::RDF::Experimental::SnapshotPtr_t ROOT::RDF::Experimental::VariationsFor(ROOT::RDF::Experimental::SnapshotPtr_t)
 {
    throw std::logic_error("Varying a Snapshot result is not implemented yet.");
@@ -370,6 +407,36 @@ public:
    }
 };
 
+void EnableBulkExecution(ROOT::RDF::RNode df, std::size_t bulkSize)
+{
+   ROOT::Internal::RDF::SetBulkSize(df, bulkSize);
+}
+
+void EnableProfiling(ROOT::RDF::RNode df, bool enable)
+{
+   ROOT::Internal::RDF::SetProfiling(df, enable);
+}
+
+std::string GetProfileAsJSON(ROOT::RDF::RNode df)
+{
+   return ROOT::Internal::RDF::GetProfileAsJSON(df);
+}
+
+void PrefetchFiles(ROOT::RDF::RNode df, unsigned int nFiles)
+{
+   ROOT::Internal::RDF::SetNFilesToPrefetch(df, nFiles);
+}
+
+void EnableJitCache(std::string_view cacheDir)
+{
+   ROOT::Internal::RDF::SetJitCacheDir(cacheDir);
+}
+
+void EnableConcurrentHistoFill(bool enable)
+{
+   ROOT::Internal::RDF::SetConcurrentHistoFill(enable);
+}
+
 void AddProgressBar(ROOT::RDF::RNode node)
 {
    auto total_files = node.GetNFiles();
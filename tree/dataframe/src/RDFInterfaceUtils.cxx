@@ -8,6 +8,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/InternalTreeUtils.hxx> // GetFileNamesFromTree
 #include <ROOT/RDataSource.hxx>
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDF/RColumnRegister.hxx>
@@ -25,11 +26,14 @@
 #include <TClassEdit.h>
 #include <TDataType.h>
 #include <TError.h>
+#include <TFile.h>
 #include <TLeaf.h>
+#include <TMD5.h>
 #include <TObjArray.h>
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 #include <TVirtualMutex.h>
 
@@ -46,8 +50,10 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>  // for size_t
+#include <fstream>
 #include <iterator> // for back_insert_iterator
 #include <map>
 #include <memory>
@@ -299,6 +305,85 @@ BuildFunctionString(const std::string &expr, const ColumnNames_t &vars, const Co
    return ss.str();
 }
 
+/// Directory of the cross-run cache of jitted functions, empty if the cache is disabled.
+/// The initial value is taken from the ROOT_RDF_JIT_CACHE_DIR environment variable.
+std::string &GetJitCacheDir()
+{
+   static std::string jitCacheDir = [] {
+      const char *dir = std::getenv("ROOT_RDF_JIT_CACHE_DIR");
+      return std::string(dir ? dir : "");
+   }();
+   return jitCacheDir;
+}
+
+std::string RetTypeOfFunc(const std::string &funcName);
+
+std::string ReadFileContent(const std::string &path)
+{
+   std::ifstream file(path);
+   std::stringstream content;
+   content << file.rdbuf();
+   return content.str();
+}
+
+/// Entry of the cross-run cache of jitted functions: a shared library compiled by ACLiC with the definition of the
+/// function, and a header with its declaration. Loading both only costs the parsing of the declaration.
+struct RJitCacheEntry {
+   std::string fSourcePath;
+   std::string fHeaderPath;
+   std::string fLibPath;
+   std::string fFailedPath; ///< Marker for functions that cannot be compiled out of the interpreter
+
+   RJitCacheEntry(const std::string &cacheDir, const std::string &hash)
+      : fSourcePath(cacheDir + "/rdfjit_" + hash + ".C"),
+        fHeaderPath(cacheDir + "/rdfjit_" + hash + ".h"),
+        fLibPath(cacheDir + "/rdfjit_" + hash + "_C." + gSystem->GetSoExt()),
+        fFailedPath(cacheDir + "/rdfjit_" + hash + ".failed")
+   {
+   }
+
+   bool Load() const
+   {
+      if (gSystem->AccessPathName(fLibPath.c_str()) || gSystem->AccessPathName(fHeaderPath.c_str()))
+         return false;
+      if (gSystem->Load(fLibPath.c_str()) < 0)
+         return false;
+      ROOT::Internal::RDF::InterpreterDeclare(ReadFileContent(fHeaderPath));
+      return true;
+   }
+
+   /// Compile the function that was just jitted as funcBaseName, for the benefit of the next processes.
+   void Store(const std::string &funcBaseName, const std::string &funcCode) const
+   {
+      if (!gSystem->AccessPathName(fFailedPath.c_str()))
+         return;
+      const auto retType = RetTypeOfFunc("R_rdf::" + funcBaseName);
+      // funcCode is "(params){body}"
+      const auto params = funcCode.substr(0, funcCode.find("){") + 1);
+
+      std::ofstream source(fSourcePath);
+      source << "#include \"ROOT/RVec.hxx\"\n#include \"ROOT/RDF/RSampleInfo.hxx\"\n#include \"TMath.h\"\n"
+             << "#include <cmath>\n#include <string>\n#include <vector>\n"
+             << "namespace R_rdf {\n"
+             << retType << " " << funcBaseName << funcCode << "\n}\n";
+      source.close();
+      // compile only, the function is already jitted in this process; put the library next to the source
+      if (!gSystem->CompileMacro(fSourcePath.c_str(), "kOcs-", "", gSystem->GetDirName(fSourcePath.c_str()))) {
+         // e.g. the expression uses code that is only declared to the interpreter
+         std::ofstream failed(fFailedPath);
+         return;
+      }
+
+      const auto tmpHeaderPath = fHeaderPath + ".tmp" + std::to_string(gSystem->GetPid());
+      std::ofstream header(tmpHeaderPath);
+      header << "namespace R_rdf {\n"
+             << retType << " " << funcBaseName << params << ";\n"
+             << "using " << funcBaseName << "_ret_t = " << retType << ";\n}";
+      header.close();
+      gSystem->Rename(tmpHeaderPath.c_str(), fHeaderPath.c_str());
+   }
+};
+
 /// Declare a function to the interpreter in namespace R_rdf, return the name of the jitted function.
 /// If the function is already in GetJittedExprs, return the name for the function that has already been jitted.
 std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
@@ -314,8 +399,27 @@ std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars,
       return funcName;
    }
 
+   // With the cross-run cache enabled, functions are named after a hash of their code and of the ROOT build, so
+   // that the same expression gets the same symbol in every process.
+   const auto &jitCacheDir = GetJitCacheDir();
+   std::unique_ptr<RJitCacheEntry> cacheEntry;
+   std::string funcBaseName;
+   if (!jitCacheDir.empty()) {
+      const auto key = std::string(gROOT->GetVersion()) + gROOT->GetGitCommit() + funcCode;
+      TMD5 md5;
+      md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+      md5.Final();
+      funcBaseName = std::string("func_") + md5.AsString();
+      cacheEntry = std::make_unique<RJitCacheEntry>(jitCacheDir, md5.AsString());
+      if (cacheEntry->Load()) {
+         exprMap.insert({funcCode, "R_rdf::" + funcBaseName});
+         return "R_rdf::" + funcBaseName;
+      }
+   } else {
+      funcBaseName = "func" + std::to_string(exprMap.size());
+   }
+
    // new expression
-   const auto funcBaseName = "func" + std::to_string(exprMap.size());
    const auto funcFullName = "R_rdf::" + funcBaseName;
 
    const auto toDeclare = "namespace R_rdf {\nauto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
@@ -326,6 +430,9 @@ std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars,
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
    exprMap.insert({funcCode, funcFullName});
 
+   if (cacheEntry)
+      cacheEntry->Store(funcBaseName, funcCode);
+
    return funcFullName;
 }
 
@@ -645,6 +752,70 @@ ParsedTreePath ParseTreePath(std::string_view fullTreeName)
    return {std::string(treeName), std::string(dirName)};
 }
 
+std::string GetPersistentCachePath(std::string_view cacheDir, std::string_view key, const ColumnNames_t &columns,
+                                   const std::vector<std::string> &columnTypes,
+                                   const std::vector<std::string> &filterNames, const ColumnNames_t &definedColumns,
+                                   RLoopManager &lm)
+{
+   std::stringstream description;
+   description << "key:" << key << "\n";
+   for (std::size_t i = 0; i < columns.size(); ++i)
+      description << "column:" << columns[i] << ":" << columnTypes[i] << "\n";
+   for (const auto &filterName : filterNames)
+      description << "filter:" << filterName << "\n";
+   for (const auto &definedColumn : definedColumns)
+      description << "define:" << definedColumn << "\n";
+
+   // The input dataset is identified by its files: a file that is rewritten changes size or modification time
+   if (auto *tree = lm.GetTree()) {
+      description << "tree:" << tree->GetName() << "\n";
+      for (const auto &fileName : ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree)) {
+         FileStat_t stat;
+         description << "file:" << fileName;
+         if (gSystem->GetPathInfo(fileName.c_str(), stat) == 0)
+            description << ":" << stat.fSize << ":" << stat.fMtime;
+         description << "\n";
+      }
+   } else if (auto *ds = lm.GetDataSource()) {
+      description << "datasource:" << ds->GetLabel() << "\n";
+   } else {
+      description << "empty:" << lm.GetNEmptyEntries() << "\n";
+   }
+
+   const auto str = description.str();
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(str.data()), str.size());
+   md5.Final();
+   return std::string(cacheDir) + "/rdfcache_" + md5.AsString() + ".root";
+}
+
+bool HasPersistentCache(const std::string &path)
+{
+   // files only appear at their final path once complete, see CommitPersistentCache
+   if (gSystem->AccessPathName(path.c_str()))
+      return false;
+   std::unique_ptr<TFile> file(TFile::Open(path.c_str(), "READ"));
+   return file && !file->IsZombie() && file->Get<TTree>(kPersistentCacheTreeName) != nullptr;
+}
+
+std::string GetPersistentCacheTmpPath(const std::string &path)
+{
+   const std::string cacheDir = gSystem->GetDirName(path.c_str()).Data();
+   if (gSystem->AccessPathName(cacheDir.c_str()) && gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true) != 0)
+      throw std::runtime_error("PersistentCache: could not create the cache directory " + cacheDir);
+   return path + ".tmp" + std::to_string(gSystem->GetPid());
+}
+
+void CommitPersistentCache(const std::string &tmpPath, const std::string &path)
+{
+   // another process might have committed the same cache in the meantime, in which case either file will do
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0) {
+      gSystem->Unlink(tmpPath.c_str());
+      if (!HasPersistentCache(path))
+         throw std::runtime_error("PersistentCache: could not move the cache file to " + path);
+   }
+}
+
 std::string PrettyPrintAddr(const void *const addr)
 {
    std::stringstream s;
@@ -653,6 +824,48 @@ std::string PrettyPrintAddr(const void *const addr)
    return s.str();
 }
 
+/// Return a string that identifies the computation of a jitted Define or Filter: two nodes with the same signature
+/// evaluate the same function with the same inputs, so they always produce the same values.
+/// Input columns are identified by the address of their Define, or by name if they are dataset columns.
+static std::string GetJitSignature(const std::string &funcName, const ColumnNames_t &usedCols,
+                                   const RColumnRegister &colRegister)
+{
+   std::string signature = funcName + "(";
+   for (const auto &col : usedCols) {
+      const auto resolvedCol = colRegister.ResolveAlias(col);
+      if (auto *define = colRegister.GetDefine(resolvedCol))
+         signature += PrettyPrintAddr(define);
+      else
+         signature += std::string(resolvedCol);
+      signature += ",";
+   }
+   return signature + ")";
+}
+
+void SetJitCacheDir(std::string_view cacheDir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   GetJitCacheDir() = std::string(cacheDir);
+   if (!cacheDir.empty() && gSystem->AccessPathName(GetJitCacheDir().c_str()))
+      gSystem->mkdir(GetJitCacheDir().c_str(), /*recursive=*/true);
+}
+
+static std::atomic<bool> &GetConcurrentHistoFill()
+{
+   static std::atomic<bool> isEnabled{false};
+   return isEnabled;
+}
+
+void SetConcurrentHistoFill(bool enable)
+{
+   GetConcurrentHistoFill() = enable;
+}
+
+bool IsConcurrentHistoFillEnabled()
+{
+   return GetConcurrentHistoFill();
+}
+
 /// Book the jitting of a Filter call
 std::shared_ptr<RDFDetail::RJittedFilter>
 BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string_view name, std::string_view expression,
@@ -668,14 +881,27 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   // Unnamed filters with the same expression on the same inputs and the same parent node are interchangeable.
+   // Named filters are kept apart because they appear separately in reports.
+   const auto variationDeps = colRegister.GetVariationDeps(parsedExpr.fUsedCols);
+   auto lm = (*prevNodeOnHeap)->GetLoopManagerUnchecked();
+   std::string signature;
+   if (name.empty() && variationDeps.empty()) {
+      signature = PrettyPrintAddr((*prevNodeOnHeap).get()) + ":" +
+                  GetJitSignature(funcName, parsedExpr.fUsedCols, colRegister);
+      if (auto cachedFilter = lm->GetJittedFilter(signature)) {
+         delete prevNodeOnHeap;
+         return cachedFilter;
+      }
+   }
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RColumnRegister *definesOnHeap = new ROOT::Internal::RDF::RColumnRegister(colRegister);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
    const auto prevNodeAddr = PrettyPrintAddr(prevNodeOnHeap);
 
    const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(
-      (*prevNodeOnHeap)->GetLoopManagerUnchecked(), name,
-      Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+      lm, name, Union(variationDeps, (*prevNodeOnHeap)->GetVariations()));
 
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
@@ -697,8 +923,9 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
                     << "reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
+   if (!signature.empty())
+      lm->AddJittedFilter(signature, jittedFilter);
 
    return jittedFilter;
 }
@@ -718,6 +945,17 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   // A Define with the same name, expression and inputs was already booked (e.g. on a sibling branch of the graph):
+   // share it, so that its value is computed once per entry and the expression is not jitted again.
+   std::string signature;
+   if (colRegister.GetVariationDeps(parsedExpr.fUsedCols).empty()) {
+      signature = std::string(name) + "=" + GetJitSignature(funcName, parsedExpr.fUsedCols, colRegister);
+      if (auto cachedDefine = lm.GetJittedDefine(signature)) {
+         delete upcastNodeOnHeap;
+         return cachedDefine;
+      }
+   }
+
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
@@ -743,6 +981,8 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
                     << PrettyPrintAddr(upcastNodeOnHeap) << "));\n";
 
    lm.ToJitExec(defineInvocation.str());
+   if (!signature.empty())
+      lm.AddJittedDefine(signature, jittedDefine);
    return jittedDefine;
 }
 
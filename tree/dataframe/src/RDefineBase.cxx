@@ -44,6 +44,12 @@ std::string RDefineBase::GetName() const
    return fName;
 }
 
+void RDefineBase::EnableProfile(bool enable)
+{
+   fProfile = enable ? std::make_unique<RDFInternal::RNodeProfile>(fLoopManager->GetNSlots(), /*hasPassRate=*/false)
+                     : nullptr;
+}
+
 std::string RDefineBase::GetTypeName() const
 {
    return fType;
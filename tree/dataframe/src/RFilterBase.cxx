@@ -24,7 +24,8 @@ RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const uns
      fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
      fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fColumnNames(columns),
-     fColRegister(colRegister), fIsDefine(columns.size()), fVariation(variation)
+     fColRegister(colRegister), fIsDefine(columns.size()), fVariation(variation), fLastCheckedBulk(nSlots, -1),
+     fLastBulkResult(nSlots)
 {
    const auto nColumns = fColumnNames.size();
    for (auto i = 0u; i < nColumns; ++i) {
@@ -56,8 +57,15 @@ void RFilterBase::FillReport(ROOT::RDF::RCutFlowReport &rep) const
    rep.AddCut({fName, accepted, all});
 }
 
+void RFilterBase::EnableProfile(bool enable)
+{
+   const auto nSlots = fLastBulkResult.size();
+   fProfile = enable ? std::make_unique<RDFInternal::RNodeProfile>(nSlots, /*hasPassRate=*/true) : nullptr;
+}
+
 void RFilterBase::InitNode()
 {
+   std::fill(fLastCheckedBulk.begin(), fLastCheckedBulk.end(), -1);
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
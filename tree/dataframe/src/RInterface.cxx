@@ -28,6 +28,49 @@ void ROOT::Internal::RDF::ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Ex
    node.GetLoopManager()->ChangeSpec(std::move(spec));
 }
 
+/**
+ * \brief Set the number of entries processed at a time in bulk execution mode.
+ *
+ * \param node Any node of the computation graph.
+ * \param bulkSize Number of entries per block, 0 to go back to entry-wise processing.
+ */
+void ROOT::Internal::RDF::SetBulkSize(const ROOT::RDF::RNode &node, std::size_t bulkSize)
+{
+   node.GetLoopManager()->SetBulkSize(bulkSize);
+}
+
+/**
+ * \brief Enable or disable the profiling of the nodes in the next event loops.
+ *
+ * \param node Any node of the computation graph.
+ * \param enable Whether Filters, Defines and actions record their call counts and timings.
+ */
+void ROOT::Internal::RDF::SetProfiling(const ROOT::RDF::RNode &node, bool enable)
+{
+   node.GetLoopManager()->SetProfiling(enable);
+}
+
+/**
+ * \brief Return the profile of the nodes of the computation graph as a JSON string.
+ *
+ * \param node Any node of the computation graph.
+ */
+std::string ROOT::Internal::RDF::GetProfileAsJSON(const ROOT::RDF::RNode &node)
+{
+   return node.GetLoopManager()->GetProfileAsJSON();
+}
+
+/**
+ * \brief Set the number of files of a TChain that are opened in advance during the next event loops.
+ *
+ * \param node Any node of the computation graph.
+ * \param nFiles The maximum number of files of the chain opened in the background, zero to disable prefetching.
+ */
+void ROOT::Internal::RDF::SetNFilesToPrefetch(const ROOT::RDF::RNode &node, unsigned int nFiles)
+{
+   node.GetLoopManager()->SetNFilesToPrefetch(nFiles);
+}
+
 /**
  * \brief Trigger the execution of an RDataFrame computation graph.
  * \param[in] node A node of the computation graph (not a result).
@@ -73,6 +73,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, firstEntry, mask);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -91,6 +97,11 @@ void RJittedAction::TriggerChildrenCount()
    fConcreteAction->TriggerChildrenCount();
 }
 
+ROOT::Detail::RDF::RNodeBase *RJittedAction::GetPrevNode() const
+{
+   return fConcreteAction != nullptr ? fConcreteAction->GetPrevNode() : nullptr;
+}
+
 void RJittedAction::FinalizeSlot(unsigned int slot)
 {
    assert(fConcreteAction != nullptr);
@@ -125,6 +136,12 @@ void RJittedAction::SetHasRun()
    return fConcreteAction->SetHasRun();
 }
 
+std::string RJittedAction::GetActionName()
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
 std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::GetGraph(
    std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap)
 {
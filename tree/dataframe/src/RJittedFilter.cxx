@@ -59,6 +59,12 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+void RJittedFilter::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask)
+{
+   assert(fConcreteFilter != nullptr);
+   fConcreteFilter->CheckFiltersBulk(slot, firstEntry, mask);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -128,6 +134,11 @@ void RJittedFilter::AddFilterName(std::vector<std::string> &filters)
    fConcreteFilter->AddFilterName(filters);
 }
 
+RNodeBase *RJittedFilter::GetPrevNode() const
+{
+   return fConcreteFilter != nullptr ? fConcreteFilter->GetPrevNode() : nullptr;
+}
+
 std::shared_ptr<RDFGraphDrawing::GraphNode>
 RJittedFilter::GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap)
 {
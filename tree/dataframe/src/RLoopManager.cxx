@@ -14,16 +14,20 @@
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RDefineReader.hxx" // RDefinesWithReaders
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RDF/RVariationReader.hxx" // RVariationsWithReaders
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RTrace.hxx"
+#include "ROOT/RVec.hxx" // RVecBufferPoolRAII
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
 #include "TChain.h"
+#include "TChainElement.h"
 #include "TEntryList.h"
 #include "TFile.h"
 #include "TFriendElement.h"
@@ -53,6 +57,7 @@
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <set>
 #include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
@@ -77,6 +82,42 @@ bool ContainsLeaf(const std::set<TLeaf *> &leaves, TLeaf *leaf)
    return (leaves.find(leaf) != leaves.end());
 }
 
+std::string EscapeJSON(const std::string &str)
+{
+   std::string escaped;
+   for (const char c : str) {
+      if (c == '"' || c == '\\')
+         escaped += '\\';
+      if (c == '\n')
+         escaped += "\\n";
+      else
+         escaped += c;
+   }
+   return escaped;
+}
+
+/// Write the profile of a node of the computation graph as a JSON object.
+void WriteProfileAsJSON(std::ostream &os, const std::string &type, const std::string &name,
+                        const ROOT::Internal::RDF::RNodeProfile &profile)
+{
+   auto writeStats = [&](const ROOT::Internal::RDF::RNodeProfile::RSlotStats &stats) {
+      os << "\"calls\":" << stats.fNCalls;
+      if (profile.HasPassRate())
+         os << ",\"passed\":" << stats.fNPassed;
+      os << ",\"time\":" << ROOT::Internal::RDF::RNodeProfile::GetEstimatedTime(stats);
+   };
+
+   os << "{\"type\":\"" << type << "\",\"name\":\"" << EscapeJSON(name) << "\",";
+   writeStats(profile.GetTotals());
+   os << ",\"slots\":[";
+   for (auto slot = 0u; slot < profile.GetNSlots(); ++slot) {
+      os << (slot > 0 ? ",{" : "{");
+      writeStats(profile.GetSlotStats(slot));
+      os << "}";
+   }
+   os << "]}";
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This overload does not check whether the leaf/branch is already in bNamesReg. In case this is a friend leaf/branch,
 /// `allowDuplicates` controls whether we add both `friendname.bname` and `bname` or just the shorter version.
@@ -314,17 +355,69 @@ auto MakeDatasetColReadersKey(const std::string &colName, const std::type_info &
    //    df.Sum<RVecI>("stdVectorBranch");
    return colName + ':' + ti.name();
 }
+/// Opens the next files of a TChain in the background while the current one is processed.
+///
+/// The open requests are sent with TFile::AsyncOpen: when the TChain switches to the next file, TFile::Open picks up
+/// the pending request with the same name instead of opening the file again. At most fNFiles requests are pending at
+/// any time. Only remote files that support asynchronous opening (i.e. XRootD ones, TFile::kNet) are requested: for
+/// the others, TFile::AsyncOpen would only record the request and the file would still be opened at the switch.
+class RChainFilePrefetcher {
+   std::vector<std::string> fFileNames;
+   std::vector<TFileOpenHandle *> fHandles; ///< Pending requests, indexed as fFileNames (null if not requested)
+   unsigned int fNFiles;
+   int fCurrentFile = -1;
+
+public:
+   RChainFilePrefetcher(TTree &tree, unsigned int nFiles) : fNFiles(nFiles)
+   {
+      auto chain = dynamic_cast<TChain *>(&tree);
+      if (nFiles == 0 || chain == nullptr)
+         return;
+      for (auto element : ROOT::Detail::TRangeStaticCast<TChainElement>(*chain->GetListOfFiles()))
+         fFileNames.emplace_back(element->GetTitle());
+      fHandles.resize(fFileNames.size(), nullptr);
+   }
+
+   RChainFilePrefetcher(const RChainFilePrefetcher &) = delete;
+   RChainFilePrefetcher &operator=(const RChainFilePrefetcher &) = delete;
+
+   ~RChainFilePrefetcher()
+   {
+      // The requests for the files that were not reached (e.g. because of a Range) are still pending: complete them,
+      // which transfers the ownership of the handles to the files, and close the files.
+      for (auto i = fCurrentFile + 1; i < static_cast<int>(fHandles.size()); ++i)
+         if (fHandles[i] != nullptr)
+            delete TFile::Open(fHandles[i]);
+   }
+
+   /// To be called with the tree number of the chain whenever the chain may have switched to another file.
+   void Update(int currentFile)
+   {
+      if (currentFile == fCurrentFile || fFileNames.empty())
+         return;
+      fCurrentFile = currentFile;
+      const auto end = std::min(fFileNames.size(), static_cast<std::size_t>(currentFile) + 1 + fNFiles);
+      for (auto i = static_cast<std::size_t>(currentFile) + 1; i < end; ++i) {
+         if (fHandles[i] != nullptr || TFile::GetType(fFileNames[i].c_str()) != TFile::kNet)
+            continue;
+         fHandles[i] = TFile::AsyncOpen(fFileNames[i].c_str());
+      }
+   }
+};
+
 } // anonymous namespace
 
 namespace ROOT {
 namespace Detail {
 namespace RDF {
 
-/// A RAII object that calls RLoopManager::CleanUpTask at destruction
+/// A RAII object that calls RLoopManager::CleanUpTask at destruction.
+/// It also enables the recycling of the buffers of the temporary RVecs created at each entry during the task.
 struct RCallCleanUpTask {
    RLoopManager &fLoopManager;
    unsigned int fArg;
    TTreeReader *fReader;
+   ROOT::Internal::VecOps::RVecBufferPoolRAII fRVecBufferPool;
 
    RCallCleanUpTask(RLoopManager &lm, unsigned int arg = 0u, TTreeReader *reader = nullptr)
       : fLoopManager(lm), fArg(arg), fReader(reader)
@@ -478,6 +571,9 @@ void RLoopManager::RunEmptySourceMT()
 
    // Each task will generate a subrange of entries
    auto genFunction = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+      if (fNStopsReceived >= fNChildren)
+         return; // a Range already ended the event loop
+      R__TRACE_SCOPE("dataframe", "RLoopManager task");
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       RCallCleanUpTask cleanup(*this, slot);
@@ -485,8 +581,14 @@ void RLoopManager::RunEmptySourceMT()
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (fRunBulk) {
+            for (auto firstEntry = range.first; firstEntry < range.second && fNStopsReceived < fNChildren;
+                 firstEntry += fBulkSize)
+               RunAndCheckFiltersBulk(slot, firstEntry, std::min<ULong64_t>(fBulkSize, range.second - firstEntry));
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second && fNStopsReceived < fNChildren; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -510,9 +612,17 @@ void RLoopManager::RunEmptySource()
    RCallCleanUpTask cleanup(*this);
    try {
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
-      for (ULong64_t currEntry = fEmptyEntryRange.first;
-           currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (fRunBulk) {
+         const auto end = fEmptyEntryRange.second;
+         for (ULong64_t firstEntry = fEmptyEntryRange.first; firstEntry < end && fNStopsReceived < fNChildren;
+              firstEntry += fBulkSize) {
+            RunAndCheckFiltersBulk(0, firstEntry, std::min<ULong64_t>(fBulkSize, end - firstEntry));
+         }
+      } else {
+         for (ULong64_t currEntry = fEmptyEntryRange.first;
+              currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -562,6 +672,9 @@ void RLoopManager::RunTreeProcessorMT()
    std::atomic<ULong64_t> entryCount(0ull);
 
    tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+      if (fNStopsReceived >= fNChildren)
+         return; // a Range already ended the event loop
+      R__TRACE_SCOPE("dataframe", "RLoopManager task");
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       RCallCleanUpTask cleanup(*this, slot, &r);
@@ -572,7 +685,7 @@ void RLoopManager::RunTreeProcessorMT()
       auto count = entryCount.fetch_add(nEntries);
       try {
          // recursive call to check filters and conditionally execute actions
-         while (validTTreeReaderRead(r)) {
+         while (fNStopsReceived < fNChildren && validTTreeReaderRead(r)) {
             if (fNewSampleNotifier.CheckFlag(slot)) {
                UpdateSampleInfo(slot, r);
             }
@@ -582,8 +695,7 @@ void RLoopManager::RunTreeProcessorMT()
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
       }
-      // fNStopsReceived < fNChildren is always true at the moment as we don't support event loop early quitting in
-      // multi-thread runs, but it costs nothing to be safe and future-proof in case we add support for that later.
+      // processing can be stopped early by ranges, in which case the reader did not reach the end of its range
       if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && fNStopsReceived < fNChildren) {
          // something went wrong in the TTreeReader event loop
          throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
@@ -610,11 +722,13 @@ void RLoopManager::RunTreeReader()
    RCallCleanUpTask cleanup(*this, 0u, &r);
    InitNodeSlots(&r, 0);
    R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, 0u));
+   RChainFilePrefetcher prefetcher(*fTree, fNFilesToPrefetch);
 
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
    try {
       while (validTTreeReaderRead(r) && fNStopsReceived < fNChildren) {
+         prefetcher.Update(fTree->GetTreeNumber());
          if (fNewSampleNotifier.CheckFlag(0)) {
             UpdateSampleInfo(/*slot*/0, r);
          }
@@ -646,6 +760,12 @@ void RLoopManager::RunDataSource()
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
+            if (fRunBulk) {
+               // bulk execution is only enabled for data sources whose SetEntry is a no-op, see CanRunBulk()
+               for (auto firstEntry = start; firstEntry < end && fNStopsReceived < fNChildren; firstEntry += fBulkSize)
+                  RunAndCheckFiltersBulk(0u, firstEntry, std::min<ULong64_t>(fBulkSize, end - firstEntry));
+               continue;
+            }
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
                   RunAndCheckFilters(0u, entry);
@@ -672,6 +792,9 @@ void RLoopManager::RunDataSourceMT()
 
    // Each task works on a subrange of entries
    auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+      if (fNStopsReceived >= fNChildren)
+         return; // a Range already ended the event loop
+      R__TRACE_SCOPE("dataframe", "RLoopManager task");
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       const auto slot = slotRAII.fSlot;
       InitNodeSlots(nullptr, slot);
@@ -681,9 +804,14 @@ void RLoopManager::RunDataSourceMT()
       const auto end = range.second;
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
       try {
-         for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+         if (fRunBulk) {
+            for (auto firstEntry = start; firstEntry < end && fNStopsReceived < fNChildren; firstEntry += fBulkSize)
+               RunAndCheckFiltersBulk(slot, firstEntry, std::min<ULong64_t>(fBulkSize, end - firstEntry));
+         } else {
+            for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
+               if (fDataSource->SetEntry(slot, entry)) {
+                  RunAndCheckFilters(slot, entry);
+               }
             }
          }
       } catch (...) {
@@ -695,9 +823,11 @@ void RLoopManager::RunDataSourceMT()
 
    fDataSource->Initialize();
    auto ranges = fDataSource->GetEntryRanges();
-   while (!ranges.empty()) {
+   // once a Range ended the event loop, the data source is not asked for (and does not read) more entry ranges
+   while (!ranges.empty() && fNStopsReceived < fNChildren) {
       pool.Foreach(runOnRange, ranges);
-      ranges = fDataSource->GetEntryRanges();
+      if (fNStopsReceived < fNChildren)
+         ranges = fDataSource->GetEntryRanges();
    }
    fDataSource->Finalize();
 #endif // not implemented otherwise (never called)
@@ -722,6 +852,47 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Bulk version of RunAndCheckFilters: process the entries [firstEntry, firstEntry + nEntries) in one go.
+/// Each action pulls a selection mask for the whole block from its upstream filters, which evaluate their
+/// expression in a tight loop over the block and cache the result for their other children, and then runs its
+/// helper on the selected entries.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries)
+{
+   // data-block callbacks run before the rest of the graph
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      for (auto &callback : fSampleCallbacks)
+         callback.second(slot, fSampleInfos[slot]);
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+
+   auto &mask = fBulkMasks[slot];
+   mask.resize(nEntries);
+   for (auto *actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, firstEntry, mask);
+   for (auto *namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, firstEntry, mask);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      for (auto &callback : fCallbacksEveryNEvents)
+         callback(slot);
+   }
+}
+
+/// Bulk execution needs random access to the entries of a block: it is available for empty sources and for data
+/// sources that read columns by entry number (RNTupleDS), but not for TTrees, which are read through a TTreeReader
+/// one entry after the other. Varied actions also only support entry-wise processing.
+bool RLoopManager::CanRunBulk() const
+{
+   if (fBulkSize == 0 || !fBookedVariations.empty())
+      return false;
+   if (fLoopType == ELoopType::kNoFiles || fLoopType == ELoopType::kNoFilesMT)
+      return true;
+#ifdef R__HAS_ROOT7
+   if (fLoopType == ELoopType::kDataSource || fLoopType == ELoopType::kDataSourceMT)
+      return dynamic_cast<ROOT::Experimental::RNTupleDS *>(fDataSource.get()) != nullptr;
+#endif
+   return false;
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
@@ -732,8 +903,12 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
       ptr->InitSlot(r, slot);
    for (auto *ptr : fBookedFilters)
       ptr->InitSlot(r, slot);
-   for (auto *ptr : fBookedDefines)
+   for (auto *ptr : fBookedDefines) {
+      // unused defines would only set up column readers that are never read
+      if (fSkipUnusedDefines && fUsedDefines.count(ptr) == 0)
+         continue;
       ptr->InitSlot(r, slot);
+   }
    for (auto *ptr : fBookedVariations)
       ptr->InitSlot(r, slot);
 
@@ -791,12 +966,123 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   FindUsedDefines();
+   if (fDataSource)
+      SetDataSourceRequiredColumns();
+   fRunBulk = CanRunBulk();
+   if (fRunBulk)
+      fBulkMasks.resize(fNSlots);
    for (auto *filter : fBookedFilters)
       filter->InitNode();
    for (auto *range : fBookedRanges)
       range->InitNode();
    for (auto *ptr : fBookedActions)
       ptr->Initialize();
+   // profiles start from scratch at every event loop, and are dropped if profiling was disabled in the meantime
+   for (auto *filter : fBookedFilters)
+      filter->EnableProfile(fProfiling);
+   for (auto *define : fBookedDefines)
+      define->EnableProfile(fProfiling);
+   for (auto *ptr : fBookedActions)
+      ptr->EnableProfile(fProfiling);
+}
+
+/// Collect the defines that are needed, directly or through other defines, by the booked actions and filters.
+/// Defines that nobody reads (e.g. those booked on a branch of the graph without actions) are left out of
+/// InitNodeSlots and CleanUpTask. Varied defines are created on demand by the variations, so the pass is
+/// skipped altogether if any variation is booked.
+void RLoopManager::FindUsedDefines()
+{
+   fUsedDefines.clear();
+   fSkipUnusedDefines = fBookedVariations.empty();
+   if (!fSkipUnusedDefines)
+      return;
+
+   std::vector<RDefineBase *> toVisit;
+   auto markUsed = [&](const ColumnNames_t &columns, const RDFInternal::RColumnRegister &colRegister) {
+      for (const auto &col : columns) {
+         auto *define = colRegister.GetDefine(colRegister.ResolveAlias(col));
+         if (define == nullptr)
+            continue;
+         if (auto *jittedDefine = dynamic_cast<RJittedDefine *>(define))
+            toVisit.push_back(jittedDefine->GetConcreteDefine());
+         toVisit.push_back(define);
+      }
+   };
+
+   for (auto *action : fBookedActions)
+      markUsed(action->GetColumnNames(), action->GetColRegister());
+   for (auto *filter : fBookedFilters)
+      markUsed(filter->GetColumnNames(), filter->GetColRegister());
+   // per-sample defines are updated through their sample callbacks whether or not anyone reads them
+   for (auto *define : fBookedDefines) {
+      if (fSampleCallbacks.count(define) > 0)
+         toVisit.push_back(define);
+   }
+
+   while (!toVisit.empty()) {
+      auto *define = toVisit.back();
+      toVisit.pop_back();
+      if (define == nullptr || !fUsedDefines.insert(define).second)
+         continue;
+      markUsed(define->GetColumnNames(), define->GetColRegister());
+   }
+}
+
+/// Pass to the data source the columns read by the booked actions and filters, directly or through defines.
+/// Columns read by nodes that are not downstream of any filter are read for every entry ("eager"); the others are
+/// only read for entries passing some filter. Nodes that do not know their upstream node are treated as eager.
+void RLoopManager::SetDataSourceRequiredColumns()
+{
+   auto isEager = [this](RNodeBase *node) {
+      for (; node != nullptr && node != this; node = node->GetPrevNode()) {
+         if (dynamic_cast<RFilterBase *>(node) != nullptr)
+            return false;
+      }
+      return true;
+   };
+
+   std::set<std::string> columns;
+   std::set<std::string> eagerColumns;
+   auto addColumns = [&](const ColumnNames_t &nodeColumns, const RDFInternal::RColumnRegister &nodeColRegister,
+                         bool eager) {
+      std::vector<std::pair<const ColumnNames_t *, const RDFInternal::RColumnRegister *>> toVisit{
+         {&nodeColumns, &nodeColRegister}};
+      std::unordered_set<RDefineBase *> visitedDefines;
+      while (!toVisit.empty()) {
+         const auto [cols, colRegister] = toVisit.back();
+         toVisit.pop_back();
+         for (const auto &col : *cols) {
+            const std::string resolved{colRegister->ResolveAlias(col)};
+            auto *define = colRegister->GetDefine(resolved);
+            if (define == nullptr) {
+               if (fDataSource->HasColumn(resolved)) {
+                  columns.insert(resolved);
+                  if (eager)
+                     eagerColumns.insert(resolved);
+               }
+               continue;
+            }
+            std::vector<RDefineBase *> defines{define};
+            if (auto *jittedDefine = dynamic_cast<RJittedDefine *>(define))
+               defines.push_back(jittedDefine->GetConcreteDefine());
+            for (auto *d : defines) {
+               if (d != nullptr && visitedDefines.insert(d).second)
+                  toVisit.emplace_back(&d->GetColumnNames(), &d->GetColRegister());
+            }
+         }
+      }
+   };
+
+   for (auto *action : fBookedActions)
+      addColumns(action->GetColumnNames(), action->GetColRegister(), isEager(action->GetPrevNode()));
+   for (auto *filter : fBookedFilters)
+      addColumns(filter->GetColumnNames(), filter->GetColRegister(), isEager(filter->GetPrevNode()));
+   // variations are evaluated whenever a varied node needs them: conservatively consider their inputs eager
+   for (auto *variation : fBookedVariations)
+      addColumns(variation->GetInputColumnNames(), variation->GetColRegister(), true);
+
+   fDataSource->SetRequiredColumns({columns.begin(), columns.end()}, {eagerColumns.begin(), eagerColumns.end()});
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -832,8 +1118,11 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       ptr->FinalizeSlot(slot);
    for (auto *ptr : fBookedFilters)
       ptr->FinalizeSlot(slot);
-   for (auto *ptr : fBookedDefines)
+   for (auto *ptr : fBookedDefines) {
+      if (fSkipUnusedDefines && fUsedDefines.count(ptr) == 0)
+         continue;
       ptr->FinalizeSlot(slot);
+   }
 
    if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT) {
       // we are reading from a tree/chain and we need to re-create the RTreeColumnReaders at every task
@@ -992,6 +1281,38 @@ void RLoopManager::Deregister(RDefineBase *ptr)
    fSampleCallbacks.erase(ptr);
 }
 
+std::shared_ptr<RJittedDefine> RLoopManager::GetJittedDefine(const std::string &signature)
+{
+   auto it = fJittedDefines.find(signature);
+   if (it == fJittedDefines.end())
+      return nullptr;
+   auto jittedDefine = it->second.lock();
+   if (!jittedDefine)
+      fJittedDefines.erase(it);
+   return jittedDefine;
+}
+
+void RLoopManager::AddJittedDefine(const std::string &signature, const std::shared_ptr<RJittedDefine> &jittedDefine)
+{
+   fJittedDefines[signature] = jittedDefine;
+}
+
+std::shared_ptr<RJittedFilter> RLoopManager::GetJittedFilter(const std::string &signature)
+{
+   auto it = fJittedFilters.find(signature);
+   if (it == fJittedFilters.end())
+      return nullptr;
+   auto jittedFilter = it->second.lock();
+   if (!jittedFilter)
+      fJittedFilters.erase(it);
+   return jittedFilter;
+}
+
+void RLoopManager::AddJittedFilter(const std::string &signature, const std::shared_ptr<RJittedFilter> &jittedFilter)
+{
+   fJittedFilters[signature] = jittedFilter;
+}
+
 void RLoopManager::Register(RDFInternal::RVariationBase *v)
 {
    fBookedVariations.emplace_back(v);
@@ -1008,6 +1329,11 @@ bool RLoopManager::CheckFilters(unsigned int, Long64_t)
    return true;
 }
 
+void RLoopManager::CheckFiltersBulk(unsigned int, Long64_t, ROOT::RVecB &mask)
+{
+   std::fill(mask.begin(), mask.end(), true);
+}
+
 /// Call `FillReport` on all booked filters
 void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 {
@@ -1048,6 +1374,32 @@ std::vector<std::string> RLoopManager::GetFiltersNames()
    return filters;
 }
 
+/// Return the profile of the nodes of the computation graph as a JSON object. Only the nodes that were part of
+/// an event loop run with profiling enabled are listed. Times are estimated wall-clock times in seconds.
+std::string RLoopManager::GetProfileAsJSON() const
+{
+   std::ostringstream os;
+   os << "{\"nodes\":[";
+   bool isFirst = true;
+   auto writeNode = [&](const std::string &type, const std::string &name, const RNodeProfile *profile) {
+      if (profile == nullptr)
+         return;
+      if (!isFirst)
+         os << ",";
+      isFirst = false;
+      WriteProfileAsJSON(os, type, name, *profile);
+   };
+
+   for (auto *filter : fBookedFilters)
+      writeNode("Filter", filter->HasName() ? filter->GetName() : "Filter", filter->GetProfile());
+   for (auto *define : fBookedDefines)
+      writeNode("Define", define->GetName(), define->GetProfile());
+   for (auto *action : GetAllActions())
+      writeNode("Action", action->GetActionName(), action->GetProfile());
+   os << "]}";
+   return os.str();
+}
+
 std::vector<RNodeBase *> RLoopManager::GetGraphEdges() const
 {
    std::vector<RNodeBase *> nodes(fBookedFilters.size() + fBookedRanges.size());
@@ -26,9 +26,11 @@
 #include <TError.h>
 #include <TSystem.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -188,6 +190,15 @@ public:
             iReal->SetOnDiskId(descGuard->FindFieldId(fDataSource->fFieldId2QualifiedName.at(iProto->GetOnDiskId())));
          }
       }
+      // Columns are added to the page source when connecting, so the deferred fields need to be marked first
+      const auto &deferredNames = fDataSource->fDeferredFieldNames;
+      source.SetDeferredField(fField->GetOnDiskId(),
+                              deferredNames.count(fDataSource->fFieldId2QualifiedName.at(fProtoField->GetOnDiskId())));
+      auto iProto = fProtoField->cbegin();
+      for (auto iReal = fField->begin(); iReal != fField->end(); ++iProto, ++iReal) {
+         source.SetDeferredField(iReal->GetOnDiskId(),
+                                 deferredNames.count(fDataSource->fFieldId2QualifiedName.at(iProto->GetOnDiskId())));
+      }
 
       ROOT::Experimental::Internal::CallConnectPageSourceOnField(*fField, source);
 
@@ -486,9 +497,107 @@ void RNTupleDS::StageNextSources()
    }
 }
 
+bool RNTupleDS::IsClusterSelected(const RNTupleDescriptor &desc, const RClusterDescriptor &clusterDesc) const
+{
+   for (const auto &filter : fClusterFilters) {
+      const auto fieldId = desc.FindFieldId(filter.fFieldName);
+      if (fieldId == kInvalidDescriptorId)
+         continue;
+      // Check the principal columns of all the representations of the field
+      for (const auto &columnDesc : desc.GetColumnIterable(fieldId)) {
+         if ((columnDesc.GetIndex() != 0) || !clusterDesc.ContainsColumn(columnDesc.GetPhysicalId()))
+            continue;
+         const auto &columnRange = clusterDesc.GetColumnRange(columnDesc.GetPhysicalId());
+         if (columnRange.fIsSuppressed || !columnRange.fMinMax)
+            continue;
+         if ((columnRange.fMinMax->second < filter.fMin) || (columnRange.fMinMax->first > filter.fMax))
+            return false;
+      }
+   }
+   return true;
+}
+
+bool RNTupleDS::ApplyClusterFilters(Internal::RPageSource &source, ULong64_t &start, ULong64_t &end) const
+{
+   auto descriptorGuard = source.GetSharedDescriptorGuard();
+   ULong64_t selectedStart = end;
+   ULong64_t selectedEnd = start;
+   auto clusterId = descriptorGuard->FindClusterId(0, 0);
+   while (clusterId != kInvalidDescriptorId) {
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+      const ULong64_t clusterStart = clusterDesc.GetFirstEntryIndex();
+      const ULong64_t clusterEnd = clusterStart + clusterDesc.GetNEntries();
+      if ((clusterEnd > start) && (clusterStart < end) && IsClusterSelected(descriptorGuard.GetRef(), clusterDesc)) {
+         selectedStart = std::min(selectedStart, std::max(clusterStart, start));
+         selectedEnd = std::max(selectedEnd, std::min(clusterEnd, end));
+      }
+      clusterId = descriptorGuard->FindNextClusterId(clusterId);
+   }
+
+   if (selectedStart >= selectedEnd)
+      return false;
+   start = selectedStart;
+   end = selectedEnd;
+   return true;
+}
+
+void RNTupleDS::AddClusterFilter(std::string_view colName, double min, double max)
+{
+   const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
+   if (index == static_cast<std::ptrdiff_t>(fColumnNames.size()))
+      throw std::runtime_error("RNTupleDS: unknown column '" + std::string(colName) + "' in cluster filter");
+   if (colName.substr(0, 13) == "R_rdf_sizeof_")
+      throw std::runtime_error("RNTupleDS: cluster filters are not supported for collection size columns");
+   if (!(min <= max))
+      throw std::runtime_error("RNTupleDS: invalid cluster filter range for column '" + std::string(colName) + "'");
+
+   // Collections and fixed-size arrays are filtered according to the statistics of their (inner-most) items
+   auto fieldId = fProtoFields[index]->GetOnDiskId();
+   while (true) {
+      const auto &fieldDesc = fPrincipalDescriptor->GetFieldDescriptor(fieldId);
+      if ((fieldDesc.GetStructure() != ENTupleStructure::kCollection) && (fieldDesc.GetNRepetitions() == 0))
+         break;
+      fieldId = fieldDesc.GetLinkIds().at(0);
+   }
+   if (fPrincipalDescriptor->GetFieldDescriptor(fieldId).GetStructure() != ENTupleStructure::kLeaf)
+      throw std::runtime_error("RNTupleDS: cluster filters require a column of numeric values: " + std::string(colName));
+
+   fClusterFilters.push_back({fPrincipalDescriptor->GetQualifiedFieldName(fieldId), min, max});
+}
+
+void RNTupleDS::SetRequiredColumns(const std::vector<std::string> &columns,
+                                   const std::vector<std::string> &eagerColumns)
+{
+   auto addFieldNames = [this](const std::string &colName, std::unordered_set<std::string> &fieldNames) {
+      const auto index =
+         std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
+      if (index == static_cast<std::ptrdiff_t>(fColumnNames.size()))
+         return;
+      const auto field = fProtoFields[index].get();
+      fieldNames.insert(fPrincipalDescriptor->GetQualifiedFieldName(field->GetOnDiskId()));
+      for (const auto &s : *field)
+         fieldNames.insert(fPrincipalDescriptor->GetQualifiedFieldName(s.GetOnDiskId()));
+   };
+
+   std::unordered_set<std::string> eagerFieldNames;
+   for (const auto &colName : eagerColumns)
+      addFieldNames(colName, eagerFieldNames);
+
+   // A field stays eager if any eager column shares it, e.g. the collection offsets read by `#jets`
+   fDeferredFieldNames.clear();
+   std::unordered_set<std::string> lazyFieldNames;
+   for (const auto &colName : columns)
+      addFieldNames(colName, lazyFieldNames);
+   for (const auto &name : lazyFieldNames) {
+      if (eagerFieldNames.count(name) == 0)
+         fDeferredFieldNames.insert(name);
+   }
+}
+
 void RNTupleDS::PrepareNextRanges()
 {
    assert(fNextRanges.empty());
+   fNEntriesNextRanges = 0;
    auto nFiles = fFileNames.empty() ? 1 : fFileNames.size();
    auto nRemainingFiles = nFiles - fNextFileIndex;
    if (nRemainingFiles == 0)
@@ -510,10 +619,17 @@ void RNTupleDS::PrepareNextRanges()
          fNextFileIndex++;
 
          auto nEntries = range.fSource->GetNEntries();
+         range.fFileOffset = fNEntriesNextRanges;
+         fNEntriesNextRanges += nEntries;
          if (nEntries == 0)
             continue;
 
          range.fLastEntry = nEntries; // whole file per slot, i.e. entry range [0..nEntries - 1]
+         if (!fClusterFilters.empty()) {
+            if (!ApplyClusterFilters(*range.fSource, range.fFirstEntry, range.fLastEntry))
+               continue;
+            range.fSource->SetEntryRange({range.fFirstEntry, range.fLastEntry - range.fFirstEntry});
+         }
          fNextRanges.emplace_back(std::move(range));
       }
       return;
@@ -534,6 +650,8 @@ void RNTupleDS::PrepareNextRanges()
       fNextFileIndex++;
 
       auto nEntries = source->GetNEntries();
+      const auto fileOffset = fNEntriesNextRanges;
+      fNEntriesNextRanges += nEntries;
       if (nEntries == 0)
          continue;
 
@@ -547,11 +665,16 @@ void RNTupleDS::PrepareNextRanges()
          auto clusterId = descriptorGuard->FindClusterId(0, 0);
          while (clusterId != kInvalidDescriptorId) {
             const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
-            rangesByCluster.emplace_back(std::make_pair<ULong64_t, ULong64_t>(
-               clusterDesc.GetFirstEntryIndex(), clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries()));
+            if (fClusterFilters.empty() || IsClusterSelected(descriptorGuard.GetRef(), clusterDesc)) {
+               rangesByCluster.emplace_back(std::make_pair<ULong64_t, ULong64_t>(
+                  clusterDesc.GetFirstEntryIndex(), clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries()));
+            }
             clusterId = descriptorGuard->FindNextClusterId(clusterId);
          }
       }
+      // All clusters may have been skipped by the cluster filters
+      if (rangesByCluster.empty())
+         continue;
       const unsigned int nRangesByCluster = rangesByCluster.size();
 
       // Distribute slots equidistantly over the entry range, aligned on cluster boundaries
@@ -576,6 +699,7 @@ void RNTupleDS::PrepareNextRanges()
          range.fSource->SetEntryRange({start, end - start});
          range.fFirstEntry = start;
          range.fLastEntry = end;
+         range.fFileOffset = fileOffset;
          fNextRanges.emplace_back(std::move(range));
       }
    } // loop over tail of remaining files
@@ -616,6 +740,7 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 
       fCurrentRanges.clear();
       std::swap(fCurrentRanges, fNextRanges);
+      fNEntriesCurrentRanges = fNEntriesNextRanges;
    }
 
    // Stage next batch of files for the next call to GetEntryRanges()
@@ -631,28 +756,22 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    // entry ranges, given the current state of the entry cursor.
    // We remember the connection from first absolute entry index of a range to its REntryRangeDS record
    // so that we can properly rewire the column reader in InitSlot
+   // Several consecutive ranges may operate on the same file (each with their own page source clone).
+   // The file offset of the ranges accounts for the entries of the preceding files in the list of ranges,
+   // including files and clusters that are skipped because of cluster filters.
    fFirstEntry2RangeIdx.clear();
-   ULong64_t nEntriesPerSource = 0;
    for (std::size_t i = 0; i < fCurrentRanges.size(); ++i) {
-      // Several consecutive ranges may operate on the same file (each with their own page source clone).
-      // We can detect a change of file when the first entry number jumps back to 0.
-      if (fCurrentRanges[i].fFirstEntry == 0) {
-         // New source
-         fSeenEntries += nEntriesPerSource;
-         nEntriesPerSource = 0;
-      }
-      auto start = fCurrentRanges[i].fFirstEntry + fSeenEntries;
-      auto end = fCurrentRanges[i].fLastEntry + fSeenEntries;
-      nEntriesPerSource += end - start;
+      auto start = fCurrentRanges[i].fFirstEntry + fCurrentRanges[i].fFileOffset + fSeenEntries;
+      auto end = fCurrentRanges[i].fLastEntry + fCurrentRanges[i].fFileOffset + fSeenEntries;
 
       fFirstEntry2RangeIdx[start] = i;
       ranges.emplace_back(start, end);
    }
-   fSeenEntries += nEntriesPerSource;
+   fSeenEntries += fNEntriesCurrentRanges;
 
    if ((fNSlots == 1) && (fCurrentRanges[0].fSource)) {
       for (auto r : fActiveColumnReaders[0]) {
-         r->Connect(*fCurrentRanges[0].fSource, ranges[0].first);
+         r->Connect(*fCurrentRanges[0].fSource, ranges[0].first - fCurrentRanges[0].fFirstEntry);
       }
    }
 
@@ -0,0 +1,45 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNodeProfile.hxx"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+using ROOT::Internal::RDF::RNodeProfile;
+
+RNodeProfile::RSlotStats RNodeProfile::GetTotals() const
+{
+   RSlotStats totals;
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      const auto &stats = GetSlotStats(slot);
+      totals.fNCalls += stats.fNCalls;
+      totals.fNPassed += stats.fNPassed;
+      totals.fNTimed += stats.fNTimed;
+      totals.fTimedNs += stats.fTimedNs;
+   }
+   return totals;
+}
+
+double RNodeProfile::GetEstimatedTime(const RSlotStats &stats)
+{
+   if (stats.fNTimed == 0)
+      return 0.;
+   return 1e-9 * stats.fTimedNs * (double(stats.fNCalls) / stats.fNTimed);
+}
+
+std::string RNodeProfile::GetSummary() const
+{
+   const auto totals = GetTotals();
+   std::ostringstream summary;
+   summary << std::setprecision(3) << GetEstimatedTime(totals) << " s, " << totals.fNCalls << " calls";
+   if (fHasPassRate && totals.fNCalls > 0)
+      summary << ", " << std::fixed << std::setprecision(1) << 100. * totals.fNPassed / totals.fNCalls << "% passed";
+   return summary.str();
+}
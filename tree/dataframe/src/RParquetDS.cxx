@@ -0,0 +1,272 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// clang-format off
+/** \file RParquetDS.cxx
+    \ingroup dataframe
+    \brief Reading of Apache Parquet files with RDataFrame.
+
+ROOT::RDF::FromParquet creates an RDataFrame that reads a Parquet file, e.g. one written by a Spark job, without
+converting it first. The file is decoded by the Parquet library of Apache Arrow and the values are served by an
+RArrowDS that streams the record batches:
+- the file is read through ROOT::Internal::RRawFile, so that local and remote files (e.g. via HTTP) are supported;
+- only the column chunks of the requested columns are read from the file;
+- every row group is read as one record batch, hence it is processed as one entry range and in parallel to the
+  other row groups when implicit multi-threading is enabled;
+- row groups can be skipped using the min/max statistics stored in the file: for every RParquetRange passed to
+  FromParquet, the row groups in which no value of the column lies in [fMin, fMax] are not read at all.
+
+RDataFrame cannot inspect the expressions of its Filters, so the ranges have to be passed explicitly. They only
+allow to skip reading: the corresponding selection must still be applied with Filter. The entries of the skipped
+row groups are not counted, i.e. the entry numbers are contiguous over the row groups that are read.
+
+~~~{.cpp}
+auto df = ROOT::RDF::FromParquet("https://example.org/events.parquet", {"pt", "eta"}, {{"pt", 20., 1e9}});
+auto h = df.Filter("pt > 20").Histo1D("eta");
+~~~
+
+As for all RDataFrames based on a stream of record batches, a single event loop can run on the RDataFrame.
+*/
+// clang-format on
+
+#include <ROOT/RArrowDS.hxx>
+#include <ROOT/RParquetDS.hxx>
+#include <ROOT/RRawFile.hxx>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/buffer.h>
+#include <arrow/io/interfaces.h>
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/schema.h>
+#include <parquet/file_reader.h>
+#include <parquet/metadata.h>
+#include <parquet/statistics.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+/// Exposes an RRawFile as an Arrow file, which the Parquet reader reads from with (possibly concurrent) ReadAt.
+class RRawFileArrowInput final : public arrow::io::RandomAccessFile {
+   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   std::mutex fMutex; ///< Serializes the reads of fFile
+   std::int64_t fPosition = 0;
+   bool fIsClosed = false;
+
+public:
+   explicit RRawFileArrowInput(std::string_view fileName) : fFile(ROOT::Internal::RRawFile::Create(fileName)) {}
+
+   arrow::Status Close() override
+   {
+      fIsClosed = true;
+      return arrow::Status::OK();
+   }
+   bool closed() const override { return fIsClosed; }
+
+   arrow::Result<std::int64_t> Tell() const override { return fPosition; }
+   arrow::Status Seek(std::int64_t position) override
+   {
+      fPosition = position;
+      return arrow::Status::OK();
+   }
+
+   arrow::Result<std::int64_t> GetSize() override
+   {
+      try {
+         return static_cast<std::int64_t>(fFile->GetSize());
+      } catch (const std::exception &e) {
+         return arrow::Status::IOError(e.what());
+      }
+   }
+
+   arrow::Result<std::int64_t> ReadAt(std::int64_t position, std::int64_t nBytes, void *out) override
+   {
+      try {
+         std::lock_guard<std::mutex> lock(fMutex);
+         return static_cast<std::int64_t>(fFile->ReadAt(out, nBytes, position));
+      } catch (const std::exception &e) {
+         return arrow::Status::IOError(e.what());
+      }
+   }
+
+   arrow::Result<std::shared_ptr<arrow::Buffer>> ReadAt(std::int64_t position, std::int64_t nBytes) override
+   {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateResizableBuffer(nBytes));
+      ARROW_ASSIGN_OR_RAISE(auto nRead, ReadAt(position, nBytes, buffer->mutable_data()));
+      ARROW_RETURN_NOT_OK(buffer->Resize(nRead));
+      return std::shared_ptr<arrow::Buffer>(std::move(buffer));
+   }
+
+   arrow::Result<std::int64_t> Read(std::int64_t nBytes, void *out) override
+   {
+      ARROW_ASSIGN_OR_RAISE(auto nRead, ReadAt(fPosition, nBytes, out));
+      fPosition += nRead;
+      return nRead;
+   }
+
+   arrow::Result<std::shared_ptr<arrow::Buffer>> Read(std::int64_t nBytes) override
+   {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(fPosition, nBytes));
+      fPosition += buffer->size();
+      return buffer;
+   }
+};
+
+/// The record batches of the selected row groups. Owns the Parquet reader, which the batches are read from.
+class RRowGroupBatchReader final : public arrow::RecordBatchReader {
+   std::unique_ptr<parquet::arrow::FileReader> fFileReader;
+   std::unique_ptr<arrow::RecordBatchReader> fBatchReader;
+
+public:
+   RRowGroupBatchReader(std::unique_ptr<parquet::arrow::FileReader> fileReader,
+                        std::unique_ptr<arrow::RecordBatchReader> batchReader)
+      : fFileReader(std::move(fileReader)), fBatchReader(std::move(batchReader))
+   {
+   }
+
+   std::shared_ptr<arrow::Schema> schema() const override { return fBatchReader->schema(); }
+   arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override
+   {
+      return fBatchReader->ReadNext(batch);
+   }
+};
+
+void ThrowIfError(const arrow::Status &status, const std::string &what)
+{
+   if (!status.ok())
+      throw std::runtime_error("FromParquet: could not " + what + ": " + status.ToString());
+}
+
+/// Append the indices of the Parquet leaf columns that make up the field to `indices`.
+void CollectLeafColumns(const parquet::arrow::SchemaField &field, std::vector<int> &indices)
+{
+   if (field.column_index >= 0)
+      indices.push_back(field.column_index);
+   for (const auto &child : field.children)
+      CollectLeafColumns(child, indices);
+}
+
+template <typename DataType>
+bool GetMinMax(const parquet::Statistics &stats, double &min, double &max)
+{
+   const auto &typedStats = static_cast<const parquet::TypedStatistics<DataType> &>(stats);
+   min = static_cast<double>(typedStats.min());
+   max = static_cast<double>(typedStats.max());
+   return true;
+}
+
+/// Whether the statistics of the column chunk show that none of its values lie in [range.fMin, range.fMax].
+/// Chunks without statistics, or of non-numerical columns, are never excluded.
+bool IsExcluded(const parquet::ColumnChunkMetaData &chunk, const ROOT::RDF::RParquetRange &range)
+{
+   if (!chunk.is_stats_set())
+      return false;
+   const auto stats = chunk.statistics();
+   if (!stats || !stats->HasMinMax())
+      return false;
+
+   double min = 0.;
+   double max = 0.;
+   bool hasMinMax = false;
+   switch (stats->physical_type()) {
+   case parquet::Type::INT32: hasMinMax = GetMinMax<parquet::Int32Type>(*stats, min, max); break;
+   case parquet::Type::INT64: hasMinMax = GetMinMax<parquet::Int64Type>(*stats, min, max); break;
+   case parquet::Type::FLOAT: hasMinMax = GetMinMax<parquet::FloatType>(*stats, min, max); break;
+   case parquet::Type::DOUBLE: hasMinMax = GetMinMax<parquet::DoubleType>(*stats, min, max); break;
+   default: break;
+   }
+   return hasMinMax && (max < range.fMin || min > range.fMax);
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace RDF {
+
+/// \brief Factory method to create an RDataFrame that reads an Apache Parquet file.
+///
+/// See RParquetDS.cxx for a description of how the file is read.
+/// \param[in] fileName the name or URL of the Parquet file, anything that ROOT::Internal::RRawFile can open.
+/// \param[in] columnNames the names of the columns to read, all the columns of the file if empty.
+/// \param[in] ranges intervals of values of numerical columns: the row groups that have no value in one of the
+///            intervals, according to the statistics stored in the file, are skipped.
+RDataFrame
+FromParquet(std::string_view fileName, const std::vector<std::string> &columnNames,
+            const std::vector<RParquetRange> &ranges)
+{
+   std::shared_ptr<arrow::io::RandomAccessFile> input = std::make_shared<RRawFileArrowInput>(fileName);
+   std::unique_ptr<parquet::arrow::FileReader> fileReader;
+   ThrowIfError(parquet::arrow::OpenFile(input, arrow::default_memory_pool(), &fileReader),
+                "open the Parquet file " + std::string(fileName));
+
+   // Column pruning: only the leaf columns of the requested top-level fields are read
+   const auto &fields = fileReader->manifest().schema_fields;
+   std::vector<int> columnIndices;
+   if (columnNames.empty()) {
+      for (const auto &field : fields)
+         CollectLeafColumns(field, columnIndices);
+   }
+   for (const auto &columnName : columnNames) {
+      auto field = std::find_if(fields.begin(), fields.end(), [&](const parquet::arrow::SchemaField &f) {
+         return f.field->name() == columnName;
+      });
+      if (field == fields.end())
+         throw std::runtime_error("FromParquet: the file " + std::string(fileName) + " does not have column " +
+                                  columnName);
+      CollectLeafColumns(*field, columnIndices);
+   }
+
+   // Statistics pushdown: select the row groups that can contain entries in all the ranges
+   const auto metadata = fileReader->parquet_reader()->metadata();
+   std::vector<int> rangeColumns;
+   for (const auto &range : ranges) {
+      const auto columnIndex = metadata->schema()->ColumnIndex(range.fColumnName);
+      if (columnIndex < 0)
+         throw std::runtime_error("FromParquet: the file " + std::string(fileName) +
+                                  " does not have a numerical column " + range.fColumnName);
+      rangeColumns.push_back(columnIndex);
+   }
+   std::vector<int> rowGroups;
+   std::int64_t maxRowGroupSize = 1;
+   for (int i = 0; i < metadata->num_row_groups(); ++i) {
+      const auto rowGroup = metadata->RowGroup(i);
+      bool isExcluded = false;
+      for (std::size_t r = 0; r < ranges.size() && !isExcluded; ++r)
+         isExcluded = IsExcluded(*rowGroup->ColumnChunk(rangeColumns[r]), ranges[r]);
+      if (isExcluded)
+         continue;
+      rowGroups.push_back(i);
+      maxRowGroupSize = std::max(maxRowGroupSize, rowGroup->num_rows());
+   }
+
+   // One record batch, hence one entry range, per row group
+   fileReader->set_batch_size(maxRowGroupSize);
+   std::unique_ptr<arrow::RecordBatchReader> batchReader;
+   ThrowIfError(fileReader->GetRecordBatchReader(rowGroups, columnIndices, &batchReader),
+                "read the row groups of the Parquet file " + std::string(fileName));
+
+   auto rowGroupReader = std::make_shared<RRowGroupBatchReader>(std::move(fileReader), std::move(batchReader));
+   return FromArrow(std::move(rowGroupReader), columnNames);
+}
+
+} // namespace RDF
+} // namespace ROOT
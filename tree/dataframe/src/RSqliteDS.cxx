@@ -328,19 +328,6 @@ struct RSqliteDSDataSet {
 };
 }
 
-RSqliteDS::Value_t::Value_t(RSqliteDS::ETypes type)
-   : fType(type), fIsActive(false), fInteger(0), fReal(0.0), fText(), fBlob(), fNull(nullptr)
-{
-   switch (type) {
-   case ETypes::kInteger: fPtr = &fInteger; break;
-   case ETypes::kReal: fPtr = &fReal; break;
-   case ETypes::kText: fPtr = &fText; break;
-   case ETypes::kBlob: fPtr = &fBlob; break;
-   case ETypes::kNull: fPtr = &fNull; break;
-   default: throw std::runtime_error("Internal error");
-   }
-}
-
 constexpr char const *RSqliteDS::fgTypeNames[];
 
 ////////////////////////////////////////////////////////////////////////////
@@ -350,7 +337,7 @@ constexpr char const *RSqliteDS::fgTypeNames[];
 ///
 /// The constructor opens the sqlite file, prepares the query engine and determines the column names and types.
 RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
-   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0)
+   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0), fFirstRowInBatch(0)
 {
    static bool hasSqliteVfs = RegisterSqliteVfs();
    if (!hasSqliteVfs)
@@ -381,7 +368,7 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
    if ((retval != SQLITE_ROW) && (retval != SQLITE_DONE))
       SqliteError(retval);
 
-   fValues.reserve(colCount);
+   fColumns.reserve(colCount);
    for (int i = 0; i < colCount; ++i) {
       fColumnNames.emplace_back(sqlite3_column_name(fDataSet->fQuery, i));
       int type = SQLITE_NULL;
@@ -409,24 +396,24 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
       switch (type) {
       case SQLITE_INTEGER:
          fColumnTypes.push_back(ETypes::kInteger);
-         fValues.emplace_back(ETypes::kInteger);
+         fColumns.emplace_back(ETypes::kInteger);
          break;
       case SQLITE_FLOAT:
          fColumnTypes.push_back(ETypes::kReal);
-         fValues.emplace_back(ETypes::kReal);
+         fColumns.emplace_back(ETypes::kReal);
          break;
       case SQLITE_TEXT:
          fColumnTypes.push_back(ETypes::kText);
-         fValues.emplace_back(ETypes::kText);
+         fColumns.emplace_back(ETypes::kText);
          break;
       case SQLITE_BLOB:
          fColumnTypes.push_back(ETypes::kBlob);
-         fValues.emplace_back(ETypes::kBlob);
+         fColumns.emplace_back(ETypes::kBlob);
          break;
       case SQLITE_NULL:
          // TODO: Null values in first rows are not well handled
          fColumnTypes.push_back(ETypes::kNull);
-         fValues.emplace_back(ETypes::kNull);
+         fColumns.emplace_back(ETypes::kNull);
          break;
       default: throw std::runtime_error("Unhandled data type");
       }
@@ -471,27 +458,82 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
       throw std::runtime_error(errmsg);
    }
 
-   fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   auto &column = fColumns[index];
+   column.fIsActive = true;
+   std::vector<void *> ptrs;
+   ptrs.reserve(fNSlots);
+   for (auto &ptr : column.fPtrs)
+      ptrs.emplace_back(&ptr);
+   return ptrs;
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Returns a range of size 1 as long as more rows are available in the SQL result set.
-/// This inherently serialized the RDF independent of the number of slots.
+/// Reads the next batch of rows of the SQL result set into the column buffers and splits it in one range per slot.
+/// Only stepping through the result set is serialized; the ranges are processed by the slots in parallel.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
+   const std::size_t nSlots = std::max(fNSlots, 1u);
+   const std::size_t maxRows = nSlots * kBatchRowsPerSlot;
+
+   fFirstRowInBatch = fNRow;
+   std::size_t nRows = 0;
+   while (nRows < maxRows) {
+      int retval = sqlite3_step(fDataSet->fQuery);
+      if (retval == SQLITE_DONE)
+         break;
+      if (retval != SQLITE_ROW)
+         SqliteError(retval);
+      FetchRow(nRows++);
+   }
+   fNRow += nRows;
+
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   int retval = sqlite3_step(fDataSet->fQuery);
-   switch (retval) {
-   case SQLITE_DONE: return entryRanges;
-   case SQLITE_ROW:
-      entryRanges.emplace_back(fNRow, fNRow + 1);
-      fNRow++;
-      return entryRanges;
-   default:
-      SqliteError(retval);
-      // Never here
-      abort();
+   const std::size_t rowsPerRange = (nRows + nSlots - 1) / nSlots;
+   for (std::size_t first = 0; first < nRows; first += rowsPerRange)
+      entryRanges.emplace_back(fFirstRowInBatch + first, fFirstRowInBatch + std::min(first + rowsPerRange, nRows));
+   return entryRanges;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Converts the current row of the sqlite query into the active column buffers at position `row`.
+void RSqliteDS::FetchRow(std::size_t row)
+{
+   unsigned N = fColumns.size();
+   for (unsigned i = 0; i < N; ++i) {
+      auto &column = fColumns[i];
+      if (!column.fIsActive)
+         continue;
+
+      const void *data;
+      int nbytes;
+      switch (column.fType) {
+      case ETypes::kInteger:
+         column.fInteger.resize(std::max(column.fInteger.size(), row + 1));
+         column.fInteger[row] = sqlite3_column_int64(fDataSet->fQuery, i);
+         break;
+      case ETypes::kReal:
+         column.fReal.resize(std::max(column.fReal.size(), row + 1));
+         column.fReal[row] = sqlite3_column_double(fDataSet->fQuery, i);
+         break;
+      case ETypes::kText:
+         column.fText.resize(std::max(column.fText.size(), row + 1));
+         // sqlite3_column_bytes() has to be called after the conversion to text
+         data = sqlite3_column_text(fDataSet->fQuery, i);
+         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         column.fText[row].assign(nbytes > 0 ? reinterpret_cast<const char *>(data) : "", nbytes);
+         break;
+      case ETypes::kBlob:
+         column.fBlob.resize(std::max(column.fBlob.size(), row + 1));
+         data = sqlite3_column_blob(fDataSet->fQuery, i);
+         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         column.fBlob[row].resize(nbytes);
+         if (nbytes > 0) {
+            std::memcpy(column.fBlob[row].data(), data, nbytes);
+         }
+         break;
+      case ETypes::kNull: break;
+      default: throw std::runtime_error("Unhandled column type");
+      }
    }
 }
 
@@ -542,36 +584,21 @@ RDataFrame FromSqlite(std::string_view fileName, std::string_view query)
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
+/// Points the slot's column readers to the given row of the current batch.
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   assert(entry + 1 == fNRow);
-   (void)entry;
-   unsigned N = fValues.size();
-   for (unsigned i = 0; i < N; ++i) {
-      if (!fValues[i].fIsActive)
+   assert(entry >= fFirstRowInBatch && entry < fNRow);
+   const auto row = entry - fFirstRowInBatch;
+   for (auto &column : fColumns) {
+      if (!column.fIsActive)
          continue;
 
-      int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
-      case ETypes::kText:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         if (nbytes == 0) {
-            fValues[i].fText = "";
-         } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
-         }
-         break;
-      case ETypes::kBlob:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
-         if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
-         }
-         break;
-      case ETypes::kNull: break;
+      switch (column.fType) {
+      case ETypes::kInteger: column.fPtrs[slot] = &column.fInteger[row]; break;
+      case ETypes::kReal: column.fPtrs[slot] = &column.fReal[row]; break;
+      case ETypes::kText: column.fPtrs[slot] = &column.fText[row]; break;
+      case ETypes::kBlob: column.fPtrs[slot] = &column.fBlob[row]; break;
+      case ETypes::kNull: column.fPtrs[slot] = &column.fNull; break;
       default: throw std::runtime_error("Unhandled column type");
       }
    }
@@ -579,14 +606,12 @@ bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// Sets up the per-slot column readers. Every call to GetEntryRanges() reads kBatchRowsPerSlot rows per slot.
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
-   if (nSlots > 1) {
-      ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                             "Consider turning off IMT.");
-   }
    fNSlots = nSlots;
+   for (auto &column : fColumns)
+      column.fPtrs.assign(fNSlots, nullptr);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,67 @@
+#ifndef ROOT_RREQUIREDCOLUMNSDS
+#define ROOT_RREQUIREDCOLUMNSDS
+
+#include "ROOT/RDataSource.hxx"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/// A RDataSource with a few int columns that records the columns RDataFrame declares it will read
+class RRequiredColumnsDS : public ROOT::RDF::RDataSource {
+   unsigned int fNSlots = 0u;
+   bool fRangeReturned = false;
+   std::vector<int> fValues;
+   std::vector<int *> fValuePtrs;
+   const std::vector<std::string> fColumnNames = {"a", "b", "c", "d"};
+
+public:
+   std::vector<std::string> fRequiredColumns;
+   std::vector<std::string> fEagerColumns;
+
+   void SetNSlots(unsigned int nSlots) final
+   {
+      fNSlots = nSlots;
+      fValues.resize(nSlots);
+      fValuePtrs.resize(nSlots);
+      for (auto i = 0u; i < nSlots; ++i)
+         fValuePtrs[i] = &fValues[i];
+   }
+   const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
+   bool HasColumn(std::string_view name) const final
+   {
+      return std::find(fColumnNames.begin(), fColumnNames.end(), name) != fColumnNames.end();
+   }
+   std::string GetTypeName(std::string_view) const final { return "int"; }
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final
+   {
+      if (fRangeReturned)
+         return {};
+      fRangeReturned = true;
+      return {{0ull, 10ull}};
+   }
+   bool SetEntry(unsigned int slot, ULong64_t entry) final
+   {
+      fValues[slot] = entry;
+      return true;
+   }
+   void SetRequiredColumns(const std::vector<std::string> &columns, const std::vector<std::string> &eager) final
+   {
+      fRequiredColumns = columns;
+      fEagerColumns = eager;
+   }
+   void Initialize() final { fRangeReturned = false; }
+
+   std::string GetLabel() final { return "RequiredColumns"; }
+
+protected:
+   std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final
+   {
+      std::vector<void *> readers;
+      for (auto &ptr : fValuePtrs)
+         readers.emplace_back(&ptr);
+      return readers;
+   }
+};
+
+#endif
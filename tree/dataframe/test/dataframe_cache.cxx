@@ -338,3 +338,32 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+TEST(Cache, Persistent)
+{
+   const auto cacheDir = std::string("dataframe_cache_persistent");
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+   int nCalls = 0;
+   auto makeCache = [&](const std::string &key) {
+      ROOT::RDataFrame df(10);
+      return df.Define("x", [&nCalls](ULong64_t e) { ++nCalls; return static_cast<int>(e); }, {"rdfentry_"})
+         .Filter([](int x) { return x % 2 == 0; }, {"x"}, "even")
+         .PersistentCache({"x"}, cacheDir, key);
+   };
+
+   auto cached = makeCache("v1");
+   EXPECT_EQ(nCalls, 10);
+   EXPECT_EQ(*cached.Take<int>("x"), std::vector<int>({0, 2, 4, 6, 8}));
+
+   // the same graph reuses the cache file without running the upstream event loop
+   auto reused = makeCache("v1");
+   EXPECT_EQ(nCalls, 10);
+   EXPECT_EQ(*reused.Sum<int>("x"), 20);
+
+   // a different key creates a new cache file
+   auto other = makeCache("v2");
+   EXPECT_EQ(nCalls, 20);
+   EXPECT_EQ(*other.Count(), 5u);
+
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
@@ -1,5 +1,6 @@
 #include "TInterpreter.h"
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include "gtest/gtest.h"
 
 TEST(CompGraphTests, ExecOrderTwoDefines)
@@ -84,3 +85,63 @@ TEST(CompGraphTests, ExecOrderThreeDefines)
    EXPECT_EQ(obj->fB, 42.f);
    EXPECT_EQ(obj->fC, "correct");
 }
+
+TEST(CompGraphTests, SharedJittedDefine)
+{
+   gInterpreter->Declare(R"(
+    namespace ROOT::Internal::RDF::Testing {
+        int nSharedDefineCalls{0};
+        int CountSharedDefineCall(ULong64_t e) { ++nSharedDefineCalls; return e; }
+    }
+   )");
+   ROOT::RDataFrame d{10};
+   // the same Define booked on two branches of the graph is evaluated once per entry
+   auto sum = d.Define("x", "ROOT::Internal::RDF::Testing::CountSharedDefineCall(rdfentry_)").Sum<int>("x");
+   auto max = d.Define("x", "ROOT::Internal::RDF::Testing::CountSharedDefineCall(rdfentry_)").Max<int>("x");
+
+   EXPECT_EQ(*sum, 45);
+   EXPECT_EQ(*max, 9);
+   EXPECT_EQ(gInterpreter->Calc("ROOT::Internal::RDF::Testing::nSharedDefineCalls"), 10);
+}
+
+TEST(CompGraphTests, SharedJittedFilter)
+{
+   gInterpreter->Declare(R"(
+    namespace ROOT::Internal::RDF::Testing {
+        int nSharedFilterCalls{0};
+        bool CountSharedFilterCall(ULong64_t e) { ++nSharedFilterCalls; return e > 4; }
+    }
+   )");
+   ROOT::RDataFrame d{10};
+   auto c1 = d.Filter("ROOT::Internal::RDF::Testing::CountSharedFilterCall(rdfentry_)").Count();
+   auto c2 = d.Filter("ROOT::Internal::RDF::Testing::CountSharedFilterCall(rdfentry_)").Count();
+   // named filters are never shared, they are reported separately
+   auto c3 = d.Filter("ROOT::Internal::RDF::Testing::CountSharedFilterCall(rdfentry_)", "named").Count();
+
+   EXPECT_EQ(*c1, 5u);
+   EXPECT_EQ(*c2, 5u);
+   EXPECT_EQ(*c3, 5u);
+   EXPECT_EQ(gInterpreter->Calc("ROOT::Internal::RDF::Testing::nSharedFilterCalls"), 20);
+}
+
+TEST(CompGraphTests, BulkExecution)
+{
+   ROOT::RDataFrame d{1000};
+   // 1000 entries do not fill a whole number of blocks
+   ROOT::RDF::Experimental::EnableBulkExecution(d, 64);
+   auto x = d.Define("x", [](ULong64_t e) { return static_cast<int>(e); }, {"rdfentry_"});
+   auto even = x.Filter([](int v) { return v % 2 == 0; }, {"x"}, "even");
+   auto sum = even.Filter([](int v) { return v > 500; }, {"x"}).Sum<int>("x");
+   auto count = even.Count();
+   auto range = x.Range(10, 20).Take<int>("x");
+   auto report = d.Report();
+
+   int expectedSum = 0;
+   for (int i = 502; i < 1000; i += 2)
+      expectedSum += i;
+   EXPECT_EQ(*sum, expectedSum);
+   EXPECT_EQ(*count, 500u);
+   EXPECT_EQ(*range, std::vector<int>({10, 11, 12, 13, 14, 15, 16, 17, 18, 19}));
+   EXPECT_EQ((*report)["even"].GetAll(), 1000u);
+   EXPECT_EQ((*report)["even"].GetPass(), 500u);
+}
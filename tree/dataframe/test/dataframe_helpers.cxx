@@ -8,6 +8,7 @@
 #include <RConfigure.h>
 
 #include <algorithm>
+#include <numeric>
 #include <deque>
 #include <vector>
 #include <string>
@@ -753,10 +754,187 @@ TEST(RDFHelpers, Cleanup_After_Exception)
       << "The Finalize method should have changed the value of testVal during the post-exception cleanup." << std::endl;
 }
 
+TEST(RDFHelpers, Profiling)
+{
+   ROOT::RDataFrame df(100);
+   ROOT::RDF::Experimental::EnableProfiling(df);
+   auto c = df.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"})
+               .Filter([](ULong64_t x) { return x % 2 == 0; }, {"x"}, "even")
+               .Count();
+
+   auto checkProfile = [&] {
+      const auto json = ROOT::RDF::Experimental::GetProfileAsJSON(df);
+      EXPECT_NE(json.find(R"({"type":"Filter","name":"even","calls":100,"passed":50,)"), std::string::npos) << json;
+      EXPECT_NE(json.find(R"({"type":"Define","name":"x","calls":100,)"), std::string::npos) << json;
+      EXPECT_NE(json.find(R"({"type":"Action","name":"Count","calls":50,)"), std::string::npos) << json;
+
+      const auto graph = ROOT::RDF::SaveGraph(c);
+      EXPECT_NE(graph.find("100 calls, 50.0% passed"), std::string::npos) << graph;
+      EXPECT_NE(graph.find("50 calls"), std::string::npos) << graph;
+   };
+
+   EXPECT_EQ(*c, 50ull);
+   checkProfile();
+
+   // the profile starts from scratch at every event loop, also in bulk execution mode
+   auto c2 = df.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"})
+                .Filter([](ULong64_t x) { return x % 2 == 0; }, {"x"}, "even")
+                .Count();
+   ROOT::RDF::Experimental::EnableBulkExecution(df, 16);
+   EXPECT_EQ(*c2, 50ull);
+   const auto json = ROOT::RDF::Experimental::GetProfileAsJSON(df);
+   EXPECT_NE(json.find(R"({"type":"Action","name":"Count","calls":50,)"), std::string::npos) << json;
+
+   ROOT::RDF::Experimental::EnableProfiling(df, false);
+   auto c3 = df.Count();
+   EXPECT_EQ(*c3, 100ull);
+   EXPECT_EQ(ROOT::RDF::Experimental::GetProfileAsJSON(df).find("\"type\":\"Filter\""), std::string::npos);
+}
+
+TEST(RDFHelpers, PrefetchFiles)
+{
+   // local files are not opened in advance, but prefetching must not change the result, also when the event loop
+   // stops before the end of the chain
+   std::vector<std::string> fileNames;
+   for (auto i = 0; i < 3; ++i) {
+      fileNames.emplace_back("dataframe_helpers_prefetchfiles_" + std::to_string(i) + ".root");
+      ROOT::RDataFrame(10).Define("x", [i](ULong64_t e) { return int(e) + 10 * i; }, {"rdfentry_"})
+         .Snapshot<int>("t", fileNames.back(), {"x"});
+   }
+
+   ROOT::RDataFrame df("t", fileNames);
+   ROOT::RDF::Experimental::PrefetchFiles(df, 2);
+   auto sum = df.Sum<int>("x");
+   auto firstValues = df.Range(15).Take<int>("x");
+   EXPECT_EQ(*sum, 435);
+   EXPECT_EQ(firstValues->size(), 15u);
+   EXPECT_EQ(firstValues->back(), 14);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
+TEST(RDFHelpers, TakeInto)
+{
+   ROOT::RDataFrame df(10000);
+   auto f = df.Define("x", [](ULong64_t e) { return e * 0.5; }, {"rdfentry_"})
+               .Filter([](ULong64_t e) { return e % 3 != 0; }, {"rdfentry_"});
+   std::vector<double> xs(10000, -1.);
+   std::vector<ULong64_t> entries(10000);
+   auto n = ROOT::RDF::Experimental::TakeInto(f, {"x", "rdfentry_"}, xs.size(), xs.data(), entries.data());
+   auto refEntries = f.Take<ULong64_t>("rdfentry_");
+
+   EXPECT_EQ(*n, refEntries->size());
+   entries.resize(*n);
+   EXPECT_EQ(entries, *refEntries); // single-thread: dataset order
+   for (std::size_t i = 0; i < *n; ++i)
+      EXPECT_DOUBLE_EQ(xs[i], entries[i] * 0.5);
+   EXPECT_DOUBLE_EQ(xs[*n], -1.);
+
+   std::vector<double> tooSmall(10);
+   auto fails = ROOT::RDF::Experimental::TakeInto(f, {"x"}, tooSmall.size(), tooSmall.data());
+   EXPECT_THROW(*fails, std::runtime_error);
+   EXPECT_THROW(ROOT::RDF::Experimental::TakeInto(f, {"x", "rdfentry_"}, tooSmall.size(), tooSmall.data()),
+                std::invalid_argument);
+}
+
+TEST(RDFHelpers, Join)
+{
+   // right: keys (run, event) = (1, 0), (1, 0), (1, 2), (1, 4), (1, 4), (1, 4); pt = 0, 1.5, 3, ...
+   const std::vector<int> rightEvents = {0, 0, 2, 4, 4, 4};
+   auto right = ROOT::RDataFrame(6)
+                   .Define("run", [] { return 1u; })
+                   .Define("event", [&](ULong64_t e) { return rightEvents[e]; }, {"rdfentry_"})
+                   .Define("pt", [](ULong64_t e) { return e * 1.5f; }, {"rdfentry_"});
+   auto left = ROOT::RDataFrame(5)
+                  .Define("run", [] { return 1; })
+                  .Define("event", [](ULong64_t e) { return static_cast<Long64_t>(e); }, {"rdfentry_"});
+
+   using ROOT::RDF::Experimental::Join;
+   auto inner = Join<float>(left, right, {"run", "event"}, {"pt"});
+   auto innerEvents = inner.Take<Long64_t>("event");
+   auto innerPts = inner.Take<ROOT::RVecF>("pt");
+   EXPECT_EQ(*innerEvents, std::vector<Long64_t>({0, 2, 4}));
+   ASSERT_EQ(innerPts->size(), 3u);
+   EXPECT_TRUE(All((*innerPts)[0] == ROOT::RVecF({0.f, 1.5f})));
+   EXPECT_TRUE(All((*innerPts)[1] == ROOT::RVecF({3.f})));
+   EXPECT_TRUE(All((*innerPts)[2] == ROOT::RVecF({4.5f, 6.f, 7.5f})));
+
+   auto leftJoin = Join<float>(left, right, {"run", "event"}, {"pt"}, ROOT::RDF::Experimental::EJoinType::kLeft);
+   auto nMatches = leftJoin.Define("n", [](const ROOT::RVecF &pt) { return pt.size(); }, {"pt"}).Take<std::size_t>("n");
+   EXPECT_EQ(*nMatches, std::vector<std::size_t>({2, 0, 1, 0, 3}));
+   // the internal columns of the join are not listed
+   EXPECT_EQ(leftJoin.GetDefinedColumnNames().size(), 3u);
+
+   EXPECT_THROW(Join<float>(left, right, {}, {"pt"}), std::invalid_argument);
+   EXPECT_THROW(Join<float>(left, right, {"event"}, {"pt", "run"}), std::invalid_argument);
+}
+
+TEST(RDFHelpers, OnMergedPartialResult)
+{
+   ROOT::RDataFrame df(100);
+   auto d = df.Define("x", [](ULong64_t e) { return e * 0.01; }, {"rdfentry_"});
+   auto c = d.Count();
+   auto h = d.Histo1D<double>({"h", "h", 10, 0, 1}, "x");
+
+   using ROOT::RDF::Experimental::OnMergedPartialResult;
+   std::vector<ULong64_t> counts;
+   OnMergedPartialResult<ULong64_t>(c, 10, [&](const ULong64_t &n) { counts.push_back(n); },
+                                    std::chrono::milliseconds(0));
+   std::vector<double> entries;
+   OnMergedPartialResult<TH1D>(h, 50, [&](const TH1D &partial) { entries.push_back(partial.GetEntries()); },
+                               std::chrono::milliseconds(0));
+
+   EXPECT_EQ(*c, 100u);
+   EXPECT_EQ(counts, std::vector<ULong64_t>({10, 20, 30, 40, 50, 60, 70, 80, 90, 100}));
+   EXPECT_EQ(entries, std::vector<double>({50., 100.}));
+   EXPECT_THROW(OnMergedPartialResult<ULong64_t>(c, 0, [](const ULong64_t &) {}), std::invalid_argument);
+}
+
 // The code below is a unit test for a function called `ProgressHelper_Existence_MT` in the `RDFHelpers` class.
 
 #ifdef R__USE_IMT
 
+TEST(RDFHelpers, TakeIntoMT)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame df(100000);
+   auto f = df.Define("x", [](ULong64_t e) { return e * 0.5; }, {"rdfentry_"})
+               .Filter([](ULong64_t e) { return e % 3 != 0; }, {"rdfentry_"});
+   std::vector<double> xs(100000);
+   std::vector<ULong64_t> entries(100000);
+   auto n = ROOT::RDF::Experimental::TakeInto(f, {"x", "rdfentry_"}, xs.size(), xs.data(), entries.data());
+
+   EXPECT_EQ(*n, 66666u);
+   // the gaps left by the slots were closed, and the values of an entry stay together
+   for (std::size_t i = 0; i < *n; ++i)
+      EXPECT_DOUBLE_EQ(xs[i], entries[i] * 0.5);
+   entries.resize(*n);
+   std::sort(entries.begin(), entries.end());
+   EXPECT_EQ(std::adjacent_find(entries.begin(), entries.end()), entries.end());
+   EXPECT_EQ(std::count_if(entries.begin(), entries.end(), [](ULong64_t e) { return e % 3 == 0; }), 0);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RDFHelpers, OnMergedPartialResultMT)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame df(100000);
+   auto d = df.Define("x", [](ULong64_t e) { return e * 1e-5; }, {"rdfentry_"});
+   auto h = d.Histo1D<double>({"h", "h", 10, 0, 1}, "x");
+   std::vector<double> entries; // the callback is never invoked concurrently
+   ROOT::RDF::Experimental::OnMergedPartialResult<TH1D>(
+      h, 1000, [&](const TH1D &merged) { entries.push_back(merged.GetEntries()); }, std::chrono::milliseconds(0));
+
+   EXPECT_EQ(h->GetEntries(), 100000.);
+   ASSERT_FALSE(entries.empty());
+   // the merged results cover more and more events, from all slots
+   EXPECT_TRUE(std::is_sorted(entries.begin(), entries.end()));
+   EXPECT_LE(entries.back(), 100000.);
+   EXPECT_GE(entries.back(), 1000.);
+   ROOT::DisableImplicitMT();
+}
+
 TEST(RDFHelpers, ProgressHelper_Existence_MT)
 {
    // Redirect cout.
@@ -791,4 +969,54 @@ TEST(RDFHelpers, ProgressHelper_existence_singleTTreeInput)
 
    EXPECT_FALSE(strCout.str().empty());
 }
+
+TEST(RDFHelpers, ConcurrentHistoFill)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame df(100000);
+   auto d = df.Define("x", [](ULong64_t e) { return (e % 100) / 100.; }, {"rdfentry_"})
+               .Define("v", [](double x) { return ROOT::RVecD(3, x); }, {"x"});
+   auto hRef1 = d.Histo1D<double>({"h1", "h1", 10, 0, 1}, "x");
+   auto hRef3 = d.Histo3D<double, double, ROOT::RVecD>({"h3", "h3", 10, 0, 1, 10, 0, 1, 10, 0, 1}, "x", "x", "v");
+
+   ROOT::RDF::Experimental::EnableConcurrentHistoFill();
+   auto h1 = d.Histo1D<double>({"h1", "h1", 10, 0, 1}, "x");
+   auto h2 = d.Histo2D<double, double, double>({"h2", "h2", 10, 0, 1, 10, 0, 1}, "x", "x", "x");
+   auto h3 = d.Histo3D<double, double, ROOT::RVecD>({"h3", "h3", 10, 0, 1, 10, 0, 1, 10, 0, 1}, "x", "x", "v");
+   auto h2Jitted = d.Histo2D({"h2j", "h2j", 10, 0, 1, 10, 0, 1}, "x", "x");
+   ROOT::RDF::Experimental::EnableConcurrentHistoFill(false);
+
+   EXPECT_EQ(100000, h1->GetEntries());
+   EXPECT_EQ(300000, h3->GetEntries());
+   EXPECT_EQ(100000, h2Jitted->GetEntries());
+   EXPECT_NEAR(hRef1->GetMean(), h1->GetMean(), 1e-9);
+   EXPECT_NEAR(h2->Integral(), d.Sum<double>("x").GetValue(), 1e-6);
+   for (int i = 0; i <= 11; ++i) {
+      EXPECT_DOUBLE_EQ(hRef1->GetBinContent(i), h1->GetBinContent(i));
+      EXPECT_DOUBLE_EQ(hRef3->GetBinContent(i, i, i), h3->GetBinContent(i, i, i));
+   }
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RDFHelpers, TreeReduce)
+{
+   ROOT::EnableImplicitMT(4);
+   for (std::size_t n : {1u, 2u, 3u, 7u, 16u}) {
+      std::vector<std::size_t> values(n);
+      std::iota(values.begin(), values.end(), 1u);
+      ROOT::Internal::RDF::TreeReduce(n, [&values](std::size_t to, std::size_t from) {
+         values[to] += values[from];
+         values[from] = 0;
+      });
+      EXPECT_EQ(n * (n + 1) / 2, values[0]);
+   }
+
+   // The per-slot histograms of a Histo2D are merged pairwise
+   auto df = ROOT::RDataFrame(100000).Define("x", [](ULong64_t e) { return (e % 10 + 0.5) / 10.; }, {"rdfentry_"});
+   auto h2 = df.Histo2D<double, double>({"h2", "h2", 10, 0, 1, 10, 0, 1}, "x", "x");
+   EXPECT_EQ(100000, h2->GetEntries());
+   for (int i = 1; i <= 10; ++i)
+      EXPECT_DOUBLE_EQ(10000, h2->GetBinContent(i, i));
+   ROOT::DisableImplicitMT();
+}
 #endif // R__USE_IMT
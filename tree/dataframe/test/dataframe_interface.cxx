@@ -3,6 +3,7 @@
 
 #include "ROOT/RCsvDS.hxx"
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include <string_view>
 #include "ROOT/RTrivialDS.hxx"
 #include "ROOT/TestSupport.hxx"
@@ -977,3 +978,31 @@ TEST(RDataFrameInterface, GetNFilesFromMoreFiles)
    ROOT::RDataFrame df{"t", filenames};
    EXPECT_EQ(df.GetNFiles(), 3);
 }
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const std::string cacheDir = "dataframe_interface_jitcache";
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+   ROOT::RDF::Experimental::EnableJitCache(cacheDir);
+
+   ROOT::RDataFrame df(4);
+   // an expression that is unique to this test, so that it is not already jitted
+   auto sum = df.Define("jitcache_x", "rdfentry_ * 3 + 17").Sum<ULong64_t>("jitcache_x");
+   EXPECT_EQ(*sum, 86u);
+
+   // either the compiled function or the marker for an expression that cannot be compiled out of the interpreter
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(dir, nullptr);
+   bool hasEntry = false;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name(entry);
+      const bool isCacheEntry = name.find(".h") != std::string::npos || name.find(".failed") != std::string::npos;
+      if (name.find("rdfjit_") == 0 && isCacheEntry)
+         hasEntry = true;
+   }
+   gSystem->FreeDirectory(dir);
+   EXPECT_TRUE(hasEntry);
+
+   ROOT::RDF::Experimental::EnableJitCache("");
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
@@ -41,6 +41,37 @@ TEST(RDataFrameNodes, RSlotStackPutBackTooMany)
    EXPECT_DEATH(theTest(), "Trying to put back a slot to a full stack!");
 }
 
+TEST(RDataFrameNodes, RSlotStackConcurrent)
+{
+   const unsigned int nSlots = 4;
+   ROOT::Internal::RSlotStack s(nSlots);
+   std::vector<std::atomic<int>> inUse(nSlots);
+   std::atomic<int> nClashes{0};
+
+   std::vector<std::thread> ts;
+   for (unsigned int i = 0; i < nSlots; ++i) {
+      ts.emplace_back([&]() {
+         for (int j = 0; j < 10000; ++j) {
+            ROOT::Internal::RSlotStackRAII slotRAII(s);
+            if (inUse[slotRAII.fSlot]++ != 0)
+               ++nClashes;
+            --inUse[slotRAII.fSlot];
+         }
+      });
+   }
+   for (auto &&t : ts)
+      t.join();
+
+   EXPECT_EQ(0, nClashes);
+
+   // A thread gets back the slot it returned last if it is free
+   const auto a = s.GetSlot();
+   const auto b = s.GetSlot();
+   s.ReturnSlot(a);
+   s.ReturnSlot(b);
+   EXPECT_EQ(b, s.GetSlot());
+}
+
 #endif
 
 TEST(RDataFrameNodes, RLoopManagerGetLoopManagerUnchecked)
@@ -1,6 +1,8 @@
 #include "ROOT/RDataFrame.hxx"
 #include <TROOT.h>
 
+#include <atomic>
+
 #include "gtest/gtest.h"
 
 using namespace ROOT;
@@ -94,15 +96,41 @@ TEST_F(RDFRanges, NoEarlyStopping)
 TEST(RDFRangesMT, ThrowIfIMT)
 {
    bool hasThrown = false;
-   ROOT::EnableImplicitMT();
+   ROOT::EnableImplicitMT(4);
    RDataFrame d(0);
    try {
-      d.Range(0);
+      d.Range(5, 10);
    } catch (const std::exception &e) {
       hasThrown = true;
-      EXPECT_STREQ(e.what(), "Range was called with ImplicitMT enabled, but multi-thread is not supported.");
+      EXPECT_STREQ(e.what(), "Range: with ImplicitMT enabled, only ranges with begin equal to 0 and stride equal "
+                             "to 1 are supported.");
    }
    EXPECT_TRUE(hasThrown);
+   EXPECT_THROW(d.Range(0, 10, 2), std::runtime_error);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RDFRangesMT, EarlyStop)
+{
+   ROOT::EnableImplicitMT(4);
+   RDataFrame d(10000000);
+   std::atomic<ULong64_t> nEvaluated{0};
+   auto f = d.Filter(
+      [&nEvaluated](ULong64_t e) {
+         ++nEvaluated;
+         return e % 3 == 0;
+      },
+      {"rdfentry_"});
+   auto entries = f.Range(100).Take<ULong64_t>("rdfentry_");
+   auto count = f.Range(1000).Count();
+
+   EXPECT_EQ(*count, 1000u);
+   EXPECT_EQ(entries->size(), 100u);
+   for (auto e : *entries)
+      EXPECT_EQ(e % 3, 0u);
+   // all slots stopped once both quotas were met, long before the end of the dataset
+   EXPECT_LT(nEvaluated.load(), 10000000u);
+   ROOT::DisableImplicitMT();
 }
 #endif
 
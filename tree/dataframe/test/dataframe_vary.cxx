@@ -3,6 +3,7 @@
 #include <ROOT/RDFHelpers.hxx>
 #include <TSystem.h>
 
+#include <atomic>
 #include <thread> // std::thread::hardware_concurrency
 
 #include "SimpleFiller.h" // for VaryFill
@@ -799,6 +800,25 @@ TEST_P(RDFVary, FilterChainDependingOnVariations)
    EXPECT_EQ(sums["y:1"], 30);
 }
 
+// Nodes that do not depend on a variation are evaluated once per entry and shared by all varied universes
+TEST_P(RDFVary, NominalNodesAreShared)
+{
+   std::atomic<int> nDefineCalls{0};
+   std::atomic<int> nFilterCalls{0};
+   auto df = ROOT::RDataFrame(10)
+                .Define("x", [] { return 1; })
+                .Define("w", [&nDefineCalls] { return ++nDefineCalls > 0; })
+                .Filter([&nFilterCalls](bool w) { return ++nFilterCalls > 0 && w; }, {"w"})
+                .Vary("x", [](int x) { return ROOT::RVecI(50, x + 1); }, {"x"}, 50);
+   auto sum = df.Sum<int>("x");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums["nominal"], 10);
+   EXPECT_EQ(sums["x:49"], 20);
+   EXPECT_EQ(nDefineCalls, 10);
+   EXPECT_EQ(nFilterCalls, 10);
+}
+
 TEST_P(RDFVary, JittedAction)
 {
    auto df = ROOT::RDataFrame(10).Define("x", [] { return 1; });
@@ -226,6 +226,52 @@ TEST(RArrowDS, ColumnReadersString)
    }
 }
 
+TEST(RArrowDS, RecordBatchReaderEntryRanges)
+{
+   auto table = createTestTable();
+   auto batchReader = std::make_shared<arrow::TableBatchReader>(*table);
+   batchReader->set_chunksize(2);
+   RArrowDS tds(batchReader, {});
+
+   const auto nSlots = 2U;
+   tds.SetNSlots(nSlots);
+   auto vals = tds.GetColumnReaders<Long64_t>("Age");
+   tds.Initialize();
+
+   // one range per record batch, at most one batch per slot at a time
+   std::vector<Long64_t> refAges = {64, 50, 40, 30, 2, 0};
+   std::vector<std::vector<std::pair<ULong64_t, ULong64_t>>> refRanges = {{{0, 2}, {2, 4}}, {{4, 6}}, {}};
+   for (const auto &refRange : refRanges) {
+      auto ranges = tds.GetEntryRanges();
+      EXPECT_EQ(refRange, ranges);
+      for (auto slot = 0U; slot < ranges.size(); ++slot) {
+         tds.InitSlot(slot, ranges[slot].first);
+         for (auto i : ROOT::TSeq<ULong64_t>(ranges[slot].first, ranges[slot].second)) {
+            tds.SetEntry(slot, i);
+            EXPECT_EQ(refAges[i], **vals[slot]);
+         }
+      }
+   }
+}
+
+TEST(RArrowDS, FromARecordBatchReader)
+{
+   auto table = createTestTable();
+   auto batchReader = std::make_shared<arrow::TableBatchReader>(*table);
+   batchReader->set_chunksize(4);
+   auto rdf = FromArrow(batchReader, {"Height", "Name"});
+   auto max = rdf.Max<double>("Height");
+   auto names = rdf.Take<std::string>("Name");
+
+   EXPECT_DOUBLE_EQ(200.5, *max);
+   std::vector<std::string> refNames = {"Harry", "Bob,Bob", "\"Joe\"", "Tom", " John  ", " Mary Ann "};
+   EXPECT_EQ(refNames, *names);
+
+   // the batches were consumed by the first event loop
+   auto c = rdf.Count();
+   EXPECT_THROW(*c, std::runtime_error);
+}
+
 #ifndef NDEBUG
 
 TEST(RArrowDS, SetNSlotsTwice)
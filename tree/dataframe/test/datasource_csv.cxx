@@ -3,6 +3,9 @@
 #include <ROOT/TSeq.hxx>
 #include <ROOT/TestSupport.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
+
+#include <fstream>
 
 #include <gtest/gtest.h>
 
@@ -326,6 +329,43 @@ TEST(RCsvDS, ProgressiveReadingRDFMT)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ParallelParsingMT)
+{
+   // large enough to span several read blocks and to be parsed by several tasks
+   const auto fileName = "RCsvDS_test_parallel.csv";
+   const ULong64_t nLines = 300000;
+   {
+      std::ofstream f(fileName);
+      f << "n,quarter,name,odd\r\n";
+      for (ULong64_t i = 0; i < nLines; ++i) {
+         f << i << ',' << i << ".25,\"n," << i % 7 << "\"," << (i % 2 ? "true" : "false") << "\r\n";
+         if (i % 1000 == 0)
+            f << "\r\n"; // empty lines are skipped
+      }
+   }
+
+   for (auto chunkSize : {-1LL, 100000LL, 123457LL}) {
+      auto df = ROOT::RDF::FromCSV(fileName, true, ',', chunkSize);
+      auto c = df.Count();
+      auto sumN = df.Sum<Long64_t>("n");
+      auto sumQuarter = df.Sum<double>("quarter");
+      auto nOdd = df.Filter([](bool odd) { return odd; }, {"odd"}).Count();
+      auto nCorrectNames = df.Filter([](Long64_t n, const std::string &name) {
+                                return name == "n," + std::to_string(n % 7);
+                             },
+                             {"n", "name"})
+                              .Count();
+
+      EXPECT_EQ(nLines, *c);
+      EXPECT_EQ(nLines * (nLines - 1) / 2, ULong64_t(*sumN));
+      EXPECT_DOUBLE_EQ(nLines * (nLines - 1) / 2 + 0.25 * nLines, *sumQuarter);
+      EXPECT_EQ(nLines / 2, *nOdd);
+      EXPECT_EQ(nLines, *nCorrectNames);
+   }
+
+   gSystem->Unlink(fileName);
+}
+
 TEST(RCsvDS, SpecifyColumnTypes)
 {
    RCsvDS tds0(fileName0, true, ',', -1LL, {{"Age", 'D'}, {"Name", 'T'}}); // with headers
@@ -5,6 +5,7 @@
 #include "RNonCopiableColumnDS.hxx"
 #include "RStreamingDS.hxx"
 #include "RArraysDS.hxx"
+#include "RRequiredColumnsDS.hxx"
 
 #include "ROOT/TestSupport.hxx"
 #include "gtest/gtest.h"
@@ -90,6 +91,31 @@ TEST(RArraysDS, CacheAndShortSyntaxForCollectionSizes)
    EXPECT_EQ(nvar, std::vector<std::size_t>{1});
 }
 
+TEST(RRequiredColumnsDS, RequiredColumns)
+{
+   auto ds = std::make_unique<RRequiredColumnsDS>();
+   auto *dsPtr = ds.get();
+   ROOT::RDataFrame df(std::move(ds));
+   using ColNames = std::vector<std::string>;
+
+   // "a" is read by the first filter, "b" through a define used by the same filter: both needed for every entry.
+   // "c" is only read by an action downstream of the filter. "d" is not read at all.
+   auto dfB = df.Define("b2", [](int b) { return 2 * b; }, {"b"});
+   auto filtered = dfB.Filter([](int a, int b2) { return a + b2 > 10; }, {"a", "b2"});
+   auto sumC = filtered.Alias("cc", "c").Sum<int>("cc");
+   EXPECT_EQ(*sumC, 4 + 5 + 6 + 7 + 8 + 9);
+   EXPECT_EQ(dsPtr->fRequiredColumns, (ColNames{"a", "b", "c"}));
+   EXPECT_EQ(dsPtr->fEagerColumns, (ColNames{"a", "b"}));
+
+   // an action booked directly on the dataframe makes its columns eager, also for jitted actions
+   auto maxC = df.Max("c");
+   auto sumD = filtered.Sum<int>("d");
+   EXPECT_EQ(*maxC, 9);
+   EXPECT_EQ(dsPtr->fRequiredColumns, (ColNames{"a", "b", "c", "d"}));
+   EXPECT_EQ(dsPtr->fEagerColumns, (ColNames{"a", "b", "c"}));
+   EXPECT_EQ(*sumD, 4 + 5 + 6 + 7 + 8 + 9);
+}
+
 #ifdef R__USE_IMT
 TEST(RStreamingDS, MultipleEntryRangesMT)
 {
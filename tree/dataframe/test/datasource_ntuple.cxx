@@ -12,7 +12,9 @@
 
 #include "ClassWithArrays.h"
 
+#include <algorithm>
 #include <limits>
+#include <stdexcept>
 
 using ROOT::Experimental::RNTupleDS;
 using ROOT::Experimental::RNTupleModel;
@@ -239,6 +241,115 @@ TEST_F(RNTupleDSTest, Chain)
    ChainTest(fNtplName, fFileName);
 }
 
+static void ClusterFilterTest()
+{
+   FileRAII guardFile1("RNTupleDS_test_cluster_filter_1.root");
+   FileRAII guardFile2("RNTupleDS_test_cluster_filter_2.root");
+   FileRAII guardFile3("RNTupleDS_test_cluster_filter_3.root");
+
+   ROOT::Experimental::RNTupleWriteOptions options;
+   options.SetEnableColumnStatistics(true);
+   // Writes 10 clusters of 10 entries each with x = first + 0, 1, ...
+   auto fnWrite = [&](const std::string &path, int first) {
+      auto model = RNTupleModel::Create();
+      auto ptrX = model->MakeField<int>("x");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+      for (int i = 0; i < 100; ++i) {
+         *ptrX = first + i;
+         writer->Fill();
+         if (i % 10 == 9)
+            writer->CommitCluster();
+      }
+   };
+   fnWrite(guardFile1.GetPath(), 0);
+   fnWrite(guardFile2.GetPath(), 1000);
+   fnWrite(guardFile3.GetPath(), 0);
+
+   auto ds = std::make_unique<RNTupleDS>(
+      "ntpl", std::vector<std::string>{guardFile1.GetPath(), guardFile2.GetPath(), guardFile3.GetPath()});
+   EXPECT_THROW(ds->AddClusterFilter("y", 0, 1), std::runtime_error);
+   EXPECT_THROW(ds->AddClusterFilter("x", 1, 0), std::runtime_error);
+   ds->AddClusterFilter("x", 35, 52);
+   ROOT::RDataFrame df(std::move(ds));
+
+   // Clusters 3 to 5 from the first and the last file; the second file is skipped entirely
+   auto nProcessed = df.Count();
+   auto filtered = df.Filter([](int x) { return x >= 35 && x <= 52; }, {"x"});
+   auto nFiltered = filtered.Count();
+   auto entries = filtered.Take<ULong64_t>("rdfentry_");
+   EXPECT_EQ(60u, nProcessed.GetValue());
+   EXPECT_EQ(36u, nFiltered.GetValue());
+   // Entry numbers still refer to the full chain
+   std::vector<ULong64_t> sortedEntries = entries.GetValue();
+   std::sort(sortedEntries.begin(), sortedEntries.end());
+   ASSERT_EQ(36u, sortedEntries.size());
+   EXPECT_EQ(35u, sortedEntries.front());
+   EXPECT_EQ(252u, sortedEntries.back());
+}
+
+TEST(RNTupleDS, ClusterFilter)
+{
+   ClusterFilterTest();
+}
+
+static void SnapshotTest(const std::string &fileName)
+{
+   FileRAII guardFile(fileName);
+
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(1000)
+                .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Define("v", [](int x) { return ROOT::RVecF(x % 3, x); }, {"x"});
+   auto out = df.Snapshot<int, ROOT::RVecF>("ntuple", fileName, {"x", "v"}, opts);
+
+   // the returned dataframe reads the RNTuple that was written
+   EXPECT_EQ(ROOT::Internal::RDF::GetDataSourceLabel(ROOT::RDF::RNode(*out)), "RNTupleDS");
+   EXPECT_EQ(1000u, *out->Count());
+   EXPECT_EQ(499500, *out->Sum<int>("x"));
+   EXPECT_EQ(*df.Define("s", "Sum(v)").Sum<float>("s"), *out->Define("s", "Sum(v)").Sum<float>("s"));
+
+   // jitted Snapshot, with a filter
+   FileRAII guardFile2("filtered_" + fileName);
+   auto out2 = df.Filter("x % 2 == 0").Snapshot("ntuple", guardFile2.GetPath(), {"x"}, opts);
+   EXPECT_EQ(500u, *out2->Count());
+   EXPECT_EQ(249500, *out2->Sum<int>("x"));
+}
+
+TEST(RNTupleDS, Snapshot)
+{
+   SnapshotTest("RNTupleDS_snapshot.root");
+}
+
+TEST(RNTupleDS, LateMaterialization)
+{
+   FileRAII guardFile("RNTupleDS_late_materialization.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrCut = model->MakeField<int>("cut");
+      auto ptrPayload = model->MakeField<std::vector<float>>("payload");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetMaxUnzippedPageSize(256);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", guardFile.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *ptrCut = i;
+         *ptrPayload = std::vector<float>(i % 4, i);
+         ntuple->Fill();
+      }
+   }
+
+   // The payload values are deferred; their size column is read eagerly by the unfiltered Sum
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", guardFile.GetPath());
+   auto sumSizes = df.Sum<std::size_t>("#payload");
+   auto selected = df.Filter([](int cut) { return cut % 100 == 1; }, {"cut"});
+   auto sumPayload = selected.Define("s", [](const ROOT::RVecF &v) { return ROOT::VecOps::Sum(v); }, {"payload"})
+                        .Sum<float>("s");
+   auto count = selected.Count();
+   EXPECT_EQ(1500u, *sumSizes);
+   EXPECT_EQ(10u, *count);
+   EXPECT_FLOAT_EQ(4510.f, *sumPayload);
+}
+
 #ifdef R__USE_IMT
 struct IMTRAII {
    IMTRAII() { ROOT::EnableImplicitMT(); }
@@ -300,6 +411,20 @@ TEST_F(RNTupleDSTest, ChainTailScheduling)
    auto sumX = df.Aggregate([](int &acc, int x) { acc += x; }, [](int a, int b) { return a + b; }, "x");
    EXPECT_EQ(56, sumX.GetValue());
 }
+
+TEST(RNTupleDS, ClusterFilterMT)
+{
+   IMTRAII _;
+
+   ClusterFilterTest();
+}
+
+TEST(RNTupleDS, SnapshotMT)
+{
+   IMTRAII _;
+
+   SnapshotTest("RNTupleDS_snapshot_mt.root");
+}
 #endif
 
 const static std::array<ROOT::RVec<std::array<ROOT::RVecI, 3>>, 3> arraysDatasetCol4El{
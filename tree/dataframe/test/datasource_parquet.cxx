@@ -0,0 +1,117 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RParquetDS.hxx>
+#include <TROOT.h>
+#include <TSystem.h>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/memory_pool.h>
+#include <arrow/table.h>
+#include <parquet/arrow/writer.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using ROOT::RDF::FromParquet;
+
+namespace {
+
+// Ten row groups of 100 rows each: "x" counts the rows, "y" is 2x, "name" is the row group index as a string
+void WriteTestFile(const std::string &fileName)
+{
+   arrow::Int64Builder xBuilder;
+   arrow::DoubleBuilder yBuilder;
+   arrow::StringBuilder nameBuilder;
+   for (int i = 0; i < 1000; ++i) {
+      ASSERT_TRUE(xBuilder.Append(i).ok());
+      ASSERT_TRUE(yBuilder.Append(2. * i).ok());
+      ASSERT_TRUE(nameBuilder.Append(std::to_string(i / 100)).ok());
+   }
+   std::shared_ptr<arrow::Array> x, y, name;
+   ASSERT_TRUE(xBuilder.Finish(&x).ok());
+   ASSERT_TRUE(yBuilder.Finish(&y).ok());
+   ASSERT_TRUE(nameBuilder.Finish(&name).ok());
+   auto schema = arrow::schema(
+      {arrow::field("x", arrow::int64()), arrow::field("y", arrow::float64()), arrow::field("name", arrow::utf8())});
+   auto table = arrow::Table::Make(schema, {x, y, name});
+
+   auto output = arrow::io::FileOutputStream::Open(fileName);
+   ASSERT_TRUE(output.ok());
+   ASSERT_TRUE(parquet::arrow::WriteTable(*table, arrow::default_memory_pool(), *output, 100).ok());
+   ASSERT_TRUE((*output)->Close().ok());
+}
+
+class RParquetDSTest : public ::testing::Test {
+protected:
+   const std::string fFileName = "RParquetDS_test.parquet";
+   void SetUp() override { WriteTestFile(fFileName); }
+   void TearDown() override { gSystem->Unlink(fFileName.c_str()); }
+};
+
+} // anonymous namespace
+
+TEST_F(RParquetDSTest, ReadAllColumns)
+{
+   auto df = FromParquet(fFileName);
+   auto colNames = df.GetColumnNames();
+   std::sort(colNames.begin(), colNames.end());
+   EXPECT_EQ(colNames, std::vector<std::string>({"name", "x", "y"}));
+
+   auto sumX = df.Sum<Long64_t>("x");
+   auto maxY = df.Max<double>("y");
+   auto names = df.Take<std::string>("name");
+   EXPECT_EQ(*sumX, 999 * 1000 / 2);
+   EXPECT_DOUBLE_EQ(*maxY, 1998.);
+   EXPECT_EQ(names->front(), "0");
+   EXPECT_EQ(names->back(), "9");
+}
+
+TEST_F(RParquetDSTest, ColumnPruning)
+{
+   auto df = FromParquet(fFileName, {"y"});
+   EXPECT_EQ(df.GetColumnNames(), std::vector<std::string>({"y"}));
+   EXPECT_EQ(*df.Count(), 1000ull);
+
+   EXPECT_THROW(FromParquet(fFileName, {"z"}), std::runtime_error);
+}
+
+TEST_F(RParquetDSTest, RowGroupStatistics)
+{
+   // only the row groups with rows 200-299 and 300-399 have values in the range
+   auto df = FromParquet(fFileName, {"x", "name"}, {{"x", 250., 320.}});
+   auto xs = df.Filter([](Long64_t x) { return x >= 250 && x <= 320; }, {"x"}).Take<Long64_t>("x");
+   auto names = df.Take<std::string>("name");
+   auto nEntries = df.Count();
+
+   EXPECT_EQ(*nEntries, 200ull);
+   std::vector<Long64_t> refXs(71);
+   std::iota(refXs.begin(), refXs.end(), 250);
+   EXPECT_EQ(*xs, refXs);
+   EXPECT_EQ(std::count(names->begin(), names->end(), "2"), 100);
+   EXPECT_EQ(std::count(names->begin(), names->end(), "3"), 100);
+}
+
+#ifdef R__USE_IMT
+TEST_F(RParquetDSTest, RowGroupsMT)
+{
+   ROOT::EnableImplicitMT(4);
+   auto df = FromParquet(fFileName, {"x"});
+   auto sumX = df.Sum<Long64_t>("x");
+   auto nEntries = df.Count();
+   EXPECT_EQ(*sumX, 999 * 1000 / 2);
+   EXPECT_EQ(*nEntries, 1000ull);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -124,17 +124,18 @@ TEST(RSqliteDS, ColumnReaders)
 {
    RSqliteDS rds(fileName0, query0);
    const auto nSlots = 2U;
-   ROOT_EXPECT_WARNING(rds.SetNSlots(nSlots), "SetNSlots",
-                       "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                       "Consider turning off IMT.");
+   rds.SetNSlots(nSlots);
    auto vals = rds.GetColumnReaders<Long64_t>("fint");
    rds.Initialize();
+   // The two rows are read in one batch and split between the slots
    auto ranges = rds.GetEntryRanges();
-   EXPECT_EQ(1U, ranges.size());
+   ASSERT_EQ(2U, ranges.size());
+   for (auto i : ROOT::TSeq<unsigned>(0, nSlots)) {
+      EXPECT_TRUE(rds.SetEntry(i, ranges[i].first));
+   }
    for (auto i : ROOT::TSeq<unsigned>(0, nSlots)) {
-      EXPECT_TRUE(rds.SetEntry(i, ranges[0].first));
       auto val = **vals[i];
-      EXPECT_EQ(1, val);
+      EXPECT_EQ(Long64_t(i + 1), val);
    }
 
    EXPECT_THROW(rds.GetColumnReaders<double>("fint"), std::runtime_error);
@@ -147,10 +148,6 @@ TEST(RSqliteDS, GetEntryRanges)
    auto ranges = rds.GetEntryRanges();
    ASSERT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
-   EXPECT_EQ(1U, ranges[0].second);
-   ranges = rds.GetEntryRanges();
-   ASSERT_EQ(1U, ranges.size());
-   EXPECT_EQ(1U, ranges[0].first);
    EXPECT_EQ(2U, ranges[0].second);
    ranges = rds.GetEntryRanges();
    EXPECT_EQ(0U, ranges.size());
@@ -160,7 +157,17 @@ TEST(RSqliteDS, GetEntryRanges)
    ranges = rds.GetEntryRanges();
    EXPECT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(2U, ranges[0].second);
+
+   // One range per slot
+   rds.SetNSlots(3);
+   rds.Initialize();
+   ranges = rds.GetEntryRanges();
+   ASSERT_EQ(2U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
    EXPECT_EQ(1U, ranges[0].second);
+   EXPECT_EQ(1U, ranges[1].first);
+   EXPECT_EQ(2U, ranges[1].second);
 }
 
 TEST(RSqliteDS, SetEntry)
@@ -184,7 +191,6 @@ TEST(RSqliteDS, SetEntry)
    EXPECT_EQ('1', (**vblob[0])[0]);
    EXPECT_EQ(nullptr, **vnull[0]);
 
-   rds.GetEntryRanges();
    EXPECT_TRUE(rds.SetEntry(0, 1));
    EXPECT_EQ(2, **vint[0]);
    EXPECT_NEAR(2.0, **vreal[0], epsilon);
@@ -202,7 +208,6 @@ TEST(RSqliteDS, IMT)
    const auto nSlots = 4U;
    ROOT::EnableImplicitMT(nSlots);
 
-   ROOT::TestSupport::CheckDiagsRAII diagRAII{kWarning, "SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. Consider turning off IMT."};
    auto rdf = ROOT::RDF::FromSqlite(fileName0, query0);
    EXPECT_EQ(3, *rdf.Sum("fint"));
    EXPECT_NEAR(3.0, *rdf.Sum("freal"), epsilon);
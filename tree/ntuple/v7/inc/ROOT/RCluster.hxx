@@ -18,6 +18,7 @@
 
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
@@ -140,6 +141,37 @@ public:
    ~ROnDiskPageMapHeap() override;
 }; // class ROnDiskPageMapHeap
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::ROnDiskPageMapHugePages
+\ingroup NTuple
+\brief An ROnDiskPageMap whose fMemory is an anonymous memory mapping backed by transparent huge pages
+
+Reduces the TLB pressure of large cluster buffers. The physical memory is only allocated on first touch, i.e. when
+the data is read from storage, and is thus placed on the NUMA node of the reading thread. On platforms without
+support for transparent huge pages, the memory is allocated on the heap.
+*/
+// clang-format on
+class ROnDiskPageMapHugePages : public ROnDiskPageMap {
+private:
+   /// The memory region containing the on-disk pages.
+   unsigned char *fMemory = nullptr;
+   /// The size of the memory mapping, a multiple of the huge page size; zero if fMemory is allocated on the heap
+   std::size_t fMappedSize = 0;
+
+public:
+   /// Buffers smaller than this size are not worth to be backed by huge pages
+   static constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+
+   /// Allocates a (zero-initialized) memory region of at least `size` bytes
+   explicit ROnDiskPageMapHugePages(std::size_t size);
+   ROnDiskPageMapHugePages(const ROnDiskPageMapHugePages &other) = delete;
+   ROnDiskPageMapHugePages &operator=(const ROnDiskPageMapHugePages &other) = delete;
+   ~ROnDiskPageMapHugePages() override;
+
+   unsigned char *GetMemory() const { return fMemory; }
+}; // class ROnDiskPageMapHugePages
+
 // clang-format off
 /**
 \class ROOT::Experimental::Internal::RCluster
@@ -150,6 +182,8 @@ Binds together several page maps that represent all the pages of certain columns
 */
 // clang-format on
 class RCluster {
+   friend class ROnDiskPageMapShared;
+
 public:
    using ColumnSet_t = std::unordered_set<DescriptorId_t>;
    /// The identifiers that specifies the content of a (partial) cluster
@@ -196,8 +230,32 @@ public:
    const ColumnSet_t &GetAvailPhysicalColumns() const { return fAvailPhysicalColumns; }
    bool ContainsColumn(DescriptorId_t colId) const { return fAvailPhysicalColumns.count(colId) > 0; }
    size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   /// The sum of the packed and compressed sizes of the on-disk pages
+   std::size_t GetNBytesOnDiskPages() const;
 }; // class RCluster
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::ROnDiskPageMapShared
+\ingroup NTuple
+\brief An ROnDiskPageMap that references the on-disk pages of a cluster owned by someone else
+
+Used to hand out clusters of the shared cluster cache. The referenced cluster stays alive as long as the page map
+exists, even if it gets evicted from the cache in the meantime.
+*/
+// clang-format on
+class ROnDiskPageMapShared : public ROnDiskPageMap {
+private:
+   std::shared_ptr<const RCluster> fCluster;
+
+public:
+   /// Registers all the on-disk pages of `cluster`
+   explicit ROnDiskPageMapShared(std::shared_ptr<const RCluster> cluster);
+   ROnDiskPageMapShared(const ROnDiskPageMapShared &other) = delete;
+   ROnDiskPageMapShared &operator=(const ROnDiskPageMapShared &other) = delete;
+   ~ROnDiskPageMapShared() override;
+}; // class ROnDiskPageMapShared
+
 } // namespace Internal
 } // namespace Experimental
 } // namespace ROOT
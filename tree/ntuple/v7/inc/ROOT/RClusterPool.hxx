@@ -18,12 +18,17 @@
 
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
+#include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <future>
+#include <string>
 #include <thread>
 #include <set>
 #include <vector>
@@ -34,6 +39,90 @@ namespace Experimental {
 namespace Internal {
 class RPageSource;
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RSharedClusterCache
+\ingroup NTuple
+\brief Process-wide cache of the packed and compressed pages of clusters, shared by all cluster pools
+
+Cluster pools of page sources that opt in (see RNTupleReadOptions::SetUseSharedClusterCache()) look up clusters
+in the shared cache before reading them from storage and put the clusters they read into the cache. Thus, several
+readers of the same ntuple in one process read every cluster only once. Clusters are identified by the storage
+location of the ntuple (see RPageSource::GetStorageId()), the ntuple name, the cluster id, and the set of physical
+columns. A lookup succeeds if a cached cluster contains at least the requested columns.
+
+The cache hands out clusters that reference the cached on-disk pages (see ROnDiskPageMapShared). If the total size
+of the cached on-disk pages exceeds the memory budget, the least recently used clusters are evicted. The memory of an
+evicted cluster is released once the last cluster pool that uses it drops its reference. Decompression is not shared:
+the unzipped pages are still owned by the page pool of every page source.
+*/
+// clang-format on
+class RSharedClusterCache {
+private:
+   /// Identifies a cluster independent of the column set
+   struct RLookupKey {
+      std::string fStorageId;
+      std::string fNTupleName;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+
+      bool operator<(const RLookupKey &other) const
+      {
+         if (fClusterId != other.fClusterId)
+            return fClusterId < other.fClusterId;
+         if (fNTupleName != other.fNTupleName)
+            return fNTupleName < other.fNTupleName;
+         return fStorageId < other.fStorageId;
+      }
+   };
+
+   struct REntry {
+      RLookupKey fLookupKey;
+      std::shared_ptr<const RCluster> fCluster;
+      std::size_t fNBytes = 0;
+   };
+
+   /// Protects all the members
+   std::mutex fLock;
+   /// Most recently used clusters first
+   std::list<REntry> fEntries;
+   /// Several entries of the same cluster with different column sets can be present
+   std::multimap<RLookupKey, std::list<REntry>::iterator> fIndex;
+   std::size_t fMemoryBudget = kDefaultMemoryBudget;
+   std::size_t fMemoryUsage = 0;
+
+   RSharedClusterCache() = default;
+   /// Needs to be called with fLock held
+   void EvictUntil(std::size_t memoryBudget);
+   /// Creates a cluster for a cluster pool that references the pages of the cached cluster
+   static std::unique_ptr<RCluster> CreateView(std::shared_ptr<const RCluster> cluster);
+
+public:
+   static constexpr std::size_t kDefaultMemoryBudget = 512 * 1024 * 1024;
+
+   RSharedClusterCache(const RSharedClusterCache &other) = delete;
+   RSharedClusterCache &operator=(const RSharedClusterCache &other) = delete;
+   ~RSharedClusterCache() = default;
+
+   static RSharedClusterCache &Instance();
+
+   /// Returns a cluster that contains at least the columns in `clusterKey` or nullptr if there is no such cluster
+   /// in the cache
+   std::unique_ptr<RCluster>
+   Get(const std::string &storageId, const std::string &ntupleName, const RCluster::RKey &clusterKey);
+   /// Takes ownership of a cluster freshly loaded from storage and returns a cluster with the same pages for the
+   /// caller. Clusters that are larger than the memory budget are passed through unchanged.
+   std::unique_ptr<RCluster>
+   Put(const std::string &storageId, const std::string &ntupleName, std::unique_ptr<RCluster> cluster);
+
+   /// Evicts clusters as necessary to respect the new budget
+   void SetMemoryBudget(std::size_t memoryBudget);
+   std::size_t GetMemoryBudget();
+   /// The total size of the on-disk pages of the cached clusters
+   std::size_t GetMemoryUsage();
+   /// Evicts all clusters
+   void Clear();
+}; // class RSharedClusterCache
+
 // clang-format off
 /**
 \class ROOT::Experimental::Internal::RClusterPool
@@ -46,6 +135,12 @@ and pushes them into the page pool. The actual logic of reading and unzipping is
 The cluster pool only orchestrates the work queues for reading and unzipping. It uses one extra I/O thread for
 reading waits for data from storage and generates no CPU load.
 
+By default, every bunch of clusters is read by a separate vector read. If more than one bunch is allowed in flight,
+the look-ahead window is widened accordingly and the I/O thread merges all the bunches waiting in its work queue
+into a single call to RPageSource::LoadClusters(). For storage backed by io_uring, this keeps many more read requests
+in flight in a single ring. Clusters are handed back to the main thread (and thus queued for unzipping) as soon
+as the merged read returns.
+
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threading
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
@@ -84,10 +179,11 @@ private:
    /// (GetCluster()) and is used for implementing the I/O and cluster memory allocation (PageSource::LoadClusters()).
    RPageSource &fPageSource;
    /// The number of clusters before the currently active cluster that should stay in the pool if present
-   /// Reserved for later use.
    unsigned int fWindowPre = 0;
    /// The number of clusters that are being read in a single vector read.
    unsigned int fClusterBunchSize;
+   /// The maximum number of cluster bunches that the I/O thread merges into a single RPageSource::LoadClusters() call
+   unsigned int fMaxBunchesInFlight;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -115,6 +211,9 @@ private:
    size_t FindFreeSlot() const;
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecReadClusters();
+   /// Called by the I/O thread; serves the clusters from the shared cluster cache if the page source opted in for it
+   /// and loads the missing ones from the page source
+   std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys);
    /// Returns the given cluster from the pool, which needs to contain at least the columns `physicalColumns`.
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
@@ -122,7 +221,11 @@ private:
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
-   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   static constexpr unsigned int kDefaultMaxBunchesInFlight = 1;
+   /// If `windowPre` is larger than zero, the given number of clusters before the requested cluster stays valid
+   /// in GetCluster(), too, provided that the clusters are requested in order.
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                unsigned int maxBunchesInFlight = kDefaultMaxBunchesInFlight, unsigned int windowPre = 0);
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
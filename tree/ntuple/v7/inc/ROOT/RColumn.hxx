@@ -52,7 +52,7 @@ private:
    /// The page into which new elements are being written. The page will initially be small
    /// (just enough to hold RNTupleWriteOptions::fInitialNElementsPerPage elements) and expand as needed and
    /// as memory for page buffers is still available (RNTupleWriteOptions::fPageBufferBudget) or the maximum page
-   /// size is reached (RNTupleWriteOptions::fMaxUnzippedPageSize).
+   /// size is reached (RNTupleWriteOptions::fMaxUnzippedPageSize, see also RPageSink::GetMaxWritePageSize()).
    RPage fWritePage;
    /// The number of elements written resp. available in the column
    NTupleSize_t fNElements = 0;
@@ -78,12 +78,14 @@ private:
    /// to the minimal size.
    void HandleWritePageIfFull()
    {
+      const auto maxPageSize = fPageSink->GetMaxWritePageSize(fHandleSink);
       auto newMaxElements = fWritePage.GetMaxElements() * 2;
-      if (newMaxElements * fElement->GetSize() > fPageSink->GetWriteOptions().GetMaxUnzippedPageSize()) {
-         newMaxElements = fPageSink->GetWriteOptions().GetMaxUnzippedPageSize() / fElement->GetSize();
+      if (newMaxElements * fElement->GetSize() > maxPageSize) {
+         newMaxElements = maxPageSize / fElement->GetSize();
       }
 
-      if (newMaxElements == fWritePage.GetMaxElements()) {
+      // With adaptive page sizes, the maximum page size may have shrunk below the current page size
+      if (newMaxElements <= fWritePage.GetMaxElements()) {
          // Maximum page size reached, flush and reset
          Flush();
       } else {
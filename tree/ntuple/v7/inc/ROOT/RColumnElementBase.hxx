@@ -109,6 +109,14 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Computes the smallest and the largest of `count` in-memory values, converted to double. Only column elements
+   /// whose on-disk representation preserves the numeric value of the in-memory type support statistics; all others
+   /// return std::nullopt. The returned bounds are conservative, i.e. they always enclose all (non-NaN) values.
+   virtual std::optional<std::pair<double, double>> GetMinMax(const void * /* values */, std::size_t /* count */) const
+   {
+      return std::nullopt;
+   }
+
    std::size_t GetSize() const { return fSize; }
    std::size_t GetBitsOnStorage() const { return fBitsOnStorage; }
    std::optional<std::pair<double, double>> GetValueRange() const { return fValueRange; }
@@ -318,10 +318,56 @@ class RField<T, typename std::enable_if<std::is_integral_v<T>>::type> final
    static_assert(std::is_signed_v<T> == std::is_signed_v<MappedType>, "invalid signedness of mapped type");
    using BaseType = RIntegralField<MappedType>;
 
+   // Parameters of the frame-of-reference encoding, see SetFrameOfReference()
+   std::size_t fBitWidth = 1;
+   double fValueMin = 0;
+   double fValueMax = 0;
+   bool fHasFrameOfReference = false;
+
 protected:
    std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const final
    {
-      return std::make_unique<RField>(newName);
+      auto cloned = std::make_unique<RField>(newName);
+      cloned->fHasFrameOfReference = fHasFrameOfReference;
+      cloned->fBitWidth = fBitWidth;
+      cloned->fValueMin = fValueMin;
+      cloned->fValueMax = fValueMax;
+      return cloned;
+   }
+
+   void GenerateColumns() final
+   {
+      BaseType::GenerateColumns();
+      for (auto &column : this->fAvailableColumns) {
+         if (column->GetType() == EColumnType::kIntFOR) {
+            // Without a range, every value but 0 would be out of range: the IntFOR representation can only be
+            // chosen through SetFrameOfReference()
+            if (!fHasFrameOfReference) {
+               throw RException(R__FAIL("frame-of-reference column of field " + this->GetFieldName() +
+                                        " requires SetFrameOfReference()"));
+            }
+            column->SetBitsOnStorage(fBitWidth);
+            column->SetValueRange(fValueMin, fValueMax);
+         }
+      }
+   }
+
+   void GenerateColumns(const RNTupleDescriptor &desc) final
+   {
+      BaseType::GenerateColumns(desc);
+      for (auto &column : this->fAvailableColumns) {
+         if (column->GetType() != EColumnType::kIntFOR)
+            continue;
+         const auto &fdesc = desc.GetFieldDescriptor(this->GetOnDiskId());
+         const auto &coldesc = desc.GetColumnDescriptor(fdesc.GetLogicalColumnIds()[column->GetRepresentationIndex()]);
+         if (!coldesc.GetValueRange().has_value()) {
+            throw RException(R__FAIL("missing value range of frame-of-reference column of field " +
+                                     this->GetFieldName()));
+         }
+         const auto [valMin, valMax] = *coldesc.GetValueRange();
+         column->SetBitsOnStorage(coldesc.GetBitsOnStorage());
+         column->SetValueRange(valMin, valMax);
+      }
    }
 
 public:
@@ -330,6 +376,38 @@ public:
    RField &operator=(RField &&other) = default;
    ~RField() override = default;
 
+   /// Sets this field to use frame-of-reference bit-packing: values are stored as the difference to `minValue`,
+   /// using as many bits as needed to represent `maxValue - minValue`, which must fit into 32 bits.
+   /// This call promises that this field will only contain values contained in `[minValue, maxValue]` inclusive.
+   /// Writing a value outside this range throws an exception.
+   void SetFrameOfReference(T minValue, T maxValue)
+   {
+      if (minValue > maxValue) {
+         throw RException(R__FAIL("SetFrameOfReference() requires minValue <= maxValue"));
+      }
+      if constexpr (sizeof(T) == 8) {
+         // The value range is stored as a pair of doubles, which exactly represent integers up to 2^53
+         constexpr T kMaxExact = T(1) << 53;
+         if (maxValue > kMaxExact || (std::is_signed_v<T> && minValue < -kMaxExact)) {
+            throw RException(R__FAIL("SetFrameOfReference() range bounds must be within [-2^53, 2^53]"));
+         }
+      }
+      const auto range = static_cast<std::uint64_t>(maxValue) - static_cast<std::uint64_t>(minValue);
+      const auto &[minBits, maxBits] = Internal::RColumnElementBase::GetValidBitRange(EColumnType::kIntFOR);
+      std::size_t nBits = minBits;
+      while (nBits < 64 && (range >> nBits) != 0)
+         ++nBits;
+      if (nBits > maxBits) {
+         throw RException(R__FAIL("SetFrameOfReference() range needs " + std::to_string(nBits) +
+                                  " bits, more than the maximum of " + std::to_string(maxBits)));
+      }
+      this->SetColumnRepresentatives({{EColumnType::kIntFOR}});
+      fHasFrameOfReference = true;
+      fBitWidth = nBits;
+      fValueMin = static_cast<double>(minValue);
+      fValueMax = static_cast<double>(maxValue);
+   }
+
    T *Map(NTupleSize_t globalIndex) { return reinterpret_cast<T *>(this->BaseType::Map(globalIndex)); }
    T *Map(RClusterIndex clusterIndex) { return reinterpret_cast<T *>(this->BaseType::Map(clusterIndex)); }
    T *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems)
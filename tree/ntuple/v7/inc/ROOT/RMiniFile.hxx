@@ -26,6 +26,7 @@
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <utility>
 
 class TCollection;
 class TFile;
@@ -140,6 +141,9 @@ private:
       std::uint64_t fKeyOffset = 0;
       /// Keeps track of TFile control structures, which need to be updated on committing the data set
       std::unique_ptr<ROOT::Experimental::Internal::RTFileControlBlock> fControlBlock;
+      /// Background I/O thread that writes full blocks, see RNTupleWriteOptions::SetUseWriteBehind()
+      struct RWriteBehind;
+      std::unique_ptr<RWriteBehind> fWriteBehind;
 
       RFileSimple();
       RFileSimple(const RFileSimple &other) = delete;
@@ -149,6 +153,8 @@ private:
       ~RFileSimple();
 
       void AllocateBuffers(std::size_t bufferSize);
+      /// Hand full blocks over to a background thread; at most `maxQueuedBytes` (but at least one block) are queued
+      void StartWriteBehind(std::size_t maxQueuedBytes);
       void Flush();
 
       /// Writes bytes in the open stream, either at fFilePos or at the given offset
@@ -226,6 +232,21 @@ public:
    /// Write into a reserved record; the caller is responsible for making sure that the written byte range is in the
    /// previously reserved key.
    void WriteIntoReservedBlob(const void *buffer, size_t nbytes, std::int64_t offset);
+
+   /// The part of a reserved blob that does not share a block of the write buffer with any other data in the file
+   struct RUnbufferedRange {
+      std::uint64_t fOffset = 0; ///< Absolute file offset, aligned to the write buffer size
+      std::size_t fSize = 0;     ///< A multiple of the write buffer size; zero if there is no such range
+   };
+   /// Reserves a new record like ReserveBlob() and additionally returns the largest possible byte range of the record
+   /// that must be written by WriteUnbuffered(). The other bytes of the record must be written by
+   /// WriteIntoReservedBlob(), in increasing file order and before any other subsequent write into the file.
+   /// Only local files written with a C file stream support unbuffered writes; for others, the range is empty.
+   std::pair<std::uint64_t, RUnbufferedRange> ReserveBlobWithUnbufferedRange(size_t nbytes, size_t len);
+   /// Positional write that bypasses the write buffer. Calls are thread-safe, also against concurrent use of the
+   /// other write methods, given that the byte range was returned by ReserveBlobWithUnbufferedRange().
+   /// With Direct I/O, the buffer must be aligned to RFileSimple::kBlockAlign.
+   void WriteUnbuffered(const void *buffer, size_t nbytes, std::uint64_t offset) const;
    /// Ensures that the streamer info records passed as argument are written to the file
    void UpdateStreamerInfos(const RNTupleSerializer::StreamerInfoMap_t &streamerInfos);
    /// Writes the RNTuple key to the file so that the header and footer keys can be found
@@ -39,6 +39,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -244,15 +245,17 @@ public:
       /// Their element index range, however, is aligned with the corresponding column of the
       /// primary column representation (see Section "Suppressed Columns" in the specification)
       bool fIsSuppressed = false;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// Optional summary statistics: the smallest and the largest value of the column elements in this cluster,
+      /// converted to double. Only recorded for numeric columns if enabled in the write options
+      /// (see RNTupleWriteOptions::SetEnableColumnStatistics()). The bounds are conservative, i.e. they are
+      /// guaranteed to enclose all values of the column range but they may not be tight for 64bit integers.
+      std::optional<std::pair<double, double>> fMinMax{};
 
       bool operator==(const RColumnRange &other) const
       {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
                 fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
-                fIsSuppressed == other.fIsSuppressed;
+                fIsSuppressed == other.fIsSuppressed && fMinMax == other.fMinMax;
       }
 
       bool Contains(NTupleSize_t index) const
@@ -1226,6 +1229,9 @@ public:
    RResult<void> CommitColumnRange(DescriptorId_t physicalId, std::uint64_t firstElementIndex,
                                    std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange);
 
+   /// Attaches min/max statistics to a column range previously added by CommitColumnRange()
+   RResult<void> SetColumnRangeMinMax(DescriptorId_t physicalId, double min, double max);
+
    /// Books the given column ID as being suppressed in this cluster. The correct first element index and number of
    /// elements need to be set by CommitSuppressedColumnRanges() once all the calls to CommitColumnRange() and
    /// MarkSuppressedColumnRange() took place.
@@ -20,9 +20,12 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+class TFile;
+
 namespace ROOT {
 namespace Experimental {
 namespace Internal {
@@ -31,6 +34,12 @@ namespace Internal {
 \class ROOT::Experimental::Internal::RNTupleIndex
 \ingroup NTuple
 \brief Builds an index on one or several fields of an RNTuple so it can be joined onto other RNTuples.
+
+A built index can be persisted with RNTupleIndex::Write() next to the indexed RNTuple. The persistent index is a
+separate RNTuple with one entry per distinct index value, sorted by the index values. Every index field is stored in
+its own column, followed by the collection of matching entry numbers. An index opened with RNTupleIndex::Open() does
+not need to be rebuilt: lookups binary-search the key columns through the page source, so that only the pages
+touched by the search are read and unpacked.
 */
 // clang-format on
 class RNTupleIndex {
@@ -66,16 +75,34 @@ private:
       }
    };
 
+   using IndexMap_t = std::unordered_map<RIndexValue, std::vector<NTupleSize_t>, RIndexValueHash>;
+
    /// The index itself. Maps field values (or combinations thereof in case the index is defined for multiple fields) to
    /// their respsective entry numbers.
-   std::unordered_map<RIndexValue, std::vector<NTupleSize_t>, RIndexValueHash> fIndex;
+   IndexMap_t fIndex;
 
    /// The page source belonging to the RNTuple for which to build the index.
    std::unique_ptr<RPageSource> fPageSource;
 
+   /// The (fully qualified) names of the indexed fields, as given on construction
+   std::vector<std::string> fIndexFieldNames;
+
    /// The fields for which the index is built. Used to compute the hashes for each entry value.
    std::vector<std::unique_ptr<RFieldBase>> fIndexFields;
 
+   /// If the index is read from its persistent representation, the page source of the sorted index RNTuple.
+   std::unique_ptr<RPageSource> fPersistentSource;
+   /// The key fields of the persistent index, one per indexed field
+   std::vector<std::unique_ptr<RFieldBase>> fPersistentKeyFields;
+   /// The collection field of the persistent index holding the entry numbers for every key
+   std::unique_ptr<RFieldBase> fPersistentEntriesField;
+   /// Values used to read the persistent index; mutable because lookups are const operations
+   mutable std::vector<RFieldBase::RValue> fPersistentKeyValues;
+   mutable std::unique_ptr<RFieldBase::RValue> fPersistentEntriesValue;
+   /// Entry numbers read from the persistent index are memoized, such that the pointers handed out by
+   /// GetAllEntryNumbers() stay valid for the lifetime of the index
+   mutable IndexMap_t fPersistentLookups;
+
    /// Only built indexes can be queried.
    bool fIsBuilt = false;
 
@@ -93,6 +120,22 @@ private:
    /// \throws RException If the index has not been built, and can therefore not be used yet.
    void EnsureBuilt() const;
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the fields for the given field names and connect them to the given (attached) page source.
+   static std::vector<std::unique_ptr<RFieldBase>>
+   CreateIndexFields(const std::vector<std::string> &fieldNames, RPageSource &pageSource);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Add the index values of the entries in the range [`firstEntry`, `lastEntry`) to `index`.
+   static void FillIndex(std::vector<std::unique_ptr<RFieldBase>> &fields, NTupleSize_t firstEntry,
+                         NTupleSize_t lastEntry, IndexMap_t &index);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Look up the given index value in the persistent, sorted index by means of binary search.
+   ///
+   /// \return The memoized entry numbers or `nullptr` if the index value is not present.
+   const std::vector<NTupleSize_t> *LookupPersistent(const RIndexValue &indexValue) const;
+
 public:
    RNTupleIndex(const RNTupleIndex &other) = delete;
    RNTupleIndex &operator=(const RNTupleIndex &other) = delete;
@@ -113,10 +156,37 @@ public:
    static std::unique_ptr<RNTupleIndex>
    Create(const std::vector<std::string> &fieldNames, const RPageSource &pageSource, bool deferBuild = false);
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Open a previously persisted index instead of building it.
+   ///
+   /// \param[in] fieldNames The names of the indexed fields, in the same order as when the index was written.
+   /// \param[in] pageSource The page source of the indexed RNTuple.
+   /// \param[in] storage The storage location (e.g., the file name) that contains the persistent index.
+   ///
+   /// \return A pointer to the opened index, which is in the built state.
+   ///
+   /// \throws RException If the persistent index does not exist or does not match the given index fields.
+   static std::unique_ptr<RNTupleIndex>
+   Open(const std::vector<std::string> &fieldNames, const RPageSource &pageSource, std::string_view storage);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief The name of the RNTuple that holds the persistent index of `ntupleName` over `fieldNames`.
+   static std::string GetPersistentName(std::string_view ntupleName, const std::vector<std::string> &fieldNames);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Write the index in its sorted, columnar form as a separate RNTuple into the given file.
+   ///
+   /// The RNTuple's name is given by RNTupleIndex::GetPersistentName(). The index must have been built.
+   void Write(TFile &file) const;
+
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Build the index.
    ///
    /// Only a built index can be queried (with RNTupleIndex::GetFirstEntryNumber or RNTupleIndex::GetAllEntryNumbers).
+   ///
+   /// If implicit multi-threading is enabled, the entries are split in cluster-aligned ranges that are indexed in
+   /// parallel, each with its own clone of the page source. The partial indexes are merged at the end, preserving the
+   /// order of the entry numbers for every index value.
    void Build();
 
    /////////////////////////////////////////////////////////////////////////////
@@ -129,6 +199,8 @@ public:
    std::size_t GetSize() const
    {
       EnsureBuilt();
+      if (fPersistentSource)
+         return fPersistentSource->GetNEntries();
       return fIndex.size();
    }
 
@@ -174,8 +246,10 @@ public:
    ///
    /// \param[in] valuePtrs A vector of pointers to the index values to look up.
    ///
-   /// \return The entry numbers that corresponds to `valuePtrs`. When no such entry exists, an empty vector is
+   /// \return The entry numbers that corresponds to `valuePtrs`. When no such entry exists, `nullptr` is
    /// returned.
+   ///
+   /// \note Lookups into an index opened with RNTupleIndex::Open() read from storage and are not thread-safe.
    const std::vector<NTupleSize_t> *GetAllEntryNumbers(const std::vector<void *> &valuePtrs) const;
 
    /////////////////////////////////////////////////////////////////////////////
@@ -20,7 +20,6 @@
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
-#include <ROOT/TTaskGroup.hxx>
 #include <Compression.h>
 
 #include <memory>
@@ -66,6 +65,9 @@ struct RNTupleMergeOptions {
    ENTupleMergeErrBehavior fErrBehavior = ENTupleMergeErrBehavior::kAbort;
    /// If true, the merger will emit further diagnostics and information.
    bool fExtraVerbose = false;
+   /// With implicit multi-threading, the pages of up to this many clusters are recompressed concurrently.
+   /// Clusters are still committed in their original order. Larger values increase the memory used by the merger.
+   unsigned int fMaxClustersInFlight = 4;
 };
 
 // clang-format off
@@ -78,7 +80,8 @@ struct RNTupleMergeOptions {
 // clang-format on
 class RNTupleMerger final {
    std::unique_ptr<RPageAllocator> fPageAlloc;
-   std::optional<TTaskGroup> fTaskGroup;
+   /// Whether to recompress pages on the implicit multi-threading pool
+   bool fUseIMT = false;
 
    void MergeCommonColumns(RClusterPool &clusterPool, DescriptorId_t clusterId, std::span<RColumnInfo> commonColumns,
                            RCluster::ColumnSet_t commonColumnSet, RSealedPageMergeData &sealedPageData,
@@ -23,13 +23,16 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <ctime> // for CPU time measurement with clock()
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -293,6 +296,8 @@ private:
    bool fIsEnabled = false;
 
    bool Contains(const std::string &name) const;
+   /// Appends the counters of this object and of the observed sub metrics as JSON objects, separated by commas
+   void PrintJSONCounters(std::ostream &output, const std::string &prefix, bool &isFirst) const;
 
 public:
    explicit RNTupleMetrics(const std::string &name) : fName(name) {}
@@ -322,10 +327,71 @@ public:
    void ObserveMetrics(RNTupleMetrics &observee);
 
    void Print(std::ostream &output, const std::string &prefix = "") const;
+   /// Prints the counters of this object and of all the observed sub metrics as a JSON object of the form
+   /// `{"name": "...", "counters": [{"name": "...", "unit": "...", "description": "...", "value": ...}, ...]}`.
+   /// Counter names are fully qualified. Disabled metrics have an empty list of counters.
+   void PrintJSON(std::ostream &output) const;
    void Enable();
    bool IsEnabled() const { return fIsEnabled; }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleMetricsRegistry
+\ingroup NTuple
+\brief Process-wide collection of the metrics of all open RNTuple readers and writers
+
+Readers and writers register their metrics on construction and unregister them on destruction. The registry can
+provide JSON snapshots of all registered metrics on demand or push them periodically to a callback, which runs on a
+dedicated thread. Only enabled metrics contribute counter values. Note that counters that are not thread-safe may be
+concurrently updated while being read for a snapshot, so that their values can be slightly out of date.
+*/
+// clang-format on
+class RNTupleMetricsRegistry {
+public:
+   /// Receives a snapshot (see GetSnapshotJSON()). Must not set or reset the push callback.
+   using PushCallback_t = std::function<void(const std::string &snapshot)>;
+
+private:
+   /// Protects the registered metrics and the push callback
+   std::mutex fLock;
+   std::vector<const RNTupleMetrics *> fMetrics;
+   PushCallback_t fPushCallback;
+   std::chrono::milliseconds fPushInterval{0};
+   /// Signals the push thread to stop
+   std::condition_variable fCvStopPush;
+   bool fStopPush = false;
+   std::thread fPushThread;
+
+   RNTupleMetricsRegistry() = default;
+   /// Needs to be called with fLock held
+   std::string MakeSnapshot() const;
+   /// The push thread routine
+   void ExecPush();
+
+public:
+   RNTupleMetricsRegistry(const RNTupleMetricsRegistry &other) = delete;
+   RNTupleMetricsRegistry &operator=(const RNTupleMetricsRegistry &other) = delete;
+   ~RNTupleMetricsRegistry();
+
+   static RNTupleMetricsRegistry &Instance();
+
+   /// The metrics must stay valid until they are unregistered
+   void Register(const RNTupleMetrics &metrics);
+   /// Blocks while a snapshot that includes the metrics is taken
+   void Unregister(const RNTupleMetrics &metrics);
+
+   /// Returns a JSON object of the form `{"timestamp": ..., "metrics": [...]}`, where the timestamp is in
+   /// milliseconds since the epoch and the metrics array contains every registered metrics as by
+   /// RNTupleMetrics::PrintJSON()
+   std::string GetSnapshotJSON();
+
+   /// Starts pushing a snapshot to `callback` every `interval`, replacing any previously set callback
+   void SetPushCallback(PushCallback_t callback, std::chrono::milliseconds interval);
+   /// Stops pushing snapshots; returns only after the last invocation of the callback has finished
+   void ResetPushCallback();
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
@@ -24,6 +24,7 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RSpan.hxx>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -75,6 +76,15 @@ The object returned by the RNTupleProcessor iterator is a view on the current st
 access to the global entry index (i.e., the entry index taking into account all processed ntuples), local entry index
 (i.e. the entry index for only the currently processed ntuple), the index of the ntuple currently being processed (with
 respect to the order of provided RNTupleSpecs) and the actual REntry containing the values for the current entry.
+
+Alternatively, the entries can be processed in parallel with RNTupleProcessor::ProcessParallel:
+
+~~~{.cpp}
+std::vector<double> sums(ROOT::GetThreadPoolSize());
+processor.ProcessParallel([&sums](unsigned int slot, NTupleSize_t, const REntry &entry) {
+   sums[slot] += *entry.GetPtr<float>("pt");
+});
+~~~
 */
 // clang-format on
 class RNTupleProcessor {
@@ -256,6 +266,23 @@ public:
    /// RNTuples are processed in the order in which they are specified.
    RNTupleProcessor(const std::vector<RNTupleSourceSpec> &ntuples, std::unique_ptr<RNTupleModel> model = nullptr);
 
+   /// Signature of the callable that is invoked for every entry by ProcessParallel(): the processing slot, the global
+   /// entry index and the entry holding the values read for the slot.
+   using ParallelCallback_t = std::function<void(unsigned int, NTupleSize_t, const REntry &)>;
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Process all entries of all RNTuples in parallel.
+   ///
+   /// \param[in] callable The function that is called for every entry.
+   ///
+   /// The RNTuples are split into cluster-aligned work items that are scheduled on the ROOT thread pool if implicit
+   /// multi-threading is enabled. Every processing slot has its own page sources and its own REntry, created from
+   /// the processor's model; the entry passed to `callable` is therefore not the one returned by GetEntry(). The slot
+   /// number is smaller than ROOT::GetThreadPoolSize() (or zero if implicit multi-threading is disabled), such that
+   /// it can be used to index per-slot results without locking. The order in which the entries are processed is
+   /// unspecified; entries within a single cluster are processed in order.
+   void ProcessParallel(const ParallelCallback_t &callable);
+
    RIterator begin() { return RIterator(*this, 0, 0); }
    RIterator end() { return RIterator(*this, fNTuples.size(), kInvalidNTupleIndex); }
 };
@@ -16,6 +16,8 @@
 #ifndef ROOT7_RNTupleReadOptions
 #define ROOT7_RNTupleReadOptions
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -39,11 +41,35 @@ public:
       kOff,
       kDefault,
    };
+   /// Selects the allocator for the memory of unsealed pages
+   enum class EPageAllocator {
+      /// Every page is allocated and freed individually on the heap
+      kHeap,
+      /// The memory of released pages is reused by the following pages (see RPageAllocatorPool)
+      kPool,
+      kDefault = kHeap,
+   };
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// The number of cluster bunches that may be merged into a single vector read by the cluster pool.  Values larger
+   /// than 1 widen the look-ahead window and increase the number of read requests in flight at the same time.
+   unsigned int fClusterBunchesInFlight = 1;
+   /// The number of connections over which the file page source distributes the read requests of a cluster bunch.
+   /// Values larger than 1 keep several vector reads in flight for remote files (e.g., over HTTP).
+   unsigned int fNRemoteReadStreams = 1;
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
+   EPageAllocator fPageAllocator = EPageAllocator::kDefault;
+   /// Upper bound of the memory kept for reuse by the pooling page allocator
+   std::size_t fPagePoolMaxBytes = 64 * 1024 * 1024;
+   /// If true, large cluster buffers are backed by transparent huge pages where the platform supports it
+   bool fUseHugePages = false;
+   /// If true, a page source of a local file maps the file into memory. Pages that are neither compressed nor need
+   /// unpacking then point directly into the mapping; other pages are unsealed from the mapping without a read call.
+   bool fUseMemoryMapping = false;
+   /// If true, the cluster pool looks up clusters in the process-wide RSharedClusterCache before reading them
+   bool fUseSharedClusterCache = false;
    /// If true, the RNTupleReader will track metrics straight from its construction, as
    /// if calling `RNTupleReader::EnableMetrics()` before having created the object.
    bool fEnableMetrics = false;
@@ -55,9 +81,30 @@ public:
    unsigned int GetClusterBunchSize() const { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
 
+   unsigned int GetClusterBunchesInFlight() const { return fClusterBunchesInFlight; }
+   void SetClusterBunchesInFlight(unsigned int val) { fClusterBunchesInFlight = val; }
+
+   unsigned int GetNRemoteReadStreams() const { return fNRemoteReadStreams; }
+   void SetNRemoteReadStreams(unsigned int val) { fNRemoteReadStreams = val; }
+
    EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
    void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
 
+   EPageAllocator GetPageAllocator() const { return fPageAllocator; }
+   void SetPageAllocator(EPageAllocator val) { fPageAllocator = val; }
+
+   std::size_t GetPagePoolMaxBytes() const { return fPagePoolMaxBytes; }
+   void SetPagePoolMaxBytes(std::size_t val) { fPagePoolMaxBytes = val; }
+
+   bool GetUseHugePages() const { return fUseHugePages; }
+   void SetUseHugePages(bool val) { fUseHugePages = val; }
+
+   bool GetUseMemoryMapping() const { return fUseMemoryMapping; }
+   void SetUseMemoryMapping(bool val) { fUseMemoryMapping = val; }
+
+   bool GetUseSharedClusterCache() const { return fUseSharedClusterCache; }
+   void SetUseSharedClusterCache(bool val) { fUseSharedClusterCache = val; }
+
    bool HasMetricsEnabled() const { return fEnableMetrics; }
    void SetMetricsEnabled(bool enable) { fEnableMetrics = enable; }
 };
@@ -80,6 +80,9 @@ enum class EColumnType {
    kSplitUInt16,
    kReal32Trunc,
    kReal32Quant,
+   // Frame-of-reference bit-packed integers: every element is stored as the difference to the minimum of the
+   // column's value range, using the column's bits on storage
+   kIntFOR,
    kMax,
 };
 
@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <string_view>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -260,6 +262,19 @@ public:
 \class ROOT::Experimental::RNTupleDirectAccessView
 \ingroup NTuple
 \brief A view variant that provides direct access to the I/O buffers. Only works for mappable fields.
+
+Besides element-wise access, the view provides bulk access through ReadBulk(), which returns spans that point
+directly into the page memory. A span never crosses a page boundary; in order to process a range of entries, call
+ReadBulk() repeatedly until the range is consumed:
+~~~ {.cpp}
+auto viewPt = reader->GetDirectAccessView<float>("pt");
+for (NTupleSize_t i = 0; i < reader->GetNEntries();) {
+   auto pts = viewPt.ReadBulk(i, reader->GetNEntries() - i);
+   // process pts.data()[0 .. pts.size())
+   i += pts.size();
+}
+~~~
+A span remains valid until the next call to the view that maps a different page.
 */
 // clang-format on
 template <typename T>
@@ -298,6 +313,26 @@ public:
 
    const T &operator()(NTupleSize_t globalIndex) { return *fField.Map(globalIndex); }
    const T &operator()(RClusterIndex clusterIndex) { return *fField.Map(clusterIndex); }
+
+   /// Returns up to `maxCount` consecutive elements starting at `globalIndex` without copying;
+   /// the returned span is shorter than requested if the page containing `globalIndex` ends earlier.
+   std::span<const T> ReadBulk(NTupleSize_t globalIndex, NTupleSize_t maxCount)
+   {
+      if (maxCount == 0)
+         return {};
+      NTupleSize_t nItems;
+      const T *values = fField.MapV(globalIndex, nItems);
+      return std::span<const T>(values, std::min(nItems, maxCount));
+   }
+
+   std::span<const T> ReadBulk(RClusterIndex clusterIndex, NTupleSize_t maxCount)
+   {
+      if (maxCount == 0)
+         return {};
+      NTupleSize_t nItems;
+      const T *values = fField.MapV(clusterIndex, nItems);
+      return std::span<const T>(values, std::min(nItems, maxCount));
+   }
 };
 
 // clang-format off
@@ -371,6 +406,19 @@ public:
       return RNTupleView<T>(RNTupleView<T>::CreateField(fieldId, fSource));
    }
 
+   /// Raises an exception if there is no field with the given name. The global indexes of the returned view are
+   /// the item indexes of this collection, i.e. local indexes can be taken from GetCollectionRange().
+   template <typename T>
+   RNTupleDirectAccessView<T> GetDirectAccessView(std::string_view fieldName)
+   {
+      auto fieldId = fSource->GetSharedDescriptorGuard()->FindFieldId(fieldName, fField->GetOnDiskId());
+      if (fieldId == kInvalidDescriptorId) {
+         throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
+                                  fSource->GetSharedDescriptorGuard()->GetName() + "'"));
+      }
+      return RNTupleDirectAccessView<T>(RNTupleDirectAccessView<T>::CreateField(fieldId, fSource));
+   }
+
    /// Raises an exception if there is no field with the given name.
    RNTupleCollectionView GetCollectionView(std::string_view fieldName)
    {
@@ -382,6 +430,19 @@ public:
       return RNTupleCollectionView::Create(fieldId, fSource);
    }
 
+   /// Returns up to `maxCount` elements of the offset column starting at collection `globalIndex` without copying.
+   /// Element `i` of the span is the cluster-local item index one past the end of collection `globalIndex + i`; the
+   /// start of the first collection is given by GetCollectionRange(globalIndex). Like RNTupleDirectAccessView::ReadBulk(),
+   /// the span ends at the page boundary and can thus be shorter than requested.
+   std::span<const ClusterSize_t> ReadBulkOffsets(NTupleSize_t globalIndex, NTupleSize_t maxCount)
+   {
+      if (maxCount == 0)
+         return {};
+      NTupleSize_t nItems;
+      const ClusterSize_t *offsets = AsClusterSizeField()->MapV(globalIndex, nItems);
+      return std::span<const ClusterSize_t>(offsets, std::min(nItems, maxCount));
+   }
+
    ClusterSize_t operator()(NTupleSize_t globalIndex) {
       ClusterSize_t size;
       RClusterIndex collectionStart;
@@ -73,6 +73,10 @@ protected:
    std::size_t fInitialNElementsPerPage = 64;
    /// Pages can grow only to the given limit in bytes.
    std::size_t fMaxUnzippedPageSize = 1024 * 1024;
+   /// If non-zero, buffered writing adapts the page size of every column such that, given the compression ratio
+   /// observed for the column so far, pages approximate the given compressed size in bytes. The uncompressed page
+   /// size is still bounded by fMaxUnzippedPageSize and by the initial page size.
+   std::size_t fApproxZippedPageSize = 0;
    /// The maximum size that the sum of all page buffers used for writing into a persistent sink are allowed to use.
    /// If set to zero, RNTuple will auto-adjust the budget based on the value of fApproxZippedClusterSize.
    /// If set manually, the size needs to be large enough to hold all initial page buffers.
@@ -89,10 +93,17 @@ protected:
    /// Buffer size to use for writing to files, must be a multiple of 4096 bytes. Testing suggests that 4MiB gives best
    /// performance (with Direct I/O) at a reasonable memory consumption.
    std::size_t fWriteBufferSize = 4 * 1024 * 1024;
+   /// Whether full write buffers are handed over to a background I/O thread instead of being written by the thread
+   /// that commits the data. At most fPageBufferBudget bytes (but at least one buffer) are queued for writing.
+   /// Only has an effect when writing to a local file with a C file stream.
+   bool fUseWriteBehind = false;
    /// Whether to use implicit multi-threading to compress pages. Only has an effect if buffered writing is turned on.
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
    /// If set, checksums will be calculated and written for every page.
    bool fEnablePageChecksums = true;
+   /// If set, the minimum and maximum value of every numeric column are recorded per cluster in the page list.
+   /// Readers can use this information to skip clusters (see RClusterDescriptor::RColumnRange::fMinMax).
+   bool fEnableColumnStatistics = false;
    /// Specifies the max size of a payload storeable into a single TKey. When writing an RNTuple to a ROOT file,
    /// any payload whose size exceeds this will be split into multiple keys.
    std::uint64_t fMaxKeySize = kDefaultMaxKeySize;
@@ -121,6 +132,9 @@ public:
    std::size_t GetMaxUnzippedPageSize() const { return fMaxUnzippedPageSize; }
    void SetMaxUnzippedPageSize(std::size_t val);
 
+   std::size_t GetApproxZippedPageSize() const { return fApproxZippedPageSize; }
+   void SetApproxZippedPageSize(std::size_t val) { fApproxZippedPageSize = val; }
+
    std::size_t GetPageBufferBudget() const;
    void SetPageBufferBudget(std::size_t val) { fPageBufferBudget = val; }
 
@@ -133,6 +147,9 @@ public:
    std::size_t GetWriteBufferSize() const { return fWriteBufferSize; }
    void SetWriteBufferSize(std::size_t val) { fWriteBufferSize = val; }
 
+   bool GetUseWriteBehind() const { return fUseWriteBehind; }
+   void SetUseWriteBehind(bool val) { fUseWriteBehind = val; }
+
    EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
    void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
 
@@ -140,6 +157,9 @@ public:
    /// Note that turning off page checksums will also turn off the same page merging optimization (see tuning.md)
    void SetEnablePageChecksums(bool val) { fEnablePageChecksums = val; }
 
+   bool GetEnableColumnStatistics() const { return fEnableColumnStatistics; }
+   void SetEnableColumnStatistics(bool val) { fEnableColumnStatistics = val; }
+
    std::uint64_t GetMaxKeySize() const { return fMaxKeySize; }
 };
 
@@ -19,8 +19,11 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPage.hxx>
 
+#include <array>
 #include <cstddef>
 #include <functional>
+#include <mutex>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -68,6 +71,61 @@ public:
    RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements) final;
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RPageAllocatorPool
+\ingroup NTuple
+\brief Recycles the memory of released pages for subsequent allocations
+
+Page buffers are allocated in power-of-two size classes. Released buffers are kept in a free list per size class and
+handed out again by later NewPage() calls of the same size class, such that unzipped pages of a new cluster typically
+reuse the memory of the pages of the previous cluster. The total size of the buffers kept in the free lists is bounded;
+buffers that do not fit anymore, as well as buffers larger than the largest size class, are returned to the heap.
+*/
+// clang-format on
+class RPageAllocatorPool : public RPageAllocator {
+public:
+   static constexpr std::size_t kDefaultMaxCachedBytes = 64 * 1024 * 1024;
+   /// The smallest size class is 2^kMinSizeClassLog2 bytes
+   static constexpr unsigned int kMinSizeClassLog2 = 6;
+   /// The largest size class is 2^kMaxSizeClassLog2 bytes; larger pages are not pooled
+   static constexpr unsigned int kMaxSizeClassLog2 = 26;
+
+private:
+   static constexpr unsigned int kNSizeClasses = kMaxSizeClassLog2 - kMinSizeClassLog2 + 1;
+
+   /// Protects the free lists and the cached bytes counter
+   std::mutex fLock;
+   std::array<std::vector<unsigned char *>, kNSizeClasses> fFreeLists;
+   /// Upper bound for fCachedBytes
+   std::size_t fMaxCachedBytes;
+   /// The sum of the buffer sizes in the free lists
+   std::size_t fCachedBytes = 0;
+
+   /// Returns the index of the size class for a buffer of the given size or kNSizeClasses for unpooled buffers
+   static unsigned int GetSizeClass(std::size_t nbytes);
+   static std::size_t GetSizeClassBytes(unsigned int sizeClass)
+   {
+      return std::size_t(1) << (sizeClass + kMinSizeClassLog2);
+   }
+
+protected:
+   void DeletePage(RPage &page) final;
+
+public:
+   explicit RPageAllocatorPool(std::size_t maxCachedBytes = kDefaultMaxCachedBytes) : fMaxCachedBytes(maxCachedBytes)
+   {
+   }
+   RPageAllocatorPool(const RPageAllocatorPool &) = delete;
+   RPageAllocatorPool &operator=(const RPageAllocatorPool &) = delete;
+   ~RPageAllocatorPool() override;
+
+   RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements) final;
+
+   /// The number of bytes currently kept for reuse in the free lists
+   std::size_t GetCachedBytes();
+};
+
 } // namespace Internal
 } // namespace Experimental
 } // namespace ROOT
@@ -25,7 +25,9 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <tuple>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -78,6 +80,19 @@ private:
       bool IsEmpty() const { return fBufferedPages.empty(); }
       bool HasSealedPagesOnly() const { return fBufferedPages.size() == fSealedPages.size(); }
       const RPageStorage::SealedPageSequence_t &GetSealedPages() const { return fSealedPages; }
+      const std::optional<std::pair<double, double>> &GetMinMax() const { return fMinMax; }
+      /// Merges the statistics of a newly buffered page (see RPageSink::MergeColumnStatistics())
+      void UpdateMinMax(const std::optional<std::pair<double, double>> &minMax)
+      {
+         RPageSink::MergeColumnStatistics(fMinMax, minMax);
+      }
+
+      /// Returns the adapted maximum page size or zero if the page size has not been adapted (yet)
+      std::size_t GetMaxPageSize() const { return fMaxPageSize; }
+      /// Adapts the maximum page size to the write options' approximate compressed page size, given newly sealed
+      /// pages of the column with `nBytesUnzipped` and `nBytesZipped` in total
+      void AdaptMaxPageSize(std::uint64_t nBytesUnzipped, std::uint64_t nBytesZipped,
+                            const RNTupleWriteOptions &options);
 
       void DropBufferedPages();
 
@@ -98,6 +113,12 @@ private:
       /// Note that each RSealedPage refers to the same buffer as `fBufferedPages[i].fBuf` for some value of `i`, and
       /// thus owned by RPageZipItem
       RPageStorage::SealedPageSequence_t fSealedPages;
+      /// Min/max statistics of the buffered pages, if enabled in the write options
+      std::optional<std::pair<double, double>> fMinMax;
+      /// Running estimate of the column's compression ratio (uncompressed / compressed size), zero if unknown
+      double fCompressionRatio = 0;
+      /// If adaptive page sizing is enabled, the uncompressed size in bytes up to which the column's pages are grown
+      std::size_t fMaxPageSize = 0;
    };
 
 private:
@@ -150,6 +171,7 @@ public:
    void CommitDatasetImpl() final;
 
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
+   std::size_t GetMaxWritePageSize(ColumnHandle_t columnHandle) const final;
 }; // RPageSinkBuf
 
 } // namespace Internal
@@ -36,9 +36,12 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <shared_mutex>
+#include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace ROOT {
@@ -134,6 +137,8 @@ public:
       DescriptorId_t fPhysicalColumnId;
       SealedPageSequence_t::const_iterator fFirst;
       SealedPageSequence_t::const_iterator fLast;
+      /// Optional min/max statistics of the values in the pages of the group (see RColumnElementBase::GetMinMax())
+      std::optional<std::pair<double, double>> fMinMax;
 
       RSealedPageGroup() = default;
       RSealedPageGroup(DescriptorId_t d, SealedPageSequence_t::const_iterator b, SealedPageSequence_t::const_iterator e)
@@ -266,6 +271,7 @@ public:
          RClusterDescriptor::RPageRange fPageRange;
          ClusterSize_t fNElements = kInvalidClusterIndex;
          bool fIsSuppressed = false;
+         std::optional<std::pair<double, double>> fMinMax;
       };
 
       std::vector<RColumnInfo> fColumnInfos;
@@ -286,6 +292,12 @@ protected:
    /// Usage of this method requires construction of fCompressor.
    RSealedPage SealPage(const RPage &page, const RColumnElementBase &element);
 
+   /// Merges the min/max statistics of a page (group) into the statistics of a column range. A page without
+   /// statistics turns the column range statistics into the uninformative range [-inf, inf], which is dropped
+   /// when the cluster is staged.
+   static void MergeColumnStatistics(std::optional<std::pair<double, double>> &target,
+                                     const std::optional<std::pair<double, double>> &source);
+
 private:
    /// Flag if sink was initialized
    bool fIsInitialized = false;
@@ -368,6 +380,14 @@ public:
    virtual void CommitSealedPage(DescriptorId_t physicalColumnId, const RPageStorage::RSealedPage &sealedPage) = 0;
    /// Write a vector of preprocessed pages to storage. The corresponding columns must have been added before.
    virtual void CommitSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges) = 0;
+   /// Like CommitSealedPageV() but the sink may leave the bulk of the I/O to the returned function. The function does
+   /// not touch the shared state of the sink and can thus be executed after releasing the sink guard. The sealed pages
+   /// must stay valid until the function has been executed. Returns an empty function if all the data was written.
+   virtual std::function<void()> CommitSealedPageVDeferred(std::span<RPageStorage::RSealedPageGroup> ranges)
+   {
+      CommitSealedPageV(ranges);
+      return {};
+   }
    /// Stage the current cluster and create a new one for the following data.
    /// Returns the object that must be passed to CommitStagedClusters to logically append the staged cluster to the
    /// ntuple descriptor.
@@ -394,6 +414,13 @@ public:
    /// Get a new, empty page for the given column that can be filled with up to nElements;
    /// nElements must be larger than zero.
    virtual RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements);
+   /// Returns the uncompressed size in bytes up to which the write page of the given column should grow.
+   /// Sinks that observe the compression of the column's pages may adapt the size toward the approximate compressed
+   /// page size set in the write options. The default is the maximum uncompressed page size.
+   virtual std::size_t GetMaxWritePageSize(ColumnHandle_t /*columnHandle*/) const
+   {
+      return GetWriteOptions().GetMaxUnzippedPageSize();
+   }
 
    /// An RAII wrapper used to synchronize a page sink. See GetSinkGuard().
    class RSinkGuard {
@@ -485,6 +512,16 @@ protected:
    /// optimized implementation though.
    virtual std::vector<RNTupleLocator>
    CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges, const std::vector<bool> &mask);
+   /// Like CommitSealedPageVImpl() but derived classes may set `deferredWrite` to a function that writes (part of)
+   /// the pages at a later point, without holding the sink guard (see CommitSealedPageVDeferred()).
+   /// The returned locators must already be valid. The default is to write everything immediately.
+   virtual std::vector<RNTupleLocator>
+   CommitSealedPageVDeferredImpl(std::span<RPageStorage::RSealedPageGroup> ranges, const std::vector<bool> &mask,
+                                 std::function<void()> &deferredWrite)
+   {
+      (void)deferredWrite;
+      return CommitSealedPageVImpl(ranges, mask);
+   }
    /// Returns the number of bytes written to storage (excluding metadata)
    virtual std::uint64_t StageClusterImpl() = 0;
    /// Returns the locator of the page list envelope of the given buffer that contains the serialized page list.
@@ -529,6 +566,7 @@ public:
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page) final;
    void CommitSealedPage(DescriptorId_t physicalColumnId, const RPageStorage::RSealedPage &sealedPage) final;
    void CommitSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges) final;
+   std::function<void()> CommitSealedPageVDeferred(std::span<RPageStorage::RSealedPageGroup> ranges) final;
    RStagedCluster StageCluster(NTupleSize_t nNewEntries) final;
    void CommitStagedClusters(std::span<RStagedCluster> clusters) final;
    void CommitClusterGroup() final;
@@ -638,6 +676,7 @@ protected:
    public:
       void Insert(DescriptorId_t physicalColumnID);
       void Erase(DescriptorId_t physicalColumnID);
+      bool Contains(DescriptorId_t physicalColumnID) const;
       RCluster::ColumnSet_t ToColumnSet() const;
    };
 
@@ -656,6 +695,18 @@ protected:
    RNTupleReadOptions fOptions;
    /// The active columns are implicitly defined by the model fields or views
    RActivePhysicalColumns fActivePhysicalColumns;
+   /// The on-disk IDs of the fields whose columns are deferred, see `SetDeferredField()`
+   std::unordered_set<DescriptorId_t> fDeferredFieldIds;
+   /// The subset of the active columns that belong to deferred fields
+   RActivePhysicalColumns fDeferredPhysicalColumns;
+
+   /// Whether the pages of the given column should be read one by one on demand rather than with their cluster
+   bool IsDeferredColumn(DescriptorId_t physicalColumnID) const
+   {
+      return fDeferredPhysicalColumns.Contains(physicalColumnID);
+   }
+   /// The active columns that are read (and prefetched) together with their cluster, i.e. all but the deferred ones
+   RCluster::ColumnSet_t GetClusterColumnSet() const;
 
    /// Pages that are unzipped with IMT are staged into the page pool
    RPagePool fPagePool;
@@ -737,6 +788,12 @@ public:
    NTupleSize_t GetNEntries();
    NTupleSize_t GetNElements(ColumnHandle_t columnHandle);
 
+   /// Defer loading the columns of the given field (not of its subfields), to be called before the field is
+   /// connected. Deferred columns are not read and prefetched with their cluster; instead, each of their pages is
+   /// read and unsealed only when it is requested. This saves reading and decompressing the pages of columns that
+   /// are only accessed for a few entries ("late materialization"), at the cost of more, smaller read requests.
+   void SetDeferredField(DescriptorId_t fieldId, bool isDeferred = true);
+
    /// Promise to only read from the given entry range. If set, prevents the cluster pool from reading-ahead beyond
    /// the given range. The range needs to be within `[0, GetNEntries())`.
    void SetEntryRange(const REntryRange &range);
@@ -766,6 +823,11 @@ public:
    /// concurrently to other methods of the page source.
    virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) = 0;
 
+   /// Identifies the physical storage container of the ntuple in the process-wide RSharedClusterCache.
+   /// Page sources that return an empty string (the default) do not use the shared cluster cache.
+   /// Like `LoadClusters()`, the method is called from the I/O thread of the cluster pool.
+   virtual std::string GetStorageId() const { return ""; }
+
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
    /// unzip thread. It is an optional optimization, the method can safely do nothing. In particular, the
@@ -25,11 +25,14 @@
 #include <string_view>
 
 #include <array>
+#include <cstddef>
 #include <cstdio>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -92,6 +95,11 @@ protected:
    CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RPageStorage::RSealedPage &sealedPage) final;
    std::vector<RNTupleLocator>
    CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges, const std::vector<bool> &mask) final;
+   /// Reserves a single record for all the pages and leaves the write of the record's whole blocks to
+   /// `deferredWrite`, if possible. Otherwise falls back to CommitSealedPageVImpl().
+   std::vector<RNTupleLocator>
+   CommitSealedPageVDeferredImpl(std::span<RPageStorage::RSealedPageGroup> ranges, const std::vector<bool> &mask,
+                                 std::function<void()> &deferredWrite) final;
    std::uint64_t StageClusterImpl() final;
    RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
    using RPagePersistentSink::CommitDatasetImpl;
@@ -140,6 +148,13 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    RMiniFileReader fReader;
+   /// The read-only memory mapping of the entire file if RNTupleReadOptions::GetUseMemoryMapping() is set and the
+   /// file is local; nullptr otherwise
+   unsigned char *fMappedFile = nullptr;
+   std::size_t fMappedSize = 0;
+   /// Additional connections to a remote file, used by LoadClusters() to keep several vector reads in flight
+   /// (see RNTupleReadOptions::SetNRemoteReadStreams())
+   std::vector<std::unique_ptr<ROOT::Internal::RRawFile>> fReadStreams;
    /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
@@ -149,6 +164,13 @@ private:
 
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
 
+   /// Called at the end of AttachImpl(); leaves fMappedFile as nullptr if the file cannot be mapped
+   void MapFile();
+
+   /// Issues the given read requests through `file`, which is either fFile or one of fReadStreams, in as few
+   /// vector reads as the limits of the file allow
+   void ReadRequests(ROOT::Internal::RRawFile &file, ROOT::Internal::RRawFile::RIOVec *readRequests, std::size_t nReqs);
+
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
    /// the provided vector.  This way, requests can be collected for multiple clusters before
@@ -183,6 +205,8 @@ public:
    void LoadSealedPage(DescriptorId_t physicalColumnId, RClusterIndex clusterIndex, RSealedPage &sealedPage) final;
 
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+
+   std::string GetStorageId() const final;
 }; // class RPageSourceFile
 
 } // namespace Internal
@@ -15,11 +15,17 @@
 
 #include <ROOT/RCluster.hxx>
 
+#include <ROOT/RConfig.hxx>
+
 #include <TError.h>
 
 #include <iterator>
 #include <utility>
 
+#ifdef R__LINUX
+#include <sys/mman.h>
+#endif
+
 ROOT::Experimental::Internal::ROnDiskPageMap::~ROnDiskPageMap() = default;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +34,35 @@ ROOT::Experimental::Internal::ROnDiskPageMapHeap::~ROnDiskPageMapHeap() = defaul
 
 ////////////////////////////////////////////////////////////////////////////////
 
+ROOT::Experimental::Internal::ROnDiskPageMapHugePages::ROnDiskPageMapHugePages(std::size_t size)
+{
+#if defined(R__LINUX) && defined(MADV_HUGEPAGE)
+   const auto mappedSize = ((size + kHugePageSize - 1) / kHugePageSize) * kHugePageSize;
+   void *memory = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (memory != MAP_FAILED) {
+      // The advice is a hint; if transparent huge pages are disabled, we still have a valid mapping
+      madvise(memory, mappedSize, MADV_HUGEPAGE);
+      fMemory = static_cast<unsigned char *>(memory);
+      fMappedSize = mappedSize;
+      return;
+   }
+#endif
+   fMemory = new unsigned char[size]();
+}
+
+ROOT::Experimental::Internal::ROnDiskPageMapHugePages::~ROnDiskPageMapHugePages()
+{
+#ifdef R__LINUX
+   if (fMappedSize > 0) {
+      munmap(fMemory, fMappedSize);
+      return;
+   }
+#endif
+   delete[] fMemory;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 const ROOT::Experimental::Internal::ROnDiskPage *
 ROOT::Experimental::Internal::RCluster::GetOnDiskPage(const ROnDiskPage::Key &key) const
 {
@@ -64,3 +99,22 @@ void ROOT::Experimental::Internal::RCluster::SetColumnAvailable(DescriptorId_t p
 {
    fAvailPhysicalColumns.insert(physicalColumnId);
 }
+
+std::size_t ROOT::Experimental::Internal::RCluster::GetNBytesOnDiskPages() const
+{
+   std::size_t nbytes = 0;
+   for (const auto &kv : fOnDiskPages)
+      nbytes += kv.second.GetSize();
+   return nbytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::Experimental::Internal::ROnDiskPageMapShared::ROnDiskPageMapShared(std::shared_ptr<const RCluster> cluster)
+   : fCluster(std::move(cluster))
+{
+   for (const auto &[key, onDiskPage] : fCluster->fOnDiskPages)
+      Register(key, onDiskPage);
+}
+
+ROOT::Experimental::Internal::ROnDiskPageMapShared::~ROnDiskPageMapShared() = default;
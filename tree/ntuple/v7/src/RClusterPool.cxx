@@ -16,6 +16,7 @@
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RTrace.hxx>
 
 #include <TError.h>
 
@@ -48,13 +49,118 @@ bool ROOT::Experimental::Internal::RClusterPool::RInFlightCluster::operator<(con
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
-ROOT::Experimental::Internal::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+ROOT::Experimental::Internal::RSharedClusterCache &ROOT::Experimental::Internal::RSharedClusterCache::Instance()
+{
+   static RSharedClusterCache cache;
+   return cache;
+}
+
+std::unique_ptr<ROOT::Experimental::Internal::RCluster>
+ROOT::Experimental::Internal::RSharedClusterCache::CreateView(std::shared_ptr<const RCluster> cluster)
+{
+   auto view = std::make_unique<RCluster>(cluster->GetId());
+   for (auto colId : cluster->GetAvailPhysicalColumns())
+      view->SetColumnAvailable(colId);
+   view->Adopt(std::make_unique<ROnDiskPageMapShared>(std::move(cluster)));
+   return view;
+}
+
+void ROOT::Experimental::Internal::RSharedClusterCache::EvictUntil(std::size_t memoryBudget)
+{
+   while (fMemoryUsage > memoryBudget) {
+      R__ASSERT(!fEntries.empty());
+      auto itrEntry = std::prev(fEntries.end());
+      auto range = fIndex.equal_range(itrEntry->fLookupKey);
+      for (auto itrIndex = range.first; itrIndex != range.second; ++itrIndex) {
+         if (itrIndex->second == itrEntry) {
+            fIndex.erase(itrIndex);
+            break;
+         }
+      }
+      fMemoryUsage -= itrEntry->fNBytes;
+      fEntries.erase(itrEntry);
+   }
+}
+
+std::unique_ptr<ROOT::Experimental::Internal::RCluster>
+ROOT::Experimental::Internal::RSharedClusterCache::Get(const std::string &storageId, const std::string &ntupleName,
+                                                       const RCluster::RKey &clusterKey)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   auto range = fIndex.equal_range(RLookupKey{storageId, ntupleName, clusterKey.fClusterId});
+   for (auto itr = range.first; itr != range.second; ++itr) {
+      const auto &cluster = itr->second->fCluster;
+      bool hasAllColumns = std::all_of(clusterKey.fPhysicalColumnSet.begin(), clusterKey.fPhysicalColumnSet.end(),
+                                       [&cluster](DescriptorId_t colId) { return cluster->ContainsColumn(colId); });
+      if (!hasAllColumns)
+         continue;
+      // Mark as most recently used
+      fEntries.splice(fEntries.begin(), fEntries, itr->second);
+      return CreateView(cluster);
+   }
+   return nullptr;
+}
+
+std::unique_ptr<ROOT::Experimental::Internal::RCluster>
+ROOT::Experimental::Internal::RSharedClusterCache::Put(const std::string &storageId, const std::string &ntupleName,
+                                                       std::unique_ptr<RCluster> cluster)
+{
+   const auto nbytes = cluster->GetNBytesOnDiskPages();
+
+   std::lock_guard<std::mutex> guard(fLock);
+   if (nbytes > fMemoryBudget)
+      return cluster;
+
+   REntry entry;
+   entry.fLookupKey = RLookupKey{storageId, ntupleName, cluster->GetId()};
+   entry.fCluster = std::shared_ptr<const RCluster>(std::move(cluster));
+   entry.fNBytes = nbytes;
+   EvictUntil(fMemoryBudget - nbytes);
+
+   fEntries.emplace_front(std::move(entry));
+   fIndex.emplace(fEntries.front().fLookupKey, fEntries.begin());
+   fMemoryUsage += nbytes;
+   return CreateView(fEntries.front().fCluster);
+}
+
+void ROOT::Experimental::Internal::RSharedClusterCache::SetMemoryBudget(std::size_t memoryBudget)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fMemoryBudget = memoryBudget;
+   EvictUntil(fMemoryBudget);
+}
+
+std::size_t ROOT::Experimental::Internal::RSharedClusterCache::GetMemoryBudget()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fMemoryBudget;
+}
+
+std::size_t ROOT::Experimental::Internal::RSharedClusterCache::GetMemoryUsage()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fMemoryUsage;
+}
+
+void ROOT::Experimental::Internal::RSharedClusterCache::Clear()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   EvictUntil(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::Experimental::Internal::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                                                         unsigned int maxBunchesInFlight, unsigned int windowPre)
    : fPageSource(pageSource),
+     fWindowPre(windowPre),
      fClusterBunchSize(clusterBunchSize),
-     fPool(2 * clusterBunchSize),
+     fMaxBunchesInFlight(maxBunchesInFlight),
+     fPool(windowPre + (1 + maxBunchesInFlight) * clusterBunchSize),
      fThreadIo(&RClusterPool::ExecReadClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
+   R__ASSERT(maxBunchesInFlight > 0);
 }
 
 ROOT::Experimental::Internal::RClusterPool::~RClusterPool()
@@ -81,6 +187,7 @@ void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
       while (!readItems.empty()) {
          std::vector<RCluster::RKey> clusterKeys;
          std::int64_t bunchId = -1;
+         unsigned int nBunches = 0;
          for (unsigned i = 0; i < readItems.size(); ++i) {
             const auto &item = readItems[i];
             // `kInvalidDescriptorId` is used as a marker for thread cancellation. Such item causes the
@@ -89,13 +196,16 @@ void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
                R__ASSERT(i == (readItems.size() - 1));
                return;
             }
-            if ((bunchId >= 0) && (item.fBunchId != bunchId))
-               break;
+            if (item.fBunchId != bunchId) {
+               if (nBunches == fMaxBunchesInFlight)
+                  break;
+               nBunches++;
+            }
             bunchId = item.fBunchId;
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
-         auto clusters = fPageSource.LoadClusters(clusterKeys);
+         auto clusters = LoadClusters(clusterKeys);
          for (std::size_t i = 0; i < clusters.size(); ++i) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
             // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
@@ -120,6 +230,37 @@ void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
    } // while (true)
 }
 
+std::vector<std::unique_ptr<ROOT::Experimental::Internal::RCluster>>
+ROOT::Experimental::Internal::RClusterPool::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+{
+   R__TRACE_SCOPE("ntuple", "RClusterPool::LoadClusters");
+   if (!fPageSource.GetReadOptions().GetUseSharedClusterCache())
+      return fPageSource.LoadClusters(clusterKeys);
+   const auto storageId = fPageSource.GetStorageId();
+   if (storageId.empty())
+      return fPageSource.LoadClusters(clusterKeys);
+
+   auto &sharedCache = RSharedClusterCache::Instance();
+   const auto &ntupleName = fPageSource.GetNTupleName();
+   std::vector<std::unique_ptr<RCluster>> clusters(clusterKeys.size());
+   std::vector<RCluster::RKey> missingKeys;
+   std::vector<std::size_t> missingIdx;
+   for (std::size_t i = 0; i < clusterKeys.size(); ++i) {
+      clusters[i] = sharedCache.Get(storageId, ntupleName, clusterKeys[i]);
+      if (!clusters[i]) {
+         missingKeys.emplace_back(clusterKeys[i]);
+         missingIdx.emplace_back(i);
+      }
+   }
+   if (missingKeys.empty())
+      return clusters;
+
+   auto loaded = fPageSource.LoadClusters(missingKeys);
+   for (std::size_t i = 0; i < loaded.size(); ++i)
+      clusters[missingIdx[i]] = sharedCache.Put(storageId, ntupleName, std::move(loaded[i]));
+   return clusters;
+}
+
 ROOT::Experimental::Internal::RCluster *
 ROOT::Experimental::Internal::RClusterPool::FindInPool(DescriptorId_t clusterId) const
 {
@@ -220,8 +361,8 @@ ROOT::Experimental::Internal::RClusterPool::GetCluster(DescriptorId_t clusterId,
       provideInfo.fPhysicalColumnSet = physicalColumns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
-         if (i == fClusterBunchSize)
+      for (DescriptorId_t i = 0, next = clusterId; i < (1 + fMaxBunchesInFlight) * fClusterBunchSize; ++i) {
+         if ((i > 0) && (i % fClusterBunchSize == 0))
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
@@ -58,6 +58,7 @@ ROOT::Experimental::Internal::RColumnElementBase::GetValidBitRange(EColumnType t
    case EColumnType::kSplitUInt16: return std::make_pair(16, 16);
    case EColumnType::kReal32Trunc: return std::make_pair(10, 31);
    case EColumnType::kReal32Quant: return std::make_pair(1, 32);
+   case EColumnType::kIntFOR: return std::make_pair(1, 32);
    default:
       if (type == kTestFutureType)
          return std::make_pair(32, 32);
@@ -99,6 +100,7 @@ std::string ROOT::Experimental::Internal::RColumnElementBase::GetTypeName(EColum
    case EColumnType::kSplitUInt16: return "SplitUInt16";
    case EColumnType::kReal32Trunc: return "Real32Trunc";
    case EColumnType::kReal32Quant: return "Real32Quant";
+   case EColumnType::kIntFOR: return "IntFOR";
    default:
       if (type == kTestFutureType)
          return "TestFutureType";
@@ -143,6 +145,7 @@ ROOT::Experimental::Internal::RColumnElementBase::Generate<void>(EColumnType typ
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<std::uint16_t, EColumnType::kSplitUInt16>>();
    case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>();
    case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>();
+   case EColumnType::kIntFOR: return std::make_unique<RColumnElement<std::int64_t, EColumnType::kIntFOR>>();
    default:
       if (type == kTestFutureType)
          return std::make_unique<RColumnElement<Internal::RTestFutureColumn, kTestFutureType>>();
@@ -13,8 +13,16 @@
 
 #include <bitset>
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <type_traits>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 // NOTE: some tests might define R__LITTLE_ENDIAN to simulate a different-endianness machine
 #ifndef R__LITTLE_ENDIAN
 #ifdef R__BYTESWAP
@@ -115,6 +123,169 @@ inline void ByteSwapIfNecessary(T &value)
 #define ByteSwapIfNecessary(x) ((void)0)
 #endif
 
+// On little-endian machines with 128 bit SIMD registers, split columns of 2, 4, and 8 byte elements are reverted
+// in blocks of 16 elements by a byte transposition made of interleave instructions. SSE2 and NEON are part of the
+// baseline of x86-64 and aarch64, respectively, so that no runtime dispatch is needed.
+#if R__LITTLE_ENDIAN == 1 && (defined(__SSE2__) || (defined(__aarch64__) && defined(__ARM_NEON)))
+#define R__NTUPLE_SIMD_UNSPLIT 1
+
+namespace Simd {
+#if defined(__SSE2__)
+using Vec_t = __m128i;
+inline Vec_t Load(const void *from)
+{
+   return _mm_loadu_si128(reinterpret_cast<const __m128i *>(from));
+}
+inline void Store(void *to, Vec_t v)
+{
+   _mm_storeu_si128(reinterpret_cast<__m128i *>(to), v);
+}
+inline Vec_t ZipLo8(Vec_t a, Vec_t b)
+{
+   return _mm_unpacklo_epi8(a, b);
+}
+inline Vec_t ZipHi8(Vec_t a, Vec_t b)
+{
+   return _mm_unpackhi_epi8(a, b);
+}
+inline Vec_t ZipLo16(Vec_t a, Vec_t b)
+{
+   return _mm_unpacklo_epi16(a, b);
+}
+inline Vec_t ZipHi16(Vec_t a, Vec_t b)
+{
+   return _mm_unpackhi_epi16(a, b);
+}
+inline Vec_t ZipLo32(Vec_t a, Vec_t b)
+{
+   return _mm_unpacklo_epi32(a, b);
+}
+inline Vec_t ZipHi32(Vec_t a, Vec_t b)
+{
+   return _mm_unpackhi_epi32(a, b);
+}
+#else
+using Vec_t = uint8x16_t;
+inline Vec_t Load(const void *from)
+{
+   return vld1q_u8(reinterpret_cast<const std::uint8_t *>(from));
+}
+inline void Store(void *to, Vec_t v)
+{
+   vst1q_u8(reinterpret_cast<std::uint8_t *>(to), v);
+}
+inline Vec_t ZipLo8(Vec_t a, Vec_t b)
+{
+   return vzip1q_u8(a, b);
+}
+inline Vec_t ZipHi8(Vec_t a, Vec_t b)
+{
+   return vzip2q_u8(a, b);
+}
+inline Vec_t ZipLo16(Vec_t a, Vec_t b)
+{
+   return vreinterpretq_u8_u16(vzip1q_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+}
+inline Vec_t ZipHi16(Vec_t a, Vec_t b)
+{
+   return vreinterpretq_u8_u16(vzip2q_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+}
+inline Vec_t ZipLo32(Vec_t a, Vec_t b)
+{
+   return vreinterpretq_u8_u32(vzip1q_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+}
+inline Vec_t ZipHi32(Vec_t a, Vec_t b)
+{
+   return vreinterpretq_u8_u32(vzip2q_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+}
+#endif
+
+/// Reverts the split encoding of 16 elements of size N. The byte `b` of element `i` is read from
+/// `splitArray[b * stride + i]`; the 16 elements are written contiguously to `destination`.
+template <std::size_t N>
+inline void UnsplitBlock16(void *destination, const char *splitArray, std::size_t stride);
+
+template <>
+inline void UnsplitBlock16<2>(void *destination, const char *splitArray, std::size_t stride)
+{
+   const auto r0 = Load(splitArray);
+   const auto r1 = Load(splitArray + stride);
+   auto dst = reinterpret_cast<char *>(destination);
+   Store(dst, ZipLo8(r0, r1));
+   Store(dst + 16, ZipHi8(r0, r1));
+}
+
+template <>
+inline void UnsplitBlock16<4>(void *destination, const char *splitArray, std::size_t stride)
+{
+   const auto r0 = Load(splitArray);
+   const auto r1 = Load(splitArray + stride);
+   const auto r2 = Load(splitArray + 2 * stride);
+   const auto r3 = Load(splitArray + 3 * stride);
+   // Bytes 0-1 and 2-3, respectively, of elements 0-7 (lo) and 8-15 (hi)
+   const auto b01Lo = ZipLo8(r0, r1);
+   const auto b01Hi = ZipHi8(r0, r1);
+   const auto b23Lo = ZipLo8(r2, r3);
+   const auto b23Hi = ZipHi8(r2, r3);
+   auto dst = reinterpret_cast<char *>(destination);
+   Store(dst, ZipLo16(b01Lo, b23Lo));
+   Store(dst + 16, ZipHi16(b01Lo, b23Lo));
+   Store(dst + 32, ZipLo16(b01Hi, b23Hi));
+   Store(dst + 48, ZipHi16(b01Hi, b23Hi));
+}
+
+template <>
+inline void UnsplitBlock16<8>(void *destination, const char *splitArray, std::size_t stride)
+{
+   Vec_t r[8];
+   for (std::size_t b = 0; b < 8; ++b)
+      r[b] = Load(splitArray + b * stride);
+   // Pairs of bytes (0-1, 2-3, 4-5, 6-7) of elements 0-7 (lo) and 8-15 (hi)
+   Vec_t pairLo[4];
+   Vec_t pairHi[4];
+   for (std::size_t p = 0; p < 4; ++p) {
+      pairLo[p] = ZipLo8(r[2 * p], r[2 * p + 1]);
+      pairHi[p] = ZipHi8(r[2 * p], r[2 * p + 1]);
+   }
+   // Bytes 0-3 and 4-7, respectively, of the elements 0-3, 4-7, 8-11, 12-15
+   const Vec_t quadLow[4] = {ZipLo16(pairLo[0], pairLo[1]), ZipHi16(pairLo[0], pairLo[1]),
+                             ZipLo16(pairHi[0], pairHi[1]), ZipHi16(pairHi[0], pairHi[1])};
+   const Vec_t quadHigh[4] = {ZipLo16(pairLo[2], pairLo[3]), ZipHi16(pairLo[2], pairLo[3]),
+                              ZipLo16(pairHi[2], pairHi[3]), ZipHi16(pairHi[2], pairHi[3])};
+   auto dst = reinterpret_cast<char *>(destination);
+   for (std::size_t q = 0; q < 4; ++q) {
+      Store(dst + 32 * q, ZipLo32(quadLow[q], quadHigh[q]));
+      Store(dst + 32 * q + 16, ZipHi32(quadLow[q], quadHigh[q]));
+   }
+}
+} // namespace Simd
+#endif // R__NTUPLE_SIMD_UNSPLIT
+
+/// \brief Reverts the split encoding of `count` elements in blocks of 16, as far as supported by the platform
+///
+/// For every block, `fnBlock(firstIndex, block)` is called with the 16 unsplit elements. Returns the number of
+/// elements that have been unsplit; the remaining elements have to be processed by the caller.
+template <typename SourceT, typename F>
+inline std::size_t UnsplitBlocks(const char *splitArray, std::size_t count, F &&fnBlock)
+{
+   std::size_t i = 0;
+#ifdef R__NTUPLE_SIMD_UNSPLIT
+   constexpr std::size_t N = sizeof(SourceT);
+   if constexpr (N == 2 || N == 4 || N == 8) {
+      alignas(16) SourceT block[16];
+      for (; i + 16 <= count; i += 16) {
+         Simd::UnsplitBlock16<N>(block, splitArray + i, count);
+         fnBlock(i, block);
+      }
+   }
+#else
+   (void)splitArray;
+   (void)count;
+   (void)fnBlock;
+#endif
+   return i;
+}
+
 /// \brief Pack `count` elements into narrower (or wider) type
 ///
 /// Used to convert in-memory elements to smaller column types of comatible types
@@ -174,7 +345,11 @@ inline void CastSplitUnpack(void *destination, const void *source, std::size_t c
    constexpr std::size_t N = sizeof(SourceT);
    auto dst = reinterpret_cast<DestT *>(destination);
    auto splitArray = reinterpret_cast<const char *>(source);
-   for (std::size_t i = 0; i < count; ++i) {
+   auto i = UnsplitBlocks<SourceT>(splitArray, count, [dst](std::size_t first, const SourceT *block) {
+      for (std::size_t j = 0; j < 16; ++j)
+         dst[first + j] = block[j];
+   });
+   for (; i < count; ++i) {
       SourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
          reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
@@ -211,7 +386,11 @@ inline void CastDeltaSplitUnpack(void *destination, const void *source, std::siz
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
+   auto i = UnsplitBlocks<SourceT>(splitArray, count, [dst](std::size_t first, const SourceT *block) {
+      for (std::size_t j = 0; j < 16; ++j)
+         dst[first + j] = (first + j == 0) ? block[j] : dst[first + j - 1] + block[j];
+   });
+   for (; i < count; ++i) {
       SourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
          reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
@@ -251,7 +430,13 @@ inline void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
+   auto i = UnsplitBlocks<USourceT>(splitArray, count, [dst](std::size_t first, const USourceT *block) {
+      for (std::size_t j = 0; j < 16; ++j) {
+         const auto val = block[j];
+         dst[first + j] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
+      }
+   });
+   for (; i < count; ++i) {
       USourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
          reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
@@ -308,6 +493,7 @@ std::unique_ptr<RColumnElementBase> GenerateColumnElementInternal(EColumnType ty
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt16>>();
    case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Trunc>>();
    case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Quant>>();
+   case EColumnType::kIntFOR: return std::make_unique<RColumnElement<CppT, EColumnType::kIntFOR>>();
    default:
       if (type == kTestFutureType)
          return std::make_unique<RColumnElement<CppT, kTestFutureType>>();
@@ -1063,13 +1249,160 @@ class RColumnElement<float, EColumnType::kReal32Quant> : public RColumnElementQu
 template <>
 class RColumnElement<double, EColumnType::kReal32Quant> : public RColumnElementQuantized<double> {};
 
-#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)  \
-   static constexpr std::size_t kSize = sizeof(CppT);           \
-   static constexpr std::size_t kBitsOnStorage = BitsOnStorage; \
-   RColumnElement() : BaseT(kSize, kBitsOnStorage) {}           \
-   bool IsMappable() const final                                \
-   {                                                            \
-      return kIsMappable;                                       \
+/// Computes conservative min/max bounds of the given in-memory values of type T. The conversion of 64bit integers
+/// to double may round to the nearest representable value, so the bounds are widened by one ulp in that case.
+/// NaN values are ignored; if there are no (non-NaN) values, no statistics are returned.
+template <typename T>
+std::optional<std::pair<double, double>> ComputeMinMax(const void *values, std::size_t count)
+{
+   static_assert(std::is_arithmetic_v<T>);
+   auto typedValues = reinterpret_cast<const T *>(values);
+   std::size_t i = 0;
+   if constexpr (std::is_floating_point_v<T>) {
+      while (i < count && std::isnan(typedValues[i]))
+         ++i;
+   }
+   if (i == count)
+      return std::nullopt;
+
+   T min = typedValues[i];
+   T max = typedValues[i];
+   for (++i; i < count; ++i) {
+      // For floating point values, NaN comparisons are false and thus NaNs are skipped
+      min = (typedValues[i] < min) ? typedValues[i] : min;
+      max = (typedValues[i] > max) ? typedValues[i] : max;
+   }
+
+   auto dmin = static_cast<double>(min);
+   auto dmax = static_cast<double>(max);
+   if constexpr (std::is_integral_v<T> && (sizeof(T) > 4)) {
+      dmin = std::nextafter(dmin, -std::numeric_limits<double>::infinity());
+      dmax = std::nextafter(dmax, std::numeric_limits<double>::infinity());
+   }
+   return std::make_pair(dmin, dmax);
+}
+
+/// Statistics are only supported for numeric in-memory types whose on-disk representation keeps the value,
+/// i.e. not for bools / chars, integers stored as bits, and floating point numbers with reduced precision on disk.
+template <typename CppT, std::size_t BitsOnStorage>
+std::optional<std::pair<double, double>> ComputeMinMaxIfLossless(const void *values, std::size_t count)
+{
+   if constexpr (std::is_same_v<CppT, bool> || std::is_same_v<CppT, char> || !std::is_arithmetic_v<CppT>) {
+      return std::nullopt;
+   } else if constexpr (std::is_integral_v<CppT> && (BitsOnStorage > 1)) {
+      return ComputeMinMax<CppT>(values, count);
+   } else if constexpr (std::is_floating_point_v<CppT> && (BitsOnStorage == 8 * sizeof(CppT))) {
+      return ComputeMinMax<CppT>(values, count);
+   } else {
+      return std::nullopt;
+   }
+}
+
+/// Frame-of-reference bit-packing of integers. Every element is stored as the difference to the minimum of the
+/// value range, using `fBitsOnStorage` bits. The value range and the bit width are set by the field.
+template <typename T>
+class RColumnElementIntFOR : public RColumnElementBase {
+   static_assert(std::is_integral_v<T>);
+
+   using Packed_t = std::uint32_t;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(T);
+
+   RColumnElementIntFOR() : RColumnElementBase(kSize, 0) {}
+
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      const auto [minBits, maxBits] = GetValidBitRange(EColumnType::kIntFOR);
+      R__ASSERT(bitsOnStorage >= minBits && bitsOnStorage <= maxBits);
+      fBitsOnStorage = bitsOnStorage;
+   }
+
+   void SetValueRange(double min, double max) final
+   {
+      R__ASSERT(min <= max);
+      R__ASSERT(min >= static_cast<double>(std::numeric_limits<T>::lowest()));
+      R__ASSERT(max <= static_cast<double>(std::numeric_limits<T>::max()));
+      fValueRange = {min, max};
+   }
+
+   bool IsMappable() const final { return kIsMappable; }
+
+   std::optional<std::pair<double, double>> GetMinMax(const void *values, std::size_t count) const final
+   {
+      return ComputeMinMax<T>(values, count);
+   }
+
+   void Pack(void *dst, const void *src, std::size_t count) const final
+   {
+      using namespace ROOT::Experimental;
+
+      auto packed = std::make_unique<Packed_t[]>(count);
+      assert(fValueRange);
+      const auto reference = static_cast<T>(fValueRange->first);
+      const auto upper = static_cast<T>(fValueRange->second);
+      const std::size_t unusedBits = 8 * sizeof(Packed_t) - fBitsOnStorage;
+      auto values = reinterpret_cast<const T *>(src);
+      std::size_t nOutOfRange = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+         nOutOfRange += (values[i] < reference) || (values[i] > upper);
+         const auto delta = static_cast<std::uint64_t>(values[i]) - static_cast<std::uint64_t>(reference);
+         // As for quantized reals, the bits are kept in the MSB because BitPacking::PackBits() drops the LSB
+         packed[i] = static_cast<Packed_t>(delta) << unusedBits;
+      }
+      if (nOutOfRange) {
+         throw RException(R__FAIL(std::to_string(nOutOfRange) +
+                                  " values were found out of range for frame-of-reference packing (range is [" +
+                                  std::to_string(reference) + ", " + std::to_string(upper) + "])"));
+      }
+      Internal::BitPacking::PackBits(dst, packed.get(), count, sizeof(Packed_t), fBitsOnStorage);
+   }
+
+   void Unpack(void *dst, const void *src, std::size_t count) const final
+   {
+      using namespace ROOT::Experimental;
+
+      auto packed = std::make_unique<Packed_t[]>(count);
+      assert(fValueRange);
+      const auto reference = static_cast<std::uint64_t>(static_cast<T>(fValueRange->first));
+      const std::size_t unusedBits = 8 * sizeof(Packed_t) - fBitsOnStorage;
+      Internal::BitPacking::UnpackBits(packed.get(), src, count, sizeof(Packed_t), fBitsOnStorage);
+      auto values = reinterpret_cast<T *>(dst);
+      for (std::size_t i = 0; i < count; ++i) {
+         values[i] = static_cast<T>(reference + (packed[i] >> unusedBits));
+      }
+   }
+};
+
+template <>
+class RColumnElement<std::int8_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::int8_t> {};
+template <>
+class RColumnElement<std::uint8_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::uint8_t> {};
+template <>
+class RColumnElement<std::int16_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::int16_t> {};
+template <>
+class RColumnElement<std::uint16_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::uint16_t> {};
+template <>
+class RColumnElement<std::int32_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::int32_t> {};
+template <>
+class RColumnElement<std::uint32_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::uint32_t> {};
+template <>
+class RColumnElement<std::int64_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::int64_t> {};
+template <>
+class RColumnElement<std::uint64_t, EColumnType::kIntFOR> : public RColumnElementIntFOR<std::uint64_t> {};
+
+#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)                                           \
+   static constexpr std::size_t kSize = sizeof(CppT);                                                    \
+   static constexpr std::size_t kBitsOnStorage = BitsOnStorage;                                          \
+   RColumnElement() : BaseT(kSize, kBitsOnStorage) {}                                                    \
+   bool IsMappable() const final                                                                         \
+   {                                                                                                     \
+      return kIsMappable;                                                                                \
+   }                                                                                                     \
+   std::optional<std::pair<double, double>> GetMinMax(const void *values, std::size_t count) const final \
+   {                                                                                                     \
+      return ComputeMinMaxIfLossless<CppT, kBitsOnStorage>(values, count);                               \
    }
 /// These macros are used to declare `RColumnElement` template specializations below.  Additional arguments can be used
 /// to forward template parameters to the base class, e.g.
@@ -1416,7 +1416,8 @@ template class ROOT::Experimental::RSimpleField<int8_t>;
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::int8_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kInt8}}, {{EColumnType::kUInt8}, {EColumnType::kBit}});
+   static RColumnRepresentations representations({{EColumnType::kInt8}, {EColumnType::kIntFOR}},
+                                                 {{EColumnType::kUInt8}, {EColumnType::kBit}});
    return representations;
 }
 
@@ -1432,7 +1433,8 @@ template class ROOT::Experimental::RSimpleField<uint8_t>;
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::uint8_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kUInt8}}, {{EColumnType::kInt8}, {EColumnType::kBit}});
+   static RColumnRepresentations representations({{EColumnType::kUInt8}, {EColumnType::kIntFOR}},
+                                                 {{EColumnType::kInt8}, {EColumnType::kBit}});
    return representations;
 }
 
@@ -1528,7 +1530,7 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::int16_t>::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitInt16}, {EColumnType::kInt16}},
+      {{EColumnType::kSplitInt16}, {EColumnType::kInt16}, {EColumnType::kIntFOR}},
       {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}, {EColumnType::kBit}});
    return representations;
 }
@@ -1546,7 +1548,7 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::uint16_t>::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}},
+      {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}, {EColumnType::kIntFOR}},
       {{EColumnType::kSplitInt16}, {EColumnType::kInt16}, {EColumnType::kBit}});
    return representations;
 }
@@ -1564,7 +1566,7 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::int32_t>::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitInt32}, {EColumnType::kInt32}},
+      {{EColumnType::kSplitInt32}, {EColumnType::kInt32}, {EColumnType::kIntFOR}},
       {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}, {EColumnType::kBit}});
    return representations;
 }
@@ -1582,7 +1584,7 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::uint32_t>::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}},
+      {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}, {EColumnType::kIntFOR}},
       {{EColumnType::kSplitInt32}, {EColumnType::kInt32}, {EColumnType::kBit}});
    return representations;
 }
@@ -1600,7 +1602,7 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::uint64_t>::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}},
+      {{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}, {EColumnType::kIntFOR}},
       {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kBit}});
    return representations;
 }
@@ -1617,14 +1619,15 @@ template class ROOT::Experimental::RSimpleField<int64_t>;
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RIntegralField<std::int64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}},
-                                                 {{EColumnType::kSplitUInt64},
-                                                  {EColumnType::kUInt64},
-                                                  {EColumnType::kInt32},
-                                                  {EColumnType::kSplitInt32},
-                                                  {EColumnType::kUInt32},
-                                                  {EColumnType::kSplitUInt32},
-                                                  {EColumnType::kBit}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kIntFOR}},
+      {{EColumnType::kSplitUInt64},
+       {EColumnType::kUInt64},
+       {EColumnType::kInt32},
+       {EColumnType::kSplitInt32},
+       {EColumnType::kUInt32},
+       {EColumnType::kSplitUInt32},
+       {EColumnType::kBit}});
    return representations;
 }
 
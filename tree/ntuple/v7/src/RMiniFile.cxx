@@ -34,14 +34,20 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <chrono>
+#include <vector>
 
 #ifdef R__LINUX
 #include <fcntl.h>
+#include <unistd.h>
 #endif
 
 #ifndef R__LITTLE_ENDIAN
@@ -873,6 +879,129 @@ void ROOT::Experimental::Internal::RMiniFileReader::ReadBuffer(void *buffer, siz
 
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+int FSeek64(FILE *stream, std::int64_t offset, int origin)
+{
+#ifdef R__SEEK64
+   return fseeko64(stream, offset, origin);
+#else
+   return fseek(stream, offset, origin);
+#endif
+}
+} // namespace
+
+struct ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::RWriteBehind {
+   /// A full block waiting to be written
+   struct RPendingBlock {
+      unsigned char *fBlock = nullptr;
+      std::uint64_t fOffset = 0;
+   };
+
+   FILE *fFile = nullptr;
+   std::size_t fBlockSize = 0;
+   /// Maximum number of blocks that are queued or being written
+   std::size_t fMaxPending = 1;
+
+   std::mutex fLock;
+   /// Notifies the I/O thread of new blocks and of the end of writing
+   std::condition_variable fCvQueue;
+   /// Notifies the producer of written blocks
+   std::condition_variable fCvWritten;
+   std::deque<RPendingBlock> fQueue;
+   /// Written blocks, zeroed and ready to be reused
+   std::vector<unsigned char *> fFreeBlocks;
+   bool fIsWriting = false;
+   bool fStop = false;
+   /// The first error encountered by the I/O thread, reported by the next Submit() or Drain()
+   std::string fError;
+   std::thread fThread;
+
+   RWriteBehind(FILE *file, std::size_t blockSize, std::size_t maxPending)
+      : fFile(file), fBlockSize(blockSize), fMaxPending(maxPending)
+   {
+      fThread = std::thread(&RWriteBehind::Work, this);
+   }
+   RWriteBehind(const RWriteBehind &other) = delete;
+   RWriteBehind &operator=(const RWriteBehind &other) = delete;
+
+   ~RWriteBehind()
+   {
+      {
+         std::unique_lock<std::mutex> lock(fLock);
+         fStop = true;
+      }
+      fCvQueue.notify_one();
+      fThread.join();
+
+      std::align_val_t blockAlign{kBlockAlign};
+      for (auto block : fFreeBlocks)
+         ::operator delete[](block, blockAlign);
+   }
+
+   void Work()
+   {
+      std::unique_lock<std::mutex> lock(fLock);
+      while (true) {
+         fCvQueue.wait(lock, [this] { return fStop || !fQueue.empty(); });
+         // Pending blocks are written before stopping
+         if (fQueue.empty())
+            return;
+         auto pending = fQueue.front();
+         fQueue.pop_front();
+         fIsWriting = true;
+         lock.unlock();
+
+         std::string error;
+         if (FSeek64(fFile, pending.fOffset, SEEK_SET)) {
+            error = std::string("Seek failed: ") + strerror(errno);
+         } else if (fwrite(pending.fBlock, 1, fBlockSize, fFile) != fBlockSize) {
+            error = std::string("write failed: ") + strerror(errno);
+         }
+         // Null the buffer contents for good measure.
+         memset(pending.fBlock, 0, fBlockSize);
+
+         lock.lock();
+         fIsWriting = false;
+         if (fError.empty())
+            fError = error;
+         fFreeBlocks.emplace_back(pending.fBlock);
+         fCvWritten.notify_one();
+      }
+   }
+
+   /// Queues the full block for writing at the given offset and returns an empty block to continue with. Blocks if
+   /// the maximum number of pending blocks is reached.
+   unsigned char *Submit(unsigned char *block, std::uint64_t offset)
+   {
+      std::unique_lock<std::mutex> lock(fLock);
+      fCvWritten.wait(lock, [this] { return fQueue.size() + fIsWriting < fMaxPending || !fError.empty(); });
+      if (!fError.empty())
+         throw RException(R__FAIL(fError));
+      fQueue.push_back({block, offset});
+      fCvQueue.notify_one();
+
+      if (!fFreeBlocks.empty()) {
+         auto result = fFreeBlocks.back();
+         fFreeBlocks.pop_back();
+         return result;
+      }
+      lock.unlock();
+      std::align_val_t blockAlign{kBlockAlign};
+      auto result = static_cast<unsigned char *>(::operator new[](fBlockSize, blockAlign));
+      memset(result, 0, fBlockSize);
+      return result;
+   }
+
+   /// Waits until all queued blocks are written
+   void Drain()
+   {
+      std::unique_lock<std::mutex> lock(fLock);
+      fCvWritten.wait(lock, [this] { return fQueue.empty() && !fIsWriting; });
+      if (!fError.empty())
+         throw RException(R__FAIL(fError));
+   }
+};
+
 ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::RFileSimple() = default;
 
 void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::AllocateBuffers(std::size_t bufferSize)
@@ -889,8 +1018,17 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::AllocateBuffe
    memset(fBlock, 0, fBlockSize);
 }
 
+void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::StartWriteBehind(std::size_t maxQueuedBytes)
+{
+   R__ASSERT(fFile && fBlock && !fWriteBehind);
+   const auto maxPending = std::max<std::size_t>(1, maxQueuedBytes / fBlockSize);
+   fWriteBehind = std::make_unique<RWriteBehind>(fFile, fBlockSize, maxPending);
+}
+
 ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::~RFileSimple()
 {
+   // Finish pending writes before closing the file
+   fWriteBehind.reset();
    if (fFile)
       fclose(fFile);
 
@@ -901,19 +1039,11 @@ ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::~RFileSimple()
       ::operator delete[](fBlock, blockAlign);
 }
 
-namespace {
-int FSeek64(FILE *stream, std::int64_t offset, int origin)
-{
-#ifdef R__SEEK64
-   return fseeko64(stream, offset, origin);
-#else
-   return fseek(stream, offset, origin);
-#endif
-}
-} // namespace
-
 void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Flush()
 {
+   if (fWriteBehind)
+      fWriteBehind->Drain();
+
    // Write the last partially filled block, which may still need appropriate alignment for Direct I/O.
    // If it is the first block, get the updated header block.
    if (fBlockOffset == 0) {
@@ -980,17 +1110,22 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Write(const v
       std::uint64_t posInBlock = fFilePos % fBlockSize;
       std::uint64_t blockOffset = fFilePos - posInBlock;
       if (blockOffset != fBlockOffset) {
-         // Write the block.
-         retval = FSeek64(fFile, fBlockOffset, SEEK_SET);
-         if (retval)
-            throw RException(R__FAIL(std::string("Seek failed: ") + strerror(errno)));
+         if (fWriteBehind) {
+            // The I/O thread writes the block and nulls its contents.
+            fBlock = fWriteBehind->Submit(fBlock, fBlockOffset);
+         } else {
+            // Write the block.
+            retval = FSeek64(fFile, fBlockOffset, SEEK_SET);
+            if (retval)
+               throw RException(R__FAIL(std::string("Seek failed: ") + strerror(errno)));
 
-         retval = fwrite(fBlock, 1, fBlockSize, fFile);
-         if (retval != fBlockSize)
-            throw RException(R__FAIL(std::string("write failed: ") + strerror(errno)));
+            retval = fwrite(fBlock, 1, fBlockSize, fFile);
+            if (retval != fBlockSize)
+               throw RException(R__FAIL(std::string("write failed: ") + strerror(errno)));
 
-         // Null the buffer contents for good measure.
-         memset(fBlock, 0, fBlockSize);
+            // Null the buffer contents for good measure.
+            memset(fBlock, 0, fBlockSize);
+         }
       }
 
       fBlockOffset = blockOffset;
@@ -1122,6 +1257,8 @@ ROOT::Experimental::Internal::RNTupleFileWriter::Recreate(std::string_view ntupl
    writer->fFileSimple.fFile = fileStream;
    writer->fFileSimple.fDirectIO = options.GetUseDirectIO();
    writer->fFileSimple.AllocateBuffers(options.GetWriteBufferSize());
+   if (options.GetUseWriteBehind())
+      writer->fFileSimple.StartWriteBehind(options.GetPageBufferBudget());
    writer->fFileName = fileName;
 
    int defaultCompression = options.GetCompression();
@@ -1301,6 +1438,57 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::WriteIntoReservedBlob(cons
    }
 }
 
+std::pair<std::uint64_t, ROOT::Experimental::Internal::RNTupleFileWriter::RUnbufferedRange>
+ROOT::Experimental::Internal::RNTupleFileWriter::ReserveBlobWithUnbufferedRange(size_t nbytes, size_t len)
+{
+   const std::uint64_t offset = ReserveBlob(nbytes, len);
+   RUnbufferedRange range;
+#ifdef R__LINUX
+   if (fFileSimple) {
+      const std::uint64_t blockSize = fFileSimple.fBlockSize;
+      // The range needs to start after the currently buffered block, which may contain the key header
+      auto first = ((offset + blockSize - 1) / blockSize) * blockSize;
+      first = std::max(first, fFileSimple.fBlockOffset + blockSize);
+      const auto last = ((offset + nbytes) / blockSize) * blockSize;
+      if (last > first) {
+         range.fOffset = first;
+         range.fSize = last - first;
+      }
+   }
+#endif
+   return {offset, range};
+}
+
+void ROOT::Experimental::Internal::RNTupleFileWriter::WriteUnbuffered(const void *buffer, size_t nbytes,
+                                                                      std::uint64_t offset) const
+{
+#ifdef R__LINUX
+   R__ASSERT(fFileSimple);
+   const int fd = fileno(fFileSimple.fFile);
+   auto pos = static_cast<const unsigned char *>(buffer);
+   while (nbytes > 0) {
+#ifdef R__SEEK64
+      auto retval = pwrite64(fd, pos, nbytes, offset);
+#else
+      auto retval = pwrite(fd, pos, nbytes, offset);
+#endif
+      if (retval < 0) {
+         if (errno == EINTR)
+            continue;
+         throw RException(R__FAIL(std::string("write failed: ") + strerror(errno)));
+      }
+      pos += retval;
+      nbytes -= retval;
+      offset += retval;
+   }
+#else
+   (void)buffer;
+   (void)nbytes;
+   (void)offset;
+   throw RException(R__FAIL("unbuffered writes are not supported on this platform"));
+#endif
+}
+
 std::uint64_t
 ROOT::Experimental::Internal::RNTupleFileWriter::WriteNTupleHeader(const void *data, size_t nbytes, size_t lenHeader)
 {
@@ -583,6 +583,21 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RClusterDescript
    return RResult<void>::Success();
 }
 
+ROOT::Experimental::RResult<void>
+ROOT::Experimental::Internal::RClusterDescriptorBuilder::SetColumnRangeMinMax(DescriptorId_t physicalId, double min,
+                                                                              double max)
+{
+   auto itr = fCluster.fColumnRanges.find(physicalId);
+   if (itr == fCluster.fColumnRanges.end())
+      return R__FAIL("unknown column ID");
+   if (itr->second.fIsSuppressed)
+      return R__FAIL("suppressed columns cannot have statistics");
+   if (!(min <= max))
+      return R__FAIL("invalid column statistics: min > max");
+   itr->second.fMinMax = {min, max};
+   return RResult<void>::Success();
+}
+
 ROOT::Experimental::RResult<void>
 ROOT::Experimental::Internal::RClusterDescriptorBuilder::MarkSuppressedColumnRange(DescriptorId_t physicalId)
 {
@@ -14,6 +14,16 @@
  *************************************************************************/
 
 #include <ROOT/RNTupleIndex.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleWriter.hxx>
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
+#endif
+
+#include <algorithm>
+#include <utility>
 
 namespace {
 ROOT::Experimental::Internal::RNTupleIndex::NTupleIndexValue_t
@@ -33,15 +43,14 @@ CastValuePtr(void *valuePtr, const ROOT::Experimental::RFieldBase &field)
 }
 } // anonymous namespace
 
-ROOT::Experimental::Internal::RNTupleIndex::RNTupleIndex(const std::vector<std::string> &fieldNames,
-                                                         const RPageSource &pageSource)
-   : fPageSource(pageSource.Clone())
+std::vector<std::unique_ptr<ROOT::Experimental::RFieldBase>>
+ROOT::Experimental::Internal::RNTupleIndex::CreateIndexFields(const std::vector<std::string> &fieldNames,
+                                                              RPageSource &pageSource)
 {
-   fPageSource->Attach();
-   auto desc = fPageSource->GetSharedDescriptorGuard();
-
-   fIndexFields.reserve(fieldNames.size());
+   std::vector<std::unique_ptr<RFieldBase>> fields;
+   fields.reserve(fieldNames.size());
 
+   auto desc = pageSource.GetSharedDescriptorGuard();
    for (const auto &fieldName : fieldNames) {
       auto fieldId = desc->FindFieldId(fieldName);
       if (fieldId == kInvalidDescriptorId)
@@ -50,10 +59,28 @@ ROOT::Experimental::Internal::RNTupleIndex::RNTupleIndex(const std::vector<std::
       const auto &fieldDesc = desc->GetFieldDescriptor(fieldId);
       auto field = fieldDesc.CreateField(desc.GetRef());
 
-      CallConnectPageSourceOnField(*field, *fPageSource);
+      CallConnectPageSourceOnField(*field, pageSource);
 
-      fIndexFields.push_back(std::move(field));
+      fields.push_back(std::move(field));
    }
+   return fields;
+}
+
+ROOT::Experimental::Internal::RNTupleIndex::RNTupleIndex(const std::vector<std::string> &fieldNames,
+                                                         const RPageSource &pageSource)
+   : fPageSource(pageSource.Clone()), fIndexFieldNames(fieldNames)
+{
+   fPageSource->Attach();
+   fIndexFields = CreateIndexFields(fieldNames, *fPageSource);
+}
+
+std::string ROOT::Experimental::Internal::RNTupleIndex::GetPersistentName(std::string_view ntupleName,
+                                                                         const std::vector<std::string> &fieldNames)
+{
+   std::string name = std::string(ntupleName) + "__index";
+   for (const auto &fieldName : fieldNames)
+      name += "__" + fieldName;
+   return name;
 }
 
 void ROOT::Experimental::Internal::RNTupleIndex::EnsureBuilt() const
@@ -74,6 +101,113 @@ ROOT::Experimental::Internal::RNTupleIndex::Create(const std::vector<std::string
    return index;
 }
 
+std::unique_ptr<ROOT::Experimental::Internal::RNTupleIndex>
+ROOT::Experimental::Internal::RNTupleIndex::Open(const std::vector<std::string> &fieldNames,
+                                                 const RPageSource &pageSource, std::string_view storage)
+{
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(fieldNames, pageSource));
+
+   index->fPersistentSource = RPageSource::Create(GetPersistentName(pageSource.GetNTupleName(), fieldNames), storage);
+   index->fPersistentSource->Attach();
+   auto desc = index->fPersistentSource->GetSharedDescriptorGuard();
+
+   auto fnConnectField = [&](const std::string &name, const std::string &expectedDescription) {
+      auto fieldId = desc->FindFieldId(name);
+      if (fieldId == kInvalidDescriptorId)
+         throw RException(R__FAIL("invalid persistent index: missing field \"" + name + "\""));
+      const auto &fieldDesc = desc->GetFieldDescriptor(fieldId);
+      if (fieldDesc.GetFieldDescription() != expectedDescription) {
+         throw RException(R__FAIL("invalid persistent index: field \"" + name + "\" indexes \"" +
+                                  fieldDesc.GetFieldDescription() + "\" instead of \"" + expectedDescription + "\""));
+      }
+      auto field = fieldDesc.CreateField(desc.GetRef());
+      CallConnectPageSourceOnField(*field, *index->fPersistentSource);
+      return field;
+   };
+
+   for (std::size_t i = 0; i < fieldNames.size(); ++i) {
+      index->fPersistentKeyFields.emplace_back(fnConnectField("key" + std::to_string(i), fieldNames[i]));
+      index->fPersistentKeyValues.emplace_back(index->fPersistentKeyFields.back()->CreateValue());
+   }
+   if (desc->FindFieldId("key" + std::to_string(fieldNames.size())) != kInvalidDescriptorId)
+      throw RException(R__FAIL("invalid persistent index: number of indexed fields does not match"));
+   index->fPersistentEntriesField = fnConnectField("entries", "");
+   index->fPersistentEntriesValue =
+      std::make_unique<RFieldBase::RValue>(index->fPersistentEntriesField->CreateValue());
+
+   index->fIsBuilt = true;
+   return index;
+}
+
+void ROOT::Experimental::Internal::RNTupleIndex::Write(TFile &file) const
+{
+   EnsureBuilt();
+   if (fPersistentSource)
+      throw RException(R__FAIL("an index opened from its persistent representation cannot be written again"));
+
+   // Sort the index values lexicographically, which is the order that LookupPersistent() relies on
+   std::vector<const decltype(fIndex)::value_type *> sortedValues;
+   sortedValues.reserve(fIndex.size());
+   for (const auto &kv : fIndex)
+      sortedValues.emplace_back(&kv);
+   std::sort(sortedValues.begin(), sortedValues.end(),
+             [](const auto *a, const auto *b) { return a->first.fFieldValues < b->first.fFieldValues; });
+
+   auto model = RNTupleModel::Create();
+   std::vector<std::shared_ptr<NTupleIndexValue_t>> keyPtrs;
+   for (std::size_t i = 0; i < fIndexFieldNames.size(); ++i) {
+      keyPtrs.emplace_back(model->MakeField<NTupleIndexValue_t>({"key" + std::to_string(i), fIndexFieldNames[i]}));
+   }
+   auto entriesPtr = model->MakeField<std::vector<NTupleSize_t>>("entries");
+
+   auto writer =
+      RNTupleWriter::Append(std::move(model), GetPersistentName(fPageSource->GetNTupleName(), fIndexFieldNames), file);
+   for (const auto *kv : sortedValues) {
+      for (std::size_t i = 0; i < keyPtrs.size(); ++i)
+         *keyPtrs[i] = kv->first.fFieldValues[i];
+      *entriesPtr = kv->second;
+      writer->Fill();
+   }
+}
+
+const std::vector<ROOT::Experimental::NTupleSize_t> *
+ROOT::Experimental::Internal::RNTupleIndex::LookupPersistent(const RIndexValue &indexValue) const
+{
+   auto itrMemo = fPersistentLookups.find(indexValue);
+   if (itrMemo != fPersistentLookups.end())
+      return &(itrMemo->second);
+
+   // Compares the key stored at the given entry of the persistent index with the searched index value
+   auto fnCompare = [&](NTupleSize_t entry) -> int {
+      for (std::size_t i = 0; i < fPersistentKeyValues.size(); ++i) {
+         fPersistentKeyValues[i].Read(entry);
+         const auto key = *fPersistentKeyValues[i].GetPtr<NTupleIndexValue_t>();
+         if (key < indexValue.fFieldValues[i])
+            return -1;
+         if (key > indexValue.fFieldValues[i])
+            return 1;
+      }
+      return 0;
+   };
+
+   const auto nKeys = fPersistentSource->GetNEntries();
+   NTupleSize_t lo = 0;
+   NTupleSize_t hi = nKeys;
+   while (lo < hi) {
+      const auto mid = lo + (hi - lo) / 2;
+      if (fnCompare(mid) < 0)
+         lo = mid + 1;
+      else
+         hi = mid;
+   }
+   if (lo == nKeys || fnCompare(lo) != 0)
+      return nullptr;
+
+   fPersistentEntriesValue->Read(lo);
+   auto result = fPersistentLookups.emplace(indexValue, *fPersistentEntriesValue->GetPtr<std::vector<NTupleSize_t>>());
+   return &(result.first->second);
+}
+
 void ROOT::Experimental::Internal::RNTupleIndex::Build()
 {
    if (fIsBuilt)
@@ -83,21 +217,85 @@ void ROOT::Experimental::Internal::RNTupleIndex::Build()
                                                                 "std::int64_t",  "std::uint8_t", "std::uint16_t",
                                                                 "std::uint32_t", "std::uint64_t"};
 
-   std::vector<RFieldBase::RValue> fieldValues;
-   fieldValues.reserve(fIndexFields.size());
-
    for (const auto &field : fIndexFields) {
       if (allowedTypes.find(field->GetTypeName()) == allowedTypes.end()) {
          throw RException(R__FAIL("Cannot use field \"" + field->GetFieldName() + "\" with type \"" +
                                   field->GetTypeName() + "\" for indexing. Only integral types are allowed."));
       }
-      fieldValues.emplace_back(field->CreateValue());
    }
 
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      // Split the entries in cluster-aligned ranges of roughly equal size, a few per worker for load balancing
+      std::vector<std::pair<NTupleSize_t, NTupleSize_t>> ranges;
+      {
+         ROOT::TThreadExecutor pool;
+         const auto nEntries = fPageSource->GetNEntries();
+         const auto nTargetRanges = 4 * static_cast<NTupleSize_t>(pool.GetPoolSize());
+         const auto targetRangeSize = std::max<NTupleSize_t>(1, nEntries / std::max<NTupleSize_t>(1, nTargetRanges));
+
+         std::vector<std::pair<NTupleSize_t, NTupleSize_t>> clusterRanges;
+         {
+            auto desc = fPageSource->GetSharedDescriptorGuard();
+            for (const auto &clusterDesc : desc->GetClusterIterable()) {
+               const auto first = clusterDesc.GetFirstEntryIndex();
+               clusterRanges.emplace_back(first, first + clusterDesc.GetNEntries());
+            }
+         }
+         std::sort(clusterRanges.begin(), clusterRanges.end());
+         for (const auto &range : clusterRanges) {
+            if (!ranges.empty() && (ranges.back().second == range.first) &&
+                (ranges.back().second - ranges.back().first < targetRangeSize)) {
+               ranges.back().second = range.second;
+            } else {
+               ranges.emplace_back(range);
+            }
+         }
+
+         if (ranges.size() > 1) {
+            std::vector<IndexMap_t> partialIndexes(ranges.size());
+            pool.Foreach(
+               [&](std::size_t i) {
+                  auto source = fPageSource->Clone();
+                  source->Attach();
+                  auto fields = CreateIndexFields(fIndexFieldNames, *source);
+                  FillIndex(fields, ranges[i].first, ranges[i].second, partialIndexes[i]);
+               },
+               ROOT::TSeq<std::size_t>(ranges.size()));
+
+            // The ranges are ordered, so appending the partial results keeps the entry numbers sorted
+            for (auto &partialIndex : partialIndexes) {
+               for (auto &[indexValue, entries] : partialIndex) {
+                  auto &target = fIndex[indexValue];
+                  target.insert(target.end(), entries.begin(), entries.end());
+               }
+               IndexMap_t().swap(partialIndex);
+            }
+            fIsBuilt = true;
+            return;
+         }
+      }
+   }
+#endif
+
+   FillIndex(fIndexFields, 0, fPageSource->GetNEntries(), fIndex);
+
+   fIsBuilt = true;
+}
+
+void ROOT::Experimental::Internal::RNTupleIndex::FillIndex(std::vector<std::unique_ptr<RFieldBase>> &fields,
+                                                           NTupleSize_t firstEntry, NTupleSize_t lastEntry,
+                                                           IndexMap_t &index)
+{
+   std::vector<RFieldBase::RValue> fieldValues;
+   fieldValues.reserve(fields.size());
+   for (const auto &field : fields)
+      fieldValues.emplace_back(field->CreateValue());
+
    std::vector<NTupleIndexValue_t> indexValues;
-   indexValues.reserve(fIndexFields.size());
+   indexValues.reserve(fields.size());
 
-   for (unsigned i = 0; i < fPageSource->GetNEntries(); ++i) {
+   for (auto i = firstEntry; i < lastEntry; ++i) {
       indexValues.clear();
       for (auto &fieldValue : fieldValues) {
          // TODO(fdegeus): use bulk reading
@@ -106,10 +304,8 @@ void ROOT::Experimental::Internal::RNTupleIndex::Build()
          auto valuePtr = fieldValue.GetPtr<void>();
          indexValues.push_back(CastValuePtr(valuePtr.get(), fieldValue.GetField()));
       }
-      fIndex[RIndexValue(indexValues)].push_back(i);
+      index[RIndexValue(indexValues)].push_back(i);
    }
-
-   fIsBuilt = true;
 }
 
 ROOT::Experimental::NTupleSize_t
@@ -136,6 +332,9 @@ ROOT::Experimental::Internal::RNTupleIndex::GetAllEntryNumbers(const std::vector
       indexValues.push_back(CastValuePtr(valuePtrs[i], *fIndexFields[i]));
    }
 
+   if (fPersistentSource)
+      return LookupPersistent(RIndexValue(indexValues));
+
    auto entryNumber = fIndex.find(RIndexValue(indexValues));
 
    if (entryNumber == fIndex.end())
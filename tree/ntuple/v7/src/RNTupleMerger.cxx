@@ -26,6 +26,7 @@
 #include <ROOT/RNTupleSerialize.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RColumnElementBase.hxx>
+#include <ROOT/TTaskGroup.hxx>
 #include <TROOT.h>
 #include <TFileMergeInfo.h>
 #include <TError.h>
@@ -219,6 +220,11 @@ struct RSealedPageMergeData {
    std::deque<RPageStorage::SealedPageSequence_t> fPagesV;
    std::vector<RPageStorage::RSealedPageGroup> fGroups;
    std::vector<std::unique_ptr<std::uint8_t[]>> fBuffers;
+   // The column elements used by the compression tasks
+   std::vector<std::unique_ptr<RColumnElementBase>> fColumnElements;
+   // With IMT, the compression tasks of the cluster. Declared last so that it waits for the tasks to finish before
+   // the other members are destructed.
+   std::optional<TTaskGroup> fTaskGroup;
 };
 } // namespace ROOT::Experimental::Internal
 
@@ -389,13 +395,17 @@ void RNTupleMerger::MergeCommonColumns(RClusterPool &clusterPool, DescriptorId_t
       R__ASSERT(clusterDesc.ContainsColumn(columnId));
 
       const auto &columnDesc = mergeData.fSrcDescriptor->GetColumnDescriptor(columnId);
-      const auto srcColElement = RColumnElementBase::Generate(columnDesc.GetType());
-      const auto dstColElement = RColumnElementBase::Generate(column.fColumnType);
+      // The elements need to outlive the compression tasks
+      const auto &srcColElement =
+         *sealedPageData.fColumnElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetType()));
+      const auto &dstColElement =
+         *sealedPageData.fColumnElements.emplace_back(RColumnElementBase::Generate(column.fColumnType));
 
       // Now get the pages for this column in this cluster
       const auto &pages = clusterDesc.GetPageRange(columnId);
 
-      RPageStorage::SealedPageSequence_t sealedPages;
+      // The compression tasks write into the sealed pages, so create them at their final place
+      RPageStorage::SealedPageSequence_t &sealedPages = sealedPageData.fPagesV.emplace_back();
       sealedPages.resize(pages.fPageInfos.size());
 
       // Each column range potentially has a distinct compression settings
@@ -433,16 +443,17 @@ void RNTupleMerger::MergeCommonColumns(RClusterPool &clusterPool, DescriptorId_t
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == sealedPage.GetBufferSize()));
 
          if (needsCompressionChange) {
-            const auto uncompressedSize = srcColElement->GetSize() * sealedPage.GetNElements();
+            const auto uncompressedSize = srcColElement.GetSize() * sealedPage.GetNElements();
             auto &buffer = sealedPageData.fBuffers[pageBufferBaseIdx + pageIdx];
             buffer = std::make_unique<std::uint8_t[]>(uncompressedSize + checksumSize);
             RChangeCompressionFunc compressTask{
-               column.fOutputId, *srcColElement, *dstColElement, mergeData.fMergeOpts,
+               column.fOutputId, srcColElement, dstColElement, mergeData.fMergeOpts,
                sealedPage,       *fPageAlloc,    buffer.get(),
             };
 
-            if (fTaskGroup)
-               fTaskGroup->Run(compressTask);
+            // With IMT, the tasks are only waited for when the cluster is committed
+            if (sealedPageData.fTaskGroup)
+               sealedPageData.fTaskGroup->Run(compressTask);
             else
                compressTask();
          }
@@ -451,12 +462,7 @@ void RNTupleMerger::MergeCommonColumns(RClusterPool &clusterPool, DescriptorId_t
 
       } // end of loop over pages
 
-      if (fTaskGroup)
-         fTaskGroup->Wait();
-
-      sealedPageData.fPagesV.push_back(std::move(sealedPages));
-      sealedPageData.fGroups.emplace_back(column.fOutputId, sealedPageData.fPagesV.back().cbegin(),
-                                          sealedPageData.fPagesV.back().cend());
+      sealedPageData.fGroups.emplace_back(column.fOutputId, sealedPages.cbegin(), sealedPages.cend());
    } // end loop over common columns
 }
 
@@ -538,7 +544,11 @@ static void GenerateExtraDstColumns(size_t nClusterEntries, std::span<RColumnInf
 void RNTupleMerger::MergeSourceClusters(RPageSource &source, std::span<RColumnInfo> commonColumns,
                                         std::span<RColumnInfo> extraDstColumns, RNTupleMergeData &mergeData)
 {
-   RClusterPool clusterPool{source};
+   // With IMT, the pages of several clusters are recompressed concurrently. The clusters are committed in order
+   // from a bounded queue, such that the cluster pool has to keep the clusters in the queue alive.
+   const unsigned int maxClustersInFlight = fUseIMT ? std::max(1u, mergeData.fMergeOpts.fMaxClustersInFlight) : 1;
+   RClusterPool clusterPool{source, RClusterPool::kDefaultClusterBunchSize, RClusterPool::kDefaultMaxBunchesInFlight,
+                            maxClustersInFlight - 1};
 
    // Convert columns to a ColumnSet for the ClusterPool query
    RCluster::ColumnSet_t commonColumnSet;
@@ -554,13 +564,38 @@ void RNTupleMerger::MergeSourceClusters(RPageSource &source, std::span<RColumnIn
    // Loop over all clusters in this file.
    // descriptor->GetClusterIterable() doesn't guarantee any specific order, so we explicitly
    // request the first cluster.
+   struct RClusterInFlight {
+      NTupleSize_t fNEntries = 0;
+      RSealedPageMergeData fSealedPageData;
+   };
+   std::deque<RClusterInFlight> clustersInFlight;
+   auto fnCommitOldestCluster = [&]() {
+      auto &oldest = clustersInFlight.front();
+      if (oldest.fSealedPageData.fTaskGroup)
+         oldest.fSealedPageData.fTaskGroup->Wait();
+
+      // Commit the pages and the clusters
+      mergeData.fDestination.CommitSealedPageV(oldest.fSealedPageData.fGroups);
+      mergeData.fDestination.CommitCluster(oldest.fNEntries);
+      mergeData.fNumDstEntries += oldest.fNEntries;
+      clustersInFlight.pop_front();
+   };
+
    DescriptorId_t clusterId = mergeData.fSrcDescriptor->FindClusterId(0, 0);
    while (clusterId != kInvalidDescriptorId) {
       const auto &clusterDesc = mergeData.fSrcDescriptor->GetClusterDescriptor(clusterId);
       const auto nClusterEntries = clusterDesc.GetNEntries();
       R__ASSERT(nClusterEntries > 0);
 
-      RSealedPageMergeData sealedPageData;
+      // Make room before requesting the next cluster from the pool, which releases clusters beyond its window
+      if (clustersInFlight.size() == maxClustersInFlight)
+         fnCommitOldestCluster();
+
+      auto &clusterInFlight = clustersInFlight.emplace_back();
+      clusterInFlight.fNEntries = nClusterEntries;
+      RSealedPageMergeData &sealedPageData = clusterInFlight.fSealedPageData;
+      if (fUseIMT)
+         sealedPageData.fTaskGroup.emplace();
 
       if (!commonColumnSet.empty()) {
          MergeCommonColumns(clusterPool, clusterId, commonColumns, commonColumnSet, sealedPageData, mergeData);
@@ -570,14 +605,11 @@ void RNTupleMerger::MergeSourceClusters(RPageSource &source, std::span<RColumnIn
          GenerateExtraDstColumns(nClusterEntries, extraDstColumns, sealedPageData, mergeData);
       }
 
-      // Commit the pages and the clusters
-      mergeData.fDestination.CommitSealedPageV(sealedPageData.fGroups);
-      mergeData.fDestination.CommitCluster(nClusterEntries);
-      mergeData.fNumDstEntries += nClusterEntries;
-
       // Go to the next cluster
       clusterId = mergeData.fSrcDescriptor->FindNextClusterId(clusterId);
    }
+   while (!clustersInFlight.empty())
+      fnCommitOldestCluster();
 
    // TODO(gparolini): when we get serious about huge file support (>~ 100GB) we might want to check here
    // the size of the running page list and commit a cluster group when it exceeds some threshold,
@@ -655,8 +687,7 @@ RNTupleMerger::RNTupleMerger()
    : fPageAlloc(std::make_unique<RPageAllocatorHeap>())
 {
 #ifdef R__USE_IMT
-   if (ROOT::IsImplicitMTEnabled())
-      fTaskGroup = TTaskGroup();
+   fUseIMT = ROOT::IsImplicitMTEnabled();
 #endif
 }
 
@@ -15,10 +15,39 @@
 
 #include <ROOT/RNTupleMetrics.hxx>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <ostream>
+#include <sstream>
 
 #include <iostream>
 
+namespace {
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   result.reserve(str.size());
+   for (char c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            result += buf;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RNTuplePerfCounter::~RNTuplePerfCounter()
 {
 }
@@ -78,6 +107,44 @@ void ROOT::Experimental::Detail::RNTupleMetrics::Print(std::ostream &output, con
    }
 }
 
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintJSONCounters(std::ostream &output, const std::string &prefix,
+                                                                   bool &isFirst) const
+{
+   if (!fIsEnabled)
+      return;
+
+   for (const auto &c : fCounters) {
+      if (!isFirst)
+         output << ", ";
+      isFirst = false;
+      output << "{\"name\": \"" << EscapeJSON(prefix + fName + kNamespaceSeperator + c->GetName()) << "\", ";
+      output << "\"unit\": \"" << EscapeJSON(c->GetUnit()) << "\", ";
+      output << "\"description\": \"" << EscapeJSON(c->GetDescription()) << "\", ";
+      output << "\"value\": ";
+      if (auto calcPerf = dynamic_cast<const RNTupleCalcPerf *>(c.get())) {
+         const auto value = calcPerf->GetValue();
+         if (std::isfinite(value))
+            output << value;
+         else
+            output << "null";
+      } else {
+         output << c->GetValueAsInt();
+      }
+      output << "}";
+   }
+   for (const auto m : fObservedMetrics) {
+      m->PrintJSONCounters(output, prefix + fName + kNamespaceSeperator, isFirst);
+   }
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintJSON(std::ostream &output) const
+{
+   output << "{\"name\": \"" << EscapeJSON(fName) << "\", \"counters\": [";
+   bool isFirst = true;
+   PrintJSONCounters(output, "", isFirst);
+   output << "]}";
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::Enable()
 {
    for (auto &c: fCounters)
@@ -91,3 +158,87 @@ void ROOT::Experimental::Detail::RNTupleMetrics::ObserveMetrics(RNTupleMetrics &
 {
    fObservedMetrics.push_back(&observee);
 }
+
+ROOT::Experimental::Detail::RNTupleMetricsRegistry &ROOT::Experimental::Detail::RNTupleMetricsRegistry::Instance()
+{
+   static RNTupleMetricsRegistry registry;
+   return registry;
+}
+
+ROOT::Experimental::Detail::RNTupleMetricsRegistry::~RNTupleMetricsRegistry()
+{
+   ResetPushCallback();
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsRegistry::Register(const RNTupleMetrics &metrics)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fMetrics.emplace_back(&metrics);
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsRegistry::Unregister(const RNTupleMetrics &metrics)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itr = std::find(fMetrics.begin(), fMetrics.end(), &metrics);
+   if (itr != fMetrics.end())
+      fMetrics.erase(itr);
+}
+
+std::string ROOT::Experimental::Detail::RNTupleMetricsRegistry::MakeSnapshot() const
+{
+   const auto timestamp =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+   std::ostringstream output;
+   output << "{\"timestamp\": " << timestamp.count() << ", \"metrics\": [";
+   for (std::size_t i = 0; i < fMetrics.size(); ++i) {
+      if (i > 0)
+         output << ", ";
+      fMetrics[i]->PrintJSON(output);
+   }
+   output << "]}";
+   return output.str();
+}
+
+std::string ROOT::Experimental::Detail::RNTupleMetricsRegistry::GetSnapshotJSON()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return MakeSnapshot();
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsRegistry::ExecPush()
+{
+   std::unique_lock<std::mutex> lock(fLock);
+   while (true) {
+      if (fCvStopPush.wait_for(lock, fPushInterval, [this] { return fStopPush; }))
+         return;
+      auto snapshot = MakeSnapshot();
+      // Don't block readers and writers while the callback runs
+      lock.unlock();
+      fPushCallback(snapshot);
+      lock.lock();
+   }
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsRegistry::SetPushCallback(PushCallback_t callback,
+                                                                        std::chrono::milliseconds interval)
+{
+   ResetPushCallback();
+   std::lock_guard<std::mutex> guard(fLock);
+   fPushCallback = std::move(callback);
+   fPushInterval = interval;
+   fStopPush = false;
+   fPushThread = std::thread(&RNTupleMetricsRegistry::ExecPush, this);
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsRegistry::ResetPushCallback()
+{
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      if (!fPushThread.joinable())
+         return;
+      fStopPush = true;
+   }
+   fCvStopPush.notify_one();
+   fPushThread.join();
+   fPushCallback = nullptr;
+}
@@ -97,6 +97,10 @@ public:
    {
       fInnerSink->CommitSealedPageV(ranges);
    }
+   std::function<void()> CommitSealedPageVDeferred(std::span<RPageStorage::RSealedPageGroup> ranges) final
+   {
+      return fInnerSink->CommitSealedPageVDeferred(ranges);
+   }
    std::uint64_t CommitCluster(NTupleSize_t nNewEntries) final { return fInnerSink->CommitCluster(nNewEntries); }
    RStagedCluster StageCluster(NTupleSize_t nNewEntries) final { return fInnerSink->StageCluster(nNewEntries); }
    void CommitStagedClusters(std::span<RStagedCluster> clusters) final { fInnerSink->CommitStagedClusters(clusters); }
@@ -121,10 +125,12 @@ ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr
    fModel->Freeze();
    fSink->Init(*fModel.get());
    fMetrics.ObserveMetrics(fSink->GetMetrics());
+   Detail::RNTupleMetricsRegistry::Instance().Register(fMetrics);
 }
 
 ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
 {
+   Detail::RNTupleMetricsRegistry::Instance().Unregister(fMetrics);
    for (const auto &context : fFillContexts) {
       if (!context.expired()) {
          R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext has not been destructed";
@@ -17,6 +17,37 @@
 
 #include <ROOT/RFieldBase.hxx>
 
+#ifdef R__USE_IMT
+#include <ROOT/RSlotStack.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+/// A range of entries of one of the processed RNTuples, aligned with cluster boundaries
+struct RWorkItem {
+   std::size_t fNTupleIndex = 0;
+   ROOT::Experimental::NTupleSize_t fFirstEntry = 0;
+   ROOT::Experimental::NTupleSize_t fLastEntry = 0;
+   /// The global entry index of the first entry of the RNTuple
+   ROOT::Experimental::NTupleSize_t fGlobalOffset = 0;
+};
+
+/// The reading state of a processing slot in RNTupleProcessor::ProcessParallel(). The order of the members ensures
+/// that the entry and the fields of the model are destructed before the page source they are connected to.
+struct RWorkerContext {
+   std::size_t fNTupleIndex = std::size_t(-1);
+   std::unique_ptr<ROOT::Experimental::Internal::RPageSource> fPageSource;
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> fModel;
+   std::unique_ptr<ROOT::Experimental::REntry> fEntry;
+};
+
+} // anonymous namespace
+
 ROOT::Experimental::NTupleSize_t
 ROOT::Experimental::Internal::RNTupleProcessor::ConnectNTuple(const RNTupleSourceSpec &ntuple)
 {
@@ -88,3 +119,85 @@ ROOT::Experimental::Internal::RNTupleProcessor::RNTupleProcessor(const std::vect
 
    ConnectFields();
 }
+
+void ROOT::Experimental::Internal::RNTupleProcessor::ProcessParallel(const ParallelCallback_t &callable)
+{
+   std::vector<RWorkItem> workItems;
+   NTupleSize_t globalOffset = 0;
+   for (std::size_t i = 0; i < fNTuples.size(); ++i) {
+      auto pageSource = Internal::RPageSource::Create(fNTuples[i].fName, fNTuples[i].fLocation);
+      pageSource->Attach();
+
+      std::vector<std::pair<NTupleSize_t, NTupleSize_t>> clusterRanges;
+      {
+         auto desc = pageSource->GetSharedDescriptorGuard();
+         for (const auto &clusterDesc : desc->GetClusterIterable()) {
+            const auto first = clusterDesc.GetFirstEntryIndex();
+            clusterRanges.emplace_back(first, first + clusterDesc.GetNEntries());
+         }
+      }
+      std::sort(clusterRanges.begin(), clusterRanges.end());
+      for (const auto &[first, last] : clusterRanges) {
+         if (first == last)
+            continue;
+         workItems.emplace_back(RWorkItem{i, first, last, globalOffset});
+      }
+
+      globalOffset += pageSource->GetNEntries();
+   }
+
+   auto fnConnectNTuple = [this](RWorkerContext &context, std::size_t ntupleIndex) {
+      context.fEntry.reset();
+      context.fModel.reset();
+      context.fPageSource = Internal::RPageSource::Create(fNTuples[ntupleIndex].fName, fNTuples[ntupleIndex].fLocation);
+      context.fPageSource->Attach();
+
+      auto model = RNTupleModel::CreateBare();
+      for (const auto &fieldContext : fFieldContexts) {
+         model->AddField(fieldContext.GetProtoField().Clone(fieldContext.GetProtoField().GetFieldName()));
+      }
+      model->Freeze();
+
+      auto desc = context.fPageSource->GetSharedDescriptorGuard();
+      for (auto &field : model->GetFieldZero().GetSubFields()) {
+         auto fieldId = desc->FindFieldId(field->GetFieldName());
+         if (fieldId == kInvalidDescriptorId)
+            throw RException(R__FAIL("field \"" + field->GetFieldName() + "\" not found in current RNTuple"));
+         field->SetOnDiskId(fieldId);
+         Internal::CallConnectPageSourceOnField(*field, *context.fPageSource);
+      }
+
+      context.fEntry = model->CreateEntry();
+      context.fModel = std::move(model);
+      context.fNTupleIndex = ntupleIndex;
+   };
+
+   auto fnProcessWorkItem = [&](RWorkerContext &context, unsigned int slot, const RWorkItem &workItem) {
+      if (context.fNTupleIndex != workItem.fNTupleIndex)
+         fnConnectNTuple(context, workItem.fNTupleIndex);
+      for (auto i = workItem.fFirstEntry; i < workItem.fLastEntry; ++i) {
+         context.fEntry->Read(i);
+         callable(slot, workItem.fGlobalOffset + i, *context.fEntry);
+      }
+   };
+
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      const auto nSlots = ROOT::GetThreadPoolSize();
+      std::vector<RWorkerContext> contexts(nSlots);
+      ROOT::Internal::RSlotStack slotStack(nSlots);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](std::size_t i) {
+            ROOT::Internal::RSlotStackRAII slotGuard(slotStack);
+            fnProcessWorkItem(contexts[slotGuard.fSlot], slotGuard.fSlot, workItems[i]);
+         },
+         ROOT::TSeq<std::size_t>(workItems.size()));
+      return;
+   }
+#endif
+
+   RWorkerContext context;
+   for (const auto &workItem : workItems)
+      fnProcessWorkItem(context, 0, workItem);
+}
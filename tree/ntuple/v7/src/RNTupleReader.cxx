@@ -70,6 +70,7 @@ ROOT::Experimental::RNTupleReader::RNTupleReader(std::unique_ptr<ROOT::Experimen
    fModel->Freeze();
    InitPageSource(options.HasMetricsEnabled());
    ConnectModel(*fModel);
+   Detail::RNTupleMetricsRegistry::Instance().Register(fMetrics);
 }
 
 ROOT::Experimental::RNTupleReader::RNTupleReader(std::unique_ptr<ROOT::Experimental::Internal::RPageSource> source,
@@ -77,9 +78,13 @@ ROOT::Experimental::RNTupleReader::RNTupleReader(std::unique_ptr<ROOT::Experimen
    : fSource(std::move(source)), fModel(nullptr), fMetrics("RNTupleReader")
 {
    InitPageSource(options.HasMetricsEnabled());
+   Detail::RNTupleMetricsRegistry::Instance().Register(fMetrics);
 }
 
-ROOT::Experimental::RNTupleReader::~RNTupleReader() = default;
+ROOT::Experimental::RNTupleReader::~RNTupleReader()
+{
+   Detail::RNTupleMetricsRegistry::Instance().Unregister(fMetrics);
+}
 
 std::unique_ptr<ROOT::Experimental::RNTupleReader>
 ROOT::Experimental::RNTupleReader::Open(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
@@ -711,6 +711,7 @@ ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnType(ROOT::Exper
    case EColumnType::kSplitUInt16: return SerializeUInt16(0x15, buffer);
    case EColumnType::kReal32Trunc: return SerializeUInt16(0x1D, buffer);
    case EColumnType::kReal32Quant: return SerializeUInt16(0x1E, buffer);
+   case EColumnType::kIntFOR: return SerializeUInt16(0x1F, buffer);
    default:
       if (type == kTestFutureType)
          return SerializeUInt16(0x99, buffer);
@@ -757,6 +758,7 @@ ROOT::Experimental::Internal::RNTupleSerializer::DeserializeColumnType(const voi
    case 0x15: type = EColumnType::kSplitUInt16; break;
    case 0x1D: type = EColumnType::kReal32Trunc; break;
    case 0x1E: type = EColumnType::kReal32Quant; break;
+   case 0x1F: type = EColumnType::kIntFOR; break;
    // case 0x99 => kTestFutureType missing on purpose
    default:
       // may be a column type introduced by a future version
@@ -1584,6 +1586,15 @@ ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList(void *buffer,
             }
             pos += SerializeInt64(columnRange.fFirstElementIndex, *where);
             pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
+            if (columnRange.fMinMax) {
+               auto [min, max] = *columnRange.fMinMax;
+               std::uint64_t intMin, intMax;
+               static_assert(sizeof(min) == sizeof(intMin) && sizeof(max) == sizeof(intMax));
+               memcpy(&intMin, &min, sizeof(min));
+               memcpy(&intMax, &max, sizeof(max));
+               pos += SerializeUInt64(intMin, *where);
+               pos += SerializeUInt64(intMax, *where);
+            }
          }
 
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
@@ -1905,6 +1916,18 @@ ROOT::Experimental::Internal::RNTupleSerializer::DeserializePageList(const void
             std::uint32_t compressionSettings;
             bytes += DeserializeUInt32(bytes, compressionSettings);
             clusterBuilders[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
+            // Optional column statistics; older writers don't produce them so that the frame simply ends here
+            if (fnInnerFrameSizeLeft() >= static_cast<int>(2 * sizeof(std::uint64_t))) {
+               std::uint64_t intMin, intMax;
+               bytes += DeserializeUInt64(bytes, intMin);
+               bytes += DeserializeUInt64(bytes, intMax);
+               double min, max;
+               memcpy(&min, &intMin, sizeof(min));
+               memcpy(&max, &intMax, sizeof(max));
+               auto voidRes = clusterBuilders[i].SetColumnRangeMinMax(j, min, max);
+               if (!voidRes)
+                  return R__FORWARD_ERROR(voidRes);
+            }
          }
 
          bytes = innerFrame + innerFrameSize;
@@ -42,10 +42,12 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
 #endif
    // Observe directly the sink's metrics to avoid an additional prefix from the fill context.
    fMetrics.ObserveMetrics(fFillContext.fSink->GetMetrics());
+   Detail::RNTupleMetricsRegistry::Instance().Register(fMetrics);
 }
 
 ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
 {
+   Detail::RNTupleMetricsRegistry::Instance().Unregister(fMetrics);
    try {
       CommitCluster(true /* commitClusterGroup */);
       fFillContext.fSink->CommitDataset();
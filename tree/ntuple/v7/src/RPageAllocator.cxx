@@ -34,3 +34,71 @@ void ROOT::Experimental::Internal::RPageAllocatorHeap::DeletePage(RPage &page)
 {
    delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::Internal::RPageAllocatorPool::~RPageAllocatorPool()
+{
+   for (auto &freeList : fFreeLists) {
+      for (auto buffer : freeList)
+         delete[] buffer;
+   }
+}
+
+unsigned int ROOT::Experimental::Internal::RPageAllocatorPool::GetSizeClass(std::size_t nbytes)
+{
+   unsigned int sizeClass = 0;
+   while (GetSizeClassBytes(sizeClass) < nbytes) {
+      if (++sizeClass == kNSizeClasses)
+         break;
+   }
+   return sizeClass;
+}
+
+ROOT::Experimental::Internal::RPage ROOT::Experimental::Internal::RPageAllocatorPool::NewPage(ColumnId_t columnId,
+                                                                                              std::size_t elementSize,
+                                                                                              std::size_t nElements)
+{
+   R__ASSERT((elementSize > 0) && (nElements > 0));
+   const auto nbytes = elementSize * nElements;
+   const auto sizeClass = GetSizeClass(nbytes);
+   if (sizeClass == kNSizeClasses)
+      return RPage(columnId, new unsigned char[nbytes], this, elementSize, nElements);
+
+   unsigned char *buffer = nullptr;
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      auto &freeList = fFreeLists[sizeClass];
+      if (!freeList.empty()) {
+         buffer = freeList.back();
+         freeList.pop_back();
+         fCachedBytes -= GetSizeClassBytes(sizeClass);
+      }
+   }
+   if (!buffer)
+      buffer = new unsigned char[GetSizeClassBytes(sizeClass)];
+   return RPage(columnId, buffer, this, elementSize, nElements);
+}
+
+void ROOT::Experimental::Internal::RPageAllocatorPool::DeletePage(RPage &page)
+{
+   auto buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   // The page capacity is the size requested from NewPage() and thus determines the size class of the buffer
+   const auto sizeClass = GetSizeClass(page.GetCapacity());
+   if (sizeClass < kNSizeClasses) {
+      const auto classBytes = GetSizeClassBytes(sizeClass);
+      std::lock_guard<std::mutex> guard(fLock);
+      if (fCachedBytes + classBytes <= fMaxCachedBytes) {
+         fFreeLists[sizeClass].emplace_back(buffer);
+         fCachedBytes += classBytes;
+         return;
+      }
+   }
+   delete[] buffer;
+}
+
+std::size_t ROOT::Experimental::Internal::RPageAllocatorPool::GetCachedBytes()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fCachedBytes;
+}
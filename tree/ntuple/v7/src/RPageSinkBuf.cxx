@@ -29,6 +29,24 @@ void ROOT::Experimental::Internal::RPageSinkBuf::RColumnBuf::DropBufferedPages()
    // Each RSealedPage points to the same region as `fBuf` for some element in `fBufferedPages`; thus, no further
    // clean-up is required
    fSealedPages.clear();
+   fMinMax.reset();
+}
+
+void ROOT::Experimental::Internal::RPageSinkBuf::RColumnBuf::AdaptMaxPageSize(std::uint64_t nBytesUnzipped,
+                                                                             std::uint64_t nBytesZipped,
+                                                                             const RNTupleWriteOptions &options)
+{
+   if (options.GetApproxZippedPageSize() == 0 || nBytesZipped == 0)
+      return;
+
+   const double ratio = static_cast<double>(nBytesUnzipped) / nBytesZipped;
+   // Dampen the feedback such that a single badly compressing page does not collapse the page size
+   fCompressionRatio = (fCompressionRatio == 0) ? ratio : (fCompressionRatio + ratio) / 2;
+
+   const double minPageSize = options.GetInitialNElementsPerPage() * fCol.fColumn->GetElement()->GetSize();
+   const double maxPageSize = options.GetMaxUnzippedPageSize();
+   const double pageSize = options.GetApproxZippedPageSize() * fCompressionRatio;
+   fMaxPageSize = static_cast<std::size_t>(std::clamp(pageSize, minPageSize, maxPageSize));
 }
 
 ROOT::Experimental::Internal::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink> inner)
@@ -144,6 +162,8 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
    // Safety: References are guaranteed to be valid until the element is destroyed. In other words, all buffered page
    // elements are valid until DropBufferedPages().
    auto &zipItem = fBufferedColumns.at(colId).BufferPage(columnHandle);
+   if (GetWriteOptions().GetEnableColumnStatistics())
+      fBufferedColumns[colId].UpdateMinMax(element.GetMinMax(page.GetBuffer(), page.GetNElements()));
    zipItem.AllocateSealedPageBuf(page.GetNBytes() + GetWriteOptions().GetEnablePageChecksums() * kNBytesPageChecksum);
    R__ASSERT(zipItem.fBuf);
    auto &sealedPage = fBufferedColumns.at(colId).RegisterSealedPage();
@@ -159,6 +179,7 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
       config.fBuffer = zipItem.fBuf.get();
       sealedPage = SealPage(config);
       zipItem.fSealedPage = &sealedPage;
+      fBufferedColumns[colId].AdaptMaxPageSize(page.GetNBytes(), sealedPage.GetDataSize(), GetWriteOptions());
       return;
    }
 
@@ -208,12 +229,26 @@ void ROOT::Experimental::Internal::RPageSinkBuf::FlushClusterImpl(std::function<
       R__ASSERT(bufColumn.HasSealedPagesOnly());
       const auto &sealedPages = bufColumn.GetSealedPages();
       toCommit.emplace_back(bufColumn.GetHandle().fPhysicalId, sealedPages.cbegin(), sealedPages.cend());
+      toCommit.back().fMinMax = bufColumn.GetMinMax();
+
+      // Without a task scheduler, the page size is already adapted as pages are sealed in CommitPage()
+      if (fTaskScheduler && !sealedPages.empty() && GetWriteOptions().GetApproxZippedPageSize() > 0) {
+         std::uint64_t nElements = 0;
+         std::uint64_t nBytesZipped = 0;
+         for (const auto &sealedPage : sealedPages) {
+            nElements += sealedPage.GetNElements();
+            nBytesZipped += sealedPage.GetDataSize();
+         }
+         const auto elementSize = bufColumn.GetHandle().fColumn->GetElement()->GetSize();
+         bufColumn.AdaptMaxPageSize(nElements * elementSize, nBytesZipped, GetWriteOptions());
+      }
    }
 
+   std::function<void()> deferredWrite;
    {
       RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
       Detail::RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
-      fInnerSink->CommitSealedPageV(toCommit);
+      deferredWrite = fInnerSink->CommitSealedPageVDeferred(toCommit);
 
       for (auto handle : fSuppressedColumns)
          fInnerSink->CommitSuppressedColumn(handle);
@@ -221,6 +256,9 @@ void ROOT::Experimental::Internal::RPageSinkBuf::FlushClusterImpl(std::function<
 
       FlushClusterFn();
    }
+   // The bulk of the page data can be written concurrently to other fill contexts sharing the inner sink
+   if (deferredWrite)
+      deferredWrite();
 
    for (auto &bufColumn : fBufferedColumns)
       bufColumn.DropBufferedPages();
@@ -267,3 +305,9 @@ ROOT::Experimental::Internal::RPageSinkBuf::ReservePage(ColumnHandle_t columnHan
 {
    return fInnerSink->ReservePage(columnHandle, nElements);
 }
+
+std::size_t ROOT::Experimental::Internal::RPageSinkBuf::GetMaxWritePageSize(ColumnHandle_t columnHandle) const
+{
+   const auto maxPageSize = fBufferedColumns.at(columnHandle.fPhysicalId).GetMaxPageSize();
+   return (maxPageSize > 0) ? maxPageSize : GetWriteOptions().GetMaxUnzippedPageSize();
+}
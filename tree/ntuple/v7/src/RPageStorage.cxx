@@ -23,6 +23,7 @@
 #include <ROOT/RNTupleSerialize.hxx>
 #include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RTrace.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #ifdef R__ENABLE_DAOS
 #include <ROOT/RPageStorageDaos.hxx>
@@ -34,7 +35,9 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cmath>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string_view>
 #include <unordered_map>
@@ -109,6 +112,11 @@ void ROOT::Experimental::Internal::RPageSource::RActivePhysicalColumns::Erase(De
    }
 }
 
+bool ROOT::Experimental::Internal::RPageSource::RActivePhysicalColumns::Contains(DescriptorId_t physicalColumnID) const
+{
+   return std::find(fIDs.begin(), fIDs.end(), physicalColumnID) != fIDs.end();
+}
+
 ROOT::Experimental::Internal::RCluster::ColumnSet_t
 ROOT::Experimental::Internal::RPageSource::RActivePhysicalColumns::ToColumnSet() const
 {
@@ -137,6 +145,8 @@ bool ROOT::Experimental::Internal::RPageSource::REntryRange::IntersectsWith(cons
 ROOT::Experimental::Internal::RPageSource::RPageSource(std::string_view name, const RNTupleReadOptions &options)
    : RPageStorage(name), fOptions(options)
 {
+   if (fOptions.GetPageAllocator() == RNTupleReadOptions::EPageAllocator::kPool)
+      fPageAllocator = std::make_unique<RPageAllocatorPool>(fOptions.GetPagePoolMaxBytes());
 }
 
 ROOT::Experimental::Internal::RPageSource::~RPageSource() {}
@@ -169,12 +179,36 @@ ROOT::Experimental::Internal::RPageSource::AddColumn(DescriptorId_t fieldId, RCo
       GetSharedDescriptorGuard()->FindPhysicalColumnId(fieldId, column.GetIndex(), column.GetRepresentationIndex());
    R__ASSERT(physicalId != kInvalidDescriptorId);
    fActivePhysicalColumns.Insert(physicalId);
+   if (fDeferredFieldIds.count(fieldId) > 0)
+      fDeferredPhysicalColumns.Insert(physicalId);
    return ColumnHandle_t{physicalId, &column};
 }
 
 void ROOT::Experimental::Internal::RPageSource::DropColumn(ColumnHandle_t columnHandle)
 {
    fActivePhysicalColumns.Erase(columnHandle.fPhysicalId);
+   fDeferredPhysicalColumns.Erase(columnHandle.fPhysicalId);
+}
+
+void ROOT::Experimental::Internal::RPageSource::SetDeferredField(DescriptorId_t fieldId, bool isDeferred)
+{
+   if (isDeferred)
+      fDeferredFieldIds.insert(fieldId);
+   else
+      fDeferredFieldIds.erase(fieldId);
+}
+
+ROOT::Experimental::Internal::RCluster::ColumnSet_t
+ROOT::Experimental::Internal::RPageSource::GetClusterColumnSet() const
+{
+   auto columnSet = fActivePhysicalColumns.ToColumnSet();
+   for (auto it = columnSet.begin(); it != columnSet.end();) {
+      if (IsDeferredColumn(*it))
+         it = columnSet.erase(it);
+      else
+         ++it;
+   }
+   return columnSet;
 }
 
 void ROOT::Experimental::Internal::RPageSource::SetEntryRange(const REntryRange &range)
@@ -229,6 +263,7 @@ void ROOT::Experimental::Internal::RPageSource::UnzipCluster(RCluster *cluster)
 
 void ROOT::Experimental::Internal::RPageSource::UnzipClusterImpl(RCluster *cluster)
 {
+   R__TRACE_SCOPE("ntuple", "RPageSource::UnzipCluster");
    Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
 
    const auto clusterId = cluster->GetId();
@@ -664,6 +699,21 @@ ROOT::Experimental::Internal::RPageSink::SealPage(const RPage &page, const RColu
    return SealPage(config);
 }
 
+void ROOT::Experimental::Internal::RPageSink::MergeColumnStatistics(
+   std::optional<std::pair<double, double>> &target, const std::optional<std::pair<double, double>> &source)
+{
+   if (!source) {
+      target = {-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+      return;
+   }
+   if (!target) {
+      target = source;
+      return;
+   }
+   target->first = std::min(target->first, source->first);
+   target->second = std::max(target->second, source->second);
+}
+
 void ROOT::Experimental::Internal::RPageSink::CommitDataset()
 {
    for (const auto &cb : fOnDatasetCommitCallbacks)
@@ -864,6 +914,10 @@ void ROOT::Experimental::Internal::RPagePersistentSink::InitFromDescriptor(const
          R__ASSERT(pageRange.fPhysicalColumnId == i);
          clusterBuilder.CommitColumnRange(i, fOpenColumnRanges[i].fFirstElementIndex, columnRange.fCompressionSettings,
                                           pageRange);
+         if (columnRange.fMinMax) {
+            clusterBuilder.SetColumnRangeMinMax(i, columnRange.fMinMax->first, columnRange.fMinMax->second)
+               .ThrowOnError();
+         }
          fOpenColumnRanges[i].fFirstElementIndex += columnRange.fNElements;
       }
       fDescriptorBuilder.AddCluster(clusterBuilder.MoveDescriptor().Unwrap());
@@ -881,6 +935,10 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSuppressedColumn(C
 void ROOT::Experimental::Internal::RPagePersistentSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
    fOpenColumnRanges.at(columnHandle.fPhysicalId).fNElements += page.GetNElements();
+   if (GetWriteOptions().GetEnableColumnStatistics()) {
+      MergeColumnStatistics(fOpenColumnRanges[columnHandle.fPhysicalId].fMinMax,
+                            columnHandle.fColumn->GetElement()->GetMinMax(page.GetBuffer(), page.GetNElements()));
+   }
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
@@ -893,6 +951,9 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPage(Descrip
                                                                          const RPageStorage::RSealedPage &sealedPage)
 {
    fOpenColumnRanges.at(physicalColumnId).fNElements += sealedPage.GetNElements();
+   // Sealed pages committed one by one carry no statistics
+   if (GetWriteOptions().GetEnableColumnStatistics())
+      MergeColumnStatistics(fOpenColumnRanges[physicalColumnId].fMinMax, std::nullopt);
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.GetNElements();
@@ -920,6 +981,14 @@ ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageVImpl(
 
 void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageV(
    std::span<RPageStorage::RSealedPageGroup> ranges)
+{
+   auto deferredWrite = CommitSealedPageVDeferred(ranges);
+   if (deferredWrite)
+      deferredWrite();
+}
+
+std::function<void()> ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageVDeferred(
+   std::span<RPageStorage::RSealedPageGroup> ranges)
 {
    /// Used in the `originalPages` map
    struct RSealedPageLink {
@@ -970,10 +1039,13 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageV(
       locatorIndexes.shrink_to_fit();
    }
 
-   auto locators = CommitSealedPageVImpl(ranges, mask);
+   std::function<void()> deferredWrite;
+   auto locators = CommitSealedPageVDeferredImpl(ranges, mask, deferredWrite);
    unsigned i = 0;
 
    for (auto &range : ranges) {
+      if (GetWriteOptions().GetEnableColumnStatistics() && (range.fFirst != range.fLast))
+         MergeColumnStatistics(fOpenColumnRanges.at(range.fPhysicalColumnId).fMinMax, range.fMinMax);
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
          fOpenColumnRanges.at(range.fPhysicalColumnId).fNElements += sealedPageIt->GetNElements();
 
@@ -984,6 +1056,8 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageV(
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
    }
+
+   return deferredWrite;
 }
 
 ROOT::Experimental::Internal::RPageSink::RStagedCluster
@@ -1009,6 +1083,11 @@ ROOT::Experimental::Internal::RPagePersistentSink::StageCluster(ROOT::Experiment
          columnInfo.fNElements = fOpenColumnRanges[i].fNElements;
          fOpenColumnRanges[i].fNElements = 0;
       }
+      // The range [-inf, inf] marks columns with incomplete statistics (see MergeColumnStatistics())
+      const auto &minMax = fOpenColumnRanges[i].fMinMax;
+      if (minMax && (!std::isinf(minMax->first) || !std::isinf(minMax->second)))
+         columnInfo.fMinMax = minMax;
+      fOpenColumnRanges[i].fMinMax.reset();
       stagedCluster.fColumnInfos.push_back(std::move(columnInfo));
    }
 
@@ -1030,6 +1109,10 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitStagedClusters(std
          } else {
             clusterBuilder.CommitColumnRange(colId, fOpenColumnRanges[colId].fFirstElementIndex,
                                              fOpenColumnRanges[colId].fCompressionSettings, columnInfo.fPageRange);
+            if (columnInfo.fMinMax) {
+               clusterBuilder.SetColumnRangeMinMax(colId, columnInfo.fMinMax->first, columnInfo.fMinMax->second)
+                  .ThrowOnError();
+            }
             fOpenColumnRanges[colId].fFirstElementIndex += columnInfo.fNElements;
          }
       }
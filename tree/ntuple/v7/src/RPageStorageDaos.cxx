@@ -498,7 +498,8 @@ ROOT::Experimental::Internal::RPageSourceDaos::RPageSourceDaos(std::string_view
                                                                const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options),
      fURI(uri),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(
+        std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetClusterBunchesInFlight()))
 {
    EnableDefaultMetrics("RPageSourceDaos");
 
@@ -617,10 +618,13 @@ ROOT::Experimental::Internal::RPageSourceDaos::LoadPageImpl(ColumnHandle_t colum
    sealedPage.SetNElements(pageInfo.fNElements);
    sealedPage.SetHasChecksum(pageInfo.fHasChecksum);
    sealedPage.SetBufferSize(pageInfo.fLocator.fBytesOnStorage + pageInfo.fHasChecksum * kNBytesPageChecksum);
-   std::unique_ptr<unsigned char[]> directReadBuffer; // only used if cluster pool is turned off
+   std::unique_ptr<unsigned char[]> directReadBuffer; // only used if cluster pool is off or the column is deferred
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      if (pageInfo.fLocator.fReserved & EDaosLocatorFlags::kCagedPage) {
+   // Caged pages can only be read through the cluster cache, also for deferred columns
+   const bool isCaged = pageInfo.fLocator.fReserved & EDaosLocatorFlags::kCagedPage;
+   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff ||
+       (IsDeferredColumn(columnId) && !isCaged)) {
+      if (isCaged) {
          throw ROOT::Experimental::RException(
             R__FAIL("accessing caged pages is only supported in conjunction with cluster cache"));
       }
@@ -636,7 +640,9 @@ ROOT::Experimental::Internal::RPageSourceDaos::LoadPageImpl(ColumnHandle_t colum
       sealedPage.SetBuffer(directReadBuffer.get());
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
-         fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
+         fCurrentCluster = fClusterPool->GetCluster(clusterId, IsDeferredColumn(columnId)
+                                                                  ? fActivePhysicalColumns.ToColumnSet()
+                                                                  : GetClusterColumnSet());
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPageRef = fPagePool.GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
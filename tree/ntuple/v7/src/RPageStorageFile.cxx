@@ -28,6 +28,7 @@
 #include <ROOT/RRawFileTFile.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <ROOT/RConfig.hxx>
 #include <RVersion.h>
 #include <TError.h>
 #include <TFile.h>
@@ -36,13 +37,25 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <future>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
 #include <utility>
 
 #include <functional>
 #include <mutex>
 
+#ifdef R__LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 ROOT::Experimental::Internal::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
                                                            const RNTupleWriteOptions &options)
    : RPagePersistentSink(ntupleName, options)
@@ -221,6 +234,131 @@ ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageVImpl(std::span<RPa
    return locators;
 }
 
+std::vector<ROOT::Experimental::RNTupleLocator>
+ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageVDeferredImpl(
+   std::span<RPageStorage::RSealedPageGroup> ranges, const std::vector<bool> &mask,
+   std::function<void()> &deferredWrite)
+{
+   std::vector<const RSealedPage *> sealedPages;
+   std::size_t size = 0;
+   std::size_t bytesPacked = 0;
+   std::size_t iPage = 0;
+   for (auto &range : ranges) {
+      if (range.fFirst == range.fLast)
+         continue;
+
+      const auto bitsOnStorage =
+         fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(range.fPhysicalColumnId).GetBitsOnStorage();
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt, ++iPage) {
+         if (!mask[iPage])
+            continue;
+         sealedPages.emplace_back(&(*sealedPageIt));
+         size += sealedPageIt->GetBufferSize();
+         bytesPacked += (bitsOnStorage * sealedPageIt->GetNElements() + 7) / 8;
+      }
+   }
+   if (sealedPages.empty() || size > fOptions->GetMaxKeySize())
+      return CommitSealedPageVImpl(ranges, mask);
+
+   // A page segment of the unbuffered range: the source address and the number of bytes
+   std::vector<std::pair<const unsigned char *, std::size_t>> unbufferedSegments;
+   std::vector<RNTupleLocator> locators;
+   locators.reserve(sealedPages.size());
+   RNTupleFileWriter::RUnbufferedRange unbufferedRange;
+   {
+      Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+
+      std::uint64_t offset;
+      std::tie(offset, unbufferedRange) = fWriter->ReserveBlobWithUnbufferedRange(size, bytesPacked);
+      if (unbufferedRange.fSize == 0) {
+         // Nothing to gain; write the reserved record in one go as CommitBatchOfPages() does
+         for (const auto *pagePtr : sealedPages) {
+            fWriter->WriteIntoReservedBlob(pagePtr->GetBuffer(), pagePtr->GetBufferSize(), offset);
+            RNTupleLocator locator;
+            locator.fPosition = offset;
+            locator.fBytesOnStorage = pagePtr->GetDataSize();
+            locators.push_back(locator);
+            offset += pagePtr->GetBufferSize();
+         }
+      } else {
+         const std::uint64_t unbufferedFirst = unbufferedRange.fOffset;
+         const std::uint64_t unbufferedLast = unbufferedRange.fOffset + unbufferedRange.fSize;
+         // The buffered bytes after the unbuffered range; they have to be written after the leading bytes
+         std::vector<std::pair<const unsigned char *, std::size_t>> trailingSegments;
+         for (const auto *pagePtr : sealedPages) {
+            const auto buffer = static_cast<const unsigned char *>(pagePtr->GetBuffer());
+            const std::uint64_t pageFirst = offset;
+            const std::uint64_t pageLast = offset + pagePtr->GetBufferSize();
+
+            if (pageFirst < unbufferedFirst) {
+               const auto n = std::min(pageLast, unbufferedFirst) - pageFirst;
+               fWriter->WriteIntoReservedBlob(buffer, n, pageFirst);
+            }
+            const auto overlapFirst = std::max(pageFirst, unbufferedFirst);
+            const auto overlapLast = std::min(pageLast, unbufferedLast);
+            if (overlapFirst < overlapLast)
+               unbufferedSegments.emplace_back(buffer + (overlapFirst - pageFirst), overlapLast - overlapFirst);
+            if (pageLast > unbufferedLast) {
+               const auto trailingFirst = std::max(pageFirst, unbufferedLast);
+               trailingSegments.emplace_back(buffer + (trailingFirst - pageFirst), pageLast - trailingFirst);
+            }
+
+            RNTupleLocator locator;
+            locator.fPosition = offset;
+            locator.fBytesOnStorage = pagePtr->GetDataSize();
+            locators.push_back(locator);
+            offset += pagePtr->GetBufferSize();
+         }
+         std::uint64_t trailingOffset = unbufferedLast;
+         for (const auto &[buffer, n] : trailingSegments) {
+            fWriter->WriteIntoReservedBlob(buffer, n, trailingOffset);
+            trailingOffset += n;
+         }
+      }
+   }
+
+   fCounters->fNPageCommitted.Add(sealedPages.size());
+   fCounters->fSzWritePayload.Add(size);
+   fNBytesCurrentCluster += size;
+
+   if (unbufferedSegments.empty())
+      return locators;
+
+   deferredWrite = [writer = fWriter.get(), counters = fCounters.get(), unbufferedRange,
+                    segments = std::move(unbufferedSegments)]() {
+      Detail::RNTupleAtomicTimer timer(counters->fTimeWallWrite, counters->fTimeCpuWrite);
+      // Gather the page bytes into chunks of whole blocks, aligned as required for Direct I/O. The size of the
+      // unbuffered range is a multiple of the write buffer size, which is a multiple of the alignment.
+      static constexpr std::size_t kAlign = 4096;
+      static constexpr std::size_t kMaxChunkSize = 4 * 1024 * 1024;
+      const std::size_t chunkSize = std::min(unbufferedRange.fSize, kMaxChunkSize);
+      std::align_val_t chunkAlign{kAlign};
+      auto deleter = [chunkAlign](unsigned char *p) { ::operator delete[](p, chunkAlign); };
+      std::unique_ptr<unsigned char[], decltype(deleter)> chunk(
+         static_cast<unsigned char *>(::operator new[](chunkSize, chunkAlign)), deleter);
+
+      std::uint64_t chunkOffset = unbufferedRange.fOffset;
+      std::size_t nChunk = 0;
+      for (auto [buffer, n] : segments) {
+         while (n > 0) {
+            const auto nCopy = std::min(n, chunkSize - nChunk);
+            memcpy(chunk.get() + nChunk, buffer, nCopy);
+            buffer += nCopy;
+            n -= nCopy;
+            nChunk += nCopy;
+            if (nChunk == chunkSize) {
+               writer->WriteUnbuffered(chunk.get(), nChunk, chunkOffset);
+               chunkOffset += nChunk;
+               nChunk = 0;
+            }
+         }
+      }
+      if (nChunk > 0)
+         writer->WriteUnbuffered(chunk.get(), nChunk, chunkOffset);
+   };
+   return locators;
+}
+
 std::uint64_t ROOT::Experimental::Internal::RPageSinkFile::StageClusterImpl()
 {
    auto result = fNBytesCurrentCluster;
@@ -258,7 +396,8 @@ void ROOT::Experimental::Internal::RPageSinkFile::CommitDatasetImpl(unsigned cha
 ROOT::Experimental::Internal::RPageSourceFile::RPageSourceFile(std::string_view ntupleName,
                                                                const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(
+        std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetClusterBunchesInFlight()))
 {
    EnableDefaultMetrics("RPageSourceFile");
 }
@@ -307,7 +446,38 @@ ROOT::Experimental::Internal::RPageSourceFile::CreateFromAnchor(const RNTuple &a
    return pageSource;
 }
 
-ROOT::Experimental::Internal::RPageSourceFile::~RPageSourceFile() = default;
+ROOT::Experimental::Internal::RPageSourceFile::~RPageSourceFile()
+{
+#ifdef R__LINUX
+   if (fMappedFile)
+      munmap(fMappedFile, fMappedSize);
+#endif
+}
+
+void ROOT::Experimental::Internal::RPageSourceFile::MapFile()
+{
+#ifdef R__LINUX
+   if (ROOT::Internal::RRawFile::GetTransport(fFile->GetUrl()) != "file" ||
+       dynamic_cast<ROOT::Internal::RRawFileTFile *>(fFile.get())) {
+      return;
+   }
+
+   const auto path = ROOT::Internal::RRawFile::GetLocation(fFile->GetUrl());
+   int fd = open(path.c_str(), O_RDONLY);
+   if (fd < 0)
+      return;
+   struct stat info;
+   if ((fstat(fd, &info) == 0) && (info.st_size > 0)) {
+      void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (mapping != MAP_FAILED) {
+         fMappedFile = static_cast<unsigned char *>(mapping);
+         fMappedSize = info.st_size;
+      }
+   }
+   // The mapping remains valid after closing the file descriptor
+   close(fd);
+#endif
+}
 
 void ROOT::Experimental::Internal::RPageSourceFile::LoadStructureImpl()
 {
@@ -388,6 +558,19 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Internal::RPageSourceF
    // For the page reads, we rely on the I/O scheduler to define the read requests
    fFile->SetBuffering(false);
 
+   if (fOptions.GetUseMemoryMapping())
+      MapFile();
+
+   // Clones of an RRawFileTFile share the underlying TFile and thus cannot read concurrently
+   const bool isRemote = (ROOT::Internal::RRawFile::GetTransport(fFile->GetUrl()) != "file") &&
+                         !dynamic_cast<ROOT::Internal::RRawFileTFile *>(fFile.get());
+   if (isRemote) {
+      for (unsigned int i = 1; i < fOptions.GetNRemoteReadStreams(); ++i) {
+         fReadStreams.emplace_back(fFile->Clone());
+         fReadStreams.back()->SetBuffering(false);
+      }
+   }
+
    return desc;
 }
 
@@ -443,9 +626,33 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadPageImpl(ColumnHandle_t colum
    sealedPage.SetNElements(pageInfo.fNElements);
    sealedPage.SetHasChecksum(pageInfo.fHasChecksum);
    sealedPage.SetBufferSize(pageInfo.fLocator.fBytesOnStorage + pageInfo.fHasChecksum * kNBytesPageChecksum);
-   std::unique_ptr<unsigned char[]> directReadBuffer; // only used if cluster pool is turned off
-
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
+   std::unique_ptr<unsigned char[]> directReadBuffer; // only used if cluster pool is off or the column is deferred
+
+   const auto pagePosition = pageInfo.fLocator.GetPosition<std::uint64_t>();
+   // Split blobs are not contiguous in the file and thus cannot be used from the mapping
+   const auto maxKeySize = fReader.GetMaxKeySize();
+   const bool isMapped = fMappedFile && (pageInfo.fLocator.fType == RNTupleLocator::kTypeFile) &&
+                         (pagePosition + sealedPage.GetBufferSize() <= fMappedSize) &&
+                         ((maxKeySize == 0) || (sealedPage.GetBufferSize() <= maxKeySize));
+
+   if (isMapped) {
+      auto pageAddress = fMappedFile + pagePosition;
+      sealedPage.SetBuffer(pageAddress);
+      // Zero-copy: the page is used in place if its on-disk representation equals the in-memory representation
+      const bool isInPlace = element->IsMappable() &&
+                             (sealedPage.GetDataSize() == element->GetPackedSize(pageInfo.fNElements)) &&
+                             (reinterpret_cast<std::uintptr_t>(pageAddress) % elementSize == 0);
+      if (isInPlace) {
+         sealedPage.VerifyChecksumIfEnabled().ThrowOnError();
+         RPage newPage(columnId, pageAddress, nullptr, elementSize, pageInfo.fNElements);
+         newPage.GrowUnchecked(pageInfo.fNElements);
+         newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                           RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+         fCounters->fNPageRead.Inc();
+         return fPagePool.RegisterPage(std::move(newPage));
+      }
+      fCounters->fNPageRead.Inc();
+   } else if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff || IsDeferredColumn(columnId)) {
       directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.GetBufferSize()]);
       {
          Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
@@ -458,7 +665,7 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadPageImpl(ColumnHandle_t colum
       sealedPage.SetBuffer(directReadBuffer.get());
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
-         fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
+         fCurrentCluster = fClusterPool->GetCluster(clusterId, GetClusterColumnSet());
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPageRef = fPagePool.GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
@@ -597,8 +804,17 @@ ROOT::Experimental::Internal::RPageSourceFile::PrepareSingleCluster(
    fCounters->fSzReadOverhead.Add(szOverhead);
 
    // Register the on disk pages in a page map
-   auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
-   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(buffer));
+   const auto szBuffer = reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize;
+   unsigned char *buffer = nullptr;
+   std::unique_ptr<ROnDiskPageMap> pageMap;
+   if (fOptions.GetUseHugePages() && (static_cast<std::size_t>(szBuffer) >= ROnDiskPageMapHugePages::kHugePageSize)) {
+      auto hugePageMap = std::make_unique<ROnDiskPageMapHugePages>(szBuffer);
+      buffer = hugePageMap->GetMemory();
+      pageMap = std::move(hugePageMap);
+   } else {
+      buffer = new unsigned char[szBuffer];
+      pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(buffer));
+   }
    for (const auto &s : onDiskPages) {
       ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
@@ -616,21 +832,11 @@ ROOT::Experimental::Internal::RPageSourceFile::PrepareSingleCluster(
    return cluster;
 }
 
-std::vector<std::unique_ptr<ROOT::Experimental::Internal::RCluster>>
-ROOT::Experimental::Internal::RPageSourceFile::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+void ROOT::Experimental::Internal::RPageSourceFile::ReadRequests(ROOT::Internal::RRawFile &file,
+                                                                 ROOT::Internal::RRawFile::RIOVec *readRequests,
+                                                                 std::size_t nReqs)
 {
-   fCounters->fNClusterLoaded.Add(clusterKeys.size());
-
-   std::vector<std::unique_ptr<ROOT::Experimental::Internal::RCluster>> clusters;
-   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
-
-   clusters.reserve(clusterKeys.size());
-   for (auto key : clusterKeys) {
-      clusters.emplace_back(PrepareSingleCluster(key, readRequests));
-   }
-
-   auto nReqs = readRequests.size();
-   auto readvLimits = fFile->GetReadVLimits();
+   auto readvLimits = file.GetReadVLimits();
    // We never want to do vectorized reads of split blobs, so we limit our single size to maxKeySize.
    readvLimits.fMaxSingleSize = std::min<size_t>(readvLimits.fMaxSingleSize, fReader.GetMaxKeySize());
 
@@ -654,13 +860,15 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadClusters(std::span<RCluster::
          }
       }
 
-      if (nBatch <= 1) {
+      // Only fReader reads split blobs; LoadClusters() does not send them through one of fReadStreams
+      if ((nBatch <= 1) && (&file == fFile.get())) {
          nBatch = 1;
          Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
          fReader.ReadBuffer(readRequests[iReq].fBuffer, readRequests[iReq].fSize, readRequests[iReq].fOffset);
       } else {
+         nBatch = std::max<std::size_t>(nBatch, 1);
          Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-         fFile->ReadV(&readRequests[iReq], nBatch);
+         file.ReadV(&readRequests[iReq], nBatch);
       }
       fCounters->fNReadV.Inc();
       fCounters->fNRead.Add(nBatch);
@@ -668,6 +876,79 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadClusters(std::span<RCluster::
       iReq += nBatch;
       nReqs -= nBatch;
    }
+}
+
+std::vector<std::unique_ptr<ROOT::Experimental::Internal::RCluster>>
+ROOT::Experimental::Internal::RPageSourceFile::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+{
+   fCounters->fNClusterLoaded.Add(clusterKeys.size());
+
+   std::vector<std::unique_ptr<ROOT::Experimental::Internal::RCluster>> clusters;
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+
+   clusters.reserve(clusterKeys.size());
+   for (auto key : clusterKeys) {
+      clusters.emplace_back(PrepareSingleCluster(key, readRequests));
+   }
+
+   if (fReadStreams.empty() || readRequests.size() < 2) {
+      ReadRequests(*fFile, readRequests.data(), readRequests.size());
+      return clusters;
+   }
+
+   // Split blobs can only be read through fReader
+   const auto maxKeySize = fReader.GetMaxKeySize();
+   std::uint64_t totalSize = 0;
+   for (const auto &req : readRequests) {
+      if ((maxKeySize > 0) && (req.fSize > maxKeySize)) {
+         ReadRequests(*fFile, readRequests.data(), readRequests.size());
+         return clusters;
+      }
+      totalSize += req.fSize;
+   }
+
+   // Distribute consecutive read requests of roughly equal total size over the streams. The first share is read
+   // by the calling thread through fFile.
+   const std::size_t nStreams = std::min(fReadStreams.size() + 1, readRequests.size());
+   std::vector<std::future<void>> futures;
+   std::size_t firstReqMain = 0;
+   std::size_t nReqsMain = 0;
+   std::size_t iReq = 0;
+   std::uint64_t sizeUpToReq = 0;
+   for (std::size_t i = 0; i < nStreams; ++i) {
+      const std::size_t firstReq = iReq;
+      const std::uint64_t shareEnd = totalSize * (i + 1) / nStreams;
+      while ((iReq < readRequests.size()) && ((iReq == firstReq) || (sizeUpToReq < shareEnd))) {
+         sizeUpToReq += readRequests[iReq].fSize;
+         ++iReq;
+      }
+      if (i == nStreams - 1)
+         iReq = readRequests.size();
+      if (iReq == firstReq)
+         break;
+
+      if (i == 0) {
+         firstReqMain = firstReq;
+         nReqsMain = iReq - firstReq;
+      } else {
+         futures.emplace_back(std::async(std::launch::async, [this, i, firstReq, nReqs = iReq - firstReq,
+                                                              reqs = readRequests.data()]() {
+            ReadRequests(*fReadStreams[i - 1], reqs + firstReq, nReqs);
+         }));
+      }
+   }
+   ReadRequests(*fFile, readRequests.data() + firstReqMain, nReqsMain);
+   for (auto &f : futures)
+      f.get();
 
    return clusters;
 }
+
+std::string ROOT::Experimental::Internal::RPageSourceFile::GetStorageId() const
+{
+   // The anchor's locators distinguish between different incarnations of the same file path
+   if (!fAnchor)
+      return "";
+   return fFile->GetUrl() + "#" + std::to_string(fAnchor->GetSeekHeader()) + "_" +
+          std::to_string(fAnchor->GetSeekFooter());
+}
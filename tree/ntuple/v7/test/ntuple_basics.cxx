@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <limits>
+
 TEST(RNTuple, ReconstructModel)
 {
    FileRaii fileGuard("test_ntuple_reconstruct.root");
@@ -304,6 +306,88 @@ TEST(RNTuple, Clusters)
    EXPECT_EQ(24.0, (*rdFourVec)[1]);
 }
 
+TEST(RNTuple, ColumnStatistics)
+{
+   FileRaii fileGuard("test_ntuple_column_statistics.root");
+
+   for (bool useBufferedWrite : {false, true}) {
+      auto model = RNTupleModel::Create();
+      auto ptrPt = model->MakeField<float>("pt");
+      auto ptrId = model->MakeField<std::int64_t>("id");
+      auto ptrTag = model->MakeField<std::string>("tag");
+      auto ptrHits = model->MakeField<std::vector<std::uint16_t>>("hits");
+      {
+         RNTupleWriteOptions options;
+         options.SetUseBufferedWrite(useBufferedWrite);
+         options.SetEnableColumnStatistics(true);
+         auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+         for (int i = 0; i < 10; ++i) {
+            *ptrPt = 0.5 * i;
+            *ptrId = -i;
+            *ptrTag = std::to_string(i);
+            *ptrHits = {static_cast<std::uint16_t>(100 + i), static_cast<std::uint16_t>(200 + i)};
+            writer->Fill();
+         }
+         writer->CommitCluster();
+         *ptrPt = std::numeric_limits<float>::quiet_NaN();
+         *ptrId = std::numeric_limits<std::int64_t>::max();
+         ptrHits->clear();
+         writer->Fill();
+      }
+
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      const auto &desc = reader->GetDescriptor();
+      ASSERT_EQ(2u, desc.GetNClusters());
+      const auto &cluster0 = desc.GetClusterDescriptor(desc.FindClusterId(0, 0));
+      const auto &cluster1 = desc.GetClusterDescriptor(desc.FindClusterId(0, 10));
+
+      auto fnGetColumnId = [&](const std::string &fieldName, std::uint32_t columnIndex = 0) {
+         return desc.FindPhysicalColumnId(desc.FindFieldId(fieldName), columnIndex, 0);
+      };
+
+      auto minMaxPt = cluster0.GetColumnRange(fnGetColumnId("pt")).fMinMax;
+      ASSERT_TRUE(minMaxPt.has_value());
+      EXPECT_DOUBLE_EQ(0.0, minMaxPt->first);
+      EXPECT_DOUBLE_EQ(4.5, minMaxPt->second);
+      // NaN values are ignored; no non-NaN values leave the column range without statistics
+      EXPECT_FALSE(cluster1.GetColumnRange(fnGetColumnId("pt")).fMinMax.has_value());
+
+      auto minMaxId = cluster0.GetColumnRange(fnGetColumnId("id")).fMinMax;
+      ASSERT_TRUE(minMaxId.has_value());
+      EXPECT_LE(minMaxId->first, -9.0);
+      EXPECT_GE(minMaxId->second, 0.0);
+      minMaxId = cluster1.GetColumnRange(fnGetColumnId("id")).fMinMax;
+      ASSERT_TRUE(minMaxId.has_value());
+      EXPECT_LE(minMaxId->first, static_cast<double>(std::numeric_limits<std::int64_t>::max()));
+      EXPECT_GE(minMaxId->second, static_cast<double>(std::numeric_limits<std::int64_t>::max()));
+
+      const auto hitsItemId = desc.FindFieldId("_0", desc.FindFieldId("hits"));
+      auto minMaxHits = cluster0.GetColumnRange(desc.FindPhysicalColumnId(hitsItemId, 0, 0)).fMinMax;
+      ASSERT_TRUE(minMaxHits.has_value());
+      EXPECT_DOUBLE_EQ(100.0, minMaxHits->first);
+      EXPECT_DOUBLE_EQ(209.0, minMaxHits->second);
+
+      // No statistics for offset and character columns
+      EXPECT_FALSE(cluster0.GetColumnRange(fnGetColumnId("hits")).fMinMax.has_value());
+      EXPECT_FALSE(cluster0.GetColumnRange(fnGetColumnId("tag", 0)).fMinMax.has_value());
+      EXPECT_FALSE(cluster0.GetColumnRange(fnGetColumnId("tag", 1)).fMinMax.has_value());
+   }
+
+   {
+      // Statistics are off by default
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      {
+         auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+         writer->Fill();
+      }
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      const auto &desc = reader->GetDescriptor();
+      const auto &cluster0 = desc.GetClusterDescriptor(desc.FindClusterId(0, 0));
+      EXPECT_FALSE(cluster0.GetColumnRange(desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0, 0)).fMinMax);
+   }
+}
+
 TEST(RNTuple, ClusterEntries)
 {
    FileRaii fileGuard("test_ntuple_cluster_entries.root");
@@ -49,6 +49,8 @@ public:
    /// Records the cluster IDs requests by LoadClusters() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Internal::RCluster::ColumnSet_t> fReqsColumns;
+   /// Records the number of clusters requested by every LoadClusters() call
+   std::vector<std::size_t> fReqsBunchSizes;
 
    RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions())
    {
@@ -75,6 +77,7 @@ public:
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final
    {
       std::vector<std::unique_ptr<RCluster>> result;
+      fReqsBunchSizes.emplace_back(clusterKeys.size());
       for (auto key : clusterKeys) {
          fReqsClusterIds.emplace_back(key.fClusterId);
          fReqsColumns.emplace_back(key.fPhysicalColumnSet);
@@ -102,6 +105,28 @@ TEST(Cluster, Allocate)
    delete cluster;
 }
 
+TEST(Cluster, AllocateHugePages)
+{
+   using ROOT::Experimental::Internal::ROnDiskPageMapHugePages;
+   const std::size_t size = ROnDiskPageMapHugePages::kHugePageSize + 1;
+   auto pageMap = std::make_unique<ROnDiskPageMapHugePages>(size);
+   auto memory = pageMap->GetMemory();
+   ASSERT_NE(nullptr, memory);
+   EXPECT_EQ(0, memory[0]);
+   EXPECT_EQ(0, memory[size - 1]);
+   memory[0] = 1;
+   memory[size - 1] = 2;
+   pageMap->Register(ROnDiskPage::Key(0, 0), ROnDiskPage(memory, size));
+
+   RCluster cluster(0);
+   cluster.Adopt(std::move(pageMap));
+   cluster.SetColumnAvailable(0);
+   auto onDiskPage = cluster.GetOnDiskPage(ROnDiskPage::Key(0, 0));
+   ASSERT_NE(nullptr, onDiskPage);
+   EXPECT_EQ(1, static_cast<const unsigned char *>(onDiskPage->GetAddress())[0]);
+   EXPECT_EQ(2, static_cast<const unsigned char *>(onDiskPage->GetAddress())[size - 1]);
+}
+
 TEST(Cluster, Basics)
 {
    auto memory = new unsigned char[3];
@@ -255,6 +280,43 @@ TEST(ClusterPool, GetClusterBasics)
    EXPECT_EQ(5U, p4.fReqsClusterIds[3]);
 }
 
+TEST(ClusterPool, BunchesInFlight)
+{
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 1);
+      c1.GetCluster(0, {0});
+      c1.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   ASSERT_EQ(2U, p1.fReqsBunchSizes.size());
+   EXPECT_EQ(1U, p1.fReqsBunchSizes[0]);
+   EXPECT_EQ(1U, p1.fReqsBunchSizes[1]);
+
+   RPageSourceMock p2;
+   {
+      RClusterPool c2(p2, 1, 3);
+      c2.GetCluster(0, {0});
+      c2.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(4U, p2.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i, p2.fReqsClusterIds[i]);
+   ASSERT_EQ(1U, p2.fReqsBunchSizes.size());
+   EXPECT_EQ(4U, p2.fReqsBunchSizes[0]);
+
+   RPageSourceMock p3;
+   {
+      RClusterPool c3(p3, 2, 2);
+      c3.GetCluster(0, {0});
+      c3.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(6U, p3.fReqsClusterIds.size());
+   ASSERT_EQ(2U, p3.fReqsBunchSizes.size());
+   EXPECT_EQ(4U, p3.fReqsBunchSizes[0]);
+   EXPECT_EQ(2U, p3.fReqsBunchSizes[1]);
+}
+
 TEST(ClusterPool, SetEntryRange)
 {
    RPageSourceMock p1;
@@ -367,6 +429,58 @@ TEST(PageStorageFile, LoadClusters)
    EXPECT_EQ(1U, clusters[1]->GetNOnDiskPages());
 }
 
+TEST(ClusterPool, SharedClusterCache)
+{
+   using ROOT::Experimental::Internal::RSharedClusterCache;
+
+   FileRaii fileGuard("test_ntuple_clusterpool_sharedcache.root");
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto writer = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = i;
+         writer->Fill();
+         writer->CommitCluster();
+      }
+   }
+
+   auto &sharedCache = RSharedClusterCache::Instance();
+   sharedCache.Clear();
+   EXPECT_EQ(0u, sharedCache.GetMemoryUsage());
+
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetUseSharedClusterCache(true);
+   options.SetMetricsEnabled(true);
+   auto readAll = [&]() {
+      auto reader = ROOT::Experimental::RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto viewPt = reader->GetView<float>("pt");
+      for (auto i : reader->GetEntryRange())
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      return reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szReadPayload")->GetValueAsInt();
+   };
+
+   EXPECT_GT(readAll(), 0);
+   const auto memoryUsage = sharedCache.GetMemoryUsage();
+   // Three clusters with a single page each
+   EXPECT_GT(memoryUsage, 0u);
+   EXPECT_EQ(0u, memoryUsage % 3);
+   const auto clusterSize = memoryUsage / 3;
+   // The second reader is served entirely from the shared cache
+   EXPECT_EQ(0, readAll());
+   EXPECT_EQ(memoryUsage, sharedCache.GetMemoryUsage());
+
+   // Only the most recently used cluster fits in the budget
+   sharedCache.SetMemoryBudget(clusterSize);
+   EXPECT_EQ(clusterSize, sharedCache.GetMemoryUsage());
+   EXPECT_GT(readAll(), 0);
+   EXPECT_EQ(clusterSize, sharedCache.GetMemoryUsage());
+
+   sharedCache.SetMemoryBudget(RSharedClusterCache::kDefaultMemoryBudget);
+   sharedCache.Clear();
+   EXPECT_EQ(0u, sharedCache.GetMemoryUsage());
+}
+
 #ifdef R__USE_IMT
 TEST(PageStorageFile, LoadClustersIMT)
 {
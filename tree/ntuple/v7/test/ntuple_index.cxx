@@ -257,3 +257,97 @@ TEST(RNTupleIndex, MultipleMatches)
    entryIdxs = index->GetAllEntryNumbers<std::uint64_t>(4);
    EXPECT_EQ(nullptr, entryIdxs);
 }
+
+TEST(RNTupleIndex, Persistent)
+{
+   FileRaii fileGuard("test_ntuple_index_persistent.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldRun = model->MakeField<std::int16_t>("run");
+      auto fldEvent = model->MakeField<std::uint64_t>("event");
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+
+      // Fill in reverse order such that the persistent index differs from the entry order
+      for (int i = 2; i >= 0; --i) {
+         *fldRun = i;
+         for (int j = 4; j >= 0; --j) {
+            *fldEvent = j % 3;
+            ntuple->Fill();
+         }
+      }
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+   {
+      auto index = RNTupleIndex::Create({"run", "event"}, *pageSource);
+      std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      index->Write(*file);
+   }
+
+   try {
+      RNTupleIndex::Open({"event", "run"}, *pageSource, fileGuard.GetPath());
+      FAIL() << "opening a non-existing persistent index should fail";
+   } catch (const RException &) {
+      // expected
+   }
+
+   auto builtIndex = RNTupleIndex::Create({"run", "event"}, *pageSource);
+   auto index = RNTupleIndex::Open({"run", "event"}, *pageSource, fileGuard.GetPath());
+   EXPECT_TRUE(index->IsBuilt());
+   EXPECT_EQ(builtIndex->GetSize(), index->GetSize());
+   EXPECT_EQ(9U, index->GetSize());
+
+   for (std::int16_t run = 0; run < 3; ++run) {
+      for (std::uint64_t event = 0; event < 3; ++event) {
+         auto expected = builtIndex->GetAllEntryNumbers<std::int16_t, std::uint64_t>(run, event);
+         auto actual = index->GetAllEntryNumbers<std::int16_t, std::uint64_t>(run, event);
+         ASSERT_NE(nullptr, actual);
+         EXPECT_EQ(*expected, *actual);
+         EXPECT_EQ((builtIndex->GetFirstEntryNumber<std::int16_t, std::uint64_t>(run, event)),
+                   (index->GetFirstEntryNumber<std::int16_t, std::uint64_t>(run, event)));
+      }
+   }
+   EXPECT_EQ(nullptr, (index->GetAllEntryNumbers<std::int16_t, std::uint64_t>(3, 0)));
+   EXPECT_EQ(nullptr, (index->GetAllEntryNumbers<std::int16_t, std::uint64_t>(1, 3)));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, (index->GetFirstEntryNumber<std::int16_t, std::uint64_t>(1, 3)));
+}
+
+#ifdef R__USE_IMT
+TEST(RNTupleIndex, BuildParallel)
+{
+   FileRaii fileGuard("test_ntuple_index_build_parallel.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldRun = model->MakeField<std::uint32_t>("run");
+      auto fldEvent = model->MakeField<std::uint64_t>("event");
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+
+      for (int i = 0; i < 1000; ++i) {
+         *fldRun = i % 7;
+         *fldEvent = i % 13;
+         ntuple->Fill();
+         if (i % 50 == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+   auto serialIndex = RNTupleIndex::Create({"run", "event"}, *pageSource);
+
+   IMTRAII _;
+   auto parallelIndex = RNTupleIndex::Create({"run", "event"}, *pageSource);
+
+   EXPECT_EQ(serialIndex->GetSize(), parallelIndex->GetSize());
+   for (std::uint32_t run = 0; run < 7; ++run) {
+      for (std::uint64_t event = 0; event < 13; ++event) {
+         auto expected = serialIndex->GetAllEntryNumbers<std::uint32_t, std::uint64_t>(run, event);
+         auto actual = parallelIndex->GetAllEntryNumbers<std::uint32_t, std::uint64_t>(run, event);
+         ASSERT_NE(nullptr, expected);
+         ASSERT_NE(nullptr, actual);
+         EXPECT_EQ(*expected, *actual);
+      }
+   }
+}
+#endif
@@ -994,3 +994,60 @@ TEST(RNTupleMerger, MergeLateModelExtension)
       }
    }
 }
+
+#ifdef R__USE_IMT
+TEST(RNTupleMerger, ChangeCompressionIMT)
+{
+   IMTRAII _;
+
+   FileRaii fileGuard1("test_ntuple_merge_changecomp_imt_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_changecomp_imt_in_2.root");
+   for (const auto &path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto fieldFoo = model->MakeField<int>("foo", 0);
+      auto fieldBar = model->MakeField<std::vector<float>>("bar");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path);
+      for (int i = 0; i < 1000; ++i) {
+         *fieldFoo = i;
+         fieldBar->assign(i % 10, i);
+         ntuple->Fill();
+         // Many small clusters, such that several of them are in flight
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   FileRaii fileGuardOut("test_ntuple_merge_changecomp_imt_out.root");
+   {
+      std::vector<std::unique_ptr<RPageSource>> sources;
+      sources.push_back(RPageSource::Create("ntuple", fileGuard1.GetPath(), RNTupleReadOptions()));
+      sources.push_back(RPageSource::Create("ntuple", fileGuard2.GetPath(), RNTupleReadOptions()));
+      std::vector<RPageSource *> sourcePtrs;
+      for (const auto &s : sources) {
+         sourcePtrs.push_back(s.get());
+      }
+
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuardOut.GetPath(), RNTupleWriteOptions());
+      RNTupleMerger merger;
+      auto opts = RNTupleMergeOptions{};
+      opts.fCompressionSettings = 101;
+      opts.fMaxClustersInFlight = 3;
+      auto res = merger.Merge(sourcePtrs, *destination, opts);
+      EXPECT_TRUE(bool(res));
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuardOut.GetPath());
+   ASSERT_EQ(2000, reader->GetNEntries());
+   EXPECT_EQ(20, reader->GetDescriptor().GetNClusters());
+   auto foo = reader->GetModel().GetDefaultEntry().GetPtr<int>("foo");
+   auto bar = reader->GetModel().GetDefaultEntry().GetPtr<std::vector<float>>("bar");
+   for (int i = 0; i < 2000; ++i) {
+      reader->LoadEntry(i);
+      // The clusters are in the original order
+      EXPECT_EQ(i % 1000, *foo);
+      ASSERT_EQ(static_cast<std::size_t>(i % 10), bar->size());
+      for (auto v : *bar)
+         EXPECT_FLOAT_EQ(i % 1000, v);
+   }
+}
+#endif
@@ -1,6 +1,10 @@
 #include "ntuple_test.hxx"
 
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <string>
 
 TEST(Metrics, Counters)
 {
@@ -112,3 +116,64 @@ TEST(Metrics, RNTupleWriter)
    // one page for the int field, one for the float field
    EXPECT_EQ(2, page_counter->GetValueAsInt());
 }
+
+TEST(Metrics, JSON)
+{
+   RNTupleMetrics inner("inner");
+   auto ctr = inner.MakeCounter<RNTuplePlainCounter *>("plain", "s", "say \"hello\"");
+   RNTupleMetrics outer("outer");
+   outer.ObserveMetrics(inner);
+
+   std::ostringstream os;
+   outer.PrintJSON(os);
+   EXPECT_EQ("{\"name\": \"outer\", \"counters\": []}", os.str());
+
+   outer.Enable();
+   ctr->Add(42);
+   os.str("");
+   outer.PrintJSON(os);
+   EXPECT_EQ("{\"name\": \"outer\", \"counters\": [{\"name\": \"outer.inner.plain\", \"unit\": \"s\", "
+             "\"description\": \"say \\\"hello\\\"\", \"value\": 42}]}",
+             os.str());
+}
+
+TEST(Metrics, Registry)
+{
+   FileRaii fileGuard("test_ntuple_metrics_registry.root");
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<int>("ints") = 7;
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      writer->Fill();
+   }
+
+   auto &registry = ROOT::Experimental::Detail::RNTupleMetricsRegistry::Instance();
+   EXPECT_EQ(std::string::npos, registry.GetSnapshotJSON().find("RNTupleReader"));
+
+   std::mutex lock;
+   std::condition_variable cvPushed;
+   std::string lastSnapshot;
+   {
+      auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+      reader->EnableMetrics();
+      reader->LoadEntry(0);
+
+      auto snapshot = registry.GetSnapshotJSON();
+      EXPECT_EQ(0u, snapshot.find("{\"timestamp\": "));
+      EXPECT_NE(std::string::npos, snapshot.find("{\"name\": \"RNTupleReader\""));
+      EXPECT_NE(std::string::npos, snapshot.find("\"name\": \"RNTupleReader.RPageSourceFile.nPageRead\""));
+
+      registry.SetPushCallback(
+         [&](const std::string &s) {
+            std::lock_guard<std::mutex> guard(lock);
+            lastSnapshot = s;
+            cvPushed.notify_one();
+         },
+         std::chrono::milliseconds(1));
+      std::unique_lock<std::mutex> guard(lock);
+      EXPECT_TRUE(cvPushed.wait_for(guard, std::chrono::seconds(10), [&] { return !lastSnapshot.empty(); }));
+   }
+   registry.ResetPushCallback();
+   EXPECT_NE(std::string::npos, lastSnapshot.find("\"metrics\": ["));
+   EXPECT_EQ(std::string::npos, registry.GetSnapshotJSON().find("RNTupleReader"));
+}
@@ -5,7 +5,9 @@
 #include <TVector3.h>
 #include <TVirtualStreamerInfo.h>
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 using ROOT::Experimental::Internal::RNTupleWriteOptionsManip;
 
@@ -91,6 +93,46 @@ TEST(MiniFile, Stream)
    EXPECT_TRUE(IsEqual(ntuple, RNTupleTester(*k).GetAnchor()));
 }
 
+TEST(MiniFile, WriteBehind)
+{
+   FileRaii fileGuard("test_ntuple_minifile_write_behind.root");
+
+   RNTupleWriteOptions options;
+   options.SetWriteBufferSize(4096);
+   options.SetPageBufferBudget(2 * 4096);
+   options.SetUseWriteBehind(true);
+   auto writer = RNTupleFileWriter::Recreate("MyNTuple", fileGuard.GetPath(), EContainerFormat::kTFile, options);
+
+   char header = 'h';
+   char footer = 'f';
+   auto offHeader = writer->WriteNTupleHeader(&header, 1, 1);
+   // Enough blobs to fill many blocks of the write buffer
+   std::vector<std::uint64_t> offBlobs;
+   std::vector<char> blob(1000);
+   for (int i = 0; i < 100; ++i) {
+      std::fill(blob.begin(), blob.end(), static_cast<char>(i));
+      offBlobs.emplace_back(writer->WriteBlob(blob.data(), blob.size(), blob.size()));
+   }
+   auto offFooter = writer->WriteNTupleFooter(&footer, 1, 1);
+   writer->Commit();
+
+   auto rawFile = RRawFile::Create(fileGuard.GetPath());
+   RMiniFileReader reader(rawFile.get());
+   auto ntuple = reader.GetNTuple("MyNTuple").Inspect();
+   EXPECT_EQ(offHeader, ntuple.GetSeekHeader());
+   EXPECT_EQ(offFooter, ntuple.GetSeekFooter());
+
+   char buf;
+   reader.ReadBuffer(&buf, 1, offHeader);
+   EXPECT_EQ(header, buf);
+   reader.ReadBuffer(&buf, 1, offFooter);
+   EXPECT_EQ(footer, buf);
+   for (int i = 0; i < 100; ++i) {
+      reader.ReadBuffer(blob.data(), blob.size(), offBlobs[i]);
+      EXPECT_EQ(std::count(blob.begin(), blob.end(), static_cast<char>(i)), blob.size());
+   }
+}
+
 TEST(MiniFile, Proper)
 {
    FileRaii fileGuard("test_ntuple_minifile_proper.root");
@@ -238,6 +238,67 @@ TYPED_TEST(PackingIndex, SplitIndex)
    EXPECT_EQ(mem, cmp);
 }
 
+// Use a number of elements that is not a multiple of the vectorized unsplit block size (16 elements)
+TYPED_TEST(PackingReal, SplitRealBlocks)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+
+   auto element = RColumnElementBase::Generate<Pod_t>(TestFixture::Helper_t::kColumnType);
+
+   std::array<Pod_t, 37> mem;
+   for (std::size_t i = 0; i < mem.size(); ++i)
+      mem[i] = (i % 2 ? -1.0 : 1.0) * (i * 3.25 + 0.5);
+   std::array<Pod_t, 37> packed;
+   std::array<Pod_t, 37> cmp;
+
+   element->Pack(packed.data(), mem.data(), mem.size());
+   element->Unpack(cmp.data(), packed.data(), mem.size());
+
+   EXPECT_EQ(mem, cmp);
+}
+
+TYPED_TEST(PackingInt, SplitIntBlocks)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+   using Narrow_t = typename TestFixture::Helper_t::Narrow_t;
+
+   auto element = RColumnElementBase::Generate<Pod_t>(TestFixture::Helper_t::kColumnType);
+
+   std::array<Pod_t, 37> mem;
+   for (std::size_t i = 0; i < mem.size(); ++i) {
+      mem[i] = static_cast<Pod_t>(i * 977);
+      if (std::is_signed_v<Pod_t> && (i % 3 == 0))
+         mem[i] = -mem[i];
+   }
+   mem[17] = std::numeric_limits<Narrow_t>::min();
+   mem[18] = std::numeric_limits<Narrow_t>::max();
+   std::array<Pod_t, 37> packed;
+   std::array<Pod_t, 37> cmp;
+
+   element->Pack(packed.data(), mem.data(), mem.size());
+   element->Unpack(cmp.data(), packed.data(), mem.size());
+
+   EXPECT_EQ(mem, cmp);
+}
+
+TYPED_TEST(PackingIndex, SplitIndexBlocks)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+
+   auto element = RColumnElementBase::Generate<ClusterSize_t>(TestFixture::Helper_t::kColumnType);
+
+   std::array<Pod_t, 37> mem;
+   for (std::size_t i = 0; i < mem.size(); ++i)
+      mem[i] = i * (i + 1) / 2;
+   std::array<Pod_t, 37> packed;
+   std::array<Pod_t, 37> cmp;
+
+   element->Pack(packed.data(), mem.data(), mem.size());
+   element->Unpack(cmp.data(), packed.data(), mem.size());
+
+   EXPECT_EQ(mem, cmp);
+}
+
 template <typename PodT, EColumnType ColumnT>
 static void AddField(RNTupleModel &model, const std::string &fieldName)
 {
@@ -1052,6 +1113,102 @@ TEST(Packing, Real32QuantDouble)
       }
    }
 }
+
+TEST(Packing, IntFOR)
+{
+   namespace BitPacking = ROOT::Experimental::Internal::BitPacking;
+   {
+      constexpr auto kBitsOnStorage = 3;
+      RColumnElement<std::int32_t, EColumnType::kIntFOR> element;
+      element.SetBitsOnStorage(kBitsOnStorage);
+      element.SetValueRange(-2, 5);
+      element.Pack(nullptr, nullptr, 0);
+      element.Unpack(nullptr, nullptr, 0);
+
+      std::int32_t i[9] = {-2, -1, 0, 1, 2, 3, 4, 5, 0};
+      unsigned char out[BitPacking::MinBufSize(std::size(i), kBitsOnStorage)];
+      static_assert(sizeof(out) == 4);
+      element.Pack(out, i, std::size(i));
+      std::int32_t i2[std::size(i)];
+      element.Unpack(i2, out, std::size(i));
+      for (std::size_t j = 0; j < std::size(i); ++j)
+         EXPECT_EQ(i[j], i2[j]);
+
+      i[3] = 6;
+      EXPECT_THROW(element.Pack(out, i, std::size(i)), RException);
+   }
+
+   {
+      RColumnElement<std::uint64_t, EColumnType::kIntFOR> element;
+      element.SetBitsOnStorage(32);
+      element.SetValueRange(1e15, 1e15 + 0xFFFFFFFF);
+
+      std::uint64_t u[3] = {1000000000000000ull, 1000000000000000ull + 0xFFFFFFFF, 1000000000000042ull};
+      unsigned char out[BitPacking::MinBufSize(std::size(u), 32)];
+      element.Pack(out, u, std::size(u));
+      std::uint64_t u2[std::size(u)];
+      element.Unpack(u2, out, std::size(u));
+      for (std::size_t j = 0; j < std::size(u); ++j)
+         EXPECT_EQ(u[j], u2[j]);
+   }
+
+   FileRaii fileGuard("test_ntuple_packing_int_for.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldRun = std::make_unique<RField<std::uint32_t>>("run");
+      fldRun->SetFrameOfReference(300000, 300100);
+      model->AddField(std::move(fldRun));
+      auto fldTrigger = std::make_unique<RField<std::int16_t>>("trigger");
+      fldTrigger->SetFrameOfReference(-1, 1);
+      model->AddField(std::move(fldTrigger));
+      auto fldLarge = std::make_unique<RField<std::uint64_t>>("large");
+      EXPECT_THROW(fldLarge->SetFrameOfReference(0, 0x100000000ull), RException);
+      EXPECT_THROW(fldLarge->SetFrameOfReference(1, 0), RException);
+
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto ptrRun = writer->GetModel().GetDefaultEntry().GetPtr<std::uint32_t>("run");
+      auto ptrTrigger = writer->GetModel().GetDefaultEntry().GetPtr<std::int16_t>("trigger");
+      for (int i = 0; i < 100; ++i) {
+         *ptrRun = 300000 + i;
+         *ptrTrigger = (i % 3) - 1;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   {
+      const auto &desc = reader->GetDescriptor();
+      const auto &colRun = desc.GetColumnDescriptor(desc.FindPhysicalColumnId(desc.FindFieldId("run"), 0, 0));
+      EXPECT_EQ(EColumnType::kIntFOR, colRun.GetType());
+      EXPECT_EQ(7u, colRun.GetBitsOnStorage());
+      const auto &colTrigger = desc.GetColumnDescriptor(desc.FindPhysicalColumnId(desc.FindFieldId("trigger"), 0, 0));
+      EXPECT_EQ(EColumnType::kIntFOR, colTrigger.GetType());
+      EXPECT_EQ(2u, colTrigger.GetBitsOnStorage());
+   }
+   auto viewRun = reader->GetView<std::uint32_t>("run");
+   auto viewTrigger = reader->GetView<std::int16_t>("trigger");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(300000 + i, viewRun(i));
+      EXPECT_EQ(static_cast<std::int16_t>((i % 3) - 1), viewTrigger(i));
+   }
+}
+
+TEST(Packing, IntFORWithoutRange)
+{
+   // The IntFOR representation is listed among the valid ones but it is only usable with a value range
+   FileRaii fileGuard("test_ntuple_packing_int_for_no_range.root");
+   auto model = RNTupleModel::Create();
+   auto fld = std::make_unique<RField<std::int32_t>>("px");
+   fld->SetColumnRepresentatives({{EColumnType::kIntFOR}});
+   model->AddField(std::move(fld));
+   try {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      FAIL() << "IntFOR column without SetFrameOfReference() should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("requires SetFrameOfReference()"));
+   }
+}
+
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif
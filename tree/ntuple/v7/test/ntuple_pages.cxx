@@ -11,6 +11,46 @@ TEST(Pages, Allocation)
    EXPECT_EQ(0U, page.GetNBytes());
 }
 
+TEST(Pages, AllocatorPool)
+{
+   RPageAllocatorPool allocator(64 + 1024);
+
+   void *buffer = nullptr;
+   {
+      auto page = allocator.NewPage(42, 4, 16);
+      EXPECT_FALSE(page.IsNull());
+      EXPECT_EQ(16U, page.GetMaxElements());
+      buffer = page.GetBuffer();
+      EXPECT_EQ(0U, allocator.GetCachedBytes());
+   }
+   EXPECT_EQ(64U, allocator.GetCachedBytes());
+
+   {
+      // Same size class, the buffer is recycled
+      auto page = allocator.NewPage(1, 1, 50);
+      EXPECT_EQ(buffer, page.GetBuffer());
+      EXPECT_EQ(0U, allocator.GetCachedBytes());
+
+      // Different size class
+      auto otherPage = allocator.NewPage(1, 8, 100);
+      EXPECT_NE(buffer, otherPage.GetBuffer());
+   }
+   EXPECT_EQ(64U + 1024U, allocator.GetCachedBytes());
+
+   {
+      // Exceeds the memory bound of the pool upon release
+      auto page = allocator.NewPage(1, 1, 65);
+   }
+   EXPECT_EQ(64U + 1024U, allocator.GetCachedBytes());
+
+   {
+      // Larger than the largest size class
+      auto page = allocator.NewPage(1, 1, (std::size_t(1) << RPageAllocatorPool::kMaxSizeClassLog2) + 1);
+      EXPECT_FALSE(page.IsNull());
+   }
+   EXPECT_EQ(64U + 1024U, allocator.GetCachedBytes());
+}
+
 TEST(Pages, Pool)
 {
    RPageAllocatorHeap allocator;
@@ -276,6 +276,59 @@ TEST(RNTupleParallelWriter, Options)
    }
 }
 
+TEST(RNTupleParallelWriter, UnbufferedWrites)
+{
+   FileRaii fileGuard("test_ntuple_parallel_unbuffered.root");
+
+   static constexpr int kNThreads = 4;
+   static constexpr std::uint64_t kNEntriesPerThread = 20000;
+
+   {
+      auto model = RNTupleModel::CreateBare();
+      model->MakeField<std::uint64_t>("val");
+
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      // With a small write buffer, most of the cluster data is written outside of the sink guard.
+      options.SetWriteBufferSize(4096);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; t++) {
+         threads.emplace_back([&writer, t]() {
+            auto c = writer->CreateFillContext();
+            auto e = c->CreateEntry();
+            auto val = e->GetPtr<std::uint64_t>("val");
+            for (std::uint64_t i = 0; i < kNEntriesPerThread; i++) {
+               *val = (static_cast<std::uint64_t>(t) << 32) | i;
+               c->Fill(*e);
+               if (i % 5000 == 4999)
+                  c->FlushCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto reader = RNTupleReader::Open("f", fileGuard.GetPath());
+   ASSERT_EQ(reader->GetNEntries(), kNThreads * kNEntriesPerThread);
+   EXPECT_EQ(reader->GetDescriptor().GetNClusters(), kNThreads * kNEntriesPerThread / 5000);
+
+   auto viewVal = reader->GetView<std::uint64_t>("val");
+   std::vector<std::uint64_t> nextPerThread(kNThreads, 0);
+   for (auto i : reader->GetEntryRange()) {
+      const auto val = viewVal(i);
+      const auto t = val >> 32;
+      ASSERT_LT(t, kNThreads);
+      // Entries of the same context are in order.
+      EXPECT_EQ(val & 0xFFFFFFFF, nextPerThread[t]);
+      nextPerThread[t]++;
+   }
+   for (auto n : nextPerThread)
+      EXPECT_EQ(n, kNEntriesPerThread);
+}
+
 TEST(RNTupleFillContext, FlushColumns)
 {
    FileRaii fileGuard("test_ntuple_context_flush.root");
@@ -296,3 +296,62 @@ TEST(RNTupleProcessor, ChainUnalignedModels)
       EXPECT_THAT(err.what(), testing::HasSubstr("field \"y\" not found in current RNTuple"));
    }
 }
+
+namespace {
+void CheckProcessParallel(const std::vector<RNTupleSourceSpec> &ntuples, std::uint64_t nExpectedEntries,
+                          unsigned int nSlots)
+{
+   std::vector<std::vector<std::uint64_t>> seenEntries(nSlots);
+   std::vector<float> sums(nSlots);
+
+   RNTupleProcessor processor(ntuples);
+   processor.ProcessParallel([&](unsigned int slot, ROOT::Experimental::NTupleSize_t globalIndex,
+                                 const ROOT::Experimental::REntry &entry) {
+      ASSERT_LT(slot, nSlots);
+      auto x = entry.GetPtr<float>("x");
+      EXPECT_EQ(static_cast<float>(globalIndex), *x);
+      seenEntries[slot].emplace_back(globalIndex);
+      sums[slot] += *x;
+   });
+
+   std::vector<std::uint64_t> allEntries;
+   for (const auto &entries : seenEntries)
+      allEntries.insert(allEntries.end(), entries.begin(), entries.end());
+   std::sort(allEntries.begin(), allEntries.end());
+   ASSERT_EQ(nExpectedEntries, allEntries.size());
+   for (std::uint64_t i = 0; i < nExpectedEntries; ++i)
+      EXPECT_EQ(i, allEntries[i]);
+
+   float sum = 0;
+   for (auto s : sums)
+      sum += s;
+   EXPECT_FLOAT_EQ(static_cast<float>(nExpectedEntries * (nExpectedEntries - 1) / 2), sum);
+}
+} // anonymous namespace
+
+TEST(RNTupleProcessor, ProcessParallel)
+{
+   FileRaii fileGuard1("test_ntuple_processor_parallel1.root");
+   FileRaii fileGuard2("test_ntuple_processor_parallel2.root");
+   unsigned int globalIndex = 0;
+   for (const auto path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto fldX = model->MakeField<float>("x");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path);
+
+      for (unsigned i = 0; i < 100; ++i) {
+         *fldX = static_cast<float>(globalIndex++);
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   std::vector<RNTupleSourceSpec> ntuples = {{"ntuple", fileGuard1.GetPath()}, {"ntuple", fileGuard2.GetPath()}};
+   CheckProcessParallel(ntuples, 200, 1);
+
+#ifdef R__USE_IMT
+   IMTRAII _;
+   CheckProcessParallel(ntuples, 200, ROOT::GetThreadPoolSize());
+#endif
+}
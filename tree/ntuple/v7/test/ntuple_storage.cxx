@@ -286,6 +286,58 @@ TEST(RNTuple, PageFillingString)
    EXPECT_EQ(10u, pr4.fPageInfos[1].fNElements);
 }
 
+TEST(RNTuple, PageFillingAdaptive)
+{
+   FileRaii fileGuard("test_ntuple_page_filling_adaptive.root");
+
+   constexpr std::size_t kZippedPageSize = 16 * 1024;
+   constexpr std::size_t kMaxPageSize = 256 * 1024;
+   {
+      auto model = RNTupleModel::Create();
+      auto fldZero = model->MakeField<std::uint64_t>("zero");
+      auto fldNoise = model->MakeField<std::uint64_t>("noise");
+
+      RNTupleWriteOptions options;
+      options.SetUseImplicitMT(RNTupleWriteOptions::EImplicitMT::kOff);
+      options.SetMaxUnzippedPageSize(kMaxPageSize);
+      options.SetApproxZippedPageSize(kZippedPageSize);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      TRandom3 rnd(42);
+      for (int i = 0; i < 200000; ++i) {
+         *fldZero = 0;
+         *fldNoise = (static_cast<std::uint64_t>(rnd.Integer(0xFFFFFFFF)) << 32) | rnd.Integer(0xFFFFFFFF);
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   ASSERT_EQ(1u, desc.GetNClusters());
+   const auto &clusterDesc = desc.GetClusterDescriptor(desc.FindClusterId(0, 0));
+   const auto &prZero = clusterDesc.GetPageRange(desc.FindPhysicalColumnId(desc.FindFieldId("zero"), 0, 0));
+   const auto &prNoise = clusterDesc.GetPageRange(desc.FindPhysicalColumnId(desc.FindFieldId("noise"), 0, 0));
+
+   // The well compressible column uses the maximum page size
+   ASSERT_GT(prZero.fPageInfos.size(), 1u);
+   for (std::size_t i = 0; i < prZero.fPageInfos.size() - 1; ++i)
+      EXPECT_EQ(kMaxPageSize / sizeof(std::uint64_t), prZero.fPageInfos[i].fNElements);
+
+   // Once the compression ratio is known, the pages of the incompressible column approximate the target size
+   ASSERT_GT(prNoise.fPageInfos.size(), 2u);
+   for (std::size_t i = 1; i < prNoise.fPageInfos.size() - 1; ++i) {
+      EXPECT_LE(prNoise.fPageInfos[i].fLocator.fBytesOnStorage, 2 * kZippedPageSize);
+      EXPECT_GE(prNoise.fPageInfos[i].fLocator.fBytesOnStorage, kZippedPageSize / 4);
+   }
+
+   auto viewZero = reader->GetView<std::uint64_t>("zero");
+   auto viewNoise = reader->GetView<std::uint64_t>("noise");
+   TRandom3 rnd(42);
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(0u, viewZero(i));
+      EXPECT_EQ((static_cast<std::uint64_t>(rnd.Integer(0xFFFFFFFF)) << 32) | rnd.Integer(0xFFFFFFFF), viewNoise(i));
+   }
+}
+
 TEST(RNTuple, FlushColumns)
 {
    FileRaii fileGuard("test_ntuple_flush.root");
@@ -1121,3 +1173,99 @@ TEST(RPageSinkFile, StreamerInfo)
    }
    FAIL() << "not all streamer infos found! ";
 }
+
+TEST(RPageSourceFile, MemoryMapping)
+{
+   FileRaii fileGuard("test_ntuple_page_source_file_memory_mapping.root");
+
+   constexpr int kNEntries = 1000;
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = std::make_unique<RField<double>>("pt");
+      fieldPt->SetColumnRepresentatives({{EColumnType::kReal64}});
+      model->AddField(std::move(fieldPt));
+      // Split encoding: needs unpacking and thus cannot be mapped in place
+      auto ptrPz = model->MakeField<float>("pz");
+      auto ptrPt = model->GetDefaultEntry().GetPtr<double>("pt");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < kNEntries; ++i) {
+         *ptrPt = i;
+         *ptrPz = -i;
+         writer->Fill();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetUseMemoryMapping(true);
+   options.SetMetricsEnabled(true);
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   auto viewPt = reader->GetView<double>("pt");
+   auto viewPz = reader->GetView<float>("pz");
+   for (int i = 0; i < kNEntries; ++i) {
+      EXPECT_DOUBLE_EQ(i, viewPt(i));
+      EXPECT_FLOAT_EQ(-i, viewPz(i));
+   }
+
+   const auto &metrics = reader->GetMetrics();
+   EXPECT_EQ(0, metrics.GetCounter("RNTupleReader.RPageSourceFile.szReadPayload")->GetValueAsInt());
+   // Only the split float column is unpacked
+   EXPECT_EQ(static_cast<std::int64_t>(kNEntries * sizeof(float)),
+             metrics.GetCounter("RNTupleReader.RPageSourceFile.szUnzip")->GetValueAsInt());
+}
+
+TEST(RPageSourceFile, DeferredField)
+{
+   FileRaii fileGuard("test_ntuple_page_source_file_deferred_field.root");
+
+   constexpr int kNEntries = 1000;
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrCut = model->MakeField<std::int32_t>("cut");
+      auto ptrPayload = model->MakeField<float>("payload");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetMaxUnzippedPageSize(400);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < kNEntries; ++i) {
+         *ptrCut = i;
+         *ptrPayload = 2 * i;
+         writer->Fill();
+      }
+   }
+
+   // Reads the payload only for the entries passing the cut; returns the number of bytes read
+   auto readSelected = [&](bool isDeferred) {
+      auto source = std::make_unique<RPageSourceFile>("ntpl", fileGuard.GetPath(), RNTupleReadOptions());
+      source->GetMetrics().Enable();
+      source->Attach();
+      auto fieldCut = std::make_unique<RField<std::int32_t>>("cut");
+      auto fieldPayload = std::make_unique<RField<float>>("payload");
+      fieldCut->SetOnDiskId(source->GetSharedDescriptorGuard()->FindFieldId("cut"));
+      fieldPayload->SetOnDiskId(source->GetSharedDescriptorGuard()->FindFieldId("payload"));
+      source->SetDeferredField(fieldPayload->GetOnDiskId(), isDeferred);
+      ROOT::Experimental::Internal::CallConnectPageSourceOnField(*fieldCut, *source);
+      ROOT::Experimental::Internal::CallConnectPageSourceOnField(*fieldPayload, *source);
+
+      auto valueCut = fieldCut->CreateValue();
+      auto valuePayload = fieldPayload->CreateValue();
+      for (int i = 0; i < kNEntries; ++i) {
+         valueCut.Read(i);
+         EXPECT_EQ(i, valueCut.GetRef<std::int32_t>());
+         if (i % 500 != 0)
+            continue;
+         valuePayload.Read(i);
+         EXPECT_FLOAT_EQ(2 * i, valuePayload.GetRef<float>());
+      }
+
+      const auto &metrics = source->GetMetrics();
+      return metrics.GetCounter("RPageSourceFile.szReadPayload")->GetValueAsInt();
+   };
+
+   const auto szReadEager = readSelected(false);
+   const auto szReadDeferred = readSelected(true);
+   // Only the two payload pages that contain the selected entries are read
+   EXPECT_LT(szReadDeferred, szReadEager);
+   EXPECT_GE(szReadDeferred, static_cast<std::int64_t>(kNEntries * sizeof(std::int32_t) + 2 * sizeof(float)));
+}
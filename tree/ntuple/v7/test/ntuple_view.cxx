@@ -74,6 +74,66 @@ TEST(RNTuple, DirectAccessView)
    EXPECT_FLOAT_EQ(137.0, viewPt(1));
 }
 
+TEST(RNTuple, DirectAccessViewBulk)
+{
+   FileRaii fileGuard("test_ntuple_direct_access_view_bulk.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldJets = model->MakeField<std::vector<float>>("jets");
+   {
+      RNTupleWriteOptions opt;
+      opt.SetInitialNElementsPerPage(8);
+      opt.SetMaxUnzippedPageSize(64);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 100; ++i) {
+         *fieldPt = i;
+         fieldJets->assign(i % 4, i);
+         writer->Fill();
+         if (i == 49)
+            writer->CommitCluster();
+      }
+   }
+   auto reader = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   const auto nEntries = reader->GetNEntries();
+   auto viewPt = reader->GetDirectAccessView<float>("pt");
+   auto viewJets = reader->GetCollectionView("jets");
+   auto viewJetValues = viewJets.GetDirectAccessView<float>("_0");
+
+   EXPECT_TRUE(viewPt.ReadBulk(0, 0).empty());
+   unsigned int nSpans = 0;
+   for (NTupleSize_t i = 0; i < nEntries; ++nSpans) {
+      auto pts = viewPt.ReadBulk(i, nEntries - i);
+      ASSERT_FALSE(pts.empty());
+      EXPECT_LE(pts.size(), 16u);
+      for (std::size_t j = 0; j < pts.size(); ++j)
+         EXPECT_FLOAT_EQ(static_cast<float>(i + j), pts[j]);
+      i += pts.size();
+   }
+   EXPECT_GT(nSpans, 1u);
+
+   for (NTupleSize_t i = 0; i < nEntries;) {
+      auto offsets = viewJets.ReadBulkOffsets(i, nEntries - i);
+      ASSERT_FALSE(offsets.empty());
+      auto range = viewJets.GetCollectionRange(i);
+      auto itemStart = (*range.begin()).GetIndex();
+      for (std::size_t j = 0; j < offsets.size(); ++j) {
+         EXPECT_EQ((i + j) % 4, offsets[j] - itemStart);
+         // Items of the collection can be read in bulk, too
+         RClusterIndex firstItem = *viewJets.GetCollectionRange(i + j).begin();
+         ClusterSize_t::ValueType nItems = offsets[j] - itemStart;
+         for (ClusterSize_t::ValueType k = 0; k < nItems;) {
+            auto values = viewJetValues.ReadBulk(firstItem + k, nItems - k);
+            for (auto v : values)
+               EXPECT_FLOAT_EQ(static_cast<float>(i + j), v);
+            k += values.size();
+         }
+         itemStart = offsets[j];
+      }
+      i += offsets.size();
+   }
+}
+
 TEST(RNTuple, VoidView)
 {
    FileRaii fileGuard("test_ntuple_voidview.root");
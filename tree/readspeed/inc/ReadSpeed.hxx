@@ -45,6 +45,10 @@ struct Result {
    ULong64_t fCompressedBytesRead;
    /// Size of ROOT's thread pool for the run (0 indicates a single-thread run with no thread pool present).
    unsigned int fThreadPoolSize;
+   /// Number of uncompressed bytes written in total to TTree branches (write mode only).
+   ULong64_t fUncompressedBytesWritten = 0;
+   /// Number of compressed bytes written in total to the output TFile (write mode only).
+   ULong64_t fCompressedBytesWritten = 0;
 };
 
 struct EntryRange {
@@ -87,6 +91,10 @@ Result EvalThroughputMT(const Data &d, unsigned nThreads);
 
 Result EvalThroughput(const Data &d, unsigned nThreads);
 
+// Read the branches of d and write them out again to a tree in outFileName, with the given compression settings
+// (-1 for ROOT's default). Measures the end-to-end read+write throughput.
+Result EvalWriteThroughput(const Data &d, const std::string &outFileName, int compression = -1);
+
 } // namespace ReadSpeed
 
 #endif // ROOTREADSPEED
@@ -16,17 +16,27 @@
 
 #include "ReadSpeed.hxx"
 
+#include <ostream>
 #include <vector>
 
 namespace ReadSpeed {
 
 void PrintThroughput(const Result &r);
 
+// Print the result as a JSON object, e.g. to track throughput regressions across ROOT versions or storage systems.
+void PrintThroughputJSON(const Result &r, std::ostream &os);
+
 struct Args {
    Data fData;
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   /// If not empty, also write the result as JSON to this file ("-" for stdout only).
+   std::string fJSONOutput;
+   /// If not empty, measure read+write throughput by copying the branches to a tree in this file.
+   std::string fWriteOutput;
+   /// Compression settings of the written file, -1 for ROOT's default.
+   int fWriteCompression = -1;
 };
 
 Args ParseArgs(const std::vector<std::string> &args);
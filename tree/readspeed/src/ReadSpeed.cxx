@@ -340,7 +340,7 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
 #endif // R__USE_IMT
 }
 
-Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
+static void CheckData(const Data &d)
 {
    if (d.fTreeNames.empty()) {
       std::cerr << "Please provide at least one tree name\n";
@@ -358,6 +358,11 @@ Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
       std::cerr << "Please provide either one tree name or as many as the file names\n";
       std::terminate();
    }
+}
+
+Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
+{
+   CheckData(d);
 
 #ifdef R__USE_IMT
    return nThreads > 0 ? EvalThroughputMT(d, nThreads) : EvalThroughputST(d);
@@ -370,3 +375,70 @@ Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
    return EvalThroughputST(d);
 #endif
 }
+
+Result ReadSpeed::EvalWriteThroughput(const Data &d, const std::string &outFileName, int compression)
+{
+   CheckData(d);
+
+   auto treeIdx = 0;
+   auto fileIdx = 0;
+   ULong64_t uncompressedBytesRead = 0;
+   ULong64_t compressedBytesRead = 0;
+   ULong64_t uncompressedBytesWritten = 0;
+
+   TStopwatch sw;
+   const auto fileBranchNames = GetPerFileBranchNames(d);
+
+   if (compression < 0)
+      compression = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault;
+   auto out = std::unique_ptr<TFile>(TFile::Open(outFileName.c_str(), "RECREATE", "", compression));
+   if (out == nullptr || out->IsZombie())
+      throw std::runtime_error("Could not create output file '" + outFileName + '\'');
+
+   for (const auto &fileName : d.fFileNames) {
+      auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+      if (f == nullptr || f->IsZombie())
+         throw std::runtime_error("Could not open file '" + fileName + '\'');
+      const auto &treeName = d.fTreeNames[treeIdx];
+      std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
+      if (t == nullptr)
+         throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
+
+      t->SetBranchStatus("*", 0);
+      for (const auto &bName : fileBranchNames[fileIdx]) {
+         if (t->GetBranch(bName.c_str()) == nullptr)
+            throw std::runtime_error("Could not retrieve branch '" + bName + "' from tree '" + t->GetName() +
+                                     "' in file '" + fileName + '\'');
+         t->SetBranchStatus(bName.c_str(), 1);
+      }
+
+      sw.Start(false);
+
+      const ULong64_t fileStartBytes = f->GetBytesRead();
+      out->cd();
+      // a full (not fast) clone: every entry is read, deserialized, serialized and written again
+      TTree *clone = t->CloneTree(-1);
+      if (clone == nullptr)
+         throw std::runtime_error("Could not copy tree '" + treeName + "' from file '" + fileName + '\'');
+      clone->Write("", TObject::kOverwrite);
+      uncompressedBytesRead += clone->GetTotBytes();
+      uncompressedBytesWritten += clone->GetTotBytes();
+      compressedBytesRead += f->GetBytesRead() - fileStartBytes;
+      delete clone;
+
+      sw.Stop();
+
+      if (d.fTreeNames.size() > 1)
+         ++treeIdx;
+      ++fileIdx;
+   }
+
+   sw.Start(false);
+   out->Close();
+   sw.Stop();
+
+   Result r{sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, 0};
+   r.fUncompressedBytesWritten = uncompressedBytesWritten;
+   r.fCompressedBytesWritten = out->GetBytesWritten();
+   return r;
+}
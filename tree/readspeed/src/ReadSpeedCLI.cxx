@@ -14,6 +14,8 @@
 #include <ROOT/TTreeProcessorMT.hxx> // for TTreeProcessorMT::SetTasksPerWorkerHint
 #endif
 
+#include <TROOT.h> // for gROOT->GetVersion
+
 #include <iostream>
 #include <cstring>
 
@@ -26,6 +28,8 @@ const auto usageText = "Usage:\n"
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
                        "               [--tasks-per-worker ntasks]\n"
+                       "               [--write-to outfile [--write-compression settings]]\n"
+                       "               [--json (outfile | -)]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
                        " Use -h for usage help, --help for detailed information.\n";
@@ -57,7 +61,19 @@ const auto argUsageText =
    "      The number of threads to use for file reading. Will automatically cap to the number of available threads on "
    "the machine.\n"
    "    --tasks-per-worker ntasks\n"
-   "      The number of tasks to generate for each worker thread when using multithreading.";
+   "      The number of tasks to generate for each worker thread when using multithreading.\n"
+   "\n"
+   "  Write throughput:\n"
+   "    --write-to outfile\n"
+   "      Instead of only reading, copy the selected branches of every tree to a tree in outfile (single thread), "
+   "measuring the end-to-end read, decompression, compression and write throughput.\n"
+   "    --write-compression settings\n"
+   "      The compression settings of outfile, e.g. 505 for ZSTD level 5. Defaults to ROOT's default.\n"
+   "\n"
+   "  Output:\n"
+   "    --json outfile\n"
+   "      Also write the results as a JSON object to outfile, e.g. for regression tracking. Use '-' to print only the "
+   "JSON object to the standard output.";
 
 const auto fullUsageText =
    "Description:\n"
@@ -140,6 +156,12 @@ void ReadSpeed::PrintThroughput(const Result &r)
 
    std::cout << "Uncompressed data read:\t\t" << r.fUncompressedBytesRead << " bytes\n";
    std::cout << "Compressed data read:\t\t" << r.fCompressedBytesRead << " bytes\n";
+   if (r.fCompressedBytesWritten > 0) {
+      std::cout << "Uncompressed data written:\t" << r.fUncompressedBytesWritten << " bytes\n";
+      std::cout << "Compressed data written:\t" << r.fCompressedBytesWritten << " bytes\n";
+      std::cout << "Compressed write throughput:\t" << r.fCompressedBytesWritten / r.fRealTime / 1024 / 1024
+                << " MB/s\n";
+   }
 
    const unsigned int effectiveThreads = std::max(r.fThreadPoolSize, 1u);
 
@@ -164,6 +186,28 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "For details run with the --help command.\n";
 }
 
+void ReadSpeed::PrintThroughputJSON(const Result &r, std::ostream &os)
+{
+   const unsigned int effectiveThreads = std::max(r.fThreadPoolSize, 1u);
+   const double toMBs = 1. / r.fRealTime / 1024 / 1024;
+   os << "{\n"
+      << "  \"rootVersion\": \"" << gROOT->GetVersion() << "\",\n"
+      << "  \"threadPoolSize\": " << r.fThreadPoolSize << ",\n"
+      << "  \"mtSetupRealTime\": " << r.fMTSetupRealTime << ",\n"
+      << "  \"mtSetupCpuTime\": " << r.fMTSetupCpuTime << ",\n"
+      << "  \"realTime\": " << r.fRealTime << ",\n"
+      << "  \"cpuTime\": " << r.fCpuTime << ",\n"
+      << "  \"uncompressedBytesRead\": " << r.fUncompressedBytesRead << ",\n"
+      << "  \"compressedBytesRead\": " << r.fCompressedBytesRead << ",\n"
+      << "  \"uncompressedBytesWritten\": " << r.fUncompressedBytesWritten << ",\n"
+      << "  \"compressedBytesWritten\": " << r.fCompressedBytesWritten << ",\n"
+      << "  \"uncompressedThroughputMBs\": " << r.fUncompressedBytesRead * toMBs << ",\n"
+      << "  \"compressedThroughputMBs\": " << r.fCompressedBytesRead * toMBs << ",\n"
+      << "  \"compressedWriteThroughputMBs\": " << r.fCompressedBytesWritten * toMBs << ",\n"
+      << "  \"cpuEfficiency\": " << (r.fCpuTime / effectiveThreads) / r.fRealTime << "\n"
+      << "}\n";
+}
+
 Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 {
    // Print help message and exit if "--help"
@@ -184,8 +228,20 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 
    Data d;
    unsigned int nThreads = 0;
+   std::string jsonOutput, writeOutput;
+   int writeCompression = -1;
 
-   enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
+   enum class EArgState {
+      kNone,
+      kTrees,
+      kFiles,
+      kBranches,
+      kThreads,
+      kTasksPerWorkerHint,
+      kJSON,
+      kWriteTo,
+      kWriteCompression
+   } argState = EArgState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
    const auto branchOptionsErrMsg =
       "Options --all-branches, --branches, and --branches-regex are mutually exclusive. You can use only one.\n";
@@ -225,6 +281,15 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
          argState = EArgState::kThreads;
       } else if (arg == "--tasks-per-worker") {
          argState = EArgState::kTasksPerWorkerHint;
+      } else if (arg == "--json") {
+         argState = EArgState::kJSON;
+      } else if (arg == "--write-to") {
+         argState = EArgState::kWriteTo;
+      } else if (arg == "--write-compression") {
+         argState = EArgState::kWriteCompression;
+      } else if (arg == "-" && argState == EArgState::kJSON) {
+         jsonOutput = arg;
+         argState = EArgState::kNone;
       } else if (arg[0] == '-') {
          std::cerr << "Unrecognized option '" << arg << "'\n";
          return {};
@@ -246,12 +311,33 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
                          "will be ignored.\n";
 #endif
             break;
+         case EArgState::kJSON:
+            jsonOutput = arg;
+            argState = EArgState::kNone;
+            break;
+         case EArgState::kWriteTo:
+            writeOutput = arg;
+            argState = EArgState::kNone;
+            break;
+         case EArgState::kWriteCompression:
+            writeCompression = std::stoi(arg);
+            argState = EArgState::kNone;
+            break;
          default: std::cerr << "Unrecognized option '" << arg << "'\n"; return {};
          }
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   if (!writeOutput.empty() && nThreads > 0) {
+      std::cerr << "Option --write-to only supports single-thread runs, the --threads option cannot be used with it.\n";
+      return {};
+   }
+
+   Args parsed{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   parsed.fJSONOutput = std::move(jsonOutput);
+   parsed.fWriteOutput = std::move(writeOutput);
+   parsed.fWriteCompression = writeCompression;
+   return parsed;
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
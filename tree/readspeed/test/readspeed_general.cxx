@@ -289,3 +289,30 @@ TEST(ReadSpeedCLI, WorkerThreadsHint)
    EXPECT_EQ(newTasksPerWorker, oldTasksPerWorker + 10) << "Tasks per worker hint not updated correctly";
 }
 #endif
+
+TEST(ReadSpeedCLI, WriteAndJSONArgs)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees",   "t",   "--branches",
+      "x",              "--write-to", "out.root",        "--write-compression", "505", "--json", "-",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_EQ(parsedArgs.fWriteOutput, "out.root") << "Write output file not parsed correctly";
+   EXPECT_EQ(parsedArgs.fWriteCompression, 505) << "Write compression not parsed correctly";
+   EXPECT_EQ(parsedArgs.fJSONOutput, "-") << "JSON output not parsed correctly";
+}
+
+TEST(ReadSpeedCLI, WriteWithThreads)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--branches", "x",
+      "--write-to",     "out.root", "--threads",        "4",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_FALSE(parsedArgs.fShouldRun) << "Program running when --write-to is combined with --threads";
+}
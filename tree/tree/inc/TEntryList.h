@@ -87,6 +87,7 @@ class TEntryList: public TNamed
       return false;
    }
 
+   virtual void        Intersect(const TEntryList *elist);
    virtual Int_t       Merge(TCollection *list);
 
    virtual Long64_t    Next();
@@ -140,6 +140,9 @@ protected:
    bool           fCacheDoClusterPrefetch;///<! true if cache is prefetching whole clusters
    bool           fCacheUserSet;          ///<! true if the cache setting was explicitly given by user
    bool           fIMTEnabled;            ///<! true if implicit multi-threading is enabled for this tree
+   Int_t          fParallelFillMinBranches{-1}; ///<! Min. number of branches to fill concurrently with IMT (-1: unset)
+   bool           fHasAutoCompression{false}; ///<! true if the compression of each branch is chosen at its first basket
+   ROOT::RCompressionAutoSelection fAutoCompression; ///<! How to choose the compression of each branch
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
@@ -446,6 +449,7 @@ public:
 #endif
    virtual Long64_t        GetAutoFlush() const {return fAutoFlush;}
    virtual Long64_t        GetAutoSave()  const {return fAutoSave;}
+   const ROOT::RCompressionAutoSelection *GetAutoCompression() const { return fHasAutoCompression ? &fAutoCompression : nullptr; }
    virtual TBranch        *GetBranch(const char* name);
    virtual TBranchRef     *GetBranchRef() const { return fBranchRef; };
    virtual bool            GetBranchStatus(const char* branchname) const;
@@ -543,6 +547,7 @@ public:
            TObject        *GetNotify() const { return fNotify; }
    TVirtualTreePlayer     *GetPlayer();
    virtual Int_t           GetPacketSize() const { return fPacketSize; }
+           Int_t           GetParallelFillMinBranches() const;
    virtual TVirtualPerfStats *GetPerfStats() const { return fPerfStats; }
            TTreeCache     *GetReadCache(TFile *file) const;
            TTreeCache     *GetReadCache(TFile *file, bool create);
@@ -621,6 +626,8 @@ public:
    virtual bool            SetAlias(const char* aliasName, const char* aliasFormula);
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
+           void            SetAutoCompression(const ROOT::RCompressionAutoSelection &selection);
+           void            ResetAutoCompression() { fHasAutoCompression = false; }
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr = nullptr);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TClass *realClass, EDataType datatype, bool isptr);
@@ -680,6 +687,7 @@ public:
    virtual void            SetNotify(TObject* obj);
 
    virtual void            SetObject(const char* name, const char* title);
+           void            SetParallelFillMinBranches(Int_t n) { fParallelFillMinBranches = n; }
    virtual void            SetParallelUnzip(bool opt=true, Float_t RelSize=-1);
    virtual void            SetPerfStats(TVirtualPerfStats* perf);
    /**
@@ -22,6 +22,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TFileCacheRead.h"
+#include "TString.h"
 
 #include <vector>
 
@@ -66,6 +67,8 @@ protected:
    bool         fAutoCreated{false}; ///<! true if cache was automatically created
 
    bool         fLearnPrefilling{false}; ///<! true if we are in the process of executing LearnPrefill
+   bool         fProfileChecked{false};  ///<! true if the learning phase already looked for a saved profile
+   Double_t     fPrefetchMemoryFactor{2}; ///<! Memory of the prefetching buffers, in units of the cache size
 
    // These members hold cached data for missed branches when miss optimization
    // is enabled.  Pointers are only initialized if the miss cache is enabled.
@@ -124,6 +127,12 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    bool     ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   // These functions save the branches learnt by the cache in a profile file,
+   // and load it in later processes to skip their learning phase.
+   TString GetProfileFileName() const; ///< Name of the profile file of the current tree, empty if profiles are disabled.
+   bool    LoadProfile();              ///< Add the branches of the saved profile to the cache and stop the learning phase.
+   void    SaveProfile() const;        ///< Save the branches in the cache in the profile file.
+
 public:
 
    TTreeCache();
@@ -142,7 +151,9 @@ public:
    Double_t             GetEfficiencyRel() const;
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
    virtual Int_t        GetEntryMax() const {return fEntryMax;}
+   Double_t             GetPrefetchMemoryFactor() const { return fPrefetchMemoryFactor; }
    static Int_t         GetLearnEntries();
+   static const char   *GetProfileDir();
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
@@ -167,7 +178,9 @@ public:
    void                 SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect) override;
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
+   static void          SetProfileDir(const char *dir);
    void                 SetOptimizeMisses(bool opt);
+   void                 SetPrefetchMemoryFactor(Double_t factor);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
    virtual void         UpdateBranches(TTree *tree);
@@ -79,7 +79,6 @@ protected:
 
    // Members for paral. managing
    bool        fAsyncReading;
-   bool        fEmpty;
    Int_t       fCycle;
    bool        fParallel; ///< Indicate if we want to activate the parallelism (for this instance)
 
@@ -96,6 +95,9 @@ protected:
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
    Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
    Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
+   std::vector<Long64_t> fBasketFirstEntry; ///<! [fNseek] First entry of the baskets in the cache
+   std::vector<Int_t>    fUnzipOrder;       ///<! Indices of the baskets in the order in which they are unzipped
+   std::atomic<Int_t>    fUnzipCursor{0};   ///<! Position in fUnzipOrder of the next basket to unzip
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
@@ -114,6 +116,7 @@ private:
 
    // Private methods
    void  Init();
+   Int_t NextBasketToUnzip();
 
 public:
    TTreeCacheUnzip();
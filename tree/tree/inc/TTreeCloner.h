@@ -33,6 +33,7 @@ class TTreeCloner {
 
    bool       fIsValid;
    bool       fNeedConversion;   ///< True if the fast merge is not possible but a slow merge might possible.
+   bool       fRecompress;       ///< True if the baskets are recompressed with the settings of the output branches.
    UInt_t     fOptions;
    TTree     *fFromTree;
    TTree     *fToTree;
@@ -87,6 +88,7 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+   void WriteRecompressedBaskets();
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -24,9 +24,12 @@
 #include "TVirtualPerfStats.h"
 #include "TTimeStamp.h"
 #include "ROOT/TIOFeatures.hxx"
+#include "ROOT/RTrace.hxx"
 #include "RZip.h"
 
 #include <bitset>
+#include <memory>
+#include <optional>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
@@ -158,6 +161,87 @@ Long64_t TBasket::CopyTo(TFile *to)
    return nBytes>0 ? nBytes : -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the content of a basket loaded with LoadBasketBuffers by the same
+/// payload compressed with the compression settings `compress` (algorithm*100+level),
+/// for CopyTo to write it out. This function is called by TTreeCloner.
+///
+/// The basket is not (un)streamed and neither its branch nor any file are
+/// accessed, so that different baskets can be recompressed concurrently.
+/// The function returns 0 in case of success, 1 in case of error; the content
+/// of the basket is left unchanged in case of error.
+
+Int_t TBasket::Recompress(Int_t compress)
+{
+   if (!fBufferRef || fNbytes <= fKeylen || fObjlen <= 0)
+      return 1;
+   // The payload of these baskets is an object buffer that was compressed before being filled.
+   if (TestBit(TBufferFile::kNotDecompressed))
+      return 0;
+
+   char *record = fBufferRef->Buffer();
+   std::unique_ptr<char[]> unzipped;
+   char *objbuf = record + fKeylen;
+   if (fObjlen > fNbytes - fKeylen) {
+      unzipped.reset(new char[fObjlen]);
+      auto zipped = reinterpret_cast<UChar_t *>(record + fKeylen);
+      auto zippedEnd = reinterpret_cast<UChar_t *>(record + fNbytes);
+      Int_t noutot = 0;
+      while (noutot < fObjlen) {
+         Int_t nin, nbuf, nout = 0;
+         if (R__unzip_header(&nin, zipped, &nbuf) != 0 || zipped + nin > zippedEnd || noutot + nbuf > fObjlen) {
+            Error("Recompress", "Inconsistency found in header (nin=%d, nbuf=%d)", nin, nbuf);
+            return 1;
+         }
+         R__unzip(&nin, zipped, &nbuf, reinterpret_cast<UChar_t *>(unzipped.get()) + noutot, &nout);
+         if (!nout)
+            break;
+         noutot += nout;
+         zipped += nin;
+      }
+      if (noutot != fObjlen) {
+         Error("Recompress", "fNbytes = %d, fKeylen = %d, fObjlen = %d, noutot = %d", fNbytes, fKeylen, fObjlen,
+               noutot);
+         return 1;
+      }
+      objbuf = unzipped.get();
+   }
+
+   using EAlgorithm = ROOT::RCompressionSetting::EAlgorithm::EValues;
+   const Int_t cxlevel = compress < 0 ? 0 : compress % 100;
+   const auto cxAlgorithm = static_cast<EAlgorithm>(compress < 0 ? 0 : compress / 100);
+   const Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
+   std::unique_ptr<char[]> rezipped;
+   Int_t noutot = 0;
+   if (cxlevel > 0) {
+      rezipped.reset(new char[fObjlen + 9 * nbuffers + 28]);
+      for (Int_t i = 0; i < nbuffers; ++i) {
+         Int_t bufmax = (i == nbuffers - 1) ? fObjlen - i * kMAXZIPBUF : kMAXZIPBUF;
+         Int_t nout = 0;
+         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf + i * kMAXZIPBUF, &bufmax, rezipped.get() + noutot, &nout,
+                                 cxAlgorithm);
+         // As in WriteBuffer, store the payload uncompressed if compression does not reduce it.
+         if (nout == 0 || noutot + nout >= fObjlen) {
+            noutot = 0;
+            break;
+         }
+         noutot += nout;
+      }
+   }
+   const char *payload = noutot ? rezipped.get() : objbuf;
+   const Int_t payloadLen = noutot ? noutot : fObjlen;
+
+   if (payload != record + fKeylen) {
+      fBufferRef->SetWriteMode();
+      if (fBufferRef->BufferSize() < fKeylen + payloadLen)
+         fBufferRef->Expand(fKeylen + payloadLen);
+      fBufferRef->SetReadMode();
+      memcpy(fBufferRef->Buffer() + fKeylen, payload, payloadLen);
+   }
+   fNbytes = fKeylen + payloadLen;
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///  Delete fEntryOffset array.
 
@@ -260,7 +344,8 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
    }
    fBufferRef->SetParent(file);
    char *buffer = fBufferRef->Buffer();
-   file->Seek(pos);
+   if (!file->IsConcurrentRead())
+      file->Seek(pos);
    TFileCacheRead *pf = tree->GetReadCache(file);
    if (pf) {
       TVirtualPerfStats* temp = gPerfStats;
@@ -269,13 +354,11 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
       if (st < 0) {
          return 1;
       } else if (st == 0) {
-         // fOffset might have been changed via TFileCacheRead::ReadBuffer(), reset it
-         file->Seek(pos);
          // If we are using a TTreeCache, disable reading from the default cache
          // temporarily, to force reading directly from file
          TTreeCache *fc = dynamic_cast<TTreeCache*>(file->GetCacheRead());
          if (fc) fc->Disable();
-         Int_t ret = file->ReadBuffer(buffer,len);
+         Int_t ret = file->ReadBuffer(buffer,pos,len);
          if (fc) fc->Enable();
          pf->AddNoCacheBytesRead(len);
          pf->AddNoCacheReadCalls(1);
@@ -285,11 +368,12 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
       }
       gPerfStats = temp;
       // fOffset might have been changed via TFileCacheRead::ReadBuffer(), reset it
-      file->SetOffset(pos + len);
+      if (!file->IsConcurrentRead())
+         file->SetOffset(pos + len);
    } else {
       TVirtualPerfStats* temp = gPerfStats;
       if (tree->GetPerfStats() != nullptr) gPerfStats = tree->GetPerfStats();
-      if (file->ReadBuffer(buffer,len)) {
+      if (file->ReadBuffer(buffer,pos,len)) {
          gPerfStats = temp;
          return 1; //error while reading
       }
@@ -470,6 +554,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    bool oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
+   const char *mapped = nullptr;
+   std::optional<TBufferFile> mappedBufferRef;
 
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
@@ -498,6 +584,11 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       // Initialize the buffer to hold the uncompressed data.
       fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file);
       readBufferRef = fBufferRef;
+   } else if (!TestBit(TBufferFile::kNotDecompressed) && (mapped = file->GetMappedBuffer(pos, len))) {
+      // The file is memory-mapped: decompress the basket straight from the mapping.
+      mappedBufferRef.emplace(TBuffer::kRead, len, const_cast<char *>(mapped), kFALSE);
+      mappedBufferRef->SetParent(file);
+      readBufferRef = &*mappedBufferRef;
    } else {
       // Initialize the buffer to hold the compressed data.
       fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
@@ -513,7 +604,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       return 1;
    }
 
-   if (pf) {
+   if (mapped) {
+      // Already in memory
+   } else if (pf) {
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != nullptr) gPerfStats = fBranch->GetTree()->GetPerfStats();
       Int_t st = 0;
@@ -598,6 +691,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       if (R__unlikely(gPerfStats)) {
          start = TTimeStamp();
       }
+      R__TRACE_SCOPE("tree", "TBasket::Unzip");
 
       memcpy(rawUncompressedBuffer, rawCompressedBuffer, fKeylen);
       char *rawUncompressedObjectBuffer = rawUncompressedBuffer+fKeylen;
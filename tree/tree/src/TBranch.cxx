@@ -43,6 +43,7 @@
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
+#include "TVirtualCollectionProxy.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
@@ -53,6 +54,7 @@
 
 #include "ROOT/TIOFeatures.hxx"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
@@ -61,6 +63,117 @@
 
 Int_t TBranch::fgCount = 0;
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the size of a value of the given primitive type in bulk IO, or 0 if
+/// the type is not supported by bulk IO.
+
+Int_t GetBulkValueSize(EDataType type)
+{
+   switch (type) {
+   case kChar_t:
+   case kUChar_t:
+   case kBool_t: return 1;
+   case kShort_t:
+   case kUShort_t: return 2;
+   case kInt_t:
+   case kUInt_t:
+   case kFloat_t: return 4;
+   case kDouble_t:
+   case kLong64_t:
+   case kULong64_t: return 8;
+   default: return 0;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Byte-swap in place the n values of the given type starting at the current
+/// position of buf. One-byte types do not need swapping.
+
+bool ByteSwapBulkValues(TBuffer &buf, Long64_t n, EDataType type)
+{
+   if (GetBulkValueSize(type) == 1)
+      return true;
+   return buf.ByteSwapBuffer(n, type);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// If branch is a top-level, non-split branch of a std::vector of a
+/// primitive type (e.g. `std::vector<float>`), return the type of its values.
+/// Return kOther_t otherwise.
+
+EDataType GetBulkVectorValueType(TBranch &branch)
+{
+   if (branch.GetMother() != &branch || branch.GetListOfBranches()->GetEntriesFast() != 0)
+      return kOther_t;
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   if (branch.GetExpectedType(cl, type) || !cl)
+      return kOther_t;
+   TVirtualCollectionProxy *proxy = cl->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->HasPointers() || proxy->GetValueClass())
+      return kOther_t;
+   // std::vector<bool> is not stored as an array of bools
+   const EDataType valueType = proxy->GetType();
+   return (valueType != kBool_t && GetBulkValueSize(valueType) > 0) ? valueType : kOther_t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make room for N Int_t at the current position of count_buf and return a
+/// pointer to them.
+
+Int_t *PrepareBulkCounts(TBuffer &count_buf, Int_t N)
+{
+   const Int_t needed = count_buf.Length() + N * sizeof(Int_t);
+   if (count_buf.BufferSize() < needed)
+      count_buf.AutoExpand(needed);
+   return reinterpret_cast<Int_t *>(count_buf.GetCurrent());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Turn in place the N serialized std::vector entries found at the current
+/// position of buf into one contiguous array of byte-swapped values, and store
+/// the sizes of the vectors in count_buf if not null.
+///
+/// Each entry is serialized as a byte count, a version, the number of values
+/// and the values themselves: only the latter are kept, moved towards the
+/// beginning of the buffer.
+
+bool ReadBulkVectors(TBuffer &buf, Int_t N, EDataType type, TBuffer *count_buf)
+{
+   const UInt_t kByteCountMask = 0x40000000;
+   const Int_t valueSize = GetBulkValueSize(type);
+   Int_t *counts = count_buf ? PrepareBulkCounts(*count_buf, N) : nullptr;
+   char *src = buf.GetCurrent();
+   char *dst = src;
+   const char *end = buf.Buffer() + buf.BufferSize();
+   Long64_t nValues = 0;
+   for (Int_t idx = 0; idx < N; ++idx) {
+      if (R__unlikely(src + sizeof(UInt_t) + sizeof(Version_t) + sizeof(Int_t) > end))
+         return false;
+      UInt_t byteCount;
+      Version_t version;
+      Int_t size;
+      frombuf(src, &byteCount);
+      frombuf(src, &version);
+      frombuf(src, &size);
+      const Long64_t nBytes = Long64_t(size) * valueSize;
+      if (R__unlikely(!(byteCount & kByteCountMask) || size < 0 || src + nBytes > end ||
+                      (byteCount & ~kByteCountMask) != sizeof(Version_t) + sizeof(Int_t) + nBytes))
+         return false;
+      memmove(dst, src, nBytes);
+      src += nBytes;
+      dst += nBytes;
+      nValues += size;
+      if (counts)
+         counts[idx] = size;
+   }
+   return ByteSwapBulkValues(buf, nValues, type);
+}
+
+} // anonymous namespace
+
 /** \class TBranch
 \ingroup tree
 
@@ -1429,8 +1542,11 @@ Int_t TBranch::GetBasketAndFirst(TBasket *&basket, Long64_t &first,
 /// to perform bulk IO (reasonable type, single TLeaf, etc); the bulk IO may
 /// still fail, depending on the contents of the individual TBaskets loaded.
 bool TBranch::SupportsBulkRead() const {
-   return (fNleaves == 1) &&
-          (static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetDeserializeType() != TLeaf::DeserializeType::kExternal);
+   if (fNleaves != 1)
+      return false;
+   if (static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetDeserializeType() != TLeaf::DeserializeType::kExternal)
+      return true;
+   return GetBulkVectorValueType(const_cast<TBranch &>(*this)) != kOther_t;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1448,20 +1564,28 @@ bool TBranch::SupportsBulkRead() const {
 ///
 /// where T is the type stored on this branch.
 ///
-/// When `count_buf` points to a valid TBuffer and the branch has a branch count,
-/// `count_buf` will be filled (via a call to GetEntriesSerialized) with the data
-/// from the branchCount.  After deserialization those value can be used to calculate
-/// the number of elements corresponding to each entries.
+/// Besides fixed-size leaves, this supports variable-size arrays of a leaf
+/// list (e.g. `x[n]/F`) and top-level branches of a std::vector of a primitive
+/// type (e.g. `std::vector<float>`). For those, the values of all the entries
+/// are contiguous in the buffer, and the number of values of each entry is
+/// given by `count_buf`.
+///
+/// When `count_buf` points to a valid TBuffer, it will be filled with one
+/// (already byte-swapped) Int_t per entry, starting at its current position:
+///  - for a variable-size array, the values of its count leaf, read via a
+///    call to GetBulkEntries() on the count branch;
+///  - for a std::vector, the size of the vector;
+///  - for a fixed-size leaf, the fixed length of the leaf.
+///
+/// For each entry of a variable-size array the number of elements is the multiplication of
 ///
-/// For each entry the number of elements is the multiplication of
-/// 
 /// ~~~{.cpp}
 /// TLeaf *leaf = static_cast<TLeaf*>(branch->GetListOfLeaves()->At(0));
 /// auto len = leaf->GetLen();
 /// ~~~
 ///
-/// and the value in the BranchCount corresponding to that entry (can be obtained
-/// from `branch->GetBranchCount()`).
+/// and the count of that entry. The offset of each entry in the value array is
+/// the running sum of the elements of the previous entries.
 ///
 /// \note This interface is not meant to be exposed to end users, but rather it should
 ///       be wrapped by higher-level interfaces.
@@ -1469,14 +1593,20 @@ bool TBranch::SupportsBulkRead() const {
 /// \note See TBranch::GetEntriesSerialized() for an alternative that does not
 ///       perform byte swapping (useful to save one pass over data in some cases).
 ///
-Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
+Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf, TBuffer *count_buf)
 {
    // TODO: eventually support multiple leaves.
    if (R__unlikely(fNleaves != 1)) return -1;
    TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   EDataType vectorType = kOther_t;
    if (R__unlikely(leaf->GetDeserializeType() == TLeaf::DeserializeType::kExternal)) {
-      return -1;
+      vectorType = GetBulkVectorValueType(*this);
+      if (vectorType == kOther_t)
+         return -1;
    }
+   TLeaf *count_leaf = vectorType == kOther_t ? leaf->GetLeafCount() : nullptr;
+   // Variable-size arrays of a TBranchElement are not stored contiguously.
+   if (R__unlikely(count_leaf && IsA() != TBranch::Class())) return -1;
 
    // Remember which entry we are reading.
    fReadEntry = entry;
@@ -1531,9 +1661,37 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
 
    Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
    //printf("Requesting %d events; fNextBasketEntry=%lld; first=%lld.\n", N, fNextBasketEntry, first);
-   if (R__unlikely(!leaf->ReadBasketFast(user_buf, N))) {
-      Error("GetBulkEntries", "Leaf failed to read.\n");
-      return -1;
+   if (vectorType != kOther_t) {
+      if (R__unlikely(!ReadBulkVectors(user_buf, N, vectorType, count_buf))) {
+         Error("GetBulkEntries", "Failed to read the vectors of entry %lld.\n", entry);
+         return -1;
+      }
+   } else if (count_leaf) {
+      // The values of all entries are contiguous, up to the end of the data of the basket.
+      TClass *cl = nullptr;
+      EDataType type = kOther_t;
+      GetExpectedType(cl, type);
+      const Long64_t nValues = (basket->GetLast() - bufbegin) / leaf->GetLenType();
+      if (R__unlikely(!ByteSwapBulkValues(user_buf, nValues, type))) {
+         Error("GetBulkEntries", "Leaf failed to read.\n");
+         return -1;
+      }
+      if (count_buf) {
+         if (R__unlikely(count_leaf->GetLenType() != sizeof(Int_t) ||
+                         count_leaf->GetBranch()->GetBulkEntries(entry, *count_buf) != N)) {
+            Error("GetBulkEntries", "Failed to read count leaf.\n");
+            return -1;
+         }
+      }
+   } else {
+      if (R__unlikely(!leaf->ReadBasketFast(user_buf, N))) {
+         Error("GetBulkEntries", "Leaf failed to read.\n");
+         return -1;
+      }
+      if (count_buf) {
+         Int_t *counts = PrepareBulkCounts(*count_buf, N);
+         std::fill(counts, counts + N, leaf->GetLen());
+      }
    }
    user_buf.SetBufferOffset(bufbegin);
 
@@ -3214,6 +3372,16 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
    auto doUpdates = [this, basket, where]() {
+      if (where == 0) {
+         if (auto selection = fTree->GetAutoCompression()) {
+            // Only this branch is changed: its sub-branches choose their own settings from their own first basket.
+            TBuffer *buf = basket->GetBufferRef();
+            const Int_t settings =
+               selection->Select(buf->Buffer() + basket->GetKeylen(), buf->Length() - basket->GetKeylen());
+            if (settings >= 0)
+               fCompress = settings;
+         }
+      }
       Int_t nout  = basket->WriteBuffer();    //  Write buffer
       if (nout < 0)
          Error("WriteBasketImpl", "basket's WriteBuffer failed.");
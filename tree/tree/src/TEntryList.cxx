@@ -27,6 +27,12 @@ ROOT::RDataFrame instead of TEntryList if possible.
 - __Subtract__() - if the lists are for the same TTree, removes the entries of the second
                list from the first list. If the lists are for TChains, loops over all
                sub-lists
+- __Intersect__() - keeps only the entries of the first list that are also in the
+               second list. If the lists are for TChains, loops over all sub-lists
+
+For lists of the same TTree, Add(), Subtract() and Intersect() combine the
+blocks of the two lists word by word, in parallel if implicit multi-threading
+is enabled.
 - __GetEntry(n)__ - returns the n-th entry number
 - __Next__()      - returns next entry number. Note, that this function is
                 much faster than GetEntry, and it's called when GetEntry() is called
@@ -160,9 +166,39 @@ End_Macro
 #include "TRegexp.h"
 #include "TSystem.h"
 #include "TObjString.h"
+#include "TROOT.h"
+
+#include <atomic>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ClassImp(TEntryList);
 
+namespace {
+
+/// Minimum number of blocks for which the blocks of two entry lists are combined in parallel.
+constexpr Int_t kMinBlocksMT = 16;
+
+/// Call `op(i)` for the blocks i in [0, n), which must be independent of each other: in parallel,
+/// if implicit multi-threading is enabled and there are enough blocks.
+template <typename F>
+void ForEachBlock(Int_t n, F &&op)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && n >= kMinBlocksMT) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(op, ROOT::TSeqI(n));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; ++i)
+      op(i);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// default c-tor
 
@@ -426,19 +462,19 @@ void TEntryList::Add(const TEntryList *elist)
                }
                return;
             }
-            //both not empty, merge block by block
+            //both not empty, merge block by block (in parallel with IMT)
             TEntryListBlock *block1=nullptr;
             TEntryListBlock *block2=nullptr;
             Int_t i;
             Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
-            Long64_t nnew, nold;
-            for (i=0; i<nmin; i++){
-               block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
-               block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
-               nold = block1->GetNPassed();
-               nnew = block1->Merge(block2);
-               fN = fN - nold + nnew;
-            }
+            std::atomic<Long64_t> delta{0};
+            ForEachBlock(nmin, [&](Int_t iblock) {
+               auto b1 = (TEntryListBlock *)fBlocks->UncheckedAt(iblock);
+               auto b2 = (TEntryListBlock *)elist->fBlocks->UncheckedAt(iblock);
+               Long64_t nold = b1->GetNPassed();
+               delta += b1->Merge(b2) - nold;
+            });
+            fN += delta;
             if (fNBlocks<elist->fNBlocks){
                Int_t nmax = elist->fNBlocks;
                for (i=nmin; i<nmax; i++){
@@ -1341,13 +1377,19 @@ void TEntryList::Subtract(const TEntryList *elist)
          //second list is also only for 1 tree
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
-            //same tree
-            Long64_t n2 = elist->GetN();
-            Long64_t entry;
-            for (Int_t i=0; i<n2; i++){
-               entry = (const_cast<TEntryList*>(elist))->GetEntry(i);
-               Remove(entry);
-            }
+            //same tree, subtract block by block (in parallel with IMT)
+            if (!elist->fBlocks) return;
+            Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+            std::atomic<Long64_t> delta{0};
+            ForEachBlock(nmin, [&](Int_t i) {
+               auto block1 = (TEntryListBlock *)fBlocks->UncheckedAt(i);
+               auto block2 = (TEntryListBlock *)elist->fBlocks->UncheckedAt(i);
+               Long64_t nold = block1->GetNPassed();
+               delta += block1->Subtract(block2) - nold;
+            });
+            fN += delta;
+            fLastIndexQueried = -1;
+            fLastIndexReturned = 0;
          } else {
             //different trees
             return;
@@ -1382,6 +1424,67 @@ void TEntryList::Subtract(const TEntryList *elist)
    return;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Keep only the entries of this entry list that are also contained in elist.
+/// Lists for different trees have no entries in common.
+///
+/// The blocks of lists for the same tree are intersected word by word; with
+/// implicit multi-threading, large lists are intersected in parallel.
+
+void TEntryList::Intersect(const TEntryList *elist)
+{
+   if (!fLists){
+      if (!fBlocks) return;
+      // The blocks from firstBlock on have no counterpart in the other list.
+      auto intersectBlocks = [this](const TEntryList *other, Int_t firstBlock) {
+         std::atomic<Long64_t> nnew{0};
+         ForEachBlock(firstBlock, [&](Int_t i) {
+            auto block1 = (TEntryListBlock *)fBlocks->UncheckedAt(i);
+            auto block2 = (TEntryListBlock *)other->fBlocks->UncheckedAt(i);
+            nnew += block1->Intersect(block2);
+         });
+         TEntryListBlock empty;
+         for (Int_t i = firstBlock; i < fNBlocks; i++)
+            ((TEntryListBlock *)fBlocks->UncheckedAt(i))->Intersect(&empty);
+         fN = nnew;
+         fLastIndexQueried = -1;
+         fLastIndexReturned = 0;
+      };
+      const TEntryList *other = elist;
+      if (elist->fLists) {
+         // find the sublist for the same tree as this list, if any
+         other = nullptr;
+         TIter next1(elist->GetLists());
+         TEntryList *templist = nullptr;
+         while ((templist = (TEntryList*)next1())){
+            if (!strcmp(templist->fTreeName.Data(),fTreeName.Data()) &&
+                !strcmp(templist->fFileName.Data(),fFileName.Data())){
+               other = templist;
+               break;
+            }
+         }
+      } else if (strcmp(elist->fTreeName.Data(),fTreeName.Data()) ||
+                 strcmp(elist->fFileName.Data(),fFileName.Data())) {
+         other = nullptr;
+      }
+      if (other && other->fLists) {
+         Intersect(other);
+         return;
+      }
+      intersectBlocks(other, other && other->fBlocks ? TMath::Min(fNBlocks, other->fNBlocks) : 0);
+   } else {
+      //this list has sublists
+      TIter next2(fLists);
+      TEntryList *templist = nullptr;
+      Long64_t oldn=0;
+      while ((templist = (TEntryList*)next2())){
+         oldn = templist->GetN();
+         templist->Intersect(elist);
+         fN = fN - oldn + templist->GetN();
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TEntryList operator||(TEntryList &elist1, TEntryList &elist2)
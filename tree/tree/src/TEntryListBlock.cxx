@@ -38,6 +38,9 @@ End_Macro
  - __Merge__() - adds all entries from one block to the other. If the first block
              uses array representation, it's changed to bits representation only
              if the total number of passing entries is still less than kBlockSize
+ - __Intersect__(), __Subtract__() - keep only the entries that are, resp. that
+             are not, in the other block. Like Merge(), they operate on whole
+             bit words, whatever the representation of the two blocks
  - __GetEntry(n)__ - returns n-th non-zero entry.
  - __Next__()      - return next non-zero entry. In case of representation 1), Next()
                  is faster than GetEntry()
@@ -46,6 +49,8 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <bitset>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -242,10 +247,11 @@ Int_t TEntryListBlock::Contains(Int_t entry)
 
 Int_t TEntryListBlock::Merge(TEntryListBlock *block)
 {
-   Int_t i, j;
+   Int_t i;
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
+      delete [] fIndices;
       fN = block->fN;
       fIndices = new UShort_t[fN];
       for (i=0; i<fN; i++)
@@ -258,109 +264,93 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
       fLastIndexQueried = -1;
       return fNPassed;
    }
-   if (fType==0){
-      //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
-         }
-      } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
-         }
-      }
-   } else {
-      //stored as a list
-      if (GetNPassed() + block->GetNPassed() > kBlockSize){
-         //change to bits
-         UShort_t *bits = new UShort_t[kBlockSize];
-         Transform(true, bits);
-         Merge(block);
-      } else {
-         //this is only possible if fPassing=1 in both blocks
-         if (block->fType==1){
-            //second block stored as a list
-            //make a bigger list
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            UShort_t *elst = block->fIndices;
-            Int_t newpos, elpos;
-            newpos = elpos = 0;
-            for (i=0; i<fNPassed; i++) {
-               while (elpos < en && fIndices[i] > elst[elpos]) {
-                  newlist[newpos] = elst[elpos];
-                  newpos++;
-                  elpos++;
-               }
-               if (fIndices[i] == elst[elpos]) elpos++;
-               newlist[newpos] = fIndices[i];
-               newpos++;
-            }
-            while (elpos < en) {
-               newlist[newpos] = elst[elpos];
-               newpos++;
-               elpos++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
-         } else {
-            //second block is stored as bits
-
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            Int_t newpos, current;
-            newpos = current = 0;
-            for (i=0; i<kBlockSize*16; i++){
-               if (!block->Contains(i)) continue;
-               while(current < fNPassed && fIndices[current]<i){
-                  newlist[newpos] = fIndices[current];
-                  current++;
-                  newpos++;
-               }
-               if (fIndices[current]==i) current++;
-               newlist[newpos] = i;
-               newpos++;
-            }
-            while(current<fNPassed){
-               newlist[newpos] = fIndices[current];
-               newpos++;
-               current++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
-         }
-      }
+   UShort_t bits[kBlockSize];
+   UShort_t other[kBlockSize];
+   GetBits(bits);
+   block->GetBits(other);
+   for (i=0; i<kBlockSize; i++)
+      bits[i] |= other[i];
+   SetBits(bits);
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Keep only the entries that are also in the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Intersect(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0) return 0;
+   UShort_t bits[kBlockSize];
+   UShort_t other[kBlockSize];
+   GetBits(bits);
+   block->GetBits(other);
+   for (Int_t i=0; i<kBlockSize; i++)
+      bits[i] &= other[i];
+   SetBits(bits);
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the entries that are in the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0 || block->GetNPassed() == 0) return GetNPassed();
+   UShort_t bits[kBlockSize];
+   UShort_t other[kBlockSize];
+   GetBits(bits);
+   block->GetBits(other);
+   for (Int_t i=0; i<kBlockSize; i++)
+      bits[i] &= ~other[i];
+   SetBits(bits);
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `bits` (kBlockSize UShort_ts) with the bits representation of the
+/// entries of the block, whatever the current representation
+
+void TEntryListBlock::GetBits(UShort_t *bits) const
+{
+   if (!fIndices) {
+      for (Int_t i=0; i<kBlockSize; i++)
+         bits[i] = fPassing ? 0 : 0xFFFF;
+      return;
+   }
+   if (fType==0) {
+      for (Int_t i=0; i<kBlockSize; i++)
+         bits[i] = fPassing ? fIndices[i] : (UShort_t)~fIndices[i];
+      return;
+   }
+   for (Int_t i=0; i<kBlockSize; i++)
+      bits[i] = fPassing ? 0 : 0xFFFF;
+   for (Int_t i=0; i<fNPassed; i++)
+      bits[fIndices[i]>>4] ^= 1<<(fIndices[i] & 15);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the entries of the block by the ones set in `bits` (kBlockSize UShort_ts)
+/// and optimize the storage
+
+void TEntryListBlock::SetBits(const UShort_t *bits)
+{
+   if (fType!=0 || fN!=kBlockSize || !fIndices) {
+      delete [] fIndices;
+      fIndices = new UShort_t[kBlockSize];
+   }
+   fNPassed = 0;
+   for (Int_t i=0; i<kBlockSize; i++) {
+      fIndices[i] = bits[i];
+      fNPassed += std::bitset<16>(bits[i]).count();
    }
+   fType = 0;
+   fN = kBlockSize;
+   fPassing = true;
    fLastIndexQueried = -1;
    fLastIndexReturned = -1;
    OptimizeStorage();
-   return GetNPassed();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3124,6 +3124,12 @@ Int_t TTree::CheckBranchAddressType(TBranch* branch, TClass* ptrClass, EDataType
 /// the file the baskets will be in the order in which they will be
 /// needed when reading the whole tree sequentially.
 ///
+/// When 'fast' is specified, 'option' can also contain the word
+/// Recompress: the baskets whose compression settings differ from the
+/// destination file's ones are then decompressed and compressed again
+/// with the destination settings, still without unstreaming them; with
+/// implicit multi-threading, the baskets are recompressed in parallel.
+///
 /// For examples of CloneTree, see tutorials:
 ///
 /// - copytree.C:
@@ -3519,7 +3525,8 @@ namespace {
 /// - SortBasketsByBranch
 /// - SortBasketsByEntry
 ///
-/// See TTree::CloneTree for a detailed explanation of the semantics of these 3 options.
+/// See TTree::CloneTree for a detailed explanation of the semantics of these 3 options,
+/// and of the Recompress option.
 ///
 /// If the tree or any of the underlying tree of the chain has an index, that index and any
 /// index in the subsequent underlying TTree objects will be merged.
@@ -4600,6 +4607,17 @@ void TTree::DropBuffers(Int_t)
 /// \note This method calls `TTree::ChangeFile` when the tree reaches a size
 ///       greater than `TTree::fgMaxTreeSize`. This doesn't happen if the tree is
 ///       attached to a `TMemFile` or derivate.
+///
+/// __Filling wide trees in parallel__
+///
+/// When implicit multi-threading is enabled, the baskets that become full are
+/// compressed and written in parallel tasks. In addition, if the tree has at
+/// least GetParallelFillMinBranches() top-level branches (2000 by default), the
+/// branches themselves are serialized into their baskets concurrently, in tasks
+/// filling contiguous groups of branches. This requires the objects of
+/// different top-level branches to be independent of each other: it is not used
+/// for trees with a TBranchRef, and it can be disabled with
+/// SetParallelFillMinBranches(0).
 
 Int_t TTree::Fill()
 {
@@ -4616,6 +4634,24 @@ Int_t TTree::Fill()
    if (fBranchRef)
       fBranchRef->Clear();
 
+   // Report a failure to fill `branch`, `nprevious` failures having been reported already for this entry.
+   auto reportFillError = [this](TBranch *branch, Int_t nwrite, Int_t nprevious) {
+      if (nprevious < 2) {
+         Error("Fill", "Failed filling branch:%s.%s, nbytes=%d, entry=%lld\n"
+                       " This error is symptomatic of a Tree created as a memory-resident Tree\n"
+                       " Instead of doing:\n"
+                       "    TTree *T = new TTree(...)\n"
+                       "    TFile *f = new TFile(...)\n"
+                       " you should do:\n"
+                       "    TFile *f = new TFile(...)\n"
+                       "    TTree *T = new TTree(...)\n\n",
+               GetName(), branch->GetName(), nwrite, fEntries + 1);
+      } else {
+         Error("Fill", "Failed filling branch:%s.%s, nbytes=%d, entry=%lld", GetName(), branch->GetName(), nwrite,
+               fEntries + 1);
+      }
+   };
+
 #ifdef R__USE_IMT
    const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
    ROOT::Internal::TBranchIMTHelper imtHelper;
@@ -4624,6 +4660,41 @@ Int_t TTree::Fill()
       fIMTZipBytes.store(0);
       fIMTTotBytes.store(0);
    }
+
+   const auto minParBranches = useIMT && !fBranchRef ? GetParallelFillMinBranches() : 0;
+   if (minParBranches > 0 && nbranches >= minParBranches) {
+      // Serialize groups of contiguous branches concurrently. Each task has its own helper for the
+      // compression of the baskets it fills, and waits for it: a TTaskGroup is not shared across tasks.
+      ROOT::Internal::TParBranchProcessingRAII pbpRAII;
+      ROOT::TThreadExecutor pool;
+      const Int_t ntasks = std::min<Int_t>(nbranches / 16 + 1, 4 * pool.GetPoolSize());
+      std::atomic<Int_t> nbpar(0);
+      std::atomic<Int_t> nerrpar(0);
+
+      auto fillTask = [&](Int_t task) {
+         ROOT::Internal::TBranchIMTHelper taskHelper;
+         const Int_t first = static_cast<Long64_t>(nbranches) * task / ntasks;
+         const Int_t last = static_cast<Long64_t>(nbranches) * (task + 1) / ntasks;
+         for (Int_t i = first; i < last; ++i) {
+            TBranch *branch = (TBranch *)fBranches.UncheckedAt(i);
+            if (branch->TestBit(kDoNotProcess))
+               continue;
+            const Int_t nwritepar = branch->FillImpl(&taskHelper);
+            if (nwritepar < 0)
+               reportFillError(branch, nwritepar, nerrpar++);
+            else
+               nbpar += nwritepar;
+         }
+         taskHelper.Wait();
+         nbpar += taskHelper.GetNbytes();
+         nerrpar += taskHelper.GetNerrors();
+      };
+      pool.Foreach(fillTask, ROOT::TSeqI(ntasks));
+
+      nbytes += nbpar;
+      nerror += nerrpar;
+      nbranches = 0; // skip the sequential loop below
+   }
 #endif
 
    for (Int_t i = 0; i < nbranches; ++i) {
@@ -4639,20 +4710,7 @@ Int_t TTree::Fill()
       nwrite = branch->FillImpl(useIMT ? &imtHelper : nullptr);
 #endif
       if (nwrite < 0) {
-         if (nerror < 2) {
-            Error("Fill", "Failed filling branch:%s.%s, nbytes=%d, entry=%lld\n"
-                          " This error is symptomatic of a Tree created as a memory-resident Tree\n"
-                          " Instead of doing:\n"
-                          "    TTree *T = new TTree(...)\n"
-                          "    TFile *f = new TFile(...)\n"
-                          " you should do:\n"
-                          "    TFile *f = new TFile(...)\n"
-                          "    TTree *T = new TTree(...)\n\n",
-                  GetName(), branch->GetName(), nwrite, fEntries + 1);
-         } else {
-            Error("Fill", "Failed filling branch:%s.%s, nbytes=%d, entry=%lld", GetName(), branch->GetName(), nwrite,
-                  fEntries + 1);
-         }
+         reportFillError(branch, nwrite, nerror);
          ++nerror;
       } else {
          nbytes += nwrite;
@@ -6260,6 +6318,22 @@ Double_t TTree::GetMaximum(const char* columname)
    return cmax;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the minimum number of top-level branches for which TTree::Fill
+/// serializes the branches concurrently when implicit multi-threading is
+/// enabled; 0 means never.
+///
+/// Unless set with SetParallelFillMinBranches, it is taken from the
+/// TTree.ParallelFillMinBranches option (2000 by default).
+
+Int_t TTree::GetParallelFillMinBranches() const
+{
+   if (fParallelFillMinBranches >= 0)
+      return fParallelFillMinBranches;
+   static const Int_t minBranches = gEnv->GetValue("TTree.ParallelFillMinBranches", 2000);
+   return minBranches;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Static function which returns the tree file size limit in bytes.
 
@@ -6923,11 +6997,18 @@ Long64_t TTree::Merge(TCollection* li, Option_t *options)
 /// this TTree object (so that this TTree object is now the appropriate to
 /// use for further merging).
 ///
+/// If info->fOptions contains "recompress", the baskets are copied with the
+/// "fast recompress" option of CloneTree, i.e. without unstreaming them but
+/// recompressed with the compression settings of the output file.
+///
 /// Returns the total number of entries in the merged tree.
 
 Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
 {
-   const char *options = info ? info->fOptions.Data() : "";
+   TString mergeOptions = info ? info->fOptions : TString();
+   if (mergeOptions.Contains("recompress") && !mergeOptions.Contains("fast"))
+      mergeOptions.Append(" fast");
+   const char *options = mergeOptions.Data();
    if (info && info->fIsFirst && info->fOutputDirectory && info->fOutputDirectory->GetFile() != GetCurrentFile()) {
       if (GetCurrentFile() == nullptr) {
          // In memory TTree, all we need to do is ... write it.
@@ -8345,6 +8426,28 @@ void TTree::SetAutoSave(Long64_t autos)
    fAutoSave = autos;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Choose the compression settings of each branch automatically.
+///
+/// When the first basket of a branch is written, it is compressed with each of
+/// the candidate settings of `selection` and decompressed again; the branch then
+/// uses the candidate that best matches the objective of `selection` for all its
+/// baskets. This overrides the compression settings given to the branches, and
+/// applies to the branches whose first basket is written after this call.
+/// ~~~ {.cpp}
+///     ROOT::RCompressionAutoSelection selection;
+///     // smallest baskets that still decompress at 500 MB/s or faster
+///     selection.fConstraint = 500;
+///     tree->SetAutoCompression(selection);
+/// ~~~
+/// Call ResetAutoCompression() to go back to the branches' own settings.
+
+void TTree::SetAutoCompression(const ROOT::RCompressionAutoSelection &selection)
+{
+   fAutoCompression = selection;
+   fHasAutoCompression = true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a branch's basket size.
 ///
@@ -8745,6 +8848,11 @@ Int_t TTree::SetCacheSizeAux(bool autocache /* = true */, Long64_t cacheSize /*
       return 0;
    }
 
+   if (autocache && file->IsMemoryMapped()) {
+      // The baskets are read straight from the mapping, a cache would only add a copy
+      return 0;
+   }
+
    // Check for an existing cache
    TTreeCache* pf = GetReadCache(file);
    if (pf) {
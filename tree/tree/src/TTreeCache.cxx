@@ -106,6 +106,29 @@ The learning period is stopped (and prefetching is started) when:
      fEntryMin + fgLearnEntries.
    - A 'cached' TChain switches over to a new file.
 
+### Reusing the learnt branches in later jobs
+Many short jobs reading the same kind of trees all spend their first entries
+learning the same set of branches. With a profile directory set, via
+TTreeCache::SetProfileDir, the environment variable `ROOT_TTREECACHE_PROFILEDIR`
+or the TTreeCache.ProfileDir option, the cache saves the branches it learnt at
+the end of the learning phase in a small text file of that directory. The file
+is specific to the tree name and to a hash of its branch names. The next caches
+for a tree with the same name and branches add the saved branches as soon as
+the first branch is read and skip the learning phase. Branches read later that
+are not in the profile are cached too; to learn the branches again, remove the
+profile file.
+
+
+### Reading the next clusters while the current ones are processed
+In the asynchronous prefetching mode, enabled with the TFile.AsyncPrefetching
+option or with SetEnablePrefetching, the cache uses two buffers: while the
+baskets of one buffer are read, the baskets of the next clusters are read into
+the other buffer by a separate thread, hiding the latency of the file access.
+The two buffers together take at most TTreeCache::GetPrefetchMemoryFactor times
+the cache size (2 by default, i.e. each buffer is as large as the cache). A
+larger factor makes each read ahead cover more clusters, at the price of more
+memory; it can be set with SetPrefetchMemoryFactor or the
+TTreeCache.PrefetchMemoryFactor option.
 
 \anchor cachemisses
 ## Self-optimization in presence of cache misses
@@ -301,10 +324,24 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TVirtualPerfStats.h"
 #include <climits>
 
+#include <fstream>
 #include <memory>
+#include <string>
 
 Int_t TTreeCache::fgLearnEntries = 100;
 
+namespace {
+/// The directory of the profiles of the learnt branches, initialized from the environment.
+TString &ProfileDir()
+{
+   static TString dir = [] {
+      const char *env = gSystem->Getenv("ROOT_TTREECACHE_PROFILEDIR");
+      return TString((env && *env) ? env : gEnv->GetValue("TTreeCache.ProfileDir", ""));
+   }();
+   return dir;
+}
+} // Anonymous namespace.
+
 ClassImp(TTreeCache);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -321,6 +358,7 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    : TFileCacheRead(tree->GetCurrentFile(), buffersize, tree), fEntryMax(tree->GetEntriesFast()), fEntryNext(0),
      fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType())
 {
+   SetPrefetchMemoryFactor(gEnv->GetValue("TTreeCache.PrefetchMemoryFactor", 2.));
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntriesFast();
    fBranches = new TObjArray(nleaves);
@@ -356,6 +394,13 @@ Int_t TTreeCache::LearnBranch(TBranch *b, bool subbranches /*= false*/)
    // Reject branch that are not from the cached tree.
    if (!b || fTree->GetTree() != b->GetTree()) return -1;
 
+   // A profile saved by a previous process replaces the learning phase.
+   if (!fLearnPrefilling && fNbranches == 0 && !fProfileChecked) {
+      fProfileChecked = true;
+      if (LoadProfile())
+         return AddBranch(b, subbranches);
+   }
+
    // Is this the first addition of a branch (and we are learning and we are in
    // the expected TTree), then prefill the cache.  (We expect that in future
    // release the Prefill-ing will be the default so we test for that inside the
@@ -1130,6 +1175,8 @@ bool TTreeCache::FillBuffer()
             // the process of filling both prefetching buffers
             StopLearningPhase();
             fIsManual = false;
+            if (!fLearnPrefilling)
+               SaveProfile();
          }
       }
       if (fIsLearning) { //  Learning mode
@@ -1191,6 +1238,9 @@ bool TTreeCache::FillBuffer()
       }
    }
 
+   // Reaching the end of this function with these conditions ends a learning phase that was not stopped explicitly.
+   const bool endsLearning = fIsLearning && !fIsManual && !fLearnPrefilling && !fEnablePrefetching;
+
    // Set to true to enable all debug output without having to set gDebug
    // Replace this once we have a per module and/or per class debugging level/setting.
    static constexpr bool showMore = false;
@@ -1307,6 +1357,12 @@ bool TTreeCache::FillBuffer()
       }
    }
 
+   // In prefetching mode, one buffer is read while the next one is filled asynchronously:
+   // each of them gets half of the memory allowed by fPrefetchMemoryFactor.
+   const Int_t bufferSizeMin =
+      fEnablePrefetching ? static_cast<Int_t>(std::min<Double_t>(0.5 * fPrefetchMemoryFactor * fBufferSizeMin, INT_MAX))
+                         : fBufferSizeMin;
+
    //clear cache buffer
    Int_t ntotCurrentBuf = 0;
    if (fEnablePrefetching){ //prefetching mode
@@ -1372,7 +1428,7 @@ bool TTreeCache::FillBuffer()
        &cursor, &lowestMaxEntry, &maxReadEntry, &minEntry,
        &reachedEnd, &skippedFirst, &oncePerBranch, &nDistinctLoad, &progress,
        &ranges, &memRanges, &reqRanges,
-       &ntotCurrentBuf, &nReadPrefRequest](EPass pass, ENarrow narrow, Long64_t maxCollectEntry) {
+       &ntotCurrentBuf, &nReadPrefRequest, bufferSizeMin](EPass pass, ENarrow narrow, Long64_t maxCollectEntry) {
          // The first pass we add one basket per branches around the requested entry
          // then in the second pass we add the other baskets of the cluster.
          // This is to support the case where the cache is too small to hold a full cluster.
@@ -1461,12 +1517,12 @@ bool TTreeCache::FillBuffer()
                Int_t len = lbaskets[j];
                if (pos <= 0 || len <= 0)
                   continue;
-               if (len > fBufferSizeMin) {
+               if (len > bufferSizeMin) {
                   // Do not cache a basket if it is bigger than the cache size!
                   if ((showMore || gDebug > 7) &&
                       (!(entries[j] < minEntry && (j < nb - 1 && entries[j + 1] <= minEntry))))
                      Info("FillBuffer", "Skipping branch %s basket %d is too large for the cache: %d > %d",
-                          b->GetName(), j, len, fBufferSizeMin);
+                          b->GetName(), j, len, bufferSizeMin);
                   continue;
                }
 
@@ -1535,7 +1591,7 @@ bool TTreeCache::FillBuffer()
                   }
                }
 
-               if (((Long64_t)ntotCurrentBuf + len) > fBufferSizeMin) {
+               if (((Long64_t)ntotCurrentBuf + len) > bufferSizeMin) {
                   // Humm ... we are going to go over the requested size.
                   if (clusterIterations > 0 && cursor[i].fLoadedOnce) {
                      // We already have a full cluster and now we would go over the requested
@@ -1545,14 +1601,14 @@ bool TTreeCache::FillBuffer()
                         Info(
                            "FillBuffer",
                            "Breaking early because %lld is greater than %d at cluster iteration %d will restart at %lld",
-                           ((Long64_t)ntotCurrentBuf + len), fBufferSizeMin, clusterIterations, minEntry);
+                           ((Long64_t)ntotCurrentBuf + len), bufferSizeMin, clusterIterations, minEntry);
                      }
                      fEntryNext = minEntry;
                      filled = true;
                      break;
                   } else {
                      if (pass == kStart || !cursor[i].fLoadedOnce) {
-                        if (((Long64_t)ntotCurrentBuf + len) > 4LL * fBufferSizeMin) {
+                        if (((Long64_t)ntotCurrentBuf + len) > 4LL * bufferSizeMin) {
                            // Okay, so we have not even made one pass and we already have
                            // accumulated request for more than twice the memory size ...
                            // So stop for now, and will restart at the same point, hoping
@@ -1562,7 +1618,7 @@ bool TTreeCache::FillBuffer()
                            if (showMore || gDebug > 5) {
                               Info("FillBuffer", "Breaking early because %lld is greater than 4*%d at cluster iteration "
                                                  "%d pass %d will restart at %lld",
-                                   ((Long64_t)ntotCurrentBuf + len), fBufferSizeMin, clusterIterations, pass, fEntryNext);
+                                   ((Long64_t)ntotCurrentBuf + len), bufferSizeMin, clusterIterations, pass, fEntryNext);
                            }
                            filled = true;
                            break;
@@ -1571,12 +1627,12 @@ bool TTreeCache::FillBuffer()
                         // We have made one pass through the branches and thus already
                         // requested one basket per branch, let's stop prefetching
                         // now.
-                        if (((Long64_t)ntotCurrentBuf + len) > 2LL * fBufferSizeMin) {
+                        if (((Long64_t)ntotCurrentBuf + len) > 2LL * bufferSizeMin) {
                            fEntryNext = maxReadEntry;
                            if (showMore || gDebug > 5) {
                               Info("FillBuffer", "Breaking early because %lld is greater than 2*%d at cluster iteration "
                                                  "%d pass %d will restart at %lld",
-                                   ((Long64_t)ntotCurrentBuf + len), fBufferSizeMin, clusterIterations, pass, fEntryNext);
+                                   ((Long64_t)ntotCurrentBuf + len), bufferSizeMin, clusterIterations, pass, fEntryNext);
                            }
                            filled = true;
                            break;
@@ -1624,13 +1680,13 @@ bool TTreeCache::FillBuffer()
                   // Info("FillBuffer","maxCollectEntry incremented from %lld to %lld", maxReadEntry, entries[j+1]);
                   maxReadEntry = entries[j+1];
                }
-               if (ntotCurrentBuf > 4LL * fBufferSizeMin) {
+               if (ntotCurrentBuf > 4LL * bufferSizeMin) {
                   // Humm something wrong happened.
                   Warning("FillBuffer", "There is more data in this cluster (starting at entry %lld to %lld, "
                                         "current=%lld) than usual ... with %d %.3f%% of the branches we already have "
                                         "%d bytes (instead of %d)",
                           fEntryCurrent, fEntryNext, entries[j], i, (100.0 * i) / ((float)fNbranches), ntotCurrentBuf,
-                          fBufferSizeMin);
+                          bufferSizeMin);
                }
                if (pass == kStart) {
                   // In the first pass, we record one basket per branch and move on to the next branch.
@@ -1706,7 +1762,7 @@ bool TTreeCache::FillBuffer()
       // at,
       // which start at 'minEntry', is not past the end of the requested range (minEntry < fEntryMax)
       // and we guess that we not going to go over the requested amount of memory by asking for another set
-      // of entries (fBufferSizeMin > ((Long64_t)ntotCurrentBuf*(clusterIterations+1))/clusterIterations).
+      // of entries (bufferSizeMin > ((Long64_t)ntotCurrentBuf*(clusterIterations+1))/clusterIterations).
       // ntotCurrentBuf / clusterIterations is the average size we are accumulated so far at each loop.
       // and thus (ntotCurrentBuf / clusterIterations) * (clusterIterations+1) is a good guess at what the next total
       // size
@@ -1714,10 +1770,10 @@ bool TTreeCache::FillBuffer()
       // be 'large' (i.e. 30Mb * 300 intervals) and can overflow the numerical limit of Int_t (i.e. become
       // artificially negative).   To avoid this issue we promote ntotCurrentBuf to a long long (64 bits rather than 32
       // bits)
-      if (!((fBufferSizeMin > ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations) &&
+      if (!((bufferSizeMin > ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations) &&
             (prevNtot < ntotCurrentBuf) && (minEntry < fEntryMax))) {
          if (showMore || gDebug > 6)
-            Info("FillBuffer", "Breaking because %d <= %lld || (%d >= %d) || %lld >= %lld", fBufferSizeMin,
+            Info("FillBuffer", "Breaking because %d <= %lld || (%d >= %d) || %lld >= %lld", bufferSizeMin,
                  ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations, prevNtot, ntotCurrentBuf,
                  minEntry, fEntryMax);
          break;
@@ -1775,7 +1831,7 @@ bool TTreeCache::FillBuffer()
    } else {
       if (showMore || gDebug > 5) {
          Info("FillBuffer", "Complete adding %d baskets from %d branches taking in memory %d out of %d",
-              nReadPrefRequest, reqRanges.BranchesRegistered(), ntotCurrentBuf, fBufferSizeMin);
+              nReadPrefRequest, reqRanges.BranchesRegistered(), ntotCurrentBuf, bufferSizeMin);
       }
    }
 
@@ -1791,6 +1847,8 @@ bool TTreeCache::FillBuffer()
       }
    }
    fIsLearning = false;
+   if (endsLearning)
+      SaveProfile();
    return true;
 }
 
@@ -1876,6 +1934,98 @@ Int_t TTreeCache::GetLearnEntries()
    return fgLearnEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function returning the directory of the profiles of the learnt
+/// branches, empty if the profiles are disabled. See SetProfileDir.
+
+const char *TTreeCache::GetProfileDir()
+{
+   return ProfileDir().Data();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the profile file of the current tree: it is made of the
+/// name of the tree and of a hash of the names of all its branches, so that a
+/// profile is only used for trees with the same structure.
+
+TString TTreeCache::GetProfileFileName() const
+{
+   const TString &dir = ProfileDir();
+   if (dir.IsNull() || !fTree || !fTree->GetTree())
+      return "";
+
+   TTree *tree = fTree->GetTree();
+   TString branchNames = tree->GetName();
+   TObjArray *leaves = tree->GetListOfLeaves();
+   for (Int_t i = 0; i < leaves->GetEntriesFast(); ++i) {
+      branchNames += ':';
+      branchNames += static_cast<TLeaf *>(leaves->UncheckedAt(i))->GetBranch()->GetName();
+   }
+   TString name = tree->GetName();
+   name.ReplaceAll("/", "_");
+   return TString::Format("%s/%s.%08x.ttreecache", dir.Data(), name.Data(), branchNames.Hash());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the branches listed in the profile of the current tree to the cache and
+/// stop the learning phase. Branches of the profile that the tree does not have
+/// are ignored. Returns false if there is no profile for the current tree.
+
+bool TTreeCache::LoadProfile()
+{
+   const TString fileName = GetProfileFileName();
+   if (fileName.IsNull())
+      return false;
+   std::ifstream profile(fileName.Data());
+   if (!profile)
+      return false;
+
+   Int_t nAdded = 0;
+   std::string branchName;
+   while (std::getline(profile, branchName)) {
+      if (branchName.empty() || branchName[0] == '#')
+         continue;
+      if (TBranch *b = fTree->GetBranch(branchName.c_str()))
+         nAdded += (AddBranch(b) == 0);
+   }
+   if (nAdded == 0)
+      return false;
+
+   if (gDebug > 0)
+      Info("LoadProfile", "%d branches added to the cache from %s", nAdded, fileName.Data());
+   StopLearningPhase();
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save the names of the branches in the cache in the profile of the current
+/// tree. The file is written under a temporary name and then renamed, so that
+/// concurrent jobs never read an incomplete profile.
+
+void TTreeCache::SaveProfile() const
+{
+   const TString fileName = GetProfileFileName();
+   if (fileName.IsNull() || fBrNames->GetEntries() == 0)
+      return;
+
+   const TString tmpFileName = TString::Format("%s.%d.tmp", fileName.Data(), gSystem->GetPid());
+   {
+      std::ofstream profile(tmpFileName.Data());
+      if (!profile) {
+         Warning("SaveProfile", "cannot write the profile of the learnt branches in %s", tmpFileName.Data());
+         return;
+      }
+      profile << "# Branches learnt by the TTreeCache of tree " << fTree->GetTree()->GetName() << "\n";
+      TIter next(fBrNames);
+      while (auto os = static_cast<TObjString *>(next()))
+         profile << os->GetName() << "\n";
+   }
+   if (gSystem->Rename(tmpFileName, fileName) != 0) {
+      gSystem->Unlink(tmpFileName);
+      Warning("SaveProfile", "cannot write the profile of the learnt branches in %s", fileName.Data());
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print cache statistics. Like:
 ///
@@ -2148,6 +2298,34 @@ void TTreeCache::SetLearnEntries(Int_t n)
    fgLearnEntries = n;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the bound of the memory used by the two buffers of the asynchronous
+/// prefetching mode, as a multiple of the cache size. Each buffer is filled
+/// with `factor / 2` times the cache size. The factor must be at least 1; the
+/// default is 2, i.e. each buffer is filled as much as the cache in the
+/// normal mode. It has no effect outside of the prefetching mode.
+
+void TTreeCache::SetPrefetchMemoryFactor(Double_t factor)
+{
+   if (factor < 1) {
+      Warning("SetPrefetchMemoryFactor", "the factor must be at least 1, %g was given: using 1", factor);
+      factor = 1;
+   }
+   fPrefetchMemoryFactor = factor;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to set the directory in which the caches save the branches
+/// they learnt, and from which they load the branches learnt by previous jobs.
+/// An empty string disables the profiles.
+/// The default can be set with the TTreeCache.ProfileDir option or the
+/// environment variable ROOT_TTREECACHE_PROFILEDIR.
+
+void TTreeCache::SetProfileDir(const char *dir)
+{
+   ProfileDir() = dir ? dir : "";
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set whether the learning period is started with a prefilling of the
 /// cache and which type of prefilling is used.
@@ -2171,6 +2349,7 @@ void TTreeCache::StartLearningPhase()
 {
    fIsLearning = true;
    fIsManual = false;
+   fProfileChecked = false;
    fNbranches  = 0;
    if (fBrNames) fBrNames->Delete();
    fIsTransferred = false;
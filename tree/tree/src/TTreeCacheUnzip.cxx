@@ -29,11 +29,13 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMutex.h"
 
 #ifdef R__USE_IMT
-#include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <thread>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -151,14 +153,15 @@ void TTreeCacheUnzip::UnzipState::SetUnzipped(Int_t index, char* buf, Int_t len)
 bool TTreeCacheUnzip::UnzipState::TryUnzipping(Int_t index) {
    Byte_t oldValue = kUntouched;
    Byte_t newValue = kProgress;
-   return fUnzipStatus[index].compare_exchange_weak(oldValue, newValue, std::memory_order_release, std::memory_order_relaxed);
+   // A spurious failure would leave the basket to the main thread, hence the strong version.
+   return fUnzipStatus[index].compare_exchange_strong(oldValue, newValue, std::memory_order_release,
+                                                      std::memory_order_relaxed);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fAsyncReading(false),
-   fEmpty(true),
    fCycle(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
@@ -177,7 +180,6 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
 
 TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tree,buffersize),
    fAsyncReading(false),
-   fEmpty(true),
    fCycle(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
@@ -234,6 +236,13 @@ void TTreeCacheUnzip::Init()
 
 TTreeCacheUnzip::~TTreeCacheUnzip()
 {
+#ifdef R__USE_IMT
+   // The unzipping tasks use the data members: they must be over before these are destroyed.
+   if (fUnzipTaskGroup) {
+      fUnzipTaskGroup->Cancel();
+      fUnzipTaskGroup.reset();
+   }
+#endif
    ResetCache();
    fUnzipState.Clear(fNseekMax);
 }
@@ -307,6 +316,7 @@ bool TTreeCacheUnzip::FillBuffer()
 
    //clear cache buffer
    TFileCacheRead::Prefetch(0,0);
+   fBasketFirstEntry.clear();
 
    //store baskets
    for (Int_t i = 0; i < fNbranches; i++) {
@@ -338,6 +348,7 @@ bool TTreeCacheUnzip::FillBuffer()
          fNReadPref++;
 
          TFileCacheRead::Prefetch(pos, len);
+         fBasketFirstEntry.push_back(entries[j]);
       }
       if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
    }
@@ -512,7 +523,6 @@ void TTreeCacheUnzip::ResetCache()
       fUnzipState.Reset(fNseekMax, fNseek);
       fNseekMax = fNseek;
    }
-   fEmpty = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -605,52 +615,65 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Reserve the next basket to unzip, in the order of fUnzipOrder, for the
+/// calling thread. Returns its index, or -1 if all the baskets were taken.
+
+Int_t TTreeCacheUnzip::NextBasketToUnzip()
+{
+   const Int_t nBaskets = std::min<Int_t>(fUnzipOrder.size(), fNseek);
+   for (Int_t i = fUnzipCursor++; i < nBaskets; i = fUnzipCursor++) {
+      const Int_t index = fUnzipOrder[i];
+      if (fUnzipState.TryUnzipping(index))
+         return index;
+   }
+   return -1;
+}
+
 #ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// Submit the unzipping of the baskets in the cache to the tasks of the ROOT
+/// task arena shared with the other IMT users, e.g. RDataFrame.
+///
+/// The baskets are unzipped in the order of their first entry, so that the
+/// ones that are needed first are ready first. Each task takes the next basket
+/// from that shared order until none is left, and there is at most one task
+/// per worker thread and per fUnzipGroupSize bytes of zipped baskets: tasks
+/// never wait, and the main thread takes baskets from the same order when the
+/// one it needs is being unzipped.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
-   auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
-
-         for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
-               Int_t res = UnzipCache(ii);
-               if(res)
-                  if (gDebug > 0)
-                     Info("UnzipCache", "Unzipping failed or cache is in learning state");
-            }
-         }
-         return nullptr;
-      };
-
-      Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
-         }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
+   if (fUnzipTaskGroup) {
+      fUnzipTaskGroup->Cancel();
+      fUnzipTaskGroup.reset();
+   }
+
+   fUnzipOrder.resize(fNseek);
+   std::iota(fUnzipOrder.begin(), fUnzipOrder.end(), 0);
+   if (fBasketFirstEntry.size() == static_cast<std::size_t>(fNseek)) {
+      std::stable_sort(fUnzipOrder.begin(), fUnzipOrder.end(),
+                       [this](Int_t a, Int_t b) { return fBasketFirstEntry[a] < fBasketFirstEntry[b]; });
+   }
+   fUnzipCursor = 0;
+
+   const Int_t cycle = fCycle;
+   auto unzipFunction = [this, cycle]() {
+      Int_t index;
+      // If cache is invalidated we should return immediately.
+      while (fIsTransferred && cycle == fCycle && (index = NextBasketToUnzip()) >= 0) {
+         if (UnzipCache(index) && gDebug > 0)
+            Info("UnzipCache", "Unzipping failed or cache is in learning state");
       }
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
    };
 
+   if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
+   const Long64_t nGroups = std::max<Long64_t>(1, fNtot / fUnzipGroupSize);
+   const Long64_t nTasks = std::min<Long64_t>(nGroups, std::max(1u, ROOT::GetThreadPoolSize()));
+
    fUnzipTaskGroup = std::make_unique<ROOT::Experimental::TTaskGroup>();
-   fUnzipTaskGroup->Run(mapFunction);
+   for (Long64_t i = 0; i < nTasks; ++i)
+      fUnzipTaskGroup->Run(unzipFunction);
 
    return 0;
 }
@@ -719,26 +742,14 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, bool
                return fUnzipState.fUnzipLen[seekidx];
             }
 
-            // If the requested basket is being unzipped by a background task, we try to steal a blk to unzip.
-            Int_t reqi = -1;
-
+            // If the requested basket is being unzipped by a background task, we help the tasks with the
+            // baskets needed next rather than waiting.
             if (fUnzipState.IsProgress(seekidx)) {
-               if (fEmpty) {
-                  for (Int_t ii = 0; ii < fNseek; ++ii) {
-                     Int_t idx = (seekidx + 1 + ii) % fNseek;
-                     if (fUnzipState.IsUntouched(idx)) {
-                        if(fUnzipState.TryUnzipping(idx)) {
-                           reqi = idx;
-                           break;
-                        }
-                     }
-                  }
-                  if (reqi < 0) {
-                     fEmpty = false;
-                  } else {
-                     UnzipCache(reqi);
-                  }
-               }
+               const Int_t reqi = NextBasketToUnzip();
+               if (reqi >= 0)
+                  UnzipCache(reqi);
+               else
+                  std::this_thread::yield();
 
                if ( myCycle != fCycle ) {
                   if (gDebug > 0)
@@ -34,9 +34,16 @@ Class implementing or helping  the various TTree cloning method
 #include "TLeafC.h"
 #include "TFileCacheRead.h"
 #include "TTreeCache.h"
+#include "TROOT.h"
 #include "snprintf.h"
 
 #include <algorithm>
+#include <memory>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -100,6 +107,12 @@ bool TTreeCloner::CompareEntry::operator()(UInt_t i1, UInt_t i2)
 /// This means that on the file the baskets will be in the order
 /// in which they will be needed when reading the whole tree
 /// sequentially.
+///
+/// If 'method' contains "Recompress", the baskets whose compression
+/// settings differ from the ones of the output branch are decompressed
+/// and compressed again with the output settings, without unstreaming
+/// them. When implicit multi-threading is enabled, the baskets are
+/// recompressed in parallel, in batches of the size of the file cache.
 
 TTreeCloner::TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t options) :
    TTreeCloner(from, to, to ? to->GetDirectory() : nullptr, method, options)
@@ -128,6 +141,7 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    fWarningMsg(),
    fIsValid(true),
    fNeedConversion(false),
+   fRecompress(false),
    fOptions(options),
    fFromTree(from),
    fToTree(to),
@@ -161,6 +175,7 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
       //::Info("TTreeCloner::TTreeCloner","use: kSortBasketsByOffset");
       fCloneMethod = TTreeCloner::kSortBasketsByOffset;
    }
+   fRecompress = opt.Contains("recompress");
    if (fToTree) fToStartEntries = fToTree->GetEntries();
 
    if (fFromTree == nullptr) {
@@ -728,6 +743,10 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 
 void TTreeCloner::WriteBaskets()
 {
+   if (fRecompress) {
+      WriteRecompressedBaskets();
+      return;
+   }
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -780,3 +799,117 @@ void TTreeCloner::WriteBaskets()
    }
    delete basket;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the basket from the input file to the output file, recompressing
+/// the ones whose compression settings differ from the output branch ones.
+///
+/// The baskets are processed in batches, in the order chosen by SortBaskets:
+/// the raw baskets of a batch are read sequentially, recompressed (in parallel
+/// with implicit multi-threading) and then written sequentially.
+
+void TTreeCloner::WriteRecompressedBaskets()
+{
+   // Resolve the compression settings of a branch, as TBasket::WriteBuffer does.
+   auto getSettings = [](TBranch *br, TFile *file) {
+      Int_t level = br->GetCompressionLevel();
+      if (level == ROOT::RCompressionSetting::ELevel::kInherit)
+         level = file ? file->GetCompressionLevel() : 0;
+      Int_t algorithm = br->GetCompressionAlgorithm();
+      if (algorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
+         algorithm = file ? file->GetCompressionAlgorithm() : 0;
+      return level > 0 ? 100 * algorithm + level : 0;
+   };
+
+   const Long64_t batchSize = fCacheSize > 0 ? fCacheSize : 32 * 1024 * 1024;
+   std::vector<std::unique_ptr<TBasket>> baskets;
+   std::vector<UInt_t> batch;      // indices in fBasketIndex of the baskets of the current batch
+   std::vector<Int_t> compress;    // target compression settings of each basket of the batch, -1 to copy it as is
+   std::vector<Int_t> status;
+
+   for (UInt_t j = 0, notCached = 0; j < fMaxBaskets;) {
+      // Read the raw baskets of the next batch.
+      batch.clear();
+      compress.clear();
+      Long64_t size = 0;
+      for (; j < fMaxBaskets && (batch.empty() || size < batchSize); ++j) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         TBranch *to = (TBranch *)fToBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+         Long64_t pos = from->GetBasketSeek(index);
+         if (pos == 0) {
+            // Memory-resident baskets are compressed with the output settings when flushed; keep the order of
+            // the baskets of this branch by writing out the current batch first.
+            if (!batch.empty())
+               break;
+            TBasket *frombasket = from->GetBasket(index);
+            if (frombasket && frombasket->GetNevBuf() > 0) {
+               TBasket *tobasket = (TBasket *)frombasket->Clone();
+               tobasket->SetBranch(to);
+               to->AddBasket(*tobasket, false, fToStartEntries + from->GetBasketEntry()[index]);
+               to->FlushOneBasket(to->GetWriteBasket());
+            }
+            continue;
+         }
+         TFile *fromfile = from->GetFile(0);
+         if (fFileCache && j >= notCached) {
+            notCached = FillCache(notCached);
+         }
+         if (batch.size() == baskets.size())
+            baskets.emplace_back(new TBasket());
+         TBasket *basket = baskets[batch.size()].get();
+         if (from->GetBasketBytes()[index] == 0) {
+            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+         }
+         Int_t len = from->GetBasketBytes()[index];
+         basket->LoadBasketBuffers(pos, len, fromfile, fFromTree);
+         const Int_t fromSettings = getSettings(from, fromfile);
+         const Int_t toSettings = getSettings(to, fToFile);
+         compress.push_back(fromSettings == toSettings ? -1 : toSettings);
+         batch.push_back(j);
+         size += len;
+      }
+      if (batch.empty())
+         continue;
+
+      // Recompress the baskets of the batch.
+      status.assign(batch.size(), 0);
+      auto recompress = [&](UInt_t i) {
+         if (compress[i] >= 0)
+            status[i] = baskets[i]->Recompress(compress[i]);
+      };
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && batch.size() > 1) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(recompress, ROOT::TSeqU(batch.size()));
+      } else
+#endif
+      {
+         for (UInt_t i = 0; i < batch.size(); ++i)
+            recompress(i);
+      }
+
+      // Write the baskets of the batch.
+      for (UInt_t i = 0; i < batch.size(); ++i) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[batch[i]]]);
+         TBranch *to = (TBranch *)fToBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[batch[i]]]);
+         Int_t index = fBasketNum[fBasketIndex[batch[i]]];
+         TBasket *basket = baskets[i].get();
+         if (status[i] != 0) {
+            Warning("WriteRecompressedBaskets", "Could not recompress basket %d of branch %s, copying it as is.",
+                    index, from->GetName());
+         }
+         basket->IncrementPidOffset(fPidOffset);
+         basket->CopyTo(fToFile);
+         if (IsInPlace()) {
+            const Int_t delta = basket->GetNbytes() - to->fBasketBytes[index];
+            to->fBasketSeek[index] = basket->GetSeekKey();
+            to->fBasketBytes[index] = basket->GetNbytes();
+            to->fZipBytes += delta;
+            fToTree->AddZipBytes(delta);
+         } else {
+            to->AddBasket(*basket, true, fToStartEntries + from->GetBasketEntry()[index]);
+         }
+      }
+   }
+}
@@ -6,6 +6,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
@@ -15,6 +16,9 @@
 
 #include "gtest/gtest.h"
 
+#include <memory>
+#include <vector>
+
 class BulkApiVariableTest : public ::testing::Test {
 public:
    static constexpr Long64_t fClusterSize = 1e5;
@@ -233,3 +237,92 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, bulkRead)
+{
+   std::unique_ptr<TFile> hfile{TFile::Open(fFileName.c_str())};
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   ASSERT_TRUE(branchFloat->GetBulkRead().SupportsBulkRead());
+
+   TBufferFile floatBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile countBuf(TBuffer::kWrite, 32 * 1024);
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   while (evt_idx < fEventCount) {
+      const auto count = branchFloat->GetBulkRead().GetBulkEntries(evt_idx, floatBuf, &countBuf);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(branchDouble->GetBulkRead().GetBulkEntries(evt_idx, doubleBuf), count);
+
+      const auto counts = reinterpret_cast<const Int_t *>(countBuf.GetCurrent());
+      const auto floats = reinterpret_cast<const float *>(floatBuf.GetCurrent());
+      const auto doubles = reinterpret_cast<const double *>(doubleBuf.GetCurrent());
+      for (Int_t idx = 0, offset = 0; idx < count; idx++) {
+         ASSERT_EQ(counts[idx], (evt_idx + idx + 1) % 10);
+         for (Int_t entry_idx = 0; entry_idx < counts[idx]; entry_idx++, offset++) {
+            // beyond that, the float counter used to write the file loses precision
+            if (evt_idx < 1600000) {
+               ASSERT_EQ(floats[offset], idx_f);
+               ASSERT_EQ(doubles[offset], idx_d);
+            }
+            idx_f++;
+            idx_d++;
+         }
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, fEventCount);
+}
+
+TEST(BulkApiVarLength, stdVectorBulkRead)
+{
+   const auto fileName = "BulkApiVarLengthVector.root";
+   const Long64_t nEvents = 10000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("T", "A ROOT tree of a std::vector<float> branch.");
+      std::vector<float> v;
+      t.Branch("v", &v);
+      for (Long64_t ev = 0; ev < nEvents; ev++) {
+         v.resize(ev % 7);
+         for (std::size_t idx = 0; idx < v.size(); idx++)
+            v[idx] = ev * 10 + idx;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   std::unique_ptr<TFile> hfile{TFile::Open(fileName)};
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branch = tree->GetBranch("v");
+   ASSERT_TRUE(branch);
+   ASSERT_TRUE(branch->GetBulkRead().SupportsBulkRead());
+
+   TBufferFile valueBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile countBuf(TBuffer::kWrite, 32 * 1024);
+   Long64_t evt_idx = 0;
+   while (evt_idx < nEvents) {
+      const auto count = branch->GetBulkRead().GetBulkEntries(evt_idx, valueBuf, &countBuf);
+      ASSERT_GT(count, 0);
+      const auto counts = reinterpret_cast<const Int_t *>(countBuf.GetCurrent());
+      const auto values = reinterpret_cast<const float *>(valueBuf.GetCurrent());
+      for (Int_t idx = 0, offset = 0; idx < count; idx++) {
+         const auto ev = evt_idx + idx;
+         ASSERT_EQ(counts[idx], ev % 7);
+         for (Int_t entry_idx = 0; entry_idx < counts[idx]; entry_idx++, offset++)
+            ASSERT_EQ(values[offset], float(ev * 10 + entry_idx));
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, nEvents);
+
+   gSystem->Unlink(fileName);
+}
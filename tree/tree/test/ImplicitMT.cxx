@@ -6,6 +6,9 @@
 
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -57,4 +60,56 @@ TEST(TChainImplicitMT, propagateToTTree)
    gSystem->Unlink(fname1);
 }
 
+TEST(TTreeImplicitMT, parallelFill)
+{
+   ROOT::EnableImplicitMT(4);
+   const auto ofileName = "parallelFillMT.root";
+   const int nBranches = 64;
+   const int nEntries = 5000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetParallelFillMinBranches(16);
+      EXPECT_EQ(t.GetParallelFillMinBranches(), 16);
+      std::vector<int> ints(nBranches);
+      std::vector<std::vector<float>> vecs(nBranches);
+      for (int b = 0; b < nBranches; ++b) {
+         t.Branch(("i" + std::to_string(b)).c_str(), &ints[b]);
+         t.Branch(("v" + std::to_string(b)).c_str(), &vecs[b], 512);
+      }
+      for (int e = 0; e < nEntries; ++e) {
+         for (int b = 0; b < nBranches; ++b) {
+            ints[b] = e * nBranches + b;
+            vecs[b].assign(e % 7, b + 0.5f * e);
+         }
+         EXPECT_GT(t.Fill(), 0);
+      }
+      t.Write();
+   }
+
+   ROOT::DisableImplicitMT();
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   EXPECT_EQ(t->GetEntries(), nEntries);
+   std::vector<int> ints(nBranches);
+   std::vector<std::vector<float> *> vecs(nBranches, nullptr);
+   for (int b = 0; b < nBranches; ++b) {
+      t->SetBranchAddress(("i" + std::to_string(b)).c_str(), &ints[b]);
+      t->SetBranchAddress(("v" + std::to_string(b)).c_str(), &vecs[b]);
+   }
+   for (int e = 0; e < nEntries; ++e) {
+      t->GetEntry(e);
+      for (int b = 0; b < nBranches; ++b) {
+         EXPECT_EQ(ints[b], e * nBranches + b);
+         ASSERT_NE(vecs[b], nullptr);
+         EXPECT_EQ(*vecs[b], std::vector<float>(e % 7, b + 0.5f * e));
+      }
+   }
+   f.Close();
+   for (auto v : vecs)
+      delete v;
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
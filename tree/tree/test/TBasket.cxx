@@ -411,3 +411,80 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<bool *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, true);
 }
+
+TEST(TBasket, RecompressWhenCloning)
+{
+   TMemFile fin("tbasket_recompress_in.root", "RECREATE", "", 101); // zlib
+   {
+      TTree t("t", "t");
+      int i = 0;
+      std::vector<double> v;
+      t.Branch("i", &i, 2000);
+      t.Branch("v", &v, 2000);
+      for (i = 0; i < 20000; ++i) {
+         v.assign(i % 5, 0.5 * i);
+         t.Fill();
+      }
+      fin.Write();
+   }
+   auto tin = fin.Get<TTree>("t");
+   ASSERT_NE(tin, nullptr);
+   ASSERT_GT(tin->GetBranch("i")->GetWriteBasket(), 1);
+
+   TMemFile fout("tbasket_recompress_out.root", "RECREATE", "", 505); // zstd
+   auto tout = tin->CloneTree(-1, "fast recompress");
+   ASSERT_NE(tout, nullptr);
+   fout.Write();
+   EXPECT_EQ(tout->GetEntries(), 20000);
+   EXPECT_EQ(tout->GetBranch("i")->GetCompressionSettings(), 505);
+
+   // The copied baskets are compressed with zstd.
+   TBranch *br = tout->GetBranch("i");
+   TBasket raw;
+   ASSERT_EQ(raw.LoadBasketBuffers(br->GetBasketSeek(0), br->GetBasketBytes()[0], &fout, tout), 0);
+   ASSERT_LT(raw.GetNbytes(), raw.GetKeylen() + raw.GetObjlen());
+   const char *payload = raw.GetBufferRef()->Buffer() + raw.GetKeylen();
+   EXPECT_EQ(payload[0], 'Z');
+   EXPECT_EQ(payload[1], 'S');
+
+   int i = -1;
+   std::vector<double> *v = nullptr;
+   tout->SetBranchAddress("i", &i);
+   tout->SetBranchAddress("v", &v);
+   for (Long64_t e = 0; e < tout->GetEntries(); ++e) {
+      tout->GetEntry(e);
+      EXPECT_EQ(i, e);
+      EXPECT_EQ(*v, std::vector<double>(e % 5, 0.5 * e));
+   }
+   tout->ResetBranchAddresses();
+   delete v;
+}
+
+TEST(TBasket, AutoCompression)
+{
+   TMemFile f("tbasket_autocompression.root", "RECREATE", "", 101);
+   TTree t("t", "t");
+   ROOT::RCompressionAutoSelection selection;
+   selection.fCandidates = {101, 505};
+   t.SetAutoCompression(selection);
+   int i = 0;
+   int zero = 0;
+   t.Branch("i", &i, 4000);
+   t.Branch("zero", &zero, 4000);
+   for (i = 0; i < 20000; ++i)
+      t.Fill();
+   t.FlushBaskets();
+
+   for (auto name : {"i", "zero"}) {
+      const auto settings = t.GetBranch(name)->GetCompressionSettings();
+      EXPECT_TRUE(settings == 101 || settings == 505) << name << ": " << settings;
+   }
+
+   int readI = -1;
+   t.SetBranchAddress("i", &readI);
+   for (Long64_t e = 0; e < t.GetEntries(); ++e) {
+      t.GetEntry(e);
+      EXPECT_EQ(readI, e);
+   }
+   t.ResetBranchAddresses();
+}
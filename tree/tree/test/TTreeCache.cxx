@@ -0,0 +1,208 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+#include "TTreeCacheUnzip.h"
+#include "TROOT.h"
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "gtest/gtest.h"
+
+class TTreeCacheTest : public ::testing::Test {
+protected:
+   static constexpr const char *fFileName = "TTreeCacheTest.root";
+   static constexpr const char *fProfileDir = "TTreeCacheTest_profiles";
+
+   void SetUp() override
+   {
+      TFile file(fFileName, "RECREATE");
+      TTree tree("tree", "A test tree");
+      int x = 0, y = 0, z = 0;
+      tree.Branch("x", &x);
+      tree.Branch("y", &y);
+      tree.Branch("z", &z);
+      for (int i = 0; i < 1000; ++i) {
+         x = i;
+         y = 2 * i;
+         z = 3 * i;
+         tree.Fill();
+      }
+      file.Write();
+      gSystem->mkdir(fProfileDir);
+      TTreeCache::SetProfileDir(fProfileDir);
+   }
+
+   void TearDown() override
+   {
+      TTreeCache::SetProfileDir("");
+      void *dir = gSystem->OpenDirectory(fProfileDir);
+      while (const char *entry = gSystem->GetDirEntry(dir)) {
+         if (strcmp(entry, ".") && strcmp(entry, ".."))
+            gSystem->Unlink(TString::Format("%s/%s", fProfileDir, entry));
+      }
+      gSystem->FreeDirectory(dir);
+      gSystem->Unlink(fProfileDir);
+      gSystem->Unlink(fFileName);
+   }
+
+   // Read the branches x and y of the first `nEntries` entries, return the cache of the tree.
+   static TTreeCache *ReadXY(TFile &file, Long64_t nEntries)
+   {
+      auto tree = file.Get<TTree>("tree");
+      TBranch *bx = tree->GetBranch("x");
+      TBranch *by = tree->GetBranch("y");
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         tree->LoadTree(i);
+         bx->GetEntry(i);
+         by->GetEntry(i);
+      }
+      return dynamic_cast<TTreeCache *>(file.GetCacheRead(tree));
+   }
+};
+
+TEST_F(TTreeCacheTest, ProfileOfLearntBranches)
+{
+   {
+      // the first job learns the branches and saves them at the end of the learning phase
+      TFile file(fFileName);
+      auto cache = ReadXY(file, 2 * TTreeCache::GetLearnEntries());
+      ASSERT_NE(cache, nullptr);
+      EXPECT_FALSE(cache->IsLearning());
+   }
+
+   void *dir = gSystem->OpenDirectory(fProfileDir);
+   std::set<std::string> profiles;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (strcmp(entry, ".") && strcmp(entry, ".."))
+         profiles.insert(entry);
+   }
+   gSystem->FreeDirectory(dir);
+   ASSERT_EQ(profiles.size(), 1u);
+   EXPECT_EQ(profiles.begin()->rfind("tree.", 0), 0u);
+   std::ifstream profile(std::string(fProfileDir) + "/" + *profiles.begin());
+   std::set<std::string> savedBranches;
+   std::string line;
+   while (std::getline(profile, line)) {
+      if (!line.empty() && line[0] != '#')
+         savedBranches.insert(line);
+   }
+   EXPECT_EQ(savedBranches, std::set<std::string>({"x", "y"}));
+
+   {
+      // the next job starts with the saved branches after reading a single entry
+      TFile file(fFileName);
+      auto cache = ReadXY(file, 1);
+      ASSERT_NE(cache, nullptr);
+      EXPECT_FALSE(cache->IsLearning());
+      ASSERT_EQ(cache->GetCachedBranches()->GetEntries(), 2);
+   }
+
+   {
+      // without a profile directory, the cache learns again
+      TTreeCache::SetProfileDir("");
+      TFile file(fFileName);
+      auto cache = ReadXY(file, 1);
+      ASSERT_NE(cache, nullptr);
+      EXPECT_TRUE(cache->IsLearning());
+   }
+}
+
+// Read all the entries of `tree` in `fileName` with asynchronous prefetching, return the number of prefetched blocks.
+static Long64_t ReadWithPrefetching(const char *fileName, Double_t memoryFactor)
+{
+   TFile file(fileName);
+   auto tree = file.Get<TTree>("tree");
+   tree->SetCacheSize(100000);
+   auto cache = dynamic_cast<TTreeCache *>(file.GetCacheRead(tree));
+   EXPECT_NE(cache, nullptr);
+   cache->SetEnablePrefetching(true);
+   cache->SetPrefetchMemoryFactor(memoryFactor);
+   tree->AddBranchToCache("*", true);
+   tree->StopCacheLearningPhase();
+
+   int x = 0;
+   tree->SetBranchAddress("x", &x);
+   Long64_t sum = 0;
+   for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+      tree->GetEntry(i);
+      sum += x;
+   }
+   EXPECT_EQ(sum, tree->GetEntries() * (tree->GetEntries() - 1) / 2);
+   return cache->GetPrefetchedBlocks();
+}
+
+TEST(TTreeCache, PrefetchMemoryFactor)
+{
+   const char *fileName = "TTreeCache_prefetch.root";
+   {
+      TFile file(fileName, "RECREATE", "", 0);
+      TTree tree("tree", "A test tree");
+      tree.SetAutoFlush(1000);
+      int x = 0;
+      tree.Branch("x", &x);
+      for (x = 0; x < 200000; ++x)
+         tree.Fill();
+      file.Write();
+   }
+
+   // larger buffers cover more clusters, so fewer of them are needed
+   const auto nBlocks = ReadWithPrefetching(fileName, 2);
+   const auto nBlocksLarge = ReadWithPrefetching(fileName, 8);
+   EXPECT_GT(nBlocks, 0);
+   EXPECT_LT(nBlocksLarge, nBlocks);
+   gSystem->Unlink(fileName);
+}
+
+#ifdef R__USE_IMT
+TEST(TTreeCacheUnzip, UnzipTasksIMT)
+{
+   const char *fileName = "TTreeCacheUnzip_tasks.root";
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "A test tree");
+      tree.SetAutoFlush(20000);
+      int x = 0;
+      double y = 0;
+      tree.Branch("x", &x);
+      tree.Branch("y", &y);
+      for (x = 0; x < 100000; ++x) {
+         y = 0.5 * x;
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   {
+      TFile file(fileName);
+      auto tree = file.Get<TTree>("tree");
+      int x = 0;
+      double y = 0;
+      tree->SetBranchAddress("x", &x);
+      tree->SetBranchAddress("y", &y);
+      Long64_t sumX = 0;
+      double sumY = 0;
+      for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+         tree->GetEntry(i);
+         sumX += x;
+         sumY += y;
+      }
+      EXPECT_EQ(sumX, 100000LL * 99999 / 2);
+      EXPECT_DOUBLE_EQ(sumY, 0.5 * sumX);
+
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(file.GetCacheRead(tree));
+      ASSERT_NE(cache, nullptr);
+      // the baskets were unzipped through the cache, by the tasks or by the main thread
+      EXPECT_GT(cache->GetNUnzip() + cache->GetNMissed(), 0);
+   }
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kDisable);
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink(fileName);
+}
+#endif
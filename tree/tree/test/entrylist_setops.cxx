@@ -0,0 +1,96 @@
+#include "TEntryList.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+
+const Long64_t kNEntries = 2000000; // 32 blocks
+
+// Entries: sparse in the first blocks (list), medium density (bits), then almost all (list of non-passing).
+bool InFirst(Long64_t i)
+{
+   return i < 500000 ? i % 101 == 0 : (i < 1500000 ? i % 3 == 0 : i % 97 != 0);
+}
+
+bool InSecond(Long64_t i)
+{
+   return i % 2 == 0 || (i > 1200000 && i < 1800000);
+}
+
+void FillList(TEntryList &elist, bool (*pred)(Long64_t), Long64_t n)
+{
+   for (Long64_t i = 0; i < n; ++i)
+      if (pred(i))
+         elist.Enter(i);
+   elist.OptimizeStorage();
+}
+
+std::vector<Long64_t> GetEntries(TEntryList &elist)
+{
+   std::vector<Long64_t> entries;
+   for (Long64_t i = 0; i < elist.GetN(); ++i)
+      entries.push_back(elist.GetEntry(i));
+   return entries;
+}
+
+template <typename Op>
+std::vector<Long64_t> Reference(Op op)
+{
+   std::vector<Long64_t> entries;
+   for (Long64_t i = 0; i < kNEntries; ++i)
+      if (op(InFirst(i), i < kNEntries / 2 && InSecond(i)))
+         entries.push_back(i);
+   return entries;
+}
+
+void CheckSetOperations()
+{
+   TEntryList second("second", "second", "t", "f.root");
+   FillList(second, InSecond, kNEntries / 2); // fewer blocks than the first list
+
+   TEntryList added("added", "added", "t", "f.root");
+   FillList(added, InFirst, kNEntries);
+   added.Add(&second);
+   const auto addedRef = Reference([](bool a, bool b) { return a || b; });
+   EXPECT_EQ(added.GetN(), (Long64_t)addedRef.size());
+   EXPECT_EQ(GetEntries(added), addedRef);
+
+   TEntryList intersected("intersected", "intersected", "t", "f.root");
+   FillList(intersected, InFirst, kNEntries);
+   intersected.Intersect(&second);
+   const auto intersectedRef = Reference([](bool a, bool b) { return a && b; });
+   EXPECT_EQ(intersected.GetN(), (Long64_t)intersectedRef.size());
+   EXPECT_EQ(GetEntries(intersected), intersectedRef);
+
+   TEntryList subtracted("subtracted", "subtracted", "t", "f.root");
+   FillList(subtracted, InFirst, kNEntries);
+   subtracted.Subtract(&second);
+   const auto subtractedRef = Reference([](bool a, bool b) { return a && !b; });
+   EXPECT_EQ(subtracted.GetN(), (Long64_t)subtractedRef.size());
+   EXPECT_EQ(GetEntries(subtracted), subtractedRef);
+
+   // Lists of different trees have no entries in common.
+   TEntryList other("other", "other", "t2", "f.root");
+   FillList(other, InSecond, kNEntries);
+   intersected.Intersect(&other);
+   EXPECT_EQ(intersected.GetN(), 0);
+}
+
+} // namespace
+
+TEST(TEntryList, SetOperations)
+{
+   CheckSetOperations();
+}
+
+#ifdef R__USE_IMT
+TEST(TEntryList, SetOperationsMT)
+{
+   ROOT::EnableImplicitMT(4);
+   CheckSetOperations();
+   ROOT::DisableImplicitMT();
+}
+#endif
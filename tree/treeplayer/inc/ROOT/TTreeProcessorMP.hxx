@@ -28,6 +28,8 @@
 #include "TSelector.h"
 #include "TTreeReader.h"
 #include <algorithm> //std::generate
+#include <deque>
+#include <map>
 #include <numeric> //std::iota
 #include <string>
 #include <functional> //std::reference_wrapper
@@ -172,9 +174,13 @@ private:
    void FixLists(std::vector<TObject*> &lists);
    void Reset();
    void ReplyToIdle(TSocket *s);
+   unsigned BroadcastRanges(unsigned nFiles);
+   unsigned NextRange(TSocket *s);
 
    unsigned fNProcessed; ///< number of arguments already passed to the workers
    unsigned fNToProcess; ///< total number of arguments to pass to the workers
+   std::vector<std::deque<unsigned>> fFreeRanges; ///< for each file, the entry ranges not yet handed out
+   std::map<TSocket *, unsigned> fWorkerFile; ///< the file each worker has been processing last
 
    /// A collection of the types of tasks that TTreeProcessorMP can execute.
    /// It is used to interpret in the right way and properly reply to the
@@ -224,9 +230,7 @@ auto TTreeProcessorMP::Process(const std::vector<std::string>& fileNames, F proc
       fTaskType = ETask::kProcByRange;
       //Tell workers to start processing entries
       fNToProcess = nWorkers*fileNames.size(); //this is the total number of ranges that will be processed by all workers cumulatively
-      std::vector<unsigned> args(nWorkers);
-      std::iota(args.begin(), args.end(), 0);
-      fNProcessed = Broadcast(MPCode::kProcRange, args);
+      fNProcessed = BroadcastRanges(fileNames.size());
       if(fNProcessed < nWorkers)
          Error("TTreeProcessorMP::Process", "[E][C] There was an error while sending tasks to workers. Some entries might not be processed.");
    } else {
@@ -92,6 +92,9 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static bool fgDynamicScheduling;
+   static bool fgSplitClusters;
+   static bool fgCoalesceFiles;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
@@ -118,6 +121,12 @@ public:
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+   static void SetDynamicScheduling(bool dynamicScheduling);
+   static bool GetDynamicScheduling();
+   static void SetSplitClusters(bool splitClusters);
+   static bool GetSplitClusters();
+   static void SetCoalesceFiles(bool coalesceFiles);
+   static bool GetCoalesceFiles();
 };
 
 } // End of namespace ROOT
@@ -57,6 +57,8 @@ protected:
 protected:
    const   char  *GetNameByIndex(TString &varexp, Int_t *index,Int_t colindex);
    void           DeleteSelectorFromFile();
+   Long64_t       DrawSelectMT(const char *varexp, const char *selection, Option_t *option,
+                               Long64_t nentries, Long64_t firstentry);
 
 public:
    TTreePlayer();
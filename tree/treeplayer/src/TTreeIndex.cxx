@@ -18,12 +18,151 @@ A Tree Index with majorname and minorname.
 #include "TTreeFormula.h"
 #include "TTree.h"
 #include "TBuffer.h"
+#include "TChain.h"
+#include "TFile.h"
 #include "TMath.h"
+#include "TROOT.h"
+#include "TVirtualMutex.h"
+#include "ROOT/InternalTreeUtils.hxx"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring> // std::strlen
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ClassImp(TTreeIndex);
 
+namespace {
+
+/// Evaluate the major or minor formula of an index for the current entry, warning if the value is possibly out of
+/// the range of the internal `long double`.
+LongDouble_t EvalAndRangeCheck(TTreeFormula &formula, bool isMajor, const char *name, Long64_t entry)
+{
+   LongDouble_t ret = formula.EvalInstance<LongDouble_t>();
+   // Check whether the value (vs significant bits) of ldRet can represent
+   // the full precision of the returned value. If we return 10^60, the
+   // value fits into a long double, but if sizeof(long double) ==
+   // sizeof(double) it cannot store the ones: the value returned by
+   // EvalInstance() only stores the higher bits.
+   LongDouble_t retCloserToZero = ret;
+   if (ret > 0)
+      retCloserToZero -= 1;
+   else
+      retCloserToZero += 1;
+   if (retCloserToZero == ret) {
+      Warning("TTreeIndex", "In tree entry %lld, %s value %s=%Lf possibly out of range for internal `long double`",
+              entry, isMajor ? "major" : "minor", name, ret);
+   }
+   return ret;
+}
+
+#ifdef R__USE_IMT
+/// Minimum number of entries for which the index values are evaluated in parallel.
+constexpr Long64_t kMinEntriesMT = 100000;
+
+/// Evaluate the index values of all the `n` entries of `tree` in parallel, when implicit multi-threading is enabled.
+/// Each task reads a range of entries from its own copy of the tree, opened from the (read-only) input file(s).
+/// Returns false, without evaluating anything, if the tree is not suitable: the caller must then evaluate the
+/// values sequentially.
+bool EvalIndexValuesMT(TTree &tree, const TString &majorName, const TString &minorName, Long64_t n,
+                       Long64_t *major, Long64_t *minor)
+{
+   if (!ROOT::IsImplicitMTEnabled() || n < kMinEntriesMT)
+      return false;
+   // The expressions may use friends or aliases, which the tasks' copies of the tree would not know about.
+   if ((tree.GetListOfFriends() && tree.GetListOfFriends()->GetEntries() > 0) ||
+       (tree.GetListOfAliases() && tree.GetListOfAliases()->GetEntries() > 0))
+      return false;
+
+   auto chain = dynamic_cast<TChain *>(&tree);
+   if (!chain) {
+      // The content on disk of a tree being written may be incomplete.
+      TFile *file = tree.GetCurrentFile();
+      if (!file || file->IsWritable() || tree.GetEntries() != n)
+         return false;
+   }
+
+   std::vector<std::string> fileNames;
+   std::vector<std::string> treeNames;
+   try {
+      fileNames = ROOT::Internal::TreeUtils::GetFileNamesFromTree(tree);
+      treeNames = ROOT::Internal::TreeUtils::GetTreeFullPaths(tree);
+   } catch (const std::exception &) {
+      return false;
+   }
+   if (fileNames.size() != treeNames.size())
+      return false;
+
+   // One piece of work per range of entries, at least 4 per thread.
+   struct RRange {
+      std::size_t fFileIdx;
+      Long64_t fOffset; ///< Global entry number of the first entry of the file
+      Long64_t fBegin;  ///< First entry of the range, local to the file
+      Long64_t fEnd;
+   };
+   ROOT::TThreadExecutor pool;
+   const Long64_t rangeSize = std::max<Long64_t>(n / (4 * pool.GetPoolSize()), kMinEntriesMT / 4);
+   std::vector<RRange> ranges;
+   for (std::size_t i = 0; i < fileNames.size(); ++i) {
+      const Long64_t offset = chain ? chain->GetTreeOffset()[i] : 0;
+      const Long64_t end = chain ? (i + 1 < fileNames.size() ? chain->GetTreeOffset()[i + 1] : n) : n;
+      if (offset < 0 || end > n || end < offset)
+         return false;
+      for (Long64_t begin = 0; begin < end - offset; begin += rangeSize)
+         ranges.push_back({i, offset, begin, std::min(begin + rangeSize, end - offset)});
+   }
+
+   std::atomic<bool> failed{false};
+   auto evalRange = [&](std::size_t r) {
+      if (failed)
+         return;
+      const auto &range = ranges[r];
+      std::unique_ptr<TFile> file(TFile::Open(fileNames[range.fFileIdx].c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+      TTree *t = file && !file->IsZombie() ? file->Get<TTree>(treeNames[range.fFileIdx].c_str()) : nullptr;
+      if (!t || t->GetEntries() < range.fEnd) {
+         failed = true;
+         return;
+      }
+      t->SetCacheEntryRange(range.fBegin, range.fEnd);
+      std::unique_ptr<TTreeFormula> majorFormula, minorFormula;
+      {
+         // Compiling the expressions may need the interpreter.
+         R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+         majorFormula.reset(new TTreeFormula("Major", majorName.Data(), t));
+         minorFormula.reset(new TTreeFormula("Minor", minorName.Data(), t));
+      }
+      majorFormula->SetQuickLoad(true);
+      minorFormula->SetQuickLoad(true);
+      if (majorFormula->GetNdim() == 1 && minorFormula->GetNdim() == 1) {
+         for (Long64_t entry = range.fBegin; entry < range.fEnd; ++entry) {
+            if (t->LoadTree(entry) < 0) {
+               failed = true;
+               break;
+            }
+            const Long64_t globalEntry = range.fOffset + entry;
+            major[globalEntry] = EvalAndRangeCheck(*majorFormula, true, majorName.Data(), globalEntry);
+            minor[globalEntry] = EvalAndRangeCheck(*minorFormula, false, minorName.Data(), globalEntry);
+         }
+      } else {
+         failed = true;
+      }
+      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+      majorFormula.reset();
+      minorFormula.reset();
+   };
+   pool.Foreach(evalRange, ROOT::TSeqUL(ranges.size()));
+   return !failed;
+}
+#endif
+
+} // anonymous namespace
+
 
 struct IndexSortComparator {
 
@@ -120,6 +259,12 @@ TTreeIndex::TTreeIndex(): TVirtualIndex()
 ///
 /// Note that this function can also be applied to a TChain.
 ///
+/// When implicit multi-threading is enabled, the values of the expressions
+/// for trees of at least 100000 entries are computed in parallel over ranges
+/// of entries, each task reading its own copy of the tree from the input
+/// file(s). This requires a TChain or a TTree from a file opened in read mode,
+/// without friends or aliases; otherwise the entries are read sequentially.
+///
 /// The return value is the number of entries in the Index (< 0 indicates failure)
 ///
 /// It is possible to play with different TreeIndex in the same Tree.
@@ -170,8 +315,13 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    Long64_t *tmp_minor = new Long64_t[fN];
    Long64_t i;
    Long64_t oldEntry = fTree->GetReadEntry();
+#ifdef R__USE_IMT
+   const bool evaluated = EvalIndexValuesMT(*fTree, fMajorName, fMinorName, fN, tmp_major, tmp_minor);
+#else
+   const bool evaluated = false;
+#endif
    Int_t current = -1;
-   for (i=0;i<fN;i++) {
+   for (i = 0; i < fN && !evaluated; i++) {
       Long64_t centry = fTree->LoadTree(i);
       if (centry < 0) break;
       if (fTree->GetTreeNumber() != current) {
@@ -179,27 +329,8 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
          fMajorFormula->UpdateFormulaLeaves();
          fMinorFormula->UpdateFormulaLeaves();
       }
-      auto GetAndRangeCheck = [this](bool isMajor, Long64_t entry) {
-         LongDouble_t ret = (isMajor ? fMajorFormula : fMinorFormula)->EvalInstance<LongDouble_t>();
-         // Check whether the value (vs significant bits) of ldRet can represent
-         // the full precision of the returned value. If we return 10^60, the
-         // value fits into a long double, but if sizeof(long double) ==
-         // sizeof(double) it cannot store the ones: the value returned by
-         // EvalInstance() only stores the higher bits.
-         LongDouble_t retCloserToZero = ret;
-         if (ret > 0)
-            retCloserToZero -= 1;
-         else
-            retCloserToZero += 1;
-         if (retCloserToZero == ret) {
-            Warning("TTreeIndex",
-                    "In tree entry %lld, %s value %s=%Lf possibly out of range for internal `long double`", entry,
-                    isMajor ? "major" : "minor", isMajor ? fMajorName.Data() : fMinorName.Data(), ret);
-         }
-         return ret;
-      };
-      tmp_major[i] = GetAndRangeCheck(true, i);
-      tmp_minor[i] = GetAndRangeCheck(false, i);
+      tmp_major[i] = EvalAndRangeCheck(*fMajorFormula, true, fMajorName.Data(), i);
+      tmp_minor[i] = EvalAndRangeCheck(*fMinorFormula, false, fMinorName.Data(), i);
    }
    fIndex = new Long64_t[fN];
    for(i = 0; i < fN; i++) { fIndex[i] = i; }
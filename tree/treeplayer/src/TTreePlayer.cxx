@@ -30,6 +30,12 @@ extra libraries (Histogram, display, etc).
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "TROOT.h"
 #include "TApplication.h"
@@ -86,6 +92,9 @@ extra libraries (Histogram, display, etc).
 #include "TTreeCache.h"
 #include "TVirtualMutex.h"
 #include "ThreadLocalStorage.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TError.h"
 #include "strlcpy.h"
 #include "snprintf.h"
 
@@ -94,6 +103,11 @@ extra libraries (Histogram, display, etc).
 #include "Fit/UnBinData.h"
 #include "Math/MinimizerOptions.h"
 
+#ifdef R__USE_IMT
+#include "TTreeReader.h"
+#include "ROOT/TTreeProcessorMT.hxx"
+#endif
+
 
 R__EXTERN Foption_t Foption;
 
@@ -338,6 +352,241 @@ Long64_t TTreePlayer::DrawScript(const char* wrapperPrefix,
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Multi-threaded version of DrawSelect for the filling of an existing histogram with scalar expressions,
+/// as in `tree->Draw("y:x>>h", "z > 0")` or `tree->Draw("x>>+h")`.
+///
+/// It is used when the implicit multi-threading is enabled (ROOT::EnableImplicitMT) and not disabled for
+/// the tree (TTree::SetImplicitMT), the tree is a TChain or is read from a file, it has no friends, no
+/// aliases and no entry or event list, and `h` is a histogram of the dimension of the expression with fixed
+/// binning (no profile, no TH2Poly, no axis that can be extended). The expressions, which must compile and
+/// must not refer to arrays, strings or special variables such as `Entry$`, are evaluated in parallel by the
+/// tasks of a ROOT::TTreeProcessorMT, each with its own TTreeFormula objects, and each thread fills its own
+/// copy of the histogram; the copies are added to `h` at the end. Unlike the sequential version, it does not
+/// fill the arrays returned by TTree::GetV1() etc.
+///
+/// Returns the number of selected entries, or -1 if the request is not one of the above.
+
+Long64_t TTreePlayer::DrawSelectMT(const char *varexp0, const char *selection, Option_t *option, Long64_t nentries,
+                                   Long64_t firstentry)
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || !fTree->GetImplicitMT())
+      return -1;
+   // The trees of the tasks are read from the files: they know of neither the lists, the friends and the aliases
+   // of fTree, nor of the weight of a TChain
+   if (fTree->GetEventList() || fTree->GetEntryList() ||
+       (fTree->GetListOfFriends() && fTree->GetListOfFriends()->GetSize()) ||
+       (fTree->GetListOfAliases() && fTree->GetListOfAliases()->GetSize()))
+      return -1;
+   const bool isChain = fTree->InheritsFrom(TChain::Class());
+   if (isChain ? fTree->TestBit(TChain::kGlobalWeight)
+               : (!fTree->GetCurrentFile() || fTree->GetCurrentFile()->IsWritable()))
+      return -1;
+
+   TString opt = option;
+   opt.ToLower();
+   const bool optnorm = opt.Contains("norm");
+   if (optnorm) {
+      opt.ReplaceAll("norm", "");
+      opt.ReplaceAll(" ", "");
+   }
+   if (opt.Contains("para") || opt.Contains("candle") || opt.Contains("gl5d") || opt.Contains("entrylist"))
+      return -1;
+
+   // varexp0 is "expression>>hname" or "expression>>+hname"
+   TString varexp = varexp0;
+   Ssiz_t arrow = kNPOS;
+   for (Ssiz_t i = varexp.Length() - 1; i > 0; --i) {
+      if (varexp[i] == '>' && varexp[i - 1] == '>') {
+         arrow = i - 1;
+         break;
+      }
+   }
+   if (arrow == kNPOS || arrow == 0)
+      return -1;
+   TString hname = varexp(arrow + 2, varexp.Length() - arrow - 2);
+   varexp.Remove(arrow);
+   hname = hname.Strip(TString::kBoth);
+   const bool optadd = hname.BeginsWith("+");
+   if (optadd)
+      hname = TString(hname(1, hname.Length() - 1)).Strip(TString::kBoth);
+   const TString cut = selection ? selection : "";
+   if (hname.IsNull() || hname.Contains("(") || varexp.Contains("$") || cut.Contains("$"))
+      return -1;
+
+   TH1 *hist = dynamic_cast<TH1 *>(gDirectory ? gDirectory->Get(hname) : nullptr);
+   if (!hist || hist->InheritsFrom(TProfile::Class()) || hist->InheritsFrom(TProfile2D::Class()) ||
+       hist->InheritsFrom("TProfile3D") || hist->InheritsFrom("TH2Poly") || hist->GetBuffer() ||
+       hist->GetXaxis()->CanExtend() || hist->GetYaxis()->CanExtend() || hist->GetZaxis()->CanExtend())
+      return -1;
+   std::vector<TString> names;
+   fSelector->SplitNames(varexp, names);
+   const Int_t ndim = names.size();
+   if (ndim < 1 || ndim != hist->GetDimension())
+      return -1;
+
+   // The expressions are first compiled on fTree, silently: the sequential version reports the errors
+   bool isInteger[3] = {false, false, false};
+   auto isSupported = [&]() {
+      std::vector<std::unique_ptr<TTreeFormula>> formulas;
+      auto manager = new TTreeFormulaManager; // deleted with the last of its formulas
+      for (Int_t i = 0; i <= ndim; ++i) {
+         if (i == ndim && cut.IsNull())
+            break;
+         formulas.emplace_back(i < ndim ? new TTreeFormula(TString::Format("Var%d", i + 1), names[i], fTree)
+                                        : new TTreeFormula("Selection", cut, fTree));
+         manager->Add(formulas.back().get());
+         if (!formulas.back()->GetNdim() || formulas.back()->IsString() || formulas.back()->EvalClass())
+            return false;
+         if (i < ndim)
+            isInteger[i] = formulas.back()->IsInteger();
+      }
+      manager->Sync();
+      return manager->GetMultiplicity() == 0;
+   };
+   const Int_t errorIgnoreLevel = gErrorIgnoreLevel;
+   gErrorIgnoreLevel = kFatal;
+   const bool supported = isSupported();
+   gErrorIgnoreLevel = errorIgnoreLevel;
+   if (!supported)
+      return -1;
+
+   // One copy of the histogram per thread, taken from and given back to freeCopies by the tasks
+   std::vector<std::unique_ptr<TH1>> copies;
+   std::vector<TH1 *> freeCopies;
+   {
+      TDirectory::TContext ctxt(nullptr);
+      for (UInt_t i = 0, n = std::max(ROOT::GetThreadPoolSize(), 1u); i < n; ++i) {
+         copies.emplace_back(static_cast<TH1 *>(hist->Clone()));
+         copies.back()->SetDirectory(nullptr);
+         copies.back()->Reset();
+         freeCopies.push_back(copies.back().get());
+      }
+   }
+   std::mutex freeCopiesMutex;
+   std::atomic<Long64_t> nSelected{0};
+
+   const Double_t treeWeight = fTree->GetWeight();
+   if (nentries > fTree->GetMaxEntryLoop())
+      nentries = fTree->GetMaxEntryLoop();
+   const Long64_t lastentry = nentries >= std::numeric_limits<Long64_t>::max() - firstentry
+                                 ? std::numeric_limits<Long64_t>::max()
+                                 : firstentry + nentries;
+
+   auto processTask = [&](TTreeReader &reader) {
+      if (!reader.Next())
+         return;
+      TTree *tree = reader.GetTree();
+      std::vector<std::unique_ptr<TTreeFormula>> vars;
+      std::unique_ptr<TTreeFormula> select;
+      TTreeFormulaManager *manager = nullptr;
+      {
+         R__LOCKGUARD(gROOTMutex);
+         manager = new TTreeFormulaManager;
+         for (Int_t i = 0; i < ndim; ++i) {
+            vars.emplace_back(new TTreeFormula(TString::Format("Var%d", i + 1), names[i], tree));
+            vars.back()->SetQuickLoad(true);
+            manager->Add(vars.back().get());
+         }
+         if (!cut.IsNull()) {
+            select.reset(new TTreeFormula("Selection", cut, tree));
+            select->SetQuickLoad(true);
+            manager->Add(select.get());
+         }
+         manager->Sync();
+      }
+
+      TH1 *h = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(freeCopiesMutex);
+         h = freeCopies.back();
+         freeCopies.pop_back();
+      }
+      Int_t treeNumber = -1;
+      Double_t weight = treeWeight;
+      Double_t x[3];
+      Long64_t n = 0;
+      do {
+         if (tree->GetTreeNumber() != treeNumber) {
+            treeNumber = tree->GetTreeNumber();
+            if (isChain)
+               weight = tree->GetWeight();
+            for (auto &var : vars)
+               var->UpdateFormulaLeaves();
+            if (select)
+               select->UpdateFormulaLeaves();
+         }
+         if (manager->GetNdata() <= 0)
+            continue;
+         Double_t w = weight;
+         if (select) {
+            w *= select->EvalInstance(0);
+            if (w == 0)
+               continue;
+         }
+         for (Int_t i = 0; i < ndim; ++i)
+            x[i] = vars[i]->EvalInstance(0);
+         // The expressions are given as "z:y:x", as in the sequential version
+         if (ndim == 1)
+            h->Fill(x[0], w);
+         else if (ndim == 2)
+            static_cast<TH2 *>(h)->Fill(x[1], x[0], w);
+         else
+            static_cast<TH3 *>(h)->Fill(x[2], x[1], x[0], w);
+         ++n;
+      } while (reader.Next());
+      nSelected += n;
+
+      {
+         std::lock_guard<std::mutex> lock(freeCopiesMutex);
+         freeCopies.push_back(h);
+      }
+      R__LOCKGUARD(gROOTMutex);
+      vars.clear();
+      select.reset();
+   };
+
+   try {
+      ROOT::TTreeProcessorMT processor(*fTree, 0u, {firstentry, lastentry});
+      processor.Process(processTask);
+   } catch (const std::exception &e) {
+      Warning("DrawSelect", "cannot process the tree in parallel (%s), processing it sequentially", e.what());
+      return -1;
+   }
+
+   if (!optadd)
+      hist->Reset();
+   for (auto &copy : copies)
+      hist->Add(copy.get());
+   if (optnorm) {
+      const Double_t sumh = hist->GetSumOfWeights();
+      if (sumh != 0)
+         hist->Scale(1. / sumh);
+   }
+   // The axes follow the "z:y:x" order of the expressions
+   static const char *axes[3][3] = {{"X"}, {"Y", "X"}, {"Z", "Y", "X"}};
+   for (Int_t i = 0; i < ndim; ++i) {
+      if (isInteger[i])
+         hist->LabelsDeflate(axes[ndim - 1][i]);
+   }
+
+   fHistogram = hist;
+   fDimension = ndim;
+   fSelectedRows = nSelected;
+   if (!opt.Contains("goff"))
+      fHistogram->Draw(opt.Data());
+   return fSelectedRows;
+#else
+   (void)varexp0;
+   (void)selection;
+   (void)option;
+   (void)nentries;
+   (void)firstentry;
+   return -1;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Draw expression varexp for specified entries that matches the selection.
 /// Returns -1 in case of error or number of selected events in case of success.
@@ -391,6 +640,10 @@ Long64_t TTreePlayer::DrawSelect(const char *varexp0, const char *selection, Opt
       }
    }
 
+   const Long64_t nrowsMT = DrawSelectMT(varexp0, selection, option, nentries, firstentry);
+   if (nrowsMT >= 0)
+      return nrowsMT;
+
    Long64_t oldEstimate  = fTree->GetEstimate();
    TEventList *evlist  = fTree->GetEventList();
    TEntryList *elist = fTree->GetEntryList();
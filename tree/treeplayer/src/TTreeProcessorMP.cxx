@@ -190,9 +190,7 @@ TList *TTreeProcessorMP::Process(const std::vector<std::string> &fileNames, TSel
          fTaskType = ETask::kProcByRange;
          // Tell workers to start processing entries
          fNToProcess = nWorkers*fileNames.size(); //this is the total number of ranges that will be processed by all workers cumulatively
-         std::vector<UInt_t> args(nWorkers);
-         std::iota(args.begin(), args.end(), 0);
-         fNProcessed = Broadcast(MPCode::kProcRange, args);
+         fNProcessed = BroadcastRanges(fileNames.size());
          if (fNProcessed < nWorkers)
             Error("TTreeProcessorMP::Process", "[E][C] There was an error while sending tasks to workers."
                                          " Some entries might not be processed");
@@ -212,9 +210,7 @@ TList *TTreeProcessorMP::Process(const std::vector<std::string> &fileNames, TSel
       fTaskType = ETask::kProcByRange;
       // Tell workers to start processing entries
       fNToProcess = nWorkers*fileNames.size(); //this is the total number of ranges that will be processed by all workers cumulatively
-      std::vector<UInt_t> args(nWorkers);
-      std::iota(args.begin(), args.end(), 0);
-      fNProcessed = Broadcast(MPCode::kProcRange, args);
+      fNProcessed = BroadcastRanges(fileNames.size());
       if (fNProcessed < nWorkers)
          Error("TTreeProcessorMP::Process", "[E][C] There was an error while sending tasks to workers."
                                       " Some entries might not be processed.");
@@ -341,9 +337,89 @@ void TTreeProcessorMP::Reset()
 {
    fNProcessed = 0;
    fNToProcess = 0;
+   fFreeRanges.clear();
+   fWorkerFile.clear();
    fTaskType = ETask::kNoTask;
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// Give the first range of entries to each worker, when processing nFiles
+/// files split in GetNWorkers() ranges each.
+/// The workers are spread over the files, so that they start on different
+/// files whenever there are enough of them. Return the number of ranges
+/// handed out.
+unsigned TTreeProcessorMP::BroadcastRanges(unsigned nFiles)
+{
+   const unsigned nWorkers = GetNWorkers();
+   fFreeRanges.assign(nFiles, std::deque<unsigned>(nWorkers));
+   for (auto &ranges : fFreeRanges)
+      std::iota(ranges.begin(), ranges.end(), 0);
+
+   TMonitor &mon = GetMonitor();
+   mon.ActivateAll();
+   std::unique_ptr<TList> lp(mon.GetListOfActives());
+   unsigned count = 0;
+   for (auto s : *lp) {
+      if (count == fNToProcess)
+         break;
+      if (MPSend((TSocket *)s, MPCode::kProcRange, NextRange((TSocket *)s))) {
+         mon.DeActivate((TSocket *)s);
+         ++count;
+      } else {
+         Error("TTreeProcessorMP::BroadcastRanges", "[E] Could not send message to server\n");
+      }
+   }
+   return count;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Choose the next range of entries for the worker on socket s, encoded as
+/// expected by TMPWorkerTree for MPCode::kProcRange (file * nWorkers + range).
+/// A worker stays on the file it already has open while it has ranges left.
+/// Otherwise it moves to a file nobody is processing, and at the tail it
+/// takes the last free range of the file with most work left, so that the
+/// worker already there can go on with the following entries.
+unsigned TTreeProcessorMP::NextRange(TSocket *s)
+{
+   const unsigned nFiles = fFreeRanges.size();
+   unsigned file = nFiles;
+
+   auto current = fWorkerFile.find(s);
+   if (current != fWorkerFile.end() && !fFreeRanges[current->second].empty())
+      file = current->second;
+
+   if (file == nFiles) {
+      std::vector<unsigned> nWorkersOnFile(nFiles, 0);
+      for (const auto &wf : fWorkerFile)
+         ++nWorkersOnFile[wf.second];
+      for (unsigned f = 0; f < nFiles; ++f) {
+         if (fFreeRanges[f].empty())
+            continue;
+         if (file == nFiles || nWorkersOnFile[f] < nWorkersOnFile[file] ||
+             (nWorkersOnFile[f] == nWorkersOnFile[file] && fFreeRanges[f].size() > fFreeRanges[file].size()))
+            file = f;
+      }
+   }
+   if (file == nFiles)
+      return 0; // cannot happen while fNProcessed < fNToProcess
+
+   unsigned range;
+   if (current != fWorkerFile.end() && current->second == file) {
+      range = fFreeRanges[file].front();
+      fFreeRanges[file].pop_front();
+   } else {
+      // start on a fresh file from the beginning, steal from the end otherwise
+      const bool fresh = fFreeRanges[file].size() == GetNWorkers();
+      range = fresh ? fFreeRanges[file].front() : fFreeRanges[file].back();
+      if (fresh)
+         fFreeRanges[file].pop_front();
+      else
+         fFreeRanges[file].pop_back();
+   }
+   fWorkerFile[s] = file;
+   return file * GetNWorkers() + range;
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// Reply to a worker who is idle.
 /// If still events to process, tell the worker. Otherwise
@@ -353,7 +429,7 @@ void TTreeProcessorMP::ReplyToIdle(TSocket *s)
    if (fNProcessed < fNToProcess) {
       //we are executing a "greedy worker" task
       if (fTaskType == ETask::kProcByRange)
-         MPSend(s, MPCode::kProcRange, fNProcessed);
+         MPSend(s, MPCode::kProcRange, fFreeRanges.empty() ? fNProcessed : NextRange(s));
       else if (fTaskType == ETask::kProcByFile)
          MPSend(s, MPCode::kProcFile, fNProcessed);
       ++fNProcessed;
@@ -24,9 +24,12 @@ of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTr
 objects.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 
 #include "TROOT.h"
+#include "ROOT/TSeq.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 
 using namespace ROOT;
@@ -121,13 +124,34 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
    return elistClusters;
 }
 
+/// Split the given clusters in sub-ranges of similar size, so that there are at least `minRanges` ranges.
+/// Each of the tasks that process the sub-ranges of a cluster decompresses the baskets that overlap its range.
+std::vector<EntryRange> SplitClusters(std::vector<EntryRange> &&clusters, unsigned int minRanges)
+{
+   if (clusters.empty() || clusters.size() >= minRanges)
+      return std::move(clusters);
+
+   const Long64_t nSplits = (minRanges + clusters.size() - 1) / clusters.size();
+   std::vector<EntryRange> ranges;
+   ranges.reserve(nSplits * clusters.size());
+   for (const auto &c : clusters) {
+      const auto nEntries = c.second - c.first;
+      const auto n = std::min(nSplits, nEntries);
+      for (Long64_t i = 0; i < n; ++i)
+         ranges.emplace_back(c.first + nEntries * i / n, c.first + nEntries * (i + 1) / n);
+   }
+   return ranges;
+}
+
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
+/// Files with fewer than `minRangesPerFile` clusters have their clusters split in sub-ranges.
 ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
                                        const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
+                                       const unsigned int minRangesPerFile,
                                        const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
 {
    // Note that as a side-effect of opening all files that are going to be used in the
@@ -217,9 +241,9 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
       const auto clustersInThisFileSize = clustersPerFileIt->size();
       const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
       // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
+      // we take the clusters as they are, or split them if requested
       if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
+         *eventRangesPerFileIt = SplitClusters(std::move(*clustersPerFileIt), minRangesPerFile);
          continue;
       }
       // Otherwise, we have to merge clusters, distributing the reminder evenly
@@ -249,6 +273,9 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+bool TTreeProcessorMT::fgDynamicScheduling = false;
+bool TTreeProcessorMT::fgSplitClusters = false;
+bool TTreeProcessorMT::fgCoalesceFiles = false;
 
 namespace Internal {
 
@@ -462,6 +489,17 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // compute number of tasks per file
    const unsigned int maxTasksPerFile =
       std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
+   // With dynamic scheduling clusters are not fused upfront: tasks claim them at runtime instead (see below)
+   const bool dynamicScheduling = GetDynamicScheduling();
+   const unsigned int maxRangesPerFile = dynamicScheduling ? std::numeric_limits<unsigned int>::max() : maxTasksPerFile;
+   // With cluster splitting, files with fewer clusters than tasks get sub-cluster ranges
+   const unsigned int minRangesPerFile = GetSplitClusters() ? maxTasksPerFile : 0u;
+   // With file coalescing, datasets with more files than the desired number of tasks are processed in groups of
+   // consecutive files, each group being processed by as few tasks as if it was a single file
+   const std::size_t nFiles = fFileNames.size();
+   const std::size_t maxGroups = std::max(1u, GetTasksPerWorkerHint() * fPool.GetPoolSize());
+   const std::size_t filesPerGroup =
+      GetCoalesceFiles() && nFiles > maxGroups ? (nFiles + maxGroups - 1) / maxGroups : 1u;
 
    // If an entry list or friend trees are present, we need to generate clusters with global entry numbers,
    // so we do it here for all files.
@@ -476,11 +514,40 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
+      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxRangesPerFile, minRangesPerFile, fGlobalRange);
       if (hasEntryList)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
 
+   // Process the clusters of one file. Without dynamic scheduling, each (possibly fused) cluster is one task.
+   // With dynamic scheduling, up to maxTasksPerFile tasks repeatedly claim chunks of contiguous clusters from a
+   // shared cursor (guided self-scheduling): a chunk is 1/(2*nTasks) of the clusters still unclaimed, so early
+   // chunks are large and the tail of the file is handed out cluster by cluster to whichever slot is idle.
+   // This keeps all slots busy when the cost per entry is very uneven across the file.
+   auto processClusters = [&](const std::vector<EntryRange> &clusters, auto &&processCluster) {
+      if (!dynamicScheduling || clusters.size() <= 1) {
+         fPool.Foreach(processCluster, clusters);
+         return;
+      }
+      const std::size_t nClusters = clusters.size();
+      const std::size_t nTasks = std::min<std::size_t>(maxTasksPerFile, nClusters);
+      std::atomic<std::size_t> nextCluster{0};
+      auto claimAndProcess = [&](unsigned int) {
+         auto begin = nextCluster.load();
+         while (true) {
+            if (begin >= nClusters)
+               return;
+            const auto chunkSize = std::max<std::size_t>(1u, (nClusters - begin) / (2u * nTasks));
+            const auto end = std::min(begin + chunkSize, nClusters);
+            if (!nextCluster.compare_exchange_weak(begin, end))
+               continue; // another task claimed clusters in the meantime, `begin` now holds the updated cursor
+            processCluster(EntryRange{clusters[begin].first, clusters[end - 1].second});
+            begin = nextCluster.load();
+         }
+      };
+      fPool.Foreach(claimAndProcess, ROOT::TSeqU(nTasks));
+   };
+
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
       auto processCluster = [&](const EntryRange &c) {
@@ -488,23 +555,31 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
                                            allEntries, fSuppressErrorsForMissingBranches);
          func(*r);
       };
-      fPool.Foreach(processCluster, allClusters[fileIdx]);
+      processClusters(allClusters[fileIdx], processCluster);
    };
 
-   // Per-file processing that also retrieves cluster info for a file
-   auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
-      // Evaluate clusters (with local entry numbers) and number of entries for this file
-      const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
-      const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
-      const auto &clusters = clustersAndEntries.first[0];
-      const auto &entries = clustersAndEntries.second[0];
+   // Per-file processing that also retrieves cluster info for a file, or for a group of files
+   auto processFileRetrievingClusters = [&](std::size_t groupIdx) {
+      // Evaluate clusters (with entry numbers local to the group) and number of entries for these files
+      const auto firstFile = fTreeNames.begin() + groupIdx * filesPerGroup;
+      const auto endFile = fTreeNames.begin() + std::min(nFiles, (groupIdx + 1) * filesPerGroup);
+      const std::vector<std::string> treeNames(firstFile, endFile);
+      const std::vector<std::string> fileNames(fFileNames.begin() + (firstFile - fTreeNames.begin()),
+                                               fFileNames.begin() + (endFile - fTreeNames.begin()));
+      auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxRangesPerFile, minRangesPerFile);
+      std::vector<EntryRange> clusters;
+      for (auto &fileClusters : clustersAndEntries.first)
+         clusters.insert(clusters.end(), fileClusters.begin(), fileClusters.end());
+      // the ranges of the files of a group are contiguous: without dynamic scheduling, one task processes them all
+      if (filesPerGroup > 1 && !dynamicScheduling && !clusters.empty())
+         clusters = {EntryRange{clusters.front().first, clusters.back().second}};
+      const auto &entries = clustersAndEntries.second;
       auto processCluster = [&](const EntryRange &c) {
-         auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries},
+         auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, entries,
                                            fSuppressErrorsForMissingBranches);
          func(*r);
       };
-      fPool.Foreach(processCluster, clusters);
+      processClusters(clusters, processCluster);
    };
 
    const auto firstNonEmpty =
@@ -515,10 +590,13 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
    std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
 
-   if (shouldRetrieveAllClusters)
+   if (shouldRetrieveAllClusters) {
       fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
-   else
-      fPool.Foreach(processFileRetrievingClusters, fileIdxs);
+   } else {
+      std::vector<std::size_t> groupIdxs((nFiles + filesPerGroup - 1) / filesPerGroup);
+      std::iota(groupIdxs.begin(), groupIdxs.end(), 0u);
+      fPool.Foreach(processFileRetrievingClusters, groupIdxs);
+   }
 
    // make sure TChains and TFiles are cleaned up since they are not globally tracked
    for (unsigned int islot = 0; islot < fTreeView.GetNSlots(); ++islot) {
@@ -549,3 +627,83 @@ void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve whether clusters are scheduled dynamically.
+/// \return True if dynamic (work-stealing) scheduling of clusters is enabled.
+bool TTreeProcessorMT::GetDynamicScheduling()
+{
+   return fgDynamicScheduling;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Enable or disable dynamic scheduling of clusters.
+/// \param[in] dynamicScheduling Whether clusters should be scheduled dynamically.
+///
+/// By default, the clusters of each file are fused upfront into at most a
+/// fixed number of tasks of similar size in entries (see SetTasksPerWorkerHint()).
+/// If the processing cost per entry is very uneven, a few tasks can then
+/// dominate the runtime while the other workers are idle. With dynamic
+/// scheduling, clusters are not fused upfront: each task repeatedly claims a
+/// chunk of contiguous clusters that shrinks as the file is consumed, down to
+/// single clusters at the end, so that idle workers pick up the remaining work.
+/// Ranges are never split within a cluster, to avoid decompressing the same
+/// baskets in more than one task. The number of calls to the user function,
+/// and the ranges they process, are then not deterministic.
+void TTreeProcessorMT::SetDynamicScheduling(bool dynamicScheduling)
+{
+   fgDynamicScheduling = dynamicScheduling;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve whether clusters are split in sub-ranges.
+/// \return True if the clusters of files with few clusters are split.
+bool TTreeProcessorMT::GetSplitClusters()
+{
+   return fgSplitClusters;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Enable or disable the splitting of clusters in sub-ranges.
+/// \param[in] splitClusters Whether the clusters of files with few clusters should be split.
+///
+/// The entry ranges processed by the tasks are made of whole clusters, so
+/// files with a few huge clusters (e.g. written with a large
+/// TTree::SetAutoFlush) cap the number of tasks, and hence of busy workers,
+/// at their number of clusters. With cluster splitting, the clusters of the
+/// files that have fewer clusters than the desired number of tasks per file
+/// (see SetTasksPerWorkerHint()) are split in sub-ranges of similar size.
+/// Each task only reads and decompresses the baskets that overlap its range:
+/// baskets that span the boundary between two sub-ranges are decompressed by
+/// both tasks, so this is only worth it if the files have several baskets per
+/// cluster and per branch.
+void TTreeProcessorMT::SetSplitClusters(bool splitClusters)
+{
+   fgSplitClusters = splitClusters;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve whether small files are coalesced in bigger tasks.
+/// \return True if consecutive files are processed in groups.
+bool TTreeProcessorMT::GetCoalesceFiles()
+{
+   return fgCoalesceFiles;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Enable or disable the coalescing of files in bigger tasks.
+/// \param[in] coalesceFiles Whether consecutive files should be processed by the same tasks.
+///
+/// Each file is processed by at least one task, which has to set up a
+/// TTreeReader on it. For chains of many small files, this setup can
+/// dominate the processing time. With file coalescing, if there are more
+/// files than the desired number of tasks (see SetTasksPerWorkerHint()),
+/// consecutive files are grouped so that there are about that many groups,
+/// and each group is processed by as few tasks as a single file would be.
+/// This does not apply to datasets with friends or entry lists, or to a
+/// global range of entries, for which the clusters of all files are computed
+/// upfront.
+void TTreeProcessorMT::SetCoalesceFiles(bool coalesceFiles)
+{
+   fgCoalesceFiles = coalesceFiles;
+}
@@ -1,4 +1,6 @@
+#include <TChain.h>
 #include <TFile.h>
+#include <TH2D.h>
 #include <TParameter.h>
 #include <TTree.h>
 #include <TSystem.h>
@@ -433,6 +435,113 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, DynamicScheduling)
+{
+   const auto nEvents = 991;
+   const auto filename = "TreeProcessorMT_DynamicScheduling.root";
+   const auto treename = "t";
+   WriteFileManyClusters(nEvents, treename, filename);
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> clusters;
+   auto nEntries = 0LL;
+   auto get_clusters = [&](TTreeReader &t) {
+      auto n = 0LL;
+      while (t.Next())
+         ++n;
+      std::lock_guard<std::mutex> l(m);
+      clusters.emplace_back(t.GetEntriesRange());
+      nEntries += n;
+   };
+
+   ROOT::TTreeProcessorMT::SetDynamicScheduling(true);
+   for (auto nThreads = 0; nThreads <= 4; ++nThreads) {
+      ROOT::EnableImplicitMT(nThreads);
+
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.Process(get_clusters);
+
+      EXPECT_EQ(nEntries, nEvents);
+      CheckClusters(clusters, nEvents);
+      // the tail of the file is handed out one cluster (of one entry) at a time
+      const auto smallest = std::min_element(clusters.begin(), clusters.end(), [](const auto &c1, const auto &c2) {
+         return c1.second - c1.first < c2.second - c2.first;
+      });
+      EXPECT_EQ(smallest->second - smallest->first, 1LL);
+      clusters.clear();
+      nEntries = 0;
+      ROOT::DisableImplicitMT();
+   }
+   ROOT::TTreeProcessorMT::SetDynamicScheduling(false);
+
+   gSystem->Unlink(filename);
+}
+
+TEST(TreeProcessorMT, SplitClusters)
+{
+   const auto nEvents = 1000;
+   const std::string filename = "TreeProcessorMT_SplitClusters.root";
+   const std::string treename = "t";
+   // a single cluster
+   FilesRAII fr({treename}, {filename}, nEvents);
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   auto nEntries = 0LL;
+   auto get_ranges = [&](TTreeReader &t) {
+      auto n = 0LL;
+      while (t.Next())
+         ++n;
+      std::lock_guard<std::mutex> l(m);
+      ranges.emplace_back(t.GetEntriesRange());
+      nEntries += n;
+   };
+
+   ROOT::TTreeProcessorMT::SetSplitClusters(true);
+   ROOT::EnableImplicitMT(4);
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(get_ranges);
+   ROOT::DisableImplicitMT();
+   ROOT::TTreeProcessorMT::SetSplitClusters(false);
+
+   EXPECT_EQ(nEntries, nEvents);
+   EXPECT_GT(ranges.size(), 1u);
+   CheckClusters(ranges, nEvents);
+}
+
+TEST(TreeProcessorMT, CoalesceFiles)
+{
+   const auto nFiles = 100u;
+   const std::string treename = "t";
+   std::vector<std::string> filenames;
+   for (auto i = 0u; i < nFiles; ++i)
+      filenames.emplace_back("TreeProcessorMT_CoalesceFiles" + std::to_string(i) + ".root");
+   FilesRAII fr(std::vector<std::string>(nFiles, treename), filenames);
+
+   std::atomic_int sum(0);
+   std::atomic_int count(0);
+   std::atomic_int nTasks(0);
+   auto sumValues = [&](TTreeReader &r) {
+      TTreeReaderValue<int> v(r, "v");
+      while (r.Next()) {
+         sum += *v;
+         ++count;
+      }
+      ++nTasks;
+   };
+
+   ROOT::TTreeProcessorMT::SetCoalesceFiles(true);
+   ROOT::EnableImplicitMT(2);
+   ROOT::TTreeProcessorMT proc(std::vector<std::string_view>(filenames.begin(), filenames.end()), treename);
+   proc.Process(sumValues);
+   ROOT::DisableImplicitMT();
+   ROOT::TTreeProcessorMT::SetCoalesceFiles(false);
+
+   EXPECT_EQ(count.load(), int(nFiles * 10)); // 10 entries per file
+   EXPECT_EQ(sum.load(), 500500);             // sum of [1..nFiles*nEntriesPerFile] inclusive
+   EXPECT_LT(nTasks.load(), int(nFiles));
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};
@@ -589,3 +698,39 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+TEST(TreeProcessorMT, TTreeDraw)
+{
+   const std::vector<std::string> filenames = {"treeprocmt_draw0.root", "treeprocmt_draw1.root"};
+   WriteFiles({"t", "t"}, filenames, 1000);
+
+   TChain c("t");
+   for (const auto &f : filenames)
+      c.Add(f.c_str());
+   TH1D h1seq("h1seq", "", 50, 0., 2000.);
+   TH2D h2seq("h2seq", "", 20, 0., 2000., 20, 0., 10.);
+   c.Draw("v>>h1seq", "v % 3 ? 2 : 1", "goff");
+   c.Draw("v % 10:v>>h2seq", "v > 100", "goff");
+
+   ROOT::EnableImplicitMT(4);
+   TH1D h1("h1", "", 50, 0., 2000.);
+   TH2D h2("h2", "", 20, 0., 2000., 20, 0., 10.);
+   EXPECT_EQ(c.Draw("v>>h1", "v % 3 ? 2 : 1", "goff"), 2000);
+   EXPECT_EQ(c.Draw("v % 10:v>>h2", "v > 100", "goff"), 1900);
+   // "+" adds to the histogram, the entry range is honoured
+   EXPECT_EQ(c.Draw("v>>+h1", "", "goff", 500, 1000), 500);
+   ROOT::DisableImplicitMT();
+
+   c.Draw("v>>+h1seq", "", "goff", 500, 1000);
+   EXPECT_EQ(h1.GetEntries(), h1seq.GetEntries());
+   EXPECT_DOUBLE_EQ(h1.GetMean(), h1seq.GetMean());
+   for (int i = 0; i <= h1.GetNbinsX() + 1; ++i) {
+      EXPECT_DOUBLE_EQ(h1.GetBinContent(i), h1seq.GetBinContent(i));
+      EXPECT_DOUBLE_EQ(h1.GetBinError(i), h1seq.GetBinError(i));
+   }
+   EXPECT_EQ(h2.GetEntries(), h2seq.GetEntries());
+   for (int i = 0; i < h2.GetNcells(); ++i)
+      EXPECT_DOUBLE_EQ(h2.GetBinContent(i), h2seq.GetBinContent(i));
+
+   DeleteFiles(filenames);
+}
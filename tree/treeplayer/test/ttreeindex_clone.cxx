@@ -2,13 +2,17 @@
 #include "TChain.h"
 #include "TChainIndex.h"
 #include "TFile.h"
+#include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
 #include "TTreeIndex.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <string>
+#include <tuple>
+#include <vector>
 
 template <typename T>
 void expect_vec_eq(const std::vector<T> &v1, const std::vector<T> &v2)
@@ -217,3 +221,53 @@ TEST(TTreeIndexClone, TTreeIndex)
    gSystem->Unlink(mainFile);
    gSystem->Unlink(auxFile);
 }
+
+#ifdef R__USE_IMT
+TEST(TTreeIndex, BuildInParallel)
+{
+   const auto fileNames = {"ttreeindex_parallel_0.root", "ttreeindex_parallel_1.root"};
+   const int nPerFile = 150000;
+   int fileIdx = 0;
+   for (auto fileName : fileNames) {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int run = 0;
+      int event = 0;
+      t.Branch("run", &run);
+      t.Branch("event", &event);
+      for (int i = 0; i < nPerFile; ++i) {
+         run = (i * 7919 + fileIdx) % 13;
+         event = (nPerFile - i) * 2 + fileIdx;
+         t.Fill();
+      }
+      t.Write();
+      ++fileIdx;
+   }
+
+   auto buildIndex = [&](bool imt) {
+      if (imt)
+         ROOT::EnableImplicitMT(4);
+      else
+         ROOT::DisableImplicitMT();
+      TChain c("t");
+      for (auto fileName : fileNames)
+         c.Add(fileName);
+      TTreeIndex index(&c, "run", "event");
+      EXPECT_EQ(index.GetN(), 2 * nPerFile);
+      std::vector<Long64_t> entries(index.GetIndex(), index.GetIndex() + index.GetN());
+      std::vector<Long64_t> majors(index.GetIndexValues(), index.GetIndexValues() + index.GetN());
+      std::vector<Long64_t> minors(index.GetIndexValuesMinor(), index.GetIndexValuesMinor() + index.GetN());
+      return std::make_tuple(entries, majors, minors);
+   };
+   const auto sequential = buildIndex(false);
+   const auto parallel = buildIndex(true);
+   ROOT::DisableImplicitMT();
+   EXPECT_EQ(std::get<0>(sequential), std::get<0>(parallel));
+   EXPECT_EQ(std::get<1>(sequential), std::get<1>(parallel));
+   EXPECT_EQ(std::get<2>(sequential), std::get<2>(parallel));
+   EXPECT_TRUE(std::is_sorted(std::get<1>(parallel).begin(), std::get<1>(parallel).end()));
+
+   for (auto fileName : fileNames)
+      gSystem->Unlink(fileName);
+}
+#endif // R__USE_IMT